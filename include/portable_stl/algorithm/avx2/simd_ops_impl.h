@@ -0,0 +1,669 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="simd_ops_impl.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SIMD_OPS_IMPL_H
+#define PSTL_SIMD_OPS_IMPL_H
+#include <immintrin.h>
+
+#include "../../common/size_t.h"
+#include "../../common/uint32_t.h"
+#include "../../metaprogramming/helper/integral_constant.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief AVX2 operations common for the integers.
+   */
+  class simd_integer_ops_base {
+  public:
+    /**
+     * @brief Vector type.
+     */
+    using vector_type  = __m256i;
+    /**
+     * @brief The operations are available.
+     */
+    using is_supported = ::portable_stl::true_type;
+
+    /**
+     * @brief Loads the vector from the unaligned address.
+     * @param ptr the address.
+     * @return the vector.
+     */
+    static vector_type load(void const *ptr) noexcept {
+      return _mm256_loadu_si256(static_cast<__m256i const *>(ptr));
+    }
+
+    /**
+     * @brief Stores the vector to the unaligned address.
+     * @param ptr the address.
+     * @param value the vector.
+     */
+    static void store(void *ptr, vector_type value) noexcept {
+      _mm256_storeu_si256(static_cast<__m256i *>(ptr), value);
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the vector which have the highest bit set.
+     * @param value the vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t byte_mask(vector_type value) noexcept {
+      return static_cast<::portable_stl::uint32_t>(_mm256_movemask_epi8(value));
+    }
+  };
+
+  /**
+   * @brief AVX2 operations on the integers of the given size and signedness.
+   * The primary template has no operations.
+   * @tparam t_size the size of the integer in bytes.
+   * @tparam t_signed the integer is signed.
+   */
+  template<::portable_stl::size_t t_size, bool t_signed> class simd_integer_ops final {
+  public:
+    /**
+     * @brief The operations are not available.
+     */
+    using is_supported = ::portable_stl::false_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is not available.
+     */
+    using has_add      = ::portable_stl::false_type;
+  };
+
+  /**
+   * @brief AVX2 operations on the signed 8-bit integers.
+   */
+  template<> class simd_integer_ops<1U, true> final : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm256_set1_epi8(static_cast<char>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm256_cmpeq_epi8(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return _mm256_min_epi8(left, right);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return _mm256_max_epi8(left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_epi8(left, right);
+    }
+  };
+
+  /**
+   * @brief AVX2 operations on the unsigned 8-bit integers.
+   */
+  template<> class simd_integer_ops<1U, false> final : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm256_set1_epi8(static_cast<char>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm256_cmpeq_epi8(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return _mm256_min_epu8(left, right);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return _mm256_max_epu8(left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_epi8(left, right);
+    }
+  };
+
+  /**
+   * @brief AVX2 operations on the signed 16-bit integers.
+   */
+  template<> class simd_integer_ops<2U, true> final : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm256_set1_epi16(static_cast<short>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm256_cmpeq_epi16(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return _mm256_min_epi16(left, right);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return _mm256_max_epi16(left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_epi16(left, right);
+    }
+  };
+
+  /**
+   * @brief AVX2 operations on the unsigned 16-bit integers.
+   */
+  template<> class simd_integer_ops<2U, false> final : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm256_set1_epi16(static_cast<short>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm256_cmpeq_epi16(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return _mm256_min_epu16(left, right);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return _mm256_max_epu16(left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_epi16(left, right);
+    }
+  };
+
+  /**
+   * @brief AVX2 operations on the signed 32-bit integers.
+   */
+  template<> class simd_integer_ops<4U, true> final : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm256_set1_epi32(static_cast<int>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm256_cmpeq_epi32(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return _mm256_min_epi32(left, right);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return _mm256_max_epi32(left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_epi32(left, right);
+    }
+  };
+
+  /**
+   * @brief AVX2 operations on the unsigned 32-bit integers.
+   */
+  template<> class simd_integer_ops<4U, false> final : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm256_set1_epi32(static_cast<int>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm256_cmpeq_epi32(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return _mm256_min_epu32(left, right);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return _mm256_max_epu32(left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_epi32(left, right);
+    }
+  };
+
+  /**
+   * @brief AVX2 operations on the 64-bit integers, without min and max (AVX2 has no 64-bit min and max).
+   */
+  class simd_integer64_ops : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm256_cmpeq_epi64(left, right));
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_epi64(left, right);
+    }
+  };
+
+  /**
+   * @brief AVX2 operations on the signed 64-bit integers.
+   */
+  template<> class simd_integer_ops<8U, true> final : public simd_integer64_ops {};
+
+  /**
+   * @brief AVX2 operations on the unsigned 64-bit integers.
+   */
+  template<> class simd_integer_ops<8U, false> final : public simd_integer64_ops {};
+
+  /**
+   * @brief AVX operations on float, the comparison follows operator== (NaN is not equal to itself, -0 is equal to
+   * +0), without min and max which would not keep the order of NaN.
+   */
+  class simd_float_ops final {
+  public:
+    /**
+     * @brief Vector type.
+     */
+    using vector_type  = __m256;
+    /**
+     * @brief The operations are available.
+     */
+    using is_supported = ::portable_stl::true_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add      = ::portable_stl::true_type;
+
+    /**
+     * @brief Loads the vector from the unaligned address.
+     * @param ptr the address.
+     * @return the vector.
+     */
+    static vector_type load(void const *ptr) noexcept {
+      return _mm256_loadu_ps(static_cast<float const *>(ptr));
+    }
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    static vector_type broadcast(float value) noexcept {
+      return _mm256_set1_ps(value);
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return static_cast<::portable_stl::uint32_t>(
+        _mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(left, right, _CMP_EQ_OQ))));
+    }
+
+    /**
+     * @brief Stores the vector to the unaligned address.
+     * @param ptr the address.
+     * @param value the vector.
+     */
+    static void store(void *ptr, vector_type value) noexcept {
+      _mm256_storeu_ps(static_cast<float *>(ptr), value);
+    }
+
+    /**
+     * @brief Adds the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_ps(left, right);
+    }
+  };
+
+  /**
+   * @brief AVX operations on double, the comparison follows operator==, without min and max.
+   */
+  class simd_double_ops final {
+  public:
+    /**
+     * @brief Vector type.
+     */
+    using vector_type  = __m256d;
+    /**
+     * @brief The operations are available.
+     */
+    using is_supported = ::portable_stl::true_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add      = ::portable_stl::true_type;
+
+    /**
+     * @brief Loads the vector from the unaligned address.
+     * @param ptr the address.
+     * @return the vector.
+     */
+    static vector_type load(void const *ptr) noexcept {
+      return _mm256_loadu_pd(static_cast<double const *>(ptr));
+    }
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    static vector_type broadcast(double value) noexcept {
+      return _mm256_set1_pd(value);
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return static_cast<::portable_stl::uint32_t>(
+        _mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(left, right, _CMP_EQ_OQ))));
+    }
+
+    /**
+     * @brief Stores the vector to the unaligned address.
+     * @param ptr the address.
+     * @param value the vector.
+     */
+    static void store(void *ptr, vector_type value) noexcept {
+      _mm256_storeu_pd(static_cast<double *>(ptr), value);
+    }
+
+    /**
+     * @brief Adds the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm256_add_pd(left, right);
+    }
+  };
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_SIMD_OPS_IMPL_H
@@ -0,0 +1,53 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="binary_search.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BINARY_SEARCH_H
+#define PSTL_BINARY_SEARCH_H
+
+#include "../functional/less.h"
+#include "lower_bound.h"
+
+namespace portable_stl {
+/**
+ * @brief Checks if an element equivalent to value appears within the sorted range [first, last).
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_value the type of the value.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value to compare the elements to.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return true if an element equivalent to value is found, false otherwise.
+ */
+template<class t_forward_iterator, class t_value, class t_compare>
+bool binary_search(t_forward_iterator first, t_forward_iterator last, t_value const &value, t_compare comp) {
+  first = ::portable_stl::lower_bound(first, last, value, comp);
+  return (first != last) && (!comp(value, *first));
+}
+
+/**
+ * @brief Checks if an element equivalent to value appears within the sorted range [first, last).
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_value the type of the value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value to compare the elements to.
+ * @return true if an element equivalent to value is found, false otherwise.
+ */
+template<class t_forward_iterator, class t_value>
+inline bool binary_search(t_forward_iterator first, t_forward_iterator last, t_value const &value) {
+  return ::portable_stl::binary_search(first, last, value, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_BINARY_SEARCH_H
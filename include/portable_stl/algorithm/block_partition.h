@@ -0,0 +1,191 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="block_partition.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BLOCK_PARTITION_H
+#define PSTL_BLOCK_PARTITION_H
+
+#include "../common/size_t.h"
+#include "../iterator/iterator_traits.h"
+#include "../utility/general/move.h"
+#include "algo_iter_swap.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief The number of elements in one block of the branchless partition.
+   */
+  constexpr ::portable_stl::size_t partition_block_size{64U};
+
+  /**
+   * @brief Moves the elements at the collected offsets across the partition.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @param left_base the base of the left offsets.
+   * @param right_base the base of the right offsets.
+   * @param left_offsets the offsets of the elements which belong to the right part.
+   * @param right_offsets the offsets of the elements which belong to the left part.
+   * @param num the number of the elements to exchange.
+   * @param use_swaps swap the pairs instead of the cyclic permutation, needed for the descending ranges.
+   */
+  template<class t_random_access_iterator>
+  void partition_swap_offsets(t_random_access_iterator left_base,
+                              t_random_access_iterator right_base,
+                              unsigned char const     *left_offsets,
+                              unsigned char const     *right_offsets,
+                              ::portable_stl::size_t   num,
+                              bool                     use_swaps) {
+    using value_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+
+    if (use_swaps) {
+      for (::portable_stl::size_t i{0U}; i < num; ++i) {
+        ::portable_stl::algo_iter_swap(left_base + left_offsets[i], right_base - right_offsets[i]);
+      }
+    } else if (num > 0U) {
+      t_random_access_iterator left{left_base + left_offsets[0]};
+      t_random_access_iterator right{right_base - right_offsets[0]};
+      value_type               tmp(::portable_stl::move(*left));
+      *left = ::portable_stl::move(*right);
+      for (::portable_stl::size_t i{1U}; i < num; ++i) {
+        left   = left_base + left_offsets[i];
+        *right = ::portable_stl::move(*left);
+        right  = right_base - right_offsets[i];
+        *left  = ::portable_stl::move(*right);
+      }
+      *right = ::portable_stl::move(tmp);
+    }
+  }
+
+  /**
+   * @brief Reorders [first, last) so that the elements satisfying the predicate precede the others, without the data
+   * dependent branches: the offsets of the misplaced elements are collected into small blocks from both ends and the
+   * elements are exchanged block by block (BlockQuicksort scheme).
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate which returns true if the element belongs to the left part.
+   * @return the beginning of the right part.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator block_partition(t_random_access_iterator first,
+                                           t_random_access_iterator last,
+                                           t_predicate             &pred) {
+    unsigned char            left_offsets[partition_block_size];
+    unsigned char            right_offsets[partition_block_size];
+    t_random_access_iterator left{first};
+    t_random_access_iterator right{last};
+    t_random_access_iterator left_base{left};
+    t_random_access_iterator right_base{right};
+    ::portable_stl::size_t   left_num{0U};
+    ::portable_stl::size_t   right_num{0U};
+    ::portable_stl::size_t   left_start{0U};
+    ::portable_stl::size_t   right_start{0U};
+
+    while (left < right) {
+      // fill the empty offset blocks, split the unknown elements between them if both are empty
+      auto const             unknown = static_cast<::portable_stl::size_t>(right - left);
+      ::portable_stl::size_t left_split{(0U == left_num) ? ((0U == right_num) ? (unknown / 2U) : unknown) : 0U};
+      ::portable_stl::size_t right_split{(0U == right_num) ? (unknown - left_split) : 0U};
+      if (left_split > partition_block_size) {
+        left_split = partition_block_size;
+      }
+      if (right_split > partition_block_size) {
+        right_split = partition_block_size;
+      }
+
+      for (::portable_stl::size_t i{0U}; i < left_split; ++i) {
+        left_offsets[left_num]  = static_cast<unsigned char>(i);
+        left_num               += static_cast<::portable_stl::size_t>(!pred(*left));
+        ++left;
+      }
+      for (::portable_stl::size_t i{0U}; i < right_split; ++i) {
+        right_offsets[right_num]  = static_cast<unsigned char>(i + 1U);
+        right_num                += static_cast<::portable_stl::size_t>(static_cast<bool>(pred(*--right)));
+      }
+
+      ::portable_stl::size_t const num{(left_num < right_num) ? left_num : right_num};
+      ::portable_stl::algorithm_helper::partition_swap_offsets(
+        left_base, right_base, left_offsets + left_start, right_offsets + right_start, num, left_num == right_num);
+      left_num    -= num;
+      right_num   -= num;
+      left_start  += num;
+      right_start += num;
+
+      if (0U == left_num) {
+        left_start = 0U;
+        left_base  = left;
+      }
+      if (0U == right_num) {
+        right_start = 0U;
+        right_base  = right;
+      }
+    }
+
+    // the rest of one block is exchanged with the elements at the boundary
+    if (0U != left_num) {
+      while (0U != left_num) {
+        --left_num;
+        ::portable_stl::algo_iter_swap(left_base + left_offsets[left_start + left_num], --right);
+      }
+      left = right;
+    }
+    if (0U != right_num) {
+      while (0U != right_num) {
+        --right_num;
+        ::portable_stl::algo_iter_swap(right_base - right_offsets[right_start + right_num], left);
+        ++left;
+      }
+    }
+    return left;
+  }
+
+  /**
+   * @brief Moves the elements which do not satisfy the predicate to the beginning of [first, last) keeping their
+   * order, without the data dependent branches: the offsets of the kept elements are collected into a small block
+   * and the elements are moved block by block.
+   * UB: *first satisfies the predicate.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate which returns true if the element should be removed.
+   * @return the end of the kept elements.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator block_remove_if(t_random_access_iterator first,
+                                           t_random_access_iterator last,
+                                           t_predicate             &pred) {
+    unsigned char            offsets[partition_block_size];
+    t_random_access_iterator result{first};
+
+    // the kept elements are always moved to the preceding positions
+    for (++first; first < last;) {
+      auto const remaining = static_cast<::portable_stl::size_t>(last - first);
+      ::portable_stl::size_t const block{(remaining < partition_block_size) ? remaining : partition_block_size};
+      ::portable_stl::size_t       num{0U};
+      for (::portable_stl::size_t i{0U}; i < block; ++i) {
+        offsets[num]  = static_cast<unsigned char>(i);
+        num          += static_cast<::portable_stl::size_t>(!pred(first[i]));
+      }
+      for (::portable_stl::size_t i{0U}; i < num; ++i) {
+        *result = ::portable_stl::move(first[offsets[i]]);
+        ++result;
+      }
+      first += block;
+    }
+    return result;
+  }
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_BLOCK_PARTITION_H
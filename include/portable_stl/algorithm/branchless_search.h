@@ -0,0 +1,143 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="branchless_search.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BRANCHLESS_SEARCH_H
+#define PSTL_BRANCHLESS_SEARCH_H
+
+#include "../iterator/iterator_traits.h"
+#include "../memory/prefetch.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Prefetches the element of the contiguous range.
+   * @tparam t_type the type of the element.
+   * @param ptr the pointer to the element.
+   */
+  template<class t_type> inline void search_prefetch(t_type *ptr) noexcept {
+    ::portable_stl::prefetch(ptr);
+  }
+
+  /**
+   * @brief No prefetch for the iterators which are not pointers.
+   * @tparam t_iterator the type of iterator.
+   */
+  template<class t_iterator> inline void search_prefetch(t_iterator const &) noexcept {
+  }
+
+  /**
+   * @brief Predicate of lower_bound: the element is less than the value.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   */
+  template<class t_value, class t_compare> class lower_bound_predicate final {
+    /**
+     * @brief The searched value.
+     */
+    t_value const &m_value;
+    /**
+     * @brief The comparison function object.
+     */
+    t_compare     &m_comp;
+
+  public:
+    /**
+     * @brief Constructor.
+     * @param value the searched value.
+     * @param comp the comparison function object.
+     */
+    lower_bound_predicate(t_value const &value, t_compare &comp) noexcept : m_value(value), m_comp(comp) {
+    }
+
+    /**
+     * @brief Checks the element.
+     * @tparam t_type the type of the element.
+     * @param element the element.
+     * @return true if the element is less than the value.
+     */
+    template<class t_type> bool operator()(t_type const &element) const {
+      return m_comp(element, m_value);
+    }
+  };
+
+  /**
+   * @brief Predicate of upper_bound: the element is not greater than the value.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   */
+  template<class t_value, class t_compare> class upper_bound_predicate final {
+    /**
+     * @brief The searched value.
+     */
+    t_value const &m_value;
+    /**
+     * @brief The comparison function object.
+     */
+    t_compare     &m_comp;
+
+  public:
+    /**
+     * @brief Constructor.
+     * @param value the searched value.
+     * @param comp the comparison function object.
+     */
+    upper_bound_predicate(t_value const &value, t_compare &comp) noexcept : m_value(value), m_comp(comp) {
+    }
+
+    /**
+     * @brief Checks the element.
+     * @tparam t_type the type of the element.
+     * @param element the element.
+     * @return true if the value is not less than the element.
+     */
+    template<class t_type> bool operator()(t_type const &element) const {
+      return !m_comp(m_value, element);
+    }
+  };
+
+  /**
+   * @brief Finds the first element of the partitioned range [first, first + len) for which pred returns false.
+   * The loop has a fixed number of iterations for the given length and no data dependent branches: the probe only
+   * decides whether the base moves by half, which compiles to a conditional move. Both candidates of the next probe
+   * are prefetched for the contiguous ranges, so the memory latency of the two levels overlaps.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of the predicate.
+   * @param first the beginning of the range.
+   * @param len the length of the range.
+   * @param pred the predicate, true for the elements of the first part.
+   * @return the iterator to the found element or first + len.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator branchless_partition_point(
+    t_random_access_iterator                                                          first,
+    typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type len,
+    t_predicate                                                                      &pred) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    if (len <= 0) {
+      return first;
+    }
+    while (len > 1) {
+      difference_type const half{len / 2};
+      difference_type const next_half{(len - half) / 2};
+      ::portable_stl::algorithm_helper::search_prefetch(first + next_half);
+      ::portable_stl::algorithm_helper::search_prefetch(first + (half + next_half));
+      first += static_cast<difference_type>(pred(first[half])) * half;
+      len   -= half;
+    }
+    first += static_cast<difference_type>(pred(*first));
+    return first;
+  }
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_BRANCHLESS_SEARCH_H
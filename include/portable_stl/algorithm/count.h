@@ -0,0 +1,83 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="count.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_COUNT_H
+#define PSTL_COUNT_H
+
+#include "../iterator/iterator_traits.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "simd_scan.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Counts the elements equal to value by the scalar loop.
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_type the type of the value.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the number of the elements.
+   */
+  template<class t_input_iterator, class t_type>
+  typename ::portable_stl::iterator_traits<t_input_iterator>::difference_type count_dispatch(
+    t_input_iterator first, t_input_iterator last, t_type const &value, ::portable_stl::false_type) {
+    typename ::portable_stl::iterator_traits<t_input_iterator>::difference_type result{0};
+    for (; first != last; ++first) {
+      if (*first == value) {
+        ++result;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Counts the elements equal to value by the vector loops over the contiguous range.
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_type the type of the value.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the number of the elements.
+   */
+  template<class t_input_iterator, class t_type>
+  typename ::portable_stl::iterator_traits<t_input_iterator>::difference_type count_dispatch(
+    t_input_iterator first, t_input_iterator last, t_type const &value, ::portable_stl::true_type) {
+    simd_element_t<t_input_iterator> needle;
+    if (!simd_needle(value, needle)) {
+      return 0;
+    }
+    return static_cast<typename ::portable_stl::iterator_traits<t_input_iterator>::difference_type>(
+      simd_count<simd_element_t<t_input_iterator>>(
+        ::portable_stl::unwrap_iter(first), ::portable_stl::unwrap_iter(last), needle));
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Returns the number of elements in the range [first, last) that are equal to value.
+ *
+ * @tparam t_input_iterator
+ * @tparam t_type
+ * @param first The range of elements to examine.
+ * @param last The range of elements to examine.
+ * @param value Value to search for.
+ * @return Number of elements equal to value.
+ */
+template<class t_input_iterator, class t_type>
+inline typename ::portable_stl::iterator_traits<t_input_iterator>::difference_type count(
+  t_input_iterator first, t_input_iterator last, t_type const &value) {
+  return ::portable_stl::algorithm_helper::count_dispatch(
+    first, last, value, ::portable_stl::algorithm_helper::simd_find_tag<t_input_iterator, t_type>{});
+}
+
+} // namespace portable_stl
+
+#endif // PSTL_COUNT_H
@@ -22,12 +22,17 @@ namespace portable_stl {
 
 /**
  * @brief Count trailing zeros, are used to count the amount of zeros at the end of the numbers binary representation.
+ * UB: value is zero.
  *
+ * @tparam t_unsigned the unsigned integer type up to 64 bits.
  * @param value
  * @return ::portable_stl::int32_t
  */
-inline ::portable_stl::int32_t ctz(::portable_stl::uint32_t value) noexcept {
-  return algorithm_helper::ctz_impl(value);
+template<class t_unsigned> inline ::portable_stl::int32_t ctz(t_unsigned value) noexcept {
+  static_assert(sizeof(t_unsigned) <= sizeof(::portable_stl::uint64_t), "ctz supports up to 64-bit integers");
+  return (sizeof(t_unsigned) <= sizeof(::portable_stl::uint32_t))
+         ? algorithm_helper::ctz_impl(static_cast<::portable_stl::uint32_t>(value))
+         : algorithm_helper::ctz_impl(static_cast<::portable_stl::uint64_t>(value));
 }
 } // namespace portable_stl
 
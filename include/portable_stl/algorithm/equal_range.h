@@ -0,0 +1,62 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="equal_range.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EQUAL_RANGE_H
+#define PSTL_EQUAL_RANGE_H
+
+#include "../functional/less.h"
+#include "../utility/tuple/tuple.h"
+#include "lower_bound.h"
+#include "upper_bound.h"
+
+namespace portable_stl {
+/**
+ * @brief Returns the range of the elements of the sorted range [first, last) equivalent to value.
+ * The upper bound is searched only in the part starting from the lower bound.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_value the type of the value.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value to compare the elements to.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return the lower and the upper bound.
+ */
+template<class t_forward_iterator, class t_value, class t_compare>
+::portable_stl::tuple<t_forward_iterator, t_forward_iterator> equal_range(t_forward_iterator first,
+                                                                          t_forward_iterator last,
+                                                                          t_value const     &value,
+                                                                          t_compare          comp) {
+  t_forward_iterator const lower{::portable_stl::lower_bound(first, last, value, comp)};
+  return ::portable_stl::tuple<t_forward_iterator, t_forward_iterator>(
+    lower, ::portable_stl::upper_bound(lower, last, value, comp));
+}
+
+/**
+ * @brief Returns the range of the elements of the sorted range [first, last) equivalent to value.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_value the type of the value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value to compare the elements to.
+ * @return the lower and the upper bound.
+ */
+template<class t_forward_iterator, class t_value>
+inline ::portable_stl::tuple<t_forward_iterator, t_forward_iterator> equal_range(t_forward_iterator first,
+                                                                                 t_forward_iterator last,
+                                                                                 t_value const     &value) {
+  return ::portable_stl::equal_range(first, last, value, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EQUAL_RANGE_H
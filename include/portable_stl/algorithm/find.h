@@ -12,7 +12,53 @@
 #ifndef PSTL_FIND_H
 #define PSTL_FIND_H
 
+#include "../metaprogramming/helper/integral_constant.h"
+#include "simd_scan.h"
+
 namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Finds the first element equal to value by the scalar loop.
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_type the type of the value.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the iterator to the element or last if there is no such element.
+   */
+  template<class t_input_iterator, class t_type>
+  t_input_iterator find_dispatch(
+    t_input_iterator first, t_input_iterator last, t_type const &value, ::portable_stl::false_type) {
+    for (; first != last; ++first) {
+      if (*first == value) {
+        break;
+      }
+    }
+    return first;
+  }
+
+  /**
+   * @brief Finds the first element equal to value by the vector loops over the contiguous range.
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_type the type of the value.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the iterator to the element or last if there is no such element.
+   */
+  template<class t_input_iterator, class t_type>
+  t_input_iterator find_dispatch(
+    t_input_iterator first, t_input_iterator last, t_type const &value, ::portable_stl::true_type) {
+    simd_element_t<t_input_iterator> needle;
+    if (!simd_needle(value, needle)) {
+      return last;
+    }
+    auto const unwrapped_first = ::portable_stl::unwrap_iter(first);
+    return first
+         + (simd_find<simd_element_t<t_input_iterator>>(unwrapped_first, ::portable_stl::unwrap_iter(last), needle)
+            - unwrapped_first);
+  }
+} // namespace algorithm_helper
 
 /**
  * @brief Returns an iterator to the first element in the range [first, last) that satisfies specific criteria (or last
@@ -27,12 +73,8 @@ namespace portable_stl {
  */
 template<class t_input_iterator, class t_type>
 inline t_input_iterator find(t_input_iterator first, t_input_iterator last, t_type const &value) {
-  for (; first != last; ++first) {
-    if (*first == value) {
-      break;
-    }
-  }
-  return first;
+  return ::portable_stl::algorithm_helper::find_dispatch(
+    first, last, value, ::portable_stl::algorithm_helper::simd_find_tag<t_input_iterator, t_type>{});
 }
 
 } // namespace portable_stl
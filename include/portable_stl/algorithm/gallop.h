@@ -0,0 +1,397 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="gallop.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_GALLOP_H
+#define PSTL_GALLOP_H
+
+#include "../common/size_t.h"
+#include "../iterator/advance.h"
+#include "../iterator/distance.h"
+#include "../iterator/input_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "copy.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief The ratio of the range lengths starting from which the merge and set operations search the end of every run
+   * of the longer range by exponential search instead of walking it element by element.
+   */
+  constexpr ::portable_stl::size_t gallop_skew_ratio{8U};
+
+  /**
+   * @brief Finds the first element of the sorted range [first, last) which is not less than value by binary search.
+   *
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value to compare the elements to.
+   * @param comp the comparison function object.
+   * @return the iterator to the found element or last.
+   */
+  template<class t_forward_iterator, class t_value, class t_compare>
+  t_forward_iterator lower_bound_impl(t_forward_iterator first,
+                                      t_forward_iterator last,
+                                      t_value const     &value,
+                                      t_compare         &comp) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_forward_iterator>::difference_type;
+
+    difference_type len{::portable_stl::distance(first, last)};
+    while (len > 0) {
+      difference_type const half{len / 2};
+      t_forward_iterator    middle{first};
+      ::portable_stl::advance(middle, half);
+      if (comp(*middle, value)) {
+        first = ++middle;
+        len  -= half + 1;
+      } else {
+        len = half;
+      }
+    }
+    return first;
+  }
+
+  /**
+   * @brief Finds the first element of the sorted range [first, last) which is greater than value by binary search.
+   *
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value to compare the elements to.
+   * @param comp the comparison function object.
+   * @return the iterator to the found element or last.
+   */
+  template<class t_forward_iterator, class t_value, class t_compare>
+  t_forward_iterator upper_bound_impl(t_forward_iterator first,
+                                      t_forward_iterator last,
+                                      t_value const     &value,
+                                      t_compare         &comp) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_forward_iterator>::difference_type;
+
+    difference_type len{::portable_stl::distance(first, last)};
+    while (len > 0) {
+      difference_type const half{len / 2};
+      t_forward_iterator    middle{first};
+      ::portable_stl::advance(middle, half);
+      if (!comp(value, *middle)) {
+        first = ++middle;
+        len  -= half + 1;
+      } else {
+        len = half;
+      }
+    }
+    return first;
+  }
+
+  /**
+   * @brief Finds the first element of the sorted range [first, last) for which pred returns false by probing the
+   * elements at the offsets 0, 1, 3, 7, ... and the binary search between the last two probes. The cost is logarithmic
+   * in the distance to the found element, not in the length of the range.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of the predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate which is true for the elements of the run and false for all the following elements.
+   * @return the end of the run.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator gallop(t_random_access_iterator first, t_random_access_iterator last, t_predicate pred) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    difference_type const len{last - first};
+    // the elements before first + low satisfy pred, the element at first + high (if any) does not
+    difference_type       low{0};
+    difference_type       high{0};
+    difference_type       step{1};
+    while ((high < len) && pred(*(first + high))) {
+      low   = high + 1;
+      high += step;
+      step *= 2;
+    }
+    if (high > len) {
+      high = len;
+    }
+
+    while (low < high) {
+      difference_type const middle{low + (high - low) / 2};
+      if (pred(*(first + middle))) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    return first + low;
+  }
+
+  /**
+   * @brief Checks if the lengths of the ranges differ enough to search the runs by exponential search.
+   * Only random access ranges are measured.
+   *
+   * @tparam t_iterator1 the type of the first range iterator.
+   * @tparam t_iterator2 the type of the second range iterator.
+   * @return false.
+   */
+  template<class t_iterator1, class t_iterator2>
+  bool is_skewed(t_iterator1,
+                 t_iterator1,
+                 t_iterator2,
+                 t_iterator2,
+                 ::portable_stl::input_iterator_tag,
+                 ::portable_stl::input_iterator_tag) {
+    return false;
+  }
+
+  /**
+   * @brief Checks if the lengths of the ranges differ enough to search the runs by exponential search.
+   *
+   * @tparam t_iterator1 the type of the first range iterator.
+   * @tparam t_iterator2 the type of the second range iterator.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param last2 the end of the second range.
+   * @return true if one range is at least gallop_skew_ratio times longer than the other one.
+   */
+  template<class t_iterator1, class t_iterator2>
+  bool is_skewed(t_iterator1 first1,
+                 t_iterator1 last1,
+                 t_iterator2 first2,
+                 t_iterator2 last2,
+                 ::portable_stl::random_access_iterator_tag,
+                 ::portable_stl::random_access_iterator_tag) {
+    ::portable_stl::size_t const len1{static_cast<::portable_stl::size_t>(last1 - first1)};
+    ::portable_stl::size_t const len2{static_cast<::portable_stl::size_t>(last2 - first2)};
+    return (len1 / ::portable_stl::algorithm_helper::gallop_skew_ratio >= len2)
+        || (len2 / ::portable_stl::algorithm_helper::gallop_skew_ratio >= len1);
+  }
+
+  /**
+   * @brief Checks if the lengths of the ranges differ enough to search the runs by exponential search.
+   *
+   * @tparam t_iterator1 the type of the first range iterator.
+   * @tparam t_iterator2 the type of the second range iterator.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param last2 the end of the second range.
+   * @return true if the runs should be searched by exponential search.
+   */
+  template<class t_iterator1, class t_iterator2>
+  bool is_skewed(t_iterator1 first1, t_iterator1 last1, t_iterator2 first2, t_iterator2 last2) {
+    return ::portable_stl::algorithm_helper::is_skewed(
+      first1,
+      last1,
+      first2,
+      last2,
+      typename ::portable_stl::iterator_traits<t_iterator1>::iterator_category{},
+      typename ::portable_stl::iterator_traits<t_iterator2>::iterator_category{});
+  }
+
+  /**
+   * @brief Skips the elements of [first, last) for which pred returns true one by one.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_predicate the type of the predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate which is true for the elements of the run.
+   * @return the end of the run.
+   */
+  template<class t_input_iterator, class t_predicate>
+  t_input_iterator skip_run(
+    t_input_iterator first, t_input_iterator last, t_predicate pred, bool, ::portable_stl::input_iterator_tag) {
+    while ((first != last) && pred(*first)) {
+      ++first;
+    }
+    return first;
+  }
+
+  /**
+   * @brief Skips the elements of [first, last) for which pred returns true.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of the predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate which is true for the elements of the run.
+   * @param skewed use the exponential search instead of the linear one.
+   * @return the end of the run.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator skip_run(t_random_access_iterator first,
+                                    t_random_access_iterator last,
+                                    t_predicate              pred,
+                                    bool                     skewed,
+                                    ::portable_stl::random_access_iterator_tag) {
+    if (skewed) {
+      return ::portable_stl::algorithm_helper::gallop(first, last, pred);
+    }
+    while ((first != last) && pred(*first)) {
+      ++first;
+    }
+    return first;
+  }
+
+  /**
+   * @brief Copies the elements of [first, last) for which pred returns true one by one.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_predicate the type of the predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param out the destination, advanced past the copied elements.
+   * @param pred the predicate which is true for the elements of the run.
+   * @return the end of the run.
+   */
+  template<class t_input_iterator, class t_output_iterator, class t_predicate>
+  t_input_iterator copy_run(t_input_iterator   first,
+                            t_input_iterator   last,
+                            t_output_iterator &out,
+                            t_predicate        pred,
+                            bool,
+                            ::portable_stl::input_iterator_tag) {
+    while ((first != last) && pred(*first)) {
+      *out = *first;
+      ++out;
+      ++first;
+    }
+    return first;
+  }
+
+  /**
+   * @brief Copies the elements of [first, last) for which pred returns true.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_predicate the type of the predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param out the destination, advanced past the copied elements.
+   * @param pred the predicate which is true for the elements of the run.
+   * @param skewed find the end of the run by the exponential search and copy the run at once.
+   * @return the end of the run.
+   */
+  template<class t_random_access_iterator, class t_output_iterator, class t_predicate>
+  t_random_access_iterator copy_run(t_random_access_iterator first,
+                                    t_random_access_iterator last,
+                                    t_output_iterator       &out,
+                                    t_predicate              pred,
+                                    bool                     skewed,
+                                    ::portable_stl::random_access_iterator_tag) {
+    if (skewed) {
+      t_random_access_iterator const run_end{::portable_stl::algorithm_helper::gallop(first, last, pred)};
+      out = ::portable_stl::copy(first, run_end, out);
+      return run_end;
+    }
+    while ((first != last) && pred(*first)) {
+      *out = *first;
+      ++out;
+      ++first;
+    }
+    return first;
+  }
+
+  /**
+   * @brief Skips the elements of [first, last) which are less than value.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value to compare the elements to.
+   * @param comp the comparison function object.
+   * @param skewed use the exponential search for the random access range.
+   * @return the first element which is not less than value or last.
+   */
+  template<class t_input_iterator, class t_value, class t_compare>
+  t_input_iterator skip_less(
+    t_input_iterator first, t_input_iterator last, t_value const &value, t_compare &comp, bool skewed) {
+    return ::portable_stl::algorithm_helper::skip_run(
+      first,
+      last,
+      [&value, &comp](decltype(*first) elem) -> bool { return comp(elem, value); },
+      skewed,
+      typename ::portable_stl::iterator_traits<t_input_iterator>::iterator_category{});
+  }
+
+  /**
+   * @brief Copies the elements of [first, last) which are less than value.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param out the destination, advanced past the copied elements.
+   * @param value the value to compare the elements to.
+   * @param comp the comparison function object.
+   * @param skewed use the exponential search for the random access range.
+   * @return the first element which is not less than value or last.
+   */
+  template<class t_input_iterator, class t_output_iterator, class t_value, class t_compare>
+  t_input_iterator copy_less(t_input_iterator   first,
+                             t_input_iterator   last,
+                             t_output_iterator &out,
+                             t_value const     &value,
+                             t_compare         &comp,
+                             bool               skewed) {
+    return ::portable_stl::algorithm_helper::copy_run(
+      first,
+      last,
+      out,
+      [&value, &comp](decltype(*first) elem) -> bool { return comp(elem, value); },
+      skewed,
+      typename ::portable_stl::iterator_traits<t_input_iterator>::iterator_category{});
+  }
+
+  /**
+   * @brief Copies the elements of [first, last) which are not greater than value.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param out the destination, advanced past the copied elements.
+   * @param value the value to compare the elements to.
+   * @param comp the comparison function object.
+   * @param skewed use the exponential search for the random access range.
+   * @return the first element which is greater than value or last.
+   */
+  template<class t_input_iterator, class t_output_iterator, class t_value, class t_compare>
+  t_input_iterator copy_not_greater(t_input_iterator   first,
+                                    t_input_iterator   last,
+                                    t_output_iterator &out,
+                                    t_value const     &value,
+                                    t_compare         &comp,
+                                    bool               skewed) {
+    return ::portable_stl::algorithm_helper::copy_run(
+      first,
+      last,
+      out,
+      [&value, &comp](decltype(*first) elem) -> bool { return !comp(value, elem); },
+      skewed,
+      typename ::portable_stl::iterator_traits<t_input_iterator>::iterator_category{});
+  }
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_GALLOP_H
@@ -13,12 +13,17 @@
 #define PSTL_CTZ_IMPL_H
 #include "../../common/int32_t.h"
 #include "../../common/uint32_t.h"
+#include "../../common/uint64_t.h"
 
 namespace portable_stl {
 namespace algorithm_helper {
   inline ::portable_stl::int32_t ctz_impl(::portable_stl::uint32_t value) noexcept {
     return __builtin_ctz(value);
   }
+
+  inline ::portable_stl::int32_t ctz_impl(::portable_stl::uint64_t value) noexcept {
+    return __builtin_ctzll(value);
+  }
 } // namespace algorithm_helper
 } // namespace portable_stl
 
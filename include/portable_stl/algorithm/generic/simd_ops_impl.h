@@ -0,0 +1,81 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="simd_ops_impl.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SIMD_OPS_IMPL_H
+#define PSTL_SIMD_OPS_IMPL_H
+
+#include "../../common/size_t.h"
+#include "../../metaprogramming/helper/integral_constant.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief No vector operations on the integers, the algorithms use the scalar loops.
+   * @tparam t_size the size of the integer in bytes.
+   * @tparam t_signed the integer is signed.
+   */
+  template<::portable_stl::size_t t_size, bool t_signed> class simd_integer_ops final {
+  public:
+    /**
+     * @brief The operations are not available.
+     */
+    using is_supported = ::portable_stl::false_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is not available.
+     */
+    using has_add      = ::portable_stl::false_type;
+  };
+
+  /**
+   * @brief No vector operations on float.
+   */
+  class simd_float_ops final {
+  public:
+    /**
+     * @brief The operations are not available.
+     */
+    using is_supported = ::portable_stl::false_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is not available.
+     */
+    using has_add      = ::portable_stl::false_type;
+  };
+
+  /**
+   * @brief No vector operations on double.
+   */
+  class simd_double_ops final {
+  public:
+    /**
+     * @brief The operations are not available.
+     */
+    using is_supported = ::portable_stl::false_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is not available.
+     */
+    using has_add      = ::portable_stl::false_type;
+  };
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_SIMD_OPS_IMPL_H
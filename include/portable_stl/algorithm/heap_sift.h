@@ -0,0 +1,215 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="heap_sift.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_HEAP_SIFT_H
+#define PSTL_HEAP_SIFT_H
+
+#include "../common/size_t.h"
+#include "../iterator/iterator_traits.h"
+#include "../utility/general/move.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Difference type of the heap iterator.
+   * @tparam t_iterator the type of iterator.
+   */
+  template<class t_iterator>
+  using heap_difference_t = typename ::portable_stl::iterator_traits<t_iterator>::difference_type;
+
+  /**
+   * @brief Finds the greatest child of the node in the t_arity-ary heap.
+   *
+   * @tparam t_arity the number of children of the heap node.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the heap.
+   * @param comp the comparison function object.
+   * @param len the length of the heap.
+   * @param child the index of the first child.
+   * @return the index of the greatest child.
+   */
+  template<::portable_stl::size_t t_arity, class t_random_access_iterator, class t_compare>
+  heap_difference_t<t_random_access_iterator> heap_greatest_child(t_random_access_iterator                    first,
+                                                                  t_compare                                  &comp,
+                                                                  heap_difference_t<t_random_access_iterator> len,
+                                                                  heap_difference_t<t_random_access_iterator> child) {
+    using difference_type = heap_difference_t<t_random_access_iterator>;
+
+    difference_type       result{child};
+    difference_type const last{
+      ((len - child) > static_cast<difference_type>(t_arity)) ? (child + static_cast<difference_type>(t_arity)) : len};
+    for (++child; child < last; ++child) {
+      if (comp(*(first + result), *(first + child))) {
+        result = child;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Moves the element at index start down to restore the t_arity-ary heap property.
+   *
+   * @tparam t_arity the number of children of the heap node.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the heap.
+   * @param comp the comparison function object.
+   * @param len the length of the heap.
+   * @param start the index of the element to move down.
+   */
+  template<::portable_stl::size_t t_arity, class t_random_access_iterator, class t_compare>
+  void sift_down(t_random_access_iterator                    first,
+                 t_compare                                  &comp,
+                 heap_difference_t<t_random_access_iterator> len,
+                 heap_difference_t<t_random_access_iterator> start) {
+    using difference_type = heap_difference_t<t_random_access_iterator>;
+    using value_type      = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+    static_assert(t_arity >= 2U, "heap arity must be at least 2");
+
+    // the first child of start is at t_arity * start + 1
+    difference_type const last_parent{(len - 2) / static_cast<difference_type>(t_arity)};
+    if ((len < 2) || (last_parent < start)) {
+      return;
+    }
+
+    difference_type child{
+      heap_greatest_child<t_arity>(first, comp, len, static_cast<difference_type>(t_arity) * start + 1)};
+
+    if (!comp(*(first + start), *(first + child))) {
+      // already in heap order
+      return;
+    }
+
+    value_type top(::portable_stl::move(*(first + start)));
+    do {
+      // not in heap order, move the greatest child up
+      *(first + start) = ::portable_stl::move(*(first + child));
+      start            = child;
+
+      if (last_parent < start) {
+        break;
+      }
+
+      child = heap_greatest_child<t_arity>(first, comp, len, static_cast<difference_type>(t_arity) * start + 1);
+    } while (comp(top, *(first + child)));
+    *(first + start) = ::portable_stl::move(top);
+  }
+
+  /**
+   * @brief Moves the last element of the range [first, first + len) up to restore the t_arity-ary heap property.
+   *
+   * @tparam t_arity the number of children of the heap node.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the heap.
+   * @param comp the comparison function object.
+   * @param len the length of the heap including the element to move up.
+   */
+  template<::portable_stl::size_t t_arity, class t_random_access_iterator, class t_compare>
+  void sift_up(t_random_access_iterator first, t_compare &comp, heap_difference_t<t_random_access_iterator> len) {
+    using difference_type = heap_difference_t<t_random_access_iterator>;
+    using value_type      = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+    static_assert(t_arity >= 2U, "heap arity must be at least 2");
+
+    if (len > 1) {
+      difference_type pos{len - 1};
+      difference_type parent{(pos - 1) / static_cast<difference_type>(t_arity)};
+      if (comp(*(first + parent), *(first + pos))) {
+        value_type value(::portable_stl::move(*(first + pos)));
+        do {
+          *(first + pos) = ::portable_stl::move(*(first + parent));
+          pos            = parent;
+          if (0 == pos) {
+            break;
+          }
+          parent = (pos - 1) / static_cast<difference_type>(t_arity);
+        } while (comp(*(first + parent), value));
+        *(first + pos) = ::portable_stl::move(value);
+      }
+    }
+  }
+
+  /**
+   * @brief Moves the greatest element of the t_arity-ary heap [first, first + len) to the position first + len - 1
+   * and makes [first, first + len - 1) a heap.
+   *
+   * @tparam t_arity the number of children of the heap node.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the heap.
+   * @param comp the comparison function object.
+   * @param len the length of the heap.
+   */
+  template<::portable_stl::size_t t_arity, class t_random_access_iterator, class t_compare>
+  void pop_heap_impl(t_random_access_iterator first, t_compare &comp, heap_difference_t<t_random_access_iterator> len) {
+    using value_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+
+    if (len > 1) {
+      t_random_access_iterator back{first + (len - 1)};
+      value_type               top(::portable_stl::move(*first));
+      *first = ::portable_stl::move(*back);
+      *back  = ::portable_stl::move(top);
+      ::portable_stl::algorithm_helper::sift_down<t_arity>(first, comp, len - 1, 0);
+    }
+  }
+
+  /**
+   * @brief Makes the t_arity-ary heap from the range [first, first + len).
+   *
+   * @tparam t_arity the number of children of the heap node.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param comp the comparison function object.
+   * @param len the length of the range.
+   */
+  template<::portable_stl::size_t t_arity, class t_random_access_iterator, class t_compare>
+  void make_heap_impl(t_random_access_iterator                    first,
+                      t_compare                                  &comp,
+                      heap_difference_t<t_random_access_iterator> len) {
+    using difference_type = heap_difference_t<t_random_access_iterator>;
+
+    if (len > 1) {
+      // start from the last parent
+      for (difference_type start{(len - 2) / static_cast<difference_type>(t_arity)}; start >= 0; --start) {
+        ::portable_stl::algorithm_helper::sift_down<t_arity>(first, comp, len, start);
+      }
+    }
+  }
+
+  /**
+   * @brief Finds the end of the largest t_arity-ary heap at the beginning of the range [first, first + len).
+   *
+   * @tparam t_arity the number of children of the heap node.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param comp the comparison function object.
+   * @param len the length of the range.
+   * @return the length of the heap.
+   */
+  template<::portable_stl::size_t t_arity, class t_random_access_iterator, class t_compare>
+  heap_difference_t<t_random_access_iterator> is_heap_until_impl(
+    t_random_access_iterator first, t_compare &comp, heap_difference_t<t_random_access_iterator> len) {
+    using difference_type = heap_difference_t<t_random_access_iterator>;
+
+    for (difference_type child{1}; child < len; ++child) {
+      if (comp(*(first + (child - 1) / static_cast<difference_type>(t_arity)), *(first + child))) {
+        return child;
+      }
+    }
+    return len;
+  }
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_HEAP_SIFT_H
@@ -0,0 +1,69 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="includes.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_INCLUDES_H
+#define PSTL_INCLUDES_H
+
+#include "../functional/less.h"
+#include "gallop.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Checks if the sorted range [first2, last2) is a subsequence of the sorted range [first1, last1).
+ * If the first random access range is much longer than the second one, its elements are skipped by exponential search.
+ *
+ * @tparam t_input_iterator1 the type of the first range iterator.
+ * @tparam t_input_iterator2 the type of the second range iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return true if every element of [first2, last2) is found in [first1, last1), false otherwise.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_compare>
+bool includes(t_input_iterator1 first1,
+              t_input_iterator1 last1,
+              t_input_iterator2 first2,
+              t_input_iterator2 last2,
+              t_compare         comp) {
+  bool const skewed{::portable_stl::algorithm_helper::is_skewed(first1, last1, first2, last2)};
+  while (first2 != last2) {
+    first1 = ::portable_stl::algorithm_helper::skip_less(first1, last1, *first2, comp, skewed);
+    if ((first1 == last1) || comp(*first2, *first1)) {
+      return false;
+    }
+    ++first1;
+    ++first2;
+  }
+  return true;
+}
+
+/**
+ * @brief Checks if the sorted range [first2, last2) is a subsequence of the sorted range [first1, last1).
+ *
+ * @tparam t_input_iterator1 the type of the first range iterator.
+ * @tparam t_input_iterator2 the type of the second range iterator.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @return true if every element of [first2, last2) is found in [first1, last1), false otherwise.
+ */
+template<class t_input_iterator1, class t_input_iterator2>
+bool includes(t_input_iterator1 first1, t_input_iterator1 last1, t_input_iterator2 first2, t_input_iterator2 last2) {
+  return ::portable_stl::includes(first1, last1, first2, last2, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_INCLUDES_H
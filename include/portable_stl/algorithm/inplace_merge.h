@@ -0,0 +1,327 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="inplace_merge.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_INPLACE_MERGE_H
+#define PSTL_INPLACE_MERGE_H
+
+#include "../common/size_t.h"
+#include "../functional/less.h"
+#include "../iterator/distance.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/next.h"
+#include "../iterator/prev.h"
+#include "../iterator/reverse_iterator.h"
+#include "../memory/construct_at.h"
+#include "../memory/destroy_at.h"
+#include "../utility/general/make_exception_guard.h"
+#include "../utility/general/move.h"
+#include "algo_iter_swap.h"
+#include "gallop.h"
+#include "rotate.h"
+#include "temporary_buffer.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Comparison with swapped arguments, used to merge the reversed ranges.
+   * @tparam t_compare the type of compare function.
+   */
+  template<class t_compare> class inverted_compare final {
+    /**
+     * @brief The original comparison function object.
+     */
+    t_compare &m_comp;
+
+  public:
+    /**
+     * @brief Constructor.
+     * @param comp the original comparison function object.
+     */
+    explicit inverted_compare(t_compare &comp) noexcept : m_comp(comp) {
+    }
+
+    /**
+     * @brief Compares the values.
+     * @param lhv the first value.
+     * @param rhv the second value.
+     * @return the original comparison of rhv and lhv.
+     */
+    template<class t_type1, class t_type2> bool operator()(t_type1 const &lhv, t_type2 const &rhv) const {
+      return m_comp(rhv, lhv);
+    }
+  };
+
+  /**
+   * @brief Merges the sorted ranges [first, middle) and [middle, last) by rotations without additional memory.
+   * The longer range is split in half, the other one at the bound of the split element, the middle parts are swapped
+   * by rotation and the halves are merged recursively. The recursion depth is logarithmic in the length of the range.
+   *
+   * @tparam t_bidirectional_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the first range.
+   * @param middle the end of the first range and the beginning of the second one.
+   * @param last the end of the second range.
+   * @param len1 the length of the first range.
+   * @param len2 the length of the second range.
+   * @param comp the comparison function object.
+   */
+  template<class t_bidirectional_iterator, class t_compare>
+  void merge_without_buffer(t_bidirectional_iterator                                                             first,
+                            t_bidirectional_iterator                                                             middle,
+                            t_bidirectional_iterator                                                             last,
+                            typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::difference_type len1,
+                            typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::difference_type len2,
+                            t_compare                                                                           &comp) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::difference_type;
+
+    if ((0 == len1) || (0 == len2)) {
+      return;
+    }
+    if (2 == len1 + len2) {
+      if (comp(*middle, *first)) {
+        ::portable_stl::algo_iter_swap(first, middle);
+      }
+      return;
+    }
+
+    t_bidirectional_iterator cut1;
+    t_bidirectional_iterator cut2;
+    difference_type          len11;
+    difference_type          len22;
+    if (len1 > len2) {
+      len11 = len1 / 2;
+      cut1  = ::portable_stl::next(first, len11);
+      cut2  = ::portable_stl::algorithm_helper::lower_bound_impl(middle, last, *cut1, comp);
+      len22 = ::portable_stl::distance(middle, cut2);
+    } else {
+      len22 = len2 / 2;
+      cut2  = ::portable_stl::next(middle, len22);
+      cut1  = ::portable_stl::algorithm_helper::upper_bound_impl(first, middle, *cut2, comp);
+      len11 = ::portable_stl::distance(first, cut1);
+    }
+
+    t_bidirectional_iterator const new_middle{::portable_stl::rotate(cut1, middle, cut2)};
+    ::portable_stl::algorithm_helper::merge_without_buffer(first, cut1, new_middle, len11, len22, comp);
+    ::portable_stl::algorithm_helper::merge_without_buffer(
+      new_middle, cut2, last, len1 - len11, len2 - len22, comp);
+  }
+
+  /**
+   * @brief Moves the elements of [first, last) to the uninitialized buffer. If a move throws, the buffered elements
+   * are moved back and destroyed.
+   *
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param buffer the uninitialized memory for the elements of the range.
+   * @return the end of the buffered elements.
+   */
+  template<class t_iterator, class t_type> t_type *move_to_buffer(t_iterator first, t_iterator last, t_type *buffer) {
+    t_type *buffer_end{buffer};
+    auto    guard = ::portable_stl::make_exception_guard([first, buffer, &buffer_end]() {
+      t_iterator output{first};
+      for (t_type *iter{buffer}; iter != buffer_end; ++iter, ++output) {
+        *output = ::portable_stl::move(*iter);
+        ::portable_stl::destroy_at(iter);
+      }
+    });
+    for (; first != last; ++first, ++buffer_end) {
+      ::portable_stl::construct_at(buffer_end, ::portable_stl::move(*first));
+    }
+    guard.commit();
+    return buffer_end;
+  }
+
+  /**
+   * @brief Merges the buffered elements [buffered, buffer_end) with the range [range, last) into [out, last), the
+   * buffered elements go first among the equivalent ones. The range [out, range) consists of as many moved-from
+   * elements as there are buffered ones, if the comparison throws, the rest of the buffered elements fills it, so the
+   * range keeps all its elements. The runs are found by exponential search when the lengths are skewed.
+   *
+   * @tparam t_buffer_iterator the type of the buffer iterator.
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param buffered the beginning of the buffered elements.
+   * @param buffer_end the end of the buffered elements.
+   * @param range the beginning of the elements left in the range.
+   * @param last the end of the range.
+   * @param out the beginning of the merged range.
+   * @param comp the comparison function object.
+   */
+  template<class t_buffer_iterator, class t_iterator, class t_compare>
+  void merge_buffered(t_buffer_iterator buffered,
+                      t_buffer_iterator buffer_end,
+                      t_iterator        range,
+                      t_iterator        last,
+                      t_iterator        out,
+                      t_compare        &comp) {
+    using buffer_value_type = typename ::portable_stl::iterator_traits<t_buffer_iterator>::value_type;
+
+    auto const move_back = [&buffered, buffer_end, &out]() {
+      for (; buffered != buffer_end; ++buffered, ++out) {
+        *out = ::portable_stl::move(*buffered);
+      }
+    };
+    auto guard = ::portable_stl::make_exception_guard([&move_back]() { move_back(); });
+
+    if (!::portable_stl::algorithm_helper::is_skewed(buffered, buffer_end, range, last)) {
+      while ((buffered != buffer_end) && (range != last)) {
+        if (comp(*range, *buffered)) {
+          *out = ::portable_stl::move(*range);
+          ++range;
+        } else {
+          *out = ::portable_stl::move(*buffered);
+          ++buffered;
+        }
+        ++out;
+      }
+    } else {
+      // the runs are found before they are moved, so the positions are exact when the comparison throws
+      while ((buffered != buffer_end) && (range != last)) {
+        if (comp(*range, *buffered)) {
+          t_iterator const run_end{::portable_stl::algorithm_helper::skip_less(range, last, *buffered, comp, true)};
+          for (; range != run_end; ++range, ++out) {
+            *out = ::portable_stl::move(*range);
+          }
+        } else {
+          t_buffer_iterator const run_end{::portable_stl::algorithm_helper::skip_run(
+            buffered,
+            buffer_end,
+            [&range, &comp](buffer_value_type const &elem) -> bool { return !comp(*range, elem); },
+            true,
+            typename ::portable_stl::iterator_traits<t_buffer_iterator>::iterator_category{})};
+          for (; buffered != run_end; ++buffered, ++out) {
+            *out = ::portable_stl::move(*buffered);
+          }
+        }
+      }
+    }
+    move_back();
+    guard.commit();
+  }
+
+  /**
+   * @brief Merges the sorted ranges [first, middle) and [middle, last) moving the shorter one to the buffer.
+   * The first element of [first, middle) must be greater than the first element of [middle, last) and the last element
+   * of [middle, last) must be less than the last element of [first, middle), so the merge never moves an element onto
+   * itself. If the comparison throws, the range keeps all its elements in an unspecified order and the buffer is left
+   * uninitialized.
+   *
+   * @tparam t_bidirectional_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the first range.
+   * @param middle the end of the first range and the beginning of the second one.
+   * @param last the end of the second range.
+   * @param len1 the length of the first range.
+   * @param len2 the length of the second range.
+   * @param comp the comparison function object.
+   * @param buffer the uninitialized memory for min(len1, len2) elements.
+   */
+  template<class t_bidirectional_iterator, class t_compare>
+  void merge_with_buffer(t_bidirectional_iterator                                                             first,
+                         t_bidirectional_iterator                                                             middle,
+                         t_bidirectional_iterator                                                             last,
+                         typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::difference_type len1,
+                         typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::difference_type len2,
+                         t_compare                                                                           &comp,
+                         typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::value_type     *buffer) {
+    using value_type = typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::value_type;
+
+    value_type *buffer_end{buffer};
+    auto const  destroy = [buffer, &buffer_end]() {
+      for (value_type *iter{buffer}; iter != buffer_end; ++iter) {
+        ::portable_stl::destroy_at(iter);
+      }
+    };
+    auto guard = ::portable_stl::make_exception_guard([&destroy]() { destroy(); });
+
+    if (len1 <= len2) {
+      buffer_end = ::portable_stl::algorithm_helper::move_to_buffer(first, middle, buffer);
+      ::portable_stl::algorithm_helper::merge_buffered(buffer, buffer_end, middle, last, first, comp);
+    } else {
+      buffer_end = ::portable_stl::algorithm_helper::move_to_buffer(middle, last, buffer);
+      // merge the reversed ranges from the end, the elements of the second range go first among the equivalent ones
+      ::portable_stl::algorithm_helper::inverted_compare<t_compare> inverted(comp);
+      ::portable_stl::algorithm_helper::merge_buffered(::portable_stl::make_reverse_iterator(buffer_end),
+                                                       ::portable_stl::make_reverse_iterator(buffer),
+                                                       ::portable_stl::make_reverse_iterator(middle),
+                                                       ::portable_stl::make_reverse_iterator(first),
+                                                       ::portable_stl::make_reverse_iterator(last),
+                                                       inverted);
+    }
+
+    guard.commit();
+    destroy();
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Merges two consecutive sorted ranges [first, middle) and [middle, last) into one sorted range [first, last).
+ * The merge is stable. The already placed prefix and suffix are skipped by binary search, then the shorter of the
+ * remaining ranges is moved to a temporary buffer and merged back with exponential search for the runs when the
+ * lengths are skewed. If the buffer can not be allocated, the ranges are merged in place by rotations in
+ * O(n log(n)) moves. If the comparison throws, the range keeps all its elements in an unspecified order.
+ *
+ * @tparam t_bidirectional_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the first range.
+ * @param middle the end of the first range and the beginning of the second one.
+ * @param last the end of the second range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ */
+template<class t_bidirectional_iterator, class t_compare>
+void inplace_merge(t_bidirectional_iterator first,
+                   t_bidirectional_iterator middle,
+                   t_bidirectional_iterator last,
+                   t_compare                comp) {
+  using value_type      = typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::value_type;
+  using difference_type = typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::difference_type;
+
+  if ((first == middle) || (middle == last)) {
+    return;
+  }
+
+  // the elements of the first range not greater than the first element of the second range are already in place, so
+  // are the elements of the second range not less than the last element of the first range
+  first = ::portable_stl::algorithm_helper::upper_bound_impl(first, middle, *middle, comp);
+  if (first == middle) {
+    return;
+  }
+  last = ::portable_stl::algorithm_helper::lower_bound_impl(middle, last, *::portable_stl::prev(middle), comp);
+
+  difference_type const len1{::portable_stl::distance(first, middle)};
+  difference_type const len2{::portable_stl::distance(middle, last)};
+
+  ::portable_stl::algorithm_helper::temporary_buffer<value_type> buffer(
+    static_cast<::portable_stl::size_t>((len1 < len2) ? len1 : len2));
+  if (nullptr == buffer.data()) {
+    ::portable_stl::algorithm_helper::merge_without_buffer(first, middle, last, len1, len2, comp);
+    return;
+  }
+  ::portable_stl::algorithm_helper::merge_with_buffer(first, middle, last, len1, len2, comp, buffer.data());
+}
+
+/**
+ * @brief Merges two consecutive sorted ranges [first, middle) and [middle, last) into one sorted range [first, last).
+ *
+ * @tparam t_bidirectional_iterator the type of iterator.
+ * @param first the beginning of the first range.
+ * @param middle the end of the first range and the beginning of the second one.
+ * @param last the end of the second range.
+ */
+template<class t_bidirectional_iterator>
+void inplace_merge(t_bidirectional_iterator first, t_bidirectional_iterator middle, t_bidirectional_iterator last) {
+  ::portable_stl::inplace_merge(first, middle, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_INPLACE_MERGE_H
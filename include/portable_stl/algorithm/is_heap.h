@@ -0,0 +1,49 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="is_heap.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_IS_HEAP_H
+#define PSTL_IS_HEAP_H
+
+#include "../functional/less.h"
+#include "is_heap_until.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Checks whether [first, last) is a max heap.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the range of elements to examine.
+ * @param last the range of elements to examine.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return true if the range is max heap, false otherwise.
+ */
+template<class t_random_access_iterator, class t_compare>
+inline bool is_heap(t_random_access_iterator first, t_random_access_iterator last, t_compare comp) {
+  return ::portable_stl::is_heap_until(first, last, comp) == last;
+}
+
+/**
+ * @brief Checks whether [first, last) is a max heap.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the range of elements to examine.
+ * @param last the range of elements to examine.
+ * @return true if the range is max heap, false otherwise.
+ */
+template<class t_random_access_iterator>
+inline bool is_heap(t_random_access_iterator first, t_random_access_iterator last) {
+  return ::portable_stl::is_heap_until(first, last) == last;
+}
+} // namespace portable_stl
+
+#endif // PSTL_IS_HEAP_H
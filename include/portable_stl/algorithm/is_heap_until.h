@@ -0,0 +1,50 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="is_heap_until.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_IS_HEAP_UNTIL_H
+#define PSTL_IS_HEAP_UNTIL_H
+
+#include "../functional/less.h"
+#include "heap_sift.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Examines the range [first, last) and finds the largest range beginning at first which is a max heap.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the range of elements to examine.
+ * @param last the range of elements to examine.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return The last iterator it for which range [first, it) is a max heap.
+ */
+template<class t_random_access_iterator, class t_compare>
+inline t_random_access_iterator is_heap_until(
+  t_random_access_iterator first, t_random_access_iterator last, t_compare comp) {
+  return first + ::portable_stl::algorithm_helper::is_heap_until_impl<2U>(first, comp, last - first);
+}
+
+/**
+ * @brief Examines the range [first, last) and finds the largest range beginning at first which is a max heap.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the range of elements to examine.
+ * @param last the range of elements to examine.
+ * @return The last iterator it for which range [first, it) is a max heap.
+ */
+template<class t_random_access_iterator>
+inline t_random_access_iterator is_heap_until(t_random_access_iterator first, t_random_access_iterator last) {
+  return ::portable_stl::is_heap_until(first, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_IS_HEAP_UNTIL_H
@@ -51,6 +51,15 @@ inline bool lexicographical_compare(
   return algorithm_helper::lexicographical_compare_impl(
     first1, last1, first2, last2, ::portable_stl::algorithm_helper::less<>());
 }
+
+template<class t_input_iterator1, class t_input_iterator2, class t_compare>
+inline bool lexicographical_compare(t_input_iterator1 first1,
+                                    t_input_iterator1 last1,
+                                    t_input_iterator2 first2,
+                                    t_input_iterator2 last2,
+                                    t_compare         comp) {
+  return algorithm_helper::lexicographical_compare_impl(first1, last1, first2, last2, comp);
+}
 } // namespace portable_stl
 
 #endif // PSTL_LEXICOGRAPHICAL_COMPARE_H
@@ -0,0 +1,110 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="lower_bound.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_LOWER_BOUND_H
+#define PSTL_LOWER_BOUND_H
+
+#include "../functional/less.h"
+#include "../iterator/input_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "branchless_search.h"
+#include "gallop.h"
+#include "unwrap_iter.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief lower_bound for the forward iterators: binary search with the distance and advance.
+   *
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value to compare the elements to.
+   * @param comp the comparison function object.
+   * @return the iterator to the found element or last.
+   */
+  template<class t_forward_iterator, class t_value, class t_compare>
+  inline t_forward_iterator lower_bound_dispatch(t_forward_iterator first,
+                                                t_forward_iterator last,
+                                                t_value const     &value,
+                                                t_compare         &comp,
+                                                ::portable_stl::input_iterator_tag) {
+    return ::portable_stl::algorithm_helper::lower_bound_impl(first, last, value, comp);
+  }
+
+  /**
+   * @brief lower_bound for the random access iterators: branchless binary search, the contiguous ranges are searched
+   * by pointers with prefetch.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_value the type of the value.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value to compare the elements to.
+   * @param comp the comparison function object.
+   * @return the iterator to the found element or last.
+   */
+  template<class t_random_access_iterator, class t_value, class t_compare>
+  inline t_random_access_iterator lower_bound_dispatch(t_random_access_iterator first,
+                                                      t_random_access_iterator last,
+                                                      t_value const           &value,
+                                                      t_compare               &comp,
+                                                      ::portable_stl::random_access_iterator_tag) {
+    ::portable_stl::algorithm_helper::lower_bound_predicate<t_value, t_compare> pred(value, comp);
+    return ::portable_stl::rewrap_iter(first,
+                                       ::portable_stl::algorithm_helper::branchless_partition_point(
+                                         ::portable_stl::unwrap_iter(first), last - first, pred));
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Finds the first element of the sorted range [first, last) which is not less than value.
+ * Random access ranges are searched by the branchless binary search with prefetch.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_value the type of the value.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value to compare the elements to.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return the iterator to the found element or last.
+ */
+template<class t_forward_iterator, class t_value, class t_compare>
+inline t_forward_iterator lower_bound(t_forward_iterator first,
+                                     t_forward_iterator last,
+                                     t_value const     &value,
+                                     t_compare          comp) {
+  return ::portable_stl::algorithm_helper::lower_bound_dispatch(
+    first, last, value, comp, typename ::portable_stl::iterator_traits<t_forward_iterator>::iterator_category{});
+}
+
+/**
+ * @brief Finds the first element of the sorted range [first, last) which is not less than value.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_value the type of the value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value to compare the elements to.
+ * @return the iterator to the found element or last.
+ */
+template<class t_forward_iterator, class t_value>
+inline t_forward_iterator lower_bound(t_forward_iterator first, t_forward_iterator last, t_value const &value) {
+  return ::portable_stl::lower_bound(first, last, value, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_LOWER_BOUND_H
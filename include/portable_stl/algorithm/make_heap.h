@@ -0,0 +1,47 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="make_heap.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_MAKE_HEAP_H
+#define PSTL_MAKE_HEAP_H
+
+#include "../functional/less.h"
+#include "heap_sift.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Constructs a max heap in the range [first, last).
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the range of elements.
+ * @param last the range of elements.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ */
+template<class t_random_access_iterator, class t_compare>
+inline void make_heap(t_random_access_iterator first, t_random_access_iterator last, t_compare comp) {
+  ::portable_stl::algorithm_helper::make_heap_impl<2U>(first, comp, last - first);
+}
+
+/**
+ * @brief Constructs a max heap in the range [first, last).
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the range of elements.
+ * @param last the range of elements.
+ */
+template<class t_random_access_iterator>
+inline void make_heap(t_random_access_iterator first, t_random_access_iterator last) {
+  ::portable_stl::make_heap(first, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_MAKE_HEAP_H
@@ -0,0 +1,94 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="min_element.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_MIN_ELEMENT_H
+#define PSTL_MIN_ELEMENT_H
+
+#include "../functional/less.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "simd_scan.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Finds the smallest element in the range [first, last).
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return the iterator to the first smallest element or last if the range is empty.
+ */
+template<class t_forward_iterator, class t_compare>
+inline t_forward_iterator min_element(t_forward_iterator first, t_forward_iterator last, t_compare comp) {
+  t_forward_iterator result{first};
+  if (first != last) {
+    while (++first != last) {
+      if (comp(*first, *result)) {
+        result = first;
+      }
+    }
+  }
+  return result;
+}
+
+namespace algorithm_helper {
+  /**
+   * @brief Finds the smallest element by the scalar loop.
+   * @tparam t_forward_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the iterator to the first smallest element or last if the range is empty.
+   */
+  template<class t_forward_iterator>
+  t_forward_iterator min_element_dispatch(t_forward_iterator first,
+                                          t_forward_iterator last,
+                                          ::portable_stl::false_type) {
+    return ::portable_stl::min_element(first, last, ::portable_stl::less<>{});
+  }
+
+  /**
+   * @brief Finds the smallest element by the vector loops over the contiguous range.
+   * @tparam t_forward_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the iterator to the first smallest element or last if the range is empty.
+   */
+  template<class t_forward_iterator>
+  t_forward_iterator min_element_dispatch(t_forward_iterator first,
+                                          t_forward_iterator last,
+                                          ::portable_stl::true_type) {
+    auto const unwrapped_first = ::portable_stl::unwrap_iter(first);
+    return first
+         + (simd_min_element<simd_element_t<t_forward_iterator>>(unwrapped_first, ::portable_stl::unwrap_iter(last))
+            - unwrapped_first);
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Finds the smallest element in the range [first, last).
+ * The contiguous ranges of the integers use the vector loops.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @return the iterator to the first smallest element or last if the range is empty.
+ */
+template<class t_forward_iterator>
+inline t_forward_iterator min_element(t_forward_iterator first, t_forward_iterator last) {
+  return ::portable_stl::algorithm_helper::min_element_dispatch(
+    first, last, ::portable_stl::algorithm_helper::simd_min_max_tag<t_forward_iterator>{});
+}
+
+} // namespace portable_stl
+
+#endif // PSTL_MIN_ELEMENT_H
@@ -0,0 +1,104 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="minmax_element.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_MINMAX_ELEMENT_H
+#define PSTL_MINMAX_ELEMENT_H
+
+#include "../functional/less.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../utility/tuple/tuple.h"
+#include "simd_scan.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Finds the smallest and the greatest elements in the range [first, last).
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return the iterators to the first smallest and the last greatest elements, last and last if the range is empty.
+ */
+template<class t_forward_iterator, class t_compare>
+inline ::portable_stl::tuple<t_forward_iterator, t_forward_iterator> minmax_element(t_forward_iterator first,
+                                                                                    t_forward_iterator last,
+                                                                                    t_compare          comp) {
+  t_forward_iterator min_result{first};
+  t_forward_iterator max_result{first};
+  if (first != last) {
+    while (++first != last) {
+      if (comp(*first, *min_result)) {
+        min_result = first;
+      }
+      if (!comp(*first, *max_result)) {
+        max_result = first;
+      }
+    }
+  }
+  return ::portable_stl::tuple<t_forward_iterator, t_forward_iterator>(min_result, max_result);
+}
+
+namespace algorithm_helper {
+  /**
+   * @brief Finds the smallest and the greatest elements by the scalar loop.
+   * @tparam t_forward_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the iterators to the first smallest and the last greatest elements.
+   */
+  template<class t_forward_iterator>
+  ::portable_stl::tuple<t_forward_iterator, t_forward_iterator> minmax_element_dispatch(
+    t_forward_iterator first, t_forward_iterator last, ::portable_stl::false_type) {
+    return ::portable_stl::minmax_element(first, last, ::portable_stl::less<>{});
+  }
+
+  /**
+   * @brief Finds the smallest and the greatest elements by the vector loops over the contiguous range.
+   * @tparam t_forward_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the iterators to the first smallest and the last greatest elements.
+   */
+  template<class t_forward_iterator>
+  ::portable_stl::tuple<t_forward_iterator, t_forward_iterator> minmax_element_dispatch(
+    t_forward_iterator first, t_forward_iterator last, ::portable_stl::true_type) {
+    using element_type = simd_element_t<t_forward_iterator>;
+
+    element_type const *const unwrapped_first{::portable_stl::unwrap_iter(first)};
+    element_type const       *min_pos{unwrapped_first};
+    element_type const       *max_pos{unwrapped_first};
+    simd_minmax_element<element_type>(unwrapped_first, ::portable_stl::unwrap_iter(last), min_pos, max_pos);
+    return ::portable_stl::tuple<t_forward_iterator, t_forward_iterator>(first + (min_pos - unwrapped_first),
+                                                                         first + (max_pos - unwrapped_first));
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Finds the smallest and the greatest elements in the range [first, last).
+ * The contiguous ranges of the integers use the vector loops.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @return the iterators to the first smallest and the last greatest elements, last and last if the range is empty.
+ */
+template<class t_forward_iterator>
+inline ::portable_stl::tuple<t_forward_iterator, t_forward_iterator> minmax_element(t_forward_iterator first,
+                                                                                    t_forward_iterator last) {
+  return ::portable_stl::algorithm_helper::minmax_element_dispatch(
+    first, last, ::portable_stl::algorithm_helper::simd_min_max_tag<t_forward_iterator>{});
+}
+
+} // namespace portable_stl
+
+#endif // PSTL_MINMAX_ELEMENT_H
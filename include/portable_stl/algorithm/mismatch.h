@@ -0,0 +1,276 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="mismatch.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_MISMATCH_H
+#define PSTL_MISMATCH_H
+
+#include "../iterator/input_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../utility/tuple/tuple.h"
+#include "simd_scan.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Finds the first mismatching pair of elements by the scalar loop.
+   * @tparam t_input_iterator1 the type of the first iterator.
+   * @tparam t_input_iterator2 the type of the second iterator.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @return the iterators to the first mismatching elements.
+   */
+  template<class t_input_iterator1, class t_input_iterator2>
+  ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch_dispatch(t_input_iterator1 first1,
+                                                                                t_input_iterator1 last1,
+                                                                                t_input_iterator2 first2,
+                                                                                ::portable_stl::false_type) {
+    for (; (first1 != last1) && (*first1 == *first2); ++first1, (void)++first2) {
+    }
+    return ::portable_stl::tuple<t_input_iterator1, t_input_iterator2>(first1, first2);
+  }
+
+  /**
+   * @brief Finds the first mismatching pair of elements by the vector loops over the contiguous ranges.
+   * @tparam t_input_iterator1 the type of the first iterator.
+   * @tparam t_input_iterator2 the type of the second iterator.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @return the iterators to the first mismatching elements.
+   */
+  template<class t_input_iterator1, class t_input_iterator2>
+  ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch_dispatch(t_input_iterator1 first1,
+                                                                                t_input_iterator1 last1,
+                                                                                t_input_iterator2 first2,
+                                                                                ::portable_stl::true_type) {
+    auto const offset = simd_mismatch<simd_element_t<t_input_iterator1>>(
+      ::portable_stl::unwrap_iter(first1), ::portable_stl::unwrap_iter(last1), ::portable_stl::unwrap_iter(first2));
+    return ::portable_stl::tuple<t_input_iterator1, t_input_iterator2>(
+      first1 + static_cast<typename ::portable_stl::iterator_traits<t_input_iterator1>::difference_type>(offset),
+      first2 + static_cast<typename ::portable_stl::iterator_traits<t_input_iterator2>::difference_type>(offset));
+  }
+
+  /**
+   * @brief Finds the first mismatching pair of elements by the predicate.
+   * @tparam t_input_iterator1 the type of the first iterator.
+   * @tparam t_input_iterator2 the type of the second iterator.
+   * @tparam t_binary_predicate the type of the predicate.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param pred the predicate which returns true if the elements are equal.
+   * @return the iterators to the first mismatching elements.
+   */
+  template<class t_input_iterator1, class t_input_iterator2, class t_binary_predicate>
+  ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch_pred(t_input_iterator1   first1,
+                                                                            t_input_iterator1   last1,
+                                                                            t_input_iterator2   first2,
+                                                                            t_binary_predicate &pred) {
+    for (; (first1 != last1) && pred(*first1, *first2); ++first1, (void)++first2) {
+    }
+    return ::portable_stl::tuple<t_input_iterator1, t_input_iterator2>(first1, first2);
+  }
+
+  /**
+   * @brief Predicate of mismatch which compares the elements by operator==.
+   */
+  class mismatch_equal final {
+  public:
+    /**
+     * @brief Compares the elements.
+     * @tparam t_type1 the type of the first element.
+     * @tparam t_type2 the type of the second element.
+     * @param left the first element.
+     * @param right the second element.
+     * @return true if the elements are equal.
+     */
+    template<class t_type1, class t_type2> bool operator()(t_type1 const &left, t_type2 const &right) const {
+      return left == right;
+    }
+  };
+
+  /**
+   * @brief Finds the first mismatching pair of elements by operator==, the contiguous ranges use the vector loops.
+   * @tparam t_input_iterator1 the type of the first iterator.
+   * @tparam t_input_iterator2 the type of the second iterator.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @return the iterators to the first mismatching elements.
+   */
+  template<class t_input_iterator1, class t_input_iterator2>
+  ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch_pred(t_input_iterator1 first1,
+                                                                            t_input_iterator1 last1,
+                                                                            t_input_iterator2 first2,
+                                                                            mismatch_equal &) {
+    return ::portable_stl::algorithm_helper::mismatch_dispatch(
+      first1, last1, first2, simd_mismatch_tag<t_input_iterator1, t_input_iterator2>{});
+  }
+
+  /**
+   * @brief Finds the first mismatching pair of elements of the input ranges.
+   * @tparam t_input_iterator1 the type of the first iterator.
+   * @tparam t_input_iterator2 the type of the second iterator.
+   * @tparam t_binary_predicate the type of the predicate.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param last2 the end of the second range.
+   * @param pred the predicate which returns true if the elements are equal.
+   * @return the iterators to the first mismatching elements.
+   */
+  template<class t_input_iterator1, class t_input_iterator2, class t_binary_predicate>
+  ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch_impl(t_input_iterator1   first1,
+                                                                            t_input_iterator1   last1,
+                                                                            t_input_iterator2   first2,
+                                                                            t_input_iterator2   last2,
+                                                                            t_binary_predicate &pred,
+                                                                            ::portable_stl::input_iterator_tag,
+                                                                            ::portable_stl::input_iterator_tag) {
+    for (; (first1 != last1) && (first2 != last2) && pred(*first1, *first2); ++first1, (void)++first2) {
+    }
+    return ::portable_stl::tuple<t_input_iterator1, t_input_iterator2>(first1, first2);
+  }
+
+  /**
+   * @brief Finds the first mismatching pair of elements of the random access ranges, the longer range is cut to the
+   * length of the shorter one.
+   * @tparam t_random_access_iterator1 the type of the first iterator.
+   * @tparam t_random_access_iterator2 the type of the second iterator.
+   * @tparam t_binary_predicate the type of the predicate.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param last2 the end of the second range.
+   * @param pred the predicate which returns true if the elements are equal.
+   * @return the iterators to the first mismatching elements.
+   */
+  template<class t_random_access_iterator1, class t_random_access_iterator2, class t_binary_predicate>
+  ::portable_stl::tuple<t_random_access_iterator1, t_random_access_iterator2> mismatch_impl(
+    t_random_access_iterator1 first1,
+    t_random_access_iterator1 last1,
+    t_random_access_iterator2 first2,
+    t_random_access_iterator2 last2,
+    t_binary_predicate       &pred,
+    ::portable_stl::random_access_iterator_tag,
+    ::portable_stl::random_access_iterator_tag) {
+    if ((last2 - first2) < (last1 - first1)) {
+      last1 = first1 + (last2 - first2);
+    }
+    return ::portable_stl::algorithm_helper::mismatch_pred(first1, last1, first2, pred);
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Returns the first mismatching pair of elements from the ranges [first1, last1) and [first2, first2 + (last1 -
+ * first1)).
+ *
+ * @tparam t_input_iterator1 the type of the first iterator.
+ * @tparam t_input_iterator2 the type of the second iterator.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @return the iterators to the first mismatching elements, last1 and the corresponding iterator of the second range if
+ * there is no mismatch.
+ */
+template<class t_input_iterator1, class t_input_iterator2>
+inline ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch(t_input_iterator1 first1,
+                                                                            t_input_iterator1 last1,
+                                                                            t_input_iterator2 first2) {
+  return ::portable_stl::algorithm_helper::mismatch_dispatch(
+    first1,
+    last1,
+    first2,
+    ::portable_stl::algorithm_helper::simd_mismatch_tag<t_input_iterator1, t_input_iterator2>{});
+}
+
+/**
+ * @brief Returns the first mismatching pair of elements from the ranges [first1, last1) and [first2, first2 + (last1 -
+ * first1)).
+ *
+ * @tparam t_input_iterator1 the type of the first iterator.
+ * @tparam t_input_iterator2 the type of the second iterator.
+ * @tparam t_binary_predicate the type of the predicate.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param pred the predicate which returns true if the elements are equal.
+ * @return the iterators to the first mismatching elements, last1 and the corresponding iterator of the second range if
+ * there is no mismatch.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_binary_predicate>
+inline ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch(
+  t_input_iterator1 first1, t_input_iterator1 last1, t_input_iterator2 first2, t_binary_predicate pred) {
+  return ::portable_stl::algorithm_helper::mismatch_pred(first1, last1, first2, pred);
+}
+
+/**
+ * @brief Returns the first mismatching pair of elements from the ranges [first1, last1) and [first2, last2).
+ *
+ * @tparam t_input_iterator1 the type of the first iterator.
+ * @tparam t_input_iterator2 the type of the second iterator.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @return the iterators to the first mismatching elements, the ends of the shorter range and the corresponding iterator
+ * of the other range if there is no mismatch.
+ */
+template<class t_input_iterator1, class t_input_iterator2>
+inline ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch(
+  t_input_iterator1 first1, t_input_iterator1 last1, t_input_iterator2 first2, t_input_iterator2 last2) {
+  ::portable_stl::algorithm_helper::mismatch_equal pred;
+  return ::portable_stl::algorithm_helper::mismatch_impl(
+    first1,
+    last1,
+    first2,
+    last2,
+    pred,
+    typename ::portable_stl::iterator_traits<t_input_iterator1>::iterator_category{},
+    typename ::portable_stl::iterator_traits<t_input_iterator2>::iterator_category{});
+}
+
+/**
+ * @brief Returns the first mismatching pair of elements from the ranges [first1, last1) and [first2, last2).
+ *
+ * @tparam t_input_iterator1 the type of the first iterator.
+ * @tparam t_input_iterator2 the type of the second iterator.
+ * @tparam t_binary_predicate the type of the predicate.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @param pred the predicate which returns true if the elements are equal.
+ * @return the iterators to the first mismatching elements, the ends of the shorter range and the corresponding iterator
+ * of the other range if there is no mismatch.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_binary_predicate>
+inline ::portable_stl::tuple<t_input_iterator1, t_input_iterator2> mismatch(t_input_iterator1  first1,
+                                                                            t_input_iterator1  last1,
+                                                                            t_input_iterator2  first2,
+                                                                            t_input_iterator2  last2,
+                                                                            t_binary_predicate pred) {
+  return ::portable_stl::algorithm_helper::mismatch_impl(
+    first1,
+    last1,
+    first2,
+    last2,
+    pred,
+    typename ::portable_stl::iterator_traits<t_input_iterator1>::iterator_category{},
+    typename ::portable_stl::iterator_traits<t_input_iterator2>::iterator_category{});
+}
+
+} // namespace portable_stl
+
+#endif // PSTL_MISMATCH_H
@@ -11,13 +11,32 @@
 // ***************************************************************************
 #ifndef PSTL_CTZ_IMPL_H
 #define PSTL_CTZ_IMPL_H
+#include <intrin.h>
+
 #include "../../common/int32_t.h"
 #include "../../common/uint32_t.h"
+#include "../../common/uint64_t.h"
 
 namespace portable_stl {
 namespace algorithm_helper {
   inline ::portable_stl::int32_t ctz_impl(::portable_stl::uint32_t value) noexcept {
-    return __lzcnt(value);
+    unsigned long index{0};
+    static_cast<void>(_BitScanForward(&index, value));
+    return static_cast<::portable_stl::int32_t>(index);
+  }
+
+  inline ::portable_stl::int32_t ctz_impl(::portable_stl::uint64_t value) noexcept {
+#  if defined(_M_X64) || defined(_M_ARM64)
+    unsigned long index{0};
+    static_cast<void>(_BitScanForward64(&index, value));
+    return static_cast<::portable_stl::int32_t>(index);
+#  else
+    ::portable_stl::uint32_t const low{static_cast<::portable_stl::uint32_t>(value)};
+    if (0U != low) {
+      return ctz_impl(low);
+    }
+    return 32 + ctz_impl(static_cast<::portable_stl::uint32_t>(value >> 32U));
+#  endif
   }
 } // namespace algorithm_helper
 } // namespace portable_stl
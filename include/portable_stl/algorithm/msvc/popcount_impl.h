@@ -0,0 +1,38 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="popcount_impl.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_POPCOUNT_IMPL_H
+#define PSTL_POPCOUNT_IMPL_H
+#include "../../common/int32_t.h"
+#include "../../common/uint32_t.h"
+#include "../../common/uint64_t.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  // __popcnt requires the POPCNT instruction, which is not guaranteed on every target, so the bit-twiddling version is
+  // used. The optimizer recognizes it and emits popcnt when the target architecture allows.
+  inline ::portable_stl::int32_t popcount_impl(::portable_stl::uint32_t value) noexcept {
+    value = value - ((value >> 1U) & 0x55555555U);
+    value = (value & 0x33333333U) + ((value >> 2U) & 0x33333333U);
+    value = (value + (value >> 4U)) & 0x0F0F0F0FU;
+    return static_cast<::portable_stl::int32_t>((value * 0x01010101U) >> 24U);
+  }
+
+  inline ::portable_stl::int32_t popcount_impl(::portable_stl::uint64_t value) noexcept {
+    value = value - ((value >> 1U) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2U) & 0x3333333333333333ULL);
+    value = (value + (value >> 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<::portable_stl::int32_t>((value * 0x0101010101010101ULL) >> 56U);
+  }
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_POPCOUNT_IMPL_H
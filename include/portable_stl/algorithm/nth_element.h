@@ -0,0 +1,151 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="nth_element.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_NTH_ELEMENT_H
+#define PSTL_NTH_ELEMENT_H
+
+#include "../functional/less.h"
+#include "../iterator/iterator_traits.h"
+#include "algo_iter_swap.h"
+#include "heap_sift.h"
+#include "sort.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Places the element which would occur at nth in the sorted range by a heap of the nth - first + 1 smallest
+   * elements. O(n log(n)) fallback of introselect.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param nth the partition point.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void heap_select(t_random_access_iterator first,
+                   t_random_access_iterator nth,
+                   t_random_access_iterator last,
+                   t_compare               &comp) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    difference_type const heap_len{(nth - first) + 1};
+    ::portable_stl::algorithm_helper::make_heap_impl<2U>(first, comp, heap_len);
+    for (t_random_access_iterator iter{nth + 1}; iter != last; ++iter) {
+      if (comp(*iter, *first)) {
+        ::portable_stl::algo_iter_swap(iter, first);
+        ::portable_stl::algorithm_helper::sift_down<2U>(first, comp, heap_len, 0);
+      }
+    }
+    // the top of the heap is the greatest of the smallest elements
+    ::portable_stl::algo_iter_swap(first, nth);
+  }
+
+  /**
+   * @brief Introselect: quickselect with the pivot and the partitions of the pattern-defeating quicksort, which
+   * switches to the heap selection when the range is not halved often enough.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param nth the partition point, must be in [first, last).
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void introselect(t_random_access_iterator first,
+                   t_random_access_iterator nth,
+                   t_random_access_iterator last,
+                   t_compare               &comp) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    difference_type depth_limit{2 * ::portable_stl::algorithm_helper::sort_log2(last - first)};
+    bool            leftmost{true};
+    while (last - first >= static_cast<difference_type>(sort_insertion_threshold)) {
+      if (0 == depth_limit) {
+        ::portable_stl::algorithm_helper::heap_select(first, nth, last, comp);
+        return;
+      }
+      --depth_limit;
+
+      ::portable_stl::algorithm_helper::sort_choose_pivot(first, last, comp);
+      if ((!leftmost) && (!comp(*(first - 1), *first))) {
+        // the left part consists of the elements equal to the pivot only
+        t_random_access_iterator const pivot_pos{::portable_stl::algorithm_helper::partition_left(first, last, comp)};
+        if (nth <= pivot_pos) {
+          return;
+        }
+        first = pivot_pos + 1;
+        continue;
+      }
+
+      bool                           already_partitioned{false};
+      t_random_access_iterator const pivot_pos{::portable_stl::algorithm_helper::partition_right(
+        first,
+        last,
+        comp,
+        already_partitioned,
+        ::portable_stl::algorithm_helper::sort_is_branchless<t_random_access_iterator, t_compare>{})};
+      if (nth == pivot_pos) {
+        return;
+      }
+      if (nth < pivot_pos) {
+        last = pivot_pos;
+      } else {
+        first    = pivot_pos + 1;
+        leftmost = false;
+      }
+    }
+    ::portable_stl::algorithm_helper::insertion_sort(first, last, comp);
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Rearranges the elements in [first, last) so that the element at nth is the element which would occur there
+ * if the range was sorted, no element of [first, nth) is greater than it and no element of (nth, last) is less than
+ * it. Introselect: O(n) on average, O(n log(n)) in the worst case.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param nth the partition point.
+ * @param last the end of the range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ */
+template<class t_random_access_iterator, class t_compare>
+void nth_element(t_random_access_iterator first,
+                 t_random_access_iterator nth,
+                 t_random_access_iterator last,
+                 t_compare                comp) {
+  if (nth == last) {
+    return;
+  }
+  ::portable_stl::algorithm_helper::introselect(first, nth, last, comp);
+}
+
+/**
+ * @brief Rearranges the elements in [first, last) so that the element at nth is the element which would occur there
+ * if the range was sorted, no element of [first, nth) is greater than it and no element of (nth, last) is less than
+ * it.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param nth the partition point.
+ * @param last the end of the range.
+ */
+template<class t_random_access_iterator>
+inline void nth_element(t_random_access_iterator first, t_random_access_iterator nth, t_random_access_iterator last) {
+  ::portable_stl::nth_element(first, nth, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_NTH_ELEMENT_H
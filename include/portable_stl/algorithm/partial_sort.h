@@ -0,0 +1,63 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="partial_sort.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PARTIAL_SORT_H
+#define PSTL_PARTIAL_SORT_H
+
+#include "../functional/less.h"
+#include "nth_element.h"
+#include "sort.h"
+
+namespace portable_stl {
+/**
+ * @brief Rearranges the elements so that [first, middle) contains the middle - first smallest elements of
+ * [first, last) in non-descending order. The order of the rest of the elements is unspecified.
+ * The last of the smallest elements is placed by introselect, then the elements before it are sorted, so the
+ * complexity is O(n + k log(k)) on average.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param middle the end of the range to be sorted.
+ * @param last the end of the range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ */
+template<class t_random_access_iterator, class t_compare>
+void partial_sort(t_random_access_iterator first,
+                  t_random_access_iterator middle,
+                  t_random_access_iterator last,
+                  t_compare                comp) {
+  if (first == middle) {
+    return;
+  }
+  t_random_access_iterator const nth{middle - 1};
+  ::portable_stl::algorithm_helper::introselect(first, nth, last, comp);
+  ::portable_stl::sort(first, nth, comp);
+}
+
+/**
+ * @brief Rearranges the elements so that [first, middle) contains the middle - first smallest elements of
+ * [first, last) in non-descending order. The order of the rest of the elements is unspecified.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param middle the end of the range to be sorted.
+ * @param last the end of the range.
+ */
+template<class t_random_access_iterator>
+inline void partial_sort(t_random_access_iterator first,
+                         t_random_access_iterator middle,
+                         t_random_access_iterator last) {
+  ::portable_stl::partial_sort(first, middle, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_PARTIAL_SORT_H
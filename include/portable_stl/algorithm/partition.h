@@ -0,0 +1,169 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="partition.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PARTITION_H
+#define PSTL_PARTITION_H
+
+#include "../iterator/bidirectional_iterator_tag.h"
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/type_properties/is_trivially_copyable.h"
+#include "algo_iter_swap.h"
+#include "block_partition.h"
+#include "find_if_not.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Partition of the forward range: the elements satisfying the predicate are swapped to the front.
+   *
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the beginning of the second group.
+   */
+  template<class t_forward_iterator, class t_predicate>
+  t_forward_iterator partition_dispatch(t_forward_iterator first,
+                                        t_forward_iterator last,
+                                        t_predicate       &pred,
+                                        ::portable_stl::forward_iterator_tag) {
+    first = ::portable_stl::find_if_not(first, last, pred);
+    if (first != last) {
+      for (t_forward_iterator iter{first}; ++iter != last;) {
+        if (pred(*iter)) {
+          ::portable_stl::algo_iter_swap(first, iter);
+          ++first;
+        }
+      }
+    }
+    return first;
+  }
+
+  /**
+   * @brief Partition of the bidirectional range: the misplaced elements found from both ends are swapped.
+   *
+   * @tparam t_bidirectional_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the beginning of the second group.
+   */
+  template<class t_bidirectional_iterator, class t_predicate>
+  t_bidirectional_iterator partition_dispatch(t_bidirectional_iterator first,
+                                              t_bidirectional_iterator last,
+                                              t_predicate             &pred,
+                                              ::portable_stl::bidirectional_iterator_tag) {
+    for (;;) {
+      for (;; ++first) {
+        if (first == last) {
+          return first;
+        }
+        if (!pred(*first)) {
+          break;
+        }
+      }
+      do {
+        if (first == --last) {
+          return first;
+        }
+      } while (!pred(*last));
+      ::portable_stl::algo_iter_swap(first, last);
+      ++first;
+    }
+  }
+
+  /**
+   * @brief Partition of the random access range of trivially copyable elements: the branchless block partition.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the beginning of the second group.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator partition_random_access(t_random_access_iterator first,
+                                                   t_random_access_iterator last,
+                                                   t_predicate             &pred,
+                                                   ::portable_stl::true_type) {
+    return ::portable_stl::algorithm_helper::block_partition(first, last, pred);
+  }
+
+  /**
+   * @brief Partition of the random access range of the other elements.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the beginning of the second group.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator partition_random_access(t_random_access_iterator first,
+                                                   t_random_access_iterator last,
+                                                   t_predicate             &pred,
+                                                   ::portable_stl::false_type) {
+    return ::portable_stl::algorithm_helper::partition_dispatch(
+      first, last, pred, ::portable_stl::bidirectional_iterator_tag{});
+  }
+
+  /**
+   * @brief Partition of the random access range.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the beginning of the second group.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator partition_dispatch(t_random_access_iterator first,
+                                              t_random_access_iterator last,
+                                              t_predicate             &pred,
+                                              ::portable_stl::random_access_iterator_tag) {
+    return ::portable_stl::algorithm_helper::partition_random_access(
+      first,
+      last,
+      pred,
+      ::portable_stl::is_trivially_copyable<
+        typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type>{});
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Reorders the elements in the range [first, last) in such a way that all elements for which the predicate
+ * returns true precede the elements for which it returns false. Relative order of the elements is not preserved.
+ * Random access ranges of trivially copyable elements are partitioned without the data dependent branches, the
+ * misplaced elements are collected into blocks from both ends and exchanged block by block.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_predicate the type of predicate.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param pred the unary predicate which returns true if the element should be ordered before other elements.
+ * @return the iterator to the first element of the second group.
+ */
+template<class t_forward_iterator, class t_predicate>
+t_forward_iterator partition(t_forward_iterator first, t_forward_iterator last, t_predicate pred) {
+  return ::portable_stl::algorithm_helper::partition_dispatch(
+    first, last, pred, typename ::portable_stl::iterator_traits<t_forward_iterator>::iterator_category{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_PARTITION_H
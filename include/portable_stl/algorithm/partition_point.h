@@ -0,0 +1,98 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="partition_point.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PARTITION_POINT_H
+#define PSTL_PARTITION_POINT_H
+
+#include "../iterator/advance.h"
+#include "../iterator/distance.h"
+#include "../iterator/input_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "branchless_search.h"
+#include "unwrap_iter.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief partition_point for the forward iterators: binary search with the distance and advance.
+   *
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the iterator past the end of the first group.
+   */
+  template<class t_forward_iterator, class t_predicate>
+  t_forward_iterator partition_point_dispatch(t_forward_iterator first,
+                                              t_forward_iterator last,
+                                              t_predicate       &pred,
+                                              ::portable_stl::input_iterator_tag) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_forward_iterator>::difference_type;
+
+    difference_type len{::portable_stl::distance(first, last)};
+    while (len > 0) {
+      difference_type const half{len / 2};
+      t_forward_iterator    middle{first};
+      ::portable_stl::advance(middle, half);
+      if (pred(*middle)) {
+        first = ++middle;
+        len  -= half + 1;
+      } else {
+        len = half;
+      }
+    }
+    return first;
+  }
+
+  /**
+   * @brief partition_point for the random access iterators: branchless binary search, the contiguous ranges are
+   * searched by pointers with prefetch.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the iterator past the end of the first group.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator partition_point_dispatch(t_random_access_iterator first,
+                                                    t_random_access_iterator last,
+                                                    t_predicate             &pred,
+                                                    ::portable_stl::random_access_iterator_tag) {
+    return ::portable_stl::rewrap_iter(first,
+                                       ::portable_stl::algorithm_helper::branchless_partition_point(
+                                         ::portable_stl::unwrap_iter(first), last - first, pred));
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Examines the partitioned range [first, last) and locates the end of the first partition, that is, the first
+ * element that does not satisfy the predicate.
+ * Random access ranges are searched by the branchless binary search with prefetch.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_predicate the type of predicate.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param pred the unary predicate which returns true for the elements found in the beginning of the range.
+ * @return the iterator past the end of the first partition or last if all elements satisfy the predicate.
+ */
+template<class t_forward_iterator, class t_predicate>
+t_forward_iterator partition_point(t_forward_iterator first, t_forward_iterator last, t_predicate pred) {
+  return ::portable_stl::algorithm_helper::partition_point_dispatch(
+    first, last, pred, typename ::portable_stl::iterator_traits<t_forward_iterator>::iterator_category{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_PARTITION_POINT_H
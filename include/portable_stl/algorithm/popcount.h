@@ -0,0 +1,38 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="popcount.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_POPCOUNT_H
+#define PSTL_POPCOUNT_H
+
+#if defined(_MSC_VER)
+#  include "msvc/popcount_impl.h"
+#else // clang and gcc
+#  include "gcc_clang/popcount_impl.h"
+#endif
+
+namespace portable_stl {
+
+/**
+ * @brief Population count, are used to count the amount of ones in the numbers binary representation.
+ *
+ * @tparam t_unsigned the unsigned integer type up to 64 bits.
+ * @param value
+ * @return ::portable_stl::int32_t
+ */
+template<class t_unsigned> inline ::portable_stl::int32_t popcount(t_unsigned value) noexcept {
+  static_assert(sizeof(t_unsigned) <= sizeof(::portable_stl::uint64_t), "popcount supports up to 64-bit integers");
+  return (sizeof(t_unsigned) <= sizeof(::portable_stl::uint32_t))
+         ? algorithm_helper::popcount_impl(static_cast<::portable_stl::uint32_t>(value))
+         : algorithm_helper::popcount_impl(static_cast<::portable_stl::uint64_t>(value));
+}
+} // namespace portable_stl
+
+#endif // PSTL_POPCOUNT_H
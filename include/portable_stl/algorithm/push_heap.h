@@ -0,0 +1,47 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="push_heap.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PUSH_HEAP_H
+#define PSTL_PUSH_HEAP_H
+
+#include "../functional/less.h"
+#include "heap_sift.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Inserts the element at the position last - 1 into the max heap defined by the range [first, last - 1).
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the range of elements.
+ * @param last the range of elements.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ */
+template<class t_random_access_iterator, class t_compare>
+inline void push_heap(t_random_access_iterator first, t_random_access_iterator last, t_compare comp) {
+  ::portable_stl::algorithm_helper::sift_up<2U>(first, comp, last - first);
+}
+
+/**
+ * @brief Inserts the element at the position last - 1 into the max heap defined by the range [first, last - 1).
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the range of elements.
+ * @param last the range of elements.
+ */
+template<class t_random_access_iterator>
+inline void push_heap(t_random_access_iterator first, t_random_access_iterator last) {
+  ::portable_stl::push_heap(first, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_PUSH_HEAP_H
@@ -0,0 +1,602 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="radix_sort.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_RADIX_SORT_H
+#define PSTL_RADIX_SORT_H
+
+#include "../common/size_t.h"
+#include "../common/uint16_t.h"
+#include "../common/uint32_t.h"
+#include "../common/uint64_t.h"
+#include "../error/portable_stl_error.h"
+#include "../iterator/iterator_traits.h"
+#include "../memory/addressof.h"
+#include "../memory/allocate_noexcept.h"
+#include "../memory/allocator.h"
+#include "../memory/allocator_traits.h"
+#include "../memory/construct_at.h"
+#include "../memory/destroy_at.h"
+#include "../memory/memcpy.h"
+#include "../memory/rebind_alloc.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/other_transformations/enable_if_bool_constant.h"
+#include "../metaprogramming/other_transformations/invoke_result.h"
+#include "../metaprogramming/other_transformations/remove_cvref.h"
+#include "../metaprogramming/other_transformations/void_t.h"
+#include "../metaprogramming/primary_type/is_floating_point.h"
+#include "../metaprogramming/primary_type/is_integral.h"
+#include "../metaprogramming/sign_modifications/make_unsigned.h"
+#include "../metaprogramming/type_properties/is_signed.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/functional/invoke.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "algo_iter_swap.h"
+#include "sort.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief The number of the buckets of one 8-bit digit.
+   */
+  constexpr ::portable_stl::size_t radix_bucket_count{256U};
+  /**
+   * @brief The string buckets shorter than this are sorted by insertion sort.
+   */
+  constexpr ::portable_stl::size_t radix_msd_insertion_threshold{32U};
+
+  /**
+   * @brief Unsigned integer type of the given size.
+   * @tparam t_size the size of the type in bytes.
+   */
+  template<::portable_stl::size_t t_size> class radix_unsigned final {};
+
+  /**
+   * @brief Unsigned integer type of the size 1.
+   */
+  template<> class radix_unsigned<1U> final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = unsigned char;
+  };
+
+  /**
+   * @brief Unsigned integer type of the size 2.
+   */
+  template<> class radix_unsigned<2U> final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::uint16_t;
+  };
+
+  /**
+   * @brief Unsigned integer type of the size 4.
+   */
+  template<> class radix_unsigned<4U> final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::uint32_t;
+  };
+
+  /**
+   * @brief Unsigned integer type of the size 8.
+   */
+  template<> class radix_unsigned<8U> final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::uint64_t;
+  };
+
+  /**
+   * @brief Maps the key to the unsigned integer with the same order. No such mapping for the other types.
+   * @tparam t_key the type of the key.
+   */
+  template<class t_key, class = void> class radix_key_traits final {};
+
+  /**
+   * @brief Integral keys: the sign bit of the signed keys is flipped.
+   * @tparam t_key the type of the key.
+   */
+  template<class t_key>
+  class radix_key_traits<t_key, ::portable_stl::enable_if_bool_constant_t<::portable_stl::is_integral<t_key>>> final {
+  public:
+    /**
+     * @brief The unsigned integer type of the radix key.
+     */
+    using unsigned_type = typename radix_unsigned<sizeof(t_key)>::type;
+    /**
+     * @brief The key is sorted by the 8-bit digits from the least significant one.
+     */
+    using is_string     = ::portable_stl::false_type;
+
+    /**
+     * @brief Converts the key.
+     * @param key the key.
+     * @return the unsigned integer with the same order.
+     */
+    static unsigned_type get(t_key key) noexcept {
+      return static_cast<unsigned_type>(
+        static_cast<unsigned_type>(key)
+        ^ (::portable_stl::is_signed<t_key>{}() ? (static_cast<unsigned_type>(1U) << (sizeof(t_key) * 8U - 1U)) : 0U));
+    }
+  };
+
+  /**
+   * @brief Floating-point keys: the sign bit of the positive keys is set and all bits of the negative ones are flipped.
+   * -0.0 goes before +0.0, the NaNs go to the ends according to their sign.
+   * @tparam t_key the type of the key.
+   */
+  template<class t_key>
+  class radix_key_traits<t_key, ::portable_stl::enable_if_bool_constant_t<::portable_stl::is_floating_point<t_key>>>
+    final {
+  public:
+    /**
+     * @brief The unsigned integer type of the radix key.
+     */
+    using unsigned_type = typename radix_unsigned<sizeof(t_key)>::type;
+    /**
+     * @brief The key is sorted by the 8-bit digits from the least significant one.
+     */
+    using is_string     = ::portable_stl::false_type;
+
+    /**
+     * @brief Converts the key.
+     * @param key the key.
+     * @return the unsigned integer with the same order.
+     */
+    static unsigned_type get(t_key key) noexcept {
+      constexpr unsigned_type sign_bit{static_cast<unsigned_type>(static_cast<unsigned_type>(1U)
+                                                                  << (sizeof(t_key) * 8U - 1U))};
+      unsigned_type           bits{0U};
+      static_cast<void>(::portable_stl::memcpy(&bits, &key, sizeof(bits)));
+      return (0U != (bits & sign_bit)) ? static_cast<unsigned_type>(~bits)
+                                       : static_cast<unsigned_type>(bits | sign_bit);
+    }
+  };
+
+  /**
+   * @brief String keys (basic_string, basic_string_view): sorted by the 8-bit digits of the code units from the most
+   * significant one. The code units are ordered as unsigned values, as char_traits<char>::lt and the comparison of
+   * basic_string_view do; traits_type of the key is ignored.
+   * @tparam t_key the type of the key.
+   */
+  template<class t_key>
+  class radix_key_traits<t_key, ::portable_stl::void_t<typename t_key::traits_type, typename t_key::value_type>>
+    final {
+  public:
+    /**
+     * @brief The code unit type.
+     */
+    using char_type     = typename t_key::value_type;
+    /**
+     * @brief The unsigned integer type of the code unit.
+     */
+    using unsigned_type = ::portable_stl::make_unsigned_t<char_type>;
+    /**
+     * @brief The keys are sorted by MSD radix sort.
+     */
+    using is_string     = ::portable_stl::true_type;
+
+    /**
+     * @brief Converts the code unit.
+     * @param unit the code unit.
+     * @return the unsigned value of the code unit.
+     */
+    static unsigned_type get(char_type unit) noexcept {
+      return static_cast<unsigned_type>(unit);
+    }
+
+    /**
+     * @brief Gets the digit of the key.
+     * @param key the key.
+     * @param depth the index of the byte of the key from the most significant byte of the first code unit.
+     * @return 0 if the key is shorter than depth, the byte value + 1 otherwise.
+     */
+    static ::portable_stl::size_t digit(t_key const &key, ::portable_stl::size_t depth) noexcept {
+      ::portable_stl::size_t const unit_index{depth / sizeof(char_type)};
+      if (unit_index >= static_cast<::portable_stl::size_t>(key.size())) {
+        return 0U;
+      }
+      ::portable_stl::size_t const shift{(sizeof(char_type) - 1U - depth % sizeof(char_type)) * 8U};
+      return static_cast<::portable_stl::size_t>((get(key[unit_index]) >> shift) & 0xFFU) + 1U;
+    }
+  };
+
+  /**
+   * @brief Radix key of the projected value.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_projection the type of the key projection.
+   */
+  template<class t_random_access_iterator, class t_projection>
+  using radix_key_t = ::portable_stl::remove_cvref_t<::portable_stl::invoke_result_t<
+    t_projection &,
+    typename ::portable_stl::iterator_traits<t_random_access_iterator>::reference>>;
+
+  /**
+   * @brief Default key projection, the value itself is the key.
+   */
+  class radix_identity final {
+  public:
+    /**
+     * @brief Returns the value.
+     * @tparam t_type the type of value.
+     * @param value the value.
+     * @return the value.
+     */
+    template<class t_type> constexpr t_type &&operator()(t_type &&value) const noexcept {
+      return ::portable_stl::forward<t_type>(value);
+    }
+  };
+
+  /**
+   * @brief Compares the projected string keys, the first prefix_len code units are known to be equal.
+   * @tparam t_projection the type of the key projection.
+   * @tparam t_traits the type of the key traits.
+   */
+  template<class t_projection, class t_traits> class radix_string_less final {
+    /**
+     * @brief The key projection.
+     */
+    t_projection          &m_proj;
+    /**
+     * @brief The length of the common prefix.
+     */
+    ::portable_stl::size_t m_prefix_len;
+
+  public:
+    /**
+     * @brief Constructor.
+     * @param proj the key projection.
+     * @param prefix_len the length of the common prefix.
+     */
+    radix_string_less(t_projection &proj, ::portable_stl::size_t prefix_len) noexcept
+        : m_proj(proj), m_prefix_len(prefix_len) {
+    }
+
+    /**
+     * @brief Compares the keys of the values from prefix_len code unit, the code units are compared as unsigned values
+     * in the same order as the digits of the radix pass.
+     * @tparam t_type1 the type of the first value.
+     * @tparam t_type2 the type of the second value.
+     * @param lhv the first value.
+     * @param rhv the second value.
+     * @return true if the key of lhv is lexicographically less than the key of rhv.
+     */
+    template<class t_type1, class t_type2> bool operator()(t_type1 const &lhv, t_type2 const &rhv) const {
+      auto const                  &lhv_key = ::portable_stl::invoke(m_proj, lhv);
+      auto const                  &rhv_key = ::portable_stl::invoke(m_proj, rhv);
+      auto const                   lhv_len = static_cast<::portable_stl::size_t>(lhv_key.size());
+      auto const                   rhv_len = static_cast<::portable_stl::size_t>(rhv_key.size());
+      ::portable_stl::size_t const len{(lhv_len < rhv_len) ? lhv_len : rhv_len};
+      for (::portable_stl::size_t i{m_prefix_len}; i < len; ++i) {
+        if (lhv_key[i] != rhv_key[i]) {
+          return t_traits::get(lhv_key[i]) < t_traits::get(rhv_key[i]);
+        }
+      }
+      return lhv_len < rhv_len;
+    }
+  };
+
+  /**
+   * @brief Moves the elements of [first, first + len) to dst ordered by the digit, the order of the elements with the
+   * same digit is kept.
+   *
+   * @tparam t_construct the destination is uninitialized memory.
+   * @tparam t_source_iterator the type of the source iterator.
+   * @tparam t_destination_iterator the type of the destination iterator.
+   * @tparam t_projection the type of the key projection.
+   * @tparam t_traits the type of the key traits.
+   * @param first the beginning of the source.
+   * @param len the number of the elements.
+   * @param dst the beginning of the destination.
+   * @param proj the key projection.
+   * @param offsets the positions of the buckets in the destination, advanced by the scatter.
+   * @param shift the shift of the digit in the key.
+   */
+  template<bool t_construct, class t_source_iterator, class t_destination_iterator, class t_projection, class t_traits>
+  void radix_scatter(t_source_iterator      first,
+                     ::portable_stl::size_t len,
+                     t_destination_iterator dst,
+                     t_projection          &proj,
+                     t_traits const &,
+                     ::portable_stl::size_t *offsets,
+                     ::portable_stl::size_t  shift) {
+    for (::portable_stl::size_t i{0U}; i < len; ++i, ++first) {
+      ::portable_stl::size_t const digit{
+        static_cast<::portable_stl::size_t>((t_traits::get(::portable_stl::invoke(proj, *first)) >> shift) & 0xFFU)};
+      t_destination_iterator const target{
+        dst + static_cast<typename ::portable_stl::iterator_traits<t_destination_iterator>::difference_type>(
+          offsets[digit]++)};
+      if (t_construct) {
+        ::portable_stl::construct_at(::portable_stl::addressof(*target), ::portable_stl::move(*first));
+      } else {
+        *target = ::portable_stl::move(*first);
+      }
+    }
+  }
+
+  /**
+   * @brief LSD radix sort of the fixed-width keys. The histograms of all digits are collected in one pass, the passes
+   * of the digits which are equal for all keys are skipped. The elements move between the range and the scratch buffer.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_projection the type of the key projection.
+   * @tparam t_allocator the type of the scratch allocator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param proj the key projection.
+   * @param alloc the scratch allocator.
+   * @return nothing or the error if the scratch buffer can not be allocated, the range is not changed then.
+   */
+  template<class t_random_access_iterator, class t_projection, class t_allocator>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> radix_sort_impl(t_random_access_iterator first,
+                                                                                     t_random_access_iterator last,
+                                                                                     t_projection            &proj,
+                                                                                     t_allocator const       &alloc,
+                                                                                     ::portable_stl::false_type) {
+    using value_type      = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+    using t_traits        = radix_key_traits<radix_key_t<t_random_access_iterator, t_projection>>;
+    using unsigned_type   = typename t_traits::unsigned_type;
+    using t_scratch_alloc = ::portable_stl::rebind_alloc<::portable_stl::allocator_traits<t_allocator>, value_type>;
+
+    constexpr ::portable_stl::size_t digit_count{sizeof(unsigned_type)};
+    auto const                       len = static_cast<::portable_stl::size_t>(last - first);
+
+    ::portable_stl::size_t counts[digit_count][radix_bucket_count]{};
+    for (t_random_access_iterator iter{first}; iter != last; ++iter) {
+      unsigned_type const key{t_traits::get(::portable_stl::invoke(proj, *iter))};
+      for (::portable_stl::size_t digit{0U}; digit < digit_count; ++digit) {
+        ++counts[digit][static_cast<::portable_stl::size_t>((key >> (digit * 8U)) & 0xFFU)];
+      }
+    }
+
+    // the pass is skipped if all keys fall into the bucket of the first key
+    bool                   active[digit_count]{};
+    ::portable_stl::size_t active_count{0U};
+    unsigned_type const    first_key{t_traits::get(::portable_stl::invoke(proj, *first))};
+    for (::portable_stl::size_t digit{0U}; digit < digit_count; ++digit) {
+      active[digit] = (len != counts[digit][static_cast<::portable_stl::size_t>((first_key >> (digit * 8U)) & 0xFFU)]);
+      if (active[digit]) {
+        ++active_count;
+        ::portable_stl::size_t offset{0U};
+        for (::portable_stl::size_t bucket{0U}; bucket < radix_bucket_count; ++bucket) {
+          ::portable_stl::size_t const count{counts[digit][bucket]};
+          counts[digit][bucket]  = offset;
+          offset                += count;
+        }
+      }
+    }
+    if (0U == active_count) {
+      return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+    }
+
+    t_scratch_alloc scratch_alloc(alloc);
+    value_type     *buffer{::portable_stl::allocate_noexcept(scratch_alloc, len)};
+    if (nullptr == buffer) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+
+    bool in_buffer{false};
+    bool constructed{false};
+    for (::portable_stl::size_t digit{0U}; digit < digit_count; ++digit) {
+      if (active[digit]) {
+        if (in_buffer) {
+          ::portable_stl::algorithm_helper::radix_scatter<false>(
+            buffer, len, first, proj, t_traits{}, counts[digit], digit * 8U);
+        } else if (constructed) {
+          ::portable_stl::algorithm_helper::radix_scatter<false>(
+            first, len, buffer, proj, t_traits{}, counts[digit], digit * 8U);
+        } else {
+          ::portable_stl::algorithm_helper::radix_scatter<true>(
+            first, len, buffer, proj, t_traits{}, counts[digit], digit * 8U);
+          constructed = true;
+        }
+        in_buffer = !in_buffer;
+      }
+    }
+
+    if (in_buffer) {
+      t_random_access_iterator iter{first};
+      for (::portable_stl::size_t i{0U}; i < len; ++i, ++iter) {
+        *iter = ::portable_stl::move(buffer[i]);
+      }
+    }
+    for (::portable_stl::size_t i{0U}; i < len; ++i) {
+      ::portable_stl::destroy_at(buffer + i);
+    }
+    ::portable_stl::allocator_traits<t_scratch_alloc>::deallocate(scratch_alloc, buffer, len);
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief MSD radix sort of the string keys with American flag in-place partitioning: the elements are counted into
+   * the buckets of the current byte, permuted in place by cycles and every bucket is sorted by the next byte.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_projection the type of the key projection.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param proj the key projection.
+   * @param depth the index of the current byte, all keys of the range have the same depth bytes before it.
+   */
+  template<class t_random_access_iterator, class t_projection>
+  void american_flag_sort(t_random_access_iterator first,
+                          t_random_access_iterator last,
+                          t_projection            &proj,
+                          ::portable_stl::size_t   depth) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+    using t_traits        = radix_key_traits<radix_key_t<t_random_access_iterator, t_projection>>;
+
+    // bucket 0 holds the keys shorter than depth
+    constexpr ::portable_stl::size_t bucket_count{radix_bucket_count + 1U};
+
+    for (;;) {
+      auto const len = static_cast<::portable_stl::size_t>(last - first);
+      if (len <= radix_msd_insertion_threshold) {
+        radix_string_less<t_projection, t_traits> comp(proj, depth / sizeof(typename t_traits::char_type));
+        ::portable_stl::algorithm_helper::insertion_sort(first, last, comp);
+        return;
+      }
+
+      ::portable_stl::size_t heads[bucket_count]{};
+      for (t_random_access_iterator iter{first}; iter != last; ++iter) {
+        ++heads[t_traits::digit(::portable_stl::invoke(proj, *iter), depth)];
+      }
+      if (len == heads[0]) {
+        // all keys are equal
+        return;
+      }
+      ::portable_stl::size_t const first_digit{t_traits::digit(::portable_stl::invoke(proj, *first), depth)};
+      if (len == heads[first_digit]) {
+        // common byte
+        ++depth;
+        continue;
+      }
+
+      ::portable_stl::size_t tails[bucket_count];
+      ::portable_stl::size_t offset{0U};
+      for (::portable_stl::size_t bucket{0U}; bucket < bucket_count; ++bucket) {
+        offset        += heads[bucket];
+        heads[bucket]  = offset - heads[bucket];
+        tails[bucket]  = offset;
+      }
+
+      for (::portable_stl::size_t bucket{0U}; bucket < bucket_count; ++bucket) {
+        while (heads[bucket] < tails[bucket]) {
+          t_random_access_iterator const iter{first + static_cast<difference_type>(heads[bucket])};
+          ::portable_stl::size_t const   digit{t_traits::digit(::portable_stl::invoke(proj, *iter), depth)};
+          if (digit == bucket) {
+            ++heads[bucket];
+          } else {
+            ::portable_stl::algo_iter_swap(iter, first + static_cast<difference_type>(heads[digit]));
+            ++heads[digit];
+          }
+        }
+      }
+
+      // the keys of bucket 0 are equal, the other buckets are sorted by the next byte
+      for (::portable_stl::size_t bucket{1U}; bucket < bucket_count; ++bucket) {
+        if (tails[bucket] - tails[bucket - 1U] > 1U) {
+          ::portable_stl::algorithm_helper::american_flag_sort(first + static_cast<difference_type>(tails[bucket - 1U]),
+                                                               first + static_cast<difference_type>(tails[bucket]),
+                                                               proj,
+                                                               depth + 1U);
+        }
+      }
+      return;
+    }
+  }
+
+  /**
+   * @brief MSD radix sort of the string keys, no scratch memory is needed.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_projection the type of the key projection.
+   * @tparam t_allocator the type of the scratch allocator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param proj the key projection.
+   * @return nothing.
+   */
+  template<class t_random_access_iterator, class t_projection, class t_allocator>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> radix_sort_impl(t_random_access_iterator first,
+                                                                                     t_random_access_iterator last,
+                                                                                     t_projection            &proj,
+                                                                                     t_allocator const &,
+                                                                                     ::portable_stl::true_type) {
+    ::portable_stl::algorithm_helper::american_flag_sort(first, last, proj, 0U);
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Sorts the elements of [first, last) by the keys returned by the projection without comparisons.
+ * Integral and floating-point keys are sorted by LSD radix sort, O(n) per byte of the key, the bytes equal for all keys
+ * are skipped. The sort is stable and needs the scratch buffer for last - first elements from alloc.
+ * String keys (basic_string, basic_string_view) are sorted by MSD radix sort with in-place American flag partitioning,
+ * the sort is not stable and allocates nothing. The projection should return the string by reference or a view.
+ * The code units are ordered as unsigned values, traits_type of the string is ignored.
+ * The move of the elements must not throw.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_projection the type of the key projection.
+ * @tparam t_allocator the type of the scratch allocator, rebound to the value type.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param proj the key projection.
+ * @param alloc the scratch allocator.
+ * @return nothing or the error if the scratch buffer can not be allocated, the range is not changed then.
+ */
+template<class t_random_access_iterator, class t_projection, class t_allocator>
+::portable_stl::expected<void, ::portable_stl::portable_stl_error> radix_sort(t_random_access_iterator first,
+                                                                              t_random_access_iterator last,
+                                                                              t_projection             proj,
+                                                                              t_allocator const       &alloc) {
+  if (last - first < 2) {
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+  return ::portable_stl::algorithm_helper::radix_sort_impl(
+    first,
+    last,
+    proj,
+    alloc,
+    typename ::portable_stl::algorithm_helper::radix_key_traits<
+      ::portable_stl::algorithm_helper::radix_key_t<t_random_access_iterator, t_projection>>::is_string{});
+}
+
+/**
+ * @brief Sorts the elements of [first, last) by the keys returned by the projection without comparisons, the scratch
+ * buffer is allocated by ::portable_stl::allocator.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_projection the type of the key projection.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param proj the key projection.
+ * @return nothing or the error if the scratch buffer can not be allocated, the range is not changed then.
+ */
+template<class t_random_access_iterator, class t_projection>
+inline ::portable_stl::expected<void, ::portable_stl::portable_stl_error> radix_sort(t_random_access_iterator first,
+                                                                                     t_random_access_iterator last,
+                                                                                     t_projection             proj) {
+  return ::portable_stl::radix_sort(
+    first,
+    last,
+    proj,
+    ::portable_stl::allocator<typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type>{});
+}
+
+/**
+ * @brief Sorts the integral, floating-point or string values of [first, last) without comparisons.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @return nothing or the error if the scratch buffer can not be allocated, the range is not changed then.
+ */
+template<class t_random_access_iterator>
+inline ::portable_stl::expected<void, ::portable_stl::portable_stl_error> radix_sort(t_random_access_iterator first,
+                                                                                     t_random_access_iterator last) {
+  return ::portable_stl::radix_sort(first, last, ::portable_stl::algorithm_helper::radix_identity{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_RADIX_SORT_H
@@ -12,14 +12,109 @@
 #ifndef PSTL_REMOVE_IF_H
 #define PSTL_REMOVE_IF_H
 
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/type_properties/is_trivially_copyable.h"
 #include "../utility/general/move.h"
+#include "block_partition.h"
 #include "find_if.h"
 
 namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief remove_if after the first removed element: the kept elements are moved one by one.
+   *
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the first removed element.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the end of the kept elements.
+   */
+  template<class t_forward_iterator, class t_predicate>
+  t_forward_iterator remove_if_dispatch(t_forward_iterator first,
+                                        t_forward_iterator last,
+                                        t_predicate       &pred,
+                                        ::portable_stl::forward_iterator_tag) {
+    t_forward_iterator i = first;
+    while (++i != last) {
+      if (!pred(*i)) {
+        *first = ::portable_stl::move(*i);
+        ++first;
+      }
+    }
+    return first;
+  }
+
+  /**
+   * @brief remove_if after the first removed element for the random access ranges of trivially copyable elements:
+   * the branchless block compaction.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the first removed element.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the end of the kept elements.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator remove_if_random_access(t_random_access_iterator first,
+                                                   t_random_access_iterator last,
+                                                   t_predicate             &pred,
+                                                   ::portable_stl::true_type) {
+    return ::portable_stl::algorithm_helper::block_remove_if(first, last, pred);
+  }
+
+  /**
+   * @brief remove_if after the first removed element for the random access ranges of the other elements.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the first removed element.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the end of the kept elements.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator remove_if_random_access(t_random_access_iterator first,
+                                                   t_random_access_iterator last,
+                                                   t_predicate             &pred,
+                                                   ::portable_stl::false_type) {
+    return ::portable_stl::algorithm_helper::remove_if_dispatch(
+      first, last, pred, ::portable_stl::forward_iterator_tag{});
+  }
+
+  /**
+   * @brief remove_if after the first removed element for the random access ranges.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the first removed element.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @return the end of the kept elements.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator remove_if_dispatch(t_random_access_iterator first,
+                                              t_random_access_iterator last,
+                                              t_predicate             &pred,
+                                              ::portable_stl::random_access_iterator_tag) {
+    return ::portable_stl::algorithm_helper::remove_if_random_access(
+      first,
+      last,
+      pred,
+      ::portable_stl::is_trivially_copyable<
+        typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type>{});
+  }
+} // namespace algorithm_helper
 
 /**
  * @brief Removes all elements satisfying specific criteria from the range [first, last) and returns a past-the-end
  * iterator for the new end of the range.
+ * Random access ranges of trivially copyable elements are compacted without the data dependent branches: the offsets
+ * of the kept elements are collected into blocks and the elements are moved block by block.
  *
  * @tparam t_forward_iterator
  * @tparam t_predicate
@@ -33,13 +128,8 @@ template<class t_forward_iterator, class t_predicate>
 t_forward_iterator remove_if(t_forward_iterator first, t_forward_iterator last, t_predicate pred) {
   first = ::portable_stl::find_if(first, last, pred);
   if (first != last) {
-    t_forward_iterator i = first;
-    while (++i != last) {
-      if (!pred(*i)) {
-        *first = ::portable_stl::move(*i);
-        ++first;
-      }
-    }
+    first = ::portable_stl::algorithm_helper::remove_if_dispatch(
+      first, last, pred, typename ::portable_stl::iterator_traits<t_forward_iterator>::iterator_category{});
   }
   return first;
 }
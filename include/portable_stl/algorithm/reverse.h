@@ -0,0 +1,72 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="reverse.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_REVERSE_H
+#define PSTL_REVERSE_H
+
+#include "../iterator/bidirectional_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "algo_iter_swap.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief reverse for the bidirectional iterators.
+   *
+   * @tparam t_bidirectional_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   */
+  template<class t_bidirectional_iterator>
+  void reverse_dispatch(t_bidirectional_iterator first,
+                        t_bidirectional_iterator last,
+                        ::portable_stl::bidirectional_iterator_tag) {
+    while ((first != last) && (first != --last)) {
+      ::portable_stl::algo_iter_swap(first, last);
+      ++first;
+    }
+  }
+
+  /**
+   * @brief reverse for the random access iterators: one comparison per swap.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   */
+  template<class t_random_access_iterator>
+  void reverse_dispatch(t_random_access_iterator first,
+                        t_random_access_iterator last,
+                        ::portable_stl::random_access_iterator_tag) {
+    if (first != last) {
+      for (--last; first < last; ++first, --last) {
+        ::portable_stl::algo_iter_swap(first, last);
+      }
+    }
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Reverses the order of the elements in the range [first, last).
+ *
+ * @tparam t_bidirectional_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ */
+template<class t_bidirectional_iterator>
+void reverse(t_bidirectional_iterator first, t_bidirectional_iterator last) {
+  ::portable_stl::algorithm_helper::reverse_dispatch(
+    first, last, typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::iterator_category{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_REVERSE_H
@@ -201,6 +201,24 @@ inline t_forward_iterator1_type search(t_forward_iterator1_type iter_first1,
   return search(
     iter_first1, iter_last1, iter_first2, iter_last2, ::portable_stl::algorithm_helper::equal_to_inter{});
 }
+/**
+ * @brief Searches for the pattern of the searcher.
+ *
+ * @tparam t_forward_iterator Must meet the requirements of LegacyForwardIterator.
+ * @tparam t_searcher the type of the searcher, default_searcher, boyer_moore_searcher or
+ * boyer_moore_horspool_searcher.
+ * @param iter_first The range of elements to examine.
+ * @param iter_last The range of elements to examine.
+ * @param searcher the searcher which holds the pattern.
+ * @return Iterator to the beginning of first occurrence of the pattern in the range [iter_first, iter_last). If no such
+ * occurrence is found, iter_last is returned.
+ */
+template<class t_forward_iterator, class t_searcher>
+inline t_forward_iterator search(t_forward_iterator iter_first,
+                                 t_forward_iterator iter_last,
+                                 t_searcher const  &searcher) {
+  return ::portable_stl::get<0>(searcher(iter_first, iter_last));
+}
 } // namespace portable_stl
 
 #endif /* PSTL_SEARCH_H */
@@ -0,0 +1,87 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="set_union.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SET_UNION_H
+#define PSTL_SET_UNION_H
+
+#include "../functional/less.h"
+#include "copy.h"
+#include "gallop.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Copies the elements found in either of the sorted ranges [first1, last1) and [first2, last2) to the sorted
+ * range beginning at out. An element found m times in the first range and n times in the second one is copied
+ * max(m, n) times, the first m of them from the first range.
+ * If one random access range is much longer than the other one, the runs of the longer range are found by exponential
+ * search and copied at once.
+ *
+ * @tparam t_input_iterator1 the type of the first range iterator.
+ * @tparam t_input_iterator2 the type of the second range iterator.
+ * @tparam t_output_iterator the type of the output iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @param out the beginning of the destination range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ * @return the iterator past the last copied element.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_output_iterator, class t_compare>
+t_output_iterator set_union(t_input_iterator1 first1,
+                            t_input_iterator1 last1,
+                            t_input_iterator2 first2,
+                            t_input_iterator2 last2,
+                            t_output_iterator out,
+                            t_compare         comp) {
+  bool const skewed{::portable_stl::algorithm_helper::is_skewed(first1, last1, first2, last2)};
+  while ((first1 != last1) && (first2 != last2)) {
+    if (comp(*first1, *first2)) {
+      first1 = ::portable_stl::algorithm_helper::copy_less(first1, last1, out, *first2, comp, skewed);
+    } else if (comp(*first2, *first1)) {
+      first2 = ::portable_stl::algorithm_helper::copy_less(first2, last2, out, *first1, comp, skewed);
+    } else {
+      *out = *first1;
+      ++out;
+      ++first1;
+      ++first2;
+    }
+  }
+  return ::portable_stl::copy(first2, last2, ::portable_stl::copy(first1, last1, out));
+}
+
+/**
+ * @brief Copies the elements found in either of the sorted ranges [first1, last1) and [first2, last2) to the sorted
+ * range beginning at out.
+ *
+ * @tparam t_input_iterator1 the type of the first range iterator.
+ * @tparam t_input_iterator2 the type of the second range iterator.
+ * @tparam t_output_iterator the type of the output iterator.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @param out the beginning of the destination range.
+ * @return the iterator past the last copied element.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_output_iterator>
+t_output_iterator set_union(t_input_iterator1 first1,
+                            t_input_iterator1 last1,
+                            t_input_iterator2 first2,
+                            t_input_iterator2 last2,
+                            t_output_iterator out) {
+  return ::portable_stl::set_union(first1, last1, first2, last2, out, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_SET_UNION_H
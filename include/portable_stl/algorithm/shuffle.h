@@ -0,0 +1,107 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="shuffle.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SHUFFLE_H
+#define PSTL_SHUFFLE_H
+
+#include "../common/uint64_t.h"
+#include "../iterator/iterator_traits.h"
+#include "../metaprogramming/reference_modifications/remove_reference.h"
+#include "algo_iter_swap.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Draws the next value of the generator shifted to start from zero.
+   *
+   * @tparam t_urbg the type of uniform random bit generator.
+   * @param gen the generator.
+   * @return the value in [0, max() - min()].
+   */
+  template<class t_urbg> ::portable_stl::uint64_t shuffle_draw(t_urbg &gen) {
+    return static_cast<::portable_stl::uint64_t>(gen() - ::portable_stl::remove_reference_t<t_urbg>::min());
+  }
+
+  /**
+   * @brief Returns the uniformly distributed value in [0, bound).
+   * The values of the generator beyond the largest multiple of bound are rejected. The generators with the range
+   * shorter than bound are combined from several draws.
+   * UB: bound == 0 or bound > 2^63.
+   *
+   * @tparam t_urbg the type of uniform random bit generator.
+   * @param gen the generator.
+   * @param bound the number of the values.
+   * @return the value in [0, bound).
+   */
+  template<class t_urbg> ::portable_stl::uint64_t shuffle_uniform(t_urbg &gen, ::portable_stl::uint64_t bound) {
+    using gen_type = ::portable_stl::remove_reference_t<t_urbg>;
+
+    auto const range = static_cast<::portable_stl::uint64_t>(gen_type::max() - gen_type::min());
+    if (static_cast<::portable_stl::uint64_t>(-1) == range) {
+      // the full 64-bit range: 2^64 mod bound values are rejected
+      ::portable_stl::uint64_t const rejected{(static_cast<::portable_stl::uint64_t>(0U) - bound) % bound};
+      for (;;) {
+        ::portable_stl::uint64_t const value{::portable_stl::algorithm_helper::shuffle_draw(gen)};
+        if (value >= rejected) {
+          return value % bound;
+        }
+      }
+    }
+
+    ::portable_stl::uint64_t const span{range + 1U};
+    if (span >= bound) {
+      ::portable_stl::uint64_t const limit{span - span % bound};
+      for (;;) {
+        ::portable_stl::uint64_t const value{::portable_stl::algorithm_helper::shuffle_draw(gen)};
+        if (value < limit) {
+          return value % bound;
+        }
+      }
+    }
+
+    // the high digit in base span is uniform in [0, ceil(bound / span))
+    ::portable_stl::uint64_t const high_bound{(bound - 1U) / span + 1U};
+    for (;;) {
+      ::portable_stl::uint64_t const value{::portable_stl::algorithm_helper::shuffle_uniform(gen, high_bound) * span
+                                           + ::portable_stl::algorithm_helper::shuffle_draw(gen)};
+      if (value < bound) {
+        return value;
+      }
+    }
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Reorders the elements in the range [first, last) such that each possible permutation of those elements has
+ * equal probability of appearance (Fisher-Yates shuffle).
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_urbg the type of uniform random bit generator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param gen the uniform random bit generator.
+ */
+template<class t_random_access_iterator, class t_urbg>
+void shuffle(t_random_access_iterator first, t_random_access_iterator last, t_urbg &&gen) {
+  using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+  difference_type const len{last - first};
+  for (difference_type pos{1}; pos < len; ++pos) {
+    auto const other = static_cast<difference_type>(
+      ::portable_stl::algorithm_helper::shuffle_uniform(gen, static_cast<::portable_stl::uint64_t>(pos) + 1U));
+    if (other != pos) {
+      ::portable_stl::algo_iter_swap(first + pos, first + other);
+    }
+  }
+}
+} // namespace portable_stl
+
+#endif // PSTL_SHUFFLE_H
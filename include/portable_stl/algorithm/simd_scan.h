@@ -0,0 +1,586 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="simd_scan.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SIMD_SCAN_H
+#define PSTL_SIMD_SCAN_H
+
+#if defined(__AVX2__)
+#  include "avx2/simd_ops_impl.h"
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#  include "sse2/simd_ops_impl.h"
+#else
+#  include "generic/simd_ops_impl.h"
+#endif
+
+#include "../common/int32_t.h"
+#include "../common/size_t.h"
+#include "../common/uint32_t.h"
+#include "../common/uint64_t.h"
+#include "../metaprogramming/cv_modifications/remove_cv.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/other_transformations/conditional.h"
+#include "../metaprogramming/pointer_modifications/remove_pointer.h"
+#include "../metaprogramming/primary_type/is_floating_point.h"
+#include "../metaprogramming/primary_type/is_integral.h"
+#include "../metaprogramming/primary_type/is_pointer.h"
+#include "../metaprogramming/type_properties/is_signed.h"
+#include "../metaprogramming/type_properties/is_volatile.h"
+#include "../metaprogramming/type_relations/is_same.h"
+#include "../utility/general/declval.h"
+#include "ctz.h"
+#include "popcount.h"
+#include "unwrap_iter.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Vector operations on the elements of the given type.
+   * The integers select the operations by the size and signedness, bool and the other types have no operations.
+   * @tparam t_type the type of the elements.
+   */
+  template<class t_type>
+  using simd_ops = ::portable_stl::conditional_t<
+    ::portable_stl::is_same<t_type, float>{}(),
+    simd_float_ops,
+    ::portable_stl::conditional_t<
+      ::portable_stl::is_same<t_type, double>{}(),
+      simd_double_ops,
+      simd_integer_ops<(::portable_stl::is_integral<t_type>{}() && (!::portable_stl::is_same<t_type, bool>{}()))
+                         ? sizeof(t_type)
+                         : 0U,
+                       ::portable_stl::is_signed<
+                         ::portable_stl::conditional_t<::portable_stl::is_integral<t_type>{}(), t_type, int>>{}()>>>;
+
+  /**
+   * @brief Number of bytes scanned by one step of the unrolled vector loops, the bitmasks of the step fill uint64_t.
+   */
+  constexpr ::portable_stl::size_t simd_group_bytes{64U};
+
+  /**
+   * @brief Type of the iterator with the wrappers removed.
+   * @tparam t_iterator the type of iterator.
+   */
+  template<class t_iterator>
+  using simd_unwrapped_t = decltype(::portable_stl::unwrap_iter(::portable_stl::declval<t_iterator>()));
+
+  /**
+   * @brief Type of the elements of the contiguous range.
+   * @tparam t_iterator the type of iterator.
+   */
+  template<class t_iterator>
+  using simd_element_t = ::portable_stl::remove_cv_t<::portable_stl::remove_pointer_t<simd_unwrapped_t<t_iterator>>>;
+
+  /**
+   * @brief Selects the vector loops: the iterator unwraps to the pointer to the non-volatile elements with the vector
+   * operations.
+   * @tparam t_iterator the type of iterator.
+   */
+  template<class t_iterator>
+  using simd_range_tag = ::portable_stl::bool_constant<
+    ::portable_stl::is_pointer<simd_unwrapped_t<t_iterator>>{}()
+    && (!::portable_stl::is_volatile<::portable_stl::remove_pointer_t<simd_unwrapped_t<t_iterator>>>{}())
+    && typename simd_ops<simd_element_t<t_iterator>>::is_supported{}()>;
+
+  /**
+   * @brief The comparison of the element with the value is the comparison of the element with the value converted to
+   * the element type: the integers, or the floating-point element with the integer or not wider floating-point value.
+   * @tparam t_element the type of the elements.
+   * @tparam t_value the type of the value.
+   */
+  template<class t_element, class t_value>
+  using simd_value_compatible = ::portable_stl::bool_constant<
+    (::portable_stl::is_integral<t_value>{}() && (!::portable_stl::is_same<t_value, bool>{}())
+     && (::portable_stl::is_floating_point<t_element>{}() || ::portable_stl::is_integral<t_element>{}()))
+    || (::portable_stl::is_floating_point<t_element>{}() && ::portable_stl::is_floating_point<t_value>{}()
+        && (sizeof(t_value) <= sizeof(t_element)))>;
+
+  /**
+   * @brief Selects the vector loops of the search for the value.
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_value the type of the value.
+   */
+  template<class t_iterator, class t_value>
+  using simd_find_tag
+    = ::portable_stl::bool_constant<simd_range_tag<t_iterator>{}()
+                                    && simd_value_compatible<simd_element_t<t_iterator>,
+                                                             ::portable_stl::remove_cv_t<t_value>>{}()>;
+
+  /**
+   * @brief Selects the vector loops of the comparison of two ranges with the same element type.
+   * @tparam t_iterator1 the type of the first iterator.
+   * @tparam t_iterator2 the type of the second iterator.
+   */
+  template<class t_iterator1, class t_iterator2>
+  using simd_mismatch_tag = ::portable_stl::bool_constant<
+    simd_range_tag<t_iterator1>{}() && simd_range_tag<t_iterator2>{}()
+    && ::portable_stl::is_same<simd_element_t<t_iterator1>, simd_element_t<t_iterator2>>{}()>;
+
+  /**
+   * @brief Selects the vector loops of the search for the smallest and the greatest elements: the lanes have min and
+   * max, which the floating-point lanes do not have because of the NaN order.
+   * @tparam t_iterator the type of iterator.
+   */
+  template<class t_iterator>
+  using simd_min_max_tag
+    = ::portable_stl::bool_constant<simd_range_tag<t_iterator>{}()
+                                    && typename simd_ops<simd_element_t<t_iterator>>::has_min_max{}()>;
+
+  /**
+   * @brief Selects the vector loops of the sum: the contiguous range of t_type whose lanes have the addition.
+   * bool has no lanes, the sums of the lanes of bool would not saturate.
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_type the type of the sum.
+   */
+  template<class t_iterator, class t_type>
+  using simd_sum_tag = ::portable_stl::bool_constant<
+    ::portable_stl::is_pointer<simd_unwrapped_t<t_iterator>>{}()
+    && (!::portable_stl::is_volatile<::portable_stl::remove_pointer_t<simd_unwrapped_t<t_iterator>>>{}())
+    && ::portable_stl::is_same<simd_element_t<t_iterator>, t_type>{}() && typename simd_ops<t_type>::has_add{}()>;
+
+  /**
+   * @brief Converts the searched value to the element type.
+   * @tparam t_element the type of the elements.
+   * @tparam t_value the type of the value.
+   * @param value the value.
+   * @param needle the converted value.
+   * @return true if the elements equal to the value are exactly the elements equal to needle, false if no element
+   * can be equal to the value.
+   */
+  template<class t_element, class t_value> bool simd_needle(t_value const &value, t_element &needle) noexcept {
+    needle = static_cast<t_element>(value);
+    return needle == value;
+  }
+
+  /**
+   * @brief Returns the index of the highest set bit.
+   * @param mask the non-zero bitmask.
+   * @return the index of the highest set bit.
+   */
+  inline ::portable_stl::int32_t simd_highest_bit(::portable_stl::uint64_t mask) noexcept {
+    mask |= mask >> 1U;
+    mask |= mask >> 2U;
+    mask |= mask >> 4U;
+    mask |= mask >> 8U;
+    mask |= mask >> 16U;
+    mask |= mask >> 32U;
+    return ::portable_stl::popcount(mask) - 1;
+  }
+
+  /**
+   * @brief Returns the bitmask of the bytes of the elements equal to needle in simd_group_bytes bytes.
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the bytes.
+   * @param needle the broadcast value.
+   * @return the bitmask, one bit per byte.
+   */
+  template<class t_type>
+  ::portable_stl::uint64_t simd_group_equal_mask(t_type const                               *first,
+                                                 typename simd_ops<t_type>::vector_type const needle) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    ::portable_stl::uint64_t mask{0U};
+    for (::portable_stl::size_t index{0U}; index < simd_group_bytes / sizeof(vector_type); ++index) {
+      mask |= static_cast<::portable_stl::uint64_t>(
+                ops::equal_mask(ops::load(first + index * (sizeof(vector_type) / sizeof(t_type))), needle))
+           << (index * sizeof(vector_type));
+    }
+    return mask;
+  }
+
+  /**
+   * @brief Finds the first element equal to value in the range [first, last).
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the pointer to the element or last if there is no such element.
+   */
+  template<class t_type> t_type const *simd_find(t_type const *first, t_type const *last, t_type value) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    constexpr ::portable_stl::size_t lanes{sizeof(vector_type) / sizeof(t_type)};
+    constexpr ::portable_stl::size_t group_lanes{simd_group_bytes / sizeof(t_type)};
+
+    vector_type const needle{ops::broadcast(value)};
+    for (; static_cast<::portable_stl::size_t>(last - first) >= group_lanes; first += group_lanes) {
+      ::portable_stl::uint64_t const mask{simd_group_equal_mask(first, needle)};
+      if (0U != mask) {
+        return first + static_cast<::portable_stl::size_t>(::portable_stl::ctz(mask)) / sizeof(t_type);
+      }
+    }
+    for (; static_cast<::portable_stl::size_t>(last - first) >= lanes; first += lanes) {
+      ::portable_stl::uint32_t const mask{ops::equal_mask(ops::load(first), needle)};
+      if (0U != mask) {
+        return first + static_cast<::portable_stl::size_t>(::portable_stl::ctz(mask)) / sizeof(t_type);
+      }
+    }
+    for (; first != last; ++first) {
+      if (*first == value) {
+        break;
+      }
+    }
+    return first;
+  }
+
+  /**
+   * @brief Finds the last element equal to value in the range [first, last).
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the pointer to the element or last if there is no such element.
+   */
+  template<class t_type> t_type const *simd_find_last(t_type const *first, t_type const *last, t_type value) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    constexpr ::portable_stl::size_t lanes{sizeof(vector_type) / sizeof(t_type)};
+    constexpr ::portable_stl::size_t group_lanes{simd_group_bytes / sizeof(t_type)};
+
+    t_type const     *pos{last};
+    vector_type const needle{ops::broadcast(value)};
+    while (static_cast<::portable_stl::size_t>(pos - first) >= group_lanes) {
+      pos -= group_lanes;
+      ::portable_stl::uint64_t const mask{simd_group_equal_mask(pos, needle)};
+      if (0U != mask) {
+        return pos + static_cast<::portable_stl::size_t>(simd_highest_bit(mask)) / sizeof(t_type);
+      }
+    }
+    while (static_cast<::portable_stl::size_t>(pos - first) >= lanes) {
+      pos -= lanes;
+      ::portable_stl::uint32_t const mask{ops::equal_mask(ops::load(pos), needle)};
+      if (0U != mask) {
+        return pos + static_cast<::portable_stl::size_t>(simd_highest_bit(mask)) / sizeof(t_type);
+      }
+    }
+    while (pos != first) {
+      --pos;
+      if (*pos == value) {
+        return pos;
+      }
+    }
+    return last;
+  }
+
+  /**
+   * @brief Counts the elements equal to value in the range [first, last).
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the number of the elements.
+   */
+  template<class t_type>
+  ::portable_stl::size_t simd_count(t_type const *first, t_type const *last, t_type value) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    constexpr ::portable_stl::size_t lanes{sizeof(vector_type) / sizeof(t_type)};
+    constexpr ::portable_stl::size_t group_lanes{simd_group_bytes / sizeof(t_type)};
+
+    // every equal element sets sizeof(t_type) bits of the bitmask
+    ::portable_stl::size_t bits{0U};
+    vector_type const      needle{ops::broadcast(value)};
+    for (; static_cast<::portable_stl::size_t>(last - first) >= group_lanes; first += group_lanes) {
+      bits += static_cast<::portable_stl::size_t>(::portable_stl::popcount(simd_group_equal_mask(first, needle)));
+    }
+    for (; static_cast<::portable_stl::size_t>(last - first) >= lanes; first += lanes) {
+      bits += static_cast<::portable_stl::size_t>(
+        ::portable_stl::popcount(ops::equal_mask(ops::load(first), needle)));
+    }
+
+    ::portable_stl::size_t result{bits / sizeof(t_type)};
+    for (; first != last; ++first) {
+      if (*first == value) {
+        ++result;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Finds the first position where the ranges [first1, last1) and [first2, first2 + (last1 - first1)) differ.
+   * @tparam t_type the type of the elements.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @return the index of the first position or last1 - first1 if the ranges are equal.
+   */
+  template<class t_type>
+  ::portable_stl::size_t simd_mismatch(t_type const *first1, t_type const *last1, t_type const *first2) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    constexpr ::portable_stl::size_t lanes{sizeof(vector_type) / sizeof(t_type)};
+    constexpr ::portable_stl::size_t group_lanes{simd_group_bytes / sizeof(t_type)};
+    constexpr ::portable_stl::uint64_t vector_mask{(static_cast<::portable_stl::uint64_t>(1U) << sizeof(vector_type))
+                                                   - 1U};
+
+    t_type const *const start{first1};
+    for (; static_cast<::portable_stl::size_t>(last1 - first1) >= group_lanes;
+         first1 += group_lanes, first2 += group_lanes) {
+      ::portable_stl::uint64_t mask{0U};
+      for (::portable_stl::size_t index{0U}; index < simd_group_bytes / sizeof(vector_type); ++index) {
+        mask |= static_cast<::portable_stl::uint64_t>(
+                  ops::equal_mask(ops::load(first1 + index * lanes), ops::load(first2 + index * lanes)))
+             << (index * sizeof(vector_type));
+      }
+      if (0U != ~mask) {
+        return static_cast<::portable_stl::size_t>(first1 - start)
+             + static_cast<::portable_stl::size_t>(::portable_stl::ctz(~mask)) / sizeof(t_type);
+      }
+    }
+    for (; static_cast<::portable_stl::size_t>(last1 - first1) >= lanes; first1 += lanes, first2 += lanes) {
+      ::portable_stl::uint64_t const mask{
+        vector_mask & ~static_cast<::portable_stl::uint64_t>(ops::equal_mask(ops::load(first1), ops::load(first2)))};
+      if (0U != mask) {
+        return static_cast<::portable_stl::size_t>(first1 - start)
+             + static_cast<::portable_stl::size_t>(::portable_stl::ctz(mask)) / sizeof(t_type);
+      }
+    }
+    for (; (first1 != last1) && (*first1 == *first2); ++first1, ++first2) {
+    }
+    return static_cast<::portable_stl::size_t>(first1 - start);
+  }
+
+  /**
+   * @brief Computes the minimum and the maximum of the range [first, last) by the vector loops.
+   * The range has at least one vector of the elements, the last partial vector overlaps the previous one.
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param min_value the minimum.
+   * @param max_value the maximum.
+   */
+  template<class t_type>
+  void simd_minmax_vector(t_type const *first, t_type const *last, t_type &min_value, t_type &max_value) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    constexpr ::portable_stl::size_t lanes{sizeof(vector_type) / sizeof(t_type)};
+
+    vector_type min_vector{ops::load(first)};
+    vector_type max_vector{min_vector};
+    for (first += lanes; static_cast<::portable_stl::size_t>(last - first) >= lanes; first += lanes) {
+      vector_type const value{ops::load(first)};
+      min_vector = ops::min(min_vector, value);
+      max_vector = ops::max(max_vector, value);
+    }
+    if (first != last) {
+      vector_type const value{ops::load(last - lanes)};
+      min_vector = ops::min(min_vector, value);
+      max_vector = ops::max(max_vector, value);
+    }
+
+    t_type min_lanes[lanes];
+    t_type max_lanes[lanes];
+    ops::store(min_lanes, min_vector);
+    ops::store(max_lanes, max_vector);
+    min_value = min_lanes[0];
+    max_value = max_lanes[0];
+    for (::portable_stl::size_t index{1U}; index < lanes; ++index) {
+      if (min_lanes[index] < min_value) {
+        min_value = min_lanes[index];
+      }
+      if (max_value < max_lanes[index]) {
+        max_value = max_lanes[index];
+      }
+    }
+  }
+
+  /**
+   * @brief Computes the minimum of the range [first, last) by the vector loops.
+   * The range has at least one vector of the elements, the last partial vector overlaps the previous one.
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the minimum.
+   */
+  template<class t_type> t_type simd_min_vector(t_type const *first, t_type const *last) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    constexpr ::portable_stl::size_t lanes{sizeof(vector_type) / sizeof(t_type)};
+
+    vector_type result{ops::load(first)};
+    for (first += lanes; static_cast<::portable_stl::size_t>(last - first) >= lanes; first += lanes) {
+      result = ops::min(result, ops::load(first));
+    }
+    if (first != last) {
+      result = ops::min(result, ops::load(last - lanes));
+    }
+
+    t_type values[lanes];
+    ops::store(values, result);
+    t_type min_value{values[0]};
+    for (::portable_stl::size_t index{1U}; index < lanes; ++index) {
+      if (values[index] < min_value) {
+        min_value = values[index];
+      }
+    }
+    return min_value;
+  }
+
+  /**
+   * @brief Computes the maximum of the range [first, last) by the vector loops.
+   * The range has at least one vector of the elements, the last partial vector overlaps the previous one.
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the maximum.
+   */
+  template<class t_type> t_type simd_max_vector(t_type const *first, t_type const *last) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    constexpr ::portable_stl::size_t lanes{sizeof(vector_type) / sizeof(t_type)};
+
+    vector_type result{ops::load(first)};
+    for (first += lanes; static_cast<::portable_stl::size_t>(last - first) >= lanes; first += lanes) {
+      result = ops::max(result, ops::load(first));
+    }
+    if (first != last) {
+      result = ops::max(result, ops::load(last - lanes));
+    }
+
+    t_type values[lanes];
+    ops::store(values, result);
+    t_type max_value{values[0]};
+    for (::portable_stl::size_t index{1U}; index < lanes; ++index) {
+      if (max_value < values[index]) {
+        max_value = values[index];
+      }
+    }
+    return max_value;
+  }
+  /**
+   * @brief Finds the first smallest element of the range [first, last).
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the pointer to the element or last if the range is empty.
+   */
+  template<class t_type> t_type const *simd_min_element(t_type const *first, t_type const *last) noexcept {
+    if (static_cast<::portable_stl::size_t>(last - first)
+        < sizeof(typename simd_ops<t_type>::vector_type) / sizeof(t_type)) {
+      t_type const *result{first};
+      for (; first != last; ++first) {
+        if (*first < *result) {
+          result = first;
+        }
+      }
+      return result;
+    }
+    return simd_find(first, last, simd_min_vector(first, last));
+  }
+
+  /**
+   * @brief Finds the first greatest element of the range [first, last).
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the pointer to the element or last if the range is empty.
+   */
+  template<class t_type> t_type const *simd_max_element(t_type const *first, t_type const *last) noexcept {
+    if (static_cast<::portable_stl::size_t>(last - first)
+        < sizeof(typename simd_ops<t_type>::vector_type) / sizeof(t_type)) {
+      t_type const *result{first};
+      for (; first != last; ++first) {
+        if (*result < *first) {
+          result = first;
+        }
+      }
+      return result;
+    }
+    return simd_find(first, last, simd_max_vector(first, last));
+  }
+
+  /**
+   * @brief Finds the first smallest and the last greatest elements of the range [first, last).
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param min_pos the pointer to the smallest element or last if the range is empty.
+   * @param max_pos the pointer to the greatest element or last if the range is empty.
+   */
+  template<class t_type>
+  void simd_minmax_element(
+    t_type const *first, t_type const *last, t_type const *&min_pos, t_type const *&max_pos) noexcept {
+    if (static_cast<::portable_stl::size_t>(last - first)
+        < sizeof(typename simd_ops<t_type>::vector_type) / sizeof(t_type)) {
+      min_pos = first;
+      max_pos = first;
+      for (; first != last; ++first) {
+        if (*first < *min_pos) {
+          min_pos = first;
+        }
+        if (!(*first < *max_pos)) {
+          max_pos = first;
+        }
+      }
+      return;
+    }
+    t_type min_value;
+    t_type max_value;
+    simd_minmax_vector(first, last, min_value, max_value);
+    min_pos = simd_find(first, last, min_value);
+    max_pos = simd_find_last(first, last, max_value);
+  }
+
+  /**
+   * @brief Computes the sum of init and the elements of the range [first, last) by four vector accumulators.
+   * The integer sums wrap around like the scalar sums converted to t_type, the floating-point sums are regrouped.
+   * @tparam t_type the type of the elements.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @return the sum.
+   */
+  template<class t_type> t_type simd_sum(t_type const *first, t_type const *last, t_type init) noexcept {
+    using ops         = simd_ops<t_type>;
+    using vector_type = typename ops::vector_type;
+
+    constexpr ::portable_stl::size_t lanes{sizeof(vector_type) / sizeof(t_type)};
+    constexpr ::portable_stl::size_t step{4U * lanes};
+
+    if (static_cast<::portable_stl::size_t>(last - first) >= step) {
+      vector_type sum0{ops::load(first)};
+      vector_type sum1{ops::load(first + lanes)};
+      vector_type sum2{ops::load(first + 2U * lanes)};
+      vector_type sum3{ops::load(first + 3U * lanes)};
+      for (first += step; static_cast<::portable_stl::size_t>(last - first) >= step; first += step) {
+        sum0 = ops::add(sum0, ops::load(first));
+        sum1 = ops::add(sum1, ops::load(first + lanes));
+        sum2 = ops::add(sum2, ops::load(first + 2U * lanes));
+        sum3 = ops::add(sum3, ops::load(first + 3U * lanes));
+      }
+      sum0 = ops::add(ops::add(sum0, sum1), ops::add(sum2, sum3));
+      for (; static_cast<::portable_stl::size_t>(last - first) >= lanes; first += lanes) {
+        sum0 = ops::add(sum0, ops::load(first));
+      }
+
+      t_type values[lanes];
+      ops::store(values, sum0);
+      for (::portable_stl::size_t index{0U}; index < lanes; ++index) {
+        init = static_cast<t_type>(init + values[index]);
+      }
+    }
+    for (; first != last; ++first) {
+      init = static_cast<t_type>(init + *first);
+    }
+    return init;
+  }
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_SIMD_SCAN_H
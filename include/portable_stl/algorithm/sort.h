@@ -0,0 +1,555 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="sort.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SORT_H
+#define PSTL_SORT_H
+
+#include "../common/size_t.h"
+#include "../functional/less.h"
+#include "../iterator/iterator_traits.h"
+#include "../metaprogramming/composite_type/is_arithmetic.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/type_relations/is_same.h"
+#include "../utility/general/make_exception_guard.h"
+#include "../utility/general/move.h"
+#include "algo_iter_swap.h"
+#include "block_partition.h"
+#include "heap_sift.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Partitions shorter than this are sorted by insertion sort.
+   */
+  constexpr ::portable_stl::size_t sort_insertion_threshold{24U};
+  /**
+   * @brief Partitions longer than this use the pseudomedian of 9 as the pivot.
+   */
+  constexpr ::portable_stl::size_t sort_ninther_threshold{128U};
+  /**
+   * @brief The number of moves after which the partial insertion sort gives up.
+   */
+  constexpr ::portable_stl::size_t sort_partial_insertion_limit{8U};
+  /**
+   * @brief Comparison of the arithmetic values by less, the partition for such ranges is branchless.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  using sort_is_branchless = ::portable_stl::bool_constant<
+    ::portable_stl::is_arithmetic<typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type>{}()
+    && (::portable_stl::is_same<t_compare, ::portable_stl::less<>>{}()
+        || ::portable_stl::is_same<
+          t_compare,
+          ::portable_stl::less<typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type>>{}())>;
+
+  /**
+   * @brief Floor of the binary logarithm of len.
+   *
+   * @tparam t_difference the type of the length.
+   * @param len the length of the range.
+   * @return floor(log2(len)), 0 for len <= 1.
+   */
+  template<class t_difference> t_difference sort_log2(t_difference len) noexcept {
+    t_difference result{0};
+    while (len > 1) {
+      len /= 2;
+      ++result;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Sorts the range [first, last) by insertion sort. The sort is stable. If the comparison throws, the range
+   * keeps all its elements in an unspecified order.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void insertion_sort(t_random_access_iterator first, t_random_access_iterator last, t_compare &comp) {
+    using value_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+
+    if (first == last) {
+      return;
+    }
+    for (t_random_access_iterator cur{first + 1}; cur != last; ++cur) {
+      t_random_access_iterator sift{cur};
+      t_random_access_iterator sift_prev{cur - 1};
+      if (comp(*sift, *sift_prev)) {
+        value_type tmp(::portable_stl::move(*sift));
+        // the inserted element fills the hole if the comparison throws, so the range keeps all its elements
+        auto       guard = ::portable_stl::make_exception_guard([&sift, &tmp]() { *sift = ::portable_stl::move(tmp); });
+        do {
+          *sift = ::portable_stl::move(*sift_prev);
+          --sift;
+        } while ((sift != first) && comp(tmp, *--sift_prev));
+        *sift = ::portable_stl::move(tmp);
+        guard.commit();
+      }
+    }
+  }
+
+  /**
+   * @brief Sorts the range [first, last) by insertion sort without the bound check.
+   * The element before first must not be greater than any element of the range.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void unguarded_insertion_sort(t_random_access_iterator first, t_random_access_iterator last, t_compare &comp) {
+    using value_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+
+    if (first == last) {
+      return;
+    }
+    for (t_random_access_iterator cur{first + 1}; cur != last; ++cur) {
+      t_random_access_iterator sift{cur};
+      t_random_access_iterator sift_prev{cur - 1};
+      if (comp(*sift, *sift_prev)) {
+        value_type tmp(::portable_stl::move(*sift));
+        do {
+          *sift = ::portable_stl::move(*sift_prev);
+          --sift;
+        } while (comp(tmp, *--sift_prev));
+        *sift = ::portable_stl::move(tmp);
+      }
+    }
+  }
+
+  /**
+   * @brief Insertion sort which gives up after a few moves.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   * @return true if the range is sorted, false if the sort has been abandoned.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  bool partial_insertion_sort(t_random_access_iterator first, t_random_access_iterator last, t_compare &comp) {
+    using value_type      = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    if (first == last) {
+      return true;
+    }
+    difference_type moves{0};
+    for (t_random_access_iterator cur{first + 1}; cur != last; ++cur) {
+      t_random_access_iterator sift{cur};
+      t_random_access_iterator sift_prev{cur - 1};
+      if (comp(*sift, *sift_prev)) {
+        value_type tmp(::portable_stl::move(*sift));
+        do {
+          *sift = ::portable_stl::move(*sift_prev);
+          --sift;
+        } while ((sift != first) && comp(tmp, *--sift_prev));
+        *sift  = ::portable_stl::move(tmp);
+        moves += cur - sift;
+      }
+      if (moves > static_cast<difference_type>(sort_partial_insertion_limit)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Sorts two elements.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param iter1 the first element.
+   * @param iter2 the second element.
+   * @param comp the comparison function object.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void sort2(t_random_access_iterator iter1, t_random_access_iterator iter2, t_compare &comp) {
+    if (comp(*iter2, *iter1)) {
+      ::portable_stl::algo_iter_swap(iter1, iter2);
+    }
+  }
+
+  /**
+   * @brief Sorts three elements.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param iter1 the first element.
+   * @param iter2 the second element.
+   * @param iter3 the third element.
+   * @param comp the comparison function object.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void sort3(t_random_access_iterator iter1,
+             t_random_access_iterator iter2,
+             t_random_access_iterator iter3,
+             t_compare               &comp) {
+    ::portable_stl::algorithm_helper::sort2(iter1, iter2, comp);
+    ::portable_stl::algorithm_helper::sort2(iter2, iter3, comp);
+    ::portable_stl::algorithm_helper::sort2(iter1, iter2, comp);
+  }
+
+  /**
+   * @brief Moves the median of 3, or the pseudomedian of 9 for the long ranges, to the beginning of the range.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void sort_choose_pivot(t_random_access_iterator first, t_random_access_iterator last, t_compare &comp) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    difference_type const len{last - first};
+    difference_type const half{len / 2};
+    if (len > static_cast<difference_type>(sort_ninther_threshold)) {
+      ::portable_stl::algorithm_helper::sort3(first, first + half, last - 1, comp);
+      ::portable_stl::algorithm_helper::sort3(first + 1, first + (half - 1), last - 2, comp);
+      ::portable_stl::algorithm_helper::sort3(first + 2, first + (half + 1), last - 3, comp);
+      ::portable_stl::algorithm_helper::sort3(first + (half - 1), first + half, first + (half + 1), comp);
+      ::portable_stl::algo_iter_swap(first, first + half);
+    } else {
+      ::portable_stl::algorithm_helper::sort3(first + half, first, last - 1, comp);
+    }
+  }
+
+  /**
+   * @brief Partitions [first, last) around the pivot *first, the elements equal to the pivot go to the right part.
+   * The range must contain an element not less than the pivot after the first one, or the element at last must not be
+   * less than the pivot.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   * @param already_partitioned set to true if no element has been swapped.
+   * @return the final position of the pivot.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  t_random_access_iterator partition_right(t_random_access_iterator first,
+                                           t_random_access_iterator last,
+                                           t_compare               &comp,
+                                           bool                    &already_partitioned,
+                                           ::portable_stl::false_type) {
+    using value_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+
+    value_type               pivot(::portable_stl::move(*first));
+    t_random_access_iterator left{first};
+    t_random_access_iterator right{last};
+
+    while (comp(*++left, pivot)) {
+    }
+    if (left - 1 == first) {
+      while ((left < right) && !comp(*--right, pivot)) {
+      }
+    } else {
+      while (!comp(*--right, pivot)) {
+      }
+    }
+
+    already_partitioned = (left >= right);
+    while (left < right) {
+      ::portable_stl::algo_iter_swap(left, right);
+      while (comp(*++left, pivot)) {
+      }
+      while (!comp(*--right, pivot)) {
+      }
+    }
+
+    t_random_access_iterator pivot_pos{left - 1};
+    *first     = ::portable_stl::move(*pivot_pos);
+    *pivot_pos = ::portable_stl::move(pivot);
+    return pivot_pos;
+  }
+
+  /**
+   * @brief Predicate of the elements less than the pivot.
+   * @tparam t_compare the type of compare function.
+   * @tparam t_value the type of pivot.
+   */
+  template<class t_compare, class t_value> class sort_less_than_pivot final {
+    /**
+     * @brief The comparison function object.
+     */
+    t_compare     &m_comp;
+    /**
+     * @brief The pivot.
+     */
+    t_value const &m_pivot;
+
+  public:
+    /**
+     * @brief Constructor.
+     * @param comp the comparison function object.
+     * @param pivot the pivot.
+     */
+    sort_less_than_pivot(t_compare &comp, t_value const &pivot) noexcept : m_comp(comp), m_pivot(pivot) {
+    }
+
+    /**
+     * @brief Compares the value with the pivot.
+     * @param value the value.
+     * @return true if the value is less than the pivot.
+     */
+    bool operator()(t_value const &value) const {
+      return m_comp(value, m_pivot);
+    }
+  };
+
+  /**
+   * @brief Partitions [first, last) around the pivot *first like partition_right, but without the data dependent
+   * branches: the offsets of the misplaced elements are collected into small blocks from both ends and the elements
+   * are exchanged block by block (BlockQuicksort scheme).
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   * @param already_partitioned set to true if no element has been swapped.
+   * @return the final position of the pivot.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  t_random_access_iterator partition_right(t_random_access_iterator first,
+                                           t_random_access_iterator last,
+                                           t_compare               &comp,
+                                           bool                    &already_partitioned,
+                                           ::portable_stl::true_type) {
+    using value_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+
+    value_type               pivot(::portable_stl::move(*first));
+    t_random_access_iterator left{first};
+    t_random_access_iterator right{last};
+
+    while (comp(*++left, pivot)) {
+    }
+    if (left - 1 == first) {
+      while ((left < right) && !comp(*--right, pivot)) {
+      }
+    } else {
+      while (!comp(*--right, pivot)) {
+      }
+    }
+
+    already_partitioned = (left >= right);
+    if (!already_partitioned) {
+      ::portable_stl::algo_iter_swap(left, right);
+      ++left;
+
+      ::portable_stl::algorithm_helper::sort_less_than_pivot<t_compare, value_type> less_than_pivot(comp, pivot);
+      left = ::portable_stl::algorithm_helper::block_partition(left, right, less_than_pivot);
+    }
+
+    t_random_access_iterator pivot_pos{left - 1};
+    *first     = ::portable_stl::move(*pivot_pos);
+    *pivot_pos = ::portable_stl::move(pivot);
+    return pivot_pos;
+  }
+
+  /**
+   * @brief Partitions [first, last) around the pivot *first, the elements equal to the pivot go to the left part.
+   * Used when the element before first is equal to the pivot, so the left part consists of the equal elements only.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   * @return the final position of the pivot.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  t_random_access_iterator partition_left(t_random_access_iterator first,
+                                          t_random_access_iterator last,
+                                          t_compare               &comp) {
+    using value_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+
+    value_type               pivot(::portable_stl::move(*first));
+    t_random_access_iterator left{first};
+    t_random_access_iterator right{last};
+
+    while (comp(pivot, *--right)) {
+    }
+    if (right + 1 == last) {
+      while ((left < right) && !comp(pivot, *++left)) {
+      }
+    } else {
+      while (!comp(pivot, *++left)) {
+      }
+    }
+
+    while (left < right) {
+      ::portable_stl::algo_iter_swap(left, right);
+      while (comp(pivot, *--right)) {
+      }
+      while (!comp(pivot, *++left)) {
+      }
+    }
+
+    *first = ::portable_stl::move(*right);
+    *right = ::portable_stl::move(pivot);
+    return right;
+  }
+
+  /**
+   * @brief Breaks the patterns of a highly unbalanced partition by swapping a few elements.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @param first the beginning of the partition.
+   * @param last the end of the partition.
+   */
+  template<class t_random_access_iterator>
+  void sort_break_patterns(t_random_access_iterator first, t_random_access_iterator last) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    difference_type const len{last - first};
+    if (len >= static_cast<difference_type>(sort_insertion_threshold)) {
+      difference_type const quarter{len / 4};
+      ::portable_stl::algo_iter_swap(first, first + quarter);
+      ::portable_stl::algo_iter_swap(last - 1, last - quarter);
+      if (len > static_cast<difference_type>(sort_ninther_threshold)) {
+        ::portable_stl::algo_iter_swap(first + 1, first + (quarter + 1));
+        ::portable_stl::algo_iter_swap(first + 2, first + (quarter + 2));
+        ::portable_stl::algo_iter_swap(last - 2, last - (quarter + 1));
+        ::portable_stl::algo_iter_swap(last - 3, last - (quarter + 2));
+      }
+    }
+  }
+
+  /**
+   * @brief Pattern-defeating quicksort loop. The smaller part is not guaranteed to be the recursive one, but every
+   * highly unbalanced partition consumes one of the bad_allowed attempts, after which the range is heap sorted, so the
+   * recursion depth and the complexity stay logarithmic and O(n log(n)).
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @tparam t_branchless the type of the partition selector.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   * @param bad_allowed the number of the unbalanced partitions before the switch to heapsort.
+   * @param leftmost the range is the leftmost part of the whole range.
+   */
+  template<class t_random_access_iterator, class t_compare, class t_branchless>
+  void pdqsort_loop(t_random_access_iterator                                                          first,
+                    t_random_access_iterator                                                          last,
+                    t_compare                                                                        &comp,
+                    typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type bad_allowed,
+                    bool                                                                              leftmost,
+                    t_branchless                                                                      branchless) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    for (;;) {
+      difference_type const len{last - first};
+      if (len < static_cast<difference_type>(sort_insertion_threshold)) {
+        if (leftmost) {
+          ::portable_stl::algorithm_helper::insertion_sort(first, last, comp);
+        } else {
+          ::portable_stl::algorithm_helper::unguarded_insertion_sort(first, last, comp);
+        }
+        return;
+      }
+
+      ::portable_stl::algorithm_helper::sort_choose_pivot(first, last, comp);
+
+      // no element of the range is less than the element before it, if the pivot is equal to that element, all the
+      // elements equal to the pivot are put to the left part which needs no further sorting
+      if ((!leftmost) && (!comp(*(first - 1), *first))) {
+        first = ::portable_stl::algorithm_helper::partition_left(first, last, comp) + 1;
+        continue;
+      }
+
+      bool                           already_partitioned{false};
+      t_random_access_iterator const pivot_pos{
+        ::portable_stl::algorithm_helper::partition_right(first, last, comp, already_partitioned, branchless)};
+
+      difference_type const left_len{pivot_pos - first};
+      difference_type const right_len{last - (pivot_pos + 1)};
+      if ((left_len < len / 8) || (right_len < len / 8)) {
+        if (0 == --bad_allowed) {
+          ::portable_stl::algorithm_helper::make_heap_impl<2U>(first, comp, len);
+          for (difference_type heap_len{len}; heap_len > 1; --heap_len) {
+            ::portable_stl::algorithm_helper::pop_heap_impl<2U>(first, comp, heap_len);
+          }
+          return;
+        }
+        ::portable_stl::algorithm_helper::sort_break_patterns(first, pivot_pos);
+        ::portable_stl::algorithm_helper::sort_break_patterns(pivot_pos + 1, last);
+      } else if (already_partitioned
+                 && ::portable_stl::algorithm_helper::partial_insertion_sort(first, pivot_pos, comp)
+                 && ::portable_stl::algorithm_helper::partial_insertion_sort(pivot_pos + 1, last, comp)) {
+        // the balanced partition of the already partitioned range, the parts were nearly sorted
+        return;
+      }
+
+      ::portable_stl::algorithm_helper::pdqsort_loop(first, pivot_pos, comp, bad_allowed, leftmost, branchless);
+      first    = pivot_pos + 1;
+      leftmost = false;
+    }
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Sorts the elements in the range [first, last) in non-descending order. The order of equal elements is not
+ * guaranteed to be preserved.
+ * Pattern-defeating quicksort: insertion sort for small partitions, the partition without the data dependent branches
+ * for arithmetic values compared by less and heapsort after too many unbalanced partitions, so the complexity is
+ * O(n log(n)) in the worst case and O(n) for the sorted, reversed and equal ranges.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ */
+template<class t_random_access_iterator, class t_compare>
+void sort(t_random_access_iterator first, t_random_access_iterator last, t_compare comp) {
+  using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+  difference_type const len{last - first};
+  if (len < 2) {
+    return;
+  }
+  ::portable_stl::algorithm_helper::pdqsort_loop(
+    first,
+    last,
+    comp,
+    ::portable_stl::algorithm_helper::sort_log2(len),
+    true,
+    ::portable_stl::algorithm_helper::sort_is_branchless<t_random_access_iterator, t_compare>{});
+}
+
+/**
+ * @brief Sorts the elements in the range [first, last) in non-descending order. The order of equal elements is not
+ * guaranteed to be preserved.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ */
+template<class t_random_access_iterator>
+inline void sort(t_random_access_iterator first, t_random_access_iterator last) {
+  ::portable_stl::sort(first, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_SORT_H
@@ -0,0 +1,53 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="sort_heap.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SORT_HEAP_H
+#define PSTL_SORT_HEAP_H
+
+#include "../functional/less.h"
+#include "heap_sift.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Converts the max heap [first, last) into a sorted range. The resulting range no longer has the heap
+ * property.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the range of elements.
+ * @param last the range of elements.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ */
+template<class t_random_access_iterator, class t_compare>
+void sort_heap(t_random_access_iterator first, t_random_access_iterator last, t_compare comp) {
+  using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+  for (difference_type len{last - first}; len > 1; --len) {
+    ::portable_stl::algorithm_helper::pop_heap_impl<2U>(first, comp, len);
+  }
+}
+
+/**
+ * @brief Converts the max heap [first, last) into a sorted range. The resulting range no longer has the heap
+ * property.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the range of elements.
+ * @param last the range of elements.
+ */
+template<class t_random_access_iterator>
+inline void sort_heap(t_random_access_iterator first, t_random_access_iterator last) {
+  ::portable_stl::sort_heap(first, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_SORT_HEAP_H
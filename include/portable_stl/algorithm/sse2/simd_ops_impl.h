@@ -0,0 +1,647 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="simd_ops_impl.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SIMD_OPS_IMPL_H
+#define PSTL_SIMD_OPS_IMPL_H
+#include <emmintrin.h>
+
+#include "../../common/size_t.h"
+#include "../../common/uint32_t.h"
+#include "../../metaprogramming/helper/integral_constant.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief SSE2 operations common for the integers.
+   */
+  class simd_integer_ops_base {
+  public:
+    /**
+     * @brief Vector type.
+     */
+    using vector_type  = __m128i;
+    /**
+     * @brief The operations are available.
+     */
+    using is_supported = ::portable_stl::true_type;
+
+    /**
+     * @brief Loads the vector from the unaligned address.
+     * @param ptr the address.
+     * @return the vector.
+     */
+    static vector_type load(void const *ptr) noexcept {
+      return _mm_loadu_si128(static_cast<__m128i const *>(ptr));
+    }
+
+    /**
+     * @brief Stores the vector to the unaligned address.
+     * @param ptr the address.
+     * @param value the vector.
+     */
+    static void store(void *ptr, vector_type value) noexcept {
+      _mm_storeu_si128(static_cast<__m128i *>(ptr), value);
+    }
+
+    /**
+     * @brief Selects the lanes of the vectors.
+     * @param mask the mask, all ones in the lanes to take from if_true.
+     * @param if_true the vector for the set lanes.
+     * @param if_false the vector for the clear lanes.
+     * @return the vector.
+     */
+    static vector_type select(vector_type mask, vector_type if_true, vector_type if_false) noexcept {
+      return _mm_or_si128(_mm_and_si128(mask, if_true), _mm_andnot_si128(mask, if_false));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the vector which have the highest bit set.
+     * @param value the vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t byte_mask(vector_type value) noexcept {
+      return static_cast<::portable_stl::uint32_t>(_mm_movemask_epi8(value));
+    }
+  };
+
+  /**
+   * @brief SSE2 operations on the integers of the given size and signedness.
+   * The primary template has no operations.
+   * @tparam t_size the size of the integer in bytes.
+   * @tparam t_signed the integer is signed.
+   */
+  template<::portable_stl::size_t t_size, bool t_signed> class simd_integer_ops final {
+  public:
+    /**
+     * @brief The operations are not available.
+     */
+    using is_supported = ::portable_stl::false_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is not available.
+     */
+    using has_add      = ::portable_stl::false_type;
+  };
+
+  /**
+   * @brief SSE2 operations on the unsigned 8-bit integers.
+   */
+  template<> class simd_integer_ops<1U, false> final : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm_set1_epi8(static_cast<char>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm_cmpeq_epi8(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return _mm_min_epu8(left, right);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return _mm_max_epu8(left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm_add_epi8(left, right);
+    }
+  };
+
+  /**
+   * @brief SSE2 operations on the signed 8-bit integers.
+   * SSE2 has only the unsigned 8-bit min and max, the signed lanes are biased to the unsigned order.
+   */
+  template<> class simd_integer_ops<1U, true> final : public simd_integer_ops_base {
+    /**
+     * @brief Flips the sign bits.
+     * @param value the vector.
+     * @return the biased vector.
+     */
+    static vector_type M_bias(vector_type value) noexcept {
+      return _mm_xor_si128(value, _mm_set1_epi8(static_cast<char>(0x80)));
+    }
+
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm_set1_epi8(static_cast<char>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm_cmpeq_epi8(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return M_bias(_mm_min_epu8(M_bias(left), M_bias(right)));
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return M_bias(_mm_max_epu8(M_bias(left), M_bias(right)));
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm_add_epi8(left, right);
+    }
+  };
+
+  /**
+   * @brief SSE2 operations on the signed 16-bit integers.
+   */
+  template<> class simd_integer_ops<2U, true> final : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm_set1_epi16(static_cast<short>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm_cmpeq_epi16(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return _mm_min_epi16(left, right);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return _mm_max_epi16(left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm_add_epi16(left, right);
+    }
+  };
+
+  /**
+   * @brief SSE2 operations on the unsigned 16-bit integers.
+   * SSE2 has only the signed 16-bit min and max, the unsigned lanes are biased to the signed order.
+   */
+  template<> class simd_integer_ops<2U, false> final : public simd_integer_ops_base {
+    /**
+     * @brief Flips the sign bits.
+     * @param value the vector.
+     * @return the biased vector.
+     */
+    static vector_type M_bias(vector_type value) noexcept {
+      return _mm_xor_si128(value, _mm_set1_epi16(static_cast<short>(0x8000)));
+    }
+
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm_set1_epi16(static_cast<short>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm_cmpeq_epi16(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return M_bias(_mm_min_epi16(M_bias(left), M_bias(right)));
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return M_bias(_mm_max_epi16(M_bias(left), M_bias(right)));
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm_add_epi16(left, right);
+    }
+  };
+
+  /**
+   * @brief SSE2 operations on the 32-bit integers.
+   * SSE2 has no 32-bit min and max, they select the lanes by the signed comparison, the unsigned lanes are biased to
+   * the signed order for the comparison.
+   * @tparam t_signed the integer is signed.
+   */
+  template<bool t_signed> class simd_integer32_ops : public simd_integer_ops_base {
+    /**
+     * @brief Compares the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return all ones in the lanes where left is greater than right.
+     */
+    static vector_type M_greater(vector_type left, vector_type right) noexcept {
+      if (t_signed) {
+        return _mm_cmpgt_epi32(left, right);
+      }
+      vector_type const bias{_mm_set1_epi32(static_cast<int>(0x80000000U))};
+      return _mm_cmpgt_epi32(_mm_xor_si128(left, bias), _mm_xor_si128(right, bias));
+    }
+
+  public:
+    /**
+     * @brief min and max are available.
+     */
+    using has_min_max = ::portable_stl::true_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add     = ::portable_stl::true_type;
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    template<class t_type> static vector_type broadcast(t_type value) noexcept {
+      return _mm_set1_epi32(static_cast<int>(value));
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return byte_mask(_mm_cmpeq_epi32(left, right));
+    }
+
+    /**
+     * @brief Computes the minimum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the minimums.
+     */
+    static vector_type min(vector_type left, vector_type right) noexcept {
+      return select(M_greater(left, right), right, left);
+    }
+
+    /**
+     * @brief Computes the maximum of the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the maximums.
+     */
+    static vector_type max(vector_type left, vector_type right) noexcept {
+      return select(M_greater(left, right), left, right);
+    }
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm_add_epi32(left, right);
+    }
+  };
+
+  /**
+   * @brief SSE2 operations on the signed 32-bit integers.
+   */
+  template<> class simd_integer_ops<4U, true> final : public simd_integer32_ops<true> {};
+
+  /**
+   * @brief SSE2 operations on the unsigned 32-bit integers.
+   */
+  template<> class simd_integer_ops<4U, false> final : public simd_integer32_ops<false> {};
+
+  /**
+   * @brief SSE2 operations on the 64-bit integers, only the addition: SSE2 has no 64-bit comparison and the comparison
+   * emulated by the 32-bit lanes is slower than the scalar loop, so the search and min and max stay scalar.
+   */
+  class simd_integer64_ops : public simd_integer_ops_base {
+  public:
+    /**
+     * @brief The search operations are not available.
+     */
+    using is_supported = ::portable_stl::false_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add      = ::portable_stl::true_type;
+
+    /**
+     * @brief Adds the lanes, the sums wrap around.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm_add_epi64(left, right);
+    }
+  };
+
+  /**
+   * @brief SSE2 operations on the signed 64-bit integers.
+   */
+  template<> class simd_integer_ops<8U, true> final : public simd_integer64_ops {};
+
+  /**
+   * @brief SSE2 operations on the unsigned 64-bit integers.
+   */
+  template<> class simd_integer_ops<8U, false> final : public simd_integer64_ops {};
+
+  /**
+   * @brief SSE2 operations on float, the comparison follows operator== (NaN is not equal to itself, -0 is equal to
+   * +0), without min and max which would not keep the order of NaN.
+   */
+  class simd_float_ops final {
+  public:
+    /**
+     * @brief Vector type.
+     */
+    using vector_type  = __m128;
+    /**
+     * @brief The operations are available.
+     */
+    using is_supported = ::portable_stl::true_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add      = ::portable_stl::true_type;
+
+    /**
+     * @brief Loads the vector from the unaligned address.
+     * @param ptr the address.
+     * @return the vector.
+     */
+    static vector_type load(void const *ptr) noexcept {
+      return _mm_loadu_ps(static_cast<float const *>(ptr));
+    }
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    static vector_type broadcast(float value) noexcept {
+      return _mm_set1_ps(value);
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return static_cast<::portable_stl::uint32_t>(_mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(left, right))));
+    }
+
+    /**
+     * @brief Stores the vector to the unaligned address.
+     * @param ptr the address.
+     * @param value the vector.
+     */
+    static void store(void *ptr, vector_type value) noexcept {
+      _mm_storeu_ps(static_cast<float *>(ptr), value);
+    }
+
+    /**
+     * @brief Adds the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm_add_ps(left, right);
+    }
+  };
+
+  /**
+   * @brief SSE2 operations on double, the comparison follows operator==, without min and max.
+   */
+  class simd_double_ops final {
+  public:
+    /**
+     * @brief Vector type.
+     */
+    using vector_type  = __m128d;
+    /**
+     * @brief The operations are available.
+     */
+    using is_supported = ::portable_stl::true_type;
+    /**
+     * @brief min and max are not available.
+     */
+    using has_min_max  = ::portable_stl::false_type;
+    /**
+     * @brief Lane-wise addition is available.
+     */
+    using has_add      = ::portable_stl::true_type;
+
+    /**
+     * @brief Loads the vector from the unaligned address.
+     * @param ptr the address.
+     * @return the vector.
+     */
+    static vector_type load(void const *ptr) noexcept {
+      return _mm_loadu_pd(static_cast<double const *>(ptr));
+    }
+
+    /**
+     * @brief Broadcasts the value to all lanes.
+     * @param value the value.
+     * @return the vector.
+     */
+    static vector_type broadcast(double value) noexcept {
+      return _mm_set1_pd(value);
+    }
+
+    /**
+     * @brief Returns the bitmask of the bytes of the equal lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the bitmask, one bit per byte.
+     */
+    static ::portable_stl::uint32_t equal_mask(vector_type left, vector_type right) noexcept {
+      return static_cast<::portable_stl::uint32_t>(_mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(left, right))));
+    }
+
+    /**
+     * @brief Stores the vector to the unaligned address.
+     * @param ptr the address.
+     * @param value the vector.
+     */
+    static void store(void *ptr, vector_type value) noexcept {
+      _mm_storeu_pd(static_cast<double *>(ptr), value);
+    }
+
+    /**
+     * @brief Adds the lanes.
+     * @param left the first vector.
+     * @param right the second vector.
+     * @return the vector of the sums.
+     */
+    static vector_type add(vector_type left, vector_type right) noexcept {
+      return _mm_add_pd(left, right);
+    }
+  };
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_SIMD_OPS_IMPL_H
@@ -0,0 +1,246 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="stable_partition.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_STABLE_PARTITION_H
+#define PSTL_STABLE_PARTITION_H
+
+#include "../common/size_t.h"
+#include "../iterator/advance.h"
+#include "../iterator/distance.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../memory/construct_at.h"
+#include "../memory/destroy_at.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/type_properties/is_trivially_copyable.h"
+#include "../metaprogramming/type_relations/is_base_of.h"
+#include "../utility/general/make_exception_guard.h"
+#include "../utility/general/move.h"
+#include "find_if_not.h"
+#include "rotate.h"
+#include "temporary_buffer.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Random access range of trivially copyable elements, the buffer partition for such ranges is branchless.
+   * @tparam t_iterator the type of iterator.
+   */
+  template<class t_iterator>
+  using stable_partition_is_branchless = ::portable_stl::bool_constant<
+    ::portable_stl::is_trivially_copyable<typename ::portable_stl::iterator_traits<t_iterator>::value_type>{}()
+    && ::portable_stl::is_base_of<::portable_stl::random_access_iterator_tag,
+                                  typename ::portable_stl::iterator_traits<t_iterator>::iterator_category>{}()>;
+
+  /**
+   * @brief Stable partition of [first, first + len) with the buffer: the elements of the second group are moved to
+   * the buffer, the elements of the first group are moved to the front and the buffer is moved after them.
+   * UB: *first does not satisfy the predicate.
+   *
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @param buffer the uninitialized memory for the elements of the range.
+   * @return the beginning of the second group.
+   */
+  template<class t_forward_iterator, class t_predicate>
+  t_forward_iterator stable_partition_with_buffer(
+    t_forward_iterator                                                        first,
+    t_forward_iterator                                                        last,
+    t_predicate                                                              &pred,
+    typename ::portable_stl::iterator_traits<t_forward_iterator>::value_type *buffer,
+    ::portable_stl::false_type) {
+    using value_type = typename ::portable_stl::iterator_traits<t_forward_iterator>::value_type;
+
+    // the elements moved to the buffer leave as many holes after the first group, on an exception the buffered
+    // elements fill the holes, so the range keeps all its elements
+    t_forward_iterator output{first};
+    value_type        *buffered{buffer};
+    value_type        *buffer_end{buffer};
+    auto const         move_back = [&output, &buffered, &buffer_end]() {
+      for (; buffered != buffer_end; ++buffered, ++output) {
+        *output = ::portable_stl::move(*buffered);
+      }
+    };
+    auto const destroy = [buffer, &buffer_end]() {
+      for (value_type *iter{buffer}; iter != buffer_end; ++iter) {
+        ::portable_stl::destroy_at(iter);
+      }
+    };
+    auto guard = ::portable_stl::make_exception_guard([&move_back, &destroy]() {
+      move_back();
+      destroy();
+    });
+
+    ::portable_stl::construct_at(buffer_end, ::portable_stl::move(*first));
+    ++buffer_end;
+    for (++first; first != last; ++first) {
+      if (pred(*first)) {
+        *output = ::portable_stl::move(*first);
+        ++output;
+      } else {
+        ::portable_stl::construct_at(buffer_end, ::portable_stl::move(*first));
+        ++buffer_end;
+      }
+    }
+
+    t_forward_iterator const result{output};
+    move_back();
+    guard.commit();
+    destroy();
+    return result;
+  }
+
+  /**
+   * @brief Stable partition of the random access range of trivially copyable elements with the buffer, without the
+   * data dependent branches: every element is copied both to the front and to the buffer and only the matching
+   * destination advances.
+   * UB: *first does not satisfy the predicate.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @param buffer the uninitialized memory for the elements of the range.
+   * @return the beginning of the second group.
+   */
+  template<class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator stable_partition_with_buffer(
+    t_random_access_iterator                                                        first,
+    t_random_access_iterator                                                        last,
+    t_predicate                                                                    &pred,
+    typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type *buffer,
+    ::portable_stl::true_type) {
+    using value_type      = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    t_random_access_iterator result{first};
+    value_type              *buffer_end{buffer};
+    // the copies to the buffer fill the holes after the first group, also when the predicate throws
+    auto const               copy_back = [&result, buffer, &buffer_end]() {
+      t_random_access_iterator output{result};
+      for (value_type *iter{buffer}; iter != buffer_end; ++iter, ++output) {
+        *output = *iter;
+      }
+    };
+    auto guard = ::portable_stl::make_exception_guard([&copy_back]() { copy_back(); });
+
+    // the first element does not satisfy the predicate, so the front never reaches the current element
+    for (; first != last; ++first) {
+      bool const first_group{static_cast<bool>(pred(*first))};
+      ::portable_stl::construct_at(buffer_end, *first);
+      *result     = *buffer_end;
+      result     += static_cast<difference_type>(first_group);
+      buffer_end += static_cast<difference_type>(!first_group);
+    }
+
+    copy_back();
+    guard.commit();
+    return result;
+  }
+
+  /**
+   * @brief Stable partition of [first, first + len): the ranges which fit into the buffer are partitioned with the
+   * buffer, the longer ones are split in halves, partitioned recursively and the middle groups are rotated.
+   * UB: *first does not satisfy the predicate.
+   *
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate.
+   * @param len the length of the range, at least 1.
+   * @param buffer the uninitialized memory for buffer_size elements or nullptr.
+   * @param buffer_size the size of the buffer.
+   * @return the beginning of the second group.
+   */
+  template<class t_forward_iterator, class t_predicate>
+  t_forward_iterator stable_partition_impl(
+    t_forward_iterator                                                             first,
+    t_forward_iterator                                                             last,
+    t_predicate                                                                   &pred,
+    typename ::portable_stl::iterator_traits<t_forward_iterator>::difference_type len,
+    typename ::portable_stl::iterator_traits<t_forward_iterator>::value_type      *buffer,
+    typename ::portable_stl::iterator_traits<t_forward_iterator>::difference_type buffer_size) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_forward_iterator>::difference_type;
+
+    if (1 == len) {
+      return first;
+    }
+    if (len <= buffer_size) {
+      return ::portable_stl::algorithm_helper::stable_partition_with_buffer(
+        first,
+        last,
+        pred,
+        buffer,
+        ::portable_stl::algorithm_helper::stable_partition_is_branchless<t_forward_iterator>{});
+    }
+
+    difference_type const half{len / 2};
+    t_forward_iterator    middle{first};
+    ::portable_stl::advance(middle, half);
+    t_forward_iterator const left_split{
+      ::portable_stl::algorithm_helper::stable_partition_impl(first, middle, pred, half, buffer, buffer_size)};
+
+    // the leading elements of the right half satisfying the predicate are already in place
+    difference_type    right_len{len - half};
+    t_forward_iterator right_split{middle};
+    while ((right_len > 0) && pred(*right_split)) {
+      ++right_split;
+      --right_len;
+    }
+    if (right_len > 0) {
+      right_split = ::portable_stl::algorithm_helper::stable_partition_impl(
+        right_split, last, pred, right_len, buffer, buffer_size);
+    }
+    return ::portable_stl::rotate(left_split, middle, right_split);
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Reorders the elements in the range [first, last) in such a way that all elements for which the predicate
+ * returns true precede the elements for which it returns false. Relative order of the elements is preserved.
+ * The function tries to allocate a temporary buffer for the range and halves the requested size while the allocation
+ * fails. The ranges which fit into the buffer are partitioned in O(n), the longer ones are split in halves and the
+ * halves are joined by rotations, O(n log(n)) without the buffer. Random access ranges of trivially copyable elements
+ * are partitioned with the buffer without the data dependent branches. If the predicate throws, the range keeps all its
+ * elements in an unspecified order and the buffer is released.
+ *
+ * @tparam t_bidirectional_iterator the type of iterator.
+ * @tparam t_predicate the type of predicate.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param pred the unary predicate which returns true if the element should be ordered before other elements.
+ * @return the iterator to the first element of the second group.
+ */
+template<class t_bidirectional_iterator, class t_predicate>
+t_bidirectional_iterator stable_partition(t_bidirectional_iterator first,
+                                          t_bidirectional_iterator last,
+                                          t_predicate              pred) {
+  using value_type      = typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::value_type;
+  using difference_type = typename ::portable_stl::iterator_traits<t_bidirectional_iterator>::difference_type;
+
+  first = ::portable_stl::find_if_not(first, last, pred);
+  if (first == last) {
+    return first;
+  }
+
+  difference_type const                                      len{::portable_stl::distance(first, last)};
+  ::portable_stl::algorithm_helper::temporary_buffer<value_type> buffer(static_cast<::portable_stl::size_t>(len), 1U);
+  return ::portable_stl::algorithm_helper::stable_partition_impl(
+    first, last, pred, len, buffer.data(), static_cast<difference_type>(buffer.size()));
+}
+} // namespace portable_stl
+
+#endif // PSTL_STABLE_PARTITION_H
@@ -0,0 +1,133 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="stable_sort.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_STABLE_SORT_H
+#define PSTL_STABLE_SORT_H
+
+#include "../common/size_t.h"
+#include "../functional/less.h"
+#include "../iterator/iterator_traits.h"
+#include "gallop.h"
+#include "inplace_merge.h"
+#include "sort.h"
+#include "temporary_buffer.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Runs not longer than this are sorted by insertion sort.
+   */
+  constexpr ::portable_stl::size_t stable_sort_insertion_threshold{32U};
+
+  /**
+   * @brief Merges the sorted adjacent ranges [first, middle) and [middle, last) with the buffer if it is given, by
+   * rotations otherwise. The ranges already in order and the already placed prefix and suffix are skipped.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the first range.
+   * @param middle the end of the first range and the beginning of the second one.
+   * @param last the end of the second range.
+   * @param comp the comparison function object.
+   * @param buffer the uninitialized memory for (last - first) / 2 elements or nullptr.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void stable_sort_merge(t_random_access_iterator                                                        first,
+                         t_random_access_iterator                                                        middle,
+                         t_random_access_iterator                                                        last,
+                         t_compare                                                                      &comp,
+                         typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type *buffer) {
+    if (!comp(*middle, *(middle - 1))) {
+      return;
+    }
+    first = ::portable_stl::algorithm_helper::upper_bound_impl(first, middle, *middle, comp);
+    last  = ::portable_stl::algorithm_helper::lower_bound_impl(middle, last, *(middle - 1), comp);
+    if (nullptr == buffer) {
+      ::portable_stl::algorithm_helper::merge_without_buffer(first, middle, last, middle - first, last - middle, comp);
+    } else {
+      ::portable_stl::algorithm_helper::merge_with_buffer(
+        first, middle, last, middle - first, last - middle, comp, buffer);
+    }
+  }
+
+  /**
+   * @brief Top-down merge sort, the short runs are sorted by insertion sort.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of compare function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   * @param buffer the uninitialized memory for (last - first) / 2 elements or nullptr.
+   */
+  template<class t_random_access_iterator, class t_compare>
+  void stable_sort_impl(t_random_access_iterator                                                        first,
+                        t_random_access_iterator                                                        last,
+                        t_compare                                                                      &comp,
+                        typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type *buffer) {
+    using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+    difference_type const len{last - first};
+    if (len <= static_cast<difference_type>(stable_sort_insertion_threshold)) {
+      ::portable_stl::algorithm_helper::insertion_sort(first, last, comp);
+      return;
+    }
+    t_random_access_iterator const middle{first + len / 2};
+    ::portable_stl::algorithm_helper::stable_sort_impl(first, middle, comp, buffer);
+    ::portable_stl::algorithm_helper::stable_sort_impl(middle, last, comp, buffer);
+    ::portable_stl::algorithm_helper::stable_sort_merge(first, middle, last, comp, buffer);
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Sorts the elements in the range [first, last) in non-descending order. The order of equal elements is
+ * preserved.
+ * Adaptive merge sort: the runs already in order are not merged, so the sorted ranges take O(n). The merges use a
+ * temporary buffer for half of the range and take O(n log(n)) in total. If the buffer can not be allocated, the runs
+ * are merged in place by rotations in O(n log(n)^2). If the comparison throws, the range keeps all its elements in
+ * an unspecified order and the buffer is released.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of compare function.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param comp the comparison function object which returns true if the first argument is less than the second.
+ */
+template<class t_random_access_iterator, class t_compare>
+void stable_sort(t_random_access_iterator first, t_random_access_iterator last, t_compare comp) {
+  using value_type      = typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type;
+  using difference_type = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+  difference_type const len{last - first};
+  if (len <= static_cast<difference_type>(::portable_stl::algorithm_helper::stable_sort_insertion_threshold)) {
+    ::portable_stl::algorithm_helper::insertion_sort(first, last, comp);
+    return;
+  }
+
+  ::portable_stl::algorithm_helper::temporary_buffer<value_type> buffer(static_cast<::portable_stl::size_t>(len / 2));
+  ::portable_stl::algorithm_helper::stable_sort_impl(first, last, comp, buffer.data());
+}
+
+/**
+ * @brief Sorts the elements in the range [first, last) in non-descending order. The order of equal elements is
+ * preserved.
+ *
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ */
+template<class t_random_access_iterator>
+inline void stable_sort(t_random_access_iterator first, t_random_access_iterator last) {
+  ::portable_stl::stable_sort(first, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_STABLE_SORT_H
@@ -0,0 +1,100 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="temporary_buffer.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_TEMPORARY_BUFFER_H
+#define PSTL_TEMPORARY_BUFFER_H
+
+#include "../common/size_t.h"
+#include "../memory/allocate_noexcept.h"
+#include "../memory/allocator.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief Uninitialized memory for the elements of the algorithms which can work without it, released when the
+   * algorithm returns or throws. The algorithms destroy the elements they construct in the buffer.
+   * @tparam t_type the type of the elements.
+   */
+  template<class t_type> class temporary_buffer final {
+    /**
+     * @brief The memory or nullptr.
+     */
+    t_type                *m_data;
+    /**
+     * @brief The number of elements the memory is allocated for.
+     */
+    ::portable_stl::size_t m_size;
+
+  public:
+    /**
+     * @brief Allocates the memory for size elements, the requested size is halved while the allocation fails and the
+     * size is not less than min_size.
+     * @param size the requested number of elements.
+     * @param min_size the smallest acceptable number of elements, at least 1.
+     */
+    temporary_buffer(::portable_stl::size_t size, ::portable_stl::size_t min_size) : m_data(nullptr), m_size(size) {
+      ::portable_stl::allocator<t_type> alloc;
+      while ((m_size >= min_size) && (m_size > 0U)
+             && (nullptr == (m_data = ::portable_stl::allocate_noexcept(alloc, m_size)))) {
+        m_size /= 2U;
+      }
+      if (nullptr == m_data) {
+        m_size = 0U;
+      }
+    }
+
+    /**
+     * @brief Allocates the memory for exactly size elements.
+     * @param size the number of elements.
+     */
+    explicit temporary_buffer(::portable_stl::size_t size) : temporary_buffer(size, size) {
+    }
+
+    /**
+     * @brief Releases the memory.
+     */
+    ~temporary_buffer() noexcept {
+      if (nullptr != m_data) {
+        ::portable_stl::allocator<t_type>{}.deallocate(m_data, m_size);
+      }
+    }
+
+    /**
+     * @brief Deleted copy constructor.
+     * @param source the source for operation.
+     */
+    temporary_buffer(temporary_buffer const &source)            = delete;
+    /**
+     * @brief Deleted copy assign.
+     * @param source the source for operation.
+     */
+    temporary_buffer &operator=(temporary_buffer const &source) = delete;
+
+    /**
+     * @brief Returns the memory.
+     * @return the memory or nullptr if the allocation failed.
+     */
+    t_type *data() const noexcept {
+      return m_data;
+    }
+
+    /**
+     * @brief Returns the number of elements the memory is allocated for.
+     * @return the number of elements, 0 if the allocation failed.
+     */
+    ::portable_stl::size_t size() const noexcept {
+      return m_size;
+    }
+  };
+} // namespace algorithm_helper
+} // namespace portable_stl
+
+#endif // PSTL_TEMPORARY_BUFFER_H
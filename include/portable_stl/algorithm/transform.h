@@ -0,0 +1,65 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="transform.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_TRANSFORM_H
+#define PSTL_TRANSFORM_H
+
+namespace portable_stl {
+/**
+ * @brief Applies the unary operation to the elements of the range and stores the results in the output range.
+ *
+ * @tparam t_input_iterator the type of the input iterator.
+ * @tparam t_output_iterator the type of the output iterator.
+ * @tparam t_unary_operation the type of the operation.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param result the beginning of the output range, may be equal to first.
+ * @param unary_op the operation.
+ * @return the iterator past the last stored element.
+ */
+template<class t_input_iterator, class t_output_iterator, class t_unary_operation>
+inline t_output_iterator transform(
+  t_input_iterator first, t_input_iterator last, t_output_iterator result, t_unary_operation unary_op) {
+  for (; first != last; ++first, static_cast<void>(++result)) {
+    *result = unary_op(*first);
+  }
+  return result;
+}
+
+/**
+ * @brief Applies the binary operation to the pairs of the elements of two ranges and stores the results in the output
+ * range.
+ *
+ * @tparam t_input_iterator1 the type of the first input iterator.
+ * @tparam t_input_iterator2 the type of the second input iterator.
+ * @tparam t_output_iterator the type of the output iterator.
+ * @tparam t_binary_operation the type of the operation.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range, at least as long as the first range.
+ * @param result the beginning of the output range, may be equal to first1 or first2.
+ * @param binary_op the operation.
+ * @return the iterator past the last stored element.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_output_iterator, class t_binary_operation>
+inline t_output_iterator transform(t_input_iterator1  first1,
+                                   t_input_iterator1  last1,
+                                   t_input_iterator2  first2,
+                                   t_output_iterator  result,
+                                   t_binary_operation binary_op) {
+  for (; first1 != last1; ++first1, static_cast<void>(++first2), static_cast<void>(++result)) {
+    *result = binary_op(*first1, *first2);
+  }
+  return result;
+}
+} // namespace portable_stl
+
+#endif // PSTL_TRANSFORM_H
@@ -0,0 +1,71 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="unique.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_UNIQUE_H
+#define PSTL_UNIQUE_H
+
+#include "../functional/equal_to.h"
+#include "../utility/general/move.h"
+
+namespace portable_stl {
+/**
+ * @brief Eliminates all except the first element from every consecutive group of equivalent elements from the range
+ * [first, last) and returns a past-the-end iterator for the new end of the range.
+ * The elements before the first repeated one are not moved.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_binary_predicate the type of predicate.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param pred the binary predicate which returns true if the elements should be treated as equal.
+ * @return the iterator past the end of the unique elements.
+ */
+template<class t_forward_iterator, class t_binary_predicate>
+t_forward_iterator unique(t_forward_iterator first, t_forward_iterator last, t_binary_predicate pred) {
+  if (first == last) {
+    return last;
+  }
+
+  // find the first repeated element
+  t_forward_iterator next{first};
+  while (++next != last) {
+    if (pred(*first, *next)) {
+      break;
+    }
+    first = next;
+  }
+  if (next == last) {
+    return last;
+  }
+
+  while (++next != last) {
+    if (!pred(*first, *next)) {
+      *++first = ::portable_stl::move(*next);
+    }
+  }
+  return ++first;
+}
+
+/**
+ * @brief Eliminates all except the first element from every consecutive group of equal elements from the range
+ * [first, last) and returns a past-the-end iterator for the new end of the range.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @return the iterator past the end of the unique elements.
+ */
+template<class t_forward_iterator> t_forward_iterator unique(t_forward_iterator first, t_forward_iterator last) {
+  return ::portable_stl::unique(first, last, ::portable_stl::equal_to<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_UNIQUE_H
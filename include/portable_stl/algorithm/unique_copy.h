@@ -0,0 +1,131 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="unique_copy.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_UNIQUE_COPY_H
+#define PSTL_UNIQUE_COPY_H
+
+#include "../functional/equal_to.h"
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/input_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+
+namespace portable_stl {
+namespace algorithm_helper {
+  /**
+   * @brief unique_copy for the input iterators: the last copied value is kept in a local copy.
+   *
+   * @tparam t_input_iterator the type of source iterator.
+   * @tparam t_output_iterator the type of destination iterator.
+   * @tparam t_binary_predicate the type of predicate.
+   * @param first the beginning of the source range.
+   * @param last the end of the source range.
+   * @param d_first the beginning of the destination range.
+   * @param pred the predicate.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_input_iterator, class t_output_iterator, class t_binary_predicate>
+  t_output_iterator unique_copy_dispatch(t_input_iterator    first,
+                                         t_input_iterator    last,
+                                         t_output_iterator   d_first,
+                                         t_binary_predicate &pred,
+                                         ::portable_stl::input_iterator_tag) {
+    using value_type = typename ::portable_stl::iterator_traits<t_input_iterator>::value_type;
+
+    if (first != last) {
+      value_type value(*first);
+      *d_first = value;
+      ++d_first;
+      while (++first != last) {
+        if (!pred(value, *first)) {
+          value    = *first;
+          *d_first = value;
+          ++d_first;
+        }
+      }
+    }
+    return d_first;
+  }
+
+  /**
+   * @brief unique_copy for the forward iterators: the elements are compared with the last copied source element.
+   *
+   * @tparam t_forward_iterator the type of source iterator.
+   * @tparam t_output_iterator the type of destination iterator.
+   * @tparam t_binary_predicate the type of predicate.
+   * @param first the beginning of the source range.
+   * @param last the end of the source range.
+   * @param d_first the beginning of the destination range.
+   * @param pred the predicate.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_forward_iterator, class t_output_iterator, class t_binary_predicate>
+  t_output_iterator unique_copy_dispatch(t_forward_iterator  first,
+                                         t_forward_iterator  last,
+                                         t_output_iterator   d_first,
+                                         t_binary_predicate &pred,
+                                         ::portable_stl::forward_iterator_tag) {
+    if (first != last) {
+      t_forward_iterator previous{first};
+      *d_first = *first;
+      ++d_first;
+      while (++first != last) {
+        if (!pred(*previous, *first)) {
+          *d_first = *first;
+          ++d_first;
+          previous = first;
+        }
+      }
+    }
+    return d_first;
+  }
+} // namespace algorithm_helper
+
+/**
+ * @brief Copies the elements from the range [first, last) to another range beginning at d_first in such a way that
+ * there are no consecutive equivalent elements. Only the first element of each group of equivalent elements is
+ * copied.
+ *
+ * @tparam t_input_iterator the type of source iterator.
+ * @tparam t_output_iterator the type of destination iterator.
+ * @tparam t_binary_predicate the type of predicate.
+ * @param first the beginning of the source range.
+ * @param last the end of the source range.
+ * @param d_first the beginning of the destination range.
+ * @param pred the binary predicate which returns true if the elements should be treated as equal.
+ * @return the iterator past the last copied element.
+ */
+template<class t_input_iterator, class t_output_iterator, class t_binary_predicate>
+t_output_iterator unique_copy(t_input_iterator   first,
+                              t_input_iterator   last,
+                              t_output_iterator  d_first,
+                              t_binary_predicate pred) {
+  return ::portable_stl::algorithm_helper::unique_copy_dispatch(
+    first, last, d_first, pred, typename ::portable_stl::iterator_traits<t_input_iterator>::iterator_category{});
+}
+
+/**
+ * @brief Copies the elements from the range [first, last) to another range beginning at d_first in such a way that
+ * there are no consecutive equal elements.
+ *
+ * @tparam t_input_iterator the type of source iterator.
+ * @tparam t_output_iterator the type of destination iterator.
+ * @param first the beginning of the source range.
+ * @param last the end of the source range.
+ * @param d_first the beginning of the destination range.
+ * @return the iterator past the last copied element.
+ */
+template<class t_input_iterator, class t_output_iterator>
+t_output_iterator unique_copy(t_input_iterator first, t_input_iterator last, t_output_iterator d_first) {
+  return ::portable_stl::unique_copy(first, last, d_first, ::portable_stl::equal_to<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_UNIQUE_COPY_H
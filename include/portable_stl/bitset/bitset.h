@@ -0,0 +1,470 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="bitset.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BITSET_H
+#define PSTL_BITSET_H
+
+#include "../common/size_t.h"
+#include "../language_support/out_of_range.h"
+#include "../vector/bit_algo/bit_word_ops.h"
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#  include "../language_support/exception/throw_on_true.h"
+#else
+#  include "../language_support/no_exception/throw_on_true.h"
+#endif
+
+namespace portable_stl {
+/**
+ * @brief Fixed-size sequence of t_size bits.
+ * Bits are stored in the array of words inside the object, the bitwise operations work on whole words and share the
+ * kernels with vector<bool>. The bits of the last word beyond t_size are always zero.
+ *
+ * @tparam t_size the number of bits.
+ */
+template<::portable_stl::size_t t_size> class bitset final {
+  /**
+   * @brief Storage word type.
+   */
+  using t_storage_type = ::portable_stl::size_t;
+
+  /**
+   * @brief Bits in the storage word.
+   */
+  static constexpr unsigned int m_bits_per_word = bit_algo::word_bits<t_storage_type>::value;
+
+  /**
+   * @brief Number of storage words (at least one to avoid zero-sized array).
+   */
+  static constexpr ::portable_stl::size_t m_words
+    = (t_size == 0U) ? 1U : ((t_size + m_bits_per_word - 1U) / m_bits_per_word);
+
+  /**
+   * @brief Mask of the bits of the last storage word within t_size.
+   */
+  static constexpr t_storage_type m_tail_mask
+    = (0U != (t_size % m_bits_per_word)) ? ((t_storage_type(1) << (t_size % m_bits_per_word)) - 1U)
+                                         : ((t_size == 0U) ? t_storage_type(0) : ~t_storage_type(0));
+
+  /**
+   * @brief Storage.
+   */
+  t_storage_type m_word[m_words];
+
+public:
+  /**
+   * @brief Size type.
+   */
+  using size_type = ::portable_stl::size_t;
+
+  /**
+   * @brief Proxy class representing a reference to a bit.
+   */
+  class reference final {
+    /**
+     * @brief Storage word of the bit.
+     */
+    t_storage_type *m_seg;
+    /**
+     * @brief Mask of the bit in the word.
+     */
+    t_storage_type  m_mask;
+
+    /**
+     * @brief Constructor.
+     * @param segment the storage word of the bit.
+     * @param mask the mask of the bit in the word.
+     */
+    reference(t_storage_type *segment, t_storage_type mask) noexcept : m_seg(segment), m_mask(mask) {
+    }
+
+    friend class bitset;
+
+  public:
+    /**
+     * @brief Copy constructor.
+     */
+    reference(reference const &) noexcept = default;
+
+    /**
+     * @brief Assigns a value to the referenced bit.
+     * @param value the value to assign.
+     * @return *this.
+     */
+    reference &operator=(bool value) noexcept {
+      if (value) {
+        *m_seg |= m_mask;
+      } else {
+        *m_seg &= ~m_mask;
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Assigns a value of other referenced bit to the referenced bit.
+     * @param other the other reference.
+     * @return *this.
+     */
+    reference &operator=(reference const &other) noexcept {
+      return operator=(static_cast<bool>(other));
+    }
+
+    /**
+     * @brief Returns the value of the referenced bit.
+     */
+    operator bool() const noexcept {
+      return 0U != (*m_seg & m_mask);
+    }
+
+    /**
+     * @brief Returns the inverse of the referenced bit.
+     * @return the inverse of the referenced bit.
+     */
+    bool operator~() const noexcept {
+      return 0U == (*m_seg & m_mask);
+    }
+
+    /**
+     * @brief Flips the referenced bit.
+     * @return *this.
+     */
+    reference &flip() noexcept {
+      *m_seg ^= m_mask;
+      return *this;
+    }
+  };
+
+  /**
+   * @brief Constructs a bitset with all bits set to zero.
+   */
+  bitset() noexcept : m_word{} {
+  }
+
+  /**
+   * @brief Constructs a bitset, initializing the first (rightmost, least significant) M bit positions to the
+   * corresponding bit values of value, where M is the smaller of t_size and the number of bits in unsigned long long.
+   * @param value the value used to initialize the bitset.
+   */
+  bitset(unsigned long long value) noexcept : m_word{} {
+    for (::portable_stl::size_t i{0U}; (i < m_words) && (0U != value); ++i) {
+      m_word[i] = static_cast<t_storage_type>(value);
+      value     = (sizeof(value) > sizeof(t_storage_type)) ? (value >> (m_bits_per_word - 1U) >> 1U) : 0U;
+    }
+    M_clear_tail();
+  }
+
+  // [element access]
+
+  /**
+   * @brief Compares the contents of bitsets.
+   * @param other the other bitset.
+   * @return true if all bits are equal, false otherwise.
+   */
+  bool operator==(bitset const &other) const noexcept {
+    for (::portable_stl::size_t i{0U}; i < m_words; ++i) {
+      if (m_word[i] != other.m_word[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Compares the contents of bitsets.
+   * @param other the other bitset.
+   * @return true if any bit differs, false otherwise.
+   */
+  bool operator!=(bitset const &other) const noexcept {
+    return !(*this == other);
+  }
+
+  /**
+   * @brief Returns the value of the bit at the position pos.
+   * UB: pos >= size().
+   * @param pos the position of the bit.
+   * @return the value of the bit.
+   */
+  constexpr bool operator[](size_type pos) const noexcept {
+    return 0U != (m_word[pos / m_bits_per_word] & (t_storage_type(1) << (pos % m_bits_per_word)));
+  }
+
+  /**
+   * @brief Returns the reference to the bit at the position pos.
+   * UB: pos >= size().
+   * @param pos the position of the bit.
+   * @return the reference to the bit.
+   */
+  reference operator[](size_type pos) noexcept {
+    return reference(m_word + pos / m_bits_per_word, t_storage_type(1) << (pos % m_bits_per_word));
+  }
+
+  /**
+   * @brief Returns the value of the bit at the position pos with bounds checking.
+   * If pos is not within the range of the bitset, an exception of type out_of_range is thrown.
+   * @param pos the position of the bit.
+   * @return the value of the bit.
+   */
+  bool test(size_type pos) const {
+    ::portable_stl::throw_on_true<::portable_stl::out_of_range<>>(pos >= t_size);
+    return (*this)[pos];
+  }
+
+  /**
+   * @brief Checks if all bits are set to true.
+   * @return true if all bits are set to true, false otherwise.
+   */
+  bool all() const noexcept {
+    return t_size == count();
+  }
+
+  /**
+   * @brief Checks if any bit is set to true.
+   * @return true if any bit is set to true, false otherwise.
+   */
+  bool any() const noexcept {
+    for (::portable_stl::size_t i{0U}; i < m_words; ++i) {
+      if (0U != m_word[i]) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Checks if none of the bits is set to true.
+   * @return true if none of the bits is set to true, false otherwise.
+   */
+  bool none() const noexcept {
+    return !any();
+  }
+
+  /**
+   * @brief Returns the number of bits set to true.
+   * @return the number of bits set to true.
+   */
+  size_type count() const noexcept {
+    return bit_algo::count_words(m_word, m_words);
+  }
+
+  // [capacity]
+
+  /**
+   * @brief Returns the number of bits that the bitset holds.
+   * @return t_size.
+   */
+  constexpr static size_type size() noexcept {
+    return t_size;
+  }
+
+  // [modifiers]
+
+  /**
+   * @brief Sets the bits to the result of binary AND on corresponding bits of *this and other.
+   * @param other the other bitset.
+   * @return *this.
+   */
+  bitset &operator&=(bitset const &other) noexcept {
+    bit_algo::and_words(m_word, other.m_word, m_words);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the bits to the result of binary OR on corresponding bits of *this and other.
+   * @param other the other bitset.
+   * @return *this.
+   */
+  bitset &operator|=(bitset const &other) noexcept {
+    bit_algo::or_words(m_word, other.m_word, m_words);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the bits to the result of binary XOR on corresponding bits of *this and other.
+   * @param other the other bitset.
+   * @return *this.
+   */
+  bitset &operator^=(bitset const &other) noexcept {
+    bit_algo::xor_words(m_word, other.m_word, m_words);
+    return *this;
+  }
+
+  /**
+   * @brief Clears the bits that are set in other (*this &= ~other).
+   * @param other the other bitset.
+   * @return *this.
+   */
+  bitset &and_not(bitset const &other) noexcept {
+    bit_algo::and_not_words(m_word, other.m_word, m_words);
+    return *this;
+  }
+
+  /**
+   * @brief Returns a copy of *this with all bits flipped.
+   * @return the flipped copy.
+   */
+  bitset operator~() const noexcept {
+    return bitset(*this).flip();
+  }
+
+  /**
+   * @brief Shifts the bits to the higher positions (bit i moves to i + num), the vacated positions are set to zero.
+   * @param num the number of positions to shift.
+   * @return *this.
+   */
+  bitset &operator<<=(size_type num) noexcept {
+    bit_algo::shift_up_words(m_word, m_words, num);
+    M_clear_tail();
+    return *this;
+  }
+
+  /**
+   * @brief Shifts the bits to the lower positions (bit i moves to i - num), the vacated positions are set to zero.
+   * @param num the number of positions to shift.
+   * @return *this.
+   */
+  bitset &operator>>=(size_type num) noexcept {
+    bit_algo::shift_down_words(m_word, m_words, num);
+    return *this;
+  }
+
+  /**
+   * @brief Returns a copy of *this shifted to the higher positions.
+   * @param num the number of positions to shift.
+   * @return the shifted copy.
+   */
+  bitset operator<<(size_type num) const noexcept {
+    return bitset(*this) <<= num;
+  }
+
+  /**
+   * @brief Returns a copy of *this shifted to the lower positions.
+   * @param num the number of positions to shift.
+   * @return the shifted copy.
+   */
+  bitset operator>>(size_type num) const noexcept {
+    return bitset(*this) >>= num;
+  }
+
+  /**
+   * @brief Sets all bits to true.
+   * @return *this.
+   */
+  bitset &set() noexcept {
+    for (::portable_stl::size_t i{0U}; i < m_words; ++i) {
+      m_word[i] = ~t_storage_type(0);
+    }
+    M_clear_tail();
+    return *this;
+  }
+
+  /**
+   * @brief Sets the bit at the position pos to the value.
+   * If pos is not within the range of the bitset, an exception of type out_of_range is thrown.
+   * @param pos the position of the bit.
+   * @param value the value to set.
+   * @return *this.
+   */
+  bitset &set(size_type pos, bool value = true) {
+    ::portable_stl::throw_on_true<::portable_stl::out_of_range<>>(pos >= t_size);
+    (*this)[pos] = value;
+    return *this;
+  }
+
+  /**
+   * @brief Sets all bits to false.
+   * @return *this.
+   */
+  bitset &reset() noexcept {
+    for (::portable_stl::size_t i{0U}; i < m_words; ++i) {
+      m_word[i] = 0U;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Sets the bit at the position pos to false.
+   * If pos is not within the range of the bitset, an exception of type out_of_range is thrown.
+   * @param pos the position of the bit.
+   * @return *this.
+   */
+  bitset &reset(size_type pos) {
+    return set(pos, false);
+  }
+
+  /**
+   * @brief Flips all bits.
+   * @return *this.
+   */
+  bitset &flip() noexcept {
+    bit_algo::not_words(m_word, m_words);
+    M_clear_tail();
+    return *this;
+  }
+
+  /**
+   * @brief Flips the bit at the position pos.
+   * If pos is not within the range of the bitset, an exception of type out_of_range is thrown.
+   * @param pos the position of the bit.
+   * @return *this.
+   */
+  bitset &flip(size_type pos) {
+    ::portable_stl::throw_on_true<::portable_stl::out_of_range<>>(pos >= t_size);
+    (*this)[pos].flip();
+    return *this;
+  }
+
+private:
+  /**
+   * @brief Sets to zero the bits of the last storage word beyond t_size.
+   */
+  void M_clear_tail() noexcept {
+    m_word[m_words - 1U] &= m_tail_mask;
+  }
+};
+
+/**
+ * @brief Performs binary AND between two bitsets.
+ * @tparam t_size the number of bits.
+ * @param lhv the first bitset.
+ * @param rhv the second bitset.
+ * @return the result bitset.
+ */
+template<::portable_stl::size_t t_size>
+inline bitset<t_size> operator&(bitset<t_size> const &lhv, bitset<t_size> const &rhv) noexcept {
+  return bitset<t_size>(lhv) &= rhv;
+}
+
+/**
+ * @brief Performs binary OR between two bitsets.
+ * @tparam t_size the number of bits.
+ * @param lhv the first bitset.
+ * @param rhv the second bitset.
+ * @return the result bitset.
+ */
+template<::portable_stl::size_t t_size>
+inline bitset<t_size> operator|(bitset<t_size> const &lhv, bitset<t_size> const &rhv) noexcept {
+  return bitset<t_size>(lhv) |= rhv;
+}
+
+/**
+ * @brief Performs binary XOR between two bitsets.
+ * @tparam t_size the number of bits.
+ * @param lhv the first bitset.
+ * @param rhv the second bitset.
+ * @return the result bitset.
+ */
+template<::portable_stl::size_t t_size>
+inline bitset<t_size> operator^(bitset<t_size> const &lhv, bitset<t_size> const &rhv) noexcept {
+  return bitset<t_size>(lhv) ^= rhv;
+}
+} // namespace portable_stl
+
+#endif // PSTL_BITSET_H
@@ -0,0 +1,892 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="circular_buffer.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_CIRCULAR_BUFFER_H
+#define PSTL_CIRCULAR_BUFFER_H
+
+#include "../common/ptrdiff_t.h"
+#include "../common/size_t.h"
+#include "../error/portable_stl_error.h"
+#include "../iterator/reverse_iterator.h"
+#include "../language_support/bad_alloc.h"
+#include "../language_support/length_error.h"
+#include "../memory/allocate_noexcept.h"
+#include "../memory/allocator.h"
+#include "../memory/allocator_traits.h"
+#include "../memory/compressed_pair.h"
+#include "../memory/memcpy.h"
+#include "../memory/memmove.h"
+#include "../memory/swap_allocator.h"
+#include "../memory/to_address.h"
+#include "../metaprogramming/cv_modifications/remove_cv.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/type_properties/is_trivially_copyable.h"
+#include "../metaprogramming/type_properties/is_trivially_destructible.h"
+#include "../metaprogramming/type_relations/is_same.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/functional/reference_wrapper.h"
+#include "../utility/general/move.h"
+#include "../utility/general/swap.h"
+#include "circular_buffer_helper.h"
+#include "circular_buffer_iterator.h"
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#  include "../language_support/exception/throw_on_true.h"
+#else
+#  include "../language_support/no_exception/throw_on_true.h"
+#endif
+
+namespace portable_stl {
+
+/**
+ * @brief Bounded FIFO container over a storage allocated once at construction.
+ * The capacity is rounded up to a power of two, so the element position is computed with a mask. No allocations are
+ * made after construction. When the buffer is full, new elements are rejected with portable_stl_error::length_error,
+ * or, in the overwrite-oldest mode, replace the oldest elements.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
+ * memory.
+ */
+template<class t_type, class t_allocator = ::portable_stl::allocator<t_type>> class circular_buffer final {
+  static_assert(::portable_stl::is_same<::portable_stl::remove_cv_t<t_type>, t_type>{}(),
+                "portable_stl::circular_buffer must have a non-const, non-volatile value_type");
+  static_assert(::portable_stl::is_same<typename t_allocator::value_type, t_type>{}(),
+                "portable_stl::circular_buffer must have the same value_type as its allocator");
+
+public:
+  /**
+   * @brief Value type.
+   */
+  using value_type             = t_type;
+  /**
+   * @brief Allocator type.
+   */
+  using allocator_type         = t_allocator;
+  /**
+   * @brief Allocator traits.
+   */
+  using t_allocator_traits     = ::portable_stl::allocator_traits<allocator_type>;
+  /**
+   * @brief Pointer type.
+   */
+  using pointer                = typename t_allocator_traits::pointer;
+  /**
+   * @brief Pointer to const type.
+   */
+  using const_pointer          = typename t_allocator_traits::const_pointer;
+  /**
+   * @brief Reference type.
+   */
+  using reference              = value_type &;
+  /**
+   * @brief Const reference type.
+   */
+  using const_reference        = value_type const &;
+  /**
+   * @brief Size type.
+   */
+  using size_type              = ::portable_stl::size_t;
+  /**
+   * @brief Difference type.
+   */
+  using difference_type        = ::portable_stl::ptrdiff_t;
+  /**
+   * @brief Iterator type.
+   */
+  using iterator               = ::portable_stl::circular_buffer_iterator<circular_buffer, false>;
+  /**
+   * @brief Const iterator type.
+   */
+  using const_iterator         = ::portable_stl::circular_buffer_iterator<circular_buffer, true>;
+  /**
+   * @brief Reverse iterator type.
+   */
+  using reverse_iterator       = ::portable_stl::reverse_iterator<iterator>;
+  /**
+   * @brief Reverse const iterator type.
+   */
+  using const_reverse_iterator = ::portable_stl::reverse_iterator<const_iterator>;
+  /**
+   * @brief Contiguous part of the content.
+   */
+  using array_range            = ::portable_stl::circular_buffer_array_range<pointer, size_type>;
+  /**
+   * @brief Contiguous part of the constant content.
+   */
+  using const_array_range      = ::portable_stl::circular_buffer_array_range<const_pointer, size_type>;
+
+private:
+  /**
+   * @brief Reference wrapper to value_type. Used in expected return.
+   */
+  using reference_wrap = ::portable_stl::reference_wrapper<value_type>;
+
+  /**
+   * @brief Internal pointer to the storage.
+   */
+  pointer m_data = nullptr;
+
+  /**
+   * @brief Storage index of the oldest element.
+   */
+  size_type m_head = 0U;
+
+  /**
+   * @brief Number of elements.
+   */
+  size_type m_size = 0U;
+
+  /**
+   * @brief Overwrite-oldest mode flag.
+   */
+  bool m_overwrite = false;
+
+  /**
+   * @brief Pair to store capacity of the storage and allocator (state or stateless).
+   */
+  ::portable_stl::compressed_pair<size_type, allocator_type> m_capacity_alloc
+    = ::portable_stl::compressed_pair<size_type, allocator_type>(0U, allocator_type());
+
+  /**
+   * @brief Retrieving buffer's allocator.
+   * @return allocator_type&
+   */
+  allocator_type &M_alloc() noexcept {
+    return m_capacity_alloc.get_second();
+  }
+
+  /**
+   * @brief Retrieving buffer's allocator constant.
+   * @return allocator_type const&
+   */
+  allocator_type const &M_alloc() const noexcept {
+    return m_capacity_alloc.get_second();
+  }
+
+  /**
+   * @brief Storage index of the element at logical position pos.
+   * @param pos the logical position.
+   * @return storage index.
+   */
+  size_type M_index(size_type pos) const noexcept {
+    return (m_head + pos) & (capacity() - 1U);
+  }
+
+  /**
+   * @brief Allocates storage for at least num elements.
+   * @param num the requested capacity.
+   * @return portable_stl_error::length_error if rounded capacity exceeds max_size(),
+   * portable_stl_error::allocate_error if memory cannot be allocated.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> M_allocate(size_type num) noexcept {
+    if (0U == num) {
+      return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+    }
+    size_type const new_capacity{::portable_stl::circular_buffer_helper::round_up_to_power_of_two(num)};
+    if ((0U == new_capacity) || (new_capacity > max_size())) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::length_error};
+    }
+    pointer const ptr{::portable_stl::allocate_noexcept(M_alloc(), new_capacity)};
+    if (nullptr == ptr) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+    m_data                         = ptr;
+    m_capacity_alloc.get_first() = new_capacity;
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Destroys elements and releases the storage.
+   */
+  void M_deallocate() noexcept {
+    clear();
+    if (nullptr != m_data) {
+      t_allocator_traits::deallocate(M_alloc(), m_data, capacity());
+      m_data                         = nullptr;
+      m_capacity_alloc.get_first() = 0U;
+    }
+  }
+
+  /**
+   * @brief Appends copies of elements from other. Buffer must have enough free space.
+   * @param other the source buffer.
+   */
+  void M_copy_elements(circular_buffer const &other) {
+    const_array_range const one{other.array_one()};
+    const_array_range const two{other.array_two()};
+    static_cast<void>(push_back_n(one.ptr, one.count));
+    static_cast<void>(push_back_n(two.ptr, two.count));
+  }
+
+  /**
+   * @brief Copies count elements from src to free space after the last element.
+   * Free space must be contiguous and large enough. Trivially copyable elements are copied with memcpy.
+   * @param src the source elements.
+   * @param count the number of elements.
+   */
+  void M_copy_in(const_pointer src, size_type count, ::portable_stl::true_type) noexcept {
+    if (count > 0U) {
+      static_cast<void>(::portable_stl::memcpy(
+        ::portable_stl::to_address(m_data + M_index(m_size)), ::portable_stl::to_address(src), count * sizeof(value_type)));
+      m_size += count;
+    }
+  }
+
+  /**
+   * @brief Copies count elements from src to free space after the last element.
+   * Free space must be contiguous and large enough.
+   * @param src the source elements.
+   * @param count the number of elements.
+   */
+  void M_copy_in(const_pointer src, size_type count, ::portable_stl::false_type) {
+    pointer const dst{m_data + M_index(m_size)};
+    for (size_type idx{0U}; idx < count; ++idx) {
+      t_allocator_traits::construct(M_alloc(), ::portable_stl::to_address(dst + idx), src[idx]);
+      ++m_size;
+    }
+  }
+
+  /**
+   * @brief Copies count elements from src to free space after the last element, in at most two chunks.
+   * Buffer must have enough free space.
+   * @param src the source elements.
+   * @param count the number of elements.
+   */
+  void M_append(const_pointer src, size_type count) {
+    if (count > 0U) {
+      size_type const tail{M_index(m_size)};
+      size_type const tail_room{capacity() - tail};
+      size_type const first_count{(count < tail_room) ? count : tail_room};
+      M_copy_in(src, first_count, ::portable_stl::is_trivially_copyable<value_type>{});
+      M_copy_in(src + first_count, count - first_count, ::portable_stl::is_trivially_copyable<value_type>{});
+    }
+  }
+
+  /**
+   * @brief Assigns count elements from src over the oldest elements, which then become the newest ones.
+   * Buffer must be full. The elements are assigned in order and src[idx] is never older than the element it replaces,
+   * so src may point to the elements of the buffer. Trivially copyable elements are copied with memmove.
+   * @param src the source elements.
+   * @param count the number of elements.
+   */
+  void M_assign_front(const_pointer src, size_type count, ::portable_stl::true_type) noexcept {
+    size_type const head_room{capacity() - m_head};
+    size_type const first_count{(count < head_room) ? count : head_room};
+    static_cast<void>(::portable_stl::memmove(
+      ::portable_stl::to_address(m_data + m_head), ::portable_stl::to_address(src), first_count * sizeof(value_type)));
+    static_cast<void>(::portable_stl::memmove(::portable_stl::to_address(m_data),
+                                              ::portable_stl::to_address(src + first_count),
+                                              (count - first_count) * sizeof(value_type)));
+    m_head = M_index(count);
+  }
+
+  /**
+   * @brief Assigns count elements from src over the oldest elements, which then become the newest ones.
+   * Buffer must be full. The elements are assigned in order and src[idx] is never older than the element it replaces,
+   * so src may point to the elements of the buffer.
+   * @param src the source elements.
+   * @param count the number of elements.
+   */
+  void M_assign_front(const_pointer src, size_type count, ::portable_stl::false_type) {
+    for (size_type idx{0U}; idx < count; ++idx) {
+      m_data[M_index(idx)] = src[idx];
+    }
+    m_head = M_index(count);
+  }
+
+  /**
+   * @brief Moves count first elements to dst and removes them from the buffer.
+   * Elements must be contiguous. Trivially copyable elements are copied with memcpy.
+   * @param dst the destination elements.
+   * @param count the number of elements.
+   */
+  void M_move_out(pointer dst, size_type count, ::portable_stl::true_type) noexcept {
+    if (count > 0U) {
+      static_cast<void>(::portable_stl::memcpy(
+        ::portable_stl::to_address(dst), ::portable_stl::to_address(m_data + m_head), count * sizeof(value_type)));
+      m_head  = M_index(count);
+      m_size -= count;
+    }
+  }
+
+  /**
+   * @brief Moves count first elements to dst and removes them from the buffer.
+   * Elements must be contiguous.
+   * @param dst the destination elements.
+   * @param count the number of elements.
+   */
+  void M_move_out(pointer dst, size_type count, ::portable_stl::false_type) {
+    for (size_type idx{0U}; idx < count; ++idx) {
+      dst[idx] = ::portable_stl::move(front());
+      pop_front();
+    }
+  }
+
+  /**
+   * @brief Destroys count first elements. Nothing to do for trivially destructible elements.
+   * @param count the number of elements.
+   */
+  void M_destroy_front(size_type, ::portable_stl::true_type) noexcept {
+  }
+
+  /**
+   * @brief Destroys count first elements.
+   * @param count the number of elements.
+   */
+  void M_destroy_front(size_type count, ::portable_stl::false_type) noexcept {
+    for (size_type idx{0U}; idx < count; ++idx) {
+      t_allocator_traits::destroy(M_alloc(), ::portable_stl::to_address(m_data + M_index(idx)));
+    }
+  }
+
+public:
+  // [construct/copy/destroy]
+
+  /**
+   * @brief Default constructor. Constructs an empty buffer with zero capacity.
+   * @throw allocator_type() may throw.
+   */
+  circular_buffer() noexcept(noexcept(allocator_type())) : m_capacity_alloc(0U, allocator_type()) {
+  }
+
+  /**
+   * @brief Constructs an empty buffer with zero capacity and the given allocator alloc.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   */
+  explicit circular_buffer(allocator_type const &alloc) noexcept : m_capacity_alloc(0U, alloc) {
+  }
+
+  /**
+   * @brief Constructs an empty buffer able to hold at least num elements.
+   * The capacity is rounded up to a power of two.
+   * @throw length_error if rounded capacity > max_size();
+   *        bad_alloc if memory cannot be allocated.
+   * @param num The requested capacity.
+   */
+  explicit circular_buffer(size_type num) : circular_buffer(num, allocator_type()) {
+  }
+
+  /**
+   * @brief Constructs an empty buffer able to hold at least num elements with the given allocator alloc.
+   * The capacity is rounded up to a power of two.
+   * @throw length_error if rounded capacity > max_size();
+   *        bad_alloc if memory cannot be allocated.
+   * @param num The requested capacity.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   */
+  circular_buffer(size_type num, allocator_type const &alloc) : m_capacity_alloc(0U, alloc) {
+    auto const result = M_allocate(num);
+    if (!result) {
+      ::portable_stl::throw_on_true<::portable_stl::length_error<>>(
+        ::portable_stl::portable_stl_error::length_error == result.error());
+      ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(true);
+    }
+  }
+
+  /**
+   * @brief Creates an empty buffer able to hold at least num elements.
+   * @param num The requested capacity.
+   * @return ::portable_stl::expected<circular_buffer, ::portable_stl::portable_stl_error>
+   */
+  static ::portable_stl::expected<circular_buffer, ::portable_stl::portable_stl_error> make_circular_buffer(
+    size_type num) noexcept(noexcept(allocator_type())) {
+    return make_circular_buffer(num, allocator_type());
+  }
+
+  /**
+   * @brief Creates an empty buffer able to hold at least num elements with the given allocator alloc.
+   * @param num The requested capacity.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   * @return ::portable_stl::expected<circular_buffer, ::portable_stl::portable_stl_error>
+   */
+  static ::portable_stl::expected<circular_buffer, ::portable_stl::portable_stl_error> make_circular_buffer(
+    size_type num, allocator_type const &alloc) noexcept {
+    circular_buffer buf{alloc};
+    auto const      result = buf.M_allocate(num);
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    return ::portable_stl::expected<circular_buffer, ::portable_stl::portable_stl_error>(::portable_stl::move(buf));
+  }
+
+  /**
+   * @brief Copy constructor. Allocates storage of the same capacity and copies elements and mode.
+   * @throw bad_alloc if memory cannot be allocated.
+   * @param other Another buffer to be used as source.
+   */
+  circular_buffer(circular_buffer const &other)
+      : m_overwrite(other.m_overwrite),
+        m_capacity_alloc(0U, t_allocator_traits::select_on_container_copy_construction(other.M_alloc())) {
+    auto const result = M_allocate(other.capacity());
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!result);
+    if (result) {
+      M_copy_elements(other);
+    }
+  }
+
+  /**
+   * @brief Move constructor. After the move, other is empty with zero capacity.
+   * @param other Another buffer to be used as source.
+   */
+  circular_buffer(circular_buffer &&other) noexcept
+      : m_data(other.m_data),
+        m_head(other.m_head),
+        m_size(other.m_size),
+        m_overwrite(other.m_overwrite),
+        m_capacity_alloc(other.capacity(), ::portable_stl::move(other.M_alloc())) {
+    other.m_data                         = nullptr;
+    other.m_head                         = 0U;
+    other.m_size                         = 0U;
+    other.m_capacity_alloc.get_first() = 0U;
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  ~circular_buffer() noexcept {
+    M_deallocate();
+  }
+
+  /**
+   * @brief Copy assignment operator. Reuses the storage if capacities are equal.
+   * @throw bad_alloc if memory cannot be allocated.
+   * @param other Another buffer to use as data source.
+   * @return circular_buffer&
+   */
+  circular_buffer &operator=(circular_buffer const &other) {
+    if (this != &other) {
+      if (capacity() == other.capacity()) {
+        clear();
+        m_overwrite = other.m_overwrite;
+        M_copy_elements(other);
+      } else {
+        circular_buffer tmp{other};
+        swap(tmp);
+      }
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator.
+   * @param other Another buffer to use as data source.
+   * @return circular_buffer&
+   */
+  circular_buffer &operator=(circular_buffer &&other) noexcept {
+    if (this != &other) {
+      circular_buffer tmp{::portable_stl::move(other)};
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Returns the allocator associated with the container.
+   * @return allocator_type
+   */
+  allocator_type get_allocator() const noexcept {
+    return M_alloc();
+  }
+
+  // [capacity]
+
+  /**
+   * @brief Checks if the container has no elements.
+   * @return true if the container is empty, false otherwise.
+   */
+  bool empty() const noexcept {
+    return 0U == m_size;
+  }
+
+  /**
+   * @brief Checks if the container has no free space.
+   * @return true if size() == capacity(), false otherwise.
+   */
+  bool full() const noexcept {
+    return capacity() == m_size;
+  }
+
+  /**
+   * @brief Returns the number of elements in the container.
+   * @return The number of elements in the container.
+   */
+  size_type size() const noexcept {
+    return m_size;
+  }
+
+  /**
+   * @brief Returns the number of elements that the container can hold. Always zero or a power of two.
+   * @return Capacity of the allocated storage.
+   */
+  size_type capacity() const noexcept {
+    return m_capacity_alloc.get_first();
+  }
+
+  /**
+   * @brief Returns the number of elements that can be appended without overwriting.
+   * @return capacity() - size().
+   */
+  size_type free_space() const noexcept {
+    return capacity() - m_size;
+  }
+
+  /**
+   * @brief Returns the maximum possible capacity.
+   * @return Maximum number of elements.
+   */
+  size_type max_size() const noexcept {
+    return t_allocator_traits::max_size(M_alloc());
+  }
+
+  /**
+   * @brief Checks the overwrite-oldest mode.
+   * @return true if appending to the full buffer replaces the oldest elements.
+   */
+  bool overwrite_oldest() const noexcept {
+    return m_overwrite;
+  }
+
+  /**
+   * @brief Sets the overwrite-oldest mode.
+   * @param overwrite true to replace the oldest elements when appending to the full buffer, false to reject new
+   * elements.
+   */
+  void set_overwrite_oldest(bool overwrite) noexcept {
+    m_overwrite = overwrite;
+  }
+
+  // [element access]
+
+  /**
+   * @brief Returns a reference to the element at logical position pos (0 is the oldest element). No bounds checking.
+   * @param pos Position of the element to return.
+   * @return Reference to the requested element.
+   */
+  reference operator[](size_type pos) noexcept {
+    return m_data[M_index(pos)];
+  }
+
+  /**
+   * @brief Returns a reference to the element at logical position pos (0 is the oldest element). No bounds checking.
+   * @param pos Position of the element to return.
+   * @return Reference to the requested element.
+   */
+  const_reference operator[](size_type pos) const noexcept {
+    return m_data[M_index(pos)];
+  }
+
+  /**
+   * @brief Returns a reference to the element at logical position pos, with bounds checking.
+   * @param pos Position of the element to return.
+   * @return Reference to the requested element or portable_stl_error::out_of_range if pos >= size().
+   */
+  ::portable_stl::expected<reference_wrap, ::portable_stl::portable_stl_error> at(size_type pos) noexcept {
+    if (pos >= m_size) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::out_of_range};
+    }
+    return ::portable_stl::expected<reference_wrap, ::portable_stl::portable_stl_error>(
+      ::portable_stl::ref<value_type>((*this)[pos]));
+  }
+
+  /**
+   * @brief Returns a reference to the oldest element.
+   * UB: Calling front on an empty container.
+   * @return Reference to the oldest element.
+   */
+  reference front() noexcept {
+    return m_data[m_head];
+  }
+
+  /**
+   * @brief Returns a reference to the oldest element.
+   * UB: Calling front on an empty container.
+   * @return Reference to the oldest element.
+   */
+  const_reference front() const noexcept {
+    return m_data[m_head];
+  }
+
+  /**
+   * @brief Returns a reference to the newest element.
+   * UB: Calling back on an empty container.
+   * @return Reference to the newest element.
+   */
+  reference back() noexcept {
+    return m_data[M_index(m_size - 1U)];
+  }
+
+  /**
+   * @brief Returns a reference to the newest element.
+   * UB: Calling back on an empty container.
+   * @return Reference to the newest element.
+   */
+  const_reference back() const noexcept {
+    return m_data[M_index(m_size - 1U)];
+  }
+
+  /**
+   * @brief Returns the first contiguous part of the content, starting with the oldest element.
+   * @return array_range
+   */
+  array_range array_one() noexcept {
+    size_type const tail_room{capacity() - m_head};
+    return array_range{m_data + m_head, (m_size < tail_room) ? m_size : tail_room};
+  }
+
+  /**
+   * @brief Returns the first contiguous part of the content, starting with the oldest element.
+   * @return const_array_range
+   */
+  const_array_range array_one() const noexcept {
+    size_type const tail_room{capacity() - m_head};
+    return const_array_range{m_data + m_head, (m_size < tail_room) ? m_size : tail_room};
+  }
+
+  /**
+   * @brief Returns the second contiguous part of the content, wrapped to the start of the storage.
+   * @return array_range with zero count if the content is contiguous.
+   */
+  array_range array_two() noexcept {
+    size_type const tail_room{capacity() - m_head};
+    return array_range{m_data, (m_size > tail_room) ? (m_size - tail_room) : 0U};
+  }
+
+  /**
+   * @brief Returns the second contiguous part of the content, wrapped to the start of the storage.
+   * @return const_array_range with zero count if the content is contiguous.
+   */
+  const_array_range array_two() const noexcept {
+    size_type const tail_room{capacity() - m_head};
+    return const_array_range{m_data, (m_size > tail_room) ? (m_size - tail_room) : 0U};
+  }
+
+  // [iterators]
+
+  iterator begin() noexcept {
+    return iterator(this, 0U);
+  }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(this, 0U);
+  }
+
+  iterator end() noexcept {
+    return iterator(this, m_size);
+  }
+
+  const_iterator end() const noexcept {
+    return const_iterator(this, m_size);
+  }
+
+  const_iterator cbegin() const noexcept {
+    return begin();
+  }
+
+  const_iterator cend() const noexcept {
+    return end();
+  }
+
+  reverse_iterator rbegin() noexcept {
+    return reverse_iterator(end());
+  }
+
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend() noexcept {
+    return reverse_iterator(begin());
+  }
+
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  const_reverse_iterator crbegin() const noexcept {
+    return rbegin();
+  }
+
+  const_reverse_iterator crend() const noexcept {
+    return rend();
+  }
+
+  // [modifiers]
+
+  /**
+   * @brief Appends a new element constructed in-place from args.
+   * In the overwrite-oldest mode the new element is first built into a temporary, since args may refer to the oldest
+   * element (e.g. push_back(front())), and only then the oldest element is removed from the full buffer.
+   * @tparam t_args Types of the arguments.
+   * @param args Arguments to forward to the constructor of the element.
+   * @return Reference to the inserted element or portable_stl_error::length_error if there is no room for it.
+   */
+  template<class... t_args>
+  ::portable_stl::expected<reference_wrap, ::portable_stl::portable_stl_error> emplace_back(t_args &&...args) {
+    pointer const pos{m_data + M_index(m_size)};
+    if (full()) {
+      if ((!m_overwrite) || (0U == capacity())) {
+        return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+          ::portable_stl::portable_stl_error::length_error};
+      }
+      value_type value(::portable_stl::forward<t_args>(args)...);
+      pop_front();
+      t_allocator_traits::construct(M_alloc(), ::portable_stl::to_address(pos), ::portable_stl::move(value));
+    } else {
+      t_allocator_traits::construct(
+        M_alloc(), ::portable_stl::to_address(pos), ::portable_stl::forward<t_args>(args)...);
+    }
+    ++m_size;
+    return ::portable_stl::expected<reference_wrap, ::portable_stl::portable_stl_error>(
+      ::portable_stl::ref<value_type>(*pos));
+  }
+
+  /**
+   * @brief Appends the given element value.
+   * @param value The value of the element to append.
+   * @return portable_stl_error::length_error if there is no room for the element.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> push_back(const_reference value) {
+    auto result = emplace_back(value);
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Appends the given element value.
+   * @param value The value of the element to append.
+   * @return portable_stl_error::length_error if there is no room for the element.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> push_back(value_type &&value) {
+    auto result = emplace_back(::portable_stl::move(value));
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Appends copies of count elements from the contiguous range starting at src.
+   * Elements are copied at most in two chunks, trivially copyable ones with memcpy.
+   * Without overwrite-oldest mode only free_space() elements are appended. In the overwrite-oldest mode only the last
+   * capacity() elements of the range are kept: the free space is filled first, then the oldest elements are assigned
+   * over in order. So src may point to the elements of the buffer itself, e.g. array_one().ptr.
+   * @param src Pointer to the first element to append.
+   * @param count Number of elements to append.
+   * @return Number of appended elements.
+   */
+  size_type push_back_n(const_pointer src, size_type count) {
+    if (m_overwrite) {
+      if (count > capacity()) {
+        src   += (count - capacity());
+        count  = capacity();
+      }
+      if (count > free_space()) {
+        size_type const free_count{free_space()};
+        M_append(src, free_count);
+        M_assign_front(src + free_count, count - free_count, ::portable_stl::is_trivially_copyable<value_type>{});
+        return count;
+      }
+    } else if (count > free_space()) {
+      count = free_space();
+    }
+    M_append(src, count);
+    return count;
+  }
+
+  /**
+   * @brief Removes the oldest element.
+   * UB: Calling pop_front on an empty container.
+   */
+  void pop_front() noexcept {
+    t_allocator_traits::destroy(M_alloc(), ::portable_stl::to_address(m_data + m_head));
+    m_head = M_index(1U);
+    --m_size;
+  }
+
+  /**
+   * @brief Moves at most count oldest elements to the contiguous range starting at dst and removes them.
+   * Elements are moved at most in two chunks, trivially copyable ones with memcpy.
+   * @param dst Pointer to the first destination element.
+   * @param count Maximum number of elements to move.
+   * @return Number of moved elements.
+   */
+  size_type pop_front_n(pointer dst, size_type count) {
+    if (count > m_size) {
+      count = m_size;
+    }
+    size_type const first_count{(count < array_one().count) ? count : array_one().count};
+    M_move_out(dst, first_count, ::portable_stl::is_trivially_copyable<value_type>{});
+    M_move_out(dst + first_count, count - first_count, ::portable_stl::is_trivially_copyable<value_type>{});
+    return count;
+  }
+
+  /**
+   * @brief Removes at most count oldest elements.
+   * @param count Maximum number of elements to remove.
+   * @return Number of removed elements.
+   */
+  size_type erase_front(size_type count) noexcept {
+    if (count > m_size) {
+      count = m_size;
+    }
+    M_destroy_front(count, ::portable_stl::is_trivially_destructible<value_type>{});
+    if (count > 0U) {
+      m_head  = M_index(count);
+      m_size -= count;
+    }
+    return count;
+  }
+
+  /**
+   * @brief Erases all elements from the container. Capacity is not changed.
+   */
+  void clear() noexcept {
+    static_cast<void>(erase_front(m_size));
+    m_head = 0U;
+  }
+
+  /**
+   * @brief Exchanges the contents of the container with those of other.
+   * @param other Container to exchange the contents with.
+   */
+  void swap(circular_buffer &other) noexcept {
+    ::portable_stl::swap(m_data, other.m_data);
+    ::portable_stl::swap(m_head, other.m_head);
+    ::portable_stl::swap(m_size, other.m_size);
+    ::portable_stl::swap(m_overwrite, other.m_overwrite);
+    ::portable_stl::swap(m_capacity_alloc.get_first(), other.m_capacity_alloc.get_first());
+    ::portable_stl::swap_allocator(M_alloc(), other.M_alloc());
+  }
+};
+
+/**
+ * @brief Specializes the swap algorithm for circular_buffer.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator Allocator type.
+ * @param lhv Container whose contents to swap.
+ * @param rhv Container whose contents to swap.
+ */
+template<class t_type, class t_allocator>
+void swap(circular_buffer<t_type, t_allocator> &lhv, circular_buffer<t_type, t_allocator> &rhv) noexcept {
+  lhv.swap(rhv);
+}
+} // namespace portable_stl
+
+#endif // PSTL_CIRCULAR_BUFFER_H
@@ -0,0 +1,59 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="circular_buffer_helper.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_CIRCULAR_BUFFER_HELPER_H
+#define PSTL_CIRCULAR_BUFFER_HELPER_H
+
+#include "../common/size_t.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Contiguous part of the circular buffer content.
+ *
+ * @tparam t_pointer the pointer type.
+ * @tparam t_size_type the size type.
+ */
+template<class t_pointer, class t_size_type = ::portable_stl::size_t> struct circular_buffer_array_range final {
+  /**
+   * @brief Pointer to the first element of the part.
+   */
+  t_pointer   ptr;
+  /**
+   * @brief Number of elements in the part.
+   */
+  t_size_type count;
+};
+
+namespace circular_buffer_helper {
+  /**
+   * @brief Rounds value up to the nearest power of two.
+   *
+   * @param value the value to round.
+   * @return the smallest power of two not less than value, value for 0 or 1, 0 on overflow.
+   */
+  constexpr inline ::portable_stl::size_t round_up_to_power_of_two(::portable_stl::size_t value) noexcept {
+    if (value <= 1U) {
+      return value;
+    }
+    ::portable_stl::size_t result{1U};
+    while (result < value) {
+      result <<= 1U;
+      if (0U == result) {
+        return 0U;
+      }
+    }
+    return result;
+  }
+} // namespace circular_buffer_helper
+} // namespace portable_stl
+
+#endif // PSTL_CIRCULAR_BUFFER_HELPER_H
@@ -0,0 +1,197 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="circular_buffer_iterator.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_CIRCULAR_BUFFER_ITERATOR_H
+#define PSTL_CIRCULAR_BUFFER_ITERATOR_H
+
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/other_transformations/conditional.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Random access iterator over circular buffer elements.
+ * Keeps the logical position of the element (0 is the oldest one), so the iterator stays valid while elements are
+ * only appended to the buffer.
+ *
+ * @tparam t_container_type the type of the circular buffer.
+ * @tparam t_is_const the constness of the iterator.
+ */
+template<class t_container_type, bool t_is_const> class circular_buffer_iterator final {
+public:
+  /**
+   * @brief Difference type.
+   */
+  using difference_type   = typename t_container_type::difference_type;
+  /**
+   * @brief Value type.
+   */
+  using value_type        = typename t_container_type::value_type;
+  /**
+   * @brief Pointer type.
+   */
+  using pointer           = ::portable_stl::
+    conditional_t<t_is_const, typename t_container_type::const_pointer, typename t_container_type::pointer>;
+  /**
+   * @brief Reference type.
+   */
+  using reference         = ::portable_stl::
+    conditional_t<t_is_const, typename t_container_type::const_reference, typename t_container_type::reference>;
+  /**
+   * @brief Iterator category.
+   */
+  using iterator_category = ::portable_stl::random_access_iterator_tag;
+
+private:
+  /**
+   * @brief Size type.
+   */
+  using size_type            = typename t_container_type::size_type;
+  /**
+   * @brief Pointer to the iterated container.
+   */
+  using t_container_pointer  = ::portable_stl::conditional_t<t_is_const, t_container_type const *, t_container_type *>;
+
+  /**
+   * @brief Iterated container.
+   */
+  t_container_pointer m_container;
+  /**
+   * @brief Logical position in the container.
+   */
+  size_type           m_pos;
+
+public:
+  /**
+   * @brief Default constructor.
+   */
+  circular_buffer_iterator() noexcept : m_container(nullptr), m_pos(0U) {
+  }
+
+  /**
+   * @brief Copy constructor for t_is_const=false and converting constructor for t_is_const=true.
+   * @param other the source iterator.
+   */
+  circular_buffer_iterator(circular_buffer_iterator<t_container_type, false> const &other) noexcept
+      : m_container(other.m_container), m_pos(other.m_pos) {
+  }
+
+  /**
+   * @brief Copy assignment.
+   * @param other the source iterator.
+   * @return circular_buffer_iterator&
+   */
+  circular_buffer_iterator &operator=(circular_buffer_iterator const &other) noexcept = default;
+
+  reference operator*() const noexcept {
+    return (*m_container)[m_pos];
+  }
+
+  pointer operator->() const noexcept {
+    return &(*m_container)[m_pos];
+  }
+
+  circular_buffer_iterator &operator++() noexcept {
+    ++m_pos;
+    return *this;
+  }
+
+  circular_buffer_iterator operator++(int) noexcept {
+    circular_buffer_iterator tmp{*this};
+    ++m_pos;
+    return tmp;
+  }
+
+  circular_buffer_iterator &operator--() noexcept {
+    --m_pos;
+    return *this;
+  }
+
+  circular_buffer_iterator operator--(int) noexcept {
+    circular_buffer_iterator tmp{*this};
+    --m_pos;
+    return tmp;
+  }
+
+  circular_buffer_iterator &operator+=(difference_type num) noexcept {
+    m_pos = static_cast<size_type>(static_cast<difference_type>(m_pos) + num);
+    return *this;
+  }
+
+  circular_buffer_iterator &operator-=(difference_type num) noexcept {
+    return *this += -num;
+  }
+
+  circular_buffer_iterator operator+(difference_type num) const noexcept {
+    circular_buffer_iterator tmp{*this};
+    tmp += num;
+    return tmp;
+  }
+
+  circular_buffer_iterator operator-(difference_type num) const noexcept {
+    circular_buffer_iterator tmp{*this};
+    tmp -= num;
+    return tmp;
+  }
+
+  friend circular_buffer_iterator operator+(difference_type num, circular_buffer_iterator const &iter) noexcept {
+    return iter + num;
+  }
+
+  friend difference_type operator-(circular_buffer_iterator const &lhv, circular_buffer_iterator const &rhv) noexcept {
+    return static_cast<difference_type>(lhv.m_pos) - static_cast<difference_type>(rhv.m_pos);
+  }
+
+  reference operator[](difference_type num) const noexcept {
+    return *(*this + num);
+  }
+
+  friend bool operator==(circular_buffer_iterator const &lhv, circular_buffer_iterator const &rhv) noexcept {
+    return (lhv.m_container == rhv.m_container) && (lhv.m_pos == rhv.m_pos);
+  }
+
+  friend bool operator!=(circular_buffer_iterator const &lhv, circular_buffer_iterator const &rhv) noexcept {
+    return !(lhv == rhv);
+  }
+
+  friend bool operator<(circular_buffer_iterator const &lhv, circular_buffer_iterator const &rhv) noexcept {
+    return lhv.m_pos < rhv.m_pos;
+  }
+
+  friend bool operator>(circular_buffer_iterator const &lhv, circular_buffer_iterator const &rhv) noexcept {
+    return rhv < lhv;
+  }
+
+  friend bool operator<=(circular_buffer_iterator const &lhv, circular_buffer_iterator const &rhv) noexcept {
+    return !(rhv < lhv);
+  }
+
+  friend bool operator>=(circular_buffer_iterator const &lhv, circular_buffer_iterator const &rhv) noexcept {
+    return !(lhv < rhv);
+  }
+
+private:
+  /**
+   * @brief Constructs iterator to the position in the container.
+   * @param container the iterated container.
+   * @param pos the logical position.
+   */
+  explicit circular_buffer_iterator(t_container_pointer container, size_type pos) noexcept
+      : m_container(container), m_pos(pos) {
+  }
+
+  friend t_container_type;
+  friend class circular_buffer_iterator<t_container_type, true>;
+};
+
+} // namespace portable_stl
+
+#endif // PSTL_CIRCULAR_BUFFER_ITERATOR_H
@@ -44,7 +44,7 @@ template<class t_node_type, class t_allocator, template<class, class> class t_ma
 class basic_node_handle
     : public t_map_or_set_specifics<t_node_type, basic_node_handle<t_node_type, t_allocator, t_map_or_set_specifics>> {
   //
-  template<class t_type, class t_compare, class t_allocator_typ> friend class tree;
+  template<class t_type, class t_compare, class t_allocator_typ, class t_node_policy> friend class tree;
 
   friend class t_map_or_set_specifics<t_node_type, basic_node_handle<t_node_type, t_allocator, t_map_or_set_specifics>>;
 
@@ -0,0 +1,42 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="sorted_tags.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SORTED_TAGS_H
+#define PSTL_SORTED_TAGS_H
+
+namespace portable_stl {
+/**
+ * @brief The range is sorted and has no equivalent elements.
+ *
+ */
+class sorted_unique_t final {
+public:
+  /**
+   * @brief Default constructor.
+   */
+  explicit sorted_unique_t() noexcept = default;
+};
+
+/**
+ * @brief The range is sorted, equivalent elements are allowed.
+ *
+ */
+class sorted_equivalent_t final {
+public:
+  /**
+   * @brief Default constructor.
+   */
+  explicit sorted_equivalent_t() noexcept = default;
+};
+
+} // namespace portable_stl
+
+#endif // PSTL_SORTED_TAGS_H
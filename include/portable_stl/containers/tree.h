@@ -15,14 +15,18 @@
 #include "../algorithm/min.h"
 #include "../common/numeric_limits.h"
 #include "../error/portable_stl_error.h"
+#include "../iterator/iterator_traits.h"
 #include "../memory/addressof.h"
 #include "../memory/allocate_noexcept.h"
 #include "../memory/allocator_traits.h"
 #include "../memory/compressed_pair.h"
+#include "../memory/construct_at.h"
 #include "../memory/pointer_traits.h"
+#include "../memory/prefetch.h"
 #include "../memory/rebind_alloc.h"
 #include "../memory/rebind_pointer.h"
 #include "../memory/swap_allocator.h"
+#include "../memory/to_address.h"
 #include "../memory/unique_ptr.h"
 #include "../metaprogramming/cv_modifications/is_same_uncvref.h"
 #include "../metaprogramming/helper/integral_constant.h"
@@ -43,11 +47,13 @@
 #include "../utility/expected/expected.h"
 #include "../utility/expected/unexpected.h"
 #include "../utility/general/forward.h"
+#include "../utility/general/make_exception_guard.h"
 #include "../utility/general/move.h"
 #include "../utility/general/swap.h"
 #include "../utility/tuple/tuple.h"
 #include "node_handle.h"
 #include "tree_algo.h"
+#include "tree_arena.h"
 #include "tree_const_iterator.h"
 #include "tree_helpers.h"
 #include "tree_iterator.h"
@@ -59,8 +65,8 @@ namespace portable_stl {
 // used in node_handle
 template<class t_node_type, class t_allocator> struct generic_container_node_destructor;
 
-template<class t_type, class t_void_ptr, class t_allocator>
-struct generic_container_node_destructor<::portable_stl::tree_node<t_type, t_void_ptr>, t_allocator>
+template<class t_type, class t_void_ptr, class t_node_policy, class t_allocator>
+struct generic_container_node_destructor<::portable_stl::tree_node<t_type, t_void_ptr, t_node_policy>, t_allocator>
     : ::portable_stl::tree_node_destructor<t_allocator> {
   using ::portable_stl::tree_node_destructor<t_allocator>::tree_node_destructor;
 };
@@ -71,8 +77,13 @@ struct generic_container_node_destructor<::portable_stl::tree_node<t_type, t_voi
  * @tparam t_type Type of the value stored in tree's nodes.
  * @tparam t_compare Compare type for tree's nodes.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Node policy type, tree_rank_node_policy enables nth() and rank().
  */
-template<class t_type, class t_compare, class t_allocator> class tree {
+template<class t_type,
+         class t_compare,
+         class t_allocator,
+         class t_node_policy = ::portable_stl::tree_plain_node_policy>
+class tree {
 public:
   /**
    * @brief Value type.
@@ -101,8 +112,8 @@ private:
    * @brief Node traits type.
    *
    */
-  using t_node_types =
-    typename ::portable_stl::tree_helper::make_tree_node_types<value_type, typename t_alloc_traits::void_pointer>::type;
+  using t_node_types = typename ::portable_stl::tree_helper::
+    make_tree_node_types<value_type, typename t_alloc_traits::void_pointer, t_node_policy>::type;
 
   /**
    * @brief Key type.
@@ -245,6 +256,18 @@ private:
   ::portable_stl::compressed_pair<size_type, value_compare> m_pair3
     = ::portable_stl::compressed_pair<size_type, value_compare>(0, value_compare());
 
+  /**
+   * @brief Header of the node block type.
+   *
+   */
+  using t_arena_header = tree_ns::tree_arena_header<t_node_pointer, size_type>;
+
+  /**
+   * @brief The first node block made by compact(), nullptr if there are no blocks.
+   *
+   */
+  t_node_pointer m_arena{nullptr};
+
 public:
   /**
    * @brief Access to end node.
@@ -429,13 +452,24 @@ public:
   tree(tree &&other, allocator_type const &alloc);
 
   /**
-   * @brief Copy assignment operator.
+   * @brief Copy assignment operator. Reuses the nodes of *this (see copy_assign()), allocation errors are not reported.
    *
    * @param other Another tree.
    * @return tree& *this.
    */
   tree &operator=(tree const &other);
 
+  /**
+   * @brief Replaces the contents with the copy of other.
+   * The existing nodes are reused for the copied values, new nodes are allocated only when other is larger, the extra
+   * nodes are destroyed. The nodes are taken out of the tree without recursion and linked into a balanced tree in
+   * O(n) in the order of other. The nodes are not reused if the allocator is propagated and not equal.
+   *
+   * @param other Another tree.
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> Result of operation.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> copy_assign(tree const &other);
+
   /**
    * @brief Move assignment operator.
    *
@@ -448,6 +482,7 @@ public:
 
   /**
    * @brief Assing reange of unique values.
+   * The existing nodes are reused for the assigned values before any new node is allocated.
    *
    * @tparam t_forward_iterator
    * @param first
@@ -457,6 +492,7 @@ public:
 
   /**
    * @brief Assing reange of non-unique values.
+   * The existing nodes are reused for the assigned values before any new node is allocated.
    *
    * @tparam t_input_iterator
    * @param first
@@ -464,6 +500,42 @@ public:
    */
   template<class t_input_iterator> void assign_multi(t_input_iterator first, t_input_iterator last);
 
+  /**
+   * @brief Fills the empty tree with the unique values of the range [first, last).
+   * While the range is sorted, the nodes are collected in a list and linked into a balanced tree at once in O(n),
+   * without per element search and rebalancing. The rest of the range after the first out of order element is
+   * inserted one by one. Of the equivalent elements the first one is kept.
+   * Precondition: the tree is empty.
+   *
+   * @tparam t_input_iterator
+   * @param first
+   * @param last
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+   */
+  template<class t_input_iterator>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> build_unique(t_input_iterator first,
+                                                                                  t_input_iterator last) {
+    return M_build(first, last, ::portable_stl::true_type{});
+  }
+
+  /**
+   * @brief Fills the empty tree with the values of the range [first, last).
+   * While the range is sorted, the nodes are collected in a list and linked into a balanced tree at once in O(n),
+   * without per element search and rebalancing. The rest of the range after the first out of order element is
+   * inserted one by one.
+   * Precondition: the tree is empty.
+   *
+   * @tparam t_input_iterator
+   * @param first
+   * @param last
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+   */
+  template<class t_input_iterator>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> build_multi(t_input_iterator first,
+                                                                                 t_input_iterator last) {
+    return M_build(first, last, ::portable_stl::false_type{});
+  }
+
   /**
    * @brief Destructor.
    *
@@ -954,6 +1026,27 @@ public:
    */
   iterator remove_node_pointer(t_node_pointer) noexcept;
 
+  /**
+   * @brief Prepares the node to leave the tree. If the node is placed in a block made by compact(), its element is
+   * moved to a separately allocated node, which takes the place of the node in the tree.
+   *
+   * @param node_ptr the node.
+   * @return the node owning its storage or nullptr if the allocation failed.
+   */
+  t_node_pointer release_from_arena(t_node_pointer node_ptr);
+
+  /**
+   * @brief Moves all the nodes into one newly allocated block in the sorted order, so the in-order iteration walks
+   * the memory sequentially. The elements are move constructed in the new places, the old nodes are released.
+   * Invalidates all iterators, pointers and references to the elements.
+   * Nodes leaving the tree later (extract, merge into another tree, split unless their whole block leaves) are moved
+   * to separately allocated nodes.
+   *
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> error if the block allocation failed,
+   * the tree is not changed then.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> compact();
+
   /**
    * @brief
    *
@@ -1043,6 +1136,42 @@ public:
    */
   iterator erase(const_iterator first, const_iterator last);
 
+  /**
+   * @brief Moves the elements not less than key_value to the empty tree other in O(log(size())) without reallocating
+   * any node. Recounting the sizes of both trees takes O(log(size())) with tree_rank_node_policy and
+   * O(min(size(), other.size())) otherwise.
+   * If the tree has blocks made by compact(), the moved nodes are walked once: the blocks with all their nodes moved
+   * go to other along with the nodes, and only the moved nodes of the blocks shared by both trees are reallocated.
+   * UB: other is not empty or other.get_allocator() != get_allocator().
+   *
+   * @tparam t_key_type
+   * @param key_value the key to split at.
+   * @param other the empty tree to move the greater elements to.
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> error if a node reallocation failed,
+   * the elements are not moved then.
+   */
+  template<class t_key_type>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> split(t_key_type const &key_value, tree &other) {
+    if (nullptr != m_arena) {
+      auto result = M_split_arenas(lower_bound(key_value), other);
+      if (!result) {
+        return result;
+      }
+    }
+    M_split(lower_bound(key_value), other);
+    return {};
+  }
+
+  /**
+   * @brief Moves all the elements of other to this tree in O(log(size() + other.size())) without reallocating any
+   * node.
+   * UB: the elements of one tree are not all less than (or equivalent for multi tree to) the elements of the other
+   * tree or other.get_allocator() != get_allocator().
+   *
+   * @param other the tree to join.
+   */
+  void join(tree &other) noexcept;
+
   /**
    * @brief
    *
@@ -1198,6 +1327,323 @@ public:
   template<class t_key_type>
   const_iterator upper_bound(t_key_type const &key_value, t_node_pointer root, t_iter_pointer result) const;
 
+  /**
+   * @brief Returns the iterator to the element at the position index in the sorted order in O(log(size())).
+   * Requires tree_rank_node_policy.
+   *
+   * @param index the position of the element.
+   * @return iterator to the element or end() if index >= size().
+   */
+  iterator nth(size_type index) noexcept {
+    return iterator(M_nth(index));
+  }
+
+  /**
+   * @brief Returns the iterator to the element at the position index in the sorted order in O(log(size())).
+   * Requires tree_rank_node_policy.
+   *
+   * @param index the position of the element.
+   * @return const_iterator to the element or end() if index >= size().
+   */
+  const_iterator nth(size_type index) const noexcept {
+    return const_iterator(M_nth(index));
+  }
+
+  /**
+   * @brief Returns the number of elements less than key_value, i.e. the position of lower_bound(key_value), in
+   * O(log(size())).
+   * Requires tree_rank_node_policy.
+   *
+   * @tparam t_key_type
+   * @param key_value
+   * @return size_type
+   */
+  template<class t_key_type> size_type rank(t_key_type const &key_value) const;
+
+  /**
+   * @brief Writes lower_bound(key) for every key of [first, last) to out.
+   * Keys coming in ascending order are looked up by finger search from the previous result, other keys are looked up
+   * by several interleaved descents from the root with prefetch of the next nodes.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return the iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) {
+    auto write_result = [&out](typename ::portable_stl::iterator_traits<t_forward_iterator>::reference,
+                               t_iter_pointer result) {
+      *out = iterator(result);
+      ++out;
+    };
+    M_lower_bound_many(first, last, write_result);
+    return out;
+  }
+
+  /**
+   * @brief Writes lower_bound(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return the iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    auto write_result = [&out](typename ::portable_stl::iterator_traits<t_forward_iterator>::reference,
+                               t_iter_pointer result) {
+      *out = const_iterator(result);
+      ++out;
+    };
+    M_lower_bound_many(first, last, write_result);
+    return out;
+  }
+
+  /**
+   * @brief Writes find(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return the iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator find_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) {
+    auto write_result = [this, &out](typename ::portable_stl::iterator_traits<t_forward_iterator>::reference key_value,
+                                     t_iter_pointer                                                          result) {
+      *out = M_is_found(key_value, result) ? iterator(result) : end();
+      ++out;
+    };
+    M_lower_bound_many(first, last, write_result);
+    return out;
+  }
+
+  /**
+   * @brief Writes find(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return the iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator find_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    auto write_result = [this, &out](typename ::portable_stl::iterator_traits<t_forward_iterator>::reference key_value,
+                                     t_iter_pointer                                                          result) {
+      *out = M_is_found(key_value, result) ? const_iterator(result) : end();
+      ++out;
+    };
+    M_lower_bound_many(first, last, write_result);
+    return out;
+  }
+
+  /**
+   * @brief Writes for every key of [first, last) to out whether the tree contains an element equivalent to the key.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return the iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator contains_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    auto write_result = [this, &out](typename ::portable_stl::iterator_traits<t_forward_iterator>::reference key_value,
+                                     t_iter_pointer                                                          result) {
+      *out = M_is_found(key_value, result);
+      ++out;
+    };
+    M_lower_bound_many(first, last, write_result);
+    return out;
+  }
+
+  /**
+   * @brief Finds the first element not less than key_value, which is not before pos, by finger search from pos.
+   * The cost is logarithmic in the distance between pos and the result, not in the size of the tree.
+   *
+   * @tparam t_key_type
+   * @param pos the position to start from.
+   * @param key_value the looked up key.
+   * @return the first element at or after pos which is not less than key_value, or end().
+   */
+  template<class t_key_type> const_iterator lower_bound_from(const_iterator pos, t_key_type const &key_value) const {
+    t_iter_pointer result{pos.m_ptr};
+    t_node_pointer less_node{nullptr};
+    M_lower_bound_finger(key_value, result, less_node);
+    return const_iterator(result);
+  }
+
+private:
+  /**
+   * @brief Checks if the lower bound result holds the element equivalent to key_value.
+   *
+   * @tparam t_key_type
+   * @param key_value the looked up key.
+   * @param result the lower bound of key_value.
+   * @return true if the element is found, false otherwise.
+   */
+  template<class t_key_type> bool M_is_found(t_key_type const &key_value, t_iter_pointer result) const {
+    return (result != get_end_node()) && !value_comp()(key_value, static_cast<t_node_pointer>(result)->m_value);
+  }
+
+  /**
+   * @brief Finds lower bounds of the keys [first, last) and passes them to func in the order of the keys.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_function the type of the function object called as func(key, result).
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param func the function object.
+   */
+  template<class t_forward_iterator, class t_function>
+  void M_lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_function &func) const;
+
+  /**
+   * @brief Finds the lower bound of key_value starting from the previous result.
+   * The predecessor of the previous result (less_node) must be less than key_value, so the new result is not less than
+   * the previous one.
+   *
+   * @tparam t_key_type
+   * @param key_value the looked up key.
+   * @param result the previous result on input, the lower bound of key_value on output.
+   * @param less_node the greatest node less than the previously looked up key on input, the greatest node less than
+   * key_value on output, nullptr if there is no such node.
+   */
+  template<class t_key_type>
+  void M_lower_bound_finger(t_key_type const &key_value, t_iter_pointer &result, t_node_pointer &less_node) const;
+
+  /**
+   * @brief Finds the node at the position index in the sorted order using the subtree sizes.
+   *
+   * @param index the position of the element.
+   * @return the node or the end node if index >= size().
+   */
+  t_iter_pointer M_nth(size_type index) const noexcept;
+
+  /**
+   * @brief Moves the elements starting from pos to the empty tree other.
+   *
+   * @param pos the first element to move.
+   * @param other the empty tree to move the elements to.
+   */
+  void M_split(const_iterator pos, tree &other) noexcept;
+
+  /**
+   * @brief Prepares the blocks made by compact() for moving the elements starting from pos to the empty tree other:
+   * the blocks with all their nodes moved go to other, the moved nodes of the other blocks are reallocated.
+   *
+   * @param pos the first element to move.
+   * @param other the empty tree to move the elements to.
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> error if a node reallocation failed,
+   * no block is handed over then.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> M_split_arenas(iterator pos, tree &other);
+
+  /**
+   * @brief Finds the block made by compact() the node is placed in.
+   *
+   * @param node_ptr the node.
+   * @return the header of the block or nullptr if the node owns its storage.
+   */
+  t_arena_header *M_find_arena(t_node_pointer node_ptr) const noexcept {
+    for (t_node_pointer block{m_arena}; nullptr != block; block = M_arena_header(block)->m_next) {
+      if (M_arena_header(block)->contains(block, node_ptr)) {
+        return M_arena_header(block);
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Returns the header of the node block.
+   *
+   * @param block the block made by compact().
+   * @return the header placed at the beginning of the block.
+   */
+  static t_arena_header *M_arena_header(t_node_pointer block) noexcept {
+    return static_cast<t_arena_header *>(static_cast<void *>(::portable_stl::to_address(block)));
+  }
+
+  /**
+   * @brief Releases the place of the node if it is in a block made by compact().
+   *
+   * @param node_ptr the node with the destroyed element.
+   * @param free_empty true to deallocate the block when its last node is released.
+   * @return true if the node is placed in a block, false if the node owns its storage.
+   */
+  bool M_release_arena_node(t_node_pointer node_ptr, bool free_empty) noexcept;
+
+  /**
+   * @brief Deallocates the node storage or releases its place in the block made by compact().
+   *
+   * @param node_ptr the node with the destroyed element.
+   */
+  void M_deallocate_node(t_node_pointer node_ptr) noexcept {
+    if (!M_release_arena_node(node_ptr, true)) {
+      t_node_traits::deallocate(get_node_allocator(), node_ptr, 1);
+    }
+  }
+
+  /**
+   * @brief Deallocates all the blocks made by compact(). No node may be placed in them.
+   */
+  void M_free_arenas() noexcept;
+
+  /**
+   * @brief Links new_ptr into the tree in place of old_ptr, old_ptr keeps its element.
+   *
+   * @param old_ptr the node to replace.
+   * @param new_ptr the node with the element to link.
+   */
+  void M_replace_node(t_node_pointer old_ptr, t_node_pointer new_ptr) noexcept;
+
+  /**
+   * @brief Recounts the sizes of the split trees from the subtree sizes.
+   *
+   * @param other the tree with the greater elements.
+   * @param total the size of the tree before the split.
+   */
+  void M_split_size(tree &other, size_type total, ::portable_stl::true_type) noexcept {
+    other.size() = tree_ns::tree_size(other.get_end_node()->m_left);
+    size()       = total - other.size();
+  }
+
+  /**
+   * @brief Recounts the sizes of the split trees by walking both trees until the smaller one ends.
+   *
+   * @param other the tree with the greater elements.
+   * @param total the size of the tree before the split.
+   */
+  void M_split_size(tree &other, size_type total, ::portable_stl::false_type) noexcept {
+    size_type count{0U};
+    iterator  left_iter{begin()};
+    iterator  right_iter{other.begin()};
+    while ((left_iter != end()) && (right_iter != other.end())) {
+      ++left_iter;
+      ++right_iter;
+      ++count;
+    }
+    if (left_iter == end()) {
+      size()       = count;
+      other.size() = total - count;
+    } else {
+      other.size() = count;
+      size()       = total - count;
+    }
+  }
+
+public:
+
   /**
    * @brief
    *
@@ -1335,12 +1781,78 @@ private:
   ::portable_stl::expected<t_node_holder, ::portable_stl::portable_stl_error> create_node(t_args &&...args);
 
   /**
-   * @brief
+   * @brief Destroys the subtree rooted at node_ptr without recursion, the nodes are released in batches.
    *
-   * @param node_ptr
+   * @param node_ptr the root of the subtree.
    */
   void destroy(t_node_pointer node_ptr) noexcept;
 
+  /**
+   * @brief Implementation of build_unique and build_multi.
+   *
+   * @tparam t_input_iterator
+   * @tparam t_unique true_type for unique values.
+   * @param first
+   * @param last
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+   */
+  template<class t_input_iterator, class t_unique>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> M_build(t_input_iterator first,
+                                                                             t_input_iterator last,
+                                                                             t_unique);
+
+  /**
+   * @brief Compares the key of value with the node value.
+   *
+   * @tparam t_key_type
+   * @param node_value the node value.
+   * @param key the key.
+   * @return 1 if the key is greater than the node value, -1 if it is less, 0 if they are equivalent.
+   */
+  template<class t_key_type>
+  int M_build_order(t_node_value_type const &node_value,
+                    t_key_type const        &key,
+                    ::portable_stl::extract_key_self_tag) const {
+    if (value_comp()(node_value, key)) {
+      return 1;
+    }
+    return value_comp()(key, node_value) ? -1 : 0;
+  }
+
+  /**
+   * @brief Compares the key of value with the node value.
+   *
+   * @tparam t_pair_type
+   * @param node_value the node value.
+   * @param value the pair of the key and the mapped value.
+   * @return 1 if the key is greater than the node value, -1 if it is less, 0 if they are equivalent.
+   */
+  template<class t_pair_type>
+  int M_build_order(t_node_value_type const &node_value,
+                    t_pair_type const       &value,
+                    ::portable_stl::extract_key_first_tag) const {
+    return M_build_order(node_value, ::portable_stl::get<0>(value), ::portable_stl::extract_key_self_tag{});
+  }
+
+  /**
+   * @brief The key can't be extracted from value, it is compared after the node construction.
+   *
+   * @tparam t_value_type
+   * @return 1.
+   */
+  template<class t_value_type>
+  int M_build_order(t_node_value_type const &, t_value_type const &, ::portable_stl::extract_key_fail_tag) const {
+    return 1;
+  }
+
+  /**
+   * @brief Links the sorted list of nodes into the empty tree as a balanced tree.
+   *
+   * @param list the sorted list of nodes, linked by m_right.
+   * @param num the number of nodes in the list.
+   */
+  void M_attach_sorted(t_node_base_pointer list, size_type num) noexcept;
+
   /**
    * @brief
    *
@@ -1452,12 +1964,10 @@ private:
      *
      */
     ~detached_tree_cache() {
-      m_tree->destroy(m_cache_elem);
-      if (m_cache_root) {
-        while (m_cache_root->m_parent != nullptr) {
-          m_cache_root = static_cast<t_node_pointer>(m_cache_root->m_parent);
-        }
-        m_tree->destroy(m_cache_root);
+      // the unused nodes are detached leaf by leaf, so no recursion is needed
+      while (m_cache_elem != nullptr) {
+        m_tree->destroy(m_cache_elem);
+        M_advance();
       }
     }
 
@@ -1509,8 +2019,8 @@ private:
     t_node_pointer m_cache_elem;
   };
 
-  template<class, class, class, class> friend class map;
-  template<class, class, class, class> friend class multimap;
+  template<class, class, class, class, class> friend class map;
+  template<class, class, class, class, class> friend class multimap;
 };
 
 /**
@@ -1519,10 +2029,11 @@ private:
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param comp
  */
-template<class t_type, class t_compare, class t_allocator>
-tree<t_type, t_compare, t_allocator>::tree(value_compare const &comp) noexcept(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy>::tree(value_compare const &comp) noexcept(
   ::portable_stl::is_nothrow_default_constructible<t_node_allocator>{}()
   && ::portable_stl::is_nothrow_copy_constructible<value_compare>{}())
     : m_pair3(0U, comp) {
@@ -1535,10 +2046,11 @@ tree<t_type, t_compare, t_allocator>::tree(value_compare const &comp) noexcept(
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param alloc
  */
-template<class t_type, class t_compare, class t_allocator>
-tree<t_type, t_compare, t_allocator>::tree(allocator_type const &alloc)
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy>::tree(allocator_type const &alloc)
     : m_begin_node(t_iter_pointer())
     , m_pair1(::portable_stl::second_tag_t{}, t_node_allocator(alloc))
     , m_pair3(0U, value_compare()) {
@@ -1551,11 +2063,12 @@ tree<t_type, t_compare, t_allocator>::tree(allocator_type const &alloc)
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param comp
  * @param alloc
  */
-template<class t_type, class t_compare, class t_allocator>
-tree<t_type, t_compare, t_allocator>::tree(value_compare const &comp, allocator_type const &alloc)
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy>::tree(value_compare const &comp, allocator_type const &alloc)
     : m_begin_node(t_iter_pointer())
     , m_pair1(::portable_stl::second_tag_t{}, t_node_allocator(alloc))
     , m_pair3(0U, comp) {
@@ -1569,12 +2082,13 @@ tree<t_type, t_compare, t_allocator>::tree(value_compare const &comp, allocator_
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param tree
- * @return tree<t_type, t_compare, t_allocator>::t_node_pointer
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_pointer
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::t_node_pointer
-  tree<t_type, t_compare, t_allocator>::detached_tree_cache::detach_from_tree(tree *tree) noexcept {
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_pointer
+  tree<t_type, t_compare, t_allocator, t_node_policy>::detached_tree_cache::detach_from_tree(tree *tree) noexcept {
   t_node_pointer cache                   = static_cast<t_node_pointer>(tree->get_begin_node());
   tree->get_begin_node()                 = tree->get_end_node();
   tree->get_end_node()->m_left->m_parent = nullptr;
@@ -1596,12 +2110,14 @@ typename tree<t_type, t_compare, t_allocator>::t_node_pointer
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param cache
- * @return tree<t_type, t_compare, t_allocator>::t_node_pointer
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_pointer
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::t_node_pointer
-  tree<t_type, t_compare, t_allocator>::detached_tree_cache::M_detach_next(t_node_pointer cache) noexcept {
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_pointer
+  tree<t_type, t_compare, t_allocator, t_node_policy>::detached_tree_cache::M_detach_next(
+    t_node_pointer cache) noexcept {
   if (nullptr == cache->m_parent) {
     return nullptr;
   }
@@ -1628,32 +2144,92 @@ typename tree<t_type, t_compare, t_allocator>::t_node_pointer
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param other
- * @return tree<t_type, t_compare, t_allocator>&
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>&
  */
-template<class t_type, class t_compare, class t_allocator>
-tree<t_type, t_compare, t_allocator> &tree<t_type, t_compare, t_allocator>::operator=(tree const &other) {
-  if (this != ::portable_stl::addressof(other)) {
-    value_comp() = other.value_comp();
-    copy_assign_alloc(other);
-    assign_multi(other.begin(), other.end());
-  }
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy> &
+  tree<t_type, t_compare, t_allocator, t_node_policy>::operator=(tree const &other) {
+  static_cast<void>(copy_assign(other));
   return *this;
 }
 
+/**
+ * @brief Replaces the contents with the copy of other.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param other
+ * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::copy_assign(tree const &other) {
+  if (this == ::portable_stl::addressof(other)) {
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+  value_comp() = other.value_comp();
+  copy_assign_alloc(other);
+
+  // other is sorted, so the nodes are collected in a list and linked into a balanced tree at once,
+  // the list is linked also if the value assignment throws
+  t_node_base_pointer list{nullptr};
+  t_node_base_pointer list_tail{nullptr};
+  size_type           list_size{0U};
+  auto                append = [&list, &list_tail, &list_size](t_node_base_pointer node) noexcept {
+    node->m_right = nullptr;
+    if (nullptr == list_tail) {
+      list = node;
+    } else {
+      list_tail->m_right = node;
+    }
+    list_tail = node;
+    ++list_size;
+  };
+  auto guard = ::portable_stl::make_exception_guard([this, &list, &list_size]() { M_attach_sorted(list, list_size); });
+
+  const_iterator first{other.begin()};
+  const_iterator last{other.end()};
+  if (0U != size()) {
+    detached_tree_cache cache(this);
+    for (; (cache.get_cache_elem() != nullptr) && (first != last); ++first) {
+      cache.get_cache_elem()->m_value = *first;
+      append(static_cast<t_node_base_pointer>(cache.get_cache_elem()));
+      cache.M_advance();
+    }
+  }
+  for (; first != last; ++first) {
+    auto result = create_node(t_node_types::get_value(*first));
+    if (!result) {
+      guard.commit();
+      M_attach_sorted(list, list_size);
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    append(static_cast<t_node_base_pointer>(result.value().release()));
+  }
+  guard.commit();
+  M_attach_sorted(list, list_size);
+  return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+}
+
 /**
  * @brief
  *
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_forward_iterator
  * @param first
  * @param last
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_forward_iterator>
-void tree<t_type, t_compare, t_allocator>::assign_unique(t_forward_iterator first, t_forward_iterator last) {
+void tree<t_type, t_compare, t_allocator, t_node_policy>::assign_unique(t_forward_iterator first,
+                                                                        t_forward_iterator last) {
   using _ITraits     = iterator_traits<t_forward_iterator>;
   using _ItValueType = typename _ITraits::value_type;
   static_assert(::portable_stl::is_same<_ItValueType, t_container_value_type>{}(),
@@ -1679,13 +2255,14 @@ void tree<t_type, t_compare, t_allocator>::assign_unique(t_forward_iterator firs
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_input_iterator
  * @param first
  * @param last
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_input_iterator>
-void tree<t_type, t_compare, t_allocator>::assign_multi(t_input_iterator first, t_input_iterator last) {
+void tree<t_type, t_compare, t_allocator, t_node_policy>::assign_multi(t_input_iterator first, t_input_iterator last) {
   using _ITraits     = iterator_traits<t_input_iterator>;
   using _ItValueType = typename _ITraits::value_type;
   static_assert((::portable_stl::is_same<_ItValueType, t_container_value_type>{}()
@@ -1710,10 +2287,11 @@ void tree<t_type, t_compare, t_allocator>::assign_multi(t_input_iterator first,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param other
  */
-template<class t_type, class t_compare, class t_allocator>
-tree<t_type, t_compare, t_allocator>::tree(tree const &other)
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy>::tree(tree const &other)
     : m_begin_node(t_iter_pointer())
     , m_pair1(::portable_stl::second_tag_t{},
               t_node_traits::select_on_container_copy_construction(other.get_node_allocator()))
@@ -1727,15 +2305,18 @@ tree<t_type, t_compare, t_allocator>::tree(tree const &other)
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param other
  */
-template<class t_type, class t_compare, class t_allocator>
-tree<t_type, t_compare, t_allocator>::tree(tree &&other) noexcept(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy>::tree(tree &&other) noexcept(
   ::portable_stl::is_nothrow_move_constructible<t_node_allocator>{}()
   && ::portable_stl::is_nothrow_move_constructible<value_compare>{}())
     : m_begin_node(::portable_stl::move(other.m_begin_node))
     , m_pair1(::portable_stl::move(other.m_pair1))
-    , m_pair3(::portable_stl::move(other.m_pair3)) {
+    , m_pair3(::portable_stl::move(other.m_pair3))
+    , m_arena(other.m_arena) {
+  other.m_arena = nullptr;
   if (0 == size()) {
     get_begin_node() = get_end_node();
   } else {
@@ -1752,11 +2333,12 @@ tree<t_type, t_compare, t_allocator>::tree(tree &&other) noexcept(
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param other
  * @param alloc
  */
-template<class t_type, class t_compare, class t_allocator>
-tree<t_type, t_compare, t_allocator>::tree(tree &&other, allocator_type const &alloc)
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy>::tree(tree &&other, allocator_type const &alloc)
     : m_pair1(::portable_stl::second_tag_t{}, t_node_allocator(alloc))
     , m_pair3(0U, ::portable_stl::move(other.value_comp())) {
   if (alloc == other.get_alloc()) {
@@ -1767,9 +2349,11 @@ tree<t_type, t_compare, t_allocator>::tree(tree &&other, allocator_type const &a
       get_end_node()->m_left           = other.get_end_node()->m_left;
       get_end_node()->m_left->m_parent = static_cast<t_parent_pointer>(get_end_node());
       size()                           = other.size();
+      m_arena                          = other.m_arena;
       other.get_begin_node()           = other.get_end_node();
       other.get_end_node()->m_left     = nullptr;
       other.size()                     = 0;
+      other.m_arena                    = nullptr;
     }
   } else {
     get_begin_node() = get_end_node();
@@ -1782,17 +2366,21 @@ tree<t_type, t_compare, t_allocator>::tree(tree &&other, allocator_type const &a
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param other
  */
-template<class t_type, class t_compare, class t_allocator>
-void tree<t_type, t_compare, t_allocator>::move_assign(tree &other, true_type) noexcept(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::move_assign(tree &other, true_type) noexcept(
   ::portable_stl::is_nothrow_move_assignable<value_compare>{}()
   && ::portable_stl::is_nothrow_move_assignable<t_node_allocator>{}()) {
   destroy(static_cast<t_node_pointer>(get_end_node()->m_left));
+  M_free_arenas();
   m_begin_node        = other.m_begin_node;
   m_pair1.get_first() = other.m_pair1.get_first();
   move_assign_alloc(other);
-  m_pair3 = ::portable_stl::move(other.m_pair3);
+  m_pair3       = ::portable_stl::move(other.m_pair3);
+  m_arena       = other.m_arena;
+  other.m_arena = nullptr;
   if (0 == size()) {
     get_begin_node() = get_end_node();
   } else {
@@ -1809,10 +2397,11 @@ void tree<t_type, t_compare, t_allocator>::move_assign(tree &other, true_type) n
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param other
  */
-template<class t_type, class t_compare, class t_allocator>
-void tree<t_type, t_compare, t_allocator>::move_assign(tree &other, false_type) {
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::move_assign(tree &other, false_type) {
   if (get_node_allocator() == other.get_node_allocator()) {
     move_assign(other, true_type());
   } else {
@@ -1838,11 +2427,13 @@ void tree<t_type, t_compare, t_allocator>::move_assign(tree &other, false_type)
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param other
- * @return tree<t_type, t_compare, t_allocator>&
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>&
  */
-template<class t_type, class t_compare, class t_allocator>
-tree<t_type, t_compare, t_allocator> &tree<t_type, t_compare, t_allocator>::operator=(tree &&other) noexcept(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy> &
+  tree<t_type, t_compare, t_allocator, t_node_policy>::operator=(tree &&other) noexcept(
   typename t_node_traits::propagate_on_container_move_assignment{}()
   && ::portable_stl::is_nothrow_move_assignable<value_compare>{}()
   && ::portable_stl::is_nothrow_move_assignable<t_node_allocator>{}()) {
@@ -1851,21 +2442,167 @@ tree<t_type, t_compare, t_allocator> &tree<t_type, t_compare, t_allocator>::oper
 }
 
 /**
- * @brief
+ * @brief Destroys the subtree rooted at node_ptr.
+ * The subtree is taken apart without recursion: the left child is rotated up until the current node has no left
+ * child, then the node is destroyed and the walk continues with its right child. The released nodes are passed to
+ * the allocator in batches (see allocator_traits::deallocate_bulk).
  *
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
- * @param node_ptr
+ * @tparam t_node_policy
+ * @param node_ptr the root of the subtree.
  */
-template<class t_type, class t_compare, class t_allocator>
-void tree<t_type, t_compare, t_allocator>::destroy(t_node_pointer node_ptr) noexcept {
-  if (node_ptr != nullptr) {
-    destroy(static_cast<t_node_pointer>(node_ptr->m_left));
-    destroy(static_cast<t_node_pointer>(node_ptr->m_right));
-    t_node_allocator &node_alloc = get_node_allocator();
-    t_node_traits::destroy(node_alloc, t_node_types::get_ptr(node_ptr->m_value));
-    t_node_traits::deallocate(node_alloc, node_ptr, 1);
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::destroy(t_node_pointer node_ptr) noexcept {
+  constexpr size_type batch_size{64U};
+  t_node_pointer      batch[batch_size];
+  size_type           batch_count{0U};
+  t_node_allocator   &node_alloc = get_node_allocator();
+
+  while (node_ptr != nullptr) {
+    if (node_ptr->m_left != nullptr) {
+      t_node_pointer left_ptr = static_cast<t_node_pointer>(node_ptr->m_left);
+      node_ptr->m_left        = left_ptr->m_right;
+      left_ptr->m_right       = node_ptr;
+      node_ptr                = left_ptr;
+    } else {
+      t_node_pointer next_ptr = static_cast<t_node_pointer>(node_ptr->m_right);
+      t_node_traits::destroy(node_alloc, t_node_types::get_ptr(node_ptr->m_value));
+      if (!M_release_arena_node(node_ptr, true)) {
+        batch[batch_count] = node_ptr;
+        ++batch_count;
+        if (batch_size == batch_count) {
+          t_node_traits::deallocate_bulk(node_alloc, batch, batch_count, 1);
+          batch_count = 0U;
+        }
+      }
+      node_ptr = next_ptr;
+    }
+  }
+  if (0U != batch_count) {
+    t_node_traits::deallocate_bulk(node_alloc, batch, batch_count, 1);
+  }
+}
+
+/**
+ * @brief Implementation of build_unique and build_multi.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @tparam t_input_iterator
+ * @tparam t_unique
+ * @param first
+ * @param last
+ * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+template<class t_input_iterator, class t_unique>
+::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::M_build(
+  t_input_iterator first, t_input_iterator last, t_unique) {
+  /**
+   * @brief Key extraction tag of the range values.
+   */
+  using t_extract_tag = typename ::portable_stl::can_extract_key<decltype(*first), key_type>::type;
+
+  // sorted prefix of the range
+  t_node_base_pointer list{nullptr};
+  t_node_base_pointer list_tail{nullptr};
+  size_type           list_size{0U};
+  bool                sorted{true};
+
+  for (; first != last; ++first) {
+    if (sorted && (nullptr != list_tail)) {
+      // the key is compared before the node allocation, if it can be extracted from the value
+      int const order{M_build_order(static_cast<t_node_pointer>(list_tail)->m_value, *first, t_extract_tag{})};
+      if ((0 == order) && t_unique{}()) {
+        continue;
+      }
+      if (order < 0) {
+        M_attach_sorted(list, list_size);
+        sorted = false;
+      }
+    }
+
+    if (sorted) {
+      auto result = create_node(*first);
+      if (!result) {
+        M_attach_sorted(list, list_size);
+        return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+      }
+      t_node_holder node_holder{::portable_stl::move(result.value())};
+
+      // the key could not be extracted from the value, so it is compared now
+      int const order{
+        ((nullptr == list_tail) || !::portable_stl::is_same<t_extract_tag, ::portable_stl::extract_key_fail_tag>{}())
+          ? 1
+          : M_build_order(static_cast<t_node_pointer>(list_tail)->m_value,
+                          t_node_types::get_key(node_holder->m_value),
+                          ::portable_stl::extract_key_self_tag{})};
+      if ((0 == order) && t_unique{}()) {
+        continue;
+      }
+      if (order >= 0) {
+        t_node_base_pointer const node{static_cast<t_node_base_pointer>(node_holder.release())};
+        node->m_right = nullptr;
+        if (nullptr == list_tail) {
+          list = node;
+        } else {
+          list_tail->m_right = node;
+        }
+        list_tail = node;
+        ++list_size;
+        continue;
+      }
+      // out of order, the rest of the range is inserted one by one
+      M_attach_sorted(list, list_size);
+      sorted = false;
+      if (t_unique{}()) {
+        t_parent_pointer     parent;
+        t_node_base_pointer &child = find_equal(parent, node_holder->m_value);
+        if (nullptr == child) {
+          insert_node_at(parent, child, static_cast<t_node_base_pointer>(node_holder.release()));
+        }
+      } else {
+        static_cast<void>(node_insert_multi(node_holder.release()));
+      }
+      continue;
+    }
+
+    auto result = t_unique{}() ? insert_unique(end(), *first) : insert_multi(end(), *first);
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+  }
+
+  if (sorted) {
+    M_attach_sorted(list, list_size);
+  }
+  return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+}
+
+/**
+ * @brief Links the sorted list of nodes into the empty tree as a balanced tree.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param list
+ * @param num
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::M_attach_sorted(t_node_base_pointer list,
+                                                                          size_type           num) noexcept {
+  if (0U != num) {
+    t_node_base_pointer root = tree_ns::tree_build_balanced(list, num);
+    root->m_parent           = static_cast<t_parent_pointer>(get_end_node());
+    get_end_node()->m_left   = root;
+    get_begin_node()         = static_cast<t_iter_pointer>(tree_ns::tree_min(root));
+    size()                   = num;
   }
 }
 
@@ -1875,10 +2612,13 @@ void tree<t_type, t_compare, t_allocator>::destroy(t_node_pointer node_ptr) noex
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  */
-template<class t_type, class t_compare, class t_allocator> tree<t_type, t_compare, t_allocator>::~tree() {
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+tree<t_type, t_compare, t_allocator, t_node_policy>::~tree() {
   static_assert(::portable_stl::is_copy_constructible<value_compare>{}(), "Comparator must be copy-constructible.");
   destroy(get_root());
+  M_free_arenas();
 }
 
 /**
@@ -1887,16 +2627,18 @@ template<class t_type, class t_compare, class t_allocator> tree<t_type, t_compar
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param other
  */
-template<class t_type, class t_compare, class t_allocator>
-void tree<t_type, t_compare, t_allocator>::swap(tree &other) noexcept(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::swap(tree &other) noexcept(
   ::portable_stl::is_nothrow_swappable<value_compare>{}()) {
   using ::portable_stl::swap;
   swap(m_begin_node, other.m_begin_node);
   swap(m_pair1.get_first(), other.m_pair1.get_first());
   ::portable_stl::swap_allocator(get_node_allocator(), other.get_node_allocator());
   m_pair3.swap(other.m_pair3);
+  swap(m_arena, other.m_arena);
   if (0 == size()) {
     get_begin_node() = get_end_node();
   } else {
@@ -1915,9 +2657,12 @@ void tree<t_type, t_compare, t_allocator>::swap(tree &other) noexcept(
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  */
-template<class t_type, class t_compare, class t_allocator> void tree<t_type, t_compare, t_allocator>::clear() noexcept {
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::clear() noexcept {
   destroy(get_root());
+  M_free_arenas();
   size()                 = 0;
   get_begin_node()       = get_end_node();
   get_end_node()->m_left = nullptr;
@@ -1930,12 +2675,14 @@ template<class t_type, class t_compare, class t_allocator> void tree<t_type, t_c
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param parent
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::t_node_base_pointer& Reference to null leaf.
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer& Reference to null leaf.
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &tree<t_type, t_compare, t_allocator>::find_leaf_low(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer &
+  tree<t_type, t_compare, t_allocator, t_node_policy>::find_leaf_low(
   t_parent_pointer &parent, key_type const &key_value) {
   t_node_pointer node_ptr{get_root()};
   if (node_ptr != nullptr) {
@@ -1968,13 +2715,15 @@ typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &tree<t_type,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param parent
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::t_node_base_pointer& Reference to null leaf.
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer& Reference to null leaf.
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &
-  tree<t_type, t_compare, t_allocator>::find_leaf_high(t_parent_pointer &parent, key_type const &key_value) {
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer &
+  tree<t_type, t_compare, t_allocator, t_node_policy>::find_leaf_high(
+    t_parent_pointer &parent, key_type const &key_value) {
   t_node_pointer node_ptr{get_root()};
   if (node_ptr != nullptr) {
     while (true) {
@@ -2007,13 +2756,15 @@ typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param hint_pos
  * @param parent
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::t_node_base_pointer& Reference to null leaf
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer& Reference to null leaf
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &tree<t_type, t_compare, t_allocator>::find_leaf(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer &
+  tree<t_type, t_compare, t_allocator, t_node_policy>::find_leaf(
   const_iterator hint_pos, t_parent_pointer &parent, key_type const &key_value) {
   if ((end() == hint_pos) || !value_comp()(*hint_pos, key_value)) // check before
   {
@@ -2043,15 +2794,17 @@ typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &tree<t_type,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param parent
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::t_node_base_pointer& If key_value exists, return reference to node of
- * key_value, otherwise reference to null leaf.
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer& If key_value exists, return
+ * reference to node of key_value, otherwise reference to null leaf.
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &tree<t_type, t_compare, t_allocator>::find_equal(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer &
+  tree<t_type, t_compare, t_allocator, t_node_policy>::find_equal(
   t_parent_pointer &parent, t_key_type const &key_value) {
   t_node_pointer       nd{get_root()};
   t_node_base_pointer *nd_ptr{get_root_ptr()};
@@ -2092,17 +2845,19 @@ typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &tree<t_type,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param hint_pos
  * @param parent
  * @param dummy
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::t_node_base_pointer& If key_value exists, return reference to node of
- * key_value, otherwise reference to null leaf.
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer& If key_value exists, return
+ * reference to node of key_value, otherwise reference to null leaf.
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &tree<t_type, t_compare, t_allocator>::find_equal(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_base_pointer &
+  tree<t_type, t_compare, t_allocator, t_node_policy>::find_equal(
   const_iterator hint_pos, t_parent_pointer &parent, t_node_base_pointer &dummy, t_key_type const &key_value) {
   if ((end() == hint_pos) || value_comp()(key_value, *hint_pos)) // check before
   {
@@ -2149,12 +2904,13 @@ typename tree<t_type, t_compare, t_allocator>::t_node_base_pointer &tree<t_type,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param parent
  * @param child
  * @param inserted_node
  */
-template<class t_type, class t_compare, class t_allocator>
-void tree<t_type, t_compare, t_allocator>::insert_node_at(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::insert_node_at(
   t_parent_pointer parent, t_node_base_pointer &child, t_node_base_pointer inserted_node) noexcept {
   inserted_node->m_left   = nullptr;
   inserted_node->m_right  = nullptr;
@@ -2174,16 +2930,17 @@ void tree<t_type, t_compare, t_allocator>::insert_node_at(
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_args
  * @param args Arguments to create node value with.
- * @return ::portable_stl::expected<typename tree<t_type, t_compare, t_allocator>::t_node_holder,
+ * @return ::portable_stl::expected<typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_holder,
  * ::portable_stl::portable_stl_error>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class... t_args>
-::portable_stl::expected<typename tree<t_type, t_compare, t_allocator>::t_node_holder,
+::portable_stl::expected<typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_holder,
                          ::portable_stl::portable_stl_error>
-  tree<t_type, t_compare, t_allocator>::create_node(t_args &&...args) {
+  tree<t_type, t_compare, t_allocator, t_node_policy>::create_node(t_args &&...args) {
   static_assert(!typename ::portable_stl::tree_helper::is_tree_value_type<t_args...>::type{}(),
                 "Cannot construct from value_type_impl");
 
@@ -2210,19 +2967,22 @@ template<class... t_args>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @tparam t_args
  * @param key_value
  * @param args
- * @return ::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator,
- * bool>,
+ * @return ::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator,
+ * t_node_policy>::iterator, bool>,
  * ::portable_stl::portable_stl_error>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type, class... t_args>
-::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator, bool>,
+::portable_stl::expected<::portable_stl::tuple<typename
+  tree<t_type, t_compare, t_allocator, t_node_policy>::iterator, bool>,
                          ::portable_stl::portable_stl_error>
-  tree<t_type, t_compare, t_allocator>::emplace_unique_key_args(t_key_type const &key_value, t_args &&...args) {
+  tree<t_type, t_compare, t_allocator, t_node_policy>::emplace_unique_key_args(
+    t_key_type const &key_value, t_args &&...args) {
   t_parent_pointer     parent;
   t_node_base_pointer &child    = find_equal(parent, key_value);
   t_node_pointer       ret      = static_cast<t_node_pointer>(child);
@@ -2248,20 +3008,22 @@ template<class t_key_type, class... t_args>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @tparam t_args
  * @param hint_pos
  * @param key_value
  * @param args
- * @return ::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator,
- * bool>,
+ * @return ::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator,
+ * t_node_policy>::iterator, bool>,
  * ::portable_stl::portable_stl_error>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type, class... t_args>
-::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator, bool>,
+::portable_stl::expected<::portable_stl::tuple<typename
+  tree<t_type, t_compare, t_allocator, t_node_policy>::iterator, bool>,
                          ::portable_stl::portable_stl_error>
-  tree<t_type, t_compare, t_allocator>::emplace_hint_unique_key_args(
+  tree<t_type, t_compare, t_allocator, t_node_policy>::emplace_hint_unique_key_args(
     const_iterator hint_pos, t_key_type const &key_value, t_args &&...args) {
   t_parent_pointer     parent;
   t_node_base_pointer  dummy;
@@ -2288,17 +3050,19 @@ template<class t_key_type, class... t_args>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_args
  * @param args
- * @return ::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator,
- * bool>,
+ * @return ::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator,
+ * t_node_policy>::iterator, bool>,
  * ::portable_stl::portable_stl_error>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class... t_args>
-::portable_stl::expected<::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator, bool>,
+::portable_stl::expected<::portable_stl::tuple<typename
+  tree<t_type, t_compare, t_allocator, t_node_policy>::iterator, bool>,
                          ::portable_stl::portable_stl_error>
-  tree<t_type, t_compare, t_allocator>::emplace_unique_impl(t_args &&...args) {
+  tree<t_type, t_compare, t_allocator, t_node_policy>::emplace_unique_impl(t_args &&...args) {
   auto result = create_node(::portable_stl::forward<t_args>(args)...);
   if (!result) {
     return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
@@ -2323,16 +3087,19 @@ template<class... t_args>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_args
  * @param hint_pos
  * @param args
- * @return ::portable_stl::expected<typename tree<t_type, t_compare, t_allocator>::iterator,
+ * @return ::portable_stl::expected<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator,
  * ::portable_stl::portable_stl_error>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class... t_args>
-::portable_stl::expected<typename tree<t_type, t_compare, t_allocator>::iterator, ::portable_stl::portable_stl_error>
-  tree<t_type, t_compare, t_allocator>::emplace_hint_unique_impl(const_iterator hint_pos, t_args &&...args) {
+::portable_stl::expected<typename
+  tree<t_type, t_compare, t_allocator, t_node_policy>::iterator, ::portable_stl::portable_stl_error>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::emplace_hint_unique_impl(
+    const_iterator hint_pos, t_args &&...args) {
   auto result = create_node(::portable_stl::forward<t_args>(args)...);
   if (!result) {
     return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
@@ -2355,15 +3122,17 @@ template<class... t_args>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_args
  * @param args
- * @return ::portable_stl::expected<typename tree<t_type, t_compare, t_allocator>::iterator,
+ * @return ::portable_stl::expected<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator,
  * ::portable_stl::portable_stl_error>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class... t_args>
-::portable_stl::expected<typename tree<t_type, t_compare, t_allocator>::iterator, ::portable_stl::portable_stl_error>
-  tree<t_type, t_compare, t_allocator>::emplace_multi(t_args &&...args) {
+::portable_stl::expected<typename
+  tree<t_type, t_compare, t_allocator, t_node_policy>::iterator, ::portable_stl::portable_stl_error>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::emplace_multi(t_args &&...args) {
   auto result = create_node(::portable_stl::forward<t_args>(args)...);
   if (!result) {
     return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
@@ -2383,16 +3152,18 @@ template<class... t_args>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_args
  * @param hint_pos
  * @param args
- * @return ::portable_stl::expected<typename tree<t_type, t_compare, t_allocator>::iterator,
+ * @return ::portable_stl::expected<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator,
  * ::portable_stl::portable_stl_error>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class... t_args>
-::portable_stl::expected<typename tree<t_type, t_compare, t_allocator>::iterator, ::portable_stl::portable_stl_error>
-  tree<t_type, t_compare, t_allocator>::emplace_hint_multi(const_iterator hint_pos, t_args &&...args) {
+::portable_stl::expected<typename
+  tree<t_type, t_compare, t_allocator, t_node_policy>::iterator, ::portable_stl::portable_stl_error>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::emplace_hint_multi(const_iterator hint_pos, t_args &&...args) {
   auto result = create_node(::portable_stl::forward<t_args>(args)...);
   if (!result) {
     return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
@@ -2412,13 +3183,14 @@ template<class... t_args>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param value
  * @param dest_node_ptr
- * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator, bool>
+ * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator, bool>
  */
-template<class t_type, class t_compare, class t_allocator>
-::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator, bool>
-  tree<t_type, t_compare, t_allocator>::node_assign_unique(t_container_value_type const &value,
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator, bool>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::node_assign_unique(t_container_value_type const &value,
                                                            t_node_pointer                dest_node_ptr) {
   t_parent_pointer     parent;
   t_node_base_pointer &child{find_equal(parent, t_node_types::get_key(value))};
@@ -2439,11 +3211,13 @@ template<class t_type, class t_compare, class t_allocator>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param node_ptr
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::node_insert_multi(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::node_insert_multi(
   t_node_pointer node_ptr) {
   t_parent_pointer     parent;
   t_node_base_pointer &child = find_leaf_high(parent, t_node_types::get_key(node_ptr->m_value));
@@ -2457,12 +3231,14 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param pos
  * @param node_ptr
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::node_insert_multi(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::node_insert_multi(
   const_iterator pos, t_node_pointer node_ptr) {
   t_parent_pointer     parent;
   t_node_base_pointer &child = find_leaf(pos, parent, t_node_types::get_key(node_ptr->m_value));
@@ -2476,11 +3252,13 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param node_ptr
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::remove_node_pointer(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::remove_node_pointer(
   t_node_pointer node_ptr) noexcept {
   iterator ret(node_ptr);
   ++ret;
@@ -2498,14 +3276,16 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_node_handle
  * @tparam t_insert_return_type
  * @param node_hdl
  * @return t_insert_return_type
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_node_handle, class t_insert_return_type>
-t_insert_return_type tree<t_type, t_compare, t_allocator>::node_handle_insert_unique(t_node_handle &&node_hdl) {
+t_insert_return_type
+  tree<t_type, t_compare, t_allocator, t_node_policy>::node_handle_insert_unique(t_node_handle &&node_hdl) {
   if (node_hdl.empty()) {
     return t_insert_return_type{end(), false, t_node_handle()};
   }
@@ -2528,14 +3308,16 @@ t_insert_return_type tree<t_type, t_compare, t_allocator>::node_handle_insert_un
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_node_handle
  * @param hint_pos
  * @param node_hdl
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_node_handle>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::node_handle_insert_unique(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::node_handle_insert_unique(
   const_iterator hint_pos, t_node_handle &&node_hdl) {
   if (node_hdl.empty()) {
     return end();
@@ -2560,13 +3342,14 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_node_handle
  * @param key
  * @return t_node_handle
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_node_handle>
-t_node_handle tree<t_type, t_compare, t_allocator>::node_handle_extract(key_type const &key) {
+t_node_handle tree<t_type, t_compare, t_allocator, t_node_policy>::node_handle_extract(key_type const &key) {
   iterator iter = find(key);
   if (iter == end()) {
     return t_node_handle();
@@ -2580,14 +3363,18 @@ t_node_handle tree<t_type, t_compare, t_allocator>::node_handle_extract(key_type
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_node_handle
  * @param pos
  * @return t_node_handle
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_node_handle>
-t_node_handle tree<t_type, t_compare, t_allocator>::node_handle_extract(const_iterator pos) {
-  t_node_pointer node_ptr = pos.get_node_pointer();
+t_node_handle tree<t_type, t_compare, t_allocator, t_node_policy>::node_handle_extract(const_iterator pos) {
+  t_node_pointer node_ptr = release_from_arena(pos.get_node_pointer());
+  if (nullptr == node_ptr) {
+    return t_node_handle();
+  }
   remove_node_pointer(node_ptr);
   return t_node_handle(node_ptr, get_alloc());
 }
@@ -2598,12 +3385,13 @@ t_node_handle tree<t_type, t_compare, t_allocator>::node_handle_extract(const_it
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_tree
  * @param src_tree
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_tree>
-void tree<t_type, t_compare, t_allocator>::node_handle_merge_unique(t_tree &src_tree) {
+void tree<t_type, t_compare, t_allocator, t_node_policy>::node_handle_merge_unique(t_tree &src_tree) {
   static_assert(::portable_stl::is_same<typename t_tree::t_node_pointer, t_node_pointer>{}(), "");
 
   for (typename t_tree::iterator iter{src_tree.begin()}; iter != src_tree.end();) {
@@ -2614,6 +3402,10 @@ void tree<t_type, t_compare, t_allocator>::node_handle_merge_unique(t_tree &src_
     if (child != nullptr) {
       continue;
     }
+    src_ptr = src_tree.release_from_arena(src_ptr);
+    if (nullptr == src_ptr) {
+      continue;
+    }
     src_tree.remove_node_pointer(src_ptr);
     insert_node_at(parent, child, static_cast<t_node_base_pointer>(src_ptr));
   }
@@ -2625,13 +3417,15 @@ void tree<t_type, t_compare, t_allocator>::node_handle_merge_unique(t_tree &src_
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_node_handle
  * @param node_hdl
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_node_handle>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::node_handle_insert_multi(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::node_handle_insert_multi(
   t_node_handle &&node_hdl) {
   if (node_hdl.empty()) {
     return end();
@@ -2650,14 +3444,16 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_node_handle
  * @param hint_pos
  * @param node_hdl
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_node_handle>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::node_handle_insert_multi(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::node_handle_insert_multi(
   const_iterator hint_pos, t_node_handle &&node_hdl) {
   if (node_hdl.empty()) {
     return end();
@@ -2677,19 +3473,24 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_tree
  * @param src_tree
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_tree>
-void tree<t_type, t_compare, t_allocator>::node_handle_merge_multi(t_tree &src_tree) {
+void tree<t_type, t_compare, t_allocator, t_node_policy>::node_handle_merge_multi(t_tree &src_tree) {
   static_assert(::portable_stl::is_same<typename t_tree::t_node_pointer, t_node_pointer>{}(), "");
 
   for (typename t_tree::iterator iter{src_tree.begin()}; iter != src_tree.end();) {
-    t_node_pointer       src_node_ptr = iter.get_node_pointer();
+    t_node_pointer src_node_ptr = iter.get_node_pointer();
+    ++iter;
+    src_node_ptr = src_tree.release_from_arena(src_node_ptr);
+    if (nullptr == src_node_ptr) {
+      continue;
+    }
     t_parent_pointer     parent;
     t_node_base_pointer &child = find_leaf_high(parent, t_node_types::get_key(src_node_ptr->m_value));
-    ++iter;
     src_tree.remove_node_pointer(src_node_ptr);
     insert_node_at(parent, child, static_cast<t_node_base_pointer>(src_node_ptr));
   }
@@ -2701,17 +3502,19 @@ void tree<t_type, t_compare, t_allocator>::node_handle_merge_multi(t_tree &src_t
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param pos
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::erase(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::erase(
   const_iterator pos) {
   t_node_pointer    node_ptr{pos.get_node_pointer()};
   iterator          ret{remove_node_pointer(node_ptr)};
   t_node_allocator &node_alloc{get_node_allocator()};
   t_node_traits::destroy(node_alloc, t_node_types::get_ptr(const_cast<t_node_value_type &>(*pos)));
-  t_node_traits::deallocate(node_alloc, node_ptr, 1);
+  M_deallocate_node(node_ptr);
   return ret;
 }
 
@@ -2721,32 +3524,368 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param first_pos
  * @param last_pos
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::erase(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::erase(
   const_iterator first_pos, const_iterator last_pos) {
-  while (first_pos != last_pos) {
-    first_pos = erase(first_pos);
+  if (first_pos == last_pos) {
+    return iterator(last_pos.m_ptr);
+  }
+  if ((first_pos == begin()) && (last_pos == end())) {
+    clear();
+    return end();
+  }
+  size_type num{0U};
+  for (const_iterator iter{first_pos}; iter != last_pos; ++iter) {
+    ++num;
+  }
+
+  // cut [last_pos, end()) and [first_pos, last_pos) off, destroy the middle tree and join the rest back
+  t_end_node          tail_end;
+  t_end_node          range_end;
+  t_parent_pointer    end_ptr{static_cast<t_parent_pointer>(get_end_node())};
+  t_parent_pointer    tail_ptr{
+    static_cast<t_parent_pointer>(::portable_stl::pointer_traits<t_end_node_ptr>::pointer_to(tail_end))};
+  t_parent_pointer    range_ptr{
+    static_cast<t_parent_pointer>(::portable_stl::pointer_traits<t_end_node_ptr>::pointer_to(range_end))};
+  t_node_base_pointer last_node{nullptr};
+  if (last_pos != end()) {
+    last_node = static_cast<t_node_base_pointer>(last_pos.get_node_pointer());
+    tree_ns::tree_split(get_end_node()->m_left, last_node, end_ptr, tail_ptr);
   }
+  tree_ns::tree_split(
+    get_end_node()->m_left, static_cast<t_node_base_pointer>(first_pos.get_node_pointer()), end_ptr, range_ptr);
+  destroy(static_cast<t_node_pointer>(range_end.m_left));
+
+  if (last_node != nullptr) {
+    tree_ns::tree_remove(tail_end.m_left, last_node);
+    tree_ns::tree_join(end_ptr, get_end_node()->m_left, last_node, tail_end.m_left);
+  }
+  if (first_pos == begin()) {
+    get_begin_node() = static_cast<t_iter_pointer>(last_pos.m_ptr);
+  }
+  size() -= num;
   return iterator(last_pos.m_ptr);
 }
 
+/**
+ * @brief Joins other to this tree.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param other
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::join(tree &other) noexcept {
+  if (0U == other.size()) {
+    return;
+  }
+  if (0U == size()) {
+    swap(other);
+    return;
+  }
+  bool const     other_is_less{value_comp()(*other.begin(), *begin())};
+  tree          &lower_tree = other_is_less ? other : *this;
+  t_iter_pointer begin_node = lower_tree.get_begin_node();
+
+  // the greatest node of the lower tree becomes the joining node
+  t_node_base_pointer mid = tree_ns::tree_max(lower_tree.get_end_node()->m_left);
+  tree_ns::tree_remove(lower_tree.get_end_node()->m_left, mid);
+  t_node_base_pointer lower_root = lower_tree.get_end_node()->m_left;
+  t_node_base_pointer upper_root = other_is_less ? get_end_node()->m_left : other.get_end_node()->m_left;
+  tree_ns::tree_join(static_cast<t_parent_pointer>(get_end_node()), lower_root, mid, upper_root);
+
+  size() += other.size();
+
+  // the blocks go along with their nodes
+  t_node_pointer *last_arena{&m_arena};
+  while (nullptr != *last_arena) {
+    last_arena = &M_arena_header(*last_arena)->m_next;
+  }
+  *last_arena   = other.m_arena;
+  other.m_arena = nullptr;
+
+  get_begin_node()             = begin_node;
+  other.get_begin_node()       = other.get_end_node();
+  other.get_end_node()->m_left = nullptr;
+  other.size()                 = 0U;
+}
+
+/**
+ * @brief Prepares the node to leave the tree, moves the element of a node placed in a block to a new node.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param node_ptr the node.
+ * @return the node owning its storage or nullptr if the allocation failed.
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_pointer
+  tree<t_type, t_compare, t_allocator, t_node_policy>::release_from_arena(t_node_pointer node_ptr) {
+  if (nullptr == M_find_arena(node_ptr)) {
+    return node_ptr;
+  }
+  auto result = create_node(t_node_types::make_move(node_ptr->m_value));
+  if (!result) {
+    return nullptr;
+  }
+  t_node_pointer const new_ptr{result.value().release()};
+  M_replace_node(node_ptr, new_ptr);
+  t_node_traits::destroy(get_node_allocator(), t_node_types::get_ptr(node_ptr->m_value));
+  static_cast<void>(M_release_arena_node(node_ptr, true));
+  return new_ptr;
+}
+
+/**
+ * @brief Moves all the nodes into one newly allocated block in the sorted order.
+ * The nodes are moved one by one, each new node takes the place of the old one in the tree, so the tree stays valid if
+ * an element move constructor throws.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::compact() {
+  static_assert(sizeof(t_arena_header) <= sizeof(t_node_type), "Block header must fit into the node place.");
+  if (0U == size()) {
+    M_free_arenas();
+    return {};
+  }
+
+  t_node_allocator &node_alloc = get_node_allocator();
+  t_node_pointer    block{::portable_stl::allocate_noexcept(node_alloc, size() + 1U)};
+  if (nullptr == block) {
+    return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+      ::portable_stl::portable_stl_error::allocate_error};
+  }
+  t_arena_header *header{::portable_stl::construct_at(M_arena_header(block), m_arena, size())};
+  m_arena = block;
+
+  t_node_pointer new_ptr{block};
+  t_node_pointer node_ptr{static_cast<t_node_pointer>(get_begin_node())};
+  while (static_cast<t_iter_pointer>(node_ptr) != get_end_node()) {
+    ++new_ptr;
+    t_node_traits::construct(
+      node_alloc, t_node_types::get_ptr(new_ptr->m_value), t_node_types::make_move(node_ptr->m_value));
+    ++header->m_live;
+    M_replace_node(node_ptr, new_ptr);
+    t_node_traits::destroy(node_alloc, t_node_types::get_ptr(node_ptr->m_value));
+    M_deallocate_node(node_ptr);
+    node_ptr = static_cast<t_node_pointer>(
+      tree_ns::tree_next_iter<t_iter_pointer>(static_cast<t_node_base_pointer>(new_ptr)));
+  }
+  return {};
+}
+
+/**
+ * @brief Releases the place of the node if it is in a block made by compact().
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param node_ptr the node with the destroyed element.
+ * @param free_empty true to deallocate the block when its last node is released.
+ * @return true if the node is placed in a block, false if the node owns its storage.
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+bool tree<t_type, t_compare, t_allocator, t_node_policy>::M_release_arena_node(t_node_pointer node_ptr,
+                                                                               bool           free_empty) noexcept {
+  t_node_pointer *link{&m_arena};
+  while (nullptr != *link) {
+    t_node_pointer const block{*link};
+    t_arena_header      *header{M_arena_header(block)};
+    if (header->contains(block, node_ptr)) {
+      --header->m_live;
+      if (free_empty && (0U == header->m_live)) {
+        *link = header->m_next;
+        t_node_traits::deallocate(get_node_allocator(), block, header->m_capacity + 1U);
+      }
+      return true;
+    }
+    link = &header->m_next;
+  }
+  return false;
+}
+
+/**
+ * @brief Deallocates all the blocks made by compact().
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::M_free_arenas() noexcept {
+  while (nullptr != m_arena) {
+    t_node_pointer const block{m_arena};
+    t_arena_header      *header{M_arena_header(block)};
+    m_arena = header->m_next;
+    t_node_traits::deallocate(get_node_allocator(), block, header->m_capacity + 1U);
+  }
+}
+
+/**
+ * @brief Links new_ptr into the tree in place of old_ptr.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param old_ptr the node to replace.
+ * @param new_ptr the node with the element to link.
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::M_replace_node(t_node_pointer old_ptr,
+                                                                         t_node_pointer new_ptr) noexcept {
+  t_node_base_pointer const old_base{static_cast<t_node_base_pointer>(old_ptr)};
+  t_node_base_pointer const new_base{static_cast<t_node_base_pointer>(new_ptr)};
+
+  new_base->m_left     = old_base->m_left;
+  new_base->m_right    = old_base->m_right;
+  new_base->m_parent   = old_base->m_parent;
+  new_base->m_is_black = old_base->m_is_black;
+  tree_ns::tree_size_copy(new_base, old_base, typename tree_ns::tree_has_size<t_node_base_pointer>::type{});
+
+  if (tree_ns::tree_is_left_child(old_base)) {
+    new_base->m_parent->m_left = new_base;
+  } else {
+    new_base->parent_unsafe()->m_right = new_base;
+  }
+  if (nullptr != new_base->m_left) {
+    new_base->m_left->set_parent(new_base);
+  }
+  if (nullptr != new_base->m_right) {
+    new_base->m_right->set_parent(new_base);
+  }
+  if (get_begin_node() == static_cast<t_iter_pointer>(old_ptr)) {
+    get_begin_node() = static_cast<t_iter_pointer>(new_ptr);
+  }
+}
+
+/**
+ * @brief Moves the elements starting from pos to the empty tree other.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param pos
+ * @param other
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::M_split(const_iterator pos, tree &other) noexcept {
+  if (pos == end()) {
+    return;
+  }
+  if (pos == begin()) {
+    swap(other);
+    return;
+  }
+  size_type const total{size()};
+  tree_ns::tree_split(get_end_node()->m_left,
+                      static_cast<t_node_base_pointer>(pos.get_node_pointer()),
+                      static_cast<t_parent_pointer>(get_end_node()),
+                      static_cast<t_parent_pointer>(other.get_end_node()));
+  other.get_begin_node() = static_cast<t_iter_pointer>(pos.m_ptr);
+  M_split_size(other, total, typename tree_ns::tree_has_size<t_node_base_pointer>::type{});
+}
+
+/**
+ * @brief Hands over the blocks made by compact() with all their nodes starting from pos to other, reallocates the nodes
+ * starting from pos placed in the other blocks.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param pos the first element to move.
+ * @param other the empty tree to move the elements to.
+ * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::M_split_arenas(iterator pos, tree &other) {
+  for (iterator iter{pos}; iter != end(); ++iter) {
+    t_arena_header *header{M_find_arena(iter.get_node_pointer())};
+    if (nullptr != header) {
+      ++header->m_leaving;
+    }
+  }
+  // m_leaving stays non-zero only for the blocks which go to other
+  for (t_node_pointer block{m_arena}; nullptr != block; block = M_arena_header(block)->m_next) {
+    t_arena_header *header{M_arena_header(block)};
+    if (header->m_leaving != header->m_live) {
+      header->m_leaving = 0U;
+    }
+  }
+
+  auto const reset_leaving = [this]() noexcept {
+    for (t_node_pointer block{m_arena}; nullptr != block; block = M_arena_header(block)->m_next) {
+      M_arena_header(block)->m_leaving = 0U;
+    }
+  };
+  auto guard = ::portable_stl::make_exception_guard([&reset_leaving]() noexcept { reset_leaving(); });
+  for (iterator iter{pos}; iter != end(); ++iter) {
+    t_arena_header const *header{M_find_arena(iter.get_node_pointer())};
+    if ((nullptr != header) && (0U == header->m_leaving)) {
+      t_node_pointer const node_ptr{release_from_arena(iter.get_node_pointer())};
+      if (nullptr == node_ptr) {
+        guard.commit();
+        reset_leaving();
+        return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+          ::portable_stl::portable_stl_error::allocate_error};
+      }
+      iter = iterator(node_ptr);
+    }
+  }
+  guard.commit();
+
+  t_node_pointer *link{&m_arena};
+  while (nullptr != *link) {
+    t_node_pointer const block{*link};
+    t_arena_header      *header{M_arena_header(block)};
+    if (0U != header->m_leaving) {
+      header->m_leaving = 0U;
+      *link             = header->m_next;
+      header->m_next    = other.m_arena;
+      other.m_arena     = block;
+    } else {
+      link = &header->m_next;
+    }
+  }
+  return {};
+}
+
 /**
  * @brief
  *
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key
- * @return tree<t_type, t_compare, t_allocator>::size_type
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::size_type tree<t_type, t_compare, t_allocator>::erase_unique(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
+  tree<t_type, t_compare, t_allocator, t_node_policy>::erase_unique(
   t_key_type const &key) {
   iterator iter = find(key);
   if (iter == end()) {
@@ -2762,13 +3901,15 @@ typename tree<t_type, t_compare, t_allocator>::size_type tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key
- * @return tree<t_type, t_compare, t_allocator>::size_type
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::size_type tree<t_type, t_compare, t_allocator>::erase_multi(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
+  tree<t_type, t_compare, t_allocator, t_node_policy>::erase_multi(
   t_key_type const &key) {
   ::portable_stl::tuple<iterator, iterator> range_pair = equal_range_multi(key);
   size_type                                 ret        = 0;
@@ -2784,13 +3925,15 @@ typename tree<t_type, t_compare, t_allocator>::size_type tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::find(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::find(
   t_key_type const &key_value) {
   iterator pos = lower_bound(key_value, get_root(), get_end_node());
   if (pos != end() && !value_comp()(key_value, *pos)) {
@@ -2805,13 +3948,15 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::const_iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::const_iterator tree<t_type, t_compare, t_allocator>::find(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::find(
   t_key_type const &key_value) const {
   const_iterator pos = lower_bound(key_value, get_root(), get_end_node());
   if (pos != end() && !value_comp()(key_value, *pos)) {
@@ -2826,13 +3971,15 @@ typename tree<t_type, t_compare, t_allocator>::const_iterator tree<t_type, t_com
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::size_type
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::size_type tree<t_type, t_compare, t_allocator>::count_unique(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
+  tree<t_type, t_compare, t_allocator, t_node_policy>::count_unique(
   t_key_type const &key_value) const {
   t_node_pointer cur_root = get_root();
   while (cur_root != nullptr) {
@@ -2853,13 +4000,15 @@ typename tree<t_type, t_compare, t_allocator>::size_type tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
- * @return tree<t_type, t_compare, t_allocator>::size_type
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::size_type tree<t_type, t_compare, t_allocator>::count_multi(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
+  tree<t_type, t_compare, t_allocator, t_node_policy>::count_multi(
   t_key_type const &key_value) const {
   t_iter_pointer result   = get_end_node();
   t_node_pointer cur_root = get_root();
@@ -2878,21 +4027,217 @@ typename tree<t_type, t_compare, t_allocator>::size_type tree<t_type, t_compare,
   return 0;
 }
 
+/**
+ * @brief Finds the node at the position index in the sorted order using the subtree sizes.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @param index the position of the element.
+ * @return the node or the end node if index >= size().
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_iter_pointer
+  tree<t_type, t_compare, t_allocator, t_node_policy>::M_nth(size_type index) const noexcept {
+  static_assert(typename tree_ns::tree_has_size<t_node_pointer>::type{}(), "nth() requires tree_rank_node_policy");
+  if (index >= size()) {
+    return get_end_node();
+  }
+  t_node_pointer node_ptr = get_root();
+  while (true) {
+    size_type const left_size{tree_ns::tree_size(node_ptr->m_left)};
+    if (index < left_size) {
+      node_ptr = static_cast<t_node_pointer>(node_ptr->m_left);
+    } else if (index == left_size) {
+      return static_cast<t_iter_pointer>(node_ptr);
+    } else {
+      index    -= left_size + 1U;
+      node_ptr  = static_cast<t_node_pointer>(node_ptr->m_right);
+    }
+  }
+}
+
+/**
+ * @brief Returns the number of elements less than key_value.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @tparam t_key_type
+ * @param key_value
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+template<class t_key_type>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::size_type
+  tree<t_type, t_compare, t_allocator, t_node_policy>::rank(t_key_type const &key_value) const {
+  static_assert(typename tree_ns::tree_has_size<t_node_pointer>::type{}(), "rank() requires tree_rank_node_policy");
+  size_type      result{0U};
+  t_node_pointer node_ptr = get_root();
+  while (node_ptr != nullptr) {
+    if (!value_comp()(node_ptr->m_value, key_value)) {
+      node_ptr = static_cast<t_node_pointer>(node_ptr->m_left);
+    } else {
+      result   += tree_ns::tree_size(node_ptr->m_left) + 1U;
+      node_ptr  = static_cast<t_node_pointer>(node_ptr->m_right);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Finds lower bounds of the keys [first, last) and passes them to func in the order of the keys.
+ * The keys are taken in groups of lanes_count and the descents of a group are interleaved level by level, so the loads
+ * of the next nodes overlap. When every key of the group is greater than the predecessor of the previous key result,
+ * the batch is considered sorted and the following keys are looked up by finger search until the order breaks.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @tparam t_forward_iterator
+ * @tparam t_function
+ * @param first the beginning of the keys.
+ * @param last the end of the keys.
+ * @param func the function object.
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+template<class t_forward_iterator, class t_function>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::M_lower_bound_many(t_forward_iterator first,
+                                                                           t_forward_iterator last,
+                                                                           t_function        &func) const {
+  constexpr size_type lanes_count{8U};
+  t_forward_iterator  keys[lanes_count];
+  t_node_pointer      nodes[lanes_count];
+  t_iter_pointer      results[lanes_count];
+  t_node_pointer      less_nodes[lanes_count];
+
+  bool           sorted{false};
+  t_iter_pointer result{get_end_node()};
+  t_node_pointer less_node{nullptr};
+  while (first != last) {
+    if (sorted && ((nullptr == less_node) || value_comp()(less_node->m_value, *first))) {
+      M_lower_bound_finger(*first, result, less_node);
+      func(*first, result);
+      ++first;
+      continue;
+    }
+
+    size_type count{0U};
+    for (; (count < lanes_count) && (first != last); ++count, ++first) {
+      keys[count]       = first;
+      nodes[count]      = get_root();
+      results[count]    = get_end_node();
+      less_nodes[count] = nullptr;
+    }
+
+    bool active{true};
+    while (active) {
+      active = false;
+      for (size_type i{0U}; i < count; ++i) {
+        t_node_pointer node_ptr{nodes[i]};
+        if (nullptr != node_ptr) {
+          if (!value_comp()(node_ptr->m_value, *keys[i])) {
+            results[i] = static_cast<t_iter_pointer>(node_ptr);
+            node_ptr   = static_cast<t_node_pointer>(node_ptr->m_left);
+          } else {
+            less_nodes[i] = node_ptr;
+            node_ptr      = static_cast<t_node_pointer>(node_ptr->m_right);
+          }
+          nodes[i] = node_ptr;
+          if (nullptr != node_ptr) {
+            ::portable_stl::prefetch(::portable_stl::to_address(node_ptr));
+            active = true;
+          }
+        }
+      }
+    }
+
+    sorted = (nullptr == less_node) || value_comp()(less_node->m_value, *keys[0]);
+    for (size_type i{0U}; i < count; ++i) {
+      func(*keys[i], results[i]);
+      if ((i + 1U < count) && (nullptr != less_nodes[i]) && !value_comp()(less_nodes[i]->m_value, *keys[i + 1U])) {
+        sorted = false;
+      }
+    }
+    result    = results[count - 1U];
+    less_node = less_nodes[count - 1U];
+  }
+}
+
+/**
+ * @brief Finds the lower bound of key_value starting from the previous result.
+ * The result is not less than the previous one, so it is either in the right subtree of the previous result or of one
+ * of its ancestors, or it is the first ancestor greater than the right subtree. The walk climbs only as high as the
+ * distance between the results requires.
+ *
+ * @tparam t_type
+ * @tparam t_compare
+ * @tparam t_allocator
+ * @tparam t_node_policy
+ * @tparam t_key_type
+ * @param key_value the looked up key.
+ * @param result the previous result on input, the lower bound of key_value on output.
+ * @param less_node the greatest node less than the previously looked up key on input, the greatest node less than
+ * key_value on output.
+ */
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+template<class t_key_type>
+void tree<t_type, t_compare, t_allocator, t_node_policy>::M_lower_bound_finger(t_key_type const &key_value,
+                                                                             t_iter_pointer   &result,
+                                                                             t_node_pointer   &less_node) const {
+  t_iter_pointer const end_node{get_end_node()};
+  if ((result == end_node) || !value_comp()(static_cast<t_node_pointer>(result)->m_value, key_value)) {
+    return;
+  }
+
+  // climb to the first ancestor which is not less than key_value, the nodes passed by are less than key_value
+  t_node_pointer node_ptr{static_cast<t_node_pointer>(result)};
+  less_node = node_ptr;
+  while (true) {
+    while (!tree_ns::tree_is_left_child(static_cast<t_node_base_pointer>(node_ptr))) {
+      node_ptr = static_cast<t_node_pointer>(node_ptr->parent_unsafe());
+    }
+    result = static_cast<t_iter_pointer>(node_ptr->m_parent);
+    if ((result == end_node) || !value_comp()(static_cast<t_node_pointer>(result)->m_value, key_value)) {
+      break;
+    }
+    node_ptr  = static_cast<t_node_pointer>(result);
+    less_node = node_ptr;
+  }
+
+  // the elements between less_node and result are the right subtree of less_node
+  node_ptr = static_cast<t_node_pointer>(less_node->m_right);
+  while (node_ptr != nullptr) {
+    if (!value_comp()(node_ptr->m_value, key_value)) {
+      result   = static_cast<t_iter_pointer>(node_ptr);
+      node_ptr = static_cast<t_node_pointer>(node_ptr->m_left);
+    } else {
+      less_node = node_ptr;
+      node_ptr  = static_cast<t_node_pointer>(node_ptr->m_right);
+    }
+  }
+}
+
 /**
  * @brief
  *
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
  * @param node_ptr
  * @param result
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::lower_bound(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::lower_bound(
   t_key_type const &key_value, t_node_pointer node_ptr, t_iter_pointer result) {
   while (node_ptr != nullptr) {
     if (!value_comp()(node_ptr->m_value, key_value)) {
@@ -2911,15 +4256,17 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
  * @param node_ptr
  * @param result
- * @return tree<t_type, t_compare, t_allocator>::const_iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::const_iterator tree<t_type, t_compare, t_allocator>::lower_bound(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::lower_bound(
   t_key_type const &key_value, t_node_pointer node_ptr, t_iter_pointer result) const {
   while (node_ptr != nullptr) {
     if (!value_comp()(node_ptr->m_value, key_value)) {
@@ -2938,15 +4285,17 @@ typename tree<t_type, t_compare, t_allocator>::const_iterator tree<t_type, t_com
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
  * @param node_ptr
  * @param result
- * @return tree<t_type, t_compare, t_allocator>::iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare, t_allocator>::upper_bound(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::upper_bound(
   t_key_type const &key_value, t_node_pointer node_ptr, t_iter_pointer result) {
   while (node_ptr != nullptr) {
     if (value_comp()(key_value, node_ptr->m_value)) {
@@ -2965,15 +4314,17 @@ typename tree<t_type, t_compare, t_allocator>::iterator tree<t_type, t_compare,
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
  * @param node_ptr
  * @param result
- * @return tree<t_type, t_compare, t_allocator>::const_iterator
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-typename tree<t_type, t_compare, t_allocator>::const_iterator tree<t_type, t_compare, t_allocator>::upper_bound(
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator
+  tree<t_type, t_compare, t_allocator, t_node_policy>::upper_bound(
   t_key_type const &key_value, t_node_pointer node_ptr, t_iter_pointer result) const {
   while (node_ptr != nullptr) {
     if (value_comp()(key_value, node_ptr->m_value)) {
@@ -2992,16 +4343,17 @@ typename tree<t_type, t_compare, t_allocator>::const_iterator tree<t_type, t_com
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
- * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator,
- * typename tree<t_type, t_compare, t_allocator>::iterator>
+ * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator,
+ * typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator,
-                      typename tree<t_type, t_compare, t_allocator>::iterator>
-  tree<t_type, t_compare, t_allocator>::equal_range_unique(t_key_type const &key_value) {
+::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator,
+                      typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::equal_range_unique(t_key_type const &key_value) {
   using t_return_range    = ::portable_stl::tuple<iterator, iterator>;
   t_iter_pointer result   = get_end_node();
   t_node_pointer cur_root = get_root();
@@ -3027,16 +4379,17 @@ template<class t_key_type>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
- * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::const_iterator,
- * typename tree<t_type, t_compare, t_allocator>::const_iterator>
+ * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator,
+ * typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::const_iterator,
-                      typename tree<t_type, t_compare, t_allocator>::const_iterator>
-  tree<t_type, t_compare, t_allocator>::equal_range_unique(t_key_type const &key_value) const {
+::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator,
+                      typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::equal_range_unique(t_key_type const &key_value) const {
   using t_return_range    = ::portable_stl::tuple<const_iterator, const_iterator>;
   t_iter_pointer result   = get_end_node();
   t_node_pointer cur_root = get_root();
@@ -3062,16 +4415,17 @@ template<class t_key_type>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
- * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator,
- * typename tree<t_type, t_compare, t_allocator>::iterator>
+ * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator,
+ * typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::iterator,
-                      typename tree<t_type, t_compare, t_allocator>::iterator>
-  tree<t_type, t_compare, t_allocator>::equal_range_multi(t_key_type const &key_value) {
+::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator,
+                      typename tree<t_type, t_compare, t_allocator, t_node_policy>::iterator>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::equal_range_multi(t_key_type const &key_value) {
   using t_return_range    = ::portable_stl::tuple<iterator, iterator>;
   t_iter_pointer result   = get_end_node();
   t_node_pointer cur_root = get_root();
@@ -3096,16 +4450,17 @@ template<class t_key_type>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @tparam t_key_type
  * @param key_value
- * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::const_iterator,
- * typename tree<t_type, t_compare, t_allocator>::const_iterator>
+ * @return ::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator,
+ * typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator>
  */
-template<class t_type, class t_compare, class t_allocator>
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
 template<class t_key_type>
-::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator>::const_iterator,
-                      typename tree<t_type, t_compare, t_allocator>::const_iterator>
-  tree<t_type, t_compare, t_allocator>::equal_range_multi(t_key_type const &key_value) const {
+::portable_stl::tuple<typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator,
+                      typename tree<t_type, t_compare, t_allocator, t_node_policy>::const_iterator>
+  tree<t_type, t_compare, t_allocator, t_node_policy>::equal_range_multi(t_key_type const &key_value) const {
   using t_return_range    = ::portable_stl::tuple<const_iterator, const_iterator>;
   t_iter_pointer result   = get_end_node();
   t_node_pointer cur_root = get_root();
@@ -3130,11 +4485,13 @@ template<class t_key_type>
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param pos
- * @return tree<t_type, t_compare, t_allocator>::t_node_holder
+ * @return tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_holder
  */
-template<class t_type, class t_compare, class t_allocator>
-typename tree<t_type, t_compare, t_allocator>::t_node_holder tree<t_type, t_compare, t_allocator>::remove(
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+typename tree<t_type, t_compare, t_allocator, t_node_policy>::t_node_holder
+  tree<t_type, t_compare, t_allocator, t_node_policy>::remove(
   const_iterator pos) noexcept {
   t_node_pointer node_ptr = pos.get_node_pointer();
   if (get_begin_node() == pos.m_ptr) {
@@ -3146,7 +4503,9 @@ typename tree<t_type, t_compare, t_allocator>::t_node_holder tree<t_type, t_comp
   }
   --size();
   tree_ns::tree_remove(get_end_node()->m_left, static_cast<t_node_base_pointer>(node_ptr));
-  return t_node_holder(node_ptr, t_tree_node_deleter(get_node_allocator(), true));
+  // the block is kept until clear() while the holder uses the node
+  bool const in_arena{M_release_arena_node(node_ptr, false)};
+  return t_node_holder(node_ptr, t_tree_node_deleter(get_node_allocator(), true, !in_arena));
 }
 
 /**
@@ -3155,12 +4514,13 @@ typename tree<t_type, t_compare, t_allocator>::t_node_holder tree<t_type, t_comp
  * @tparam t_type
  * @tparam t_compare
  * @tparam t_allocator
+ * @tparam t_node_policy
  * @param lhv tree whose contents to swap.
  * @param rhv tree whose contents to swap.
  */
-template<class t_type, class t_compare, class t_allocator>
-inline void swap(tree<t_type, t_compare, t_allocator> &lhv,
-                 tree<t_type, t_compare, t_allocator> &rhv) noexcept(noexcept(lhv.swap(rhv))) {
+template<class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline void swap(tree<t_type, t_compare, t_allocator, t_node_policy> &lhv,
+                 tree<t_type, t_compare, t_allocator, t_node_policy> &rhv) noexcept(noexcept(lhv.swap(rhv))) {
   lhv.swap(rhv);
 }
 
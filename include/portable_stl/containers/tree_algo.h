@@ -12,6 +12,11 @@
 #ifndef PSTL_TREE_ALGO_H
 #define PSTL_TREE_ALGO_H
 
+#include "../common/size_t.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/other_transformations/void_t.h"
+#include "../utility/general/declval.h"
+
 namespace portable_stl {
 
 namespace tree_ns {
@@ -227,6 +232,155 @@ namespace tree_ns {
     return node;
   }
 
+  /**
+   * @brief Checks if the node keeps the size of its subtree (see tree_rank_node_policy).
+   * @tparam t_node_ptr
+   */
+  template<class t_node_ptr, class = void> class tree_has_size final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::false_type;
+  };
+
+  /**
+   * @brief Checks if the node keeps the size of its subtree (see tree_rank_node_policy).
+   * @tparam t_node_ptr
+   */
+  template<class t_node_ptr>
+  class tree_has_size<t_node_ptr, ::portable_stl::void_t<decltype(::portable_stl::declval<t_node_ptr>()->m_size)>>
+    final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::true_type;
+  };
+
+  /**
+   * @brief Returns the size of the subtree rooted at node.
+   *
+   * @tparam t_node_ptr
+   * @param node the subtree root, may be null.
+   * @return the number of nodes in the subtree.
+   */
+  template<class t_node_ptr> inline ::portable_stl::size_t tree_size(t_node_ptr node) noexcept {
+    return (node == nullptr) ? 0U : node->m_size;
+  }
+
+  /**
+   * @brief Recomputes the subtree size of node from its children.
+   *
+   * @tparam t_node_ptr
+   * @param node
+   */
+  template<class t_node_ptr> inline void tree_size_fix(t_node_ptr node, ::portable_stl::true_type) noexcept {
+    node->m_size = 1U + tree_size(node->m_left) + tree_size(node->m_right);
+  }
+
+  /**
+   * @brief Plain nodes have no subtree size.
+   * @tparam t_node_ptr
+   */
+  template<class t_node_ptr> inline void tree_size_fix(t_node_ptr, ::portable_stl::false_type) noexcept {
+  }
+
+  /**
+   * @brief Sets the subtree size of node.
+   *
+   * @tparam t_node_ptr
+   * @param node
+   * @param num the number of nodes in the subtree.
+   */
+  template<class t_node_ptr>
+  inline void tree_size_set(t_node_ptr node, ::portable_stl::size_t num, ::portable_stl::true_type) noexcept {
+    node->m_size = num;
+  }
+
+  /**
+   * @brief Plain nodes have no subtree size.
+   * @tparam t_node_ptr
+   */
+  template<class t_node_ptr>
+  inline void tree_size_set(t_node_ptr, ::portable_stl::size_t, ::portable_stl::false_type) noexcept {
+  }
+
+  /**
+   * @brief Copies the subtree size of src_node to dst_node.
+   *
+   * @tparam t_node_ptr
+   * @param dst_node
+   * @param src_node
+   */
+  template<class t_node_ptr>
+  inline void tree_size_copy(t_node_ptr dst_node, t_node_ptr src_node, ::portable_stl::true_type) noexcept {
+    dst_node->m_size = src_node->m_size;
+  }
+
+  /**
+   * @brief Plain nodes have no subtree size.
+   * @tparam t_node_ptr
+   */
+  template<class t_node_ptr> inline void tree_size_copy(t_node_ptr, t_node_ptr, ::portable_stl::false_type) noexcept {
+  }
+
+  /**
+   * @brief Adds one to the subtree sizes of all the ancestors of node up to 'root' (node is inserted) or subtracts one
+   * from them (node is going to be removed).
+   *
+   * @tparam t_node_ptr
+   * @param root
+   * @param node
+   * @param increment true to add one, false to subtract one.
+   */
+  template<class t_node_ptr>
+  inline void tree_size_update_path(t_node_ptr root,
+                                    t_node_ptr node,
+                                    bool       increment,
+                                    ::portable_stl::true_type) noexcept {
+    while (node != root) {
+      node = node->parent_unsafe();
+      if (increment) {
+        ++node->m_size;
+      } else {
+        --node->m_size;
+      }
+    }
+  }
+
+  /**
+   * @brief Plain nodes have no subtree size.
+   * @tparam t_node_ptr
+   */
+  template<class t_node_ptr>
+  inline void tree_size_update_path(t_node_ptr, t_node_ptr, bool, ::portable_stl::false_type) noexcept {
+  }
+
+  /**
+   * @brief Recomputes the subtree sizes of node and all its ancestors up to 'root'.
+   *
+   * @tparam t_node_ptr
+   * @param root
+   * @param node
+   */
+  template<class t_node_ptr>
+  inline void tree_size_fix_path(t_node_ptr root, t_node_ptr node, ::portable_stl::true_type) noexcept {
+    tree_size_fix(node, ::portable_stl::true_type{});
+    while (node != root) {
+      node = node->parent_unsafe();
+      tree_size_fix(node, ::portable_stl::true_type{});
+    }
+  }
+
+  /**
+   * @brief Plain nodes have no subtree size.
+   * @tparam t_node_ptr
+   */
+  template<class t_node_ptr>
+  inline void tree_size_fix_path(t_node_ptr, t_node_ptr, ::portable_stl::false_type) noexcept {
+  }
+
   /**
    * @brief Makes node->m_right the subtree root with node as its left child while preserving in-order order.
    *
@@ -249,6 +403,8 @@ namespace tree_ns {
     }
     old_right->m_left = node;
     node->set_parent(old_right);
+    tree_size_copy(old_right, node, typename tree_has_size<t_node_ptr>::type{});
+    tree_size_fix(node, typename tree_has_size<t_node_ptr>::type{});
   }
 
   /**
@@ -273,24 +429,24 @@ namespace tree_ns {
     }
     old_left->m_right = node;
     node->set_parent(old_left);
+    tree_size_copy(old_left, node, typename tree_has_size<t_node_ptr>::type{});
+    tree_size_fix(node, typename tree_has_size<t_node_ptr>::type{});
   }
 
   /**
-   * @brief Rebalances 'root' after attaching node to a leaf.
-   * Precondition:  node has no children.
-   *                node == 'root' or node ia a direct or indirect child of 'root'.
-   *                If node were to be unlinked from 'root' (setting 'root' to
-   *                  nullptr if 'root' == node), tree_invariant('root') == true.
+   * @brief Restores the red black properties of 'root' after linking the red node which may have a red parent.
+   * Precondition:  node == 'root' or node is a direct or indirect child of 'root'.
+   *                Both subtrees of node are proper red black subtrees with the same black height, the subtree sizes
+   *                are up to date.
    * Postcondition: tree_invariant(end_node->m_left) == true.  end_node->m_left
    *                may be different than the value passed in as 'root'.
    *
    * @tparam t_node_ptr
    * @param root
    * @param node
+   * @return true if the black height of the tree grew by one, i.e. the recoloring reached 'root'.
    */
-  template<class t_node_ptr> void tree_balance_after_insert(t_node_ptr root, t_node_ptr node) noexcept {
-    // static_assert(root != nullptr, "Root of the tree shouldn't be null");
-    // static_assert(node != nullptr, "Can't attach null node to a leaf");
+  template<class t_node_ptr> bool tree_balance_after_link(t_node_ptr root, t_node_ptr node) noexcept {
     node->m_is_black = (node == root);
     while ((node != root) && (!node->parent_unsafe()->m_is_black)) {
       // node->m_parent != root because node->m_parent->__is_black == false
@@ -312,7 +468,7 @@ namespace tree_ns {
           node             = node->parent_unsafe();
           node->m_is_black = false;
           tree_right_rotate(node);
-          break;
+          return false;
         }
       } else {
         t_node_ptr up_left = node->parent_unsafe()->m_parent->m_left;
@@ -332,10 +488,32 @@ namespace tree_ns {
           node             = node->parent_unsafe();
           node->m_is_black = false;
           tree_left_rotate(node);
-          break;
+          return false;
         }
       }
     }
+    return node == root;
+  }
+
+  /**
+   * @brief Rebalances 'root' after attaching node to a leaf.
+   * Precondition:  node has no children.
+   *                node == 'root' or node ia a direct or indirect child of 'root'.
+   *                If node were to be unlinked from 'root' (setting 'root' to
+   *                  nullptr if 'root' == node), tree_invariant('root') == true.
+   * Postcondition: tree_invariant(end_node->m_left) == true.  end_node->m_left
+   *                may be different than the value passed in as 'root'.
+   *
+   * @tparam t_node_ptr
+   * @param root
+   * @param node
+   */
+  template<class t_node_ptr> void tree_balance_after_insert(t_node_ptr root, t_node_ptr node) noexcept {
+    // static_assert(root != nullptr, "Root of the tree shouldn't be null");
+    // static_assert(node != nullptr, "Can't attach null node to a leaf");
+    tree_size_set(node, 1U, typename tree_has_size<t_node_ptr>::type{});
+    tree_size_update_path(root, node, true, typename tree_has_size<t_node_ptr>::type{});
+    static_cast<void>(tree_balance_after_link(root, node));
   }
 
   /**
@@ -359,6 +537,8 @@ namespace tree_ns {
     // y_node will have at most one child.
     // y_node will be the initial hole in the tree (make the hole at a leaf)
     t_node_ptr y_node = ((z_node->m_left == nullptr) || (z_node->m_right == nullptr)) ? z_node : tree_next(z_node);
+    // y_node leaves the subtrees of all its ancestors
+    tree_size_update_path(root, y_node, false, typename tree_has_size<t_node_ptr>::type{});
     // node is y_node's possibly null single child
     t_node_ptr node   = y_node->m_left != nullptr ? y_node->m_left : y_node->m_right;
     // w_node is node's possibly null uncle (will become node's sibling)
@@ -397,6 +577,7 @@ namespace tree_ns {
         y_node->m_right->set_parent(y_node);
       }
       y_node->m_is_black = z_node->m_is_black;
+      tree_size_copy(y_node, z_node, typename tree_has_size<t_node_ptr>::type{});
       if (root == z_node) {
         root = y_node;
       }
@@ -519,6 +700,286 @@ namespace tree_ns {
       }
     }
   }
+
+  /**
+   * @brief Returns the black height of the subtree, i.e. the number of black nodes on any path from node to a leaf.
+   *
+   * @tparam t_node_ptr
+   * @param node the subtree root, may be null.
+   * @return the black height.
+   */
+  template<class t_node_ptr> unsigned tree_black_height(t_node_ptr node) noexcept {
+    unsigned height{0U};
+    for (; node != nullptr; node = node->m_left) {
+      if (node->m_is_black) {
+        ++height;
+      }
+    }
+    return height;
+  }
+
+  /**
+   * @brief Returns the black height of the child subtree as it becomes after its root is colored black.
+   *
+   * @tparam t_node_ptr
+   * @param child the child subtree root, may be null.
+   * @param height the black height of the parent subtree, the parent included.
+   * @param parent_is_black the color of the parent.
+   * @return the black height of the child subtree with the black root.
+   */
+  template<class t_node_ptr>
+  inline unsigned tree_child_black_height(t_node_ptr child, unsigned height, bool parent_is_black) noexcept {
+    unsigned const child_height{parent_is_black ? (height - 1U) : height};
+    return ((child != nullptr) && !child->m_is_black) ? (child_height + 1U) : child_height;
+  }
+
+  /**
+   * @brief Joins two detached trees of the known black heights and the node between them into the tree linked to
+   * end_node in O(|left_height - right_height| + 1).
+   * Precondition:  all the nodes of left precede mid and all the nodes of right follow mid in the in-order order.
+   *                left and right are null or roots of proper red black trees (their parents are ignored).
+   *                left_height and right_height are the black heights of left and right with their roots colored black.
+   * Postcondition: end_node->m_left is the root of the joined tree and tree_invariant(end_node->m_left) == true.
+   *
+   * @tparam t_parent_ptr
+   * @tparam t_node_ptr
+   * @param end_node the holder of the joined tree, its previous m_left is ignored.
+   * @param left the tree of the lesser nodes.
+   * @param left_height the black height of left.
+   * @param mid the node between the trees.
+   * @param right the tree of the greater nodes.
+   * @param right_height the black height of right.
+   * @return the black height of the joined tree.
+   */
+  template<class t_parent_ptr, class t_node_ptr>
+  unsigned tree_join_heights(t_parent_ptr end_node,
+                             t_node_ptr   left,
+                             unsigned     left_height,
+                             t_node_ptr   mid,
+                             t_node_ptr   right,
+                             unsigned     right_height) noexcept {
+    // the black roots keep both trees valid and make the black heights comparable
+    if (left != nullptr) {
+      left->m_is_black = true;
+    }
+    if (right != nullptr) {
+      right->m_is_black = true;
+    }
+
+    if (left_height == right_height) {
+      mid->m_left      = left;
+      mid->m_right     = right;
+      mid->m_is_black  = true;
+      mid->m_parent    = end_node;
+      end_node->m_left = mid;
+      if (left != nullptr) {
+        left->set_parent(mid);
+      }
+      if (right != nullptr) {
+        right->set_parent(mid);
+      }
+      tree_size_fix(mid, typename tree_has_size<t_node_ptr>::type{});
+      return left_height + 1U;
+    }
+
+    // descend the spine of the higher tree to the black node of the lower tree black height and put mid there
+    t_node_ptr parent = nullptr;
+    if (left_height > right_height) {
+      end_node->m_left = left;
+      left->m_parent   = end_node;
+      t_node_ptr node  = left;
+      unsigned   height{left_height};
+      while ((node != nullptr) && (!node->m_is_black || (height > right_height))) {
+        if (node->m_is_black) {
+          --height;
+        }
+        parent = node;
+        node   = node->m_right;
+      }
+      mid->m_left     = node;
+      mid->m_right    = right;
+      parent->m_right = mid;
+    } else {
+      end_node->m_left = right;
+      right->m_parent  = end_node;
+      t_node_ptr node  = right;
+      unsigned   height{right_height};
+      while ((node != nullptr) && (!node->m_is_black || (height > left_height))) {
+        if (node->m_is_black) {
+          --height;
+        }
+        parent = node;
+        node   = node->m_left;
+      }
+      mid->m_left    = left;
+      mid->m_right   = node;
+      parent->m_left = mid;
+    }
+    mid->set_parent(parent);
+    if (mid->m_left != nullptr) {
+      mid->m_left->set_parent(mid);
+    }
+    if (mid->m_right != nullptr) {
+      mid->m_right->set_parent(mid);
+    }
+    tree_size_fix_path(static_cast<t_node_ptr>(end_node->m_left), mid, typename tree_has_size<t_node_ptr>::type{});
+    unsigned const height{(left_height > right_height) ? left_height : right_height};
+    // mid is red and may have a red parent
+    return tree_balance_after_link(static_cast<t_node_ptr>(end_node->m_left), mid) ? (height + 1U) : height;
+  }
+
+  /**
+   * @brief Joins two detached trees and the node between them into the tree linked to end_node in O(log(n)), the
+   * black heights of the trees are found by the walks down their left spines.
+   * Precondition:  all the nodes of left precede mid and all the nodes of right follow mid in the in-order order.
+   *                left and right are null or roots of proper red black trees (their parents are ignored).
+   * Postcondition: end_node->m_left is the root of the joined tree and tree_invariant(end_node->m_left) == true.
+   *
+   * @tparam t_parent_ptr
+   * @tparam t_node_ptr
+   * @param end_node the holder of the joined tree, its previous m_left is ignored.
+   * @param left the tree of the lesser nodes.
+   * @param mid the node between the trees.
+   * @param right the tree of the greater nodes.
+   */
+  template<class t_parent_ptr, class t_node_ptr>
+  void tree_join(t_parent_ptr end_node, t_node_ptr left, t_node_ptr mid, t_node_ptr right) noexcept {
+    unsigned const left_height{(left == nullptr) ? 0U : (tree_black_height(left) + (left->m_is_black ? 0U : 1U))};
+    unsigned const right_height{
+      (right == nullptr) ? 0U : (tree_black_height(right) + (right->m_is_black ? 0U : 1U))};
+    static_cast<void>(tree_join_heights(end_node, left, left_height, mid, right, right_height));
+  }
+
+  /**
+   * @brief Splits the tree rooted at 'root' before pos in O(log(n)): the nodes preceding pos go to the tree linked to
+   * left_end and pos with all the following nodes go to the tree linked to right_end.
+   * The black heights of the subtrees and of the both parts are carried along the walk up, so every join costs
+   * O(|black height difference| + 1) and the costs telescope to O(log(n)).
+   * Precondition:  pos == 'root' or pos is a direct or indirect child of 'root'.
+   * Postcondition: left_end->m_left and right_end->m_left are the roots of proper red black trees (the left one may
+   *                be null). left_end may be the end_node of 'root'.
+   *
+   * @tparam t_parent_ptr
+   * @tparam t_node_ptr
+   * @param root
+   * @param pos the first node of the right tree.
+   * @param left_end the holder of the left tree.
+   * @param right_end the holder of the right tree.
+   */
+  template<class t_parent_ptr, class t_node_ptr>
+  void tree_split(t_node_ptr root, t_node_ptr pos, t_parent_ptr left_end, t_parent_ptr right_end) noexcept {
+    // walk from pos up to 'root', each ancestor with its other subtree is joined to the left or the right tree,
+    // the links and the color of the ancestor are read before the join changes them; node_height is the black height
+    // of the ancestor subtree in the original tree
+    t_node_ptr node       = pos;
+    bool       at_root    = (node == root);
+    bool       is_left    = !at_root && tree_is_left_child(node);
+    t_node_ptr parent     = at_root ? nullptr : node->parent_unsafe();
+    t_node_ptr left       = node->m_left;
+    bool       node_black = node->m_is_black;
+    unsigned   node_height{tree_black_height(node)};
+    unsigned   left_height{tree_child_black_height(left, node_height, node_black)};
+
+    unsigned right_height{tree_join_heights(right_end,
+                                            static_cast<t_node_ptr>(nullptr),
+                                            0U,
+                                            node,
+                                            static_cast<t_node_ptr>(node->m_right),
+                                            tree_child_black_height(node->m_right, node_height, node_black))};
+    left_end->m_left = left;
+    while (!at_root) {
+      bool const from_left{is_left};
+      node        = parent;
+      at_root     = (node == root);
+      is_left     = !at_root && tree_is_left_child(node);
+      parent      = at_root ? nullptr : node->parent_unsafe();
+      node_black  = node->m_is_black;
+      node_height += node_black ? 1U : 0U;
+      if (from_left) {
+        t_node_ptr const other{static_cast<t_node_ptr>(node->m_right)};
+        right_height = tree_join_heights(right_end,
+                                         static_cast<t_node_ptr>(right_end->m_left),
+                                         right_height,
+                                         node,
+                                         other,
+                                         tree_child_black_height(other, node_height, node_black));
+      } else {
+        t_node_ptr const other{static_cast<t_node_ptr>(node->m_left)};
+        left_height = tree_join_heights(left_end,
+                                        other,
+                                        tree_child_black_height(other, node_height, node_black),
+                                        node,
+                                        static_cast<t_node_ptr>(left_end->m_left),
+                                        left_height);
+      }
+    }
+    if (left_end->m_left != nullptr) {
+      left_end->m_left->m_parent   = left_end;
+      left_end->m_left->m_is_black = true;
+    }
+  }
+
+  /**
+   * @brief Builds the perfectly balanced subtree from the first num nodes of the sorted list linked by m_right.
+   * Every level of the subtree except the deepest one is full, the nodes at the deepest level red_depth are colored
+   * red and all the others black, so every path has the same black height.
+   * Postcondition: list points to the node after the used ones.
+   *
+   * @tparam t_node_ptr
+   * @param list the sorted list of nodes, linked by m_right.
+   * @param num the number of nodes in the subtree.
+   * @param depth the depth of the subtree root.
+   * @param red_depth the depth of the red nodes.
+   * @return the root of the subtree.
+   */
+  template<class t_node_ptr>
+  t_node_ptr tree_build_from_list(t_node_ptr &list, ::portable_stl::size_t num, unsigned depth, unsigned red_depth) {
+    if (0U == num) {
+      return nullptr;
+    }
+    ::portable_stl::size_t const left_num{(num - 1U) / 2U};
+
+    t_node_ptr left_node  = tree_build_from_list(list, left_num, depth + 1U, red_depth);
+    t_node_ptr node       = list;
+    list                  = list->m_right;
+    t_node_ptr right_node = tree_build_from_list(list, num - 1U - left_num, depth + 1U, red_depth);
+
+    node->m_left     = left_node;
+    node->m_right    = right_node;
+    node->m_is_black = (depth != red_depth);
+    tree_size_set(node, num, typename tree_has_size<t_node_ptr>::type{});
+    if (left_node != nullptr) {
+      left_node->set_parent(node);
+    }
+    if (right_node != nullptr) {
+      right_node->set_parent(node);
+    }
+    return node;
+  }
+
+  /**
+   * @brief Builds the balanced red black tree from the sorted list of nodes linked by m_right in O(num).
+   * The recursion depth is O(log(num)).
+   * Postcondition: the root parent is not set, the caller links it to the end_node.
+   *
+   * @tparam t_node_ptr
+   * @param list the sorted list of nodes, linked by m_right.
+   * @param num the number of nodes in the list.
+   * @return the root of the tree.
+   */
+  template<class t_node_ptr> t_node_ptr tree_build_balanced(t_node_ptr list, ::portable_stl::size_t num) {
+    if (0U == num) {
+      return nullptr;
+    }
+    // depth of the deepest level of the balanced tree (floor(log2(num)))
+    unsigned red_depth{0U};
+    for (::portable_stl::size_t rest{num}; rest > 1U; rest >>= 1U) {
+      ++red_depth;
+    }
+    t_node_ptr root  = tree_build_from_list(list, num, 0U, red_depth);
+    root->m_is_black = true;
+    return root;
+  }
 } // namespace tree_ns
 
 } // namespace portable_stl
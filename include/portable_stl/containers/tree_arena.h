@@ -0,0 +1,81 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="tree_arena.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_TREE_ARENA_H
+#define PSTL_TREE_ARENA_H
+
+#include "../common/size_t.h"
+#include "../memory/to_address.h"
+
+namespace portable_stl {
+namespace tree_ns {
+
+  /**
+   * @brief Header of the node block made by tree::compact().
+   * The block is allocated as m_capacity + 1 nodes, the header takes the place of the first one and the tree nodes
+   * are placed in the rest. The blocks of the tree are linked into a list.
+   *
+   * @tparam t_node_pointer the type of a pointer to the tree node.
+   * @tparam t_size_type the size type.
+   */
+  template<class t_node_pointer, class t_size_type> class tree_arena_header final {
+  public:
+    /**
+     * @brief The next block of the tree.
+     */
+    t_node_pointer m_next;
+
+    /**
+     * @brief The number of node places in the block.
+     */
+    t_size_type m_capacity;
+
+    /**
+     * @brief The number of nodes of the tree placed in the block.
+     */
+    t_size_type m_live;
+
+    /**
+     * @brief The number of nodes of the block leaving the tree, counted by tree::split().
+     */
+    t_size_type m_leaving;
+
+    /**
+     * @brief Constructs the header of the empty block.
+     *
+     * @param next the next block of the tree.
+     * @param capacity the number of node places in the block.
+     */
+    tree_arena_header(t_node_pointer next, t_size_type capacity) noexcept
+        : m_next(next), m_capacity(capacity), m_live(0U), m_leaving(0U) {
+    }
+
+    /**
+     * @brief Checks whether the node is placed in the block. The addresses are compared as integers, since the
+     * built-in comparison of the pointers to unrelated objects is unspecified.
+     *
+     * @param block the block of this header.
+     * @param node_ptr the node.
+     * @return true if node_ptr is one of the node places of the block.
+     */
+    bool contains(t_node_pointer block, t_node_pointer node_ptr) const noexcept {
+      ::portable_stl::size_t const first{
+        reinterpret_cast<::portable_stl::size_t>(::portable_stl::to_address(block + 1))};
+      ::portable_stl::size_t const last{
+        reinterpret_cast<::portable_stl::size_t>(::portable_stl::to_address(block + m_capacity))};
+      ::portable_stl::size_t const node{reinterpret_cast<::portable_stl::size_t>(::portable_stl::to_address(node_ptr))};
+      return (first <= node) && (node <= last);
+    }
+  };
+} // namespace tree_ns
+} // namespace portable_stl
+
+#endif // PSTL_TREE_ARENA_H
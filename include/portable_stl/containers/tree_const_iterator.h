@@ -226,9 +226,9 @@ private:
     return static_cast<t_node_pointer>(m_ptr);
   }
 
-  template<class, class, class> friend class tree;
-  template<class, class, class, class> friend class map;
-  template<class, class, class, class> friend class multimap;
+  template<class, class, class, class> friend class tree;
+  template<class, class, class, class, class> friend class map;
+  template<class, class, class, class, class> friend class multimap;
   template<class, class, class> friend class set;
   template<class, class, class> friend class multiset;
   template<class> friend class map_const_iterator;
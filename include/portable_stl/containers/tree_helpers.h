@@ -26,13 +26,15 @@ namespace tree_helper {
    *
    * @tparam t_value_type
    * @tparam t_void_ptr Void pointer type.
+   * @tparam t_node_policy Node policy type.
    */
-  template<class t_value_type, class t_void_ptr> struct make_tree_node_types {
+  template<class t_value_type, class t_void_ptr, class t_node_policy = ::portable_stl::tree_plain_node_policy>
+  struct make_tree_node_types {
   private:
     /**
      * @brief Additional alias for msvc.
      */
-    using t_tree_node = ::portable_stl::tree_node<t_value_type, t_void_ptr>;
+    using t_tree_node = ::portable_stl::tree_node<t_value_type, t_void_ptr, t_node_policy>;
 
   public:
     /**
@@ -21,8 +21,10 @@ namespace portable_stl {
  *
  * @tparam t_type Stored value type.
  * @tparam t_void_ptr Void pointer type.
+ * @tparam t_node_policy Node policy type.
  */
-template<class t_type, class t_void_ptr> class tree_node : public tree_node_base<t_void_ptr> {
+template<class t_type, class t_void_ptr, class t_node_policy = ::portable_stl::tree_plain_node_policy>
+class tree_node : public tree_node_base<t_void_ptr, t_node_policy> {
 public:
   /**
    * @brief Node's value type.
@@ -20,9 +20,12 @@ namespace portable_stl {
  * @brief RB-tree base node type, represented tree structure.
  *
  * @tparam t_void_ptr
+ * @tparam t_node_policy Node policy type.
  */
-template<class t_void_ptr> class tree_node_base : public tree_node_base_types<t_void_ptr>::t_end_node_type {
-  using t_node_base_type = tree_node_base_types<t_void_ptr>;
+template<class t_void_ptr, class t_node_policy = ::portable_stl::tree_plain_node_policy>
+class tree_node_base : public t_node_policy::template node_base<
+                         typename tree_node_base_types<t_void_ptr, t_node_policy>::t_end_node_type> {
+  using t_node_base_type = tree_node_base_types<t_void_ptr, t_node_policy>;
 
 public:
   /**
@@ -18,18 +18,20 @@
 #include "../metaprogramming/primary_type/is_pointer.h"
 #include "../metaprogramming/type_relations/is_same.h"
 #include "tree_end_node.h"
+#include "tree_node_policy.h"
 // #include "tree_node_base.h"
 
 namespace portable_stl {
 
-template<class t_void_ptr> class tree_node_base;
+template<class t_void_ptr, class t_node_policy> class tree_node_base;
 
 /**
  * @brief Tree node base types traits.
  *
  * @tparam t_void_ptr Given void pointer type.
+ * @tparam t_node_policy Node policy type.
  */
-template<class t_void_ptr> class tree_node_base_types {
+template<class t_void_ptr, class t_node_policy = ::portable_stl::tree_plain_node_policy> class tree_node_base_types {
 public:
   /**
    * @brief Void pointer type (from allocator).
@@ -40,7 +42,7 @@ public:
    * @brief Type of an base node in a tree.
    *
    */
-  using t_node_base_type    = ::portable_stl::tree_node_base<t_void_pointer>;
+  using t_node_base_type    = ::portable_stl::tree_node_base<t_void_pointer, t_node_policy>;
   /**
    * @brief Type of a pointer to then base node in a tree.
    *
@@ -62,6 +62,13 @@ public:
    */
   bool m_value_constructed;
 
+  /**
+   * @brief Flag, the node storage is deallocated. It is not when the node is placed in a block made by
+   * tree::compact().
+   *
+   */
+  bool m_deallocate;
+
   /**
    * @brief Copy constructor.
    *
@@ -80,9 +87,10 @@ public:
    *
    * @param node_alloc Given node allocator.
    * @param constrcuted Is node's value constructed.
+   * @param deallocate Is node's storage deallocated.
    */
-  explicit tree_node_destructor(allocator_type &node_alloc, bool constrcuted = false) noexcept
-      : m_node_alloc(node_alloc), m_value_constructed(constrcuted) {
+  explicit tree_node_destructor(allocator_type &node_alloc, bool constrcuted = false, bool deallocate = true) noexcept
+      : m_node_alloc(node_alloc), m_value_constructed(constrcuted), m_deallocate(deallocate) {
   }
 
   /**
@@ -96,7 +104,7 @@ public:
     if (m_value_constructed) {
       t_alloc_traits::destroy(m_node_alloc, t_node_types::get_ptr(ptr->m_value));
     }
-    if (ptr) {
+    if (ptr && m_deallocate) {
       t_alloc_traits::deallocate(m_node_alloc, ptr, 1);
     }
     return {};
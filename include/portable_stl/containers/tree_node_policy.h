@@ -0,0 +1,64 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="tree_node_policy.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_TREE_NODE_POLICY_H
+#define PSTL_TREE_NODE_POLICY_H
+
+#include "../common/size_t.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Default tree node policy, the node keeps only the tree structure.
+ *
+ */
+class tree_plain_node_policy final {
+public:
+  /**
+   * @brief Base of the tree node.
+   *
+   * @tparam t_end_node_type Type of the end node.
+   */
+  template<class t_end_node_type> using node_base = t_end_node_type;
+};
+
+/**
+ * @brief Base of the order statistic tree node.
+ *
+ * @tparam t_end_node_type Type of the end node.
+ */
+template<class t_end_node_type> class tree_rank_node_base : public t_end_node_type {
+public:
+  /**
+   * @brief The number of nodes in the subtree of the node, including the node itself.
+   *
+   */
+  ::portable_stl::size_t m_size;
+};
+
+/**
+ * @brief Order statistic tree node policy. Every node keeps the size of its subtree, so the tree finds the k-th
+ * element and the rank of the key in O(log(n)). The sizes are updated by the insert, erase and rotations.
+ *
+ */
+class tree_rank_node_policy final {
+public:
+  /**
+   * @brief Base of the tree node.
+   *
+   * @tparam t_end_node_type Type of the end node.
+   */
+  template<class t_end_node_type> using node_base = ::portable_stl::tree_rank_node_base<t_end_node_type>;
+};
+
+} // namespace portable_stl
+
+#endif // PSTL_TREE_NODE_POLICY_H
@@ -26,16 +26,16 @@ namespace portable_stl {
 template<class t_node_ptr, class t_node_type = typename ::portable_stl::pointer_traits<t_node_ptr>::element_type>
 struct tree_node_types;
 
-template<class t_node_ptr, class t_type, class t_void_ptr>
-struct tree_node_types<t_node_ptr, ::portable_stl::tree_node<t_type, t_void_ptr>>
-    : public tree_node_base_types<t_void_ptr>
+template<class t_node_ptr, class t_type, class t_void_ptr, class t_node_policy>
+struct tree_node_types<t_node_ptr, ::portable_stl::tree_node<t_type, t_void_ptr, t_node_policy>>
+    : public tree_node_base_types<t_void_ptr, t_node_policy>
     , tree_key_value_types<t_type>
     , tree_map_pointer_types<t_type, t_void_ptr> {
   /**
    * @brief Tree's base node types.
    *
    */
-  using t_base             = ::portable_stl::tree_node_base_types<t_void_ptr>;
+  using t_base             = ::portable_stl::tree_node_base_types<t_void_ptr, t_node_policy>;
   /**
    * @brief Tree's node keys types.
    *
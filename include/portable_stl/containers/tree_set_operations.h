@@ -0,0 +1,298 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="tree_set_operations.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_TREE_SET_OPERATIONS_H
+#define PSTL_TREE_SET_OPERATIONS_H
+
+#include "../algorithm/copy.h"
+#include "../utility/tuple/tuple_get.h"
+
+namespace portable_stl {
+namespace tree_helper {
+  /**
+   * @brief Key getter for the containers storing bare keys.
+   */
+  class tree_value_key final {
+  public:
+    /**
+     * @brief Returns the key of the element.
+     * @tparam t_value the type of the element.
+     * @param value the element.
+     * @return the element itself.
+     */
+    template<class t_value> t_value const &operator()(t_value const &value) const noexcept {
+      return value;
+    }
+  };
+
+  /**
+   * @brief Key getter for the containers storing key-value tuples.
+   */
+  class tree_pair_key final {
+  public:
+    /**
+     * @brief Returns the key of the element.
+     * @tparam t_value the type of the element.
+     * @param value the element.
+     * @return the first element of the tuple.
+     */
+    template<class t_value>
+    auto operator()(t_value const &value) const noexcept -> decltype(::portable_stl::get<0>(value)) {
+      return ::portable_stl::get<0>(value);
+    }
+  };
+
+  /**
+   * @brief Skips the elements of the container starting from iter which are less than key_value.
+   * The element at iter must be less than key_value. The next element is checked first, so interleaved containers are
+   * walked element by element, and only a longer run is skipped by finger search.
+   *
+   * @tparam t_container the type of the container.
+   * @tparam t_key_type the type of the key.
+   * @param container the walked container.
+   * @param iter the current position.
+   * @param key_value the key to compare the elements to.
+   * @param get_key the key getter.
+   * @return the first element after iter which is not less than key_value, or end().
+   */
+  template<class t_container, class t_key_type, class t_get_key>
+  typename t_container::const_iterator tree_skip_less(t_container const                   &container,
+                                                      typename t_container::const_iterator iter,
+                                                      t_key_type const                    &key_value,
+                                                      t_get_key                           &get_key) {
+    ++iter;
+    if ((iter != container.end()) && container.key_comp()(get_key(*iter), key_value)) {
+      iter = container.lower_bound_from(iter, key_value);
+    }
+    return iter;
+  }
+
+  /**
+   * @brief Copies the elements found in either of the containers to out.
+   *
+   * @tparam t_container the type of the containers.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_get_key the type of the key getter.
+   * @param lhv the first container.
+   * @param rhv the second container.
+   * @param out the beginning of the destination range.
+   * @param get_key the key getter.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_container, class t_output_iterator, class t_get_key>
+  t_output_iterator tree_set_union(
+    t_container const &lhv, t_container const &rhv, t_output_iterator out, t_get_key get_key) {
+    using const_iterator = typename t_container::const_iterator;
+
+    auto           comp = lhv.key_comp();
+    const_iterator iter1{lhv.begin()};
+    const_iterator iter2{rhv.begin()};
+    while ((iter1 != lhv.end()) && (iter2 != rhv.end())) {
+      if (comp(get_key(*iter1), get_key(*iter2))) {
+        const_iterator const run_end{::portable_stl::tree_helper::tree_skip_less(lhv, iter1, get_key(*iter2), get_key)};
+        out   = ::portable_stl::copy(iter1, run_end, out);
+        iter1 = run_end;
+      } else if (comp(get_key(*iter2), get_key(*iter1))) {
+        const_iterator const run_end{::portable_stl::tree_helper::tree_skip_less(rhv, iter2, get_key(*iter1), get_key)};
+        out   = ::portable_stl::copy(iter2, run_end, out);
+        iter2 = run_end;
+      } else {
+        *out = *iter1;
+        ++out;
+        ++iter1;
+        ++iter2;
+      }
+    }
+    return ::portable_stl::copy(iter2, rhv.end(), ::portable_stl::copy(iter1, lhv.end(), out));
+  }
+
+  /**
+   * @brief Copies the elements of lhv found in rhv to out.
+   *
+   * @tparam t_container the type of the containers.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_get_key the type of the key getter.
+   * @param lhv the first container.
+   * @param rhv the second container.
+   * @param out the beginning of the destination range.
+   * @param get_key the key getter.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_container, class t_output_iterator, class t_get_key>
+  t_output_iterator tree_set_intersection(
+    t_container const &lhv, t_container const &rhv, t_output_iterator out, t_get_key get_key) {
+    using const_iterator = typename t_container::const_iterator;
+
+    auto           comp = lhv.key_comp();
+    const_iterator iter1{lhv.begin()};
+    const_iterator iter2{rhv.begin()};
+    while ((iter1 != lhv.end()) && (iter2 != rhv.end())) {
+      if (comp(get_key(*iter1), get_key(*iter2))) {
+        iter1 = ::portable_stl::tree_helper::tree_skip_less(lhv, iter1, get_key(*iter2), get_key);
+      } else if (comp(get_key(*iter2), get_key(*iter1))) {
+        iter2 = ::portable_stl::tree_helper::tree_skip_less(rhv, iter2, get_key(*iter1), get_key);
+      } else {
+        *out = *iter1;
+        ++out;
+        ++iter1;
+        ++iter2;
+      }
+    }
+    return out;
+  }
+
+  /**
+   * @brief Copies the elements of lhv not found in rhv to out.
+   *
+   * @tparam t_container the type of the containers.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_get_key the type of the key getter.
+   * @param lhv the first container.
+   * @param rhv the second container.
+   * @param out the beginning of the destination range.
+   * @param get_key the key getter.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_container, class t_output_iterator, class t_get_key>
+  t_output_iterator tree_set_difference(
+    t_container const &lhv, t_container const &rhv, t_output_iterator out, t_get_key get_key) {
+    using const_iterator = typename t_container::const_iterator;
+
+    auto           comp = lhv.key_comp();
+    const_iterator iter1{lhv.begin()};
+    const_iterator iter2{rhv.begin()};
+    while ((iter1 != lhv.end()) && (iter2 != rhv.end())) {
+      if (comp(get_key(*iter1), get_key(*iter2))) {
+        const_iterator const run_end{::portable_stl::tree_helper::tree_skip_less(lhv, iter1, get_key(*iter2), get_key)};
+        out   = ::portable_stl::copy(iter1, run_end, out);
+        iter1 = run_end;
+      } else if (comp(get_key(*iter2), get_key(*iter1))) {
+        iter2 = ::portable_stl::tree_helper::tree_skip_less(rhv, iter2, get_key(*iter1), get_key);
+      } else {
+        ++iter1;
+        ++iter2;
+      }
+    }
+    return ::portable_stl::copy(iter1, lhv.end(), out);
+  }
+
+  /**
+   * @brief Copies the elements found in exactly one of the containers to out.
+   *
+   * @tparam t_container the type of the containers.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_get_key the type of the key getter.
+   * @param lhv the first container.
+   * @param rhv the second container.
+   * @param out the beginning of the destination range.
+   * @param get_key the key getter.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_container, class t_output_iterator, class t_get_key>
+  t_output_iterator tree_set_symmetric_difference(
+    t_container const &lhv, t_container const &rhv, t_output_iterator out, t_get_key get_key) {
+    using const_iterator = typename t_container::const_iterator;
+
+    auto           comp = lhv.key_comp();
+    const_iterator iter1{lhv.begin()};
+    const_iterator iter2{rhv.begin()};
+    while ((iter1 != lhv.end()) && (iter2 != rhv.end())) {
+      if (comp(get_key(*iter1), get_key(*iter2))) {
+        const_iterator const run_end{::portable_stl::tree_helper::tree_skip_less(lhv, iter1, get_key(*iter2), get_key)};
+        out   = ::portable_stl::copy(iter1, run_end, out);
+        iter1 = run_end;
+      } else if (comp(get_key(*iter2), get_key(*iter1))) {
+        const_iterator const run_end{::portable_stl::tree_helper::tree_skip_less(rhv, iter2, get_key(*iter1), get_key)};
+        out   = ::portable_stl::copy(iter2, run_end, out);
+        iter2 = run_end;
+      } else {
+        ++iter1;
+        ++iter2;
+      }
+    }
+    return ::portable_stl::copy(iter2, rhv.end(), ::portable_stl::copy(iter1, lhv.end(), out));
+  }
+
+  /**
+   * @brief Copies the elements of both containers to out, the element of lhv precedes the equivalent element of rhv.
+   *
+   * @tparam t_container the type of the containers.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_get_key the type of the key getter.
+   * @param lhv the first container.
+   * @param rhv the second container.
+   * @param out the beginning of the destination range.
+   * @param get_key the key getter.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_container, class t_output_iterator, class t_get_key>
+  t_output_iterator tree_merge(
+    t_container const &lhv, t_container const &rhv, t_output_iterator out, t_get_key get_key) {
+    using const_iterator = typename t_container::const_iterator;
+
+    auto           comp = lhv.key_comp();
+    const_iterator iter1{lhv.begin()};
+    const_iterator iter2{rhv.begin()};
+    while ((iter1 != lhv.end()) && (iter2 != rhv.end())) {
+      if (comp(get_key(*iter2), get_key(*iter1))) {
+        const_iterator const run_end{::portable_stl::tree_helper::tree_skip_less(rhv, iter2, get_key(*iter1), get_key)};
+        out   = ::portable_stl::copy(iter2, run_end, out);
+        iter2 = run_end;
+      } else {
+        // the keys are unique, so the run ends at most one element after the elements less than the key of iter2
+        const_iterator run_end{iter1};
+        if (comp(get_key(*iter1), get_key(*iter2))) {
+          run_end = ::portable_stl::tree_helper::tree_skip_less(lhv, iter1, get_key(*iter2), get_key);
+        }
+        if ((run_end != lhv.end()) && !comp(get_key(*iter2), get_key(*run_end))) {
+          ++run_end;
+        }
+        out   = ::portable_stl::copy(iter1, run_end, out);
+        iter1 = run_end;
+      }
+    }
+    return ::portable_stl::copy(iter2, rhv.end(), ::portable_stl::copy(iter1, lhv.end(), out));
+  }
+
+  /**
+   * @brief Checks if every element of rhv is found in lhv.
+   *
+   * @tparam t_container the type of the containers.
+   * @tparam t_get_key the type of the key getter.
+   * @param lhv the first container.
+   * @param rhv the second container.
+   * @param get_key the key getter.
+   * @return true if rhv is a subset of lhv, false otherwise.
+   */
+  template<class t_container, class t_get_key>
+  bool tree_includes(t_container const &lhv, t_container const &rhv, t_get_key get_key) {
+    using const_iterator = typename t_container::const_iterator;
+
+    if (lhv.size() < rhv.size()) {
+      return false;
+    }
+    auto           comp = lhv.key_comp();
+    const_iterator iter1{lhv.begin()};
+    for (const_iterator iter2{rhv.begin()}; iter2 != rhv.end(); ++iter2) {
+      if ((iter1 != lhv.end()) && comp(get_key(*iter1), get_key(*iter2))) {
+        iter1 = ::portable_stl::tree_helper::tree_skip_less(lhv, iter1, get_key(*iter2), get_key);
+      }
+      if ((iter1 == lhv.end()) || comp(get_key(*iter2), get_key(*iter1))) {
+        return false;
+      }
+      ++iter1;
+    }
+    return true;
+  }
+} // namespace tree_helper
+} // namespace portable_stl
+
+#endif // PSTL_TREE_SET_OPERATIONS_H
@@ -0,0 +1,43 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="atomic.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_ATOMIC_H
+#define PSTL_EXECUTION_ATOMIC_H
+
+#if defined(_MSC_VER)
+#  include "msvc/atomic_impl.h"
+#else // clang and gcc
+#  include "gcc_clang/atomic_impl.h"
+#endif
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief Reads the value shared between the threads.
+   * @param object the shared value.
+   * @return the value, the writes made before the value was stored are visible.
+   */
+  inline ::portable_stl::size_t shared_load(::portable_stl::size_t const *object) noexcept {
+    return ::portable_stl::execution_helper::atomic_load(object);
+  }
+
+  /**
+   * @brief Atomically replaces the value shared between the threads with the minimum of it and the given value.
+   * @param object the shared value.
+   * @param value the value to compare with.
+   */
+  inline void shared_store_min(::portable_stl::size_t *object, ::portable_stl::size_t value) noexcept {
+    ::portable_stl::execution_helper::atomic_fetch_min(object, value);
+  }
+} // namespace execution_helper
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_ATOMIC_H
@@ -0,0 +1,102 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="copy.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_COPY_H
+#define PSTL_EXECUTION_COPY_H
+
+#include "../algorithm/copy.h"
+#include "../common/size_t.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief copy for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_input_iterator the type of the input iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param result the beginning of the output range.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_execution_policy, class t_input_iterator, class t_output_iterator>
+  t_output_iterator copy_dispatch(t_execution_policy const &,
+                                  t_input_iterator  first,
+                                  t_input_iterator  last,
+                                  t_output_iterator result,
+                                  ::portable_stl::false_type) {
+    return ::portable_stl::copy(first, last, result);
+  }
+
+  /**
+   * @brief copy for the random access iterators: the chunks are copied in parallel.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator1 the type of the input iterator.
+   * @tparam t_random_access_iterator2 the type of the output iterator.
+   * @param policy the execution policy.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param result the beginning of the output range.
+   * @return the iterator past the last copied element.
+   */
+  template<class t_execution_policy, class t_random_access_iterator1, class t_random_access_iterator2>
+  t_random_access_iterator2 copy_dispatch(t_execution_policy const &policy,
+                                          t_random_access_iterator1 first,
+                                          t_random_access_iterator1 last,
+                                          t_random_access_iterator2 result,
+                                          ::portable_stl::true_type) {
+    auto const                                 size = static_cast<::portable_stl::size_t>(last - first);
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      return ::portable_stl::copy(first, last, result);
+    }
+
+    auto task = [first, result](::portable_stl::size_t, ::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      static_cast<void>(::portable_stl::copy(first + begin, first + end, result + begin));
+    };
+    ::portable_stl::execution_helper::parallel_for(*exec, parallel_split(*exec, size), task);
+    return result + (last - first);
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Copies the elements of the range [first, last) to the range beginning at result according to the policy.
+ * The ranges must not overlap. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator the type of the input iterator.
+ * @tparam t_output_iterator the type of the output iterator.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param result the beginning of the output range.
+ * @return the iterator past the last copied element.
+ */
+template<class t_execution_policy,
+         class t_input_iterator,
+         class t_output_iterator,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+t_output_iterator copy(t_execution_policy &&policy,
+                       t_input_iterator     first,
+                       t_input_iterator     last,
+                       t_output_iterator    result) {
+  return ::portable_stl::execution_helper::copy_dispatch(
+    policy,
+    first,
+    last,
+    result,
+    ::portable_stl::execution_helper::is_parallel_iterators<t_input_iterator, t_output_iterator>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_COPY_H
@@ -0,0 +1,71 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="default_executor.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_DEFAULT_EXECUTOR_H
+#define PSTL_DEFAULT_EXECUTOR_H
+
+#include "executor.h"
+
+#if defined(__linux__)
+#  include "pthread_executor.h"
+#else
+#  include "inline_executor.h"
+#endif
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief Returns the built-in executor: the pool of all online processors on Linux, the calling thread otherwise.
+   * The pool is started on the first call.
+   * @return the built-in executor.
+   */
+  inline ::portable_stl::execution::executor &builtin_executor() noexcept {
+#if defined(__linux__)
+    static ::portable_stl::execution::pthread_executor instance;
+#else
+    static ::portable_stl::execution::inline_executor instance;
+#endif
+    return instance;
+  }
+
+  /**
+   * @brief Returns the storage of the executor installed by set_default_executor.
+   * @return reference to the pointer to the installed executor, nullptr if none.
+   */
+  inline ::portable_stl::execution::executor *&installed_executor() noexcept {
+    static ::portable_stl::execution::executor *instance{nullptr};
+    return instance;
+  }
+} // namespace execution_helper
+
+namespace execution {
+  /**
+   * @brief Returns the executor used by par and par_unseq without the explicit executor.
+   * @return the executor installed by set_default_executor or the built-in executor.
+   */
+  inline ::portable_stl::execution::executor &default_executor() noexcept {
+    ::portable_stl::execution::executor *const installed{::portable_stl::execution_helper::installed_executor()};
+    return (nullptr != installed) ? *installed : ::portable_stl::execution_helper::builtin_executor();
+  }
+
+  /**
+   * @brief Replaces the executor used by par and par_unseq without the explicit executor.
+   * The call is not synchronized with the running algorithms, it is intended for the program startup.
+   * The executor must outlive its use by the algorithms.
+   * @param exec the new default executor, nullptr restores the built-in executor.
+   */
+  inline void set_default_executor(::portable_stl::execution::executor *exec) noexcept {
+    ::portable_stl::execution_helper::installed_executor() = exec;
+  }
+} // namespace execution
+} // namespace portable_stl
+
+#endif // PSTL_DEFAULT_EXECUTOR_H
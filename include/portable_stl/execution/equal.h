@@ -0,0 +1,199 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="equal.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_EQUAL_H
+#define PSTL_EXECUTION_EQUAL_H
+
+#include "../algorithm/equal.h"
+#include "../algorithm/mismatch.h"
+#include "../common/size_t.h"
+#include "../iterator/distance.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../utility/tuple/tuple_get.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief equal for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_input_iterator1 the type of the first iterator.
+   * @tparam t_input_iterator2 the type of the second iterator.
+   * @tparam t_binary_predicate the type of the predicate.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param pred the predicate which returns true if the elements are equal.
+   * @return true if the ranges are equal.
+   */
+  template<class t_execution_policy, class t_input_iterator1, class t_input_iterator2, class t_binary_predicate>
+  bool equal_dispatch(t_execution_policy const &,
+                      t_input_iterator1   first1,
+                      t_input_iterator1   last1,
+                      t_input_iterator2   first2,
+                      t_binary_predicate &pred,
+                      ::portable_stl::false_type) {
+    return ::portable_stl::equal(first1, last1, first2, pred);
+  }
+
+  /**
+   * @brief equal for the random access iterators: the chunks are compared in parallel, the comparison stops in the
+   * chunks after the found mismatch.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator1 the type of the first iterator.
+   * @tparam t_random_access_iterator2 the type of the second iterator.
+   * @tparam t_binary_predicate the type of the predicate.
+   * @param policy the execution policy.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param pred the predicate which returns true if the elements are equal.
+   * @return true if the ranges are equal.
+   */
+  template<class t_execution_policy,
+           class t_random_access_iterator1,
+           class t_random_access_iterator2,
+           class t_binary_predicate>
+  bool equal_dispatch(t_execution_policy const &policy,
+                      t_random_access_iterator1 first1,
+                      t_random_access_iterator1 last1,
+                      t_random_access_iterator2 first2,
+                      t_binary_predicate       &pred,
+                      ::portable_stl::true_type) {
+    auto const                                 size = static_cast<::portable_stl::size_t>(last1 - first1);
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      return ::portable_stl::equal(first1, last1, first2, pred);
+    }
+
+    auto search = [first1, first2, &pred](::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      return static_cast<::portable_stl::size_t>(
+        ::portable_stl::get<0>(::portable_stl::mismatch(first1 + begin, first1 + end, first2 + begin, pred)) - first1);
+    };
+    return size == ::portable_stl::execution_helper::parallel_find_first(*exec, size, search);
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Checks whether the range [first1, last1) is equal to the range [first2, first2 + (last1 - first1)) according
+ * to the policy. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator1 the type of the first iterator.
+ * @tparam t_input_iterator2 the type of the second iterator.
+ * @tparam t_binary_predicate the type of the predicate.
+ * @param policy the execution policy.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param pred the predicate which returns true if the elements are equal.
+ * @return true if the ranges are equal.
+ */
+template<class t_execution_policy,
+         class t_input_iterator1,
+         class t_input_iterator2,
+         class t_binary_predicate,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+bool equal(t_execution_policy &&policy,
+           t_input_iterator1    first1,
+           t_input_iterator1    last1,
+           t_input_iterator2    first2,
+           t_binary_predicate   pred) {
+  return ::portable_stl::execution_helper::equal_dispatch(
+    policy,
+    first1,
+    last1,
+    first2,
+    pred,
+    ::portable_stl::execution_helper::is_parallel_iterators<t_input_iterator1, t_input_iterator2>{});
+}
+
+/**
+ * @brief Checks whether the range [first1, last1) is equal to the range [first2, first2 + (last1 - first1)) according
+ * to the policy. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator1 the type of the first iterator.
+ * @tparam t_input_iterator2 the type of the second iterator.
+ * @param policy the execution policy.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @return true if the ranges are equal.
+ */
+template<class t_execution_policy,
+         class t_input_iterator1,
+         class t_input_iterator2,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+bool equal(t_execution_policy &&policy, t_input_iterator1 first1, t_input_iterator1 last1, t_input_iterator2 first2) {
+  return ::portable_stl::equal(policy, first1, last1, first2, ::portable_stl::algorithm_helper::equal_to_inter{});
+}
+
+/**
+ * @brief Checks whether the range [first1, last1) is equal to the range [first2, last2) according to the policy.
+ * The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_forward_iterator1 the type of the first iterator.
+ * @tparam t_forward_iterator2 the type of the second iterator.
+ * @tparam t_binary_predicate the type of the predicate.
+ * @param policy the execution policy.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @param pred the predicate which returns true if the elements are equal.
+ * @return true if the ranges have the same length and are equal.
+ */
+template<class t_execution_policy,
+         class t_forward_iterator1,
+         class t_forward_iterator2,
+         class t_binary_predicate,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+bool equal(t_execution_policy &&policy,
+           t_forward_iterator1  first1,
+           t_forward_iterator1  last1,
+           t_forward_iterator2  first2,
+           t_forward_iterator2  last2,
+           t_binary_predicate   pred) {
+  return (::portable_stl::distance(first1, last1) == ::portable_stl::distance(first2, last2))
+      && ::portable_stl::equal(policy, first1, last1, first2, pred);
+}
+
+/**
+ * @brief Checks whether the range [first1, last1) is equal to the range [first2, last2) according to the policy.
+ * The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_forward_iterator1 the type of the first iterator.
+ * @tparam t_forward_iterator2 the type of the second iterator.
+ * @param policy the execution policy.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @return true if the ranges have the same length and are equal.
+ */
+template<class t_execution_policy,
+         class t_forward_iterator1,
+         class t_forward_iterator2,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+bool equal(t_execution_policy &&policy,
+           t_forward_iterator1  first1,
+           t_forward_iterator1  last1,
+           t_forward_iterator2  first2,
+           t_forward_iterator2  last2) {
+  return ::portable_stl::equal(
+    policy, first1, last1, first2, last2, ::portable_stl::algorithm_helper::equal_to_inter{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_EQUAL_H
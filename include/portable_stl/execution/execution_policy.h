@@ -0,0 +1,185 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="execution_policy.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_POLICY_H
+#define PSTL_EXECUTION_POLICY_H
+
+#include "../metaprogramming/helper/integral_constant.h"
+#include "default_executor.h"
+#include "executor.h"
+
+namespace portable_stl {
+namespace execution {
+  /**
+   * @brief Execution policy type: the algorithm runs on the calling thread.
+   */
+  class sequenced_policy final {};
+
+  /**
+   * @brief Execution policy type: the algorithm may split the work between the threads of the executor.
+   * The element access functions are called in the indeterminately sequenced order in the executor threads.
+   */
+  class parallel_policy final {
+    /**
+     * @brief The executor, nullptr for the default executor.
+     */
+    ::portable_stl::execution::executor *m_executor;
+
+  public:
+    /**
+     * @brief Constructs the policy which uses the default executor.
+     */
+    constexpr parallel_policy() noexcept : m_executor(nullptr) {
+    }
+
+    /**
+     * @brief Constructs the policy which uses the given executor.
+     * @param exec the executor.
+     */
+    constexpr explicit parallel_policy(::portable_stl::execution::executor &exec) noexcept : m_executor(&exec) {
+    }
+
+    /**
+     * @brief Returns the policy which uses the given executor.
+     * @param exec the executor.
+     * @return the new policy.
+     */
+    constexpr parallel_policy on(::portable_stl::execution::executor &exec) const noexcept {
+      return parallel_policy(exec);
+    }
+
+    /**
+     * @brief Returns the executor of the policy.
+     * @return the given executor or the default executor.
+     */
+    ::portable_stl::execution::executor &get_executor() const noexcept {
+      return (nullptr != m_executor) ? *m_executor : ::portable_stl::execution::default_executor();
+    }
+  };
+
+  /**
+   * @brief Execution policy type: the algorithm may split the work between the threads of the executor and
+   * vectorize it inside the threads.
+   */
+  class parallel_unsequenced_policy final {
+    /**
+     * @brief The executor, nullptr for the default executor.
+     */
+    ::portable_stl::execution::executor *m_executor;
+
+  public:
+    /**
+     * @brief Constructs the policy which uses the default executor.
+     */
+    constexpr parallel_unsequenced_policy() noexcept : m_executor(nullptr) {
+    }
+
+    /**
+     * @brief Constructs the policy which uses the given executor.
+     * @param exec the executor.
+     */
+    constexpr explicit parallel_unsequenced_policy(::portable_stl::execution::executor &exec) noexcept
+        : m_executor(&exec) {
+    }
+
+    /**
+     * @brief Returns the policy which uses the given executor.
+     * @param exec the executor.
+     * @return the new policy.
+     */
+    constexpr parallel_unsequenced_policy on(::portable_stl::execution::executor &exec) const noexcept {
+      return parallel_unsequenced_policy(exec);
+    }
+
+    /**
+     * @brief Returns the executor of the policy.
+     * @return the given executor or the default executor.
+     */
+    ::portable_stl::execution::executor &get_executor() const noexcept {
+      return (nullptr != m_executor) ? *m_executor : ::portable_stl::execution::default_executor();
+    }
+  };
+
+  /**
+   * @brief Sequenced execution policy object.
+   */
+  constexpr sequenced_policy seq{};
+
+  /**
+   * @brief Parallel execution policy object, uses the default executor.
+   */
+  constexpr parallel_policy par{};
+
+  /**
+   * @brief Parallel unsequenced execution policy object, uses the default executor.
+   */
+  constexpr parallel_unsequenced_policy par_unseq{};
+} // namespace execution
+
+namespace execution_helper {
+  /**
+   * @brief Checks whether t_type is the execution policy type.
+   * @tparam t_type the type to check.
+   */
+  template<class t_type> class is_execution_policy final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::false_type;
+  };
+
+  /**
+   * @brief Checks whether t_type is the execution policy type.
+   * Specialization for sequenced_policy.
+   */
+  template<> class is_execution_policy<::portable_stl::execution::sequenced_policy> final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::true_type;
+  };
+
+  /**
+   * @brief Checks whether t_type is the execution policy type.
+   * Specialization for parallel_policy.
+   */
+  template<> class is_execution_policy<::portable_stl::execution::parallel_policy> final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::true_type;
+  };
+
+  /**
+   * @brief Checks whether t_type is the execution policy type.
+   * Specialization for parallel_unsequenced_policy.
+   */
+  template<> class is_execution_policy<::portable_stl::execution::parallel_unsequenced_policy> final {
+  public:
+    /**
+     * @brief Result type.
+     */
+    using type = ::portable_stl::true_type;
+  };
+} // namespace execution_helper
+
+/**
+ * @brief Checks whether t_type is the execution policy type.
+ * @tparam t_type the type to check.
+ */
+template<class t_type>
+using is_execution_policy = typename ::portable_stl::execution_helper::is_execution_policy<t_type>::type;
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_POLICY_H
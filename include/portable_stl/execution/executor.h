@@ -0,0 +1,72 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="executor.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTOR_H
+#define PSTL_EXECUTOR_H
+
+#include "../common/size_t.h"
+
+namespace portable_stl {
+namespace execution {
+  /**
+   * @brief Interface of the executors which run the parallel algorithms.
+   * The parallel algorithms split the work into independent tasks numbered from 0 and pass them to bulk_execute in
+   * one call. An implementation may run the tasks on any threads in any order, including the calling thread.
+   * The tasks of the parallel algorithms do not call the executor recursively.
+   */
+  class executor {
+  public:
+    /**
+     * @brief The task function: called as function(context, index) for every task index.
+     */
+    using task_function = void (*)(void *context, ::portable_stl::size_t index);
+
+    /**
+     * @brief Default constructor.
+     */
+    executor() noexcept = default;
+
+    /**
+     * @brief Copy constructor is deleted.
+     */
+    executor(executor const &) = delete;
+
+    /**
+     * @brief Copy assignment is deleted.
+     * @return executor&
+     */
+    executor &operator=(executor const &) = delete;
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~executor() = default;
+
+    /**
+     * @brief Returns the number of the tasks which can run at the same time.
+     * The algorithms split the work into a few times more tasks than this number.
+     * @return the number of threads available to the executor, at least 1.
+     */
+    virtual ::portable_stl::size_t concurrency() const noexcept = 0;
+
+    /**
+     * @brief Runs function(context, index) for every index in [0, count) and returns when all calls have returned.
+     * The calls must not throw.
+     * @param function the task function.
+     * @param context the context passed to the task function.
+     * @param count the number of tasks.
+     */
+    virtual void bulk_execute(task_function function, void *context, ::portable_stl::size_t count) noexcept = 0;
+  };
+} // namespace execution
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTOR_H
@@ -0,0 +1,103 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="fill_n.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_FILL_N_H
+#define PSTL_EXECUTION_FILL_N_H
+
+#include "../algorithm/fill_n.h"
+#include "../common/size_t.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief fill_n for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_type the type of the value.
+   * @param first the beginning of the range.
+   * @param count the number of elements, greater than 0.
+   * @param value the value to be assigned.
+   * @return the iterator past the last assigned element.
+   */
+  template<class t_execution_policy, class t_output_iterator, class t_type>
+  t_output_iterator fill_n_dispatch(t_execution_policy const &,
+                                    t_output_iterator      first,
+                                    ::portable_stl::size_t count,
+                                    t_type const          &value,
+                                    ::portable_stl::false_type) {
+    return ::portable_stl::fill_n(first, count, value);
+  }
+
+  /**
+   * @brief fill_n for the random access iterators: the chunks are filled in parallel.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator the type of the output iterator.
+   * @tparam t_type the type of the value.
+   * @param policy the execution policy.
+   * @param first the beginning of the range.
+   * @param count the number of elements, greater than 0.
+   * @param value the value to be assigned.
+   * @return the iterator past the last assigned element.
+   */
+  template<class t_execution_policy, class t_random_access_iterator, class t_type>
+  t_random_access_iterator fill_n_dispatch(t_execution_policy const &policy,
+                                           t_random_access_iterator  first,
+                                           ::portable_stl::size_t    count,
+                                           t_type const             &value,
+                                           ::portable_stl::true_type) {
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, count)};
+    if (nullptr == exec) {
+      return ::portable_stl::fill_n(first, count, value);
+    }
+
+    auto task = [first, &value](::portable_stl::size_t, ::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      static_cast<void>(::portable_stl::fill_n(first + begin, end - begin, value));
+    };
+    ::portable_stl::execution_helper::parallel_for(*exec, parallel_split(*exec, count), task);
+    return first + count;
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Assigns the value to the first count elements of the range beginning at first according to the policy.
+ * Does nothing if count <= 0. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_output_iterator the type of the output iterator.
+ * @tparam t_size the type of number of elements.
+ * @tparam t_type the type of the value.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param count the number of elements.
+ * @param value the value to be assigned.
+ * @return the iterator past the last assigned element if count > 0, first otherwise.
+ */
+template<class t_execution_policy,
+         class t_output_iterator,
+         class t_size,
+         class t_type,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+t_output_iterator fill_n(t_execution_policy &&policy, t_output_iterator first, t_size count, t_type const &value) {
+  if (!(count > 0)) {
+    return first;
+  }
+  return ::portable_stl::execution_helper::fill_n_dispatch(
+    policy,
+    first,
+    static_cast<::portable_stl::size_t>(count),
+    value,
+    ::portable_stl::execution_helper::is_parallel_iterators<t_output_iterator>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_FILL_N_H
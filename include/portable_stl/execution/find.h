@@ -0,0 +1,95 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="find.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_FIND_H
+#define PSTL_EXECUTION_FIND_H
+
+#include "../algorithm/find.h"
+#include "../common/size_t.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief find for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_type the type of the value.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the iterator to the element or last if there is no such element.
+   */
+  template<class t_execution_policy, class t_input_iterator, class t_type>
+  t_input_iterator find_dispatch(t_execution_policy const &,
+                                 t_input_iterator first,
+                                 t_input_iterator last,
+                                 t_type const    &value,
+                                 ::portable_stl::false_type) {
+    return ::portable_stl::find(first, last, value);
+  }
+
+  /**
+   * @brief find for the random access iterators: the chunks are searched in parallel, the search stops in the chunks
+   * after the found element.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_type the type of the value.
+   * @param policy the execution policy.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param value the value.
+   * @return the iterator to the first such element or last if there is no such element.
+   */
+  template<class t_execution_policy, class t_random_access_iterator, class t_type>
+  t_random_access_iterator find_dispatch(t_execution_policy const &policy,
+                                         t_random_access_iterator  first,
+                                         t_random_access_iterator  last,
+                                         t_type const             &value,
+                                         ::portable_stl::true_type) {
+    auto const                                 size = static_cast<::portable_stl::size_t>(last - first);
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      return ::portable_stl::find(first, last, value);
+    }
+
+    auto search = [first, &value](::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      return static_cast<::portable_stl::size_t>(::portable_stl::find(first + begin, first + end, value) - first);
+    };
+    return first + ::portable_stl::execution_helper::parallel_find_first(*exec, size, search);
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Finds the first element equal to value according to the policy.
+ * The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_type the type of the value.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value.
+ * @return the iterator to the first such element or last if there is no such element.
+ */
+template<class t_execution_policy,
+         class t_input_iterator,
+         class t_type,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+t_input_iterator find(t_execution_policy &&policy, t_input_iterator first, t_input_iterator last, t_type const &value) {
+  return ::portable_stl::execution_helper::find_dispatch(
+    policy, first, last, value, ::portable_stl::execution_helper::is_parallel_iterators<t_input_iterator>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_FIND_H
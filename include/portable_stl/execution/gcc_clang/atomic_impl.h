@@ -0,0 +1,31 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="atomic_impl.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_ATOMIC_IMPL_H
+#define PSTL_ATOMIC_IMPL_H
+#include "../../common/size_t.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  inline ::portable_stl::size_t atomic_load(::portable_stl::size_t const *object) noexcept {
+    return __atomic_load_n(object, __ATOMIC_ACQUIRE);
+  }
+
+  inline void atomic_fetch_min(::portable_stl::size_t *object, ::portable_stl::size_t value) noexcept {
+    ::portable_stl::size_t current{__atomic_load_n(object, __ATOMIC_RELAXED)};
+    while ((value < current)
+           && (!__atomic_compare_exchange_n(object, &current, value, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))) {
+    }
+  }
+} // namespace execution_helper
+} // namespace portable_stl
+
+#endif // PSTL_ATOMIC_IMPL_H
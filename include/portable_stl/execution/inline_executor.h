@@ -0,0 +1,48 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="inline_executor.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_INLINE_EXECUTOR_H
+#define PSTL_INLINE_EXECUTOR_H
+
+#include "../common/size_t.h"
+#include "executor.h"
+
+namespace portable_stl {
+namespace execution {
+  /**
+   * @brief Executor which runs the tasks one by one on the calling thread.
+   */
+  class inline_executor final : public ::portable_stl::execution::executor {
+  public:
+    /**
+     * @brief Returns the number of the tasks which can run at the same time.
+     * @return 1.
+     */
+    ::portable_stl::size_t concurrency() const noexcept override {
+      return 1U;
+    }
+
+    /**
+     * @brief Runs function(context, index) for every index in [0, count) on the calling thread.
+     * @param function the task function.
+     * @param context the context passed to the task function.
+     * @param count the number of tasks.
+     */
+    void bulk_execute(task_function function, void *context, ::portable_stl::size_t count) noexcept override {
+      for (::portable_stl::size_t index{0U}; index < count; ++index) {
+        function(context, index);
+      }
+    }
+  };
+} // namespace execution
+} // namespace portable_stl
+
+#endif // PSTL_INLINE_EXECUTOR_H
@@ -0,0 +1,158 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="lexicographical_compare.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_LEXICOGRAPHICAL_COMPARE_H
+#define PSTL_EXECUTION_LEXICOGRAPHICAL_COMPARE_H
+
+#include "../algorithm/comp.h"
+#include "../algorithm/lexicographical_compare.h"
+#include "../algorithm/min.h"
+#include "../common/size_t.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief lexicographical_compare for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_input_iterator1 the type of the first iterator.
+   * @tparam t_input_iterator2 the type of the second iterator.
+   * @tparam t_compare the type of the comparison function.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param last2 the end of the second range.
+   * @param comp the comparison function.
+   * @return true if the first range is lexicographically less than the second range.
+   */
+  template<class t_execution_policy, class t_input_iterator1, class t_input_iterator2, class t_compare>
+  bool lexicographical_compare_dispatch(t_execution_policy const &,
+                                        t_input_iterator1 first1,
+                                        t_input_iterator1 last1,
+                                        t_input_iterator2 first2,
+                                        t_input_iterator2 last2,
+                                        t_compare        &comp,
+                                        ::portable_stl::false_type) {
+    return ::portable_stl::lexicographical_compare(first1, last1, first2, last2, comp);
+  }
+
+  /**
+   * @brief lexicographical_compare for the random access iterators: the chunks of the common length are searched in
+   * parallel for the first pair of not equivalent elements.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator1 the type of the first iterator.
+   * @tparam t_random_access_iterator2 the type of the second iterator.
+   * @tparam t_compare the type of the comparison function.
+   * @param policy the execution policy.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param last2 the end of the second range.
+   * @param comp the comparison function.
+   * @return true if the first range is lexicographically less than the second range.
+   */
+  template<class t_execution_policy, class t_random_access_iterator1, class t_random_access_iterator2, class t_compare>
+  bool lexicographical_compare_dispatch(t_execution_policy const &policy,
+                                        t_random_access_iterator1 first1,
+                                        t_random_access_iterator1 last1,
+                                        t_random_access_iterator2 first2,
+                                        t_random_access_iterator2 last2,
+                                        t_compare                &comp,
+                                        ::portable_stl::true_type) {
+    auto const size1 = static_cast<::portable_stl::size_t>(last1 - first1);
+    auto const size2 = static_cast<::portable_stl::size_t>(last2 - first2);
+    auto const size  = ::portable_stl::min(size1, size2);
+
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      return ::portable_stl::lexicographical_compare(first1, last1, first2, last2, comp);
+    }
+
+    auto search = [first1, first2, &comp](::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      for (; begin != end; ++begin) {
+        if (comp(first1[begin], first2[begin]) || comp(first2[begin], first1[begin])) {
+          break;
+        }
+      }
+      return begin;
+    };
+    ::portable_stl::size_t const index{::portable_stl::execution_helper::parallel_find_first(*exec, size, search)};
+    return (index != size) ? static_cast<bool>(comp(first1[index], first2[index])) : (size1 < size2);
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Checks whether the range [first1, last1) is lexicographically less than the range [first2, last2) according
+ * to the policy. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator1 the type of the first iterator.
+ * @tparam t_input_iterator2 the type of the second iterator.
+ * @tparam t_compare the type of the comparison function.
+ * @param policy the execution policy.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @param comp the comparison function.
+ * @return true if the first range is lexicographically less than the second range.
+ */
+template<class t_execution_policy,
+         class t_input_iterator1,
+         class t_input_iterator2,
+         class t_compare,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+bool lexicographical_compare(t_execution_policy &&policy,
+                             t_input_iterator1    first1,
+                             t_input_iterator1    last1,
+                             t_input_iterator2    first2,
+                             t_input_iterator2    last2,
+                             t_compare            comp) {
+  return ::portable_stl::execution_helper::lexicographical_compare_dispatch(
+    policy,
+    first1,
+    last1,
+    first2,
+    last2,
+    comp,
+    ::portable_stl::execution_helper::is_parallel_iterators<t_input_iterator1, t_input_iterator2>{});
+}
+
+/**
+ * @brief Checks whether the range [first1, last1) is lexicographically less than the range [first2, last2) according
+ * to the policy. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator1 the type of the first iterator.
+ * @tparam t_input_iterator2 the type of the second iterator.
+ * @param policy the execution policy.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param last2 the end of the second range.
+ * @return true if the first range is lexicographically less than the second range.
+ */
+template<class t_execution_policy,
+         class t_input_iterator1,
+         class t_input_iterator2,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+bool lexicographical_compare(t_execution_policy &&policy,
+                             t_input_iterator1    first1,
+                             t_input_iterator1    last1,
+                             t_input_iterator2    first2,
+                             t_input_iterator2    last2) {
+  return ::portable_stl::lexicographical_compare(
+    policy, first1, last1, first2, last2, ::portable_stl::algorithm_helper::less<>());
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_LEXICOGRAPHICAL_COMPARE_H
@@ -0,0 +1,53 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="atomic_impl.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_ATOMIC_IMPL_H
+#define PSTL_ATOMIC_IMPL_H
+#include <intrin.h>
+
+#include "../../common/size_t.h"
+
+namespace portable_stl {
+namespace execution_helper {
+#if defined(_WIN64)
+  inline ::portable_stl::size_t atomic_compare_exchange(::portable_stl::size_t *object,
+                                                        ::portable_stl::size_t  value,
+                                                        ::portable_stl::size_t  comparand) noexcept {
+    return static_cast<::portable_stl::size_t>(_InterlockedCompareExchange64(
+      reinterpret_cast<__int64 volatile *>(object), static_cast<__int64>(value), static_cast<__int64>(comparand)));
+  }
+#else
+  inline ::portable_stl::size_t atomic_compare_exchange(::portable_stl::size_t *object,
+                                                        ::portable_stl::size_t  value,
+                                                        ::portable_stl::size_t  comparand) noexcept {
+    return static_cast<::portable_stl::size_t>(_InterlockedCompareExchange(
+      reinterpret_cast<long volatile *>(object), static_cast<long>(value), static_cast<long>(comparand)));
+  }
+#endif
+
+  inline ::portable_stl::size_t atomic_load(::portable_stl::size_t const *object) noexcept {
+    return atomic_compare_exchange(const_cast<::portable_stl::size_t *>(object), 0U, 0U);
+  }
+
+  inline void atomic_fetch_min(::portable_stl::size_t *object, ::portable_stl::size_t value) noexcept {
+    ::portable_stl::size_t current{atomic_load(object)};
+    while (value < current) {
+      ::portable_stl::size_t const previous{atomic_compare_exchange(object, value, current)};
+      if (previous == current) {
+        break;
+      }
+      current = previous;
+    }
+  }
+} // namespace execution_helper
+} // namespace portable_stl
+
+#endif // PSTL_ATOMIC_IMPL_H
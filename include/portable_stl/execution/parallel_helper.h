@@ -0,0 +1,236 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="parallel_helper.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PARALLEL_HELPER_H
+#define PSTL_PARALLEL_HELPER_H
+
+#include "../algorithm/min.h"
+#include "../common/size_t.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/logical_operator/conjunction.h"
+#include "../metaprogramming/other_transformations/enable_if_bool_constant.h"
+#include "../metaprogramming/other_transformations/remove_cvref.h"
+#include "../metaprogramming/type_relations/is_base_of.h"
+#include "atomic.h"
+#include "execution_policy.h"
+#include "executor.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief The minimum number of elements in the task.
+   * The shorter ranges are processed on the calling thread, where the task dispatch would cost more than it saves.
+   */
+  constexpr ::portable_stl::size_t parallel_min_chunk = 16384U;
+
+  /**
+   * @brief The number of tasks per executor thread, the threads which finish early take the extra tasks.
+   */
+  constexpr ::portable_stl::size_t parallel_tasks_per_thread = 4U;
+
+  /**
+   * @brief The number of elements searched between the checks whether a preceding task has found the result.
+   */
+  constexpr ::portable_stl::size_t parallel_search_block = 4096U;
+
+  /**
+   * @brief Enables the overload if t_execution_policy is the execution policy type.
+   * @tparam t_execution_policy the tested type.
+   */
+  template<class t_execution_policy>
+  using enable_if_execution_policy = ::portable_stl::enable_if_bool_constant_t<
+    ::portable_stl::is_execution_policy<::portable_stl::remove_cvref_t<t_execution_policy>>,
+    void *>;
+
+  /**
+   * @brief Checks whether all the iterators are random access, the parallel algorithms split only such ranges.
+   * @tparam t_iterators the iterator types.
+   */
+  template<class... t_iterators>
+  using is_parallel_iterators = ::portable_stl::conjunction<
+    ::portable_stl::is_base_of<::portable_stl::random_access_iterator_tag,
+                               typename ::portable_stl::iterator_traits<t_iterators>::iterator_category>...>;
+
+  /**
+   * @brief Returns the executor of the policy.
+   * @return nullptr, the sequenced policy has no executor.
+   */
+  inline ::portable_stl::execution::executor *policy_executor(
+    ::portable_stl::execution::sequenced_policy const &) noexcept {
+    return nullptr;
+  }
+
+  /**
+   * @brief Returns the executor of the policy.
+   * @param policy the policy.
+   * @return the executor of the policy.
+   */
+  inline ::portable_stl::execution::executor *policy_executor(
+    ::portable_stl::execution::parallel_policy const &policy) noexcept {
+    return &policy.get_executor();
+  }
+
+  /**
+   * @brief Returns the executor of the policy.
+   * @param policy the policy.
+   * @return the executor of the policy.
+   */
+  inline ::portable_stl::execution::executor *policy_executor(
+    ::portable_stl::execution::parallel_unsequenced_policy const &policy) noexcept {
+    return &policy.get_executor();
+  }
+
+  /**
+   * @brief Returns the executor which should process the range of the given size.
+   * @tparam t_execution_policy the type of the policy.
+   * @param policy the policy.
+   * @param size the number of elements.
+   * @return the executor or nullptr if the range should be processed on the calling thread.
+   */
+  template<class t_execution_policy>
+  ::portable_stl::execution::executor *parallel_executor(t_execution_policy const &policy,
+                                                         ::portable_stl::size_t    size) noexcept {
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::policy_executor(policy)};
+    return ((nullptr != exec) && (size >= 2U * parallel_min_chunk) && (exec->concurrency() > 1U)) ? exec : nullptr;
+  }
+
+  /**
+   * @brief Split of the index range [0, size) into the contiguous chunks of almost equal length, one per task.
+   */
+  class parallel_split final {
+    /**
+     * @brief The number of elements.
+     */
+    ::portable_stl::size_t m_size;
+    /**
+     * @brief The number of chunks.
+     */
+    ::portable_stl::size_t m_count;
+
+  public:
+    /**
+     * @brief Splits the range for the executor.
+     * @param exec the executor.
+     * @param size the number of elements.
+     */
+    parallel_split(::portable_stl::execution::executor const &exec, ::portable_stl::size_t size) noexcept
+        : m_size(size),
+          m_count(::portable_stl::min(exec.concurrency() * parallel_tasks_per_thread, size / parallel_min_chunk)) {
+      if (0U == m_count) {
+        m_count = 1U;
+      }
+    }
+
+    /**
+     * @brief Returns the number of chunks.
+     * @return the number of chunks.
+     */
+    ::portable_stl::size_t count() const noexcept {
+      return m_count;
+    }
+
+    /**
+     * @brief Returns the first index of the chunk.
+     * UB: index > count().
+     * @param index the chunk index, count() gives the end of the range.
+     * @return the first index of the chunk.
+     */
+    ::portable_stl::size_t begin(::portable_stl::size_t index) const noexcept {
+      return index * (m_size / m_count) + ::portable_stl::min(index, m_size % m_count);
+    }
+
+    /**
+     * @brief Returns the index after the last index of the chunk.
+     * UB: index >= count().
+     * @param index the chunk index.
+     * @return the end index of the chunk.
+     */
+    ::portable_stl::size_t end(::portable_stl::size_t index) const noexcept {
+      return begin(index + 1U);
+    }
+  };
+
+  /**
+   * @brief The task function which calls the functor with the task index.
+   * The exception thrown by the functor calls terminate.
+   * @tparam t_functor the type of the functor.
+   * @param context the functor.
+   * @param index the task index.
+   */
+  template<class t_functor> void parallel_task(void *context, ::portable_stl::size_t index) noexcept {
+    (*static_cast<t_functor *>(context))(index);
+  }
+
+  /**
+   * @brief Calls functor(index) for every index in [0, count) on the executor and waits for all the calls.
+   * @tparam t_functor the type of the functor.
+   * @param exec the executor.
+   * @param count the number of tasks.
+   * @param functor the functor.
+   */
+  template<class t_functor>
+  void parallel_invoke(::portable_stl::execution::executor &exec, ::portable_stl::size_t count, t_functor &functor) {
+    exec.bulk_execute(&::portable_stl::execution_helper::parallel_task<t_functor>, &functor, count);
+  }
+
+  /**
+   * @brief Calls functor(chunk, begin, end) for every chunk of the split on the executor and waits for all the calls.
+   * @tparam t_functor the type of the functor.
+   * @param exec the executor.
+   * @param split the split of the range.
+   * @param functor the functor.
+   */
+  template<class t_functor>
+  void parallel_for(::portable_stl::execution::executor &exec, parallel_split const &split, t_functor &functor) {
+    auto task = [&split, &functor](::portable_stl::size_t chunk) {
+      functor(chunk, split.begin(chunk), split.end(chunk));
+    };
+    ::portable_stl::execution_helper::parallel_invoke(exec, split.count(), task);
+  }
+
+  /**
+   * @brief Finds the first index in [0, size) found by the search function.
+   * The chunks are searched in parallel by the blocks. The block is skipped if a smaller index has been found.
+   * @tparam t_search the type of the search function: search(begin, end) returns the first found index in
+   * [begin, end) or end.
+   * @param exec the executor.
+   * @param size the number of elements.
+   * @param search the search function.
+   * @return the first found index or size if there is no such index.
+   */
+  template<class t_search>
+  ::portable_stl::size_t parallel_find_first(::portable_stl::execution::executor &exec,
+                                             ::portable_stl::size_t               size,
+                                             t_search                            &search) {
+    ::portable_stl::size_t found{size};
+    parallel_split const   split(exec, size);
+    auto task = [&found, &search](::portable_stl::size_t, ::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      while (begin < end) {
+        if (::portable_stl::execution_helper::shared_load(&found) < begin) {
+          return;
+        }
+        ::portable_stl::size_t const block_end{::portable_stl::min(begin + parallel_search_block, end)};
+        ::portable_stl::size_t const index{search(begin, block_end)};
+        if (index != block_end) {
+          ::portable_stl::execution_helper::shared_store_min(&found, index);
+          return;
+        }
+        begin = block_end;
+      }
+    };
+    ::portable_stl::execution_helper::parallel_for(exec, split, task);
+    return found;
+  }
+} // namespace execution_helper
+} // namespace portable_stl
+
+#endif // PSTL_PARALLEL_HELPER_H
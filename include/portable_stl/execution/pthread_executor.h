@@ -0,0 +1,226 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="pthread_executor.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PTHREAD_EXECUTOR_H
+#define PSTL_PTHREAD_EXECUTOR_H
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "../common/size_t.h"
+#include "../vector/vector.h"
+#include "executor.h"
+
+namespace portable_stl {
+namespace execution {
+  /**
+   * @brief Executor with the pool of POSIX threads.
+   * The pool keeps concurrency() - 1 worker threads, the thread which calls bulk_execute runs the tasks too. The tasks
+   * are taken one by one from the shared counter, so the threads which finish early take more tasks.
+   *
+   * The pool runs one bulk_execute at a time. The call made while the pool is busy (from another thread or from the
+   * task) runs its tasks on the calling thread, so the calls never wait for each other.
+   */
+  class pthread_executor final : public ::portable_stl::execution::executor {
+    /**
+     * @brief Worker threads.
+     */
+    ::portable_stl::vector<pthread_t> m_threads;
+    /**
+     * @brief Taken by bulk_execute while the pool runs its tasks.
+     */
+    pthread_mutex_t                   m_submit_mutex;
+    /**
+     * @brief Protects the state of the current bulk_execute.
+     */
+    pthread_mutex_t                   m_mutex;
+    /**
+     * @brief Signals the workers about the new tasks and the stop.
+     */
+    pthread_cond_t                    m_work_cond;
+    /**
+     * @brief Signals bulk_execute that the last task has finished.
+     */
+    pthread_cond_t                    m_done_cond;
+    /**
+     * @brief The task function of the current bulk_execute.
+     */
+    task_function                     m_function;
+    /**
+     * @brief The context of the current bulk_execute.
+     */
+    void                             *m_context;
+    /**
+     * @brief The number of the tasks of the current bulk_execute.
+     */
+    ::portable_stl::size_t            m_count;
+    /**
+     * @brief The index of the next task to take.
+     */
+    ::portable_stl::size_t            m_next;
+    /**
+     * @brief The number of the tasks which are not finished.
+     */
+    ::portable_stl::size_t            m_pending;
+    /**
+     * @brief The workers must exit.
+     */
+    bool                              m_stop;
+
+  public:
+    /**
+     * @brief Returns the number of the online processors.
+     * @return the number of processors, at least 1.
+     */
+    static ::portable_stl::size_t hardware_concurrency() noexcept {
+      long const processors{::sysconf(_SC_NPROCESSORS_ONLN)};
+      return (processors > 0) ? static_cast<::portable_stl::size_t>(processors) : 1U;
+    }
+
+    /**
+     * @brief Starts the pool.
+     * The pool has less threads if the threads cannot be created.
+     * @param threads the number of threads including the calling thread.
+     */
+    explicit pthread_executor(::portable_stl::size_t threads = hardware_concurrency()) noexcept
+        : m_threads(),
+          m_submit_mutex(),
+          m_mutex(),
+          m_work_cond(),
+          m_done_cond(),
+          m_function(nullptr),
+          m_context(nullptr),
+          m_count(0U),
+          m_next(0U),
+          m_pending(0U),
+          m_stop(false) {
+      static_cast<void>(::pthread_mutex_init(&m_submit_mutex, nullptr));
+      static_cast<void>(::pthread_mutex_init(&m_mutex, nullptr));
+      static_cast<void>(::pthread_cond_init(&m_work_cond, nullptr));
+      static_cast<void>(::pthread_cond_init(&m_done_cond, nullptr));
+
+      if ((threads > 1U) && m_threads.reserve(threads - 1U)) {
+        for (::portable_stl::size_t index{1U}; index < threads; ++index) {
+          pthread_t thread;
+          if (0 != ::pthread_create(&thread, nullptr, &pthread_executor::M_worker, this)) {
+            break;
+          }
+          static_cast<void>(m_threads.push_back(thread));
+        }
+      }
+    }
+
+    /**
+     * @brief Stops and joins the worker threads.
+     */
+    ~pthread_executor() override {
+      static_cast<void>(::pthread_mutex_lock(&m_mutex));
+      m_stop = true;
+      static_cast<void>(::pthread_cond_broadcast(&m_work_cond));
+      static_cast<void>(::pthread_mutex_unlock(&m_mutex));
+
+      for (pthread_t thread : m_threads) {
+        static_cast<void>(::pthread_join(thread, nullptr));
+      }
+
+      static_cast<void>(::pthread_cond_destroy(&m_done_cond));
+      static_cast<void>(::pthread_cond_destroy(&m_work_cond));
+      static_cast<void>(::pthread_mutex_destroy(&m_mutex));
+      static_cast<void>(::pthread_mutex_destroy(&m_submit_mutex));
+    }
+
+    /**
+     * @brief Returns the number of the tasks which can run at the same time.
+     * @return the number of the worker threads plus the calling thread.
+     */
+    ::portable_stl::size_t concurrency() const noexcept override {
+      return m_threads.size() + 1U;
+    }
+
+    /**
+     * @brief Runs function(context, index) for every index in [0, count) on the pool threads and the calling thread.
+     * @param function the task function.
+     * @param context the context passed to the task function.
+     * @param count the number of tasks.
+     */
+    void bulk_execute(task_function function, void *context, ::portable_stl::size_t count) noexcept override {
+      if ((count < 2U) || m_threads.empty() || (0 != ::pthread_mutex_trylock(&m_submit_mutex))) {
+        // nothing to share or the pool is busy
+        for (::portable_stl::size_t index{0U}; index < count; ++index) {
+          function(context, index);
+        }
+        return;
+      }
+
+      static_cast<void>(::pthread_mutex_lock(&m_mutex));
+      m_function = function;
+      m_context  = context;
+      m_count    = count;
+      m_next     = 0U;
+      m_pending  = count;
+      static_cast<void>(::pthread_cond_broadcast(&m_work_cond));
+
+      M_run_tasks();
+      while (0U != m_pending) {
+        static_cast<void>(::pthread_cond_wait(&m_done_cond, &m_mutex));
+      }
+      m_count = 0U;
+      m_next  = 0U;
+      static_cast<void>(::pthread_mutex_unlock(&m_mutex));
+
+      static_cast<void>(::pthread_mutex_unlock(&m_submit_mutex));
+    }
+
+  private:
+    /**
+     * @brief Runs the tasks of the current bulk_execute until there are no tasks to take.
+     * Called with m_mutex locked, returns with m_mutex locked.
+     */
+    void M_run_tasks() noexcept {
+      while (m_next < m_count) {
+        ::portable_stl::size_t const index{m_next++};
+        task_function const          function{m_function};
+        void *const                  context{m_context};
+        static_cast<void>(::pthread_mutex_unlock(&m_mutex));
+
+        function(context, index);
+
+        static_cast<void>(::pthread_mutex_lock(&m_mutex));
+        if (0U == --m_pending) {
+          static_cast<void>(::pthread_cond_signal(&m_done_cond));
+        }
+      }
+    }
+
+    /**
+     * @brief The worker thread function.
+     * @param self the executor.
+     * @return nullptr.
+     */
+    static void *M_worker(void *self) noexcept {
+      pthread_executor *const pool{static_cast<pthread_executor *>(self)};
+
+      static_cast<void>(::pthread_mutex_lock(&pool->m_mutex));
+      while (!pool->m_stop) {
+        if (pool->m_next < pool->m_count) {
+          pool->M_run_tasks();
+        } else {
+          static_cast<void>(::pthread_cond_wait(&pool->m_work_cond, &pool->m_mutex));
+        }
+      }
+      static_cast<void>(::pthread_mutex_unlock(&pool->m_mutex));
+      return nullptr;
+    }
+  };
+} // namespace execution
+} // namespace portable_stl
+
+#endif // PSTL_PTHREAD_EXECUTOR_H
@@ -0,0 +1,180 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="reduce.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_REDUCE_H
+#define PSTL_EXECUTION_REDUCE_H
+
+#include "../common/size_t.h"
+#include "../functional/plus.h"
+#include "../iterator/iterator_traits.h"
+#include "../memory/allocate_noexcept.h"
+#include "../memory/allocator.h"
+#include "../memory/construct_at.h"
+#include "../memory/destroy_at.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../numeric/reduce.h"
+#include "../utility/general/move.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief reduce for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_binary_op the type of the reduction.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @param op the reduction.
+   * @return the reduced value.
+   */
+  template<class t_execution_policy, class t_input_iterator, class t_type, class t_binary_op>
+  t_type reduce_dispatch(t_execution_policy const &,
+                         t_input_iterator first,
+                         t_input_iterator last,
+                         t_type           init,
+                         t_binary_op     &op,
+                         ::portable_stl::false_type) {
+    return ::portable_stl::reduce(first, last, ::portable_stl::move(init), op);
+  }
+
+  /**
+   * @brief reduce for the random access iterators: every chunk is reduced in parallel starting from its first element,
+   * then the partial values are reduced with init in the order of the chunks.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_binary_op the type of the reduction.
+   * @param policy the execution policy.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @param op the reduction.
+   * @return the reduced value.
+   */
+  template<class t_execution_policy, class t_random_access_iterator, class t_type, class t_binary_op>
+  t_type reduce_dispatch(t_execution_policy const &policy,
+                         t_random_access_iterator  first,
+                         t_random_access_iterator  last,
+                         t_type                    init,
+                         t_binary_op              &op,
+                         ::portable_stl::true_type) {
+    auto const                                 size = static_cast<::portable_stl::size_t>(last - first);
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      return ::portable_stl::reduce(first, last, ::portable_stl::move(init), op);
+    }
+
+    parallel_split const              split(*exec, size);
+    ::portable_stl::allocator<t_type> alloc;
+    t_type *const                     partials{::portable_stl::allocate_noexcept(alloc, split.count())};
+    if (nullptr == partials) {
+      return ::portable_stl::reduce(first, last, ::portable_stl::move(init), op);
+    }
+
+    // every chunk is not empty, its first element is the initial value of the chunk
+    auto task = [first, &op, partials](
+                  ::portable_stl::size_t chunk, ::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      ::portable_stl::construct_at(
+        partials + chunk, ::portable_stl::reduce(first + (begin + 1U), first + end, t_type(first[begin]), op));
+    };
+    ::portable_stl::execution_helper::parallel_for(*exec, split, task);
+
+    for (::portable_stl::size_t chunk{0U}; chunk < split.count(); ++chunk) {
+      init = op(::portable_stl::move(init), ::portable_stl::move(partials[chunk]));
+      ::portable_stl::destroy_at(partials + chunk);
+    }
+    alloc.deallocate(partials, split.count());
+    return init;
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Reduces init and the elements of the range [first, last) in unspecified order according to the policy.
+ * The reduction must be associative and commutative. The parallel policies split the random access ranges between the
+ * executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_type the type of the reduced value.
+ * @tparam t_binary_op the type of the reduction.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param init the initial value.
+ * @param op the reduction.
+ * @return the reduced value.
+ */
+template<class t_execution_policy,
+         class t_input_iterator,
+         class t_type,
+         class t_binary_op,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+t_type reduce(
+  t_execution_policy &&policy, t_input_iterator first, t_input_iterator last, t_type init, t_binary_op op) {
+  return ::portable_stl::execution_helper::reduce_dispatch(
+    policy,
+    first,
+    last,
+    ::portable_stl::move(init),
+    op,
+    ::portable_stl::execution_helper::is_parallel_iterators<t_input_iterator>{});
+}
+
+/**
+ * @brief Computes the sum of init and the elements of the range [first, last) in unspecified order according to the
+ * policy. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_type the type of the reduced value.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param init the initial value.
+ * @return the sum.
+ */
+template<class t_execution_policy,
+         class t_input_iterator,
+         class t_type,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+t_type reduce(t_execution_policy &&policy, t_input_iterator first, t_input_iterator last, t_type init) {
+  return ::portable_stl::reduce(policy, first, last, ::portable_stl::move(init), ::portable_stl::plus<>{});
+}
+
+/**
+ * @brief Computes the sum of the elements of the range [first, last) in unspecified order according to the policy.
+ * The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator the type of iterator.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @return the sum or the value-initialized value for the empty range.
+ */
+template<class t_execution_policy,
+         class t_input_iterator,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+typename ::portable_stl::iterator_traits<t_input_iterator>::value_type reduce(t_execution_policy &&policy,
+                                                                             t_input_iterator     first,
+                                                                             t_input_iterator     last) {
+  return ::portable_stl::reduce(policy,
+                                first,
+                                last,
+                                typename ::portable_stl::iterator_traits<t_input_iterator>::value_type{},
+                                ::portable_stl::plus<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_REDUCE_H
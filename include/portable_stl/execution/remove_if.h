@@ -0,0 +1,117 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="remove_if.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_REMOVE_IF_H
+#define PSTL_EXECUTION_REMOVE_IF_H
+
+#include "../algorithm/move_algo.h"
+#include "../algorithm/remove_if.h"
+#include "../common/size_t.h"
+#include "../memory/allocate_noexcept.h"
+#include "../memory/allocator.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief remove_if for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_forward_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate which returns true for the removed elements.
+   * @return the end of the kept elements.
+   */
+  template<class t_execution_policy, class t_forward_iterator, class t_predicate>
+  t_forward_iterator remove_if_dispatch(t_execution_policy const &,
+                                        t_forward_iterator first,
+                                        t_forward_iterator last,
+                                        t_predicate       &pred,
+                                        ::portable_stl::false_type) {
+    return ::portable_stl::remove_if(first, last, pred);
+  }
+
+  /**
+   * @brief remove_if for the random access iterators: the chunks are compacted in place in parallel, then the kept
+   * elements of every chunk are moved after the kept elements of the preceding chunks.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_predicate the type of predicate.
+   * @param policy the execution policy.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param pred the predicate which returns true for the removed elements.
+   * @return the end of the kept elements.
+   */
+  template<class t_execution_policy, class t_random_access_iterator, class t_predicate>
+  t_random_access_iterator remove_if_dispatch(t_execution_policy const &policy,
+                                              t_random_access_iterator  first,
+                                              t_random_access_iterator  last,
+                                              t_predicate              &pred,
+                                              ::portable_stl::true_type) {
+    auto const                                 size = static_cast<::portable_stl::size_t>(last - first);
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      return ::portable_stl::remove_if(first, last, pred);
+    }
+
+    parallel_split const                              split(*exec, size);
+    ::portable_stl::allocator<::portable_stl::size_t> alloc;
+    ::portable_stl::size_t *const                     kept_end{::portable_stl::allocate_noexcept(alloc, split.count())};
+    if (nullptr == kept_end) {
+      return ::portable_stl::remove_if(first, last, pred);
+    }
+
+    auto task = [first, &pred, kept_end](
+                  ::portable_stl::size_t chunk, ::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      kept_end[chunk]
+        = static_cast<::portable_stl::size_t>(::portable_stl::remove_if(first + begin, first + end, pred) - first);
+    };
+    ::portable_stl::execution_helper::parallel_for(*exec, split, task);
+
+    t_random_access_iterator result{first + kept_end[0]};
+    for (::portable_stl::size_t chunk{1U}; chunk < split.count(); ++chunk) {
+      result = ::portable_stl::move(first + split.begin(chunk), first + kept_end[chunk], result);
+    }
+    alloc.deallocate(kept_end, split.count());
+    return result;
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Removes the elements satisfying the predicate from the range according to the policy, the order of the kept
+ * elements is preserved. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_predicate the type of predicate.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param pred the predicate which returns true for the removed elements.
+ * @return the end of the kept elements.
+ */
+template<class t_execution_policy,
+         class t_forward_iterator,
+         class t_predicate,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+t_forward_iterator remove_if(t_execution_policy &&policy,
+                             t_forward_iterator   first,
+                             t_forward_iterator   last,
+                             t_predicate          pred) {
+  return ::portable_stl::execution_helper::remove_if_dispatch(
+    policy, first, last, pred, ::portable_stl::execution_helper::is_parallel_iterators<t_forward_iterator>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_REMOVE_IF_H
@@ -0,0 +1,130 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="sort.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_SORT_H
+#define PSTL_EXECUTION_SORT_H
+
+#include "../algorithm/inplace_merge.h"
+#include "../algorithm/min.h"
+#include "../algorithm/sort.h"
+#include "../common/size_t.h"
+#include "../functional/less.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief sort for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_compare the type of the comparison function.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function.
+   */
+  template<class t_execution_policy, class t_iterator, class t_compare>
+  void sort_dispatch(
+    t_execution_policy const &, t_iterator first, t_iterator last, t_compare &comp, ::portable_stl::false_type) {
+    ::portable_stl::sort(first, last, comp);
+  }
+
+  /**
+   * @brief sort for the random access iterators: the chunks are sorted in parallel, then the neighbouring sorted runs
+   * are merged pairwise, the merges of one round run in parallel.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_compare the type of the comparison function.
+   * @param policy the execution policy.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function.
+   */
+  template<class t_execution_policy, class t_random_access_iterator, class t_compare>
+  void sort_dispatch(t_execution_policy const &policy,
+                     t_random_access_iterator  first,
+                     t_random_access_iterator  last,
+                     t_compare                &comp,
+                     ::portable_stl::true_type) {
+    auto const                                 size = static_cast<::portable_stl::size_t>(last - first);
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      ::portable_stl::sort(first, last, comp);
+      return;
+    }
+
+    parallel_split const split(*exec, size);
+    auto sort_task = [first, &comp](::portable_stl::size_t, ::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      ::portable_stl::sort(first + begin, first + end, comp);
+    };
+    ::portable_stl::execution_helper::parallel_for(*exec, split, sort_task);
+
+    // the run of width chunks starting at every chunk multiple of 2 * width is merged with the next run
+    for (::portable_stl::size_t width{1U}; width < split.count(); width *= 2U) {
+      auto merge_task = [first, &comp, &split, width](::portable_stl::size_t pair) {
+        ::portable_stl::size_t const left{pair * 2U * width};
+        ::portable_stl::inplace_merge(first + split.begin(left),
+                                      first + split.begin(left + width),
+                                      first + split.begin(::portable_stl::min(left + 2U * width, split.count())),
+                                      comp);
+      };
+      // the last run without the pair stays in place
+      ::portable_stl::execution_helper::parallel_invoke(
+        *exec, (split.count() + width - 1U) / (2U * width), merge_task);
+    }
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Sorts the elements of the range in non-descending order according to the policy.
+ * The order of equal elements is not guaranteed to be preserved. The parallel policies split the random access ranges
+ * between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_random_access_iterator the type of iterator.
+ * @tparam t_compare the type of the comparison function.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param comp the comparison function which returns true if the first argument is less than the second.
+ */
+template<class t_execution_policy,
+         class t_random_access_iterator,
+         class t_compare,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+void sort(t_execution_policy     &&policy,
+          t_random_access_iterator first,
+          t_random_access_iterator last,
+          t_compare                comp) {
+  ::portable_stl::execution_helper::sort_dispatch(
+    policy, first, last, comp, ::portable_stl::execution_helper::is_parallel_iterators<t_random_access_iterator>{});
+}
+
+/**
+ * @brief Sorts the elements of the range in non-descending order according to the policy.
+ * The order of equal elements is not guaranteed to be preserved. The parallel policies split the random access ranges
+ * between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_random_access_iterator the type of iterator.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ */
+template<class t_execution_policy,
+         class t_random_access_iterator,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+void sort(t_execution_policy &&policy, t_random_access_iterator first, t_random_access_iterator last) {
+  ::portable_stl::sort(policy, first, last, ::portable_stl::less<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_SORT_H
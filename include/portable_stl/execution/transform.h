@@ -0,0 +1,227 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="transform.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXECUTION_TRANSFORM_H
+#define PSTL_EXECUTION_TRANSFORM_H
+
+#include "../algorithm/transform.h"
+#include "../common/size_t.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "parallel_helper.h"
+
+namespace portable_stl {
+namespace execution_helper {
+  /**
+   * @brief Unary transform for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_input_iterator the type of the input iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_unary_operation the type of the operation.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param result the beginning of the output range.
+   * @param unary_op the operation.
+   * @return the iterator past the last stored element.
+   */
+  template<class t_execution_policy, class t_input_iterator, class t_output_iterator, class t_unary_operation>
+  t_output_iterator transform_dispatch(t_execution_policy const &,
+                                       t_input_iterator   first,
+                                       t_input_iterator   last,
+                                       t_output_iterator  result,
+                                       t_unary_operation &unary_op,
+                                       ::portable_stl::false_type) {
+    return ::portable_stl::transform(first, last, result, unary_op);
+  }
+
+  /**
+   * @brief Unary transform for the random access iterators: the chunks are transformed in parallel.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator1 the type of the input iterator.
+   * @tparam t_random_access_iterator2 the type of the output iterator.
+   * @tparam t_unary_operation the type of the operation.
+   * @param policy the execution policy.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param result the beginning of the output range.
+   * @param unary_op the operation.
+   * @return the iterator past the last stored element.
+   */
+  template<class t_execution_policy,
+           class t_random_access_iterator1,
+           class t_random_access_iterator2,
+           class t_unary_operation>
+  t_random_access_iterator2 transform_dispatch(t_execution_policy const &policy,
+                                               t_random_access_iterator1 first,
+                                               t_random_access_iterator1 last,
+                                               t_random_access_iterator2 result,
+                                               t_unary_operation        &unary_op,
+                                               ::portable_stl::true_type) {
+    auto const                                 size = static_cast<::portable_stl::size_t>(last - first);
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      return ::portable_stl::transform(first, last, result, unary_op);
+    }
+
+    auto task = [first, result, &unary_op](
+                  ::portable_stl::size_t, ::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      static_cast<void>(::portable_stl::transform(first + begin, first + end, result + begin, unary_op));
+    };
+    ::portable_stl::execution_helper::parallel_for(*exec, parallel_split(*exec, size), task);
+    return result + (last - first);
+  }
+
+  /**
+   * @brief Binary transform for the not random access iterators: the sequential algorithm.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_input_iterator1 the type of the first input iterator.
+   * @tparam t_input_iterator2 the type of the second input iterator.
+   * @tparam t_output_iterator the type of the output iterator.
+   * @tparam t_binary_operation the type of the operation.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param result the beginning of the output range.
+   * @param binary_op the operation.
+   * @return the iterator past the last stored element.
+   */
+  template<class t_execution_policy,
+           class t_input_iterator1,
+           class t_input_iterator2,
+           class t_output_iterator,
+           class t_binary_operation>
+  t_output_iterator transform_dispatch(t_execution_policy const &,
+                                       t_input_iterator1   first1,
+                                       t_input_iterator1   last1,
+                                       t_input_iterator2   first2,
+                                       t_output_iterator   result,
+                                       t_binary_operation &binary_op,
+                                       ::portable_stl::false_type) {
+    return ::portable_stl::transform(first1, last1, first2, result, binary_op);
+  }
+
+  /**
+   * @brief Binary transform for the random access iterators: the chunks are transformed in parallel.
+   * @tparam t_execution_policy the type of the execution policy.
+   * @tparam t_random_access_iterator1 the type of the first input iterator.
+   * @tparam t_random_access_iterator2 the type of the second input iterator.
+   * @tparam t_random_access_iterator3 the type of the output iterator.
+   * @tparam t_binary_operation the type of the operation.
+   * @param policy the execution policy.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param result the beginning of the output range.
+   * @param binary_op the operation.
+   * @return the iterator past the last stored element.
+   */
+  template<class t_execution_policy,
+           class t_random_access_iterator1,
+           class t_random_access_iterator2,
+           class t_random_access_iterator3,
+           class t_binary_operation>
+  t_random_access_iterator3 transform_dispatch(t_execution_policy const &policy,
+                                               t_random_access_iterator1 first1,
+                                               t_random_access_iterator1 last1,
+                                               t_random_access_iterator2 first2,
+                                               t_random_access_iterator3 result,
+                                               t_binary_operation       &binary_op,
+                                               ::portable_stl::true_type) {
+    auto const                                 size = static_cast<::portable_stl::size_t>(last1 - first1);
+    ::portable_stl::execution::executor *const exec{::portable_stl::execution_helper::parallel_executor(policy, size)};
+    if (nullptr == exec) {
+      return ::portable_stl::transform(first1, last1, first2, result, binary_op);
+    }
+
+    auto task = [first1, first2, result, &binary_op](
+                  ::portable_stl::size_t, ::portable_stl::size_t begin, ::portable_stl::size_t end) {
+      static_cast<void>(
+        ::portable_stl::transform(first1 + begin, first1 + end, first2 + begin, result + begin, binary_op));
+    };
+    ::portable_stl::execution_helper::parallel_for(*exec, parallel_split(*exec, size), task);
+    return result + (last1 - first1);
+  }
+} // namespace execution_helper
+
+/**
+ * @brief Applies the unary operation to the elements of the range and stores the results in the output range
+ * according to the policy. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator the type of the input iterator.
+ * @tparam t_output_iterator the type of the output iterator.
+ * @tparam t_unary_operation the type of the operation.
+ * @param policy the execution policy.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param result the beginning of the output range, may be equal to first.
+ * @param unary_op the operation.
+ * @return the iterator past the last stored element.
+ */
+template<class t_execution_policy,
+         class t_input_iterator,
+         class t_output_iterator,
+         class t_unary_operation,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+t_output_iterator transform(t_execution_policy &&policy,
+                            t_input_iterator     first,
+                            t_input_iterator     last,
+                            t_output_iterator    result,
+                            t_unary_operation    unary_op) {
+  return ::portable_stl::execution_helper::transform_dispatch(
+    policy,
+    first,
+    last,
+    result,
+    unary_op,
+    ::portable_stl::execution_helper::is_parallel_iterators<t_input_iterator, t_output_iterator>{});
+}
+
+/**
+ * @brief Applies the binary operation to the pairs of the elements of two ranges and stores the results in the output
+ * range according to the policy. The parallel policies split the random access ranges between the executor threads.
+ *
+ * @tparam t_execution_policy the type of the execution policy.
+ * @tparam t_input_iterator1 the type of the first input iterator.
+ * @tparam t_input_iterator2 the type of the second input iterator.
+ * @tparam t_output_iterator the type of the output iterator.
+ * @tparam t_binary_operation the type of the operation.
+ * @param policy the execution policy.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range, at least as long as the first range.
+ * @param result the beginning of the output range, may be equal to first1 or first2.
+ * @param binary_op the operation.
+ * @return the iterator past the last stored element.
+ */
+template<class t_execution_policy,
+         class t_input_iterator1,
+         class t_input_iterator2,
+         class t_output_iterator,
+         class t_binary_operation,
+         ::portable_stl::execution_helper::enable_if_execution_policy<t_execution_policy> = nullptr>
+t_output_iterator transform(t_execution_policy &&policy,
+                            t_input_iterator1    first1,
+                            t_input_iterator1    last1,
+                            t_input_iterator2    first2,
+                            t_output_iterator    result,
+                            t_binary_operation   binary_op) {
+  return ::portable_stl::execution_helper::transform_dispatch(
+    policy,
+    first1,
+    last1,
+    first2,
+    result,
+    binary_op,
+    ::portable_stl::execution_helper::is_parallel_iterators<t_input_iterator1, t_input_iterator2, t_output_iterator>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXECUTION_TRANSFORM_H
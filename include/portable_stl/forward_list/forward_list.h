@@ -456,6 +456,7 @@ public:
 
   /**
    * @brief Replaces the contents of the container with num copies of value 'value'.
+   * The existing nodes are reused, the values are assigned to them in place, only the missing nodes are allocated.
    *
    * @param num The new size of the container.
    * @param value The value to initialize elements of the container with.
@@ -466,6 +467,7 @@ public:
   /**
    * @brief Replaces the contents of the container with copies of those in the range [first, last). The behavior is
    * undefined if either argument is an iterator into *this.
+   * The existing nodes are reused, the values are assigned to them in place, only the missing nodes are allocated.
    *
    * @tparam t_input_iterator Satisfies LegacyInputIterator.
    * @param first The range [first, last) to copy the elements from.
@@ -1015,7 +1017,11 @@ private:
   template<class t_compare>
   static t_node_pointer merge_impl(t_node_pointer first1, t_node_pointer first2, t_compare &comp);
 
-  template<class t_compare> static t_node_pointer sort_impl(t_node_pointer first, size_type list_size, t_compare &comp);
+  static t_node_pointer append_chain(t_node_pointer first, t_node_pointer second) noexcept;
+
+  template<class t_compare> static void merge_runs_impl(t_node_pointer &first1, t_node_pointer first2, t_compare &comp);
+
+  template<class t_compare> static void sort_impl(t_node_pointer &first, t_compare &comp);
 };
 
 // [constructors]
@@ -2283,6 +2289,8 @@ void forward_list<t_type, t_allocator>::merge(forward_list &other_list, t_compar
 
 /**
  * @brief Sorts the elements and preserves the order of equivalent elements.
+ * Nodes are relinked, no element is copied or moved and no memory is allocated. If the comparison throws, all nodes
+ * are linked back into the list in unspecified order.
  *
  * @tparam t_type The type of the elements.
  * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
@@ -2293,48 +2301,162 @@ void forward_list<t_type, t_allocator>::merge(forward_list &other_list, t_compar
 template<class t_type, class t_allocator>
 template<class t_compare>
 inline void forward_list<t_type, t_allocator>::sort(t_compare comp) {
-  base::get_before_begin()->m_next = sort_impl(
-    base::get_before_begin()->m_next, static_cast<size_type>(::portable_stl::distance(begin(), end())), comp);
+  t_node_pointer first{base::get_before_begin()->m_next};
+  auto           guard = ::portable_stl::make_exception_guard([this, &first]() noexcept {
+    base::get_before_begin()->m_next = first;
+  });
+  sort_impl(first, comp);
+  guard.commit();
+  base::get_before_begin()->m_next = first;
+}
+
+/**
+ * @brief Appends the null-terminated chain to the end of another one.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
+ * memory.
+ * @param first Pointer to the first node of the first chain.
+ * @param second Pointer to the first node of the appended chain.
+ * @return forward_list<t_type, t_allocator>::t_node_pointer
+ */
+template<class t_type, class t_allocator>
+typename forward_list<t_type, t_allocator>::t_node_pointer forward_list<t_type, t_allocator>::append_chain(
+  t_node_pointer first, t_node_pointer second) noexcept {
+  if (nullptr == first) {
+    return second;
+  }
+  t_node_pointer last{first};
+  while (nullptr != last->m_next) {
+    last = last->m_next;
+  }
+  last->m_next = second;
+  return first;
+}
+
+/**
+ * @brief Merges two sorted null-terminated chains for sort, the nodes of the first one go first among equivalent ones.
+ * If the comparison throws, first1 holds all nodes of both chains in unspecified order.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
+ * memory.
+ * @tparam t_compare Must meet the requirements of Compare.
+ * @param first1 Pointer to the first node of the first chain, receives the first node of the merged chain.
+ * @param first2 Pointer to the first node of the second chain.
+ * @param comp Comparison function object.
+ */
+template<class t_type, class t_allocator>
+template<class t_compare>
+void forward_list<t_type, t_allocator>::merge_runs_impl(t_node_pointer &first1,
+                                                        t_node_pointer  first2,
+                                                        t_compare      &comp) {
+  t_node_pointer rest1{first1};
+  t_node_pointer head{nullptr};
+  t_node_pointer tail{nullptr};
+
+  auto guard = ::portable_stl::make_exception_guard([&first1, &rest1, &first2, &head, &tail]() noexcept {
+    // keep the merged part and the rest of both chains in one chain
+    if (nullptr != tail) {
+      tail->m_next = rest1;
+      rest1        = head;
+    }
+    first1 = append_chain(rest1, first2);
+  });
+
+  while ((nullptr != rest1) && (nullptr != first2)) {
+    t_node_pointer node;
+    if (comp(first2->get_value(), rest1->get_value())) {
+      node   = first2;
+      first2 = first2->m_next;
+    } else {
+      node  = rest1;
+      rest1 = rest1->m_next;
+    }
+    if (nullptr == tail) {
+      head = node;
+    } else {
+      tail->m_next = node;
+    }
+    tail = node;
+  }
+  guard.commit();
+
+  t_node_pointer const rest{(nullptr != rest1) ? rest1 : first2};
+  if (nullptr == tail) {
+    first1 = rest;
+  } else {
+    tail->m_next = rest;
+    first1       = head;
+  }
 }
 
 /**
  * @brief Sort implementation.
+ * Bottom-up merge sort: runs[i] is either empty or holds a sorted run of 2^i nodes. Every node taken from the input is
+ * carried up through the occupied slots like a binary counter, so the sort is neither recursive nor allocating.
+ * Every node is always reachable from exactly one of first, carry and runs, so if the comparison throws they are
+ * joined back into one chain.
  *
  * @tparam t_type The type of the elements.
  * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
  * memory.
  * @tparam t_compare Must meet the requirements of Compare.
- * @param first1 Pointer to the first node.
- * @param list_size Size of the list.
+ * @param first Pointer to the first node of the null-terminated chain, receives the first node of the sorted chain.
  * @param comp Comparison function object.
- * @return forward_list<t_type, t_allocator>::t_node_pointer
  */
 template<class t_type, class t_allocator>
 template<class t_compare>
-typename forward_list<t_type, t_allocator>::t_node_pointer forward_list<t_type, t_allocator>::sort_impl(
-  t_node_pointer first, size_type list_size, t_compare &comp) {
-  switch (list_size) {
-    case 0:
-    case 1:
-      return first;
-    case 2:
-      if (comp(first->m_next->get_value(), first->get_value())) {
-        // swap first and second nodes
-        t_node_pointer tmp{first->m_next};
-        tmp->m_next   = first;
-        first->m_next = nullptr;
-        first         = tmp;
-      }
-      return first;
-    default:
-      size_type const size_left{list_size / 2};                                    // >= 1
-      size_type const size_right{list_size - size_left};                           // >= 0
-      auto const      left_end_dist = static_cast<difference_type>(size_left - 1); // >= 0
-      t_node_pointer  tmp2{::portable_stl::next(iterator(first), left_end_dist).get_unsafe_node_pointer()};
-      t_node_pointer  first2{tmp2->m_next};
-      tmp2->m_next = nullptr;
-      return merge_impl(sort_impl(first, size_left, comp), sort_impl(first2, size_right, comp), comp);
+void forward_list<t_type, t_allocator>::sort_impl(t_node_pointer &first, t_compare &comp) {
+  if ((nullptr == first) || (nullptr == first->m_next)) {
+    return;
+  }
+
+  constexpr size_type max_runs{64U};
+  t_node_pointer      runs[max_runs]{};
+  size_type           runs_used{0U};
+  t_node_pointer      carry{nullptr};
+
+  auto guard = ::portable_stl::make_exception_guard([&first, &runs, &runs_used, &carry]() noexcept {
+    for (size_type index{0U}; index < runs_used; ++index) {
+      carry = append_chain(carry, runs[index]);
+    }
+    first = append_chain(carry, first);
+  });
+
+  while (nullptr != first) {
+    carry         = first;
+    first         = first->m_next;
+    carry->m_next = nullptr;
+
+    size_type index{0U};
+    for (; (index < runs_used) && (nullptr != runs[index]); ++index) {
+      // the run in the slot holds earlier elements, keep it first for stability
+      t_node_pointer const merging{carry};
+      carry = nullptr;
+      merge_runs_impl(runs[index], merging, comp);
+      carry       = runs[index];
+      runs[index] = nullptr;
+    }
+    if (index == max_runs) {
+      --index;
+    }
+    if (index == runs_used) {
+      ++runs_used;
+    }
+    runs[index] = carry;
+    carry       = nullptr;
+  }
+
+  for (size_type index{0U}; index < runs_used; ++index) {
+    t_node_pointer const merging{carry};
+    carry = nullptr;
+    merge_runs_impl(runs[index], merging, comp);
+    carry       = runs[index];
+    runs[index] = nullptr;
   }
+  guard.commit();
+  first = carry;
 }
 
 /**
@@ -0,0 +1,175 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="boyer_moore_horspool_searcher.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BOYER_MOORE_HORSPOOL_SEARCHER_H
+#define PSTL_BOYER_MOORE_HORSPOOL_SEARCHER_H
+
+#include "../error/portable_stl_error.h"
+#include "../iterator/iterator_traits.h"
+#include "../language_support/bad_alloc.h"
+#include "../metaprogramming/cv_modifications/remove_cv.h"
+#include "../metaprogramming/primary_type/is_integral.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/move.h"
+#include "../utility/tuple/tuple.h"
+#include "equal_to.h"
+#include "searcher_skip_table.h"
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#  include "../language_support/exception/throw_on_true.h"
+#else
+#  include "../language_support/no_exception/throw_on_true.h"
+#endif
+
+namespace portable_stl {
+/**
+ * @brief Searcher of the pattern by the Boyer-Moore-Horspool algorithm.
+ * The bad character table is built once by the constructor, so the searches of the same pattern in many ranges share
+ * it. The table is the flat array for the byte elements and the hash table for the wider elements. The pattern is
+ * compared from its end, after the mismatch the pattern is shifted by the table entry of the text element under the
+ * last pattern element. The search is sublinear on the long patterns over the large alphabets.
+ *
+ * The pattern range must outlive the searcher.
+ *
+ * @tparam t_random_access_iterator the type of the pattern iterator.
+ * @tparam t_binary_predicate the type of the predicate, it must agree with the equality of the elements.
+ */
+template<class t_random_access_iterator, class t_binary_predicate = ::portable_stl::equal_to<>>
+class boyer_moore_horspool_searcher final {
+  /**
+   * @brief Type of the pattern elements.
+   */
+  using t_key
+    = ::portable_stl::remove_cv_t<typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type>;
+  /**
+   * @brief Difference type.
+   */
+  using t_difference = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+  static_assert(::portable_stl::is_integral<t_key>{}(), "the bad character table is indexed by the integer elements");
+
+  /**
+   * @brief The beginning of the pattern.
+   */
+  t_random_access_iterator                                                   m_first;
+  /**
+   * @brief The length of the pattern.
+   */
+  t_difference                                                               m_length;
+  /**
+   * @brief Predicate.
+   */
+  t_binary_predicate                                                         m_pred;
+  /**
+   * @brief Bad character table.
+   */
+  ::portable_stl::functional_helper::searcher_skip_table<t_key, t_difference> m_skip;
+
+  /**
+   * @brief Constructs the searcher, the table is not built.
+   * @param first the beginning of the pattern.
+   * @param last the end of the pattern.
+   * @param pred the predicate.
+   * @param unused distinguishes the constructor from the public one.
+   */
+  boyer_moore_horspool_searcher(t_random_access_iterator first,
+                                t_random_access_iterator last,
+                                t_binary_predicate const &pred,
+                                ::portable_stl::size_t) noexcept
+      : m_first(first), m_length(last - first), m_pred(pred), m_skip(m_length) {
+  }
+
+  /**
+   * @brief Builds the bad character table.
+   * @return true if success, false if memory cannot be allocated.
+   */
+  bool M_build() {
+    if (!m_skip.reserve(static_cast<::portable_stl::size_t>(m_length))) {
+      return false;
+    }
+    ::portable_stl::functional_helper::searcher_fill_skip_table<t_key>(m_skip, m_first, m_length);
+    return true;
+  }
+
+public:
+  /**
+   * @brief Constructs the searcher of the pattern [first, last).
+   * @throw bad_alloc if memory for the table cannot be allocated.
+   * @param first the beginning of the pattern.
+   * @param last the end of the pattern.
+   * @param pred the predicate.
+   */
+  boyer_moore_horspool_searcher(t_random_access_iterator  first,
+                                t_random_access_iterator  last,
+                                t_binary_predicate const &pred = t_binary_predicate())
+      : boyer_moore_horspool_searcher(first, last, pred, 0U) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!M_build());
+  }
+
+  /**
+   * @brief Constructs the searcher of the pattern [first, last).
+   * @param first the beginning of the pattern.
+   * @param last the end of the pattern.
+   * @param pred the predicate.
+   * @return the searcher or allocate_error if memory for the table cannot be allocated.
+   */
+  static ::portable_stl::expected<boyer_moore_horspool_searcher, ::portable_stl::portable_stl_error>
+    make_boyer_moore_horspool_searcher(t_random_access_iterator  first,
+                                       t_random_access_iterator  last,
+                                       t_binary_predicate const &pred = t_binary_predicate()) {
+    boyer_moore_horspool_searcher searcher(first, last, pred, 0U);
+    if (!searcher.M_build()) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+    return ::portable_stl::expected<boyer_moore_horspool_searcher, ::portable_stl::portable_stl_error>(
+      ::portable_stl::move(searcher));
+  }
+
+  /**
+   * @brief Finds the first occurrence of the pattern in the range [first, last).
+   * @tparam t_random_access_iterator2 the type of the range iterator, its elements have the pattern element type.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the beginning and the end of the occurrence, (first, first) for the empty pattern, (last, last) if the
+   * pattern is not found.
+   */
+  template<class t_random_access_iterator2>
+  ::portable_stl::tuple<t_random_access_iterator2, t_random_access_iterator2> operator()(
+    t_random_access_iterator2 first, t_random_access_iterator2 last) const {
+    using t_difference2 = typename ::portable_stl::iterator_traits<t_random_access_iterator2>::difference_type;
+
+    if (0 == m_length) {
+      return ::portable_stl::tuple<t_random_access_iterator2, t_random_access_iterator2>(first, first);
+    }
+
+    auto const    length = static_cast<t_difference2>(m_length);
+    t_difference2 remain{last - first};
+    while (remain >= length) {
+      // compare from the end of the pattern
+      t_difference index{m_length - 1};
+      while (m_pred(first[static_cast<t_difference2>(index)], m_first[index])) {
+        if (0 == index) {
+          return ::portable_stl::tuple<t_random_access_iterator2, t_random_access_iterator2>(first, first + length);
+        }
+        --index;
+      }
+      auto const shift = static_cast<t_difference2>(m_skip.get(static_cast<t_key>(first[length - 1])));
+      first  += shift;
+      remain -= shift;
+    }
+    return ::portable_stl::tuple<t_random_access_iterator2, t_random_access_iterator2>(last, last);
+  }
+};
+} // namespace portable_stl
+
+#endif // PSTL_BOYER_MOORE_HORSPOOL_SEARCHER_H
@@ -0,0 +1,232 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="boyer_moore_searcher.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BOYER_MOORE_SEARCHER_H
+#define PSTL_BOYER_MOORE_SEARCHER_H
+
+#include "../common/size_t.h"
+#include "../error/portable_stl_error.h"
+#include "../iterator/iterator_traits.h"
+#include "../language_support/bad_alloc.h"
+#include "../metaprogramming/cv_modifications/remove_cv.h"
+#include "../metaprogramming/primary_type/is_integral.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/move.h"
+#include "../utility/tuple/tuple.h"
+#include "../vector/vector.h"
+#include "equal_to.h"
+#include "searcher_skip_table.h"
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#  include "../language_support/exception/throw_on_true.h"
+#else
+#  include "../language_support/no_exception/throw_on_true.h"
+#endif
+
+namespace portable_stl {
+/**
+ * @brief Searcher of the pattern by the Boyer-Moore algorithm.
+ * The bad character and the good suffix tables are built once by the constructor, so the searches of the same pattern
+ * in many ranges share them. The bad character table is the flat array for the byte elements and the hash table for
+ * the wider elements. The pattern is compared from its end, after the mismatch the pattern is shifted by the larger of
+ * the bad character shift and the good suffix shift, so the search has linear worst case on the periodic patterns,
+ * where the Horspool shift degrades to one element.
+ *
+ * The pattern range must outlive the searcher.
+ *
+ * @tparam t_random_access_iterator the type of the pattern iterator.
+ * @tparam t_binary_predicate the type of the predicate, it must agree with the equality of the elements.
+ */
+template<class t_random_access_iterator, class t_binary_predicate = ::portable_stl::equal_to<>>
+class boyer_moore_searcher final {
+  /**
+   * @brief Type of the pattern elements.
+   */
+  using t_key
+    = ::portable_stl::remove_cv_t<typename ::portable_stl::iterator_traits<t_random_access_iterator>::value_type>;
+  /**
+   * @brief Difference type.
+   */
+  using t_difference = typename ::portable_stl::iterator_traits<t_random_access_iterator>::difference_type;
+
+  static_assert(::portable_stl::is_integral<t_key>{}(), "the bad character table is indexed by the integer elements");
+
+  /**
+   * @brief The beginning of the pattern.
+   */
+  t_random_access_iterator                                                    m_first;
+  /**
+   * @brief The length of the pattern.
+   */
+  t_difference                                                                m_length;
+  /**
+   * @brief Predicate.
+   */
+  t_binary_predicate                                                          m_pred;
+  /**
+   * @brief Bad character table.
+   */
+  ::portable_stl::functional_helper::searcher_skip_table<t_key, t_difference> m_skip;
+  /**
+   * @brief Good suffix table: the shift after the mismatch at the pattern position.
+   */
+  ::portable_stl::vector<t_difference>                                        m_suffix_shift;
+
+  /**
+   * @brief Constructs the searcher, the tables are not built.
+   * @param first the beginning of the pattern.
+   * @param last the end of the pattern.
+   * @param pred the predicate.
+   * @param unused distinguishes the constructor from the public one.
+   */
+  boyer_moore_searcher(t_random_access_iterator  first,
+                       t_random_access_iterator  last,
+                       t_binary_predicate const &pred,
+                       ::portable_stl::size_t) noexcept
+      : m_first(first), m_length(last - first), m_pred(pred), m_skip(m_length), m_suffix_shift() {
+  }
+
+  /**
+   * @brief Builds the bad character and the good suffix tables.
+   * @return true if success, false if memory cannot be allocated.
+   */
+  bool M_build() {
+    if (0 == m_length) {
+      return true;
+    }
+    auto const length = static_cast<::portable_stl::size_t>(m_length);
+    if (!m_skip.reserve(length)) {
+      return false;
+    }
+    ::portable_stl::functional_helper::searcher_fill_skip_table<t_key>(m_skip, m_first, m_length);
+
+    // suffix_length[i] is the length of the longest common suffix of the pattern and its prefix ending at i
+    ::portable_stl::vector<t_difference> suffix;
+    if ((!suffix.resize(length, t_difference())) || (!m_suffix_shift.resize(length, m_length))) {
+      return false;
+    }
+    t_difference *const suffix_length{suffix.data()};
+    t_difference *const suffix_shift{m_suffix_shift.data()};
+    t_difference const  last{m_length - 1};
+    suffix_length[last] = m_length;
+    t_difference start{last};
+    t_difference end{last};
+    for (t_difference index{last - 1}; index >= 0; --index) {
+      if ((index > start) && (suffix_length[index + last - end] < index - start)) {
+        suffix_length[index] = suffix_length[index + last - end];
+      } else {
+        if (index < start) {
+          start = index;
+        }
+        end = index;
+        while ((start >= 0) && m_pred(m_first[start], m_first[start + last - end])) {
+          --start;
+        }
+        suffix_length[index] = end - start;
+      }
+    }
+
+    // the suffix matched before the mismatch at position is a prefix of the pattern
+    t_difference position{0};
+    for (t_difference index{last}; index >= 0; --index) {
+      if (suffix_length[index] == index + 1) {
+        for (; position < last - index; ++position) {
+          if (suffix_shift[position] == m_length) {
+            suffix_shift[position] = last - index;
+          }
+        }
+      }
+    }
+    // the suffix matched before the mismatch at position occurs elsewhere in the pattern
+    for (t_difference index{0}; index < last; ++index) {
+      suffix_shift[last - suffix_length[index]] = last - index;
+    }
+    return true;
+  }
+
+public:
+  /**
+   * @brief Constructs the searcher of the pattern [first, last).
+   * @throw bad_alloc if memory for the tables cannot be allocated.
+   * @param first the beginning of the pattern.
+   * @param last the end of the pattern.
+   * @param pred the predicate.
+   */
+  boyer_moore_searcher(t_random_access_iterator  first,
+                       t_random_access_iterator  last,
+                       t_binary_predicate const &pred = t_binary_predicate())
+      : boyer_moore_searcher(first, last, pred, 0U) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!M_build());
+  }
+
+  /**
+   * @brief Constructs the searcher of the pattern [first, last).
+   * @param first the beginning of the pattern.
+   * @param last the end of the pattern.
+   * @param pred the predicate.
+   * @return the searcher or allocate_error if memory for the tables cannot be allocated.
+   */
+  static ::portable_stl::expected<boyer_moore_searcher, ::portable_stl::portable_stl_error> make_boyer_moore_searcher(
+    t_random_access_iterator  first,
+    t_random_access_iterator  last,
+    t_binary_predicate const &pred = t_binary_predicate()) {
+    boyer_moore_searcher searcher(first, last, pred, 0U);
+    if (!searcher.M_build()) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+    return ::portable_stl::expected<boyer_moore_searcher, ::portable_stl::portable_stl_error>(
+      ::portable_stl::move(searcher));
+  }
+
+  /**
+   * @brief Finds the first occurrence of the pattern in the range [first, last).
+   * @tparam t_random_access_iterator2 the type of the range iterator, its elements have the pattern element type.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the beginning and the end of the occurrence, (first, first) for the empty pattern, (last, last) if the
+   * pattern is not found.
+   */
+  template<class t_random_access_iterator2>
+  ::portable_stl::tuple<t_random_access_iterator2, t_random_access_iterator2> operator()(
+    t_random_access_iterator2 first, t_random_access_iterator2 last) const {
+    using t_difference2 = typename ::portable_stl::iterator_traits<t_random_access_iterator2>::difference_type;
+
+    if (0 == m_length) {
+      return ::portable_stl::tuple<t_random_access_iterator2, t_random_access_iterator2>(first, first);
+    }
+
+    auto const    length = static_cast<t_difference2>(m_length);
+    t_difference2 remain{last - first};
+    while (remain >= length) {
+      // compare from the end of the pattern
+      t_difference index{m_length - 1};
+      while (m_pred(first[static_cast<t_difference2>(index)], m_first[index])) {
+        if (0 == index) {
+          return ::portable_stl::tuple<t_random_access_iterator2, t_random_access_iterator2>(first, first + length);
+        }
+        --index;
+      }
+      // the bad character shift aligns the mismatched element with its last occurrence left of index
+      t_difference const bad_character{m_skip.get(static_cast<t_key>(first[static_cast<t_difference2>(index)]))
+                                       - (m_length - 1 - index)};
+      t_difference const good_suffix{m_suffix_shift[static_cast<::portable_stl::size_t>(index)]};
+      auto const shift = static_cast<t_difference2>((bad_character < good_suffix) ? good_suffix : bad_character);
+      first  += shift;
+      remain -= shift;
+    }
+    return ::portable_stl::tuple<t_random_access_iterator2, t_random_access_iterator2>(last, last);
+  }
+};
+} // namespace portable_stl
+
+#endif // PSTL_BOYER_MOORE_SEARCHER_H
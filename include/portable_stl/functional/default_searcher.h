@@ -0,0 +1,79 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="default_searcher.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_DEFAULT_SEARCHER_H
+#define PSTL_DEFAULT_SEARCHER_H
+
+#include "../algorithm/search.h"
+#include "../iterator/iterator_traits.h"
+#include "../utility/tuple/tuple.h"
+#include "equal_to.h"
+
+namespace portable_stl {
+/**
+ * @brief Searcher of the pattern by the element-wise comparison of search, without the precomputed tables.
+ *
+ * The pattern range must outlive the searcher.
+ *
+ * @tparam t_forward_iterator the type of the pattern iterator.
+ * @tparam t_binary_predicate the type of the predicate.
+ */
+template<class t_forward_iterator, class t_binary_predicate = ::portable_stl::equal_to<>> class default_searcher final {
+  /**
+   * @brief The beginning of the pattern.
+   */
+  t_forward_iterator m_first;
+  /**
+   * @brief The end of the pattern.
+   */
+  t_forward_iterator m_last;
+  /**
+   * @brief Predicate.
+   */
+  t_binary_predicate m_pred;
+
+public:
+  /**
+   * @brief Constructs the searcher of the pattern [first, last).
+   * @param first the beginning of the pattern.
+   * @param last the end of the pattern.
+   * @param pred the predicate.
+   */
+  default_searcher(t_forward_iterator        first,
+                   t_forward_iterator        last,
+                   t_binary_predicate const &pred = t_binary_predicate())
+      : m_first(first), m_last(last), m_pred(pred) {
+  }
+
+  /**
+   * @brief Finds the first occurrence of the pattern in the range [first, last).
+   * @tparam t_forward_iterator2 the type of the range iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return the beginning and the end of the occurrence, (first, first) for the empty pattern, (last, last) if the
+   * pattern is not found.
+   */
+  template<class t_forward_iterator2>
+  ::portable_stl::tuple<t_forward_iterator2, t_forward_iterator2> operator()(t_forward_iterator2 first,
+                                                                             t_forward_iterator2 last) const {
+    return ::portable_stl::algorithm_helper::search_impl<t_binary_predicate const &>(
+      first,
+      last,
+      m_first,
+      m_last,
+      m_pred,
+      typename ::portable_stl::iterator_traits<t_forward_iterator2>::iterator_category(),
+      typename ::portable_stl::iterator_traits<t_forward_iterator>::iterator_category());
+  }
+};
+} // namespace portable_stl
+
+#endif // PSTL_DEFAULT_SEARCHER_H
@@ -0,0 +1,66 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="minus.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_MINUS_H
+#define PSTL_MINUS_H
+
+#include "../utility/general/forward.h"
+
+namespace portable_stl {
+
+/**
+ * @brief Function object for performing arithmetic.
+ * The main template invokes operator- on type t_type.
+ * @tparam t_type the type of arguments.
+ */
+template<class t_type = void> class minus final {
+public:
+  /**
+   * @brief The type of result value.
+   */
+  using result_type = t_type;
+
+  /**
+   * @brief The type of first argument.
+   */
+  using first_argument_type = t_type;
+
+  /**
+   * @brief The type of second argument.
+   */
+  using second_argument_type = t_type;
+
+  /**
+   * @brief Returns the difference of the arguments.
+   * @param first the first argument.
+   * @param second the second argument.
+   * @return the difference of the arguments.
+   */
+  constexpr inline result_type operator()(first_argument_type const &first, second_argument_type const &second) const
+    noexcept(noexcept(first - second)) {
+    return first - second;
+  }
+};
+
+template<> class minus<void> final {
+public:
+  template<class t_type1, class t_type2>
+  auto operator()(t_type1 &&first, t_type2 &&second) const
+    noexcept(noexcept(::portable_stl::forward<t_type1>(first) - ::portable_stl::forward<t_type2>(second)))
+      -> decltype(::portable_stl::forward<t_type1>(first) - ::portable_stl::forward<t_type2>(second)) {
+    return ::portable_stl::forward<t_type1>(first) - ::portable_stl::forward<t_type2>(second);
+  }
+
+  using is_transparent = void;
+};
+} // namespace portable_stl
+
+#endif // PSTL_MINUS_H
@@ -0,0 +1,205 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="searcher_skip_table.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SEARCHER_SKIP_TABLE_H
+#define PSTL_SEARCHER_SKIP_TABLE_H
+
+#include "../common/size_t.h"
+#include "../common/uint64_t.h"
+#include "../vector/vector.h"
+
+namespace portable_stl {
+namespace functional_helper {
+  /**
+   * @brief Bad character table of the Boyer-Moore searchers: maps the element of the pattern to its shift.
+   * The table for the wider elements is the open addressing hash table with the linear probing, sized for the
+   * pattern. A slot holding the default value is free, so the table never stores the default value.
+   * @tparam t_key the type of the elements, an integer.
+   * @tparam t_value the type of the shifts.
+   * @tparam t_byte the elements are bytes.
+   */
+  template<class t_key, class t_value, bool t_byte = (sizeof(t_key) == 1U)> class searcher_skip_table final {
+    /**
+     * @brief Slot of the table.
+     */
+    class t_slot final {
+    public:
+      /**
+       * @brief Key.
+       */
+      t_key   m_key;
+      /**
+       * @brief Value, the default value in the free slot.
+       */
+      t_value m_value;
+    };
+
+    /**
+     * @brief Slots, the number of slots is a power of 2.
+     */
+    ::portable_stl::vector<t_slot> m_slots;
+    /**
+     * @brief Value of the absent keys.
+     */
+    t_value                        m_default;
+    /**
+     * @brief Number of slots minus 1.
+     */
+    ::portable_stl::size_t         m_mask;
+    /**
+     * @brief Shift of the hash to the slot index: 64 minus the number of the index bits.
+     */
+    ::portable_stl::size_t         m_shift;
+
+    /**
+     * @brief Returns the first slot of the probe sequence of the key.
+     * @param key the key.
+     * @return the slot index.
+     */
+    ::portable_stl::size_t M_slot(t_key key) const noexcept {
+      // the high bits of the Fibonacci hash mix all bits of the key
+      return static_cast<::portable_stl::size_t>((static_cast<::portable_stl::uint64_t>(key) * 0x9E3779B97F4A7C15ULL)
+                                                 >> m_shift);
+    }
+
+  public:
+    /**
+     * @brief Constructs the empty table.
+     * @param default_value the value of the absent keys.
+     */
+    explicit searcher_skip_table(t_value default_value) noexcept
+        : m_slots(), m_default(default_value), m_mask(0U), m_shift(64U) {
+    }
+
+    /**
+     * @brief Allocates the slots for the given number of the distinct keys, the table becomes empty.
+     * @param count the number of the distinct keys.
+     * @return true if success, false if memory cannot be allocated.
+     */
+    bool reserve(::portable_stl::size_t count) noexcept {
+      // at most a quarter of the slots are used, the probe of the absent key mostly stops at the first slot
+      ::portable_stl::size_t slots{8U};
+      ::portable_stl::size_t shift{61U};
+      while (slots < 4U * count) {
+        slots *= 2U;
+        --shift;
+      }
+      m_slots.clear();
+      if (!m_slots.resize(slots, t_slot{t_key(), m_default})) {
+        return false;
+      }
+      m_mask  = slots - 1U;
+      m_shift = shift;
+      return true;
+    }
+
+    /**
+     * @brief Sets the value of the key.
+     * UB: value is the default value, more distinct keys than reserved.
+     * @param key the key.
+     * @param value the value.
+     */
+    void set(t_key key, t_value value) noexcept {
+      ::portable_stl::size_t index{M_slot(key)};
+      while ((m_slots[index].m_value != m_default) && (m_slots[index].m_key != key)) {
+        index = (index + 1U) & m_mask;
+      }
+      m_slots[index].m_key   = key;
+      m_slots[index].m_value = value;
+    }
+
+    /**
+     * @brief Returns the value of the key.
+     * @param key the key.
+     * @return the value or the default value if the key is absent.
+     */
+    t_value get(t_key key) const noexcept {
+      t_slot const          *slots{m_slots.data()};
+      ::portable_stl::size_t index{M_slot(key)};
+      while (slots[index].m_value != m_default) {
+        if (slots[index].m_key == key) {
+          return slots[index].m_value;
+        }
+        index = (index + 1U) & m_mask;
+      }
+      return m_default;
+    }
+  };
+
+  /**
+   * @brief Bad character table of the Boyer-Moore searchers for the byte elements: the flat array of 256 values.
+   * @tparam t_key the type of the elements, an integer.
+   * @tparam t_value the type of the shifts.
+   */
+  template<class t_key, class t_value> class searcher_skip_table<t_key, t_value, true> final {
+    /**
+     * @brief Values of all bytes.
+     */
+    t_value m_values[256];
+
+  public:
+    /**
+     * @brief Constructs the empty table.
+     * @param default_value the value of the absent keys.
+     */
+    explicit searcher_skip_table(t_value default_value) noexcept {
+      for (t_value &value : m_values) {
+        value = default_value;
+      }
+    }
+
+    /**
+     * @brief The array needs no memory.
+     * @return true.
+     */
+    bool reserve(::portable_stl::size_t) noexcept {
+      return true;
+    }
+
+    /**
+     * @brief Sets the value of the key.
+     * @param key the key.
+     * @param value the value.
+     */
+    void set(t_key key, t_value value) noexcept {
+      m_values[static_cast<unsigned char>(key)] = value;
+    }
+
+    /**
+     * @brief Returns the value of the key.
+     * @param key the key.
+     * @return the value or the default value if the key is absent.
+     */
+    t_value get(t_key key) const noexcept {
+      return m_values[static_cast<unsigned char>(key)];
+    }
+  };
+  /**
+   * @brief Fills the bad character table of the pattern: the distance from the last occurrence of the element in the
+   * pattern without its last element to the end of the pattern.
+   * @tparam t_key the type of the elements.
+   * @tparam t_table the type of the table.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_difference the type of the pattern length.
+   * @param table the table with the pattern length as the default value.
+   * @param first the beginning of the pattern.
+   * @param length the length of the pattern.
+   */
+  template<class t_key, class t_table, class t_random_access_iterator, class t_difference>
+  void searcher_fill_skip_table(t_table &table, t_random_access_iterator first, t_difference length) {
+    for (t_difference index{0}; index < length - 1; ++index) {
+      table.set(static_cast<t_key>(first[index]), length - 1 - index);
+    }
+  }
+} // namespace functional_helper
+} // namespace portable_stl
+
+#endif // PSTL_SEARCHER_SKIP_TABLE_H
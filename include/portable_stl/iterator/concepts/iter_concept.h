@@ -39,10 +39,10 @@ namespace iterator_helper {
     /**
      * @brief Result type.
      */
-    using type
-      = ::portable_stl::conditional_bool_constant_t<::portable_stl::iterator_helper::is_primary_template<t_iterator>,
-                                                    t_iterator,
-                                                    ::portable_stl::iterator_traits<t_iterator>>;
+    using type = ::portable_stl::conditional_bool_constant_t<
+      ::portable_stl::iterator_helper::is_primary_template<::portable_stl::iterator_traits<t_iterator>>,
+      t_iterator,
+      ::portable_stl::iterator_traits<t_iterator>>;
   };
 
   /**
@@ -101,7 +101,7 @@ namespace iterator_helper {
     /**
      * @brief Result type.
      */
-    using type = typename ::portable_stl::iterator_traits<t_iterator>::iterator_concept;
+    using type = typename ITER_TRAITS<t_iterator>::iterator_concept;
   };
 
   /**
@@ -119,7 +119,7 @@ namespace iterator_helper {
     /**
      * @brief Result type.
      */
-    using type = typename ::portable_stl::iterator_traits<t_iterator>::iterator_category;
+    using type = typename ITER_TRAITS<t_iterator>::iterator_category;
   };
 
   /**
@@ -132,7 +132,8 @@ namespace iterator_helper {
                           ::portable_stl::enable_if_bool_constant_t<::portable_stl::conjunction<
                             ::portable_stl::negation<has_iterator_concept_type<t_iterator>>,
                             ::portable_stl::negation<has_iterator_category_type<t_iterator>>,
-                            ::portable_stl::iterator_helper::is_primary_template<t_iterator>>>>
+                            ::portable_stl::iterator_helper::is_primary_template<
+                              ::portable_stl::iterator_traits<t_iterator>>>>>
     final {
   public:
     /**
@@ -12,6 +12,7 @@
 #ifndef PSTL_INCREMENTABLE_TRAITS_H
 #define PSTL_INCREMENTABLE_TRAITS_H
 
+#include "../common/ptrdiff_t.h"
 #include "../metaprogramming/composite_type/is_object.h"
 #include "../metaprogramming/logical_operator/conjunction.h"
 #include "../metaprogramming/logical_operator/negation.h"
@@ -81,7 +82,7 @@ public:
   /**
    * @brief Associated difference type.
    */
-  using difference_type = ptrdiff_t;
+  using difference_type = ::portable_stl::ptrdiff_t;
 };
 
 /**
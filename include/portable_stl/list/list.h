@@ -424,6 +424,7 @@ public:
 
   /**
    * @brief Replaces the contents of the list with count copies of value value.
+   * The existing nodes are reused, the values are assigned to them in place, only the missing nodes are allocated.
    *
    * @param num The new size of the list.
    * @param value The value to initialize elements of the list with.
@@ -433,6 +434,7 @@ public:
 
   /**
    * @brief Replaces the contents of the list with copies of those in the range [first, last).
+   * The existing nodes are reused, the values are assigned to them in place, only the missing nodes are allocated.
    * The behavior is undefined if either argument is an iterator into *this.
    *
    * @tparam t_input_iterator Satisfies LegacyInputIterator.
@@ -1137,7 +1139,10 @@ private:
   void        M_link_nodes_at_back(t_link_pointer first, t_link_pointer last);
   iterator    M_iterator(size_type num);
 
-  template<class t_comp> static iterator M_sort(iterator first1, iterator end2, size_type num, t_comp &comp);
+  static t_link_pointer M_append_chain(t_link_pointer first, t_link_pointer second) noexcept;
+  static void           M_relink_chain(t_link_pointer end_link, t_link_pointer first) noexcept;
+  template<class t_comp> static void M_merge_runs(t_link_pointer &first1, t_link_pointer first2, t_comp &comp);
+  template<class t_comp> static void M_sort(t_link_pointer &first, t_comp &comp);
 
   void move_assign(list &other_transformations_helper,
                    true_type) noexcept(::portable_stl::is_nothrow_move_assignable<t_node_allocator>{}());
@@ -2066,71 +2071,198 @@ template<class t_type, class t_allocator> inline void list<t_type, t_allocator>:
   sort(::portable_stl::less<>());
 }
 
+/**
+ * @brief Sorts the elements and preserves the order of equivalent elements.
+ * The nodes are sorted as a null-terminated chain of m_next links, the m_prev links are restored afterwards. If the
+ * comparison throws, all nodes are linked back into the list in unspecified order.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
+ * memory.
+ * @tparam t_comp Must meet the requirements of Compare.
+ * @param comp Comparison function object.
+ */
 template<class t_type, class t_allocator>
 template<class t_comp>
 inline void list<t_type, t_allocator>::sort(t_comp comp) {
-  M_sort(begin(), end(), base::size_val(), comp);
+  if (base::size_val() > 1U) {
+    t_link_pointer end_link{base::end_as_link()};
+    end_link->m_prev->m_next = nullptr;
+
+    t_link_pointer first{end_link->m_next};
+    auto           guard = ::portable_stl::make_exception_guard([end_link, &first]() noexcept {
+      M_relink_chain(end_link, first);
+    });
+    M_sort(first, comp);
+    guard.commit();
+    M_relink_chain(end_link, first);
+  }
 }
 
+/**
+ * @brief Appends the null-terminated chain to the end of another one.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
+ * memory.
+ * @param first The first node of the first chain.
+ * @param second The first node of the appended chain.
+ * @return The first node of the joined chain, only m_next links are valid.
+ */
+template<class t_type, class t_allocator>
+typename list<t_type, t_allocator>::t_link_pointer list<t_type, t_allocator>::M_append_chain(
+  t_link_pointer first, t_link_pointer second) noexcept {
+  if (nullptr == first) {
+    return second;
+  }
+  t_link_pointer last{first};
+  while (nullptr != last->m_next) {
+    last = last->m_next;
+  }
+  last->m_next = second;
+  return first;
+}
+
+/**
+ * @brief Links the null-terminated chain between the end node: restores the m_prev links and the circular links.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
+ * memory.
+ * @param end_link The end node of the list.
+ * @param first The first node of the non-empty chain.
+ */
+template<class t_type, class t_allocator>
+void list<t_type, t_allocator>::M_relink_chain(t_link_pointer end_link, t_link_pointer first) noexcept {
+  t_link_pointer prev{end_link};
+  end_link->m_next = first;
+  for (t_link_pointer node{first}; nullptr != node; node = node->m_next) {
+    node->m_prev = prev;
+    prev         = node;
+  }
+  prev->m_next     = end_link;
+  end_link->m_prev = prev;
+}
+
+/**
+ * @brief Merges two sorted null-terminated chains, the nodes of the first one go first among equivalent ones.
+ * If the comparison throws, first1 holds all nodes of both chains in unspecified order.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
+ * memory.
+ * @tparam t_comp Must meet the requirements of Compare.
+ * @param first1 The first node of the first chain, receives the first node of the merged chain (only m_next links are
+ * valid).
+ * @param first2 The first node of the second chain.
+ * @param comp Comparison function object.
+ */
 template<class t_type, class t_allocator>
 template<class t_comp>
-typename list<t_type, t_allocator>::iterator list<t_type, t_allocator>::M_sort(
-  iterator first1, iterator end2, size_type num, t_comp &comp) {
-  switch (num) {
-    case 0:
-    case 1:
-      return first1;
-    case 2:
-      if (comp(*--end2, *first1)) {
-        t_link_pointer first_node_link = end2.m_ptr;
-        base::unlink_nodes(first_node_link, first_node_link);
-        M_link_nodes(first1.m_ptr, first_node_link, first_node_link);
-        return end2;
-      }
-      return first1;
-    default:
-      break; // do nothing
-  }
-  size_type num_div_2 = num / 2;
-  iterator  end1      = ::portable_stl::next(
-    first1, static_cast<typename ::portable_stl::iterator_traits<iterator>::difference_type>(num_div_2));
-  iterator ret = first1 = M_sort(first1, end1, num_div_2, comp);
-  iterator first2 = end1 = M_sort(end1, end2, num - num_div_2, comp);
-  if (comp(*first2, *first1)) {
-    iterator next_node2 = ::portable_stl::next(first2);
-    for (; (next_node2 != end2) && comp(*next_node2, *first1); ++next_node2)
-      ;
-    t_link_pointer first_node_link = first2.m_ptr;
-    t_link_pointer last_node_link  = next_node2.m_ptr->m_prev;
-    ret                            = first2;
-    end1 = first2 = next_node2;
-    base::unlink_nodes(first_node_link, last_node_link);
-    next_node2 = ::portable_stl::next(first1);
-    M_link_nodes(first1.m_ptr, first_node_link, last_node_link);
-    first1 = next_node2;
+void list<t_type, t_allocator>::M_merge_runs(t_link_pointer &first1, t_link_pointer first2, t_comp &comp) {
+  t_link_pointer rest1{first1};
+  t_link_pointer head{nullptr};
+  t_link_pointer tail{nullptr};
+
+  auto guard = ::portable_stl::make_exception_guard([&first1, &rest1, &first2, &head, &tail]() noexcept {
+    // keep the merged part and the rest of both chains in one chain
+    if (nullptr != tail) {
+      tail->m_next = rest1;
+      rest1        = head;
+    }
+    first1 = M_append_chain(rest1, first2);
+  });
+
+  while ((nullptr != rest1) && (nullptr != first2)) {
+    t_link_pointer node;
+    if (comp(first2->as_node()->get_value(), rest1->as_node()->get_value())) {
+      node   = first2;
+      first2 = first2->m_next;
+    } else {
+      node  = rest1;
+      rest1 = rest1->m_next;
+    }
+    if (nullptr == tail) {
+      head = node;
+    } else {
+      tail->m_next = node;
+    }
+    tail = node;
+  }
+  guard.commit();
+
+  t_link_pointer const rest{(nullptr != rest1) ? rest1 : first2};
+  if (nullptr == tail) {
+    first1 = rest;
   } else {
-    ++first1;
+    tail->m_next = rest;
+    first1       = head;
   }
-  while (first1 != end1 && first2 != end2) {
-    if (comp(*first2, *first1)) {
-      iterator next_node2 = ::portable_stl::next(first2);
-      for (; (next_node2 != end2) && comp(*next_node2, *first1); ++next_node2)
-        ;
-      t_link_pointer first_node_link = first2.m_ptr;
-      t_link_pointer last_node_link  = next_node2.m_ptr->m_prev;
-      if (end1 == first2) {
-        end1 = next_node2;
-      }
-      first2 = next_node2;
-      base::unlink_nodes(first_node_link, last_node_link);
-      next_node2 = ::portable_stl::next(first1);
-      M_link_nodes(first1.m_ptr, first_node_link, last_node_link);
-      first1 = next_node2;
-    } else {
-      ++first1;
+}
+
+/**
+ * @brief Sort implementation.
+ * Bottom-up merge sort: runs[i] is either empty or holds a sorted run of 2^i nodes. Every node taken from the chain is
+ * carried up through the occupied slots like a binary counter, so the sort is neither recursive nor allocating.
+ * Every node is always reachable from exactly one of first, carry and runs, so if the comparison throws they are
+ * joined back into one chain.
+ *
+ * @tparam t_type The type of the elements.
+ * @tparam t_allocator An allocator that is used to acquire/release memory and to construct/destroy the elements in that
+ * memory.
+ * @tparam t_comp Must meet the requirements of Compare.
+ * @param first The first node of the null-terminated chain, receives the first node of the sorted chain (only m_next
+ * links are valid).
+ * @param comp Comparison function object.
+ */
+template<class t_type, class t_allocator>
+template<class t_comp>
+void list<t_type, t_allocator>::M_sort(t_link_pointer &first, t_comp &comp) {
+  constexpr size_type max_runs{64U};
+  t_link_pointer      runs[max_runs]{};
+  size_type           runs_used{0U};
+  t_link_pointer      carry{nullptr};
+
+  auto guard = ::portable_stl::make_exception_guard([&first, &runs, &runs_used, &carry]() noexcept {
+    for (size_type index{0U}; index < runs_used; ++index) {
+      carry = M_append_chain(carry, runs[index]);
+    }
+    first = M_append_chain(carry, first);
+  });
+
+  while (nullptr != first) {
+    carry         = first;
+    first         = first->m_next;
+    carry->m_next = nullptr;
+
+    size_type index{0U};
+    for (; (index < runs_used) && (nullptr != runs[index]); ++index) {
+      // the run in the slot holds earlier elements, keep it first for stability
+      t_link_pointer const merging{carry};
+      carry = nullptr;
+      M_merge_runs(runs[index], merging, comp);
+      carry       = runs[index];
+      runs[index] = nullptr;
     }
+    if (index == max_runs) {
+      --index;
+    }
+    if (index == runs_used) {
+      ++runs_used;
+    }
+    runs[index] = carry;
+    carry       = nullptr;
+  }
+
+  for (size_type index{0U}; index < runs_used; ++index) {
+    t_link_pointer const merging{carry};
+    carry = nullptr;
+    M_merge_runs(runs[index], merging, comp);
+    carry       = runs[index];
+    runs[index] = nullptr;
   }
-  return ret;
+  guard.commit();
+  first = carry;
 }
 
 template<class t_type, class t_allocator> void list<t_type, t_allocator>::reverse() noexcept {
@@ -0,0 +1,566 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="grouped_multimap.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_GROUPED_MULTIMAP_H
+#define PSTL_GROUPED_MULTIMAP_H
+
+#include "../error/portable_stl_error.h"
+#include "../functional/less.h"
+#include "../memory/allocator.h"
+#include "../memory/allocator_traits.h"
+#include "../memory/rebind_alloc.h"
+#include "../metaprogramming/other_transformations/type_identity.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "../utility/tuple/tuple.h"
+#include "../utility/tuple/tuple_get.h"
+#include "../vector/vector.h"
+#include "map.h"
+
+namespace portable_stl {
+
+/**
+ * @brief grouped_multimap is an associative container that maps a key to any number of values, like multimap, but
+ * stores the key only once. Every tree node holds a key and the vector of all its values in insertion order, so a hot
+ * key with many values costs one node instead of one node per value. Lookup of a key is O(log(k)) for k distinct
+ * keys, the values of the key are then walked over contiguous memory, and count() does not walk them at all.
+ * The container never holds a key without values.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type, rebound for the tree nodes and for the values.
+ */
+template<class t_key,
+         class t_type,
+         class t_compare   = ::portable_stl::less<t_key>,
+         class t_allocator = ::portable_stl::allocator<::portable_stl::tuple<t_key const, t_type>>>
+class grouped_multimap {
+public:
+  /**
+   * @brief Key type.
+   */
+  using key_type              = t_key;
+  /**
+   * @brief Mapped value type.
+   */
+  using mapped_type           = t_type;
+  /**
+   * @brief Key compare type.
+   */
+  using key_compare           = ::portable_stl::type_identity_t<t_compare>;
+  /**
+   * @brief Allocator type.
+   */
+  using allocator_type        = ::portable_stl::type_identity_t<t_allocator>;
+  /**
+   * @brief Allocator type of the values.
+   */
+  using values_allocator_type = ::portable_stl::rebind_alloc<::portable_stl::allocator_traits<allocator_type>, t_type>;
+  /**
+   * @brief Container of the values of one key.
+   */
+  using values_type           = ::portable_stl::vector<mapped_type, values_allocator_type>;
+  /**
+   * @brief Iterator over the values of one key.
+   */
+  using value_iterator        = typename values_type::iterator;
+  /**
+   * @brief Constant iterator over the values of one key.
+   */
+  using const_value_iterator  = typename values_type::const_iterator;
+  /**
+   * @brief Size type.
+   */
+  using size_type             = typename ::portable_stl::allocator_traits<allocator_type>::size_type;
+
+private:
+  /**
+   * @brief Allocator type of the groups.
+   */
+  using t_groups_allocator = ::portable_stl::
+    rebind_alloc<::portable_stl::allocator_traits<allocator_type>, ::portable_stl::tuple<key_type const, values_type>>;
+  /**
+   * @brief Tree of the groups.
+   */
+  using t_groups_type      = ::portable_stl::map<key_type, values_type, key_compare, t_groups_allocator>;
+  /**
+   * @brief Mutable iterator over the groups.
+   */
+  using t_group_iterator   = typename t_groups_type::iterator;
+
+public:
+  /**
+   * @brief Iterator over the groups, the element is the tuple of the key and its values. The groups are read-only, so
+   * the number of the values is changed only by the container, the values are changed through equal_range().
+   */
+  using group_iterator       = typename t_groups_type::const_iterator;
+  /**
+   * @brief Constant iterator over the groups.
+   */
+  using const_group_iterator = typename t_groups_type::const_iterator;
+
+private:
+  /**
+   * @brief Groups of values by key.
+   */
+  t_groups_type m_groups;
+  /**
+   * @brief Total number of values.
+   */
+  size_type     m_size{0U};
+
+public:
+  /**
+   * @brief Default constructor. Constructs empty container.
+   */
+  grouped_multimap() = default;
+
+  /**
+   * @brief Constructs empty container.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   */
+  explicit grouped_multimap(key_compare const &comp, allocator_type const &alloc = allocator_type())
+      : m_groups(comp, t_groups_allocator(alloc)) {
+  }
+
+  /**
+   * @brief Returns the allocator associated with the container.
+   * @return allocator_type The associated allocator.
+   */
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(m_groups.get_allocator());
+  }
+
+  /**
+   * @brief Returns the function object that compares the keys.
+   * @return key_compare The key comparison function object.
+   */
+  key_compare key_comp() const {
+    return m_groups.key_comp();
+  }
+
+  /**
+   * @brief Returns an iterator to the first group.
+   * @return const_group_iterator Iterator to the first group.
+   */
+  const_group_iterator begin() const noexcept {
+    return m_groups.begin();
+  }
+
+  /**
+   * @brief Returns an iterator to the group following the last group.
+   * @return const_group_iterator Iterator to the group following the last group.
+   */
+  const_group_iterator end() const noexcept {
+    return m_groups.end();
+  }
+
+  /**
+   * @brief Checks if the container has no values.
+   * @return true if the container is empty, false otherwise.
+   */
+  bool empty() const noexcept {
+    return 0U == m_size;
+  }
+
+  /**
+   * @brief Returns the number of values of all keys.
+   * @return size_type The number of values.
+   */
+  size_type size() const noexcept {
+    return m_size;
+  }
+
+  /**
+   * @brief Returns the number of distinct keys.
+   * @return size_type The number of keys.
+   */
+  size_type key_count() const noexcept {
+    return m_groups.size();
+  }
+
+  /**
+   * @brief Appends the value constructed from args to the values of the key. The key is added if it is not present.
+   *
+   * @tparam t_args Types of the value constructor arguments.
+   * @param key The key of the value.
+   * @param args Arguments to forward to the constructor of the value.
+   * @return ::portable_stl::expected<value_iterator, ::portable_stl::portable_stl_error> Iterator to the inserted value
+   * or the allocation error, the container is not changed on error.
+   */
+  template<class... t_args>
+  ::portable_stl::expected<value_iterator, ::portable_stl::portable_stl_error> emplace(key_type const &key,
+                                                                                      t_args &&...args);
+
+  /**
+   * @brief Appends the value to the values of the key. The key is added if it is not present.
+   *
+   * @param key The key of the value.
+   * @param value The value to insert.
+   * @return ::portable_stl::expected<value_iterator, ::portable_stl::portable_stl_error> Iterator to the inserted value
+   * or the allocation error.
+   */
+  ::portable_stl::expected<value_iterator, ::portable_stl::portable_stl_error> insert(key_type const    &key,
+                                                                                     mapped_type const &value) {
+    return emplace(key, value);
+  }
+
+  /**
+   * @brief Appends the value to the values of the key. The key is added if it is not present.
+   *
+   * @param key The key of the value.
+   * @param value The value to insert.
+   * @return ::portable_stl::expected<value_iterator, ::portable_stl::portable_stl_error> Iterator to the inserted value
+   * or the allocation error.
+   */
+  ::portable_stl::expected<value_iterator, ::portable_stl::portable_stl_error> insert(key_type const &key,
+                                                                                     mapped_type  &&value) {
+    return emplace(key, ::portable_stl::move(value));
+  }
+
+  /**
+   * @brief Appends the values [first, last) to the values of the key with one lookup of the key.
+   *
+   * @tparam t_input_iterator Type of the values iterator.
+   * @param key The key of the values.
+   * @param first The beginning of the values.
+   * @param last The end of the values.
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> The allocation error, the values
+   * inserted before the error stay in the container.
+   */
+  template<class t_input_iterator>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> insert(key_type const  &key,
+                                                                           t_input_iterator first,
+                                                                           t_input_iterator last);
+
+  /**
+   * @brief Reserves the storage for at least new_cap values of the present key, so the values inserted later do not
+   * reallocate. The key is not added, since the container never holds a key without values.
+   *
+   * @param key The key.
+   * @param new_cap The number of values.
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> portable_stl_error::not_exists if the
+   * key is not present or the allocation error.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> reserve(key_type const &key, size_type new_cap);
+
+  /**
+   * @brief Removes the key and all its values.
+   *
+   * @param key The key to remove.
+   * @return size_type The number of removed values.
+   */
+  size_type erase(key_type const &key);
+
+  /**
+   * @brief Removes the values of the key equal to value. The key is removed with its last value.
+   *
+   * @param key The key of the value.
+   * @param value The value to remove.
+   * @return size_type The number of removed values.
+   */
+  size_type erase(key_type const &key, mapped_type const &value);
+
+  /**
+   * @brief Removes the group at pos.
+   *
+   * @param pos Iterator to the group to remove.
+   * @return group_iterator Iterator following the removed group.
+   */
+  group_iterator erase(const_group_iterator pos) {
+    m_size -= ::portable_stl::get<1>(*pos).size();
+    return m_groups.erase(pos);
+  }
+
+  /**
+   * @brief Removes all keys and values.
+   */
+  void clear() noexcept {
+    m_groups.clear();
+    m_size = 0U;
+  }
+
+  /**
+   * @brief Exchanges the contents of the container with those of other.
+   * @param other Container to exchange the contents with.
+   */
+  void swap(grouped_multimap &other) noexcept(noexcept(m_groups.swap(other.m_groups))) {
+    m_groups.swap(other.m_groups);
+    size_type const tmp_size{m_size};
+    m_size       = other.m_size;
+    other.m_size = tmp_size;
+  }
+
+  /**
+   * @brief Finds the group of the key.
+   * @param key The key to search for.
+   * @return const_group_iterator Iterator to the group or end().
+   */
+  const_group_iterator find(key_type const &key) const {
+    return m_groups.find(key);
+  }
+
+  /**
+   * @brief Returns the number of values of the key in O(log(k)), the values are not walked.
+   * @param key The key of the values to count.
+   * @return size_type The number of values.
+   */
+  size_type count(key_type const &key) const {
+    const_group_iterator const iter{m_groups.find(key)};
+    return (iter == m_groups.end()) ? 0U : ::portable_stl::get<1>(*iter).size();
+  }
+
+  /**
+   * @brief Checks if the container has values of the key.
+   * @param key The key to search for.
+   * @return true if there are values of the key, false otherwise.
+   */
+  bool contains(key_type const &key) const {
+    return m_groups.find(key) != m_groups.end();
+  }
+
+  /**
+   * @brief Returns the contiguous range of the values of the key in insertion order.
+   * @param key The key of the values.
+   * @return ::portable_stl::tuple<value_iterator, value_iterator> The range of the values, empty if the key is not
+   * present.
+   */
+  ::portable_stl::tuple<value_iterator, value_iterator> equal_range(key_type const &key) {
+    t_group_iterator const iter{m_groups.find(key)};
+    if (iter == m_groups.end()) {
+      return ::portable_stl::make_tuple(value_iterator(), value_iterator());
+    }
+    values_type &values = ::portable_stl::get<1>(*iter);
+    return ::portable_stl::make_tuple(values.begin(), values.end());
+  }
+
+  /**
+   * @brief Returns the contiguous range of the values of the key in insertion order.
+   * @param key The key of the values.
+   * @return ::portable_stl::tuple<const_value_iterator, const_value_iterator> The range of the values, empty if the
+   * key is not present.
+   */
+  ::portable_stl::tuple<const_value_iterator, const_value_iterator> equal_range(key_type const &key) const {
+    const_group_iterator const iter{m_groups.find(key)};
+    if (iter == m_groups.end()) {
+      return ::portable_stl::make_tuple(const_value_iterator(), const_value_iterator());
+    }
+    values_type const &values = ::portable_stl::get<1>(*iter);
+    return ::portable_stl::make_tuple(values.begin(), values.end());
+  }
+
+  /**
+   * @brief Releases the unused capacity of the values of all keys.
+   */
+  void shrink_to_fit() {
+    for (auto &group : m_groups) {
+      ::portable_stl::get<1>(group).shrink_to_fit();
+    }
+  }
+
+private:
+  /**
+   * @brief Finds the group of the key or adds the empty one.
+   * @param key The key of the group.
+   * @return ::portable_stl::expected<t_group_iterator, ::portable_stl::portable_stl_error> Iterator to the group or
+   * the allocation error.
+   */
+  ::portable_stl::expected<t_group_iterator, ::portable_stl::portable_stl_error> M_get_group(key_type const &key) {
+    return m_groups.try_emplace(key, values_allocator_type(m_groups.get_allocator()))
+      .transform([](::portable_stl::tuple<t_group_iterator, bool> &&tmp) -> t_group_iterator {
+        return ::portable_stl::get<0>(tmp);
+      });
+  }
+};
+
+/**
+ * @brief Appends the value constructed from args to the values of the key.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_args Types of the value constructor arguments.
+ * @param key The key of the value.
+ * @param args Arguments to forward to the constructor of the value.
+ * @return ::portable_stl::expected<value_iterator, ::portable_stl::portable_stl_error> Iterator to the inserted value
+ * or the allocation error.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator>
+template<class... t_args>
+::portable_stl::expected<typename grouped_multimap<t_key, t_type, t_compare, t_allocator>::value_iterator,
+                         ::portable_stl::portable_stl_error>
+  grouped_multimap<t_key, t_type, t_compare, t_allocator>::emplace(key_type const &key, t_args &&...args) {
+  auto group_result = M_get_group(key);
+  if (!group_result) {
+    return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{group_result.error()};
+  }
+  t_group_iterator const group_iter{group_result.value()};
+  values_type           &values = ::portable_stl::get<1>(*group_iter);
+
+  auto result = values.emplace_back(::portable_stl::forward<t_args>(args)...);
+  if (!result) {
+    if (values.empty()) {
+      static_cast<void>(m_groups.erase(group_iter));
+    }
+    return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+  }
+  ++m_size;
+  return ::portable_stl::expected<value_iterator, ::portable_stl::portable_stl_error>(values.end() - 1);
+}
+
+/**
+ * @brief Appends the values [first, last) to the values of the key with one lookup of the key.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_input_iterator Type of the values iterator.
+ * @param key The key of the values.
+ * @param first The beginning of the values.
+ * @param last The end of the values.
+ * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> The allocation error.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator>
+template<class t_input_iterator>
+::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+  grouped_multimap<t_key, t_type, t_compare, t_allocator>::insert(key_type const  &key,
+                                                                  t_input_iterator first,
+                                                                  t_input_iterator last) {
+  if (first == last) {
+    return {};
+  }
+  auto group_result = M_get_group(key);
+  if (!group_result) {
+    return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{group_result.error()};
+  }
+  t_group_iterator const group_iter{group_result.value()};
+  values_type           &values = ::portable_stl::get<1>(*group_iter);
+
+  for (; first != last; ++first) {
+    auto result = values.emplace_back(*first);
+    if (!result) {
+      if (values.empty()) {
+        static_cast<void>(m_groups.erase(group_iter));
+      }
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    ++m_size;
+  }
+  return {};
+}
+
+/**
+ * @brief Reserves the storage for at least new_cap values of the key.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @param key The key.
+ * @param new_cap The number of values.
+ * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> The allocation error.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator>
+::portable_stl::expected<void, ::portable_stl::portable_stl_error>
+  grouped_multimap<t_key, t_type, t_compare, t_allocator>::reserve(key_type const &key, size_type new_cap) {
+  t_group_iterator const iter{m_groups.find(key)};
+  if (iter == m_groups.end()) {
+    return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+      ::portable_stl::portable_stl_error::not_exists};
+  }
+  return ::portable_stl::get<1>(*iter).reserve(new_cap);
+}
+
+/**
+ * @brief Removes the key and all its values.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @param key The key to remove.
+ * @return size_type The number of removed values.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator>
+typename grouped_multimap<t_key, t_type, t_compare, t_allocator>::size_type
+  grouped_multimap<t_key, t_type, t_compare, t_allocator>::erase(key_type const &key) {
+  const_group_iterator const iter{m_groups.find(key)};
+  if (iter == m_groups.end()) {
+    return 0U;
+  }
+  size_type const num{::portable_stl::get<1>(*iter).size()};
+  static_cast<void>(erase(iter));
+  return num;
+}
+
+/**
+ * @brief Removes the values of the key equal to value. The key is removed with its last value.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @param key The key of the value.
+ * @param value The value to remove.
+ * @return size_type The number of removed values.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator>
+typename grouped_multimap<t_key, t_type, t_compare, t_allocator>::size_type
+  grouped_multimap<t_key, t_type, t_compare, t_allocator>::erase(key_type const &key, mapped_type const &value) {
+  t_group_iterator const iter{m_groups.find(key)};
+  if (iter == m_groups.end()) {
+    return 0U;
+  }
+  values_type &values = ::portable_stl::get<1>(*iter);
+
+  // compact the kept values in place, keeping their order
+  value_iterator dst{values.begin()};
+  for (value_iterator src{values.begin()}; src != values.end(); ++src) {
+    if (!(*src == value)) {
+      if (dst != src) {
+        *dst = ::portable_stl::move(*src);
+      }
+      ++dst;
+    }
+  }
+  size_type const num{static_cast<size_type>(values.end() - dst)};
+  static_cast<void>(values.erase(dst, values.end()));
+  m_size -= num;
+  if (values.empty()) {
+    static_cast<void>(m_groups.erase(iter));
+  }
+  return num;
+}
+
+/**
+ * @brief Specializes the ::swap algorithm for ::grouped_multimap. Swaps the contents of lhs and rhs.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @param lhv Container to swap.
+ * @param rhv Container to swap.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator>
+inline void swap(grouped_multimap<t_key, t_type, t_compare, t_allocator> &lhv,
+                 grouped_multimap<t_key, t_type, t_compare, t_allocator> &rhv) noexcept(noexcept(lhv.swap(rhv))) {
+  lhv.swap(rhv);
+}
+} // namespace portable_stl
+
+#endif // PSTL_GROUPED_MULTIMAP_H
@@ -16,7 +16,9 @@
 #include "../algorithm/lexicographical_compare.h"
 #include "../containers/insert_return_type.h"
 #include "../containers/node_handle.h"
+#include "../containers/sorted_tags.h"
 #include "../containers/tree.h"
+#include "../containers/tree_set_operations.h"
 #include "../containers/value_type_impl.h"
 #include "../functional/binary_function.h"
 #include "../functional/is_transparent.h"
@@ -52,7 +54,7 @@ namespace portable_stl {
  * @brief Forward declaration of the multimap.
  *
  */
-template<class, class, class, class> class multimap;
+template<class, class, class, class, class> class multimap;
 
 /**
  * @brief A sorted associative container that contains key-value pairs with unique keys. Keys are sorted by using the
@@ -62,11 +64,13 @@ template<class, class, class, class> class multimap;
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type, tree_rank_node_policy enables nth() and rank().
  */
 template<class t_key,
          class t_type,
-         class t_compare   = ::portable_stl::less<t_key>,
-         class t_allocator = ::portable_stl::allocator<::portable_stl::tuple<t_key const, t_type>>>
+         class t_compare     = ::portable_stl::less<t_key>,
+         class t_allocator   = ::portable_stl::allocator<::portable_stl::tuple<t_key const, t_type>>,
+         class t_node_policy = ::portable_stl::tree_plain_node_policy>
 class map {
 public:
   /**
@@ -152,7 +156,7 @@ private:
   /**
    * @brief
    */
-  using t_base_tree_type = ::portable_stl::tree<t_value_type, t_value_compare, t_allocator_type>;
+  using t_base_tree_type = ::portable_stl::tree<t_value_type, t_value_compare, t_allocator_type, t_node_policy>;
   /**
    * @brief
    */
@@ -215,8 +219,8 @@ public:
    */
   using insert_return_type = ::portable_stl::insert_return_type<iterator, node_type>;
 
-  template<class t_key2, class t_value2, class t_comp2, class t_alloc2> friend class map;
-  template<class t_key2, class t_value2, class t_comp2, class t_alloc2> friend class multimap;
+  template<class t_key2, class t_value2, class t_comp2, class t_alloc2, class t_policy2> friend class map;
+  template<class t_key2, class t_value2, class t_comp2, class t_alloc2, class t_policy2> friend class multimap;
 
   /**
    * @brief Constructs new empty map.
@@ -359,6 +363,88 @@ public:
     return make_map(first, last, key_compare(), alloc);
   }
 
+  /**
+   * @brief Constructs the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted and has no equivalent keys with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   */
+  template<class t_input_iterator>
+  map(::portable_stl::sorted_unique_t,
+      t_input_iterator   first,
+      t_input_iterator   last,
+      key_compare const &comp = key_compare())
+      : m_tree(t_value_compare(comp)) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.build_unique(first, last));
+  }
+
+  /**
+   * @brief Makes the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted and has no equivalent keys with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @return ::portable_stl::expected<map, ::portable_stl::portable_stl_error>.
+   */
+  template<class t_input_iterator>
+  static ::portable_stl::expected<map, ::portable_stl::portable_stl_error> make_map(
+    ::portable_stl::sorted_unique_t tag,
+    t_input_iterator                first,
+    t_input_iterator                last,
+    key_compare const              &comp = key_compare()) {
+    return make_map(tag, first, last, comp, allocator_type());
+  }
+
+  /**
+   * @brief Constructs the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted and has no equivalent keys with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   */
+  template<class t_input_iterator>
+  map(::portable_stl::sorted_unique_t,
+      t_input_iterator      first,
+      t_input_iterator      last,
+      key_compare const    &comp,
+      allocator_type const &alloc)
+      : m_tree(t_value_compare(comp), typename t_base_tree_type::allocator_type(alloc)) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.build_unique(first, last));
+  }
+
+  /**
+   * @brief Makes the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted and has no equivalent keys with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   * @return ::portable_stl::expected<map, ::portable_stl::portable_stl_error>.
+   */
+  template<class t_input_iterator>
+  static ::portable_stl::expected<map, ::portable_stl::portable_stl_error> make_map(
+    ::portable_stl::sorted_unique_t,
+    t_input_iterator      first,
+    t_input_iterator      last,
+    key_compare const    &comp,
+    allocator_type const &alloc) {
+    map ret(comp, alloc);
+    return ret.m_tree.build_unique(first, last)
+      .and_then([&ret](void) -> ::portable_stl::expected<map, ::portable_stl::portable_stl_error> {
+        return {::portable_stl::in_place_t{}, ::portable_stl::move(ret)};
+      });
+  }
+
   /**
    * @brief Copy constructor. Constructs the container with the copy of the contents of other.
    *
@@ -445,12 +531,13 @@ public:
 
   /**
    * @brief Copy assignment operator. Replaces the contents with a copy of the contents of other.
+   * The existing nodes are reused for the copied elements.
    *
    * @param other Another container to use as data source.
    * @return map& *this.
    */
   map &operator=(map const &other) {
-    m_tree = other.m_tree;
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.copy_assign(other.m_tree));
     return *this;
   }
 
@@ -832,6 +919,10 @@ public:
   template<class t_input_iterator>
   ::portable_stl::expected<void, ::portable_stl::portable_stl_error> insert(t_input_iterator first,
                                                                             t_input_iterator last) {
+    if (empty()) {
+      // linear time for the sorted range
+      return m_tree.build_unique(first, last);
+    }
     for (const_iterator end_pos = cend(); first != last; ++first) {
       auto result = insert(end_pos.m_iter, *first);
       if (!result) {
@@ -1146,8 +1237,27 @@ public:
     m_tree.clear();
   }
 
+  /**
+   * @brief Moves all the elements into one contiguous memory block in the sorted order, so the iteration and the
+   * lookups walk the memory sequentially. Useful for a long-lived container which is rarely modified. The elements
+   * are move constructed in the block and the old nodes are deallocated. Complexity is linear in the size of the
+   * container.
+   * Invalidates all references, pointers and iterators referring to the elements. Any past-the-end iterator remains
+   * valid. Elements inserted later are allocated separately. Elements leaving the container (extract(), merge() into
+   * another container, split() unless their whole block leaves) are moved to separately allocated nodes first, which
+   * invalidates references to them.
+   *
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> error if the block allocation failed,
+   * the map is not changed then.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> compact() {
+    return m_tree.compact();
+  }
+
   /**
    * @brief Unlinks the node that contains the element pointed to by position and returns a node handle that owns it.
+   * If the container is compacted (see compact()) and the element can not be moved to a separately allocated node, the
+   * element stays in the container and an empty node handle is returned.
    *
    * @param pos A valid iterator into this container.
    * @return node_type A node handle that owns the extracted element.
@@ -1179,7 +1289,8 @@ public:
    * @tparam t_compare2
    * @param source Compatible container to transfer the nodes from.
    */
-  template<class t_compare2> void merge(map<key_type, mapped_type, t_compare2, allocator_type> &source) {
+  template<class t_compare2>
+  void merge(map<key_type, mapped_type, t_compare2, allocator_type, t_node_policy> &source) {
     // _LIBCPP_ASSERT_COMPATIBLE_ALLOCATOR(source.get_allocator() == get_allocator(),
     //                                     "merging container with incompatible allocator");
     m_tree.node_handle_merge_unique(source.m_tree);
@@ -1196,7 +1307,8 @@ public:
    * @tparam t_compare2
    * @param source Compatible container to transfer the nodes from.
    */
-  template<class t_compare2> void merge(map<key_type, mapped_type, t_compare2, allocator_type> &&source) {
+  template<class t_compare2>
+  void merge(map<key_type, mapped_type, t_compare2, allocator_type, t_node_policy> &&source) {
     m_tree.node_handle_merge_unique(source.m_tree);
   }
 
@@ -1212,7 +1324,7 @@ public:
    * @param source Compatible container to transfer the nodes from.
    */
   template<class t_compare2>
-  void merge(::portable_stl::multimap<key_type, mapped_type, t_compare2, allocator_type> &source) {
+  void merge(::portable_stl::multimap<key_type, mapped_type, t_compare2, allocator_type, t_node_policy> &source) {
     m_tree.node_handle_merge_unique(source.m_tree);
   }
 
@@ -1228,7 +1340,7 @@ public:
    * @param source Compatible container to transfer the nodes from.
    */
   template<class t_compare2>
-  void merge(::portable_stl::multimap<key_type, mapped_type, t_compare2, allocator_type> &&source) {
+  void merge(::portable_stl::multimap<key_type, mapped_type, t_compare2, allocator_type, t_node_policy> &&source) {
     m_tree.node_handle_merge_unique(source.m_tree);
   }
 
@@ -1244,6 +1356,38 @@ public:
     m_tree.swap(other.m_tree);
   }
 
+  /**
+   * @brief Moves the elements with keys not less than 'key' to the returned map. No elements are copied or moved,
+   * only the internal pointers of the container nodes are repointed. Complexity is logarithmic in the size of the
+   * container, without tree_rank_node_policy recounting the sizes adds linear in the size of the smaller part.
+   * All pointers, references and iterators to the transferred elements remain valid, but now refer into the returned
+   * map. The exception is a compacted container (see compact()): the transferred elements are walked once, the
+   * memory blocks holding only transferred elements go to the returned map, and the transferred elements sharing a
+   * block with the remaining ones are moved to separately allocated nodes, which throws bad_alloc if the allocation
+   * fails.
+   *
+   * @param key Key value to split at.
+   * @return map Map with the elements with keys not less than 'key'.
+   */
+  map split(key_type const &key) {
+    map result(key_comp(), get_allocator());
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.split(key, result.m_tree));
+    return result;
+  }
+
+  /**
+   * @brief Moves all the elements of other to *this. No elements are copied or moved, only the internal pointers of
+   * the container nodes are repointed. Complexity is logarithmic in the size of the containers.
+   * All pointers, references and iterators to the transferred elements remain valid, but now refer into *this.
+   * The behavior is undefined if the keys of one container are not all less than the keys of the other container or
+   * get_allocator() != other.get_allocator().
+   *
+   * @param other Map to join.
+   */
+  void join(map &other) noexcept {
+    m_tree.join(other.m_tree);
+  }
+
   /**
    * @brief Finds an element with key equivalent to key.
    *
@@ -1469,6 +1613,135 @@ public:
     return m_tree.upper_bound(value);
   }
 
+  /**
+   * @brief Returns an iterator pointing to the element at the position 'index' in the sorted order. Complexity is
+   * logarithmic in the size of the container. Available only with tree_rank_node_policy.
+   *
+   * @param index Position of the element.
+   * @return iterator Iterator pointing to the element. If index >= size(), past-the-end (see end()) iterator is
+   * returned.
+   */
+  iterator nth(size_type index) noexcept {
+    return m_tree.nth(index);
+  }
+
+  /**
+   * @brief Returns a constant iterator pointing to the element at the position 'index' in the sorted order. Complexity
+   * is logarithmic in the size of the container. Available only with tree_rank_node_policy.
+   *
+   * @param index Position of the element.
+   * @return const_iterator Iterator pointing to the element. If index >= size(), past-the-end (see end()) iterator is
+   * returned.
+   */
+  const_iterator nth(size_type index) const noexcept {
+    return m_tree.nth(index);
+  }
+
+  /**
+   * @brief Returns the number of elements with key that compares less than 'key', i.e. the position of
+   * lower_bound(key). Complexity is logarithmic in the size of the container. Available only with
+   * tree_rank_node_policy.
+   *
+   * @param key Key value to compare the elements to.
+   * @return size_type Number of elements less than 'key'.
+   */
+  size_type rank(key_type const &key) const {
+    return m_tree.rank(key);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes lower_bound(key) for every key of [first, last) to out. Keys coming in
+   * ascending order are looked up by finger search from the previous result, other keys are looked up by several
+   * interleaved descents from the root with software prefetch of the next nodes.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) {
+    return m_tree.lower_bound_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes lower_bound(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts const_iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.lower_bound_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes find(key) for every key of [first, last) to out. The lookup is done as in
+   * lower_bound_many().
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator find_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) {
+    return m_tree.find_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes find(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts const_iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator find_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.find_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes contains(key) for every key of [first, last) to out. The lookup is done
+   * as in lower_bound_many().
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts bool.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator contains_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.contains_many(first, last, out);
+  }
+
+  /**
+   * @brief Returns an iterator pointing to the first element at or after pos that is not less than key. The search
+   * walks the tree from pos, so its cost is logarithmic in the distance to the result. It is used by the set
+   * operations to skip the runs of the longer container.
+   *
+   * @param pos Position to start the search from.
+   * @param key Key value to compare the elements to.
+   * @return const_iterator Iterator pointing to the first element at or after pos that is not less than key. If no
+   * such element is found, a past-the-end iterator (see end()) is returned.
+   */
+  const_iterator lower_bound_from(const_iterator pos, key_type const &key) const {
+    return const_iterator(m_tree.lower_bound_from(pos.m_iter, key));
+  }
+
   /**
    * @brief Returns a range containing all elements with the given key in the container. The range is defined by two
    * iterators, one pointing to the first element that is not less than key and another pointing to the first element
@@ -1593,11 +1866,12 @@ private:
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param other Another container to be used as source to initialize the elements of the container with.
  * @param alloc Allocator to use for all memory allocations of this container.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-map<t_key, t_type, t_compare, t_allocator>::map(map &&other, allocator_type const &alloc)
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+map<t_key, t_type, t_compare, t_allocator, t_node_policy>::map(map &&other, allocator_type const &alloc)
     : m_tree(::portable_stl::move(other.m_tree), typename t_base_tree_type::allocator_type(alloc)) {
   if (alloc != other.get_allocator()) {
     const_iterator c_end = cend();
@@ -1616,12 +1890,13 @@ map<t_key, t_type, t_compare, t_allocator>::map(map &&other, allocator_type cons
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param key The key of the element to find.
  * @return t_type& A reference to the mapped value of the new element if no element with key key existed.
  * Otherwise, a reference to the mapped value of the existing element whose key is equivalent to key.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-t_type &map<t_key, t_type, t_compare, t_allocator>::operator[](key_type const &key) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+t_type &map<t_key, t_type, t_compare, t_allocator, t_node_policy>::operator[](key_type const &key) {
   return ::portable_stl::get<1>(
     ::portable_stl::get<0>(::portable_stl::move(m_tree.emplace_unique_key_args(key,
                                                                                ::portable_stl::piecewise_construct_t{},
@@ -1639,12 +1914,13 @@ t_type &map<t_key, t_type, t_compare, t_allocator>::operator[](key_type const &k
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param key The key of the element to find.
  * @return t_type& A reference to the mapped value of the new element if no element with key key existed.
  * Otherwise, a reference to the mapped value of the existing element whose key is equivalent to key.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-t_type &map<t_key, t_type, t_compare, t_allocator>::operator[](key_type &&key) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+t_type &map<t_key, t_type, t_compare, t_allocator, t_node_policy>::operator[](key_type &&key) {
   // TODO investigate this clang-tidy warning.
   // NOLINTBEGIN(bugprone-use-after-move)
   return ::portable_stl::get<1>(
@@ -1666,11 +1942,12 @@ t_type &map<t_key, t_type, t_compare, t_allocator>::operator[](key_type &&key) {
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param key The key of the element to find.
  * @return t_type& A reference to the mapped value of the requested element.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-t_type &map<t_key, t_type, t_compare, t_allocator>::at(key_type const &key) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+t_type &map<t_key, t_type, t_compare, t_allocator, t_node_policy>::at(key_type const &key) {
   t_parent_pointer     parent;
   t_node_base_pointer &child = m_tree.find_equal(parent, key);
   ::portable_stl::throw_on_true<::portable_stl::out_of_range<>>(nullptr == child); // "map::at:  key not found"
@@ -1685,11 +1962,12 @@ t_type &map<t_key, t_type, t_compare, t_allocator>::at(key_type const &key) {
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param key The key of the element to find.
  * @return t_type const& A reference to the mapped value of the requested element.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-t_type const &map<t_key, t_type, t_compare, t_allocator>::at(key_type const &key) const {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+t_type const &map<t_key, t_type, t_compare, t_allocator, t_node_policy>::at(key_type const &key) const {
   t_parent_pointer    parent;
   t_node_base_pointer child = m_tree.find_equal(parent, key);
   ::portable_stl::throw_on_true<::portable_stl::out_of_range<>>(nullptr == child); // "map::at:  key not found"
@@ -1703,14 +1981,15 @@ t_type const &map<t_key, t_type, t_compare, t_allocator>::at(key_type const &key
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the maps are equal,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator==(map<t_key, t_type, t_compare, t_allocator> const &lhv,
-                       map<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator==(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                       map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return lhv.size() == rhv.size() && ::portable_stl::equal(lhv.begin(), lhv.end(), rhv.begin());
 }
 
@@ -1721,14 +2000,15 @@ inline bool operator==(map<t_key, t_type, t_compare, t_allocator> const &lhv,
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if if the contents of the maps are not equal,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator!=(map<t_key, t_type, t_compare, t_allocator> const &lhv,
-                       map<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator!=(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                       map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return !(lhv == rhv);
 }
 
@@ -1739,14 +2019,15 @@ inline bool operator!=(map<t_key, t_type, t_compare, t_allocator> const &lhv,
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the lhs are lexicographically less than the contents of rhs,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator<(map<t_key, t_type, t_compare, t_allocator> const &lhv,
-                      map<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator<(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                      map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return ::portable_stl::lexicographical_compare(lhv.begin(), lhv.end(), rhv.begin(), rhv.end());
 }
 
@@ -1757,14 +2038,15 @@ inline bool operator<(map<t_key, t_type, t_compare, t_allocator> const &lhv,
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the lhs are lexicographically less than or equal to the contents of rhs,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator<=(map<t_key, t_type, t_compare, t_allocator> const &lhv,
-                       map<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator<=(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                       map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return !(rhv < lhv);
 }
 
@@ -1775,14 +2057,15 @@ inline bool operator<=(map<t_key, t_type, t_compare, t_allocator> const &lhv,
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the lhs are lexicographically greater than the contents of rhs,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator>(map<t_key, t_type, t_compare, t_allocator> const &lhv,
-                      map<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator>(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                      map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return rhv < lhv;
 }
 
@@ -1793,14 +2076,15 @@ inline bool operator>(map<t_key, t_type, t_compare, t_allocator> const &lhv,
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the lhs are lexicographically greater than or equal to the contents of rhs,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator>=(map<t_key, t_type, t_compare, t_allocator> const &lhv,
-                       map<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator>=(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                       map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return !(lhv < rhv);
 }
 
@@ -1811,15 +2095,175 @@ inline bool operator>=(map<t_key, t_type, t_compare, t_allocator> const &lhv,
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to swap.
  * @param rhv Map to swap.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline void swap(map<t_key, t_type, t_compare, t_allocator> &lhv,
-                 map<t_key, t_type, t_compare, t_allocator> &rhv) noexcept(noexcept(lhv.swap(rhv))) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline void swap(map<t_key, t_type, t_compare, t_allocator, t_node_policy> &lhv,
+                 map<t_key, t_type, t_compare, t_allocator, t_node_policy> &rhv) noexcept(noexcept(lhv.swap(rhv))) {
   lhv.swap(rhv);
 }
 
+/**
+ * @brief Copies the elements found in either of the maps to the sorted range beginning at out. For
+ * equivalent keys the element of lhv is copied.
+ * The maps are walked directly: the runs of one map between the elements of the other one are skipped
+ * by finger search from the current node, so the cost of a short map against a long one depends on the
+ * distances between the matches, not on the size of the long map.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first map.
+ * @param rhv The second map, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy, class t_output_iterator>
+inline t_output_iterator set_union(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                                   map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv,
+                                   t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_set_union(lhv, rhv, out, ::portable_stl::tree_helper::tree_pair_key{});
+}
+
+/**
+ * @brief Copies the elements of lhv whose keys are found in rhv to the sorted range beginning at out.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first map.
+ * @param rhv The second map, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy, class t_output_iterator>
+inline t_output_iterator set_intersection(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                                          map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv,
+                                          t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_set_intersection(
+    lhv, rhv, out, ::portable_stl::tree_helper::tree_pair_key{});
+}
+
+/**
+ * @brief Copies the elements of lhv whose keys are not found in rhv to the sorted range beginning at out.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first map.
+ * @param rhv The second map, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy, class t_output_iterator>
+inline t_output_iterator set_difference(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                                        map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv,
+                                        t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_set_difference(lhv, rhv, out, ::portable_stl::tree_helper::tree_pair_key{});
+}
+
+/**
+ * @brief Copies the elements whose keys are found in exactly one of the maps to the sorted range
+ * beginning at out.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first map.
+ * @param rhv The second map, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy, class t_output_iterator>
+inline t_output_iterator set_symmetric_difference(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                                                  map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv,
+                                                  t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_set_symmetric_difference(
+    lhv, rhv, out, ::portable_stl::tree_helper::tree_pair_key{});
+}
+
+/**
+ * @brief Copies the elements of both maps to the sorted range beginning at out. The element of lhv
+ * precedes the element of rhv with the equivalent key.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first map.
+ * @param rhv The second map, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy, class t_output_iterator>
+inline t_output_iterator merge(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                               map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv,
+                               t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_merge(lhv, rhv, out, ::portable_stl::tree_helper::tree_pair_key{});
+}
+
+/**
+ * @brief Checks if every key of rhv is found in lhv.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
+ * @param lhv The first map.
+ * @param rhv The second map, ordered by the comparison equivalent to the one of lhv.
+ * @return true if the keys of rhv are a subset of the keys of lhv,
+ * @return false otherwise.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool includes(map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                     map<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
+  return ::portable_stl::tree_helper::tree_includes(lhv, rhv, ::portable_stl::tree_helper::tree_pair_key{});
+}
+
+/**
+ * @brief Merges two maps into one by splicing the nodes, no element is copied or allocated.
+ * The nodes of the smaller map are moved into the larger one (see map::merge()), which is then moved to the
+ * result, so the cost is O(m log(n + m)) for the sizes n >= m. The elements of the smaller map whose keys are
+ * already present in the larger one stay in the smaller map, the other map is left empty.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_type Mapped type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
+ * @param lhv The first map.
+ * @param rhv The second map, using the equal allocator.
+ * @return map The map containing the elements of both.
+ */
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline map<t_key, t_type, t_compare, t_allocator, t_node_policy> merge(
+  map<t_key, t_type, t_compare, t_allocator, t_node_policy> &lhv,
+  map<t_key, t_type, t_compare, t_allocator, t_node_policy> &rhv) {
+  if (lhv.size() < rhv.size()) {
+    rhv.merge(lhv);
+    return ::portable_stl::move(rhv);
+  }
+  lhv.merge(rhv);
+  return ::portable_stl::move(lhv);
+}
+
 } // namespace portable_stl
 
 #endif // PSTL_MAP_H
@@ -170,8 +170,8 @@ public:
     return lhv.m_iter != rhv.m_iter;
   }
 
-  template<class, class, class, class> friend class map;
-  template<class, class, class, class> friend class multimap;
+  template<class, class, class, class, class> friend class map;
+  template<class, class, class, class, class> friend class multimap;
   template<class> friend class map_const_iterator;
 };
 
@@ -16,6 +16,7 @@
 #include "../algorithm/lexicographical_compare.h"
 #include "../containers/insert_return_type.h"
 #include "../containers/node_handle.h"
+#include "../containers/sorted_tags.h"
 #include "../containers/tree.h"
 #include "../containers/value_type_impl.h"
 #include "../functional/binary_function.h"
@@ -50,7 +51,7 @@ namespace portable_stl {
  * @brief Forward declaration of the map.
  *
  */
-template<class, class, class, class> class map;
+template<class, class, class, class, class> class map;
 
 /**
  * @brief multimap is an associative container that contains a sorted list of key-value pairs, while permitting
@@ -61,11 +62,13 @@ template<class, class, class, class> class map;
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type, tree_rank_node_policy enables nth() and rank().
  */
 template<class t_key,
          class t_type,
-         class t_compare   = ::portable_stl::less<t_key>,
-         class t_allocator = ::portable_stl::allocator<::portable_stl::tuple<t_key const, t_type>>>
+         class t_compare     = ::portable_stl::less<t_key>,
+         class t_allocator   = ::portable_stl::allocator<::portable_stl::tuple<t_key const, t_type>>,
+         class t_node_policy = ::portable_stl::tree_plain_node_policy>
 class multimap {
 public:
   /**
@@ -135,7 +138,7 @@ private:
   /**
    * @brief
    */
-  using t_base_tree_type = ::portable_stl::tree<t_value_type, t_value_compare, t_allocator_type>;
+  using t_base_tree_type = ::portable_stl::tree<t_value_type, t_value_compare, t_allocator_type, t_node_policy>;
   /**
    * @brief
    */
@@ -198,8 +201,8 @@ public:
    */
   using insert_return_type = ::portable_stl::insert_return_type<iterator, node_type>;
 
-  template<class t_key2, class t_value2, class t_comp2, class t_alloc2> friend class map;
-  template<class t_key2, class t_value2, class t_comp2, class t_alloc2> friend class multimap;
+  template<class t_key2, class t_value2, class t_comp2, class t_alloc2, class t_policy2> friend class map;
+  template<class t_key2, class t_value2, class t_comp2, class t_alloc2, class t_policy2> friend class multimap;
 
   /**
    * @brief (1) Constructs new empty multimap.
@@ -335,6 +338,88 @@ public:
     return make_multimap(first, last, key_compare(), alloc);
   }
 
+  /**
+   * @brief Constructs the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   */
+  template<class t_input_iterator>
+  multimap(::portable_stl::sorted_equivalent_t,
+           t_input_iterator   first,
+           t_input_iterator   last,
+           key_compare const &comp = key_compare())
+      : m_tree(t_value_compare(comp)) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.build_multi(first, last));
+  }
+
+  /**
+   * @brief Makes the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @return ::portable_stl::expected<multimap, ::portable_stl::portable_stl_error>.
+   */
+  template<class t_input_iterator>
+  static ::portable_stl::expected<multimap, ::portable_stl::portable_stl_error> make_multimap(
+    ::portable_stl::sorted_equivalent_t tag,
+    t_input_iterator                    first,
+    t_input_iterator                    last,
+    key_compare const                  &comp = key_compare()) {
+    return make_multimap(tag, first, last, comp, allocator_type());
+  }
+
+  /**
+   * @brief Constructs the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   */
+  template<class t_input_iterator>
+  multimap(::portable_stl::sorted_equivalent_t,
+           t_input_iterator      first,
+           t_input_iterator      last,
+           key_compare const    &comp,
+           allocator_type const &alloc)
+      : m_tree(t_value_compare(comp), typename t_base_tree_type::allocator_type(alloc)) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.build_multi(first, last));
+  }
+
+  /**
+   * @brief Makes the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   * @return ::portable_stl::expected<multimap, ::portable_stl::portable_stl_error>.
+   */
+  template<class t_input_iterator>
+  static ::portable_stl::expected<multimap, ::portable_stl::portable_stl_error> make_multimap(
+    ::portable_stl::sorted_equivalent_t,
+    t_input_iterator      first,
+    t_input_iterator      last,
+    key_compare const    &comp,
+    allocator_type const &alloc) {
+    multimap ret(comp, alloc);
+    return ret.m_tree.build_multi(first, last)
+      .and_then([&ret](void) -> ::portable_stl::expected<multimap, ::portable_stl::portable_stl_error> {
+        return {::portable_stl::in_place_t{}, ::portable_stl::move(ret)};
+      });
+  }
+
   /**
    * @brief (6) Copy constructor. Constructs the container with the copy of the contents of other.
    *
@@ -422,12 +507,13 @@ public:
 
   /**
    * @brief Copy assignment operator. Replaces the contents with a copy of the contents of other.
+   * The existing nodes are reused for the copied elements.
    *
    * @param other Another container to use as data source.
    * @return map& *this.
    */
   multimap &operator=(multimap const &other) {
-    m_tree = other.m_tree;
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.copy_assign(other.m_tree));
     return *this;
   }
 
@@ -679,6 +765,23 @@ public:
     m_tree.clear();
   }
 
+  /**
+   * @brief Moves all the elements into one contiguous memory block in the sorted order, so the iteration and the
+   * lookups walk the memory sequentially. Useful for a long-lived container which is rarely modified. The elements
+   * are move constructed in the block and the old nodes are deallocated. Complexity is linear in the size of the
+   * container.
+   * Invalidates all references, pointers and iterators referring to the elements. Any past-the-end iterator remains
+   * valid. Elements inserted later are allocated separately. Elements leaving the container (extract(), merge() into
+   * another container, split() unless their whole block leaves) are moved to separately allocated nodes first, which
+   * invalidates references to them.
+   *
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> error if the block allocation failed,
+   * the multimap is not changed then.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> compact() {
+    return m_tree.compact();
+  }
+
   /**
    * @brief (1) Inserts value. If the container has elements with equivalent key, inserts at the upper bound of that
    * range.
@@ -767,6 +870,10 @@ public:
   template<class t_input_iterator>
   ::portable_stl::expected<void, ::portable_stl::portable_stl_error> insert(t_input_iterator first,
                                                                             t_input_iterator last) {
+    if (empty()) {
+      // linear time for the sorted range
+      return m_tree.build_multi(first, last);
+    }
     for (const_iterator end_pos = cend(); first != last; ++first) {
       auto result = insert(end_pos.m_iter, *first);
       if (!result) {
@@ -857,6 +964,8 @@ public:
 
   /**
    * @brief Unlinks the node that contains the element pointed to by position and returns a node handle that owns it.
+   * If the container is compacted (see compact()) and the element can not be moved to a separately allocated node, the
+   * element stays in the container and an empty node handle is returned.
    *
    * @param pos A valid iterator into this container.
    * @return node_type A node handle that owns the extracted element.
@@ -888,7 +997,7 @@ public:
    * @param source Compatible container to transfer the nodes from.
    */
   template<class t_compare2>
-  void merge(::portable_stl::map<key_type, mapped_type, t_compare2, allocator_type> &source) {
+  void merge(::portable_stl::map<key_type, mapped_type, t_compare2, allocator_type, t_node_policy> &source) {
     return m_tree.node_handle_merge_multi(source.m_tree);
   }
 
@@ -903,7 +1012,7 @@ public:
    * @param source Compatible container to transfer the nodes from.
    */
   template<class t_compare2>
-  void merge(::portable_stl::map<key_type, mapped_type, t_compare2, allocator_type> &&source) {
+  void merge(::portable_stl::map<key_type, mapped_type, t_compare2, allocator_type, t_node_policy> &&source) {
     return m_tree.node_handle_merge_multi(source.m_tree);
   }
 
@@ -917,7 +1026,8 @@ public:
    * @tparam t_compare2
    * @param source Compatible container to transfer the nodes from.
    */
-  template<class t_compare2> void merge(multimap<key_type, mapped_type, t_compare2, allocator_type> &source) {
+  template<class t_compare2>
+  void merge(multimap<key_type, mapped_type, t_compare2, allocator_type, t_node_policy> &source) {
     return m_tree.node_handle_merge_multi(source.m_tree);
   }
 
@@ -931,7 +1041,8 @@ public:
    * @tparam t_compare2
    * @param source Compatible container to transfer the nodes from.
    */
-  template<class t_compare2> void merge(multimap<key_type, mapped_type, t_compare2, allocator_type> &&source) {
+  template<class t_compare2>
+  void merge(multimap<key_type, mapped_type, t_compare2, allocator_type, t_node_policy> &&source) {
     return m_tree.node_handle_merge_multi(source.m_tree);
   }
 
@@ -945,6 +1056,38 @@ public:
     m_tree.swap(other.m_tree);
   }
 
+  /**
+   * @brief Moves the elements with keys not less than 'key' to the returned multimap. No elements are copied or moved,
+   * only the internal pointers of the container nodes are repointed. Complexity is logarithmic in the size of the
+   * container, without tree_rank_node_policy recounting the sizes adds linear in the size of the smaller part.
+   * All pointers, references and iterators to the transferred elements remain valid, but now refer into the returned
+   * multimap. The exception is a compacted container (see compact()): the transferred elements are walked once, the
+   * memory blocks holding only transferred elements go to the returned multimap, and the transferred elements sharing a
+   * block with the remaining ones are moved to separately allocated nodes, which throws bad_alloc if the allocation
+   * fails.
+   *
+   * @param key Key value to split at.
+   * @return multimap Multimap with the elements with keys not less than 'key'.
+   */
+  multimap split(key_type const &key) {
+    multimap result(key_comp(), get_allocator());
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.split(key, result.m_tree));
+    return result;
+  }
+
+  /**
+   * @brief Moves all the elements of other to *this. No elements are copied or moved, only the internal pointers of
+   * the container nodes are repointed. Complexity is logarithmic in the size of the containers.
+   * All pointers, references and iterators to the transferred elements remain valid, but now refer into *this.
+   * The behavior is undefined if the keys of one container are not all less than the keys of the other container or
+   * get_allocator() != other.get_allocator().
+   *
+   * @param other Multimap to join.
+   */
+  void join(multimap &other) noexcept {
+    m_tree.join(other.m_tree);
+  }
+
   // [lookup]
 
   /**
@@ -1174,6 +1317,121 @@ public:
     return m_tree.upper_bound(key_like);
   }
 
+  /**
+   * @brief Returns an iterator pointing to the element at the position 'index' in the sorted order. Complexity is
+   * logarithmic in the size of the container. Available only with tree_rank_node_policy.
+   *
+   * @param index Position of the element.
+   * @return iterator Iterator pointing to the element. If index >= size(), past-the-end (see end()) iterator is
+   * returned.
+   */
+  iterator nth(size_type index) noexcept {
+    return m_tree.nth(index);
+  }
+
+  /**
+   * @brief Returns a constant iterator pointing to the element at the position 'index' in the sorted order. Complexity
+   * is logarithmic in the size of the container. Available only with tree_rank_node_policy.
+   *
+   * @param index Position of the element.
+   * @return const_iterator Iterator pointing to the element. If index >= size(), past-the-end (see end()) iterator is
+   * returned.
+   */
+  const_iterator nth(size_type index) const noexcept {
+    return m_tree.nth(index);
+  }
+
+  /**
+   * @brief Returns the number of elements with key that compares less than 'key', i.e. the position of
+   * lower_bound(key). Complexity is logarithmic in the size of the container. Available only with
+   * tree_rank_node_policy.
+   *
+   * @param key Key value to compare the elements to.
+   * @return size_type Number of elements less than 'key'.
+   */
+  size_type rank(key_type const &key) const {
+    return m_tree.rank(key);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes lower_bound(key) for every key of [first, last) to out. Keys coming in
+   * ascending order are looked up by finger search from the previous result, other keys are looked up by several
+   * interleaved descents from the root with software prefetch of the next nodes.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) {
+    return m_tree.lower_bound_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes lower_bound(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts const_iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.lower_bound_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes find(key) for every key of [first, last) to out. The lookup is done as in
+   * lower_bound_many().
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator find_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) {
+    return m_tree.find_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes find(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts const_iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator find_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.find_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes contains(key) for every key of [first, last) to out. The lookup is done
+   * as in lower_bound_many().
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts bool.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator contains_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.contains_many(first, last, out);
+  }
+
   /**
    * @brief Returns a range containing all elements with the given key in the container. The range is defined by two
    * iterators, one pointing to the first element that is not less than key and another pointing to the first element
@@ -1290,11 +1548,12 @@ private:
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param other Another container to be used as source to initialize the elements of the container with.
  * @param alloc Allocator to use for all memory allocations of this container.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-multimap<t_key, t_type, t_compare, t_allocator>::multimap(multimap &&other, allocator_type const &alloc)
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+multimap<t_key, t_type, t_compare, t_allocator, t_node_policy>::multimap(multimap &&other, allocator_type const &alloc)
     : m_tree(::portable_stl::move(other.m_tree), typename t_base_tree_type::allocator_type(alloc)) {
   if (alloc != other.get_allocator()) {
     const_iterator c_end = cend();
@@ -1313,14 +1572,15 @@ multimap<t_key, t_type, t_compare, t_allocator>::multimap(multimap &&other, allo
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the maps are equal,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator==(multimap<t_key, t_type, t_compare, t_allocator> const &lhv,
-                       multimap<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator==(multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                       multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return lhv.size() == rhv.size() && ::portable_stl::equal(lhv.begin(), lhv.end(), rhv.begin());
 }
 
@@ -1331,14 +1591,15 @@ inline bool operator==(multimap<t_key, t_type, t_compare, t_allocator> const &lh
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if if the contents of the maps are not equal,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator!=(multimap<t_key, t_type, t_compare, t_allocator> const &lhv,
-                       multimap<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator!=(multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                       multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return !(lhv == rhv);
 }
 
@@ -1349,14 +1610,15 @@ inline bool operator!=(multimap<t_key, t_type, t_compare, t_allocator> const &lh
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the lhs are lexicographically less than the contents of rhs,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator<(multimap<t_key, t_type, t_compare, t_allocator> const &lhv,
-                      multimap<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator<(multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                      multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return ::portable_stl::lexicographical_compare(lhv.begin(), lhv.end(), rhv.begin(), rhv.end());
 }
 
@@ -1367,14 +1629,15 @@ inline bool operator<(multimap<t_key, t_type, t_compare, t_allocator> const &lhv
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the lhs are lexicographically less than or equal to the contents of rhs,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator<=(multimap<t_key, t_type, t_compare, t_allocator> const &lhv,
-                       multimap<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator<=(multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                       multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return !(rhv < lhv);
 }
 
@@ -1385,14 +1648,15 @@ inline bool operator<=(multimap<t_key, t_type, t_compare, t_allocator> const &lh
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the lhs are lexicographically greater than the contents of rhs,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator>(multimap<t_key, t_type, t_compare, t_allocator> const &lhv,
-                      multimap<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator>(multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                      multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return rhv < lhv;
 }
 
@@ -1403,14 +1667,15 @@ inline bool operator>(multimap<t_key, t_type, t_compare, t_allocator> const &lhv
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to compare.
  * @param rhv Map to compare.
  * @return true if the contents of the lhs are lexicographically greater than or equal to the contents of rhs,
  * @return false otherwise.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline bool operator>=(multimap<t_key, t_type, t_compare, t_allocator> const &lhv,
-                       multimap<t_key, t_type, t_compare, t_allocator> const &rhv) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline bool operator>=(multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &lhv,
+                       multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> const &rhv) {
   return !(lhv < rhv);
 }
 
@@ -1421,12 +1686,14 @@ inline bool operator>=(multimap<t_key, t_type, t_compare, t_allocator> const &lh
  * @tparam t_type Mapped type.
  * @tparam t_compare Key compare type.
  * @tparam t_allocator Allocator type.
+ * @tparam t_node_policy Tree node policy type.
  * @param lhv Map to swap.
  * @param rhv Map to swap.
  */
-template<class t_key, class t_type, class t_compare, class t_allocator>
-inline void swap(multimap<t_key, t_type, t_compare, t_allocator> &lhv,
-                 multimap<t_key, t_type, t_compare, t_allocator> &rhv) noexcept(noexcept(lhv.swap(rhv))) {
+template<class t_key, class t_type, class t_compare, class t_allocator, class t_node_policy>
+inline void swap(multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> &lhv,
+                 multimap<t_key, t_type, t_compare, t_allocator, t_node_policy> &rhv)
+  noexcept(noexcept(lhv.swap(rhv))) {
   lhv.swap(rhv);
 }
 
@@ -91,6 +91,26 @@ namespace allocator_traits_helper {
     using type = ::portable_stl::true_type;
   };
 
+  // [has_deallocate_bulk]
+
+  template<class t_allocator, class t_pointer, class t_size_type, class = void> class has_deallocate_bulk final {
+  public:
+    using type = ::portable_stl::false_type;
+  };
+
+  template<class t_allocator, class t_pointer, class t_size_type>
+  class has_deallocate_bulk<t_allocator,
+                            t_pointer,
+                            t_size_type,
+                            decltype((void)::portable_stl::declval<t_allocator>().deallocate_bulk(
+                              ::portable_stl::declval<t_pointer const *>(),
+                              ::portable_stl::declval<t_size_type>(),
+                              ::portable_stl::declval<t_size_type>()))>
+    final {
+  public:
+    using type = ::portable_stl::true_type;
+  };
+
   // [has_max_size]
 
   template<class t_allocator, class = void> class has_max_size final {
@@ -231,6 +251,48 @@ public:
     allocator.deallocate(ptr, num);
   }
 
+  /**
+   * @brief Deallocates a batch of storages using the allocator.
+   * Calls a.deallocate_bulk(ptrs, count, num) if the allocator provides it, so the allocator is able to release the
+   * whole batch at once.
+   * @tparam t_alloc
+   * @param allocator Allocator to use.
+   * @param ptrs Pointers to the previously allocated storages.
+   * @param count The number of pointers in ptrs.
+   * @param num The number of objects each storage was allocated for.
+   */
+  template<class t_alloc = t_allocator,
+           class         = ::portable_stl::enable_if_bool_constant_t<
+                     typename allocator_traits_helper::has_deallocate_bulk<t_alloc, pointer, size_type>::type>>
+  constexpr static void deallocate_bulk(allocator_type &allocator,
+                                        pointer const  *ptrs,
+                                        size_type       count,
+                                        size_type       num) noexcept {
+    allocator.deallocate_bulk(ptrs, count, num);
+  }
+
+  /**
+   * @brief Deallocates a batch of storages using the allocator.
+   * allocator has no member function deallocate_bulk, the storages are deallocated one by one.
+   * @tparam t_alloc
+   * @param allocator Allocator to use.
+   * @param ptrs Pointers to the previously allocated storages.
+   * @param count The number of pointers in ptrs.
+   * @param num The number of objects each storage was allocated for.
+   */
+  template<class t_alloc = t_allocator,
+           class         = void,
+           class         = ::portable_stl::enable_if_bool_constant_t<::portable_stl::negation<
+                     typename allocator_traits_helper::has_deallocate_bulk<t_alloc, pointer, size_type>::type>>>
+  constexpr static void deallocate_bulk(allocator_type &allocator,
+                                        pointer const  *ptrs,
+                                        size_type       count,
+                                        size_type       num) noexcept {
+    for (size_type i{0U}; i < count; ++i) {
+      allocator.deallocate(ptrs[i], num);
+    }
+  }
+
   /**
    * @brief Constructs an object in the allocated storage.
    *
@@ -0,0 +1,29 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="prefetch_impl.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PREFETCH_IMPL_H
+#define PSTL_PREFETCH_IMPL_H
+
+namespace portable_stl {
+namespace memory_helper {
+
+  /**
+   * @brief Hints the processor to bring the memory at ptr into the cache for reading.
+   *
+   * @param ptr the address to prefetch.
+   */
+  inline void prefetch_impl(void const *ptr) noexcept {
+    __builtin_prefetch(ptr);
+  }
+} // namespace memory_helper
+} // namespace portable_stl
+
+#endif // PSTL_PREFETCH_IMPL_H
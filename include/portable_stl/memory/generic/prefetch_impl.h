@@ -0,0 +1,26 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="prefetch_impl.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PREFETCH_IMPL_H
+#define PSTL_PREFETCH_IMPL_H
+
+namespace portable_stl {
+namespace memory_helper {
+
+  /**
+   * @brief Prefetch is not available, does nothing.
+   */
+  inline void prefetch_impl(void const *) noexcept {
+  }
+} // namespace memory_helper
+} // namespace portable_stl
+
+#endif // PSTL_PREFETCH_IMPL_H
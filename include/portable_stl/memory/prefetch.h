@@ -0,0 +1,38 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="prefetch.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PREFETCH_H
+#define PSTL_PREFETCH_H
+
+#if defined(__has_builtin)
+#  if (!(__has_builtin(__builtin_prefetch)))
+#    include "generic/prefetch_impl.h"
+#  else
+#    include "builtin/prefetch_impl.h"
+#  endif
+#else
+#  include "generic/prefetch_impl.h"
+#endif
+
+namespace portable_stl {
+
+/**
+ * @brief Hints the processor to bring the memory at ptr into the cache for reading.
+ * Does nothing if the compiler has no prefetch intrinsic. Prefetching never faults, so ptr may be any value.
+ *
+ * @param ptr the address to prefetch.
+ */
+inline void prefetch(void const *ptr) noexcept {
+  ::portable_stl::memory_helper::prefetch_impl(ptr);
+}
+} // namespace portable_stl
+
+#endif // PSTL_PREFETCH_H
@@ -0,0 +1,56 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="accumulate.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_ACCUMULATE_H
+#define PSTL_ACCUMULATE_H
+
+#include "../functional/plus.h"
+#include "../utility/general/move.h"
+
+namespace portable_stl {
+/**
+ * @brief Folds the range [first, last) from the left: init = op(init, element) for every element in order.
+ * The order of the operations is fixed, use reduce for the associative operations.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_type the type of the accumulated value.
+ * @tparam t_binary_op the type of the operation.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param init the initial value.
+ * @param op the operation.
+ * @return the accumulated value.
+ */
+template<class t_input_iterator, class t_type, class t_binary_op>
+t_type accumulate(t_input_iterator first, t_input_iterator last, t_type init, t_binary_op op) {
+  for (; first != last; ++first) {
+    init = op(::portable_stl::move(init), *first);
+  }
+  return init;
+}
+
+/**
+ * @brief Computes the sum of init and the elements of the range [first, last) from the left.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_type the type of the accumulated value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param init the initial value.
+ * @return the sum.
+ */
+template<class t_input_iterator, class t_type>
+inline t_type accumulate(t_input_iterator first, t_input_iterator last, t_type init) {
+  return ::portable_stl::accumulate(first, last, ::portable_stl::move(init), ::portable_stl::plus<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_ACCUMULATE_H
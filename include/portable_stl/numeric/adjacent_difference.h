@@ -0,0 +1,71 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="adjacent_difference.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_ADJACENT_DIFFERENCE_H
+#define PSTL_ADJACENT_DIFFERENCE_H
+
+#include "../functional/minus.h"
+#include "../iterator/iterator_traits.h"
+#include "../utility/general/move.h"
+
+namespace portable_stl {
+/**
+ * @brief Writes the first element of the range [first, last) and op(element, previous element) for every next
+ * element to the destination. The destination may be first.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_output_iterator the type of output iterator.
+ * @tparam t_binary_op the type of the operation.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param d_first the beginning of the destination.
+ * @param op the operation.
+ * @return the iterator after the last written element.
+ */
+template<class t_input_iterator, class t_output_iterator, class t_binary_op>
+t_output_iterator adjacent_difference(t_input_iterator  first,
+                                      t_input_iterator  last,
+                                      t_output_iterator d_first,
+                                      t_binary_op       op) {
+  using value_type = typename ::portable_stl::iterator_traits<t_input_iterator>::value_type;
+
+  if (first == last) {
+    return d_first;
+  }
+  value_type previous(*first);
+  *d_first = previous;
+  ++d_first;
+  for (++first; first != last; ++first, (void)++d_first) {
+    value_type current(*first);
+    *d_first = op(current, ::portable_stl::move(previous));
+    previous = ::portable_stl::move(current);
+  }
+  return d_first;
+}
+
+/**
+ * @brief Writes the first element of the range [first, last) and the differences of the adjacent elements to the
+ * destination. The destination may be first.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_output_iterator the type of output iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param d_first the beginning of the destination.
+ * @return the iterator after the last written element.
+ */
+template<class t_input_iterator, class t_output_iterator>
+inline t_output_iterator adjacent_difference(t_input_iterator first, t_input_iterator last, t_output_iterator d_first) {
+  return ::portable_stl::adjacent_difference(first, last, d_first, ::portable_stl::minus<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_ADJACENT_DIFFERENCE_H
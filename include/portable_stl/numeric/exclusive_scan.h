@@ -0,0 +1,132 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="exclusive_scan.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EXCLUSIVE_SCAN_H
+#define PSTL_EXCLUSIVE_SCAN_H
+
+#include "../algorithm/unwrap_iter.h"
+#include "../common/ptrdiff_t.h"
+#include "../functional/plus.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../utility/general/move.h"
+#include "unrolled_reduce.h"
+
+namespace portable_stl {
+namespace numeric_helper {
+  /**
+   * @brief exclusive_scan for the input ranges: one op per element in order.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_output_iterator the type of output iterator.
+   * @tparam t_type the type of the running value.
+   * @tparam t_binary_op the type of the operation.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param d_first the beginning of the destination.
+   * @param sum the running value.
+   * @param op the operation.
+   * @return the iterator after the last written element.
+   */
+  template<class t_input_iterator, class t_output_iterator, class t_type, class t_binary_op>
+  t_output_iterator exclusive_scan_dispatch(t_input_iterator  first,
+                                            t_input_iterator  last,
+                                            t_output_iterator d_first,
+                                            t_type            sum,
+                                            t_binary_op      &op,
+                                            ::portable_stl::false_type) {
+    for (; first != last; ++first, (void)++d_first) {
+      // the element is read before the destination, which may be the same, is written
+      t_type next(op(sum, *first));
+      *d_first = ::portable_stl::move(sum);
+      sum      = ::portable_stl::move(next);
+    }
+    return d_first;
+  }
+
+  /**
+   * @brief exclusive_scan with the floating-point running value for the random access ranges: the unrolled scan,
+   * the contiguous ranges are read by pointers.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_output_iterator the type of output iterator.
+   * @tparam t_type the type of the running value.
+   * @tparam t_binary_op the type of the operation.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param d_first the beginning of the destination.
+   * @param sum the running value.
+   * @param op the operation.
+   * @return the iterator after the last written element.
+   */
+  template<class t_random_access_iterator, class t_output_iterator, class t_type, class t_binary_op>
+  t_output_iterator exclusive_scan_dispatch(t_random_access_iterator first,
+                                            t_random_access_iterator last,
+                                            t_output_iterator        d_first,
+                                            t_type                   sum,
+                                            t_binary_op             &op,
+                                            ::portable_stl::true_type) {
+    return ::portable_stl::numeric_helper::unrolled_exclusive_scan(
+      ::portable_stl::unwrap_iter(first), static_cast<::portable_stl::ptrdiff_t>(last - first), d_first, sum, op);
+  }
+} // namespace numeric_helper
+
+/**
+ * @brief Writes op(init, element 0, ..., element i - 1) for every element i of the range [first, last) to the
+ * destination, the operations are grouped in unspecified way. The destination may be first.
+ * op must be associative. The random access ranges with the floating-point init are scanned in groups of four
+ * elements, which shortens the dependency chain of the running value.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_output_iterator the type of output iterator.
+ * @tparam t_type the type of the running value.
+ * @tparam t_binary_op the type of the operation.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param d_first the beginning of the destination.
+ * @param init the initial value.
+ * @param op the operation.
+ * @return the iterator after the last written element.
+ */
+template<class t_input_iterator, class t_output_iterator, class t_type, class t_binary_op>
+inline t_output_iterator exclusive_scan(
+  t_input_iterator first, t_input_iterator last, t_output_iterator d_first, t_type init, t_binary_op op) {
+  return ::portable_stl::numeric_helper::exclusive_scan_dispatch(
+    first,
+    last,
+    d_first,
+    ::portable_stl::move(init),
+    op,
+    ::portable_stl::numeric_helper::unrolled_scan_tag<t_input_iterator, t_type>{});
+}
+
+/**
+ * @brief Writes the sum of init and the elements before it for every element of the range [first, last) to the
+ * destination. The destination may be first.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_output_iterator the type of output iterator.
+ * @tparam t_type the type of the running value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param d_first the beginning of the destination.
+ * @param init the initial value.
+ * @return the iterator after the last written element.
+ */
+template<class t_input_iterator, class t_output_iterator, class t_type>
+inline t_output_iterator exclusive_scan(t_input_iterator  first,
+                                        t_input_iterator  last,
+                                        t_output_iterator d_first,
+                                        t_type            init) {
+  return ::portable_stl::exclusive_scan(first, last, d_first, ::portable_stl::move(init), ::portable_stl::plus<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_EXCLUSIVE_SCAN_H
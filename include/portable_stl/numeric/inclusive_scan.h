@@ -0,0 +1,154 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="inclusive_scan.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_INCLUSIVE_SCAN_H
+#define PSTL_INCLUSIVE_SCAN_H
+
+#include "../algorithm/unwrap_iter.h"
+#include "../common/ptrdiff_t.h"
+#include "../functional/plus.h"
+#include "../iterator/iterator_traits.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../utility/general/move.h"
+#include "unrolled_reduce.h"
+
+namespace portable_stl {
+namespace numeric_helper {
+  /**
+   * @brief inclusive_scan continuing the running value for the input ranges: one op per element in order.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_output_iterator the type of output iterator.
+   * @tparam t_binary_op the type of the operation.
+   * @tparam t_type the type of the running value.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param d_first the beginning of the destination.
+   * @param op the operation.
+   * @param sum the running value.
+   * @return the iterator after the last written element.
+   */
+  template<class t_input_iterator, class t_output_iterator, class t_binary_op, class t_type>
+  t_output_iterator inclusive_scan_dispatch(t_input_iterator  first,
+                                            t_input_iterator  last,
+                                            t_output_iterator d_first,
+                                            t_binary_op      &op,
+                                            t_type            sum,
+                                            ::portable_stl::false_type) {
+    for (; first != last; ++first, (void)++d_first) {
+      sum      = op(::portable_stl::move(sum), *first);
+      *d_first = sum;
+    }
+    return d_first;
+  }
+
+  /**
+   * @brief inclusive_scan continuing the floating-point running value for the random access ranges: the unrolled
+   * scan, the contiguous ranges are read by pointers.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_output_iterator the type of output iterator.
+   * @tparam t_binary_op the type of the operation.
+   * @tparam t_type the type of the running value.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param d_first the beginning of the destination.
+   * @param op the operation.
+   * @param sum the running value.
+   * @return the iterator after the last written element.
+   */
+  template<class t_random_access_iterator, class t_output_iterator, class t_binary_op, class t_type>
+  t_output_iterator inclusive_scan_dispatch(t_random_access_iterator first,
+                                            t_random_access_iterator last,
+                                            t_output_iterator        d_first,
+                                            t_binary_op             &op,
+                                            t_type                   sum,
+                                            ::portable_stl::true_type) {
+    return ::portable_stl::numeric_helper::unrolled_inclusive_scan(
+      ::portable_stl::unwrap_iter(first), static_cast<::portable_stl::ptrdiff_t>(last - first), d_first, sum, op);
+  }
+} // namespace numeric_helper
+
+/**
+ * @brief Writes op(init, element 0, ..., element i) for every element i of the range [first, last) to the
+ * destination, the operations are grouped in unspecified way. The destination may be first.
+ * op must be associative. The random access ranges of the floating-point values are scanned in groups of four
+ * elements, which shortens the dependency chain of the running value.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_output_iterator the type of output iterator.
+ * @tparam t_binary_op the type of the operation.
+ * @tparam t_type the type of the running value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param d_first the beginning of the destination.
+ * @param op the operation.
+ * @param init the initial value.
+ * @return the iterator after the last written element.
+ */
+template<class t_input_iterator, class t_output_iterator, class t_binary_op, class t_type>
+inline t_output_iterator inclusive_scan(
+  t_input_iterator first, t_input_iterator last, t_output_iterator d_first, t_binary_op op, t_type init) {
+  return ::portable_stl::numeric_helper::inclusive_scan_dispatch(
+    first,
+    last,
+    d_first,
+    op,
+    ::portable_stl::move(init),
+    ::portable_stl::numeric_helper::unrolled_scan_tag<t_input_iterator, t_type>{});
+}
+
+/**
+ * @brief Writes op(element 0, ..., element i) for every element i of the range [first, last) to the destination,
+ * the operations are grouped in unspecified way. The destination may be first.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_output_iterator the type of output iterator.
+ * @tparam t_binary_op the type of the operation.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param d_first the beginning of the destination.
+ * @param op the operation.
+ * @return the iterator after the last written element.
+ */
+template<class t_input_iterator, class t_output_iterator, class t_binary_op>
+t_output_iterator inclusive_scan(t_input_iterator  first,
+                                 t_input_iterator  last,
+                                 t_output_iterator d_first,
+                                 t_binary_op       op) {
+  using value_type = typename ::portable_stl::iterator_traits<t_input_iterator>::value_type;
+
+  if (first == last) {
+    return d_first;
+  }
+  value_type init(*first);
+  *d_first = init;
+  return ::portable_stl::inclusive_scan(++first, last, ++d_first, op, ::portable_stl::move(init));
+}
+
+/**
+ * @brief Writes the sums of the prefixes of the range [first, last) to the destination. The destination may be
+ * first.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_output_iterator the type of output iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param d_first the beginning of the destination.
+ * @return the iterator after the last written element.
+ */
+template<class t_input_iterator, class t_output_iterator>
+inline t_output_iterator inclusive_scan(t_input_iterator first, t_input_iterator last, t_output_iterator d_first) {
+  return ::portable_stl::inclusive_scan(first, last, d_first, ::portable_stl::plus<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_INCLUSIVE_SCAN_H
@@ -0,0 +1,71 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="inner_product.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_INNER_PRODUCT_H
+#define PSTL_INNER_PRODUCT_H
+
+#include "../functional/multiplies.h"
+#include "../functional/plus.h"
+#include "../utility/general/move.h"
+
+namespace portable_stl {
+/**
+ * @brief Folds the pairs of the ranges [first1, last1) and [first2, ...) from the left:
+ * init = op1(init, op2(element1, element2)) for every pair in order.
+ * The order of the operations is fixed, use transform_reduce for the associative operations.
+ *
+ * @tparam t_input_iterator1 the type of iterator of the first range.
+ * @tparam t_input_iterator2 the type of iterator of the second range.
+ * @tparam t_type the type of the accumulated value.
+ * @tparam t_binary_op1 the type of the accumulation.
+ * @tparam t_binary_op2 the type of the transformation of the pair.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param init the initial value.
+ * @param op1 the accumulation.
+ * @param op2 the transformation of the pair.
+ * @return the accumulated value.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_type, class t_binary_op1, class t_binary_op2>
+t_type inner_product(t_input_iterator1 first1,
+                     t_input_iterator1 last1,
+                     t_input_iterator2 first2,
+                     t_type            init,
+                     t_binary_op1      op1,
+                     t_binary_op2      op2) {
+  for (; first1 != last1; ++first1, (void)++first2) {
+    init = op1(::portable_stl::move(init), op2(*first1, *first2));
+  }
+  return init;
+}
+
+/**
+ * @brief Computes the sum of init and the products of the pairs of the ranges [first1, last1) and [first2, ...)
+ * from the left.
+ *
+ * @tparam t_input_iterator1 the type of iterator of the first range.
+ * @tparam t_input_iterator2 the type of iterator of the second range.
+ * @tparam t_type the type of the accumulated value.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param init the initial value.
+ * @return the inner product.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_type>
+inline t_type inner_product(t_input_iterator1 first1, t_input_iterator1 last1, t_input_iterator2 first2, t_type init) {
+  return ::portable_stl::inner_product(
+    first1, last1, first2, ::portable_stl::move(init), ::portable_stl::plus<>{}, ::portable_stl::multiplies<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_INNER_PRODUCT_H
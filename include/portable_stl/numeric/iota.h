@@ -0,0 +1,34 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="iota.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_IOTA_H
+#define PSTL_IOTA_H
+
+namespace portable_stl {
+/**
+ * @brief Fills the range [first, last) with sequentially increasing values, starting with value.
+ *
+ * @tparam t_forward_iterator the type of iterator.
+ * @tparam t_type the type of the value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the initial value to store.
+ */
+template<class t_forward_iterator, class t_type>
+void iota(t_forward_iterator first, t_forward_iterator last, t_type value) {
+  for (; first != last; ++first) {
+    *first = value;
+    ++value;
+  }
+}
+} // namespace portable_stl
+
+#endif // PSTL_IOTA_H
@@ -0,0 +1,192 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="reduce.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_REDUCE_H
+#define PSTL_REDUCE_H
+
+#include "../algorithm/simd_scan.h"
+#include "../algorithm/unwrap_iter.h"
+#include "../common/ptrdiff_t.h"
+#include "../functional/plus.h"
+#include "../iterator/iterator_traits.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/type_relations/is_same.h"
+#include "../utility/general/move.h"
+#include "unrolled_reduce.h"
+
+namespace portable_stl {
+namespace numeric_helper {
+  /**
+   * @brief reduce for the input ranges and the non-arithmetic values: the left fold.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_binary_op the type of the reduction.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @param op the reduction.
+   * @return the reduced value.
+   */
+  template<class t_input_iterator, class t_type, class t_binary_op>
+  t_type reduce_dispatch(
+    t_input_iterator first, t_input_iterator last, t_type init, t_binary_op &op, ::portable_stl::false_type) {
+    for (; first != last; ++first) {
+      init = op(::portable_stl::move(init), *first);
+    }
+    return init;
+  }
+
+  /**
+   * @brief Selects the vector sum of algorithm_helper::simd_sum: the reduction is the addition and the range is
+   * contiguous with the elements of the reduced type, which has the vector addition.
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_binary_op the type of the reduction.
+   */
+  template<class t_iterator, class t_type, class t_binary_op>
+  using simd_reduce_tag = ::portable_stl::bool_constant<
+    ::portable_stl::algorithm_helper::simd_sum_tag<t_iterator, t_type>{}()
+    && (::portable_stl::is_same<t_binary_op, ::portable_stl::plus<>>{}()
+        || ::portable_stl::is_same<t_binary_op, ::portable_stl::plus<t_type>>{}())>;
+
+  /**
+   * @brief reduce for the random access ranges and the arithmetic values: the unrolled reduction, the contiguous
+   * ranges are reduced by pointers.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_binary_op the type of the reduction.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @param op the reduction.
+   * @return the reduced value.
+   */
+  template<class t_random_access_iterator, class t_type, class t_binary_op>
+  t_type reduce_random_access(t_random_access_iterator first,
+                              t_random_access_iterator last,
+                              t_type                   init,
+                              t_binary_op             &op,
+                              ::portable_stl::false_type) {
+    auto unwrapped_first = ::portable_stl::unwrap_iter(first);
+    return ::portable_stl::numeric_helper::unrolled_reduce(
+      ::portable_stl::numeric_helper::element_reader<decltype(unwrapped_first)>(unwrapped_first),
+      static_cast<::portable_stl::ptrdiff_t>(last - first),
+      init,
+      op);
+  }
+
+  /**
+   * @brief reduce for the contiguous ranges summed into the element type: the vector sum.
+   *
+   * @tparam t_contiguous_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_binary_op the type of the reduction.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @return the sum.
+   */
+  template<class t_contiguous_iterator, class t_type, class t_binary_op>
+  t_type reduce_random_access(t_contiguous_iterator first,
+                              t_contiguous_iterator last,
+                              t_type                init,
+                              t_binary_op &,
+                              ::portable_stl::true_type) {
+    t_type const *unwrapped_first{::portable_stl::unwrap_iter(first)};
+    return ::portable_stl::algorithm_helper::simd_sum(unwrapped_first, unwrapped_first + (last - first), init);
+  }
+
+  /**
+   * @brief reduce for the random access ranges and the arithmetic values.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_binary_op the type of the reduction.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @param op the reduction.
+   * @return the reduced value.
+   */
+  template<class t_random_access_iterator, class t_type, class t_binary_op>
+  t_type reduce_dispatch(t_random_access_iterator first,
+                         t_random_access_iterator last,
+                         t_type                   init,
+                         t_binary_op             &op,
+                         ::portable_stl::true_type) {
+    return ::portable_stl::numeric_helper::reduce_random_access(
+      first,
+      last,
+      init,
+      op,
+      ::portable_stl::numeric_helper::simd_reduce_tag<t_random_access_iterator, t_type, t_binary_op>{});
+  }
+} // namespace numeric_helper
+
+/**
+ * @brief Reduces the range [first, last) and init with op in unspecified order and grouping.
+ * op must be associative and commutative. The random access ranges of the arithmetic values are reduced with
+ * several independent accumulators, the contiguous ranges summed by plus into their element type are summed by the
+ * vector lanes where the target has them.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_type the type of the reduced value.
+ * @tparam t_binary_op the type of the reduction.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param init the initial value.
+ * @param op the reduction.
+ * @return the reduced value.
+ */
+template<class t_input_iterator, class t_type, class t_binary_op>
+inline t_type reduce(t_input_iterator first, t_input_iterator last, t_type init, t_binary_op op) {
+  return ::portable_stl::numeric_helper::reduce_dispatch(
+    first,
+    last,
+    ::portable_stl::move(init),
+    op,
+    ::portable_stl::numeric_helper::unrolled_reduce_tag<t_input_iterator, t_type>{});
+}
+
+/**
+ * @brief Computes the sum of init and the elements of the range [first, last) in unspecified order.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_type the type of the reduced value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param init the initial value.
+ * @return the sum.
+ */
+template<class t_input_iterator, class t_type>
+inline t_type reduce(t_input_iterator first, t_input_iterator last, t_type init) {
+  return ::portable_stl::reduce(first, last, ::portable_stl::move(init), ::portable_stl::plus<>{});
+}
+
+/**
+ * @brief Computes the sum of the elements of the range [first, last) in unspecified order.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @return the sum or the value-initialized value for the empty range.
+ */
+template<class t_input_iterator>
+inline typename ::portable_stl::iterator_traits<t_input_iterator>::value_type reduce(t_input_iterator first,
+                                                                                     t_input_iterator last) {
+  return ::portable_stl::reduce(
+    first, last, typename ::portable_stl::iterator_traits<t_input_iterator>::value_type{}, ::portable_stl::plus<>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_REDUCE_H
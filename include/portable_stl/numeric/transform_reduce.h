@@ -0,0 +1,240 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="transform_reduce.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_TRANSFORM_REDUCE_H
+#define PSTL_TRANSFORM_REDUCE_H
+
+#include "../algorithm/unwrap_iter.h"
+#include "../common/ptrdiff_t.h"
+#include "../functional/multiplies.h"
+#include "../functional/plus.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../utility/general/move.h"
+#include "unrolled_reduce.h"
+
+namespace portable_stl {
+namespace numeric_helper {
+  /**
+   * @brief transform_reduce of two ranges for the input ranges and the non-arithmetic values: the left fold.
+   *
+   * @tparam t_input_iterator1 the type of iterator of the first range.
+   * @tparam t_input_iterator2 the type of iterator of the second range.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_reduce_op the type of the reduction.
+   * @tparam t_transform_op the type of the transformation of the pair.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param init the initial value.
+   * @param reduce the reduction.
+   * @param transform the transformation of the pair.
+   * @return the reduced value.
+   */
+  template<class t_input_iterator1, class t_input_iterator2, class t_type, class t_reduce_op, class t_transform_op>
+  t_type transform_reduce_dispatch(t_input_iterator1 first1,
+                                   t_input_iterator1 last1,
+                                   t_input_iterator2 first2,
+                                   t_type            init,
+                                   t_reduce_op      &reduce,
+                                   t_transform_op   &transform,
+                                   ::portable_stl::false_type) {
+    for (; first1 != last1; ++first1, (void)++first2) {
+      init = reduce(::portable_stl::move(init), transform(*first1, *first2));
+    }
+    return init;
+  }
+
+  /**
+   * @brief transform_reduce of two ranges for the random access ranges and the arithmetic values: the unrolled
+   * reduction, the contiguous ranges are read by pointers.
+   *
+   * @tparam t_random_access_iterator1 the type of iterator of the first range.
+   * @tparam t_random_access_iterator2 the type of iterator of the second range.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_reduce_op the type of the reduction.
+   * @tparam t_transform_op the type of the transformation of the pair.
+   * @param first1 the beginning of the first range.
+   * @param last1 the end of the first range.
+   * @param first2 the beginning of the second range.
+   * @param init the initial value.
+   * @param reduce the reduction.
+   * @param transform the transformation of the pair.
+   * @return the reduced value.
+   */
+  template<class t_random_access_iterator1,
+           class t_random_access_iterator2,
+           class t_type,
+           class t_reduce_op,
+           class t_transform_op>
+  t_type transform_reduce_dispatch(t_random_access_iterator1 first1,
+                                   t_random_access_iterator1 last1,
+                                   t_random_access_iterator2 first2,
+                                   t_type                    init,
+                                   t_reduce_op              &reduce,
+                                   t_transform_op           &transform,
+                                   ::portable_stl::true_type) {
+    auto unwrapped_first1 = ::portable_stl::unwrap_iter(first1);
+    auto unwrapped_first2 = ::portable_stl::unwrap_iter(first2);
+    return ::portable_stl::numeric_helper::unrolled_reduce(
+      ::portable_stl::numeric_helper::
+        binary_transform_reader<decltype(unwrapped_first1), decltype(unwrapped_first2), t_transform_op>(
+          unwrapped_first1, unwrapped_first2, transform),
+      static_cast<::portable_stl::ptrdiff_t>(last1 - first1),
+      init,
+      reduce);
+  }
+
+  /**
+   * @brief transform_reduce of one range for the input ranges and the non-arithmetic values: the left fold.
+   *
+   * @tparam t_input_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_reduce_op the type of the reduction.
+   * @tparam t_transform_op the type of the transformation.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @param reduce the reduction.
+   * @param transform the transformation.
+   * @return the reduced value.
+   */
+  template<class t_input_iterator, class t_type, class t_reduce_op, class t_transform_op>
+  t_type transform_reduce_dispatch(t_input_iterator first,
+                                   t_input_iterator last,
+                                   t_type           init,
+                                   t_reduce_op     &reduce,
+                                   t_transform_op  &transform,
+                                   ::portable_stl::false_type) {
+    for (; first != last; ++first) {
+      init = reduce(::portable_stl::move(init), transform(*first));
+    }
+    return init;
+  }
+
+  /**
+   * @brief transform_reduce of one range for the random access ranges and the arithmetic values: the unrolled
+   * reduction, the contiguous ranges are read by pointers.
+   *
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_type the type of the reduced value.
+   * @tparam t_reduce_op the type of the reduction.
+   * @tparam t_transform_op the type of the transformation.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param init the initial value.
+   * @param reduce the reduction.
+   * @param transform the transformation.
+   * @return the reduced value.
+   */
+  template<class t_random_access_iterator, class t_type, class t_reduce_op, class t_transform_op>
+  t_type transform_reduce_dispatch(t_random_access_iterator first,
+                                   t_random_access_iterator last,
+                                   t_type                   init,
+                                   t_reduce_op             &reduce,
+                                   t_transform_op          &transform,
+                                   ::portable_stl::true_type) {
+    auto unwrapped_first = ::portable_stl::unwrap_iter(first);
+    return ::portable_stl::numeric_helper::unrolled_reduce(
+      ::portable_stl::numeric_helper::unary_transform_reader<decltype(unwrapped_first), t_transform_op>(
+        unwrapped_first, transform),
+      static_cast<::portable_stl::ptrdiff_t>(last - first),
+      init,
+      reduce);
+  }
+} // namespace numeric_helper
+
+/**
+ * @brief Reduces init and transform(element1, element2) for the pairs of the ranges [first1, last1) and
+ * [first2, ...) with reduce in unspecified order and grouping.
+ * reduce must be associative and commutative. The random access ranges are reduced to the arithmetic values with
+ * several independent accumulators.
+ *
+ * @tparam t_input_iterator1 the type of iterator of the first range.
+ * @tparam t_input_iterator2 the type of iterator of the second range.
+ * @tparam t_type the type of the reduced value.
+ * @tparam t_reduce_op the type of the reduction.
+ * @tparam t_transform_op the type of the transformation of the pair.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param init the initial value.
+ * @param reduce the reduction.
+ * @param transform the transformation of the pair.
+ * @return the reduced value.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_type, class t_reduce_op, class t_transform_op>
+inline t_type transform_reduce(t_input_iterator1 first1,
+                               t_input_iterator1 last1,
+                               t_input_iterator2 first2,
+                               t_type            init,
+                               t_reduce_op       reduce,
+                               t_transform_op    transform) {
+  using t_tag = ::portable_stl::bool_constant<
+    ::portable_stl::numeric_helper::unrolled_reduce_tag<t_input_iterator1, t_type>{}()
+    && ::portable_stl::numeric_helper::unrolled_reduce_tag<t_input_iterator2, t_type>{}()>;
+
+  return ::portable_stl::numeric_helper::transform_reduce_dispatch(
+    first1, last1, first2, ::portable_stl::move(init), reduce, transform, t_tag{});
+}
+
+/**
+ * @brief Computes the sum of init and the products of the pairs of the ranges [first1, last1) and [first2, ...)
+ * in unspecified order.
+ *
+ * @tparam t_input_iterator1 the type of iterator of the first range.
+ * @tparam t_input_iterator2 the type of iterator of the second range.
+ * @tparam t_type the type of the reduced value.
+ * @param first1 the beginning of the first range.
+ * @param last1 the end of the first range.
+ * @param first2 the beginning of the second range.
+ * @param init the initial value.
+ * @return the inner product.
+ */
+template<class t_input_iterator1, class t_input_iterator2, class t_type>
+inline t_type transform_reduce(t_input_iterator1 first1,
+                               t_input_iterator1 last1,
+                               t_input_iterator2 first2,
+                               t_type            init) {
+  return ::portable_stl::transform_reduce(
+    first1, last1, first2, ::portable_stl::move(init), ::portable_stl::plus<>{}, ::portable_stl::multiplies<>{});
+}
+
+/**
+ * @brief Reduces init and transform(element) for the elements of the range [first, last) with reduce in
+ * unspecified order and grouping.
+ * reduce must be associative and commutative. The random access ranges are reduced to the arithmetic values with
+ * several independent accumulators.
+ *
+ * @tparam t_input_iterator the type of iterator.
+ * @tparam t_type the type of the reduced value.
+ * @tparam t_reduce_op the type of the reduction.
+ * @tparam t_transform_op the type of the transformation.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param init the initial value.
+ * @param reduce the reduction.
+ * @param transform the transformation.
+ * @return the reduced value.
+ */
+template<class t_input_iterator, class t_type, class t_reduce_op, class t_transform_op>
+inline t_type transform_reduce(
+  t_input_iterator first, t_input_iterator last, t_type init, t_reduce_op reduce, t_transform_op transform) {
+  return ::portable_stl::numeric_helper::transform_reduce_dispatch(
+    first,
+    last,
+    ::portable_stl::move(init),
+    reduce,
+    transform,
+    ::portable_stl::numeric_helper::unrolled_reduce_tag<t_input_iterator, t_type>{});
+}
+} // namespace portable_stl
+
+#endif // PSTL_TRANSFORM_REDUCE_H
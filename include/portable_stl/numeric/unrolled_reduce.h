@@ -0,0 +1,305 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="unrolled_reduce.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_UNROLLED_REDUCE_H
+#define PSTL_UNROLLED_REDUCE_H
+
+#include "../common/ptrdiff_t.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/composite_type/is_arithmetic.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/primary_type/is_floating_point.h"
+#include "../metaprogramming/type_relations/is_base_of.h"
+
+namespace portable_stl {
+namespace numeric_helper {
+  /**
+   * @brief Number of the independent accumulators of the unrolled reduction.
+   */
+  constexpr ::portable_stl::ptrdiff_t reduce_lanes{8};
+
+  /**
+   * @brief Selects the unrolled reduction: the random access range and the arithmetic accumulator.
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_type the type of the accumulator.
+   */
+  template<class t_iterator, class t_type>
+  using unrolled_reduce_tag = ::portable_stl::bool_constant<
+    ::portable_stl::is_base_of<::portable_stl::random_access_iterator_tag,
+                               typename ::portable_stl::iterator_traits<t_iterator>::iterator_category>{}()
+    && ::portable_stl::is_arithmetic<t_type>{}()>;
+
+  /**
+   * @brief Selects the unrolled scan: the random access range and the floating-point accumulator, whose addition
+   * latency bounds the sequential scan.
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_type the type of the accumulator.
+   */
+  template<class t_iterator, class t_type>
+  using unrolled_scan_tag = ::portable_stl::bool_constant<
+    ::portable_stl::is_base_of<::portable_stl::random_access_iterator_tag,
+                               typename ::portable_stl::iterator_traits<t_iterator>::iterator_category>{}()
+    && ::portable_stl::is_floating_point<t_type>{}()>;
+
+  /**
+   * @brief Reads the elements of the range.
+   * @tparam t_iterator the type of iterator.
+   */
+  template<class t_iterator> class element_reader final {
+    /**
+     * @brief The beginning of the range.
+     */
+    t_iterator m_first;
+
+  public:
+    /**
+     * @brief Constructor.
+     * @param first the beginning of the range.
+     */
+    explicit element_reader(t_iterator first) : m_first(first) {
+    }
+
+    /**
+     * @brief Reads the element.
+     * @param index the index of the element.
+     * @return the element.
+     */
+    typename ::portable_stl::iterator_traits<t_iterator>::reference operator()(::portable_stl::ptrdiff_t index) const {
+      return m_first[index];
+    }
+  };
+
+  /**
+   * @brief Reads the transformed elements of the range.
+   * @tparam t_iterator the type of iterator.
+   * @tparam t_unary_op the type of the transformation.
+   */
+  template<class t_iterator, class t_unary_op> class unary_transform_reader final {
+    /**
+     * @brief The beginning of the range.
+     */
+    t_iterator  m_first;
+    /**
+     * @brief The transformation.
+     */
+    t_unary_op &m_transform;
+
+  public:
+    /**
+     * @brief Constructor.
+     * @param first the beginning of the range.
+     * @param transform the transformation.
+     */
+    unary_transform_reader(t_iterator first, t_unary_op &transform) : m_first(first), m_transform(transform) {
+    }
+
+    /**
+     * @brief Reads the transformed element.
+     * @param index the index of the element.
+     * @return the transformed element.
+     */
+    auto operator()(::portable_stl::ptrdiff_t index) const -> decltype(m_transform(m_first[index])) {
+      return m_transform(m_first[index]);
+    }
+  };
+
+  /**
+   * @brief Reads the transformed pairs of the elements of two ranges.
+   * @tparam t_iterator1 the type of iterator of the first range.
+   * @tparam t_iterator2 the type of iterator of the second range.
+   * @tparam t_binary_op the type of the transformation.
+   */
+  template<class t_iterator1, class t_iterator2, class t_binary_op> class binary_transform_reader final {
+    /**
+     * @brief The beginning of the first range.
+     */
+    t_iterator1  m_first1;
+    /**
+     * @brief The beginning of the second range.
+     */
+    t_iterator2  m_first2;
+    /**
+     * @brief The transformation.
+     */
+    t_binary_op &m_transform;
+
+  public:
+    /**
+     * @brief Constructor.
+     * @param first1 the beginning of the first range.
+     * @param first2 the beginning of the second range.
+     * @param transform the transformation.
+     */
+    binary_transform_reader(t_iterator1 first1, t_iterator2 first2, t_binary_op &transform)
+        : m_first1(first1), m_first2(first2), m_transform(transform) {
+    }
+
+    /**
+     * @brief Reads the transformed pair of the elements.
+     * @param index the index of the elements.
+     * @return the transformed pair.
+     */
+    auto operator()(::portable_stl::ptrdiff_t index) const -> decltype(m_transform(m_first1[index], m_first2[index])) {
+      return m_transform(m_first1[index], m_first2[index]);
+    }
+  };
+
+  /**
+   * @brief Reduces len values of the reader with the associative and commutative op.
+   * The values are spread over reduce_lanes independent accumulators, so the latency of op does not serialize the
+   * loop, and the compiler can keep the accumulators in the (vector) registers. The accumulators are separate
+   * variables rather than an array, which some compilers keep in memory without the vectorizer. They start from
+   * the first values, so op needs no identity element, and are combined pairwise at the end.
+   *
+   * @tparam t_type the type of the accumulator.
+   * @tparam t_reader the type of the reader.
+   * @tparam t_binary_op the type of the reduction.
+   * @param reader the reader of the values.
+   * @param len the number of the values.
+   * @param init the initial value.
+   * @param op the reduction.
+   * @return the reduced value.
+   */
+  template<class t_type, class t_reader, class t_binary_op>
+  t_type unrolled_reduce(t_reader const &reader, ::portable_stl::ptrdiff_t len, t_type init, t_binary_op &op) {
+    ::portable_stl::ptrdiff_t index{0};
+    if (len >= 2 * reduce_lanes) {
+      auto accumulator0 = static_cast<t_type>(reader(0));
+      auto accumulator1 = static_cast<t_type>(reader(1));
+      auto accumulator2 = static_cast<t_type>(reader(2));
+      auto accumulator3 = static_cast<t_type>(reader(3));
+      auto accumulator4 = static_cast<t_type>(reader(4));
+      auto accumulator5 = static_cast<t_type>(reader(5));
+      auto accumulator6 = static_cast<t_type>(reader(6));
+      auto accumulator7 = static_cast<t_type>(reader(7));
+      ::portable_stl::ptrdiff_t const last_block{len - len % reduce_lanes};
+      for (index = reduce_lanes; index != last_block; index += reduce_lanes) {
+        accumulator0 = static_cast<t_type>(op(accumulator0, reader(index)));
+        accumulator1 = static_cast<t_type>(op(accumulator1, reader(index + 1)));
+        accumulator2 = static_cast<t_type>(op(accumulator2, reader(index + 2)));
+        accumulator3 = static_cast<t_type>(op(accumulator3, reader(index + 3)));
+        accumulator4 = static_cast<t_type>(op(accumulator4, reader(index + 4)));
+        accumulator5 = static_cast<t_type>(op(accumulator5, reader(index + 5)));
+        accumulator6 = static_cast<t_type>(op(accumulator6, reader(index + 6)));
+        accumulator7 = static_cast<t_type>(op(accumulator7, reader(index + 7)));
+      }
+      accumulator0 = static_cast<t_type>(op(accumulator0, accumulator4));
+      accumulator1 = static_cast<t_type>(op(accumulator1, accumulator5));
+      accumulator2 = static_cast<t_type>(op(accumulator2, accumulator6));
+      accumulator3 = static_cast<t_type>(op(accumulator3, accumulator7));
+      accumulator0 = static_cast<t_type>(op(accumulator0, accumulator2));
+      accumulator1 = static_cast<t_type>(op(accumulator1, accumulator3));
+      init         = static_cast<t_type>(op(init, op(accumulator0, accumulator1)));
+    }
+    for (; index < len; ++index) {
+      init = static_cast<t_type>(op(init, reader(index)));
+    }
+    return init;
+  }
+
+  /**
+   * @brief Writes the inclusive scan of the range [first, first + len) continuing the running value sum.
+   * Each group of four elements is scanned on its own and then combined with the running value, so the dependency
+   * chain through sum has one op per four elements instead of one per element. The group is read before it is
+   * written, so the scan may be in place.
+   *
+   * @tparam t_type the type of the running value.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_output_iterator the type of output iterator.
+   * @tparam t_binary_op the type of the operation.
+   * @param first the beginning of the range.
+   * @param len the length of the range.
+   * @param d_first the beginning of the destination.
+   * @param sum the running value.
+   * @param op the associative operation.
+   * @return the iterator after the last written element.
+   */
+  template<class t_type, class t_random_access_iterator, class t_output_iterator, class t_binary_op>
+  t_output_iterator unrolled_inclusive_scan(t_random_access_iterator  first,
+                                            ::portable_stl::ptrdiff_t len,
+                                            t_output_iterator         d_first,
+                                            t_type                    sum,
+                                            t_binary_op              &op) {
+    ::portable_stl::ptrdiff_t index{0};
+    for (; index + 4 <= len; index += 4) {
+      t_type const part0(first[index]);
+      t_type const part1(op(part0, first[index + 1]));
+      t_type const part2(op(part1, first[index + 2]));
+      t_type const part3(op(part2, first[index + 3]));
+      *d_first = op(sum, part0);
+      ++d_first;
+      *d_first = op(sum, part1);
+      ++d_first;
+      *d_first = op(sum, part2);
+      ++d_first;
+      sum      = op(sum, part3);
+      *d_first = sum;
+      ++d_first;
+    }
+    for (; index < len; ++index) {
+      sum      = op(sum, first[index]);
+      *d_first = sum;
+      ++d_first;
+    }
+    return d_first;
+  }
+
+  /**
+   * @brief Writes the exclusive scan of the range [first, first + len) continuing the running value sum.
+   * Each group of four elements is scanned on its own and then combined with the running value, see
+   * unrolled_inclusive_scan.
+   *
+   * @tparam t_type the type of the running value.
+   * @tparam t_random_access_iterator the type of iterator.
+   * @tparam t_output_iterator the type of output iterator.
+   * @tparam t_binary_op the type of the operation.
+   * @param first the beginning of the range.
+   * @param len the length of the range.
+   * @param d_first the beginning of the destination.
+   * @param sum the running value.
+   * @param op the associative operation.
+   * @return the iterator after the last written element.
+   */
+  template<class t_type, class t_random_access_iterator, class t_output_iterator, class t_binary_op>
+  t_output_iterator unrolled_exclusive_scan(t_random_access_iterator  first,
+                                            ::portable_stl::ptrdiff_t len,
+                                            t_output_iterator         d_first,
+                                            t_type                    sum,
+                                            t_binary_op              &op) {
+    ::portable_stl::ptrdiff_t index{0};
+    for (; index + 4 <= len; index += 4) {
+      t_type const part0(first[index]);
+      t_type const part1(op(part0, first[index + 1]));
+      t_type const part2(op(part1, first[index + 2]));
+      t_type const part3(op(part2, first[index + 3]));
+      *d_first = sum;
+      ++d_first;
+      *d_first = op(sum, part0);
+      ++d_first;
+      *d_first = op(sum, part1);
+      ++d_first;
+      *d_first = op(sum, part2);
+      ++d_first;
+      sum      = op(sum, part3);
+    }
+    for (; index < len; ++index) {
+      t_type next(op(sum, first[index]));
+      *d_first = sum;
+      ++d_first;
+      sum = next;
+    }
+    return d_first;
+  }
+} // namespace numeric_helper
+} // namespace portable_stl
+
+#endif // PSTL_UNROLLED_REDUCE_H
@@ -0,0 +1,592 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="indexed_priority_queue.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_INDEXED_PRIORITY_QUEUE_H
+#define PSTL_INDEXED_PRIORITY_QUEUE_H
+
+#include "../common/numeric_limits.h"
+#include "../common/size_t.h"
+#include "../error/portable_stl_error.h"
+#include "../functional/less.h"
+#include "../memory/addressof.h"
+#include "../memory/allocator.h"
+#include "../memory/allocator_traits.h"
+#include "../memory/construct_at.h"
+#include "../memory/destroy_at.h"
+#include "../memory/rebind_alloc.h"
+#include "../metaprogramming/type_properties/is_nothrow_move_constructible.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/in_place_t.h"
+#include "../utility/general/move.h"
+#include "../vector/vector.h"
+
+namespace portable_stl {
+namespace queue_helper {
+  /**
+   * @brief Storage of one element of indexed_priority_queue. The element is alive only while its handle is in use, so
+   * removing the element destroys it and reusing the handle constructs the new element in place.
+   *
+   * @tparam t_type the type of the element.
+   */
+  template<class t_type> class indexed_slot final {
+    /**
+     * @brief The element storage, the lifetime of the element is handled by the slot.
+     */
+    union {
+      /**
+       * @brief The element.
+       */
+      t_type m_value;
+    };
+
+    /**
+     * @brief The element is alive.
+     */
+    bool m_engaged;
+
+  public:
+    /**
+     * @brief Constructs the empty slot.
+     */
+    indexed_slot() noexcept : m_engaged(false) {
+    }
+
+    /**
+     * @brief Constructs the slot with the element constructed from args.
+     * @tparam t_args Types of the arguments.
+     * @param args Arguments to forward to the constructor of the element.
+     */
+    template<class... t_args>
+    explicit indexed_slot(::portable_stl::in_place_t, t_args &&...args)
+        : m_value(::portable_stl::forward<t_args>(args)...), m_engaged(true) {
+    }
+
+    /**
+     * @brief Copy constructor, copies the element if other has one.
+     * @param other the slot to copy.
+     */
+    indexed_slot(indexed_slot const &other) : m_engaged(false) {
+      if (other.m_engaged) {
+        emplace(other.m_value);
+      }
+    }
+
+    /**
+     * @brief Move constructor, moves the element if other has one.
+     * @param other the slot to move.
+     */
+    indexed_slot(indexed_slot &&other) noexcept(::portable_stl::is_nothrow_move_constructible<t_type>{}())
+        : m_engaged(false) {
+      if (other.m_engaged) {
+        emplace(::portable_stl::move(other.m_value));
+      }
+    }
+
+    /**
+     * @brief Destroys the element if the slot has one.
+     */
+    ~indexed_slot() {
+      reset();
+    }
+
+    /**
+     * @brief Copy assignment, the element is copy constructed in place of the old one.
+     * @param other the slot to copy.
+     * @return *this.
+     */
+    indexed_slot &operator=(indexed_slot const &other) {
+      if (this != &other) {
+        reset();
+        if (other.m_engaged) {
+          emplace(other.m_value);
+        }
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Move assignment, the element is move constructed in place of the old one.
+     * @param other the slot to move.
+     * @return *this.
+     */
+    indexed_slot &operator=(indexed_slot &&other) noexcept(
+      ::portable_stl::is_nothrow_move_constructible<t_type>{}()) {
+      if (this != &other) {
+        reset();
+        if (other.m_engaged) {
+          emplace(::portable_stl::move(other.m_value));
+        }
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Constructs the element from args in the empty slot.
+     * UB: the slot has the element.
+     * @tparam t_args Types of the arguments.
+     * @param args Arguments to forward to the constructor of the element.
+     */
+    template<class... t_args> void emplace(t_args &&...args) {
+      static_cast<void>(
+        ::portable_stl::construct_at(::portable_stl::addressof(m_value), ::portable_stl::forward<t_args>(args)...));
+      m_engaged = true;
+    }
+
+    /**
+     * @brief Destroys the element if the slot has one.
+     */
+    void reset() noexcept {
+      if (m_engaged) {
+        m_engaged = false;
+        ::portable_stl::destroy_at(::portable_stl::addressof(m_value));
+      }
+    }
+
+    /**
+     * @brief Returns the element.
+     * UB: the slot is empty.
+     * @return Reference to the element.
+     */
+    t_type &value() noexcept {
+      return m_value;
+    }
+
+    /**
+     * @brief Returns the element.
+     * UB: the slot is empty.
+     * @return Reference to the element.
+     */
+    t_type const &value() const noexcept {
+      return m_value;
+    }
+  };
+} // namespace queue_helper
+
+/**
+ * @brief Priority queue with stable handles to the elements.
+ * The handle returned by push() stays valid until the element is removed, so the element priority can be changed with
+ * decrease_key()/increase_key()/update() and the element can be removed with erase() in O(log n).
+ * Values are never moved inside the queue: the t_arity-ary heap stores handles only. Removed elements are destroyed at
+ * once, their handles are reused by next insertions which construct the new elements in place. Memory for bookkeeping
+ * is reserved on insertion, so erase() and pop() do not allocate.
+ *
+ * @tparam t_type The type of the stored elements.
+ * @tparam t_compare A Compare type providing a strict weak ordering. The top element is the largest one.
+ * @tparam t_allocator An allocator that is used to acquire/release memory, rebound to the element slots.
+ * @tparam t_arity The number of children of the heap node.
+ */
+template<class t_type,
+         class t_compare               = ::portable_stl::less<t_type>,
+         class t_allocator             = ::portable_stl::allocator<t_type>,
+         ::portable_stl::size_t t_arity = 4U>
+class indexed_priority_queue final {
+  static_assert(t_arity >= 2U, "portable_stl::indexed_priority_queue arity must be at least 2");
+
+public:
+  /**
+   * @brief Value type.
+   */
+  using value_type      = t_type;
+  /**
+   * @brief Compare type.
+   */
+  using value_compare   = t_compare;
+  /**
+   * @brief Allocator type.
+   */
+  using allocator_type  = t_allocator;
+  /**
+   * @brief Size type.
+   */
+  using size_type       = ::portable_stl::size_t;
+  /**
+   * @brief Handle to the element.
+   */
+  using handle_type     = size_type;
+  /**
+   * @brief Const reference type.
+   */
+  using const_reference = value_type const &;
+
+  /**
+   * @brief Invalid handle value.
+   */
+  static constexpr handle_type npos{::portable_stl::numeric_limits<handle_type>::max()};
+
+private:
+  /**
+   * @brief Allocator for handles.
+   */
+  using t_handle_allocator
+    = ::portable_stl::rebind_alloc<::portable_stl::allocator_traits<allocator_type>, handle_type>;
+
+  /**
+   * @brief Container of handles.
+   */
+  using t_handle_vector = ::portable_stl::vector<handle_type, t_handle_allocator>;
+
+  /**
+   * @brief Storage of one element.
+   */
+  using t_slot = ::portable_stl::queue_helper::indexed_slot<value_type>;
+
+  /**
+   * @brief Allocator for element slots.
+   */
+  using t_slot_allocator = ::portable_stl::rebind_alloc<::portable_stl::allocator_traits<allocator_type>, t_slot>;
+
+  /**
+   * @brief Values indexed by handle, the slots of free handles are empty.
+   */
+  ::portable_stl::vector<t_slot, t_slot_allocator> m_values;
+
+  /**
+   * @brief Handles in heap order.
+   */
+  t_handle_vector m_heap;
+
+  /**
+   * @brief Heap position indexed by handle, npos for free handles.
+   */
+  t_handle_vector m_position;
+
+  /**
+   * @brief Free handles.
+   */
+  t_handle_vector m_free;
+
+  /**
+   * @brief The comparison function object.
+   */
+  value_compare m_comp;
+
+  /**
+   * @brief Compares elements at the heap positions.
+   * @param lhv_pos the first heap position.
+   * @param rhv_pos the second heap position.
+   * @return true if the element at lhv_pos has lower priority.
+   */
+  bool M_less(size_type lhv_pos, size_type rhv_pos) const {
+    return m_comp(m_values[m_heap[lhv_pos]].value(), m_values[m_heap[rhv_pos]].value());
+  }
+
+  /**
+   * @brief Moves the element at the heap position up to restore the heap property.
+   * @param pos the heap position.
+   * @return the new heap position.
+   */
+  size_type M_sift_up(size_type pos) {
+    handle_type const handle{m_heap[pos]};
+    while (pos > 0U) {
+      size_type const parent{(pos - 1U) / t_arity};
+      if (!m_comp(m_values[m_heap[parent]].value(), m_values[handle].value())) {
+        break;
+      }
+      m_heap[pos]             = m_heap[parent];
+      m_position[m_heap[pos]] = pos;
+      pos                     = parent;
+    }
+    m_heap[pos]        = handle;
+    m_position[handle] = pos;
+    return pos;
+  }
+
+  /**
+   * @brief Moves the element at the heap position down to restore the heap property.
+   * @param pos the heap position.
+   */
+  void M_sift_down(size_type pos) {
+    size_type const   len{m_heap.size()};
+    handle_type const handle{m_heap[pos]};
+    for (;;) {
+      size_type child{pos * t_arity + 1U};
+      if (child >= len) {
+        break;
+      }
+      size_type const last{((len - child) > t_arity) ? (child + t_arity) : len};
+      for (size_type next{child + 1U}; next < last; ++next) {
+        if (M_less(child, next)) {
+          child = next;
+        }
+      }
+      if (!m_comp(m_values[handle].value(), m_values[m_heap[child]].value())) {
+        break;
+      }
+      m_heap[pos]             = m_heap[child];
+      m_position[m_heap[pos]] = pos;
+      pos                     = child;
+    }
+    m_heap[pos]        = handle;
+    m_position[handle] = pos;
+  }
+
+  /**
+   * @brief Restores the heap property for the element at the heap position after its value change.
+   * @param pos the heap position.
+   */
+  void M_restore(size_type pos) {
+    if (M_sift_up(pos) == pos) {
+      M_sift_down(pos);
+    }
+  }
+
+  /**
+   * @brief Allocates a handle for a new element, reserves bookkeeping memory.
+   * @tparam t_args Types of the arguments.
+   * @param args Arguments to forward to the constructor of the element.
+   * @return New handle or error.
+   */
+  template<class... t_args>
+  ::portable_stl::expected<handle_type, ::portable_stl::portable_stl_error> M_new_handle(t_args &&...args) {
+    if (!m_free.empty()) {
+      handle_type const handle{m_free.back()};
+      m_values[handle].emplace(::portable_stl::forward<t_args>(args)...);
+      m_free.pop_back();
+      return ::portable_stl::expected<handle_type, ::portable_stl::portable_stl_error>(handle);
+    }
+
+    handle_type const handle{m_values.size()};
+    auto value_result = m_values.emplace_back(::portable_stl::in_place_t{}, ::portable_stl::forward<t_args>(args)...);
+    if (!value_result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{value_result.error()};
+    }
+    auto position_result = m_position.push_back(npos);
+    if (!position_result) {
+      m_values.pop_back();
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{position_result.error()};
+    }
+    auto heap_result = m_heap.reserve(m_values.size());
+    auto free_result = heap_result ? m_free.reserve(m_values.size()) : heap_result;
+    if (!free_result) {
+      m_position.pop_back();
+      m_values.pop_back();
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{free_result.error()};
+    }
+    return ::portable_stl::expected<handle_type, ::portable_stl::portable_stl_error>(handle);
+  }
+
+public:
+  /**
+   * @brief Default constructor.
+   */
+  indexed_priority_queue() : m_values(), m_heap(), m_position(), m_free(), m_comp() {
+  }
+
+  /**
+   * @brief Constructs an empty queue with the given comparison functor.
+   * @param comp The comparison function object.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   */
+  explicit indexed_priority_queue(value_compare const &comp, allocator_type const &alloc = allocator_type())
+      : m_values(t_slot_allocator(alloc)), m_heap(t_handle_allocator(alloc)), m_position(t_handle_allocator(alloc)),
+        m_free(t_handle_allocator(alloc)), m_comp(comp) {
+  }
+
+  // [element access]
+
+  /**
+   * @brief Returns reference to the top element.
+   * UB: Calling top on an empty container.
+   * @return Reference to the top element.
+   */
+  const_reference top() const noexcept {
+    return m_values[m_heap.front()].value();
+  }
+
+  /**
+   * @brief Returns handle of the top element.
+   * UB: Calling top_handle on an empty container.
+   * @return Handle of the top element.
+   */
+  handle_type top_handle() const noexcept {
+    return m_heap.front();
+  }
+
+  /**
+   * @brief Checks if the handle refers to the element in the queue.
+   * @param handle the handle to check.
+   * @return true if the element is in the queue.
+   */
+  bool contains(handle_type handle) const noexcept {
+    return (handle < m_position.size()) && (npos != m_position[handle]);
+  }
+
+  /**
+   * @brief Returns reference to the element by handle.
+   * UB: Calling value with a handle of the removed element.
+   * @param handle the handle of the element.
+   * @return Reference to the element.
+   */
+  const_reference value(handle_type handle) const noexcept {
+    return m_values[handle].value();
+  }
+
+  // [capacity]
+
+  /**
+   * @brief Checks if the queue has no elements.
+   * @return true if the queue is empty, false otherwise.
+   */
+  bool empty() const noexcept {
+    return m_heap.empty();
+  }
+
+  /**
+   * @brief Returns the number of elements in the queue.
+   * @return The number of elements.
+   */
+  size_type size() const noexcept {
+    return m_heap.size();
+  }
+
+  // [modifiers]
+
+  /**
+   * @brief Pushes a new element constructed from args to the queue.
+   * @tparam t_args Types of the arguments.
+   * @param args Arguments to forward to the constructor of the element.
+   * @return Handle of the new element or error if memory cannot be allocated.
+   */
+  template<class... t_args>
+  ::portable_stl::expected<handle_type, ::portable_stl::portable_stl_error> emplace(t_args &&...args) {
+    auto result = M_new_handle(::portable_stl::forward<t_args>(args)...);
+    if (result) {
+      // capacity is reserved in M_new_handle
+      static_cast<void>(m_heap.push_back(result.value()));
+      static_cast<void>(M_sift_up(m_heap.size() - 1U));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Pushes the given element value to the queue.
+   * @param value The value of the element to push.
+   * @return Handle of the new element or error if memory cannot be allocated.
+   */
+  ::portable_stl::expected<handle_type, ::portable_stl::portable_stl_error> push(value_type const &value) {
+    return emplace(value);
+  }
+
+  /**
+   * @brief Pushes the given element value to the queue.
+   * @param value The value of the element to push.
+   * @return Handle of the new element or error if memory cannot be allocated.
+   */
+  ::portable_stl::expected<handle_type, ::portable_stl::portable_stl_error> push(value_type &&value) {
+    return emplace(::portable_stl::move(value));
+  }
+
+  /**
+   * @brief Removes and destroys the top element.
+   * UB: Calling pop on an empty container.
+   */
+  void pop() {
+    static_cast<void>(erase(m_heap.front()));
+  }
+
+  /**
+   * @brief Removes and destroys the element by handle. The handle becomes invalid.
+   * @param handle the handle of the element.
+   * @return portable_stl_error::out_of_range if the handle does not refer to the element in the queue.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> erase(handle_type handle) {
+    if (!contains(handle)) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::out_of_range};
+    }
+    size_type const pos{m_position[handle]};
+    size_type const last{m_heap.size() - 1U};
+    m_position[handle] = npos;
+    m_values[handle].reset();
+    // capacity is reserved in M_new_handle
+    static_cast<void>(m_free.push_back(handle));
+    if (pos != last) {
+      m_heap[pos] = m_heap[last];
+      m_heap.pop_back();
+      M_restore(pos);
+    } else {
+      m_heap.pop_back();
+    }
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Replaces the element value by a smaller or equal one (e.g. the shorter distance in Dijkstra's algorithm).
+   * The element moves towards the top with the greater<> comparison and towards the bottom with the default less<>.
+   * @param handle the handle of the element.
+   * @param value the new value.
+   * @return portable_stl_error::out_of_range if the handle does not refer to the element in the queue.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> decrease_key(handle_type       handle,
+                                                                                  value_type const &value) {
+    if (!contains(handle)) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::out_of_range};
+    }
+    m_values[handle].value() = value;
+    M_restore(m_position[handle]);
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Replaces the element value by a greater or equal one.
+   * The element moves towards the top with the default less<> comparison and towards the bottom with greater<>.
+   * @param handle the handle of the element.
+   * @param value the new value.
+   * @return portable_stl_error::out_of_range if the handle does not refer to the element in the queue.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> increase_key(handle_type       handle,
+                                                                                  value_type const &value) {
+    if (!contains(handle)) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::out_of_range};
+    }
+    m_values[handle].value() = value;
+    M_restore(m_position[handle]);
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Replaces the element value by an arbitrary one.
+   * @param handle the handle of the element.
+   * @param value the new value.
+   * @return portable_stl_error::out_of_range if the handle does not refer to the element in the queue.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> update(handle_type       handle,
+                                                                            value_type const &value) {
+    if (!contains(handle)) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::out_of_range};
+    }
+    m_values[handle].value() = value;
+    M_restore(m_position[handle]);
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Removes all elements. All handles become invalid.
+   */
+  void clear() noexcept {
+    m_heap.clear();
+    m_position.clear();
+    m_free.clear();
+    m_values.clear();
+  }
+};
+
+template<class t_type, class t_compare, class t_allocator, ::portable_stl::size_t t_arity>
+constexpr typename indexed_priority_queue<t_type, t_compare, t_allocator, t_arity>::handle_type
+  indexed_priority_queue<t_type, t_compare, t_allocator, t_arity>::npos;
+} // namespace portable_stl
+
+#endif // PSTL_INDEXED_PRIORITY_QUEUE_H
@@ -0,0 +1,268 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="priority_queue.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_PRIORITY_QUEUE_H
+#define PSTL_PRIORITY_QUEUE_H
+
+#include "../algorithm/heap_sift.h"
+#include "../common/size_t.h"
+#include "../error/portable_stl_error.h"
+#include "../functional/less.h"
+#include "../metaprogramming/type_relations/is_same.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "../utility/general/swap.h"
+#include "../vector/vector.h"
+
+namespace portable_stl {
+
+/**
+ * @brief A container adaptor that provides constant time lookup of the largest (by default) element, at the expense
+ * of logarithmic insertion and extraction.
+ * Elements are kept in the t_arity-ary heap. The default 4-ary heap is shallower than the binary one and touches
+ * fewer cache lines per operation.
+ *
+ * @tparam t_type The type of the stored elements.
+ * @tparam t_container The type of the underlying container to use to store the elements. Must provide random access
+ * iterators and front(), push_back(), emplace_back(), pop_back() functions.
+ * @tparam t_compare A Compare type providing a strict weak ordering.
+ * @tparam t_arity The number of children of the heap node.
+ */
+template<class t_type,
+         class t_container             = ::portable_stl::vector<t_type>,
+         class t_compare               = ::portable_stl::less<typename t_container::value_type>,
+         ::portable_stl::size_t t_arity = 4U>
+class priority_queue final {
+  static_assert(::portable_stl::is_same<t_type, typename t_container::value_type>{}(),
+                "portable_stl::priority_queue must have the same value_type as its container");
+  static_assert(t_arity >= 2U, "portable_stl::priority_queue arity must be at least 2");
+
+public:
+  /**
+   * @brief Container type.
+   */
+  using container_type  = t_container;
+  /**
+   * @brief Compare type.
+   */
+  using value_compare   = t_compare;
+  /**
+   * @brief Value type.
+   */
+  using value_type      = typename container_type::value_type;
+  /**
+   * @brief Size type.
+   */
+  using size_type       = typename container_type::size_type;
+  /**
+   * @brief Reference type.
+   */
+  using reference       = typename container_type::reference;
+  /**
+   * @brief Const reference type.
+   */
+  using const_reference = typename container_type::const_reference;
+
+private:
+  /**
+   * @brief The underlying container.
+   */
+  container_type m_container;
+
+  /**
+   * @brief The comparison function object.
+   */
+  value_compare m_comp;
+
+public:
+  /**
+   * @brief Default constructor. Value-initializes the underlying container and the comparison functor.
+   */
+  priority_queue() : m_container(), m_comp() {
+  }
+
+  /**
+   * @brief Constructs an empty queue with the given comparison functor.
+   * @param comp The comparison function object to initialize the underlying comparison functor.
+   */
+  explicit priority_queue(value_compare const &comp) : m_container(), m_comp(comp) {
+  }
+
+  /**
+   * @brief Copy-constructs the underlying container with the contents of cont and makes the heap from it.
+   * @param comp The comparison function object to initialize the underlying comparison functor.
+   * @param cont Container to be used as source to initialize the underlying container.
+   */
+  priority_queue(value_compare const &comp, container_type const &cont) : m_container(cont), m_comp(comp) {
+    M_make_heap();
+  }
+
+  /**
+   * @brief Move-constructs the underlying container with cont and makes the heap from it.
+   * @param comp The comparison function object to initialize the underlying comparison functor.
+   * @param cont Container to be used as source to initialize the underlying container.
+   */
+  priority_queue(value_compare const &comp, container_type &&cont)
+      : m_container(::portable_stl::move(cont)), m_comp(comp) {
+    M_make_heap();
+  }
+
+  /**
+   * @brief Constructs the underlying container from the range [first, last) and makes the heap from it.
+   * @tparam t_input_iterator Satisfies LegacyInputIterator.
+   * @param first The range of elements to initialize with.
+   * @param last The range of elements to initialize with.
+   * @param comp The comparison function object to initialize the underlying comparison functor.
+   */
+  template<class t_input_iterator>
+  priority_queue(t_input_iterator first, t_input_iterator last, value_compare const &comp = value_compare())
+      : m_container(first, last), m_comp(comp) {
+    M_make_heap();
+  }
+
+  // [element access]
+
+  /**
+   * @brief Returns reference to the top element in the priority queue.
+   * UB: Calling top on an empty container.
+   * @return Reference to the top element.
+   */
+  const_reference top() const noexcept {
+    return m_container.front();
+  }
+
+  // [capacity]
+
+  /**
+   * @brief Checks if the underlying container has no elements.
+   * @return true if the underlying container is empty, false otherwise.
+   */
+  bool empty() const noexcept {
+    return m_container.empty();
+  }
+
+  /**
+   * @brief Returns the number of elements in the underlying container.
+   * @return The number of elements in the container.
+   */
+  size_type size() const noexcept {
+    return m_container.size();
+  }
+
+  // [modifiers]
+
+  /**
+   * @brief Pushes the given element value to the priority queue.
+   * @param value The value of the element to push.
+   * @return Error if the underlying container fails to store the element.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> push(value_type const &value) {
+    auto result = m_container.push_back(value);
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    M_sift_up();
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Pushes the given element value to the priority queue.
+   * @param value The value of the element to push.
+   * @return Error if the underlying container fails to store the element.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> push(value_type &&value) {
+    auto result = m_container.push_back(::portable_stl::move(value));
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    M_sift_up();
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Pushes a new element constructed in-place from args to the priority queue.
+   * @tparam t_args Types of the arguments.
+   * @param args Arguments to forward to the constructor of the element.
+   * @return Error if the underlying container fails to store the element.
+   */
+  template<class... t_args>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> emplace(t_args &&...args) {
+    auto result = m_container.emplace_back(::portable_stl::forward<t_args>(args)...);
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    M_sift_up();
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Removes the top element from the priority queue.
+   * UB: Calling pop on an empty container.
+   */
+  void pop() {
+    ::portable_stl::algorithm_helper::pop_heap_impl<t_arity>(
+      m_container.begin(), m_comp, static_cast<difference_type>(m_container.size()));
+    m_container.pop_back();
+  }
+
+  /**
+   * @brief Exchanges the contents of the container adaptor with those of other.
+   * @param other Container adaptor to exchange the contents with.
+   */
+  void swap(priority_queue &other) noexcept {
+    using ::portable_stl::swap;
+    swap(m_container, other.m_container);
+    swap(m_comp, other.m_comp);
+  }
+
+private:
+  /**
+   * @brief Difference type of the underlying container.
+   */
+  using difference_type = typename container_type::difference_type;
+
+  /**
+   * @brief Makes the heap from the underlying container.
+   */
+  void M_make_heap() {
+    ::portable_stl::algorithm_helper::make_heap_impl<t_arity>(
+      m_container.begin(), m_comp, static_cast<difference_type>(m_container.size()));
+  }
+
+  /**
+   * @brief Moves the last element of the underlying container up to its heap position.
+   */
+  void M_sift_up() {
+    ::portable_stl::algorithm_helper::sift_up<t_arity>(
+      m_container.begin(), m_comp, static_cast<difference_type>(m_container.size()));
+  }
+};
+
+/**
+ * @brief Specializes the swap algorithm for priority_queue.
+ *
+ * @tparam t_type The type of the stored elements.
+ * @tparam t_container The type of the underlying container.
+ * @tparam t_compare A Compare type.
+ * @tparam t_arity The number of children of the heap node.
+ * @param lhv Container adaptor whose contents to swap.
+ * @param rhv Container adaptor whose contents to swap.
+ */
+template<class t_type, class t_container, class t_compare, ::portable_stl::size_t t_arity>
+void swap(priority_queue<t_type, t_container, t_compare, t_arity> &lhv,
+          priority_queue<t_type, t_container, t_compare, t_arity> &rhv) noexcept {
+  lhv.swap(rhv);
+}
+} // namespace portable_stl
+
+#endif // PSTL_PRIORITY_QUEUE_H
@@ -0,0 +1,111 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="all.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_ALL_H
+#define PSTL_ALL_H
+
+#include "../metaprogramming/logical_operator/conjunction.h"
+#include "../metaprogramming/logical_operator/negation.h"
+#include "../metaprogramming/other_transformations/enable_if_bool_constant.h"
+#include "../metaprogramming/other_transformations/remove_cvref.h"
+#include "../metaprogramming/primary_type/is_lvalue_reference.h"
+#include "../metaprogramming/reference_modifications/remove_reference.h"
+#include "../utility/general/declval.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "concepts/enable_view.h"
+#include "owning_view.h"
+#include "range_adaptor.h"
+#include "ref_view.h"
+
+namespace portable_stl {
+namespace ranges {
+  namespace ranges_helper {
+    /**
+     * @brief views::all implementation.
+     */
+    class all_fn final {
+    public:
+      /**
+       * @brief The view is copied.
+       * @tparam t_range the type of the view.
+       * @param range the view.
+       * @return the copy of the view.
+       */
+      template<class t_range,
+               ::portable_stl::enable_if_bool_constant_t<
+                 ::portable_stl::ranges::enable_view_bool_constant<::portable_stl::remove_cvref_t<t_range>>,
+                 void *>
+               = nullptr>
+      constexpr ::portable_stl::remove_cvref_t<t_range> operator()(t_range &&range) const {
+        return ::portable_stl::forward<t_range>(range);
+      }
+
+      /**
+       * @brief The lvalue range is referred by ref_view.
+       * @tparam t_range the type of the range.
+       * @param range the range.
+       * @return the ref_view of the range.
+       */
+      template<class t_range,
+               ::portable_stl::enable_if_bool_constant_t<
+                 ::portable_stl::conjunction<::portable_stl::negation<::portable_stl::ranges::enable_view_bool_constant<
+                                               ::portable_stl::remove_cvref_t<t_range>>>,
+                                             ::portable_stl::is_lvalue_reference<t_range>>,
+                 void *>
+               = nullptr>
+      constexpr ::portable_stl::ranges::ref_view<::portable_stl::remove_reference_t<t_range>> operator()(
+        t_range &&range) const noexcept {
+        return ::portable_stl::ranges::ref_view<::portable_stl::remove_reference_t<t_range>>(range);
+      }
+
+      /**
+       * @brief The rvalue range is moved to owning_view.
+       * @tparam t_range the type of the range.
+       * @param range the range.
+       * @return the owning_view of the range.
+       */
+      template<class t_range,
+               ::portable_stl::enable_if_bool_constant_t<
+                 ::portable_stl::conjunction<::portable_stl::negation<::portable_stl::ranges::enable_view_bool_constant<
+                                               ::portable_stl::remove_cvref_t<t_range>>>,
+                                             ::portable_stl::negation<::portable_stl::is_lvalue_reference<t_range>>>,
+                 void *>
+               = nullptr>
+      constexpr ::portable_stl::ranges::owning_view<::portable_stl::remove_cvref_t<t_range>> operator()(
+        t_range &&range) const {
+        return ::portable_stl::ranges::owning_view<::portable_stl::remove_cvref_t<t_range>>(
+          ::portable_stl::move(range));
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Returns the view of all elements of the range: the copy of the view, ref_view of the lvalue range or
+       * owning_view of the rvalue range.
+       */
+      constexpr auto const &all = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::range_adaptor_closure<::portable_stl::ranges::ranges_helper::all_fn>>::value;
+    } // namespace
+
+    /**
+     * @brief Type of the view returned by views::all for the range of t_range type.
+     * @tparam t_range the type of the range.
+     */
+    template<class t_range>
+    using all_t = decltype(::portable_stl::ranges::views::all(::portable_stl::declval<t_range>()));
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_ALL_H */
@@ -0,0 +1,250 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="chunk_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_CHUNK_VIEW_H
+#define PSTL_CHUNK_VIEW_H
+
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "all.h"
+#include "begin.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "range_adaptor.h"
+#include "subrange.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the consecutive subranges of count elements of the underlying view, the last subrange may be
+   * shorter. The iterator keeps the bounds of the current subrange and the pointer to the view, so the view must
+   * outlive its iterators. The iterator is forward.
+   * @tparam t_view the type of the underlying common forward view.
+   */
+  template<class t_view> class chunk_view final : public ::portable_stl::ranges::view_interface<chunk_view<t_view>> {
+    /**
+     * @brief Underlying iterator type.
+     */
+    using t_base_iterator = ::portable_stl::ranges::iterator_t<t_view const>;
+
+    /**
+     * @brief Underlying difference type.
+     */
+    using t_difference = typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type;
+
+    /**
+     * @brief Underlying view.
+     */
+    t_view       m_base;
+    /**
+     * @brief Number of elements in the subrange.
+     */
+    t_difference m_count;
+
+    /**
+     * @brief Finds the end of the subrange.
+     * @param current the beginning of the subrange.
+     * @return the end of the subrange.
+     */
+    constexpr t_base_iterator M_next(t_base_iterator current) const {
+      return ranges_helper::bounded_next(::portable_stl::move(current), m_count, ::portable_stl::ranges::end(m_base));
+    }
+
+  public:
+    /**
+     * @brief Difference type.
+     */
+    using difference_type = t_difference;
+
+    /**
+     * @brief Iterator of the chunk_view.
+     */
+    class iterator final : public ranges_helper::view_iterator_operators<iterator, t_difference> {
+      /**
+       * @brief The view constructs its iterators.
+       */
+      friend chunk_view;
+
+      /**
+       * @brief The view.
+       */
+      chunk_view const *m_parent{nullptr};
+      /**
+       * @brief Beginning of the current subrange.
+       */
+      t_base_iterator   m_current{};
+      /**
+       * @brief End of the current subrange.
+       */
+      t_base_iterator   m_next{};
+
+      /**
+       * @brief Constructs the iterator.
+       * @param parent the view.
+       * @param current the beginning of the subrange.
+       * @param next the end of the subrange.
+       */
+      constexpr iterator(chunk_view const *parent, t_base_iterator current, t_base_iterator next)
+          : m_parent(parent), m_current(::portable_stl::move(current)), m_next(::portable_stl::move(next)) {
+      }
+
+    public:
+      /**
+       * @brief Iterator category.
+       */
+      using iterator_category = ::portable_stl::forward_iterator_tag;
+      /**
+       * @brief Value type: the subrange of the underlying view.
+       */
+      using value_type        = ::portable_stl::ranges::subrange<t_base_iterator>;
+      /**
+       * @brief Difference type.
+       */
+      using difference_type   = t_difference;
+      /**
+       * @brief Pointer type.
+       */
+      using pointer           = void;
+      /**
+       * @brief Reference type: the subrange is returned.
+       */
+      using reference         = value_type;
+
+      /**
+       * @brief Default constructor.
+       */
+      constexpr iterator() = default;
+
+      /**
+       * @brief Returns the beginning of the current subrange.
+       * @return the underlying iterator.
+       */
+      constexpr t_base_iterator base() const {
+        return m_current;
+      }
+
+      /**
+       * @brief Dereferences the iterator.
+       * @return the current subrange.
+       */
+      constexpr value_type operator*() const {
+        return value_type(m_current, m_next);
+      }
+
+      /**
+       * @brief Moves to the next subrange.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator++() {
+        m_current = m_next;
+        m_next    = m_parent->M_next(m_current);
+        return *this;
+      }
+
+      /**
+       * @brief Equality comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the iterators refer to the same subrange.
+       */
+      friend constexpr bool operator==(iterator const &left, iterator const &right) {
+        return left.m_current == right.m_current;
+      }
+    };
+
+    /**
+     * @brief Constructs the view.
+     * UB: count <= 0.
+     * @param base the underlying view.
+     * @param count the number of elements in the subrange.
+     */
+    constexpr chunk_view(t_view base, difference_type count) : m_base(::portable_stl::move(base)), m_count(count) {
+    }
+
+    /**
+     * @brief Returns the underlying view.
+     * @return the underlying view.
+     */
+    constexpr t_view const &base() const noexcept {
+      return m_base;
+    }
+
+    /**
+     * @brief Returns an iterator to the first subrange.
+     * @return the iterator to the first subrange.
+     */
+    constexpr iterator begin() const {
+      t_base_iterator first{::portable_stl::ranges::begin(m_base)};
+      return iterator(this, first, M_next(first));
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator end() const {
+      t_base_iterator last{::portable_stl::ranges::end(m_base)};
+      return iterator(this, last, last);
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::chunk implementation.
+     */
+    class chunk_fn final {
+    public:
+      /**
+       * @brief Makes chunk_view of the range.
+       * @tparam t_range the type of the range.
+       * @tparam t_count the type of the number of elements.
+       * @param range the range.
+       * @param count the number of elements in the subrange.
+       * @return the view.
+       */
+      template<class t_range, class t_count>
+      constexpr ::portable_stl::ranges::chunk_view<::portable_stl::ranges::views::all_t<t_range>> operator()(
+        t_range &&range, t_count count) const {
+        using t_view = ::portable_stl::ranges::chunk_view<::portable_stl::ranges::views::all_t<t_range>>;
+        return t_view(::portable_stl::ranges::views::all(::portable_stl::forward<t_range>(range)),
+                      static_cast<typename t_view::difference_type>(count));
+      }
+
+      /**
+       * @brief Makes the closure applicable with the pipe syntax.
+       * @tparam t_count the type of the number of elements.
+       * @param count the number of elements in the subrange.
+       * @return the closure.
+       */
+      template<class t_count> constexpr bound_closure_t<chunk_fn, t_count> operator()(t_count count) const {
+        return bind_adaptor<chunk_fn>(count);
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the subranges of count elements: views::chunk(range, count) or
+       * range | views::chunk(count).
+       */
+      constexpr auto const &chunk = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::chunk_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_CHUNK_VIEW_H */
@@ -18,6 +18,7 @@
 #include "../../metaprogramming/cv_modifications/remove_cv.h"
 #include "../../metaprogramming/logical_operator/conjunction.h"
 #include "../../metaprogramming/logical_operator/disjunction.h"
+#include "../../metaprogramming/other_transformations/remove_cvref.h"
 #include "../../metaprogramming/primary_type/is_class.h"
 #include "../../metaprogramming/type_relations/is_convertible.h"
 #include "../iterator_t.h"
@@ -37,7 +38,7 @@ namespace ranges {
   template<class derived_type,
            class = ::portable_stl::enable_if_bool_constant_t<::portable_stl::conjunction<
              ::portable_stl::is_class<derived_type>,
-             ::portable_stl::same_as<derived_type, ::portable_stl::remove_cv<derived_type>>>>>
+             ::portable_stl::same_as<derived_type, ::portable_stl::remove_cv_t<derived_type>>>>>
   class view_interface;
 
   namespace ranges_helper {
@@ -49,11 +50,24 @@ namespace ranges {
     void is_derived_from_view_interface(t_type const *, view_interface<u_type> const *);
 
     template<class t_type> class is_derived_from_view_interface_impl final {
-      template<class T1>::portable_stl::true_type  test(T1 const *, view_interface<T2> const *);
-      template<class T1>::portable_stl::false_type test(...);
+      /**
+       * @brief Test function.
+       * @tparam t_derived the derived type of the view_interface specialization.
+       * @return ::portable_stl::true_type
+       */
+      template<class t_derived> static ::portable_stl::true_type test(view_interface<t_derived> const *);
+
+      /**
+       * @brief Test function.
+       * @return ::portable_stl::false_type
+       */
+      static ::portable_stl::false_type test(...);
 
     public:
-      using type = decltype(test<t_type>(static_cast<t_type *>(nullptr), static_cast<t_type *>(nullptr)));
+      /**
+       * @brief Result type.
+       */
+      using type = decltype(test(static_cast<::portable_stl::remove_cvref_t<t_type> *>(nullptr)));
     };
 
     template<class t_type>
@@ -67,12 +81,6 @@ namespace ranges {
    */
   template<class range_type> using enable_view_bool_constant = ranges_helper::enable_view_impl<range_type>;
 
-  /**
-   * @brief The enable_view variable template is used to indicate whether a range is a view.
-   * @tparam range_type
-   */
-  template<class range_type> constexpr inline bool enable_view = enable_view_bool_constant<range_type>{}();
-
 } // namespace ranges
 } // namespace portable_stl
 
@@ -0,0 +1,27 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="enable_view_v.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_ENABLE_VIEW_V_H
+#define PSTL_ENABLE_VIEW_V_H
+
+#include "enable_view.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief The enable_view variable template is used to indicate whether a range is a view.
+   * @tparam range_type
+   */
+  template<class range_type> constexpr inline bool enable_view = enable_view_bool_constant<range_type>{}();
+} // namespace ranges
+} // namespace portable_stl
+
+#endif // PSTL_ENABLE_VIEW_V_H
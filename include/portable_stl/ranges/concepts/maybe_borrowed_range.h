@@ -47,7 +47,7 @@ namespace ranges {
   template<class range_type>
   using maybe_borrowed_range = ::portable_stl::disjunction<
     ::portable_stl::is_lvalue_reference<range_type>,
-    ranges_helper::enable_borrowed_range_bool_constant<::portable_stl::remove_cvref<range_type>>>;
+    ranges_helper::enable_borrowed_range_bool_constant<::portable_stl::remove_cvref_t<range_type>>>;
 
 } // namespace ranges
 } // namespace portable_stl
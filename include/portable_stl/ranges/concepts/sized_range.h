@@ -61,8 +61,8 @@ namespace ranges {
    * @tparam range_type Tested range type.
    */
   template<class range_type>
-  using sized_range = ::portable_stl::conjunction<::portable_stl::ranges::range<t_type>,
-                                                  typename ranges_helper::has_size<t_type>::type>;
+  using sized_range = ::portable_stl::conjunction<::portable_stl::ranges::range<range_type>,
+                                                  typename ranges_helper::has_size<range_type>::type>;
 
 } // namespace ranges
 } // namespace portable_stl
@@ -21,7 +21,7 @@ namespace portable_stl {
 namespace ranges {
 
   template<class range_type>
-  using view = ::portable_stl::conjunction<::portable_stl::range<range_type>,
+  using view = ::portable_stl::conjunction<::portable_stl::ranges::range<range_type>,
                                            ::portable_stl::movable<range_type>,
                                            ::portable_stl::ranges::enable_view_bool_constant<range_type>>;
 
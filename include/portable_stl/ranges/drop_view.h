@@ -0,0 +1,139 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="drop_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_DROP_VIEW_H
+#define PSTL_DROP_VIEW_H
+
+#include "../iterator/iterator_traits.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "all.h"
+#include "begin.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "range_adaptor.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the elements of the underlying view except the first count elements.
+   * The iterators are the iterators of the underlying view. begin() skips the elements on every call: in constant time
+   * for random access views and in linear time for the other views.
+   * @tparam t_view the type of the underlying common view.
+   */
+  template<class t_view> class drop_view final : public ::portable_stl::ranges::view_interface<drop_view<t_view>> {
+    /**
+     * @brief Underlying iterator type.
+     */
+    using t_base_iterator = ::portable_stl::ranges::iterator_t<t_view const>;
+
+  public:
+    /**
+     * @brief Difference type.
+     */
+    using difference_type = typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type;
+
+  private:
+    /**
+     * @brief Underlying view.
+     */
+    t_view          m_base;
+    /**
+     * @brief Number of the skipped elements.
+     */
+    difference_type m_count;
+
+  public:
+    /**
+     * @brief Constructs the view.
+     * UB: count < 0.
+     * @param base the underlying view.
+     * @param count the number of the skipped elements.
+     */
+    constexpr drop_view(t_view base, difference_type count) : m_base(::portable_stl::move(base)), m_count(count) {
+    }
+
+    /**
+     * @brief Returns the underlying view.
+     * @return the underlying view.
+     */
+    constexpr t_view const &base() const noexcept {
+      return m_base;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the view.
+     * @return the iterator to the first element.
+     */
+    constexpr t_base_iterator begin() const {
+      return ranges_helper::bounded_next(
+        ::portable_stl::ranges::begin(m_base), m_count, ::portable_stl::ranges::end(m_base));
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr t_base_iterator end() const {
+      return ::portable_stl::ranges::end(m_base);
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::drop implementation.
+     */
+    class drop_fn final {
+    public:
+      /**
+       * @brief Makes drop_view of the range.
+       * @tparam t_range the type of the range.
+       * @tparam t_count the type of the number of elements.
+       * @param range the range.
+       * @param count the number of the skipped elements.
+       * @return the view.
+       */
+      template<class t_range, class t_count>
+      constexpr ::portable_stl::ranges::drop_view<::portable_stl::ranges::views::all_t<t_range>> operator()(
+        t_range &&range, t_count count) const {
+        using t_view = ::portable_stl::ranges::drop_view<::portable_stl::ranges::views::all_t<t_range>>;
+        return t_view(::portable_stl::ranges::views::all(::portable_stl::forward<t_range>(range)),
+                      static_cast<typename t_view::difference_type>(count));
+      }
+
+      /**
+       * @brief Makes the closure applicable with the pipe syntax.
+       * @tparam t_count the type of the number of elements.
+       * @param count the number of the skipped elements.
+       * @return the closure.
+       */
+      template<class t_count> constexpr bound_closure_t<drop_fn, t_count> operator()(t_count count) const {
+        return bind_adaptor<drop_fn>(count);
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the elements except the first count elements: views::drop(range, count) or
+       * range | views::drop(count).
+       */
+      constexpr auto const &drop = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::drop_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_DROP_VIEW_H */
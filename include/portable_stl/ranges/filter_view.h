@@ -0,0 +1,273 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="filter_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_FILTER_VIEW_H
+#define PSTL_FILTER_VIEW_H
+
+#include "../iterator/bidirectional_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../metaprogramming/other_transformations/decay.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "all.h"
+#include "begin.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "range_adaptor.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the elements of the underlying view that satisfy the predicate.
+   * The elements are tested lazily while the view is iterated, begin() searches the first element on every call.
+   * The iterator keeps the base iterator and the pointer to the view, so the view must outlive its iterators.
+   * @tparam t_view the type of the underlying common view.
+   * @tparam t_predicate the type of the predicate, it is called as const.
+   */
+  template<class t_view, class t_predicate>
+  class filter_view final : public ::portable_stl::ranges::view_interface<filter_view<t_view, t_predicate>> {
+    /**
+     * @brief Underlying iterator type.
+     */
+    using t_base_iterator = ::portable_stl::ranges::iterator_t<t_view const>;
+
+    /**
+     * @brief Underlying view.
+     */
+    t_view      m_base;
+    /**
+     * @brief Predicate.
+     */
+    t_predicate m_predicate;
+
+    /**
+     * @brief Finds the first element satisfying the predicate in [current, end of the underlying view).
+     * @param current the start of the search.
+     * @return the iterator to the found element or the end of the underlying view.
+     */
+    constexpr t_base_iterator M_find(t_base_iterator current) const {
+      t_base_iterator const last{::portable_stl::ranges::end(m_base)};
+      while ((current != last) && (!m_predicate(*current))) {
+        ++current;
+      }
+      return current;
+    }
+
+  public:
+    /**
+     * @brief Iterator of the filter_view.
+     */
+    class iterator final
+        : public ranges_helper::view_iterator_operators<
+            iterator,
+            typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type> {
+      /**
+       * @brief The view constructs its iterators.
+       */
+      friend filter_view;
+
+      /**
+       * @brief Underlying iterator.
+       */
+      t_base_iterator    m_current{};
+      /**
+       * @brief The view.
+       */
+      filter_view const *m_parent{nullptr};
+
+      /**
+       * @brief Constructs the iterator.
+       * @param parent the view.
+       * @param current the underlying iterator.
+       */
+      constexpr iterator(filter_view const *parent, t_base_iterator current)
+          : m_current(::portable_stl::move(current)), m_parent(parent) {
+      }
+
+    public:
+      /**
+       * @brief Iterator category, at most bidirectional.
+       */
+      using iterator_category
+        = ranges_helper::limit_iterator_category<t_base_iterator, ::portable_stl::bidirectional_iterator_tag>;
+      /**
+       * @brief Value type.
+       */
+      using value_type      = typename ::portable_stl::iterator_traits<t_base_iterator>::value_type;
+      /**
+       * @brief Difference type.
+       */
+      using difference_type = typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type;
+      /**
+       * @brief Pointer type.
+       */
+      using pointer         = typename ::portable_stl::iterator_traits<t_base_iterator>::pointer;
+      /**
+       * @brief Reference type.
+       */
+      using reference       = typename ::portable_stl::iterator_traits<t_base_iterator>::reference;
+
+      /**
+       * @brief Default constructor.
+       */
+      constexpr iterator() = default;
+
+      /**
+       * @brief Returns the underlying iterator.
+       * @return the underlying iterator.
+       */
+      constexpr t_base_iterator base() const {
+        return m_current;
+      }
+
+      /**
+       * @brief Dereferences the iterator.
+       * @return the reference to the element.
+       */
+      constexpr reference operator*() const {
+        return *m_current;
+      }
+
+      /**
+       * @brief Accesses the element member.
+       * @return the underlying iterator.
+       */
+      constexpr t_base_iterator operator->() const {
+        return m_current;
+      }
+
+      /**
+       * @brief Moves to the next element satisfying the predicate.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator++() {
+        m_current = m_parent->M_find(++m_current);
+        return *this;
+      }
+
+      /**
+       * @brief Moves to the previous element satisfying the predicate.
+       * UB: there is no such element.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator--() {
+        do {
+          --m_current;
+        } while (!m_parent->m_predicate(*m_current));
+        return *this;
+      }
+
+      /**
+       * @brief Equality comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the underlying iterators are equal.
+       */
+      friend constexpr bool operator==(iterator const &left, iterator const &right) {
+        return left.m_current == right.m_current;
+      }
+    };
+
+    /**
+     * @brief Constructs the view.
+     * @param base the underlying view.
+     * @param predicate the predicate.
+     */
+    constexpr filter_view(t_view base, t_predicate predicate)
+        : m_base(::portable_stl::move(base)), m_predicate(::portable_stl::move(predicate)) {
+    }
+
+    /**
+     * @brief Returns the underlying view.
+     * @return the underlying view.
+     */
+    constexpr t_view const &base() const noexcept {
+      return m_base;
+    }
+
+    /**
+     * @brief Returns the predicate.
+     * @return the predicate.
+     */
+    constexpr t_predicate const &pred() const noexcept {
+      return m_predicate;
+    }
+
+    /**
+     * @brief Returns an iterator to the first element satisfying the predicate.
+     * @return the iterator to the first element.
+     */
+    constexpr iterator begin() const {
+      return iterator(this, M_find(::portable_stl::ranges::begin(m_base)));
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator end() const {
+      return iterator(this, ::portable_stl::ranges::end(m_base));
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::filter implementation.
+     */
+    class filter_fn final {
+    public:
+      /**
+       * @brief Makes filter_view of the range.
+       * @tparam t_range the type of the range.
+       * @tparam t_predicate the type of the predicate.
+       * @param range the range.
+       * @param predicate the predicate.
+       * @return the view.
+       */
+      template<class t_range, class t_predicate>
+      constexpr ::portable_stl::ranges::
+        filter_view<::portable_stl::ranges::views::all_t<t_range>, ::portable_stl::decay_t<t_predicate>>
+        operator()(t_range &&range, t_predicate &&predicate) const {
+        return ::portable_stl::ranges::
+          filter_view<::portable_stl::ranges::views::all_t<t_range>, ::portable_stl::decay_t<t_predicate>>(
+            ::portable_stl::ranges::views::all(::portable_stl::forward<t_range>(range)),
+            ::portable_stl::forward<t_predicate>(predicate));
+      }
+
+      /**
+       * @brief Makes the closure applicable with the pipe syntax.
+       * @tparam t_predicate the type of the predicate.
+       * @param predicate the predicate.
+       * @return the closure.
+       */
+      template<class t_predicate>
+      constexpr bound_closure_t<filter_fn, t_predicate> operator()(t_predicate &&predicate) const {
+        return bind_adaptor<filter_fn>(::portable_stl::forward<t_predicate>(predicate));
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the elements satisfying the predicate: views::filter(range, predicate) or
+       * range | views::filter(predicate).
+       */
+      constexpr auto const &filter = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::filter_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_FILTER_VIEW_H */
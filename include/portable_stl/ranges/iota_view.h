@@ -0,0 +1,263 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="iota_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_IOTA_VIEW_H
+#define PSTL_IOTA_VIEW_H
+
+#include "../common/numeric_limits.h"
+#include "../common/ptrdiff_t.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/primary_type/is_integral.h"
+#include "concepts/maybe_borrowed_range.h"
+#include "range_adaptor.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the sequence of the integral values [first, last).
+   * The iterator keeps the current value only. The sequence without the bound ends at the maximal value of the type.
+   * @tparam t_type the integral type of the values.
+   */
+  template<class t_type> class iota_view final : public ::portable_stl::ranges::view_interface<iota_view<t_type>> {
+    static_assert(::portable_stl::is_integral<t_type>{}(), "iota_view requires the integral type");
+
+    /**
+     * @brief The first value.
+     */
+    t_type m_first{};
+    /**
+     * @brief The bound of the values.
+     */
+    t_type m_last{};
+
+  public:
+    /**
+     * @brief Iterator of the iota_view.
+     */
+    class iterator final : public ranges_helper::view_iterator_operators<iterator, ::portable_stl::ptrdiff_t> {
+      /**
+       * @brief Current value.
+       */
+      t_type m_value{};
+
+    public:
+      /**
+       * @brief Iterator category.
+       */
+      using iterator_category = ::portable_stl::random_access_iterator_tag;
+      /**
+       * @brief Value type.
+       */
+      using value_type        = t_type;
+      /**
+       * @brief Difference type.
+       */
+      using difference_type   = ::portable_stl::ptrdiff_t;
+      /**
+       * @brief Pointer type.
+       */
+      using pointer           = void;
+      /**
+       * @brief Reference type: the value is returned.
+       */
+      using reference         = t_type;
+
+      /**
+       * @brief Default constructor.
+       */
+      constexpr iterator() = default;
+
+      /**
+       * @brief Constructs the iterator to the value.
+       * @param value the value.
+       */
+      constexpr explicit iterator(t_type value) noexcept : m_value(value) {
+      }
+
+      /**
+       * @brief Dereferences the iterator.
+       * @return the current value.
+       */
+      constexpr t_type operator*() const noexcept {
+        return m_value;
+      }
+
+      /**
+       * @brief Accesses the value by the offset.
+       * @param offset the offset of the value.
+       * @return the value.
+       */
+      constexpr t_type operator[](difference_type offset) const noexcept {
+        return static_cast<t_type>(m_value + offset);
+      }
+
+      /**
+       * @brief Moves to the next value.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator++() noexcept {
+        ++m_value;
+        return *this;
+      }
+
+      /**
+       * @brief Moves to the previous value.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator--() noexcept {
+        --m_value;
+        return *this;
+      }
+
+      /**
+       * @brief Advances the iterator.
+       * @param offset the number of positions.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator+=(difference_type offset) noexcept {
+        m_value = static_cast<t_type>(m_value + offset);
+        return *this;
+      }
+
+      /**
+       * @brief Moves back the iterator.
+       * @param offset the number of positions.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator-=(difference_type offset) noexcept {
+        m_value = static_cast<t_type>(m_value - offset);
+        return *this;
+      }
+
+      /**
+       * @brief Equality comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the values are equal.
+       */
+      friend constexpr bool operator==(iterator const &left, iterator const &right) noexcept {
+        return left.m_value == right.m_value;
+      }
+
+      /**
+       * @brief Less than comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the value of left is less.
+       */
+      friend constexpr bool operator<(iterator const &left, iterator const &right) noexcept {
+        return left.m_value < right.m_value;
+      }
+
+      /**
+       * @brief Distance between the iterators.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return the difference of the values.
+       */
+      friend constexpr difference_type operator-(iterator const &left, iterator const &right) noexcept {
+        return (right.m_value < left.m_value) ? static_cast<difference_type>(left.m_value - right.m_value)
+                                              : -static_cast<difference_type>(right.m_value - left.m_value);
+      }
+    };
+
+    /**
+     * @brief Default constructor: the empty sequence.
+     */
+    constexpr iota_view() = default;
+
+    /**
+     * @brief Constructs the sequence from first to the maximal value of the type.
+     * @param first the first value.
+     */
+    constexpr explicit iota_view(t_type first) noexcept
+        : m_first(first), m_last(::portable_stl::numeric_limits<t_type>::max()) {
+    }
+
+    /**
+     * @brief Constructs the sequence [first, last).
+     * UB: last < first.
+     * @param first the first value.
+     * @param last the bound of the values.
+     */
+    constexpr iota_view(t_type first, t_type last) noexcept : m_first(first), m_last(last) {
+    }
+
+    /**
+     * @brief Returns an iterator to the first value.
+     * @return the iterator to the first value.
+     */
+    constexpr iterator begin() const noexcept {
+      return iterator(m_first);
+    }
+
+    /**
+     * @brief Returns an iterator to the bound of the values.
+     * @return the iterator to the end.
+     */
+    constexpr iterator end() const noexcept {
+      return iterator(m_last);
+    }
+  };
+
+  /**
+   * @brief The iterators of iota_view do not depend on the lifetime of the view.
+   * @tparam t_type the integral type of the values.
+   */
+  template<class t_type> constexpr bool enable_borrowed_range<::portable_stl::ranges::iota_view<t_type>> = true;
+
+  namespace ranges_helper {
+    /**
+     * @brief views::iota implementation.
+     */
+    class iota_fn final {
+    public:
+      /**
+       * @brief Makes the sequence from first to the maximal value of the type.
+       * @tparam t_type the integral type of the values.
+       * @param first the first value.
+       * @return the view.
+       */
+      template<class t_type>
+      constexpr ::portable_stl::ranges::iota_view<t_type> operator()(t_type first) const noexcept {
+        return ::portable_stl::ranges::iota_view<t_type>(first);
+      }
+
+      /**
+       * @brief Makes the sequence [first, last).
+       * @tparam t_type the integral type of the values.
+       * @tparam t_bound the type of the bound.
+       * @param first the first value.
+       * @param last the bound of the values.
+       * @return the view.
+       */
+      template<class t_type, class t_bound>
+      constexpr ::portable_stl::ranges::iota_view<t_type> operator()(t_type first, t_bound last) const noexcept {
+        return ::portable_stl::ranges::iota_view<t_type>(first, static_cast<t_type>(last));
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the sequence of the integral values: views::iota(first, last) or views::iota(first).
+       */
+      constexpr auto const &iota = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::iota_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_IOTA_VIEW_H */
@@ -0,0 +1,253 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="join_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_JOIN_VIEW_H
+#define PSTL_JOIN_VIEW_H
+
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/input_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../metaprogramming/logical_operator/conjunction.h"
+#include "../metaprogramming/other_transformations/conditional_bool_constant.h"
+#include "../metaprogramming/reference_modifications/remove_reference.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "all.h"
+#include "begin.h"
+#include "concepts/maybe_borrowed_range.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "range_adaptor.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the elements of the inner ranges of the underlying view, flattened into one sequence.
+   * The inner ranges must be lvalues or borrowed views (e.g. the pieces of split_view). The iterator keeps the outer
+   * and the inner iterators and the pointer to the view, so the view must outlive its iterators.
+   * @tparam t_view the type of the underlying common view.
+   */
+  template<class t_view> class join_view final : public ::portable_stl::ranges::view_interface<join_view<t_view>> {
+    /**
+     * @brief Outer iterator type.
+     */
+    using t_outer_iterator = ::portable_stl::ranges::iterator_t<t_view const>;
+
+    /**
+     * @brief Reference type of the outer iterator, the inner range.
+     */
+    using t_inner_reference = typename ::portable_stl::iterator_traits<t_outer_iterator>::reference;
+
+    /**
+     * @brief Inner iterator type.
+     */
+    using t_inner_iterator = ::portable_stl::ranges::iterator_t<::portable_stl::remove_reference_t<t_inner_reference>>;
+
+    static_assert(::portable_stl::ranges::maybe_borrowed_range<t_inner_reference>{}(),
+                  "the inner ranges of join_view must be lvalues or borrowed views");
+
+    /**
+     * @brief Underlying view.
+     */
+    t_view m_base;
+
+  public:
+    /**
+     * @brief Iterator of the join_view.
+     */
+    class iterator final
+        : public ranges_helper::view_iterator_operators<
+            iterator,
+            typename ::portable_stl::iterator_traits<t_inner_iterator>::difference_type> {
+      /**
+       * @brief The view constructs its iterators.
+       */
+      friend join_view;
+
+      /**
+       * @brief The view.
+       */
+      join_view const *m_parent{nullptr};
+      /**
+       * @brief Outer iterator.
+       */
+      t_outer_iterator m_outer{};
+      /**
+       * @brief Inner iterator, value initialized at the end of the view.
+       */
+      t_inner_iterator m_inner{};
+
+      /**
+       * @brief Constructs the iterator.
+       * @param parent the view.
+       * @param outer the outer iterator.
+       */
+      constexpr iterator(join_view const *parent, t_outer_iterator outer)
+          : m_parent(parent), m_outer(::portable_stl::move(outer)) {
+      }
+
+      /**
+       * @brief Skips the empty inner ranges starting from the outer iterator.
+       */
+      constexpr void M_satisfy() {
+        t_outer_iterator const last{::portable_stl::ranges::end(m_parent->m_base)};
+        for (; m_outer != last; ++m_outer) {
+          t_inner_reference inner_range = *m_outer;
+          m_inner                       = ::portable_stl::ranges::begin(inner_range);
+          if (m_inner != ::portable_stl::ranges::end(inner_range)) {
+            return;
+          }
+        }
+        m_inner = t_inner_iterator{};
+      }
+
+    public:
+      /**
+       * @brief Iterator category: forward if the outer and the inner iterators are forward, input otherwise.
+       */
+      using iterator_category = ::portable_stl::conditional_bool_constant_t<
+        ::portable_stl::conjunction<
+          ranges_helper::is_iterator_category<t_outer_iterator, ::portable_stl::forward_iterator_tag>,
+          ranges_helper::is_iterator_category<t_inner_iterator, ::portable_stl::forward_iterator_tag>>,
+        ::portable_stl::forward_iterator_tag,
+        ::portable_stl::input_iterator_tag>;
+      /**
+       * @brief Value type.
+       */
+      using value_type      = typename ::portable_stl::iterator_traits<t_inner_iterator>::value_type;
+      /**
+       * @brief Difference type.
+       */
+      using difference_type = typename ::portable_stl::iterator_traits<t_inner_iterator>::difference_type;
+      /**
+       * @brief Pointer type.
+       */
+      using pointer         = typename ::portable_stl::iterator_traits<t_inner_iterator>::pointer;
+      /**
+       * @brief Reference type.
+       */
+      using reference       = typename ::portable_stl::iterator_traits<t_inner_iterator>::reference;
+
+      /**
+       * @brief Default constructor.
+       */
+      constexpr iterator() = default;
+
+      /**
+       * @brief Dereferences the iterator.
+       * @return the reference to the element.
+       */
+      constexpr reference operator*() const {
+        return *m_inner;
+      }
+
+      /**
+       * @brief Accesses the element member.
+       * @return the inner iterator.
+       */
+      constexpr t_inner_iterator operator->() const {
+        return m_inner;
+      }
+
+      /**
+       * @brief Moves to the next element, skips the empty inner ranges.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator++() {
+        t_inner_reference inner_range = *m_outer;
+        if (++m_inner == ::portable_stl::ranges::end(inner_range)) {
+          ++m_outer;
+          M_satisfy();
+        }
+        return *this;
+      }
+
+      /**
+       * @brief Equality comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the outer and the inner iterators are equal.
+       */
+      friend constexpr bool operator==(iterator const &left, iterator const &right) {
+        return (left.m_outer == right.m_outer) && (left.m_inner == right.m_inner);
+      }
+    };
+
+    /**
+     * @brief Constructs the view.
+     * @param base the underlying view.
+     */
+    constexpr explicit join_view(t_view base) : m_base(::portable_stl::move(base)) {
+    }
+
+    /**
+     * @brief Returns the underlying view.
+     * @return the underlying view.
+     */
+    constexpr t_view const &base() const noexcept {
+      return m_base;
+    }
+
+    /**
+     * @brief Returns an iterator to the first element.
+     * @return the iterator to the first element.
+     */
+    constexpr iterator begin() const {
+      iterator result(this, ::portable_stl::ranges::begin(m_base));
+      result.M_satisfy();
+      return result;
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator end() const {
+      return iterator(this, ::portable_stl::ranges::end(m_base));
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::join implementation.
+     */
+    class join_fn final {
+    public:
+      /**
+       * @brief Makes join_view of the range.
+       * @tparam t_range the type of the range.
+       * @param range the range of ranges.
+       * @return the view.
+       */
+      template<class t_range>
+      constexpr ::portable_stl::ranges::join_view<::portable_stl::ranges::views::all_t<t_range>> operator()(
+        t_range &&range) const {
+        return ::portable_stl::ranges::join_view<::portable_stl::ranges::views::all_t<t_range>>(
+          ::portable_stl::ranges::views::all(::portable_stl::forward<t_range>(range)));
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the flattened inner ranges: views::join(range) or range | views::join.
+       */
+      constexpr auto const &join = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::range_adaptor_closure<::portable_stl::ranges::ranges_helper::join_fn>>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_JOIN_VIEW_H */
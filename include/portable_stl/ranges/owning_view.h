@@ -0,0 +1,94 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="owning_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_OWNING_VIEW_H
+#define PSTL_OWNING_VIEW_H
+
+#include "../utility/general/move.h"
+#include "begin.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "sentinel_t.h"
+#include "view_interface.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View that takes the ownership of the range moved into it.
+   * @tparam t_range the type of the owned range.
+   */
+  template<class t_range>
+  class owning_view final : public ::portable_stl::ranges::view_interface<owning_view<t_range>> {
+    /**
+     * @brief Owned range.
+     */
+    t_range m_range;
+
+  public:
+    /**
+     * @brief Constructs the view by moving the range.
+     * @param range the owned range.
+     */
+    constexpr explicit owning_view(t_range &&range) : m_range(::portable_stl::move(range)) {
+    }
+
+    /**
+     * @brief Returns the owned range.
+     * @return the owned range.
+     */
+    constexpr t_range &base() noexcept {
+      return m_range;
+    }
+
+    /**
+     * @brief Returns the owned range.
+     * @return the owned range.
+     */
+    constexpr t_range const &base() const noexcept {
+      return m_range;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the range.
+     * @return the iterator to the first element.
+     */
+    constexpr ::portable_stl::ranges::iterator_t<t_range> begin() {
+      return ::portable_stl::ranges::begin(m_range);
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the range.
+     * @return the iterator to the first element.
+     */
+    constexpr ::portable_stl::ranges::iterator_t<t_range const> begin() const {
+      return ::portable_stl::ranges::begin(m_range);
+    }
+
+    /**
+     * @brief Returns a sentinel of the range.
+     * @return the sentinel.
+     */
+    constexpr ::portable_stl::ranges::sentinel_t<t_range> end() {
+      return ::portable_stl::ranges::end(m_range);
+    }
+
+    /**
+     * @brief Returns a sentinel of the range.
+     * @return the sentinel.
+     */
+    constexpr ::portable_stl::ranges::sentinel_t<t_range const> end() const {
+      return ::portable_stl::ranges::end(m_range);
+    }
+  };
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_OWNING_VIEW_H */
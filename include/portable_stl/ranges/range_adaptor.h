@@ -0,0 +1,250 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="range_adaptor.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_RANGE_ADAPTOR_H
+#define PSTL_RANGE_ADAPTOR_H
+
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/logical_operator/negation.h"
+#include "../metaprogramming/other_transformations/decay.h"
+#include "../metaprogramming/other_transformations/enable_if_bool_constant.h"
+#include "../metaprogramming/other_transformations/remove_cvref.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief Range adaptor closure object: the function object with one range argument that can be applied with the
+   * pipe syntax range | closure and composed with closure | closure.
+   * @tparam t_function the type of the function applied to the range.
+   */
+  template<class t_function> class range_adaptor_closure final {
+    /**
+     * @brief Function applied to the range.
+     */
+    t_function m_function;
+
+  public:
+    /**
+     * @brief Default constructor.
+     */
+    constexpr range_adaptor_closure() : m_function() {
+    }
+
+    /**
+     * @brief Constructs the closure of the function.
+     * @param function the function applied to the range.
+     */
+    constexpr explicit range_adaptor_closure(t_function function) : m_function(::portable_stl::move(function)) {
+    }
+
+    /**
+     * @brief Applies the function to the range.
+     * @tparam t_range the type of the range.
+     * @param range the range.
+     * @return the result of the function, usually the view.
+     */
+    template<class t_range> constexpr decltype(auto) operator()(t_range &&range) const {
+      return m_function(::portable_stl::forward<t_range>(range));
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief Helper wrapper with static member to brak ODR violation.
+     * @tparam t_type Given type.
+     */
+    template<class t_type> struct static_const_wrapper {
+      /**
+       * @brief The only static member.
+       */
+      constexpr static t_type value{};
+    };
+
+    /**
+     * @brief Static member initialization.
+     * @tparam t_type Given type.
+     */
+    template<class t_type> constexpr t_type static_const_wrapper<t_type>::value;
+
+    /**
+     * @brief Checks if t_type is the range adaptor closure object type.
+     * @tparam t_type the tested type.
+     */
+    template<class t_type> class is_range_adaptor_closure final {
+    public:
+      /**
+       * @brief Result type.
+       */
+      using type = ::portable_stl::false_type;
+    };
+
+    /**
+     * @brief Checks if t_type is the range adaptor closure object type.
+     * @tparam t_function the type of the function of the closure.
+     */
+    template<class t_function>
+    class is_range_adaptor_closure<::portable_stl::ranges::range_adaptor_closure<t_function>> final {
+    public:
+      /**
+       * @brief Result type.
+       */
+      using type = ::portable_stl::true_type;
+    };
+
+    /**
+     * @brief Checks if t_type is the range adaptor closure object type.
+     * @tparam t_type the tested type.
+     */
+    template<class t_type> using is_range_adaptor_closure_t = typename is_range_adaptor_closure<t_type>::type;
+
+    /**
+     * @brief Composition of two closures: applies t_first, then t_second.
+     * @tparam t_first the type of the first closure.
+     * @tparam t_second the type of the second closure.
+     */
+    template<class t_first, class t_second> class composed_adaptor final {
+      /**
+       * @brief The first closure.
+       */
+      t_first  m_first;
+      /**
+       * @brief The second closure.
+       */
+      t_second m_second;
+
+    public:
+      /**
+       * @brief Constructs the composition.
+       * @param first the first closure.
+       * @param second the second closure.
+       */
+      constexpr composed_adaptor(t_first first, t_second second)
+          : m_first(::portable_stl::move(first)), m_second(::portable_stl::move(second)) {
+      }
+
+      /**
+       * @brief Applies both closures to the range.
+       * @tparam t_range the type of the range.
+       * @param range the range.
+       * @return second(first(range)).
+       */
+      template<class t_range> constexpr decltype(auto) operator()(t_range &&range) const {
+        return m_second(m_first(::portable_stl::forward<t_range>(range)));
+      }
+    };
+
+    /**
+     * @brief Range adaptor with the bound trailing argument: calls t_adaptor{}(range, argument).
+     * @tparam t_adaptor the type of the range adaptor object.
+     * @tparam t_argument the type of the bound argument.
+     */
+    template<class t_adaptor, class t_argument> class bound_adaptor final {
+      /**
+       * @brief Bound argument.
+       */
+      t_argument m_argument;
+
+    public:
+      /**
+       * @brief Constructs the adaptor with the bound argument.
+       * @param argument the bound argument.
+       */
+      constexpr explicit bound_adaptor(t_argument argument) : m_argument(::portable_stl::move(argument)) {
+      }
+
+      /**
+       * @brief Applies the adaptor to the range and the bound argument.
+       * @tparam t_range the type of the range.
+       * @param range the range.
+       * @return the view.
+       */
+      template<class t_range> constexpr decltype(auto) operator()(t_range &&range) const {
+        return t_adaptor{}(::portable_stl::forward<t_range>(range), m_argument);
+      }
+    };
+
+    /**
+     * @brief Closure type of the range adaptor with the bound trailing argument.
+     * @tparam t_adaptor the type of the range adaptor object.
+     * @tparam t_argument the type of the bound argument.
+     */
+    template<class t_adaptor, class t_argument>
+    using bound_closure_t
+      = ::portable_stl::ranges::range_adaptor_closure<bound_adaptor<t_adaptor, ::portable_stl::decay_t<t_argument>>>;
+
+    /**
+     * @brief Makes the closure of the range adaptor with the bound trailing argument.
+     * @tparam t_adaptor the type of the range adaptor object.
+     * @tparam t_argument the type of the bound argument.
+     * @param argument the bound argument.
+     * @return the closure.
+     */
+    template<class t_adaptor, class t_argument>
+    constexpr bound_closure_t<t_adaptor, t_argument> bind_adaptor(t_argument &&argument) {
+      return bound_closure_t<t_adaptor, t_argument>(
+        bound_adaptor<t_adaptor, ::portable_stl::decay_t<t_argument>>(::portable_stl::forward<t_argument>(argument)));
+    }
+  } // namespace ranges_helper
+
+  /**
+   * @brief Applies the closure to the range: range | closure is closure(range).
+   * @tparam t_range the type of the range.
+   * @tparam t_function the type of the function of the closure.
+   * @param range the range.
+   * @param closure the range adaptor closure object.
+   * @return the result of the closure, usually the view.
+   */
+  template<class t_range,
+           class t_function,
+           ::portable_stl::enable_if_bool_constant_t<
+             ::portable_stl::negation<
+               ranges_helper::is_range_adaptor_closure_t<::portable_stl::remove_cvref_t<t_range>>>,
+             void *>
+           = nullptr>
+  constexpr decltype(auto) operator|(t_range                                                     &&range,
+                                     ::portable_stl::ranges::range_adaptor_closure<t_function> const &closure) {
+    return closure(::portable_stl::forward<t_range>(range));
+  }
+
+  /**
+   * @brief Composes two closures: range | (first | second) is range | first | second.
+   * @tparam t_first the type of the function of the first closure.
+   * @tparam t_second the type of the function of the second closure.
+   * @param first the first closure.
+   * @param second the second closure.
+   * @return the composed closure.
+   */
+  template<class t_first, class t_second>
+  constexpr ::portable_stl::ranges::range_adaptor_closure<
+    ranges_helper::composed_adaptor<::portable_stl::ranges::range_adaptor_closure<t_first>,
+                                    ::portable_stl::ranges::range_adaptor_closure<t_second>>>
+    operator|(::portable_stl::ranges::range_adaptor_closure<t_first> const  &first,
+              ::portable_stl::ranges::range_adaptor_closure<t_second> const &second) {
+    using t_composed = ranges_helper::composed_adaptor<::portable_stl::ranges::range_adaptor_closure<t_first>,
+                                                       ::portable_stl::ranges::range_adaptor_closure<t_second>>;
+    return ::portable_stl::ranges::range_adaptor_closure<t_composed>(t_composed(first, second));
+  }
+
+  /**
+   * @brief Range adaptor objects.
+   */
+  namespace views {}
+} // namespace ranges
+
+/**
+ * @brief Shortcut for the range adaptor objects.
+ */
+namespace views = ::portable_stl::ranges::views;
+} // namespace portable_stl
+
+#endif /* PSTL_RANGE_ADAPTOR_H */
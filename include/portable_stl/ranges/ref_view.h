@@ -0,0 +1,76 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="ref_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_REF_VIEW_H
+#define PSTL_REF_VIEW_H
+
+#include "begin.h"
+#include "concepts/maybe_borrowed_range.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "sentinel_t.h"
+#include "view_interface.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the elements of some other range.
+   * The view refers to the range, so the range must outlive the view.
+   * @tparam t_range the type of the referred range.
+   */
+  template<class t_range> class ref_view final : public ::portable_stl::ranges::view_interface<ref_view<t_range>> {
+    /**
+     * @brief Referred range.
+     */
+    t_range *m_range;
+
+  public:
+    /**
+     * @brief Constructs the view of the range.
+     * @param range the referred range.
+     */
+    constexpr explicit ref_view(t_range &range) noexcept : m_range(&range) {
+    }
+
+    /**
+     * @brief Returns the referred range.
+     * @return the referred range.
+     */
+    constexpr t_range &base() const noexcept {
+      return *m_range;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the range.
+     * @return the iterator to the first element.
+     */
+    constexpr ::portable_stl::ranges::iterator_t<t_range> begin() const {
+      return ::portable_stl::ranges::begin(*m_range);
+    }
+
+    /**
+     * @brief Returns a sentinel of the range.
+     * @return the sentinel.
+     */
+    constexpr ::portable_stl::ranges::sentinel_t<t_range> end() const {
+      return ::portable_stl::ranges::end(*m_range);
+    }
+  };
+
+  /**
+   * @brief The iterators of ref_view do not depend on the lifetime of the view.
+   * @tparam t_range the type of the referred range.
+   */
+  template<class t_range> constexpr bool enable_borrowed_range<::portable_stl::ranges::ref_view<t_range>> = true;
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_REF_VIEW_H */
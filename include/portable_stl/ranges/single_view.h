@@ -0,0 +1,99 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="single_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SINGLE_VIEW_H
+#define PSTL_SINGLE_VIEW_H
+
+#include "../common/size_t.h"
+#include "../metaprogramming/other_transformations/decay.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "range_adaptor.h"
+#include "view_interface.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of exactly one element it owns.
+   * @tparam t_type the type of the element.
+   */
+  template<class t_type> class single_view final : public ::portable_stl::ranges::view_interface<single_view<t_type>> {
+    /**
+     * @brief The element.
+     */
+    t_type m_value;
+
+  public:
+    /**
+     * @brief Constructs the view of the element.
+     * @param value the element.
+     */
+    constexpr explicit single_view(t_type value) : m_value(::portable_stl::move(value)) {
+    }
+
+    /**
+     * @brief Returns a pointer to the element.
+     * @return the pointer to the element.
+     */
+    constexpr t_type const *begin() const noexcept {
+      return &m_value;
+    }
+
+    /**
+     * @brief Returns a pointer past the element.
+     * @return the pointer past the element.
+     */
+    constexpr t_type const *end() const noexcept {
+      return &m_value + 1;
+    }
+
+    /**
+     * @brief Returns the number of elements.
+     * @return 1.
+     */
+    constexpr static ::portable_stl::size_t size() noexcept {
+      return 1U;
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::single implementation.
+     */
+    class single_fn final {
+    public:
+      /**
+       * @brief Makes single_view of the value.
+       * @tparam t_type the type of the value.
+       * @param value the value.
+       * @return the view.
+       */
+      template<class t_type>
+      constexpr ::portable_stl::ranges::single_view<::portable_stl::decay_t<t_type>> operator()(t_type &&value) const {
+        return ::portable_stl::ranges::single_view<::portable_stl::decay_t<t_type>>(
+          ::portable_stl::forward<t_type>(value));
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of exactly one element: views::single(value).
+       */
+      constexpr auto const &single = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::single_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_SINGLE_VIEW_H */
@@ -0,0 +1,352 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="split_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SPLIT_VIEW_H
+#define PSTL_SPLIT_VIEW_H
+
+#include "../algorithm/search.h"
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../metaprogramming/other_transformations/decay.h"
+#include "../metaprogramming/other_transformations/enable_if_bool_constant.h"
+#include "../metaprogramming/logical_operator/negation.h"
+#include "../metaprogramming/reference_modifications/remove_reference.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "all.h"
+#include "begin.h"
+#include "concepts/range.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "range_adaptor.h"
+#include "single_view.h"
+#include "subrange.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the subranges of the underlying view separated by the pattern.
+   * The pieces are found lazily while the view is iterated, the empty pattern splits the view into single elements.
+   * The iterator keeps the base iterators of the piece and of the found pattern and the pointer to the view, so the
+   * view must outlive its iterators. The character array pattern includes the terminating null character, so the
+   * single character is used to split by the character.
+   * @tparam t_view the type of the underlying common forward view.
+   * @tparam t_pattern the type of the pattern view.
+   */
+  template<class t_view, class t_pattern>
+  class split_view final : public ::portable_stl::ranges::view_interface<split_view<t_view, t_pattern>> {
+    /**
+     * @brief Underlying iterator type.
+     */
+    using t_base_iterator = ::portable_stl::ranges::iterator_t<t_view const>;
+
+    /**
+     * @brief Underlying view.
+     */
+    t_view    m_base;
+    /**
+     * @brief Pattern.
+     */
+    t_pattern m_pattern;
+
+    /**
+     * @brief Finds the next pattern in [current, end of the underlying view).
+     * @param current the start of the search.
+     * @return the found pattern or the empty subrange at the end of the underlying view.
+     */
+    constexpr ::portable_stl::ranges::subrange<t_base_iterator> M_find_next(t_base_iterator current) const {
+      t_base_iterator const last{::portable_stl::ranges::end(m_base)};
+      auto const            pattern_first = ::portable_stl::ranges::begin(m_pattern);
+      auto const            pattern_last  = ::portable_stl::ranges::end(m_pattern);
+
+      t_base_iterator first{::portable_stl::search(current, last, pattern_first, pattern_last)};
+      if (first == last) {
+        return {last, last};
+      }
+      t_base_iterator next{first};
+      if (pattern_first == pattern_last) {
+        // the empty pattern matches after every element
+        ++first;
+        ++next;
+      } else {
+        for (auto pattern = pattern_first; pattern != pattern_last; ++pattern) {
+          ++next;
+        }
+      }
+      return {first, next};
+    }
+
+  public:
+    /**
+     * @brief Iterator of the split_view.
+     */
+    class iterator final
+        : public ranges_helper::view_iterator_operators<
+            iterator,
+            typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type> {
+      /**
+       * @brief The view constructs its iterators.
+       */
+      friend split_view;
+
+      /**
+       * @brief The view.
+       */
+      split_view const *m_parent{nullptr};
+      /**
+       * @brief Beginning of the current piece.
+       */
+      t_base_iterator   m_current{};
+      /**
+       * @brief Beginning of the found pattern, the end of the current piece.
+       */
+      t_base_iterator   m_next_first{};
+      /**
+       * @brief End of the found pattern.
+       */
+      t_base_iterator   m_next_last{};
+      /**
+       * @brief The pattern at the end of the underlying view is followed by the empty piece.
+       */
+      bool              m_trailing_empty{false};
+
+      /**
+       * @brief Constructs the iterator.
+       * @param parent the view.
+       * @param current the beginning of the piece.
+       * @param next the found pattern.
+       */
+      constexpr iterator(split_view const                               *parent,
+                         t_base_iterator                                  current,
+                         ::portable_stl::ranges::subrange<t_base_iterator> next)
+          : m_parent(parent), m_current(::portable_stl::move(current)), m_next_first(next.begin()),
+            m_next_last(next.end()) {
+      }
+
+    public:
+      /**
+       * @brief Iterator category.
+       */
+      using iterator_category = ::portable_stl::forward_iterator_tag;
+      /**
+       * @brief Value type: the piece of the underlying view.
+       */
+      using value_type        = ::portable_stl::ranges::subrange<t_base_iterator>;
+      /**
+       * @brief Difference type.
+       */
+      using difference_type   = typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type;
+      /**
+       * @brief Pointer type.
+       */
+      using pointer           = void;
+      /**
+       * @brief Reference type: the piece is returned.
+       */
+      using reference         = value_type;
+
+      /**
+       * @brief Default constructor.
+       */
+      constexpr iterator() = default;
+
+      /**
+       * @brief Returns the beginning of the current piece.
+       * @return the underlying iterator.
+       */
+      constexpr t_base_iterator base() const {
+        return m_current;
+      }
+
+      /**
+       * @brief Dereferences the iterator.
+       * @return the current piece.
+       */
+      constexpr value_type operator*() const {
+        return value_type(m_current, m_next_first);
+      }
+
+      /**
+       * @brief Moves to the next piece.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator++() {
+        t_base_iterator const last{::portable_stl::ranges::end(m_parent->m_base)};
+        m_current = m_next_first;
+        if (m_current != last) {
+          m_current = m_next_last;
+          if (m_current == last) {
+            m_trailing_empty = true;
+            m_next_first     = m_current;
+            m_next_last      = m_current;
+          } else {
+            ::portable_stl::ranges::subrange<t_base_iterator> const next{m_parent->M_find_next(m_current)};
+            m_next_first = next.begin();
+            m_next_last  = next.end();
+          }
+        } else {
+          m_trailing_empty = false;
+        }
+        return *this;
+      }
+
+      /**
+       * @brief Equality comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the iterators refer to the same piece.
+       */
+      friend constexpr bool operator==(iterator const &left, iterator const &right) {
+        return (left.m_current == right.m_current) && (left.m_trailing_empty == right.m_trailing_empty);
+      }
+    };
+
+    /**
+     * @brief Constructs the view.
+     * @param base the underlying view.
+     * @param pattern the pattern.
+     */
+    constexpr split_view(t_view base, t_pattern pattern)
+        : m_base(::portable_stl::move(base)), m_pattern(::portable_stl::move(pattern)) {
+    }
+
+    /**
+     * @brief Returns the underlying view.
+     * @return the underlying view.
+     */
+    constexpr t_view const &base() const noexcept {
+      return m_base;
+    }
+
+    /**
+     * @brief Returns an iterator to the first piece.
+     * @return the iterator to the first piece.
+     */
+    constexpr iterator begin() const {
+      t_base_iterator first{::portable_stl::ranges::begin(m_base)};
+      return iterator(this, first, M_find_next(first));
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator end() const {
+      t_base_iterator last{::portable_stl::ranges::end(m_base)};
+      return iterator(this, last, {last, last});
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::split implementation.
+     */
+    class split_fn final {
+    public:
+      /**
+       * @brief Makes split_view of the range by the pattern range.
+       * @tparam t_range the type of the range.
+       * @tparam t_pattern the type of the pattern range.
+       * @param range the range.
+       * @param pattern the pattern range.
+       * @return the view.
+       */
+      template<class t_range,
+               class t_pattern,
+               ::portable_stl::enable_if_bool_constant_t<
+                 ::portable_stl::ranges::range<::portable_stl::remove_reference_t<t_pattern>>,
+                 void *>
+               = nullptr>
+      constexpr ::portable_stl::ranges::split_view<::portable_stl::ranges::views::all_t<t_range>,
+                                                   ::portable_stl::ranges::views::all_t<t_pattern>>
+        operator()(t_range &&range, t_pattern &&pattern) const {
+        return ::portable_stl::ranges::split_view<::portable_stl::ranges::views::all_t<t_range>,
+                                                  ::portable_stl::ranges::views::all_t<t_pattern>>(
+          ::portable_stl::ranges::views::all(::portable_stl::forward<t_range>(range)),
+          ::portable_stl::ranges::views::all(::portable_stl::forward<t_pattern>(pattern)));
+      }
+
+      /**
+       * @brief Makes split_view of the range by the single element.
+       * @tparam t_range the type of the range.
+       * @tparam t_pattern the type of the element.
+       * @param range the range.
+       * @param pattern the separating element.
+       * @return the view.
+       */
+      template<class t_range,
+               class t_pattern,
+               ::portable_stl::enable_if_bool_constant_t<
+                 ::portable_stl::negation<::portable_stl::ranges::range<::portable_stl::remove_reference_t<t_pattern>>>,
+                 void *>
+               = nullptr>
+      constexpr ::portable_stl::ranges::
+        split_view<::portable_stl::ranges::views::all_t<t_range>,
+                   ::portable_stl::ranges::single_view<::portable_stl::decay_t<t_pattern>>>
+        operator()(t_range &&range, t_pattern &&pattern) const {
+        return ::portable_stl::ranges::split_view<
+          ::portable_stl::ranges::views::all_t<t_range>,
+          ::portable_stl::ranges::single_view<::portable_stl::decay_t<t_pattern>>>(
+          ::portable_stl::ranges::views::all(::portable_stl::forward<t_range>(range)),
+          ::portable_stl::ranges::single_view<::portable_stl::decay_t<t_pattern>>(
+            ::portable_stl::forward<t_pattern>(pattern)));
+      }
+
+      /**
+       * @brief Makes the closure applicable with the pipe syntax. The closure keeps the view of the pattern range, so
+       * the lvalue pattern range must outlive the closure and the views made by it.
+       * @tparam t_pattern the type of the pattern range.
+       * @param pattern the pattern range.
+       * @return the closure.
+       */
+      template<class t_pattern,
+               ::portable_stl::enable_if_bool_constant_t<
+                 ::portable_stl::ranges::range<::portable_stl::remove_reference_t<t_pattern>>,
+                 void *>
+               = nullptr>
+      constexpr bound_closure_t<split_fn, ::portable_stl::ranges::views::all_t<t_pattern>> operator()(
+        t_pattern &&pattern) const {
+        return bind_adaptor<split_fn>(::portable_stl::ranges::views::all(::portable_stl::forward<t_pattern>(pattern)));
+      }
+
+      /**
+       * @brief Makes the closure applicable with the pipe syntax.
+       * @tparam t_pattern the type of the separating element.
+       * @param pattern the separating element.
+       * @return the closure.
+       */
+      template<class t_pattern,
+               ::portable_stl::enable_if_bool_constant_t<
+                 ::portable_stl::negation<::portable_stl::ranges::range<::portable_stl::remove_reference_t<t_pattern>>>,
+                 void *>
+               = nullptr>
+      constexpr bound_closure_t<split_fn, t_pattern> operator()(t_pattern &&pattern) const {
+        return bind_adaptor<split_fn>(::portable_stl::forward<t_pattern>(pattern));
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the pieces separated by the pattern range or the element: views::split(range,
+       * pattern) or range | views::split(pattern).
+       */
+      constexpr auto const &split = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::split_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_SPLIT_VIEW_H */
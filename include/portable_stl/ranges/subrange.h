@@ -0,0 +1,79 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="subrange.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_SUBRANGE_H
+#define PSTL_SUBRANGE_H
+
+#include "../utility/general/move.h"
+#include "concepts/maybe_borrowed_range.h"
+#include "view_interface.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the iterator-sentinel pair.
+   * @tparam t_iterator the iterator type.
+   * @tparam t_sentinel the sentinel type.
+   */
+  template<class t_iterator, class t_sentinel = t_iterator>
+  class subrange final : public ::portable_stl::ranges::view_interface<subrange<t_iterator, t_sentinel>> {
+    /**
+     * @brief The beginning of the range.
+     */
+    t_iterator m_begin{};
+    /**
+     * @brief The end of the range.
+     */
+    t_sentinel m_end{};
+
+  public:
+    /**
+     * @brief Default constructor.
+     */
+    constexpr subrange() = default;
+
+    /**
+     * @brief Constructs the view of [first, last).
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    constexpr subrange(t_iterator first, t_sentinel last)
+        : m_begin(::portable_stl::move(first)), m_end(::portable_stl::move(last)) {
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the range.
+     * @return the iterator to the first element.
+     */
+    constexpr t_iterator begin() const {
+      return m_begin;
+    }
+
+    /**
+     * @brief Returns a sentinel of the range.
+     * @return the sentinel.
+     */
+    constexpr t_sentinel end() const {
+      return m_end;
+    }
+  };
+
+  /**
+   * @brief The iterators of subrange do not depend on the lifetime of the view.
+   * @tparam t_iterator the iterator type.
+   * @tparam t_sentinel the sentinel type.
+   */
+  template<class t_iterator, class t_sentinel>
+  constexpr bool enable_borrowed_range<::portable_stl::ranges::subrange<t_iterator, t_sentinel>> = true;
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_SUBRANGE_H */
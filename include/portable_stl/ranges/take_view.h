@@ -0,0 +1,356 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="take_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_TAKE_VIEW_H
+#define PSTL_TAKE_VIEW_H
+
+#include "../algorithm/min.h"
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/other_transformations/conditional_bool_constant.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "all.h"
+#include "begin.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "range_adaptor.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the first count elements of the underlying view (or all elements if there are less of them).
+   * The iterator keeps the base iterator and the number of the remaining elements. Random access views are sized
+   * views of min(count, size) elements, the other views are at most forward.
+   * @tparam t_view the type of the underlying common view.
+   */
+  template<class t_view> class take_view final : public ::portable_stl::ranges::view_interface<take_view<t_view>> {
+    /**
+     * @brief Underlying iterator type.
+     */
+    using t_base_iterator = ::portable_stl::ranges::iterator_t<t_view const>;
+
+    /**
+     * @brief Checks if the underlying iterator is random access iterator.
+     */
+    using t_is_random_access
+      = ranges_helper::is_iterator_category<t_base_iterator, ::portable_stl::random_access_iterator_tag>;
+
+    /**
+     * @brief Underlying difference type.
+     */
+    using t_difference = typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type;
+
+  public:
+    /**
+     * @brief Difference type.
+     */
+    using difference_type = t_difference;
+
+    /**
+     * @brief Iterator of the take_view.
+     */
+    class iterator final : public ranges_helper::view_iterator_operators<iterator, t_difference> {
+      /**
+       * @brief The view constructs its iterators.
+       */
+      friend take_view;
+
+      /**
+       * @brief Underlying iterator.
+       */
+      t_base_iterator m_current{};
+      /**
+       * @brief Number of the remaining elements.
+       */
+      t_difference    m_count{0};
+
+      /**
+       * @brief Constructs the iterator.
+       * @param current the underlying iterator.
+       * @param count the number of the remaining elements.
+       */
+      constexpr iterator(t_base_iterator current, t_difference count)
+          : m_current(::portable_stl::move(current)), m_count(count) {
+      }
+
+    public:
+      /**
+       * @brief Iterator category: random access or at most forward.
+       */
+      using iterator_category = ::portable_stl::conditional_bool_constant_t<
+        t_is_random_access,
+        ::portable_stl::random_access_iterator_tag,
+        ranges_helper::limit_iterator_category<t_base_iterator, ::portable_stl::forward_iterator_tag>>;
+      /**
+       * @brief Value type.
+       */
+      using value_type      = typename ::portable_stl::iterator_traits<t_base_iterator>::value_type;
+      /**
+       * @brief Difference type.
+       */
+      using difference_type = t_difference;
+      /**
+       * @brief Pointer type.
+       */
+      using pointer         = typename ::portable_stl::iterator_traits<t_base_iterator>::pointer;
+      /**
+       * @brief Reference type.
+       */
+      using reference       = typename ::portable_stl::iterator_traits<t_base_iterator>::reference;
+
+      /**
+       * @brief Default constructor.
+       */
+      constexpr iterator() = default;
+
+      /**
+       * @brief Returns the underlying iterator.
+       * @return the underlying iterator.
+       */
+      constexpr t_base_iterator base() const {
+        return m_current;
+      }
+
+      /**
+       * @brief Dereferences the iterator.
+       * @return the reference to the element.
+       */
+      constexpr reference operator*() const {
+        return *m_current;
+      }
+
+      /**
+       * @brief Accesses the element member.
+       * @return the underlying iterator.
+       */
+      constexpr t_base_iterator operator->() const {
+        return m_current;
+      }
+
+      /**
+       * @brief Accesses the element by the offset.
+       * @param offset the offset of the element.
+       * @return the reference to the element.
+       */
+      constexpr reference operator[](difference_type offset) const {
+        return m_current[offset];
+      }
+
+      /**
+       * @brief Moves to the next element.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator++() {
+        ++m_current;
+        --m_count;
+        return *this;
+      }
+
+      /**
+       * @brief Moves to the previous element.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator--() {
+        --m_current;
+        ++m_count;
+        return *this;
+      }
+
+      /**
+       * @brief Advances the iterator.
+       * @param offset the number of positions.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator+=(difference_type offset) {
+        m_current += offset;
+        m_count   -= offset;
+        return *this;
+      }
+
+      /**
+       * @brief Moves back the iterator.
+       * @param offset the number of positions.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator-=(difference_type offset) {
+        m_current -= offset;
+        m_count   += offset;
+        return *this;
+      }
+
+      /**
+       * @brief Equality comparison: the end is reached either by the count or by the underlying view.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the iterators are equal.
+       */
+      friend constexpr bool operator==(iterator const &left, iterator const &right) {
+        return (left.m_count == right.m_count) || (left.m_current == right.m_current);
+      }
+
+      /**
+       * @brief Less than comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if left precedes right.
+       */
+      friend constexpr bool operator<(iterator const &left, iterator const &right) {
+        return right.m_count < left.m_count;
+      }
+
+      /**
+       * @brief Distance between the iterators.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return the number of elements from right to left.
+       */
+      friend constexpr difference_type operator-(iterator const &left, iterator const &right) {
+        return right.m_count - left.m_count;
+      }
+    };
+
+  private:
+    /**
+     * @brief Underlying view.
+     */
+    t_view          m_base;
+    /**
+     * @brief Maximal number of elements.
+     */
+    difference_type m_count;
+
+    /**
+     * @brief Number of elements of the random access view.
+     * @return min(count, size of the underlying view).
+     */
+    constexpr difference_type M_size() const {
+      return ::portable_stl::min(m_count, ::portable_stl::ranges::end(m_base) - ::portable_stl::ranges::begin(m_base));
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the random access view.
+     * @return the iterator to the first element.
+     */
+    constexpr iterator M_begin(::portable_stl::true_type) const {
+      return iterator(::portable_stl::ranges::begin(m_base), M_size());
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the view.
+     * @return the iterator to the first element.
+     */
+    constexpr iterator M_begin(::portable_stl::false_type) const {
+      return iterator(::portable_stl::ranges::begin(m_base), m_count);
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the random access view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator M_end(::portable_stl::true_type) const {
+      return iterator(::portable_stl::ranges::begin(m_base) + M_size(), 0);
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator M_end(::portable_stl::false_type) const {
+      return iterator(::portable_stl::ranges::end(m_base), 0);
+    }
+
+  public:
+    /**
+     * @brief Constructs the view.
+     * UB: count < 0.
+     * @param base the underlying view.
+     * @param count the maximal number of elements.
+     */
+    constexpr take_view(t_view base, difference_type count) : m_base(::portable_stl::move(base)), m_count(count) {
+    }
+
+    /**
+     * @brief Returns the underlying view.
+     * @return the underlying view.
+     */
+    constexpr t_view const &base() const noexcept {
+      return m_base;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the view.
+     * @return the iterator to the first element.
+     */
+    constexpr iterator begin() const {
+      return M_begin(t_is_random_access{});
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator end() const {
+      return M_end(t_is_random_access{});
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::take implementation.
+     */
+    class take_fn final {
+    public:
+      /**
+       * @brief Makes take_view of the range.
+       * @tparam t_range the type of the range.
+       * @tparam t_count the type of the number of elements.
+       * @param range the range.
+       * @param count the maximal number of elements.
+       * @return the view.
+       */
+      template<class t_range, class t_count>
+      constexpr ::portable_stl::ranges::take_view<::portable_stl::ranges::views::all_t<t_range>> operator()(
+        t_range &&range, t_count count) const {
+        using t_view = ::portable_stl::ranges::take_view<::portable_stl::ranges::views::all_t<t_range>>;
+        return t_view(::portable_stl::ranges::views::all(::portable_stl::forward<t_range>(range)),
+                      static_cast<typename t_view::difference_type>(count));
+      }
+
+      /**
+       * @brief Makes the closure applicable with the pipe syntax.
+       * @tparam t_count the type of the number of elements.
+       * @param count the maximal number of elements.
+       * @return the closure.
+       */
+      template<class t_count> constexpr bound_closure_t<take_fn, t_count> operator()(t_count count) const {
+        return bind_adaptor<take_fn>(count);
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the first count elements: views::take(range, count) or range | views::take(count).
+       */
+      constexpr auto const &take = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::take_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_TAKE_VIEW_H */
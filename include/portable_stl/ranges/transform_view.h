@@ -0,0 +1,294 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="transform_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_TRANSFORM_VIEW_H
+#define PSTL_TRANSFORM_VIEW_H
+
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/other_transformations/decay.h"
+#include "../metaprogramming/other_transformations/remove_cvref.h"
+#include "../utility/general/declval.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "all.h"
+#include "begin.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "range_adaptor.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  /**
+   * @brief View of the results of the function applied to the elements of the underlying view.
+   * The function is called lazily on every dereference. The iterator keeps the base iterator and the pointer to the
+   * view, so the view must outlive its iterators. The iterator keeps the category of the underlying iterator even if
+   * the function returns the value.
+   * @tparam t_view the type of the underlying common view.
+   * @tparam t_function the type of the function, it is called as const.
+   */
+  template<class t_view, class t_function>
+  class transform_view final : public ::portable_stl::ranges::view_interface<transform_view<t_view, t_function>> {
+    /**
+     * @brief Underlying iterator type.
+     */
+    using t_base_iterator = ::portable_stl::ranges::iterator_t<t_view const>;
+
+    /**
+     * @brief Underlying view.
+     */
+    t_view     m_base;
+    /**
+     * @brief Function.
+     */
+    t_function m_function;
+
+  public:
+    /**
+     * @brief Iterator of the transform_view.
+     */
+    class iterator final
+        : public ranges_helper::view_iterator_operators<
+            iterator,
+            typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type> {
+      /**
+       * @brief The view constructs its iterators.
+       */
+      friend transform_view;
+
+      /**
+       * @brief Underlying iterator.
+       */
+      t_base_iterator       m_current{};
+      /**
+       * @brief The view.
+       */
+      transform_view const *m_parent{nullptr};
+
+      /**
+       * @brief Constructs the iterator.
+       * @param parent the view.
+       * @param current the underlying iterator.
+       */
+      constexpr iterator(transform_view const *parent, t_base_iterator current)
+          : m_current(::portable_stl::move(current)), m_parent(parent) {
+      }
+
+    public:
+      /**
+       * @brief Iterator category.
+       */
+      using iterator_category
+        = ranges_helper::limit_iterator_category<t_base_iterator, ::portable_stl::random_access_iterator_tag>;
+      /**
+       * @brief Reference type: the result of the function.
+       */
+      using reference       = decltype(::portable_stl::declval<t_function const &>()(
+        *::portable_stl::declval<t_base_iterator const &>()));
+      /**
+       * @brief Value type.
+       */
+      using value_type      = ::portable_stl::remove_cvref_t<reference>;
+      /**
+       * @brief Difference type.
+       */
+      using difference_type = typename ::portable_stl::iterator_traits<t_base_iterator>::difference_type;
+      /**
+       * @brief Pointer type.
+       */
+      using pointer         = void;
+
+      /**
+       * @brief Default constructor.
+       */
+      constexpr iterator() = default;
+
+      /**
+       * @brief Returns the underlying iterator.
+       * @return the underlying iterator.
+       */
+      constexpr t_base_iterator base() const {
+        return m_current;
+      }
+
+      /**
+       * @brief Dereferences the iterator.
+       * @return the result of the function applied to the element.
+       */
+      constexpr reference operator*() const {
+        return m_parent->m_function(*m_current);
+      }
+
+      /**
+       * @brief Accesses the element by the offset.
+       * @param offset the offset of the element.
+       * @return the result of the function applied to the element.
+       */
+      constexpr reference operator[](difference_type offset) const {
+        return m_parent->m_function(m_current[offset]);
+      }
+
+      /**
+       * @brief Moves to the next element.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator++() {
+        ++m_current;
+        return *this;
+      }
+
+      /**
+       * @brief Moves to the previous element.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator--() {
+        --m_current;
+        return *this;
+      }
+
+      /**
+       * @brief Advances the iterator.
+       * @param offset the number of positions.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator+=(difference_type offset) {
+        m_current += offset;
+        return *this;
+      }
+
+      /**
+       * @brief Moves back the iterator.
+       * @param offset the number of positions.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator-=(difference_type offset) {
+        m_current -= offset;
+        return *this;
+      }
+
+      /**
+       * @brief Equality comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the underlying iterators are equal.
+       */
+      friend constexpr bool operator==(iterator const &left, iterator const &right) {
+        return left.m_current == right.m_current;
+      }
+
+      /**
+       * @brief Less than comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if left precedes right.
+       */
+      friend constexpr bool operator<(iterator const &left, iterator const &right) {
+        return left.m_current < right.m_current;
+      }
+
+      /**
+       * @brief Distance between the iterators.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return the number of elements from right to left.
+       */
+      friend constexpr difference_type operator-(iterator const &left, iterator const &right) {
+        return left.m_current - right.m_current;
+      }
+    };
+
+    /**
+     * @brief Constructs the view.
+     * @param base the underlying view.
+     * @param function the function.
+     */
+    constexpr transform_view(t_view base, t_function function)
+        : m_base(::portable_stl::move(base)), m_function(::portable_stl::move(function)) {
+    }
+
+    /**
+     * @brief Returns the underlying view.
+     * @return the underlying view.
+     */
+    constexpr t_view const &base() const noexcept {
+      return m_base;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the view.
+     * @return the iterator to the first element.
+     */
+    constexpr iterator begin() const {
+      return iterator(this, ::portable_stl::ranges::begin(m_base));
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator end() const {
+      return iterator(this, ::portable_stl::ranges::end(m_base));
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::transform implementation.
+     */
+    class transform_fn final {
+    public:
+      /**
+       * @brief Makes transform_view of the range.
+       * @tparam t_range the type of the range.
+       * @tparam t_function the type of the function.
+       * @param range the range.
+       * @param function the function.
+       * @return the view.
+       */
+      template<class t_range, class t_function>
+      constexpr ::portable_stl::ranges::
+        transform_view<::portable_stl::ranges::views::all_t<t_range>, ::portable_stl::decay_t<t_function>>
+        operator()(t_range &&range, t_function &&function) const {
+        return ::portable_stl::ranges::
+          transform_view<::portable_stl::ranges::views::all_t<t_range>, ::portable_stl::decay_t<t_function>>(
+            ::portable_stl::ranges::views::all(::portable_stl::forward<t_range>(range)),
+            ::portable_stl::forward<t_function>(function));
+      }
+
+      /**
+       * @brief Makes the closure applicable with the pipe syntax.
+       * @tparam t_function the type of the function.
+       * @param function the function.
+       * @return the closure.
+       */
+      template<class t_function>
+      constexpr bound_closure_t<transform_fn, t_function> operator()(t_function &&function) const {
+        return bind_adaptor<transform_fn>(::portable_stl::forward<t_function>(function));
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the results of the function applied to the elements: views::transform(range,
+       * function) or range | views::transform(function).
+       */
+      constexpr auto const &transform = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::transform_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_TRANSFORM_VIEW_H */
@@ -12,14 +12,21 @@
 #ifndef PSTL_VIEW_INTERFACE_H
 #define PSTL_VIEW_INTERFACE_H
 
+#include "../common/size_t.h"
 #include "../concepts/derived_from.h"
 #include "../concepts/same_as.h"
+#include "../iterator/bidirectional_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/prev.h"
+#include "../iterator/random_access_iterator_tag.h"
 #include "../metaprogramming/cv_modifications/remove_cv.h"
 #include "../metaprogramming/logical_operator/conjunction.h"
 #include "../metaprogramming/other_transformations/enable_if_bool_constant.h"
 #include "../metaprogramming/primary_type/is_class.h"
+#include "../metaprogramming/type_relations/is_base_of.h"
 #include "concepts/forward_range.h"
 #include "concepts/view.h"
+#include "iterator_t.h"
 
 // #include "../iterator/concepts/contiguous_iterator.h"
 // #include "../metaprogramming/logical_operator/disjunction.h"
@@ -28,39 +35,133 @@
 
 namespace portable_stl {
 namespace ranges {
+  namespace ranges_helper {
+    /**
+     * @brief Checks whether the iterator category of t_range is derived from t_tag.
+     * @tparam t_range the range type.
+     * @tparam t_tag the iterator category tag.
+     */
+    template<class t_range, class t_tag>
+    using has_iterator_category = ::portable_stl::is_base_of<
+      t_tag,
+      typename ::portable_stl::iterator_traits<::portable_stl::ranges::iterator_t<t_range>>::iterator_category>;
+  } // namespace ranges_helper
 
-  template<class derived_type,
-           class = ::portable_stl::enable_if_bool_constant_t<::portable_stl::conjunction<
-             ::portable_stl::is_class<derived_type>,
-             ::portable_stl::same_as<derived_type, ::portable_stl::remove_cv<derived_type>>>>>
-  class view_interface {
+  /**
+   * @brief Helper class template for defining views, using the curiously recurring template pattern.
+   * The derived view provides begin() and end(), the interface adds the members computed from them.
+   * @tparam derived_type the view type.
+   */
+  template<class derived_type, class> class view_interface {
+    /**
+     * @brief Returns the derived view.
+     * @return reference to the derived view.
+     */
     constexpr derived_type &get_derived() noexcept {
-      static_assert(sizeof(derived_type)                                          //
-                    && ::portable_stl::derived_from<derived_type, view_interface> //
-                    && ::portable_stl::ranges::view<derived_type>);
+      static_assert(::portable_stl::derived_from<derived_type, view_interface>{}(),
+                    "the view must be derived from view_interface");
       return static_cast<derived_type &>(*this);
     }
 
+    /**
+     * @brief Returns the derived view.
+     * @return reference to the derived view.
+     */
     constexpr derived_type const &get_derived() const noexcept {
-      static_assert(sizeof(derived_type)                                          //
-                    && ::portable_stl::derived_from<derived_type, view_interface> //
-                    && ::portable_stl::ranges::view<derived_type>);
+      static_assert(::portable_stl::derived_from<derived_type, view_interface>{}(),
+                    "the view must be derived from view_interface");
       return static_cast<derived_type const &>(*this);
     }
 
   public:
+    /**
+     * @brief Checks whether the view is empty.
+     * @return true if the view has no elements.
+     */
     template<class t_type = derived_type,
              ::portable_stl::enable_if_bool_constant_t<portable_stl::ranges::forward_range<t_type>, void *> = nullptr>
     constexpr bool empty() {
       return ::portable_stl::ranges::begin(get_derived()) == ::portable_stl::ranges::end(get_derived());
     }
 
+    /**
+     * @brief Checks whether the view is empty.
+     * @return true if the view has no elements.
+     */
     template<class t_type = derived_type,
              ::portable_stl::enable_if_bool_constant_t<portable_stl::ranges::forward_range<t_type const>, void *>
              = nullptr>
     constexpr bool empty() const {
       return ::portable_stl::ranges::begin(get_derived()) == ::portable_stl::ranges::end(get_derived());
     }
+
+    /**
+     * @brief Checks whether the view is not empty.
+     * @return true if the view has elements.
+     */
+    template<class t_type = derived_type,
+             ::portable_stl::enable_if_bool_constant_t<portable_stl::ranges::forward_range<t_type const>, void *>
+             = nullptr>
+    constexpr explicit operator bool() const {
+      return !empty();
+    }
+
+    /**
+     * @brief Returns the number of elements of the random access view.
+     * @return the number of elements.
+     */
+    template<class t_type = derived_type,
+             ::portable_stl::enable_if_bool_constant_t<
+               ranges_helper::has_iterator_category<t_type const, ::portable_stl::random_access_iterator_tag>,
+               void *>
+             = nullptr>
+    constexpr ::portable_stl::size_t size() const {
+      return static_cast<::portable_stl::size_t>(::portable_stl::ranges::end(get_derived())
+                                                 - ::portable_stl::ranges::begin(get_derived()));
+    }
+
+    /**
+     * @brief Returns the first element.
+     * UB: the view is empty.
+     * @return the first element.
+     */
+    template<class t_type = derived_type,
+             ::portable_stl::enable_if_bool_constant_t<portable_stl::ranges::forward_range<t_type const>, void *>
+             = nullptr>
+    constexpr decltype(auto) front() const {
+      return *::portable_stl::ranges::begin(get_derived());
+    }
+
+    /**
+     * @brief Returns the last element of the bidirectional view.
+     * UB: the view is empty.
+     * @return the last element.
+     */
+    template<class t_type = derived_type,
+             ::portable_stl::enable_if_bool_constant_t<
+               ranges_helper::has_iterator_category<t_type const, ::portable_stl::bidirectional_iterator_tag>,
+               void *>
+             = nullptr>
+    constexpr decltype(auto) back() const {
+      return *::portable_stl::prev(::portable_stl::ranges::end(get_derived()));
+    }
+
+    /**
+     * @brief Returns the element of the random access view.
+     * UB: index >= size().
+     * @param index the index of the element.
+     * @return the element.
+     */
+    template<class t_type = derived_type,
+             ::portable_stl::enable_if_bool_constant_t<
+               ranges_helper::has_iterator_category<t_type const, ::portable_stl::random_access_iterator_tag>,
+               void *>
+             = nullptr>
+    constexpr decltype(auto) operator[](::portable_stl::size_t index) const {
+      return ::portable_stl::ranges::begin(get_derived())[static_cast<
+        typename ::portable_stl::iterator_traits<::portable_stl::ranges::iterator_t<t_type const>>::difference_type>(
+        index)];
+    }
   };
 } // namespace ranges
 } // namespace portable_stl
@@ -0,0 +1,228 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="view_iterator_helper.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_VIEW_ITERATOR_HELPER_H
+#define PSTL_VIEW_ITERATOR_HELPER_H
+
+#include "../metaprogramming/other_transformations/conditional_bool_constant.h"
+#include "../iterator/bidirectional_iterator_tag.h"
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/input_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/type_relations/is_base_of.h"
+
+namespace portable_stl {
+namespace ranges {
+  namespace ranges_helper {
+    /**
+     * @brief Derived operators of the view iterators.
+     * The iterator defines operator==, prefix operator++ and operator--, operator+=, operator-=, operator< and the
+     * difference of two iterators, the base adds the rest. The operators are instantiated only when used, so forward
+     * iterators may derive from the base as well. The base is empty and keeps the iterator trivially copyable.
+     * @tparam t_iterator the view iterator type.
+     * @tparam t_difference the difference type of the iterator.
+     */
+    template<class t_iterator, class t_difference> class view_iterator_operators {
+    public:
+      /**
+       * @brief Postfix increment.
+       * @param iter the iterator.
+       * @return the iterator before the increment.
+       */
+      friend constexpr t_iterator operator++(t_iterator &iter, int) {
+        t_iterator result{iter};
+        ++iter;
+        return result;
+      }
+
+      /**
+       * @brief Postfix decrement.
+       * @param iter the iterator.
+       * @return the iterator before the decrement.
+       */
+      friend constexpr t_iterator operator--(t_iterator &iter, int) {
+        t_iterator result{iter};
+        --iter;
+        return result;
+      }
+
+      /**
+       * @brief Inequality comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return !(left == right).
+       */
+      friend constexpr bool operator!=(t_iterator const &left, t_iterator const &right) {
+        return !(left == right);
+      }
+
+      /**
+       * @brief Advances the copy of the iterator.
+       * @param iter the iterator.
+       * @param offset the number of positions.
+       * @return the advanced iterator.
+       */
+      friend constexpr t_iterator operator+(t_iterator iter, t_difference offset) {
+        iter += offset;
+        return iter;
+      }
+
+      /**
+       * @brief Advances the copy of the iterator.
+       * @param offset the number of positions.
+       * @param iter the iterator.
+       * @return the advanced iterator.
+       */
+      friend constexpr t_iterator operator+(t_difference offset, t_iterator iter) {
+        iter += offset;
+        return iter;
+      }
+
+      /**
+       * @brief Moves back the copy of the iterator.
+       * @param iter the iterator.
+       * @param offset the number of positions.
+       * @return the moved iterator.
+       */
+      friend constexpr t_iterator operator-(t_iterator iter, t_difference offset) {
+        iter -= offset;
+        return iter;
+      }
+
+      /**
+       * @brief Greater than comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return right < left.
+       */
+      friend constexpr bool operator>(t_iterator const &left, t_iterator const &right) {
+        return right < left;
+      }
+
+      /**
+       * @brief Less than or equal comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return !(right < left).
+       */
+      friend constexpr bool operator<=(t_iterator const &left, t_iterator const &right) {
+        return !(right < left);
+      }
+
+      /**
+       * @brief Greater than or equal comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return !(left < right).
+       */
+      friend constexpr bool operator>=(t_iterator const &left, t_iterator const &right) {
+        return !(left < right);
+      }
+    };
+
+    /**
+     * @brief Portable category of the iterator category: the strongest portable_stl iterator tag t_category is derived
+     * from, input_iterator_tag for unknown categories.
+     * @tparam t_category the iterator category.
+     */
+    template<class t_category>
+    using portable_iterator_category = ::portable_stl::conditional_bool_constant_t<
+      ::portable_stl::is_base_of<::portable_stl::random_access_iterator_tag, t_category>,
+      ::portable_stl::random_access_iterator_tag,
+      ::portable_stl::conditional_bool_constant_t<
+        ::portable_stl::is_base_of<::portable_stl::bidirectional_iterator_tag, t_category>,
+        ::portable_stl::bidirectional_iterator_tag,
+        ::portable_stl::conditional_bool_constant_t<
+          ::portable_stl::is_base_of<::portable_stl::forward_iterator_tag, t_category>,
+          ::portable_stl::forward_iterator_tag,
+          ::portable_stl::input_iterator_tag>>>;
+
+    /**
+     * @brief Iterator category of the view iterator: the category of the base iterator limited by t_max_category.
+     * @tparam t_iterator the base iterator type.
+     * @tparam t_max_category the strongest category the view supports.
+     */
+    template<class t_iterator, class t_max_category>
+    using limit_iterator_category = ::portable_stl::conditional_bool_constant_t<
+      ::portable_stl::is_base_of<t_max_category,
+                                 portable_iterator_category<
+                                   typename ::portable_stl::iterator_traits<t_iterator>::iterator_category>>,
+      t_max_category,
+      portable_iterator_category<typename ::portable_stl::iterator_traits<t_iterator>::iterator_category>>;
+
+    /**
+     * @brief Checks if the iterator supports the category.
+     * @tparam t_iterator the view iterator type.
+     * @tparam t_category the iterator category.
+     */
+    template<class t_iterator, class t_category>
+    using is_iterator_category = ::portable_stl::is_base_of<
+      t_category,
+      portable_iterator_category<typename ::portable_stl::iterator_traits<t_iterator>::iterator_category>>;
+
+    /**
+     * @brief Advances the random access iterator by count positions but not beyond last.
+     * @tparam t_iterator the iterator type.
+     * @param first the iterator.
+     * @param count the number of positions.
+     * @param last the bound.
+     * @return the advanced iterator.
+     */
+    template<class t_iterator>
+    constexpr t_iterator bounded_next_impl(t_iterator                                                           first,
+                                           typename ::portable_stl::iterator_traits<t_iterator>::difference_type count,
+                                           t_iterator                                                           last,
+                                           ::portable_stl::true_type) {
+      return ((last - first) < count) ? last : (first + count);
+    }
+
+    /**
+     * @brief Advances the iterator by count positions but not beyond last.
+     * @tparam t_iterator the iterator type.
+     * @param first the iterator.
+     * @param count the number of positions.
+     * @param last the bound.
+     * @return the advanced iterator.
+     */
+    template<class t_iterator>
+    constexpr t_iterator bounded_next_impl(t_iterator                                                           first,
+                                           typename ::portable_stl::iterator_traits<t_iterator>::difference_type count,
+                                           t_iterator                                                           last,
+                                           ::portable_stl::false_type) {
+      for (; (count > 0) && (first != last); --count) {
+        ++first;
+      }
+      return first;
+    }
+
+    /**
+     * @brief Advances the iterator by count positions but not beyond last: in constant time for random access
+     * iterators and in linear time for the other iterators.
+     * @tparam t_iterator the iterator type.
+     * @param first the iterator.
+     * @param count the number of positions.
+     * @param last the bound.
+     * @return the advanced iterator.
+     */
+    template<class t_iterator>
+    constexpr t_iterator bounded_next(t_iterator                                                           first,
+                                      typename ::portable_stl::iterator_traits<t_iterator>::difference_type count,
+                                      t_iterator                                                           last) {
+      return bounded_next_impl(
+        first, count, last, is_iterator_category<t_iterator, ::portable_stl::random_access_iterator_tag>{});
+    }
+  } // namespace ranges_helper
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_VIEW_ITERATOR_HELPER_H */
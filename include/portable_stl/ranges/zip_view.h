@@ -0,0 +1,471 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="zip_view.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_ZIP_VIEW_H
+#define PSTL_ZIP_VIEW_H
+
+#include "../common/numeric_limits.h"
+#include "../common/ptrdiff_t.h"
+#include "../common/size_t.h"
+#include "../iterator/forward_iterator_tag.h"
+#include "../iterator/input_iterator_tag.h"
+#include "../iterator/iterator_traits.h"
+#include "../iterator/random_access_iterator_tag.h"
+#include "../metaprogramming/helper/integral_constant.h"
+#include "../metaprogramming/integer_sequence/integer_sequence.h"
+#include "../metaprogramming/integer_sequence/make_index_sequence.h"
+#include "../metaprogramming/logical_operator/conjunction.h"
+#include "../metaprogramming/other_transformations/conditional_bool_constant.h"
+#include "../utility/general/forward.h"
+#include "../utility/general/move.h"
+#include "../utility/tuple/tuple.h"
+#include "all.h"
+#include "begin.h"
+#include "end.h"
+#include "iterator_t.h"
+#include "range_adaptor.h"
+#include "view_interface.h"
+#include "view_iterator_helper.h"
+
+namespace portable_stl {
+namespace ranges {
+  namespace ranges_helper {
+    /**
+     * @brief Element of zip_storage.
+     * @tparam t_index the index of the element.
+     * @tparam t_type the type of the element.
+     */
+    template<::portable_stl::size_t t_index, class t_type> class zip_element {
+    public:
+      /**
+       * @brief Stored value.
+       */
+      t_type m_value{};
+    };
+
+    /**
+     * @brief Storage of the iterators of zip_view. Unlike tuple it is trivially copyable if the iterators are.
+     * @tparam t_indexes the index sequence of the iterators.
+     * @tparam t_types the types of the iterators.
+     */
+    template<class t_indexes, class... t_types> class zip_storage;
+
+    /**
+     * @brief Storage of the iterators of zip_view. Unlike tuple it is trivially copyable if the iterators are.
+     * @tparam t_indexes the indexes of the iterators.
+     * @tparam t_types the types of the iterators.
+     */
+    template<::portable_stl::size_t... t_indexes, class... t_types>
+    class zip_storage<::portable_stl::index_sequence<t_indexes...>, t_types...> final
+        : public zip_element<t_indexes, t_types>... {
+    public:
+      /**
+       * @brief Default constructor.
+       */
+      constexpr zip_storage() = default;
+
+      /**
+       * @brief Constructs the storage of the values.
+       * @param values the stored values.
+       */
+      constexpr explicit zip_storage(t_types... values)
+          : zip_element<t_indexes, t_types>{::portable_stl::move(values)}... {
+      }
+    };
+
+    /**
+     * @brief Accesses the element of zip_storage.
+     * @tparam t_index the index of the element.
+     * @tparam t_type the type of the element.
+     * @param element the storage.
+     * @return the reference to the element.
+     */
+    template<::portable_stl::size_t t_index, class t_type>
+    constexpr t_type &zip_get(zip_element<t_index, t_type> &element) noexcept {
+      return element.m_value;
+    }
+
+    /**
+     * @brief Accesses the element of zip_storage.
+     * @tparam t_index the index of the element.
+     * @tparam t_type the type of the element.
+     * @param element the storage.
+     * @return the reference to the element.
+     */
+    template<::portable_stl::size_t t_index, class t_type>
+    constexpr t_type const &zip_get(zip_element<t_index, t_type> const &element) noexcept {
+      return element.m_value;
+    }
+  } // namespace ranges_helper
+
+  /**
+   * @brief View of the tuples of the corresponding elements of the underlying views.
+   * The view ends with the shortest underlying view. The iterator is random access if all underlying iterators are
+   * random access, forward if all of them are at least forward and input otherwise.
+   * @tparam t_views the types of the underlying common views.
+   */
+  template<class... t_views>
+  class zip_view final : public ::portable_stl::ranges::view_interface<zip_view<t_views...>> {
+    static_assert(sizeof...(t_views) > 0U, "zip_view requires at least one view");
+
+    /**
+     * @brief Index sequence of the underlying views.
+     */
+    using t_indexes = ::portable_stl::index_sequence_for<t_views...>;
+
+    /**
+     * @brief Storage of the underlying iterators.
+     */
+    using t_storage = ranges_helper::zip_storage<t_indexes, ::portable_stl::ranges::iterator_t<t_views const>...>;
+
+    /**
+     * @brief Checks if all underlying iterators are random access iterators.
+     */
+    using t_is_random_access = ::portable_stl::conjunction<
+      ranges_helper::is_iterator_category<::portable_stl::ranges::iterator_t<t_views const>,
+                                          ::portable_stl::random_access_iterator_tag>...>;
+
+    /**
+     * @brief Checks if all underlying iterators are forward iterators.
+     */
+    using t_is_forward = ::portable_stl::conjunction<
+      ranges_helper::is_iterator_category<::portable_stl::ranges::iterator_t<t_views const>,
+                                          ::portable_stl::forward_iterator_tag>...>;
+
+    /**
+     * @brief Underlying views.
+     */
+    ::portable_stl::tuple<t_views...> m_views;
+
+  public:
+    /**
+     * @brief Difference type.
+     */
+    using difference_type = ::portable_stl::ptrdiff_t;
+
+    /**
+     * @brief Iterator of the zip_view.
+     */
+    class iterator final : public ranges_helper::view_iterator_operators<iterator, ::portable_stl::ptrdiff_t> {
+      /**
+       * @brief The view constructs its iterators.
+       */
+      friend zip_view;
+
+      /**
+       * @brief Underlying iterators.
+       */
+      t_storage m_current{};
+
+      /**
+       * @brief Constructs the iterator.
+       * @param current the underlying iterators.
+       */
+      constexpr explicit iterator(t_storage current) : m_current(current) {
+      }
+
+    public:
+      /**
+       * @brief Iterator category.
+       */
+      using iterator_category = ::portable_stl::conditional_bool_constant_t<
+        t_is_random_access,
+        ::portable_stl::random_access_iterator_tag,
+        ::portable_stl::conditional_bool_constant_t<t_is_forward,
+                                                    ::portable_stl::forward_iterator_tag,
+                                                    ::portable_stl::input_iterator_tag>>;
+      /**
+       * @brief Value type: the tuple of the values.
+       */
+      using value_type      = ::portable_stl::tuple<
+        typename ::portable_stl::iterator_traits<::portable_stl::ranges::iterator_t<t_views const>>::value_type...>;
+      /**
+       * @brief Reference type: the tuple of the references.
+       */
+      using reference       = ::portable_stl::tuple<
+        typename ::portable_stl::iterator_traits<::portable_stl::ranges::iterator_t<t_views const>>::reference...>;
+      /**
+       * @brief Difference type.
+       */
+      using difference_type = ::portable_stl::ptrdiff_t;
+      /**
+       * @brief Pointer type.
+       */
+      using pointer         = void;
+
+    private:
+      /**
+       * @brief Dereferences the underlying iterators.
+       * @tparam t_index the indexes of the iterators.
+       * @return the tuple of the references.
+       */
+      template<::portable_stl::size_t... t_index>
+      constexpr reference M_dereference(::portable_stl::index_sequence<t_index...>) const {
+        return reference(*ranges_helper::zip_get<t_index>(m_current)...);
+      }
+
+      /**
+       * @brief Advances the underlying iterators.
+       * @tparam t_index the indexes of the iterators.
+       * @param offset the number of positions.
+       */
+      template<::portable_stl::size_t... t_index>
+      constexpr void M_advance(difference_type offset, ::portable_stl::index_sequence<t_index...>) {
+        int const unused[]{(static_cast<void>(ranges_helper::zip_get<t_index>(m_current) += offset), 0)...};
+        static_cast<void>(unused);
+      }
+
+      /**
+       * @brief Increments the underlying iterators.
+       * @tparam t_index the indexes of the iterators.
+       */
+      template<::portable_stl::size_t... t_index>
+      constexpr void M_increment(::portable_stl::index_sequence<t_index...>) {
+        int const unused[]{(static_cast<void>(++ranges_helper::zip_get<t_index>(m_current)), 0)...};
+        static_cast<void>(unused);
+      }
+
+      /**
+       * @brief Decrements the underlying iterators.
+       * @tparam t_index the indexes of the iterators.
+       */
+      template<::portable_stl::size_t... t_index>
+      constexpr void M_decrement(::portable_stl::index_sequence<t_index...>) {
+        int const unused[]{(static_cast<void>(--ranges_helper::zip_get<t_index>(m_current)), 0)...};
+        static_cast<void>(unused);
+      }
+
+      /**
+       * @brief Checks if any underlying iterator is equal to the corresponding iterator of other.
+       * @tparam t_index the indexes of the iterators.
+       * @param other the other iterator.
+       * @return true if any underlying iterators are equal.
+       */
+      template<::portable_stl::size_t... t_index>
+      constexpr bool M_any_equal(iterator const &other, ::portable_stl::index_sequence<t_index...>) const {
+        bool      result{false};
+        int const unused[]{
+          (result = result
+                 || (ranges_helper::zip_get<t_index>(m_current) == ranges_helper::zip_get<t_index>(other.m_current)),
+           0)...};
+        static_cast<void>(unused);
+        return result;
+      }
+
+    public:
+      /**
+       * @brief Default constructor.
+       */
+      constexpr iterator() = default;
+
+      /**
+       * @brief Dereferences the iterator.
+       * @return the tuple of the references to the elements.
+       */
+      constexpr reference operator*() const {
+        return M_dereference(t_indexes{});
+      }
+
+      /**
+       * @brief Accesses the elements by the offset.
+       * @param offset the offset of the elements.
+       * @return the tuple of the references to the elements.
+       */
+      constexpr reference operator[](difference_type offset) const {
+        return *(*this + offset);
+      }
+
+      /**
+       * @brief Moves to the next elements.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator++() {
+        M_increment(t_indexes{});
+        return *this;
+      }
+
+      /**
+       * @brief Moves to the previous elements.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator--() {
+        M_decrement(t_indexes{});
+        return *this;
+      }
+
+      /**
+       * @brief Advances the iterator.
+       * @param offset the number of positions.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator+=(difference_type offset) {
+        M_advance(offset, t_indexes{});
+        return *this;
+      }
+
+      /**
+       * @brief Moves back the iterator.
+       * @param offset the number of positions.
+       * @return reference to this iterator.
+       */
+      constexpr iterator &operator-=(difference_type offset) {
+        M_advance(-offset, t_indexes{});
+        return *this;
+      }
+
+      /**
+       * @brief Equality comparison: the iterators are equal if any of the underlying iterators are equal, so the end
+       * of the shortest view ends the iteration.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if the iterators are equal.
+       */
+      friend constexpr bool operator==(iterator const &left, iterator const &right) {
+        return left.M_any_equal(right, t_indexes{});
+      }
+
+      /**
+       * @brief Less than comparison.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return true if left precedes right.
+       */
+      friend constexpr bool operator<(iterator const &left, iterator const &right) {
+        return ranges_helper::zip_get<0U>(left.m_current) < ranges_helper::zip_get<0U>(right.m_current);
+      }
+
+      /**
+       * @brief Distance between the iterators.
+       * @param left the first iterator.
+       * @param right the second iterator.
+       * @return the number of elements from right to left.
+       */
+      friend constexpr difference_type operator-(iterator const &left, iterator const &right) {
+        return static_cast<difference_type>(ranges_helper::zip_get<0U>(left.m_current)
+                                            - ranges_helper::zip_get<0U>(right.m_current));
+      }
+    };
+
+  private:
+    /**
+     * @brief Returns the iterators to the beginning of the underlying views.
+     * @tparam t_index the indexes of the views.
+     * @return the iterator.
+     */
+    template<::portable_stl::size_t... t_index>
+    constexpr iterator M_begin(::portable_stl::index_sequence<t_index...>) const {
+      return iterator(t_storage(::portable_stl::ranges::begin(::portable_stl::get<t_index>(m_views))...));
+    }
+
+    /**
+     * @brief Returns the iterators to the end of the underlying views.
+     * @tparam t_index the indexes of the views.
+     * @return the iterator.
+     */
+    template<::portable_stl::size_t... t_index>
+    constexpr iterator M_end(::portable_stl::index_sequence<t_index...>) const {
+      return iterator(t_storage(::portable_stl::ranges::end(::portable_stl::get<t_index>(m_views))...));
+    }
+
+    /**
+     * @brief Size of the shortest random access view.
+     * @tparam t_index the indexes of the views.
+     * @return the number of the elements of the view.
+     */
+    template<::portable_stl::size_t... t_index>
+    constexpr difference_type M_size(::portable_stl::index_sequence<t_index...>) const {
+      difference_type result{::portable_stl::numeric_limits<difference_type>::max()};
+      difference_type const sizes[]{
+        static_cast<difference_type>(::portable_stl::ranges::end(::portable_stl::get<t_index>(m_views))
+                                     - ::portable_stl::ranges::begin(::portable_stl::get<t_index>(m_views)))...};
+      for (difference_type const size : sizes) {
+        if (size < result) {
+          result = size;
+        }
+      }
+      return result;
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the random access view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator M_end(::portable_stl::true_type) const {
+      return M_begin(t_indexes{}) + M_size(t_indexes{});
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator M_end(::portable_stl::false_type) const {
+      return M_end(t_indexes{});
+    }
+
+  public:
+    /**
+     * @brief Constructs the view.
+     * @param views the underlying views.
+     */
+    constexpr explicit zip_view(t_views... views) : m_views(::portable_stl::move(views)...) {
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the view.
+     * @return the iterator to the first elements.
+     */
+    constexpr iterator begin() const {
+      return M_begin(t_indexes{});
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the view.
+     * @return the iterator to the end.
+     */
+    constexpr iterator end() const {
+      return M_end(t_is_random_access{});
+    }
+  };
+
+  namespace ranges_helper {
+    /**
+     * @brief views::zip implementation.
+     */
+    class zip_fn final {
+    public:
+      /**
+       * @brief Makes zip_view of the ranges.
+       * @tparam t_ranges the types of the ranges.
+       * @param ranges the ranges.
+       * @return the view.
+       */
+      template<class... t_ranges>
+      constexpr ::portable_stl::ranges::zip_view<::portable_stl::ranges::views::all_t<t_ranges>...> operator()(
+        t_ranges &&...ranges) const {
+        return ::portable_stl::ranges::zip_view<::portable_stl::ranges::views::all_t<t_ranges>...>(
+          ::portable_stl::ranges::views::all(::portable_stl::forward<t_ranges>(ranges))...);
+      }
+    };
+  } // namespace ranges_helper
+
+  namespace views {
+    namespace {
+      /**
+       * @brief Makes the view of the tuples of the corresponding elements: views::zip(range1, range2, ...).
+       */
+      constexpr auto const &zip = ::portable_stl::ranges::ranges_helper::static_const_wrapper<
+        ::portable_stl::ranges::ranges_helper::zip_fn>::value;
+    } // namespace
+  } // namespace views
+} // namespace ranges
+} // namespace portable_stl
+
+#endif /* PSTL_ZIP_VIEW_H */
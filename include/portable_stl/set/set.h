@@ -16,7 +16,9 @@
 #include "../algorithm/lexicographical_compare.h"
 #include "../containers/insert_return_type.h"
 #include "../containers/node_handle.h"
+#include "../containers/sorted_tags.h"
 #include "../containers/tree.h"
+#include "../containers/tree_set_operations.h"
 #include "../functional/is_transparent.h"
 #include "../functional/less.h"
 #include "../iterator/reverse_iterator.h"
@@ -286,6 +288,88 @@ public:
     return make_set(first, last, value_compare(), alloc);
   }
 
+  /**
+   * @brief Constructs the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted and has no equivalent keys with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   */
+  template<class t_input_iterator>
+  set(::portable_stl::sorted_unique_t,
+      t_input_iterator     first,
+      t_input_iterator     last,
+      value_compare const &comp = value_compare())
+      : m_tree(comp) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.build_unique(first, last));
+  }
+
+  /**
+   * @brief Makes the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted and has no equivalent keys with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @return ::portable_stl::expected<set, ::portable_stl::portable_stl_error>.
+   */
+  template<class t_input_iterator>
+  static ::portable_stl::expected<set, ::portable_stl::portable_stl_error> make_set(
+    ::portable_stl::sorted_unique_t tag,
+    t_input_iterator                first,
+    t_input_iterator                last,
+    value_compare const            &comp = value_compare()) {
+    return make_set(tag, first, last, comp, allocator_type());
+  }
+
+  /**
+   * @brief Constructs the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted and has no equivalent keys with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   */
+  template<class t_input_iterator>
+  set(::portable_stl::sorted_unique_t,
+      t_input_iterator      first,
+      t_input_iterator      last,
+      value_compare const  &comp,
+      allocator_type const &alloc)
+      : m_tree(comp, alloc) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.build_unique(first, last));
+  }
+
+  /**
+   * @brief Makes the container with the contents of the sorted range [first, last) in linear time.
+   * UB: the range is not sorted and has no equivalent keys with respect to comp.
+   *
+   * @tparam t_input_iterator Must meet the requirements of LegacyInputIterator.
+   * @param first The range to copy the elements from.
+   * @param last The range to copy the elements from.
+   * @param comp Comparison function object to use for all comparisons of keys.
+   * @param alloc Allocator to use for all memory allocations of this container.
+   * @return ::portable_stl::expected<set, ::portable_stl::portable_stl_error>.
+   */
+  template<class t_input_iterator>
+  static ::portable_stl::expected<set, ::portable_stl::portable_stl_error> make_set(
+    ::portable_stl::sorted_unique_t,
+    t_input_iterator      first,
+    t_input_iterator      last,
+    value_compare const  &comp,
+    allocator_type const &alloc) {
+    set ret(comp, alloc);
+    return ret.m_tree.build_unique(first, last)
+      .and_then([&ret](void) -> ::portable_stl::expected<set, ::portable_stl::portable_stl_error> {
+        return {::portable_stl::in_place_t{}, ::portable_stl::move(ret)};
+      });
+  }
+
   /**
    * @brief Copy constructor.
    * Constructs the set with the copy of the contents of other.
@@ -371,12 +455,13 @@ public:
 
   /**
    * @brief Copy assignment operator. Replaces the contents with a copy of the contents of other.
+   * The existing nodes are reused for the copied elements.
    *
    * @param other Another set to use as data source.
    * @return set&
    */
   set &operator=(set const &other) {
-    m_tree = other.m_tree;
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!m_tree.copy_assign(other.m_tree));
     return *this;
   }
 
@@ -663,6 +748,10 @@ public:
   template<class t_input_iterator>
   ::portable_stl::expected<void, ::portable_stl::portable_stl_error> insert(t_input_iterator first,
                                                                             t_input_iterator last) {
+    if (empty()) {
+      // linear time for the sorted range
+      return m_tree.build_unique(first, last);
+    }
     for (const_iterator end_iter = cend(); first != last; ++first) {
       auto result = m_tree.insert_unique(end_iter, *first);
       if (!result) {
@@ -755,6 +844,23 @@ public:
     m_tree.clear();
   }
 
+  /**
+   * @brief Moves all the elements into one contiguous memory block in the sorted order, so the iteration and the
+   * lookups walk the memory sequentially. Useful for a long-lived container which is rarely modified. The elements
+   * are move constructed in the block and the old nodes are deallocated. Complexity is linear in the size of the
+   * container.
+   * Invalidates all references, pointers and iterators referring to the elements. Any past-the-end iterator remains
+   * valid. Elements inserted later are allocated separately. Elements leaving the container (extract(), merge() into
+   * another container, split() unless their whole block leaves) are moved to separately allocated nodes first, which
+   * invalidates references to them.
+   *
+   * @return ::portable_stl::expected<void, ::portable_stl::portable_stl_error> error if the block allocation failed,
+   * the set is not changed then.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> compact() {
+    return m_tree.compact();
+  }
+
   /**
    * @brief If the set has an element with key equivalent to 'key', unlinks the node that contains that element from the
    * set and returns a node handle that owns it. Otherwise, returns an empty node handle.
@@ -768,6 +874,8 @@ public:
 
   /**
    * @brief Unlinks the node that contains the element pointed to by position and returns a node handle that owns it.
+   * If the container is compacted (see compact()) and the element can not be moved to a separately allocated node, the
+   * element stays in the container and an empty node handle is returned.
    *
    * @param pos A valid iterator into this container.
    * @return node_type A node handle that owns the extracted element.
@@ -927,6 +1035,99 @@ public:
     return find(key_value) != end();
   }
 
+  /**
+   * @brief Looks up a batch of keys, writes lower_bound(key) for every key of [first, last) to out. Keys coming in
+   * ascending order are looked up by finger search from the previous result, other keys are looked up by several
+   * interleaved descents from the root with software prefetch of the next nodes.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) {
+    return m_tree.lower_bound_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes lower_bound(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts const_iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator lower_bound_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.lower_bound_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes find(key) for every key of [first, last) to out. The lookup is done as in
+   * lower_bound_many().
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator find_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) {
+    return m_tree.find_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes find(key) for every key of [first, last) to out.
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts const_iterator.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator find_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.find_many(first, last, out);
+  }
+
+  /**
+   * @brief Looks up a batch of keys, writes contains(key) for every key of [first, last) to out. The lookup is done
+   * as in lower_bound_many().
+   *
+   * @tparam t_forward_iterator the type of the keys iterator.
+   * @tparam t_output_iterator the type of the output iterator, accepts bool.
+   * @param first the beginning of the keys.
+   * @param last the end of the keys.
+   * @param out the beginning of the destination range.
+   * @return t_output_iterator Iterator past the last written element.
+   */
+  template<class t_forward_iterator, class t_output_iterator>
+  t_output_iterator contains_many(t_forward_iterator first, t_forward_iterator last, t_output_iterator out) const {
+    return m_tree.contains_many(first, last, out);
+  }
+
+  /**
+   * @brief Returns an iterator pointing to the first element at or after pos that is not less than key. The search
+   * walks the tree from pos, so its cost is logarithmic in the distance to the result. It is used by the set
+   * operations to skip the runs of the longer container.
+   *
+   * @param pos Position to start the search from.
+   * @param key Key value to compare the elements to.
+   * @return const_iterator Iterator pointing to the first element at or after pos that is not less than key. If no
+   * such element is found, a past-the-end iterator (see end()) is returned.
+   */
+  const_iterator lower_bound_from(const_iterator pos, key_type const &key) const {
+    return m_tree.lower_bound_from(pos, key);
+  }
+
   /**
    * @brief Returns an iterator pointing to the first element that is not less than (i.e. greater or equal to) key.
    *
@@ -1272,6 +1473,149 @@ inline void swap(set<t_key, t_compare, t_allocator> &lhv,
   lhv.swap(rhv);
 }
 
+/**
+ * @brief Copies the elements found in either of the sets to the sorted range beginning at out. For
+ * equivalent keys the element of lhv is copied.
+ * The sets are walked directly: the runs of one set between the elements of the other one are skipped
+ * by finger search from the current node, so the cost of a short set against a long one depends on the
+ * distances between the matches, not on the size of the long set.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first set.
+ * @param rhv The second set, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_compare, class t_allocator, class t_output_iterator>
+inline t_output_iterator set_union(set<t_key, t_compare, t_allocator> const &lhv,
+                                   set<t_key, t_compare, t_allocator> const &rhv,
+                                   t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_set_union(lhv, rhv, out, ::portable_stl::tree_helper::tree_value_key{});
+}
+
+/**
+ * @brief Copies the elements of lhv whose keys are found in rhv to the sorted range beginning at out.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first set.
+ * @param rhv The second set, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_compare, class t_allocator, class t_output_iterator>
+inline t_output_iterator set_intersection(set<t_key, t_compare, t_allocator> const &lhv,
+                                          set<t_key, t_compare, t_allocator> const &rhv,
+                                          t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_set_intersection(
+    lhv, rhv, out, ::portable_stl::tree_helper::tree_value_key{});
+}
+
+/**
+ * @brief Copies the elements of lhv whose keys are not found in rhv to the sorted range beginning at out.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first set.
+ * @param rhv The second set, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_compare, class t_allocator, class t_output_iterator>
+inline t_output_iterator set_difference(set<t_key, t_compare, t_allocator> const &lhv,
+                                        set<t_key, t_compare, t_allocator> const &rhv,
+                                        t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_set_difference(lhv, rhv, out, ::portable_stl::tree_helper::tree_value_key{});
+}
+
+/**
+ * @brief Copies the elements whose keys are found in exactly one of the sets to the sorted range
+ * beginning at out.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first set.
+ * @param rhv The second set, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_compare, class t_allocator, class t_output_iterator>
+inline t_output_iterator set_symmetric_difference(set<t_key, t_compare, t_allocator> const &lhv,
+                                                  set<t_key, t_compare, t_allocator> const &rhv,
+                                                  t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_set_symmetric_difference(
+    lhv, rhv, out, ::portable_stl::tree_helper::tree_value_key{});
+}
+
+/**
+ * @brief Copies the elements of both sets to the sorted range beginning at out. The element of lhv
+ * precedes the element of rhv with the equivalent key.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @tparam t_output_iterator Output iterator type.
+ * @param lhv The first set.
+ * @param rhv The second set, ordered by the comparison equivalent to the one of lhv.
+ * @param out The beginning of the destination range.
+ * @return t_output_iterator Iterator past the last copied element.
+ */
+template<class t_key, class t_compare, class t_allocator, class t_output_iterator>
+inline t_output_iterator merge(set<t_key, t_compare, t_allocator> const &lhv,
+                               set<t_key, t_compare, t_allocator> const &rhv,
+                               t_output_iterator out) {
+  return ::portable_stl::tree_helper::tree_merge(lhv, rhv, out, ::portable_stl::tree_helper::tree_value_key{});
+}
+
+/**
+ * @brief Checks if every key of rhv is found in lhv.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @param lhv The first set.
+ * @param rhv The second set, ordered by the comparison equivalent to the one of lhv.
+ * @return true if the keys of rhv are a subset of the keys of lhv,
+ * @return false otherwise.
+ */
+template<class t_key, class t_compare, class t_allocator>
+inline bool includes(set<t_key, t_compare, t_allocator> const &lhv, set<t_key, t_compare, t_allocator> const &rhv) {
+  return ::portable_stl::tree_helper::tree_includes(lhv, rhv, ::portable_stl::tree_helper::tree_value_key{});
+}
+
+/**
+ * @brief Merges two sets into one by splicing the nodes, no element is copied or allocated.
+ * The nodes of the smaller set are moved into the larger one (see set::merge()), which is then moved to the
+ * result, so the cost is O(m log(n + m)) for the sizes n >= m. The elements of the smaller set whose keys are
+ * already present in the larger one stay in the smaller set, the other set is left empty.
+ *
+ * @tparam t_key Keys type.
+ * @tparam t_compare Key compare type.
+ * @tparam t_allocator Allocator type.
+ * @param lhv The first set.
+ * @param rhv The second set, using the equal allocator.
+ * @return set The set containing the elements of both.
+ */
+template<class t_key, class t_compare, class t_allocator>
+inline set<t_key, t_compare, t_allocator> merge(set<t_key, t_compare, t_allocator> &lhv,
+                                                set<t_key, t_compare, t_allocator> &rhv) {
+  if (lhv.size() < rhv.size()) {
+    rhv.merge(lhv);
+    return ::portable_stl::move(rhv);
+  }
+  lhv.merge(rhv);
+  return ::portable_stl::move(lhv);
+}
+
 } // namespace portable_stl
 
 #endif // SET_H
@@ -0,0 +1,654 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="aho_corasick.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_AHO_CORASICK_H
+#define PSTL_AHO_CORASICK_H
+
+#include "../common/size_t.h"
+#include "../common/uint16_t.h"
+#include "../common/uint32_t.h"
+#include "../error/portable_stl_error.h"
+#include "../language_support/bad_alloc.h"
+#include "../language_support/length_error.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/move.h"
+#include "../vector/vector.h"
+#include "aho_corasick_iterator.h"
+#include "basic_string_view.h"
+#include "char_traits.h"
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#  include "../language_support/exception/throw_on_true.h"
+#else
+#  include "../language_support/no_exception/throw_on_true.h"
+#endif
+
+namespace portable_stl {
+/**
+ * @brief Representation of the aho_corasick automaton.
+ */
+enum class aho_corasick_mode : unsigned char {
+  /**
+   * @brief Complete transition table: one table lookup per input byte, the table takes 4 bytes for every state and
+   * every distinct byte of the patterns.
+   */
+  dense,
+  /**
+   * @brief Trie edges sorted per state and failure links: the automaton takes about 30 bytes per state, the scan
+   * follows failure links on mismatches.
+   */
+  lean,
+};
+
+/**
+ * @brief Multi-pattern matcher (Aho-Corasick automaton) over basic_string_view patterns.
+ * Finds all occurrences of all patterns in one pass over the text, the scan time does not depend on the number of
+ * patterns. The automaton runs over the bytes of the characters, the distinct bytes of the patterns are mapped to
+ * byte classes to keep the transition table narrow. Occurrences of multibyte characters patterns are reported only
+ * at the character boundaries.
+ *
+ * Empty patterns are ignored. Occurrences of equal patterns are reported with the id of the first one.
+ *
+ * @tparam t_char_type Character type.
+ * @tparam t_char_traits_type Class specifying the operations on the character type.
+ */
+template<class t_char_type, class t_char_traits_type = ::portable_stl::char_traits<t_char_type>>
+class aho_corasick final {
+  /**
+   * @brief Iterator over the matches needs the transitions.
+   */
+  friend class ::portable_stl::aho_corasick_iterator<aho_corasick>;
+
+public:
+  /**
+   * @brief Character type.
+   */
+  using value_type  = t_char_type;
+  /**
+   * @brief Character traits type.
+   */
+  using traits_type = t_char_traits_type;
+  /**
+   * @brief Pattern and text type.
+   */
+  using view_type   = ::portable_stl::basic_string_view<t_char_type, t_char_traits_type>;
+  /**
+   * @brief Size type.
+   */
+  using size_type   = ::portable_stl::size_t;
+  /**
+   * @brief Input iterator over the matches in the text.
+   */
+  using iterator    = ::portable_stl::aho_corasick_iterator<aho_corasick>;
+  /**
+   * @brief Lazy range of the matches in the text.
+   */
+  using match_range = ::portable_stl::aho_corasick_range<aho_corasick>;
+
+private:
+  /**
+   * @brief State index type.
+   */
+  using t_state = ::portable_stl::uint32_t;
+  /**
+   * @brief Byte class type.
+   */
+  using t_class = ::portable_stl::uint16_t;
+
+  /**
+   * @brief Trie of the patterns used while building the automaton.
+   */
+  class t_trie final {
+  public:
+    /**
+     * @brief The first child of every state, m_root if none.
+     */
+    ::portable_stl::vector<t_state> m_child;
+    /**
+     * @brief The next child of the same parent with a greater byte class, m_root if none.
+     */
+    ::portable_stl::vector<t_state> m_sibling;
+    /**
+     * @brief Byte class of the edge to every state.
+     */
+    ::portable_stl::vector<t_class> m_label;
+  };
+
+  /**
+   * @brief The root state. No edge leads to the root, so it also marks the absent state.
+   */
+  static constexpr t_state   m_root       = 0U;
+  /**
+   * @brief The greatest state index.
+   */
+  static constexpr t_state   m_max_state  = static_cast<t_state>(-1);
+  /**
+   * @brief Pattern id of the states without a pattern.
+   */
+  static constexpr size_type m_no_pattern = static_cast<size_type>(-1);
+  /**
+   * @brief Number of the byte values.
+   */
+  static constexpr size_type m_bytes      = 256U;
+
+  /**
+   * @brief Automaton representation.
+   */
+  ::portable_stl::aho_corasick_mode m_mode;
+  /**
+   * @brief Dense mode: log2 of the transition table row width.
+   */
+  size_type                         m_shift;
+  /**
+   * @brief Number of byte classes, the class 0 is for the bytes absent in the patterns.
+   */
+  size_type                         m_classes;
+  /**
+   * @brief Byte class of every byte value.
+   */
+  t_class                           m_class[m_bytes];
+  /**
+   * @brief Length of every pattern in characters.
+   */
+  ::portable_stl::vector<size_type> m_length;
+  /**
+   * @brief Id of the pattern ending at every state, m_no_pattern if none.
+   */
+  ::portable_stl::vector<size_type> m_output;
+  /**
+   * @brief The longest proper suffix state of every state with a pattern, m_root if none.
+   */
+  ::portable_stl::vector<t_state>   m_dict;
+  /**
+   * @brief The state itself if a pattern ends at it, m_dict otherwise.
+   */
+  ::portable_stl::vector<t_state>   m_report;
+  /**
+   * @brief Dense mode: transitions (target << m_shift) | (target has a pattern), a row of 1 << m_shift entries per
+   * state. Lean mode: the target of every trie edge.
+   */
+  ::portable_stl::vector<t_state>   m_next;
+  /**
+   * @brief Lean mode: the first edge of every state (one extra for the end).
+   */
+  ::portable_stl::vector<t_state>   m_edge_begin;
+  /**
+   * @brief Lean mode: byte class of every trie edge, sorted per state.
+   */
+  ::portable_stl::vector<t_class>   m_edge_label;
+  /**
+   * @brief Lean mode: failure link of every state, the longest proper suffix state.
+   */
+  ::portable_stl::vector<t_state>   m_fail;
+  /**
+   * @brief Lean mode: transitions of the root state for every byte class.
+   */
+  ::portable_stl::vector<t_state>   m_root_next;
+
+  /**
+   * @brief Constructs empty automaton, the automaton is not built.
+   * @param mode the automaton representation.
+   */
+  explicit aho_corasick(::portable_stl::aho_corasick_mode mode) noexcept
+      : m_mode(mode),
+        m_shift(0U),
+        m_classes(1U),
+        m_class{},
+        m_length(),
+        m_output(),
+        m_dict(),
+        m_report(),
+        m_next(),
+        m_edge_begin(),
+        m_edge_label(),
+        m_fail(),
+        m_root_next() {
+  }
+
+public:
+  /**
+   * @brief Builds the automaton for the patterns [first, last).
+   * The pattern id is the position of the pattern in the range.
+   * @throw length_error if the automaton has too many states;
+   *        bad_alloc if memory cannot be allocated.
+   * @tparam t_forward_iterator the type of iterator, the value must be convertible to view_type.
+   * @param first the beginning of the patterns.
+   * @param last the end of the patterns.
+   * @param mode the automaton representation.
+   */
+  template<class t_forward_iterator>
+  aho_corasick(t_forward_iterator                first,
+               t_forward_iterator                last,
+               ::portable_stl::aho_corasick_mode mode = ::portable_stl::aho_corasick_mode::dense)
+      : aho_corasick(mode) {
+    auto const result = M_build(first, last);
+    if (!result) {
+      ::portable_stl::throw_on_true<::portable_stl::length_error<>>(
+        ::portable_stl::portable_stl_error::length_error == result.error());
+      ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(true);
+    }
+  }
+
+  /**
+   * @brief Builds the automaton for the patterns [first, last).
+   * The pattern id is the position of the pattern in the range.
+   * @tparam t_forward_iterator the type of iterator, the value must be convertible to view_type.
+   * @param first the beginning of the patterns.
+   * @param last the end of the patterns.
+   * @param mode the automaton representation.
+   * @return the automaton or length_error if the automaton has too many states, allocate_error if memory cannot be
+   * allocated.
+   */
+  template<class t_forward_iterator>
+  static ::portable_stl::expected<aho_corasick, ::portable_stl::portable_stl_error> make_aho_corasick(
+    t_forward_iterator                first,
+    t_forward_iterator                last,
+    ::portable_stl::aho_corasick_mode mode = ::portable_stl::aho_corasick_mode::dense) {
+    aho_corasick automaton(mode);
+    auto const   result = automaton.M_build(first, last);
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    return ::portable_stl::expected<aho_corasick, ::portable_stl::portable_stl_error>(
+      ::portable_stl::move(automaton));
+  }
+
+  /**
+   * @brief Returns the automaton representation.
+   * @return the automaton representation.
+   */
+  ::portable_stl::aho_corasick_mode mode() const noexcept {
+    return m_mode;
+  }
+
+  /**
+   * @brief Returns the number of patterns including the empty ones.
+   * @return the number of patterns.
+   */
+  size_type pattern_count() const noexcept {
+    return m_length.size();
+  }
+
+  /**
+   * @brief Returns the number of automaton states.
+   * @return the number of states.
+   */
+  size_type state_count() const noexcept {
+    return m_output.size();
+  }
+
+  /**
+   * @brief Finds all occurrences of the patterns in the text in one pass.
+   * The occurrences are reported in the order of their ends, the occurrences with the same end are reported from the
+   * longest pattern to the shortest one.
+   * @tparam t_callback the type of callback.
+   * @param text the text.
+   * @param callback the callback called as callback(pattern id, offset of the occurrence in the text) for every
+   * occurrence.
+   */
+  template<class t_callback> void scan(view_type text, t_callback callback) const {
+    unsigned char const *const bytes{reinterpret_cast<unsigned char const *>(text.data())};
+    size_type const            size{text.size() * sizeof(value_type)};
+
+    if (::portable_stl::aho_corasick_mode::dense == m_mode) {
+      // the low bit of the transition marks the target states with patterns
+      t_state const  mask{static_cast<t_state>(~static_cast<t_state>(1U))};
+      t_state const *next{m_next.data()};
+      t_state        transition{0U};
+      for (size_type pos{0U}; pos < size; ++pos) {
+        transition = next[(transition & mask) + m_class[bytes[pos]]];
+        if (0U != (transition & 1U)) {
+          M_report(static_cast<t_state>(transition >> m_shift), pos + 1U, callback);
+        }
+      }
+    } else {
+      t_state state{m_root};
+      for (size_type pos{0U}; pos < size; ++pos) {
+        state = M_lean_next(state, m_class[bytes[pos]]);
+        if (m_root != m_report[state]) {
+          M_report(state, pos + 1U, callback);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the lazy range of the occurrences of the patterns in the text.
+   * The occurrences are found while the range is iterated, in the order of scan.
+   * UB: the automaton or the text is destroyed while the range is used.
+   * @param text the text.
+   * @return the range of aho_corasick_match.
+   */
+  match_range matches(view_type text) const noexcept {
+    return match_range(*this, text);
+  }
+
+private:
+  /**
+   * @brief Makes the transition from the state on the byte.
+   * @param state the current state.
+   * @param byte the input byte.
+   * @return the next state.
+   */
+  t_state M_step(t_state state, unsigned char byte) const noexcept {
+    if (::portable_stl::aho_corasick_mode::dense == m_mode) {
+      return static_cast<t_state>(m_next[(static_cast<size_type>(state) << m_shift) + m_class[byte]] >> m_shift);
+    }
+    return M_lean_next(state, m_class[byte]);
+  }
+
+  /**
+   * @brief Makes the lean mode transition, follows the failure links until the state has an edge with the class.
+   * @param state the current state.
+   * @param label the byte class of the input byte.
+   * @return the next state.
+   */
+  t_state M_lean_next(t_state state, t_class label) const noexcept {
+    for (;;) {
+      if (m_root == state) {
+        return m_root_next[label];
+      }
+      t_state const last{m_edge_begin[state + 1U]};
+      for (t_state edge{m_edge_begin[state]}; edge < last; ++edge) {
+        if (m_edge_label[edge] >= label) {
+          if (m_edge_label[edge] == label) {
+            return m_next[edge];
+          }
+          break;
+        }
+      }
+      state = m_fail[state];
+    }
+  }
+
+  /**
+   * @brief Makes the match of the pattern ending at the state.
+   * @param state the state with a pattern.
+   * @param end the offset of the end of the occurrence in bytes.
+   * @return the match.
+   */
+  ::portable_stl::aho_corasick_match M_match(t_state state, size_type end) const noexcept {
+    size_type const pattern{m_output[state]};
+    return ::portable_stl::aho_corasick_match{pattern, end / sizeof(value_type) - m_length[pattern]};
+  }
+
+  /**
+   * @brief Reports the patterns ending at the state and its suffix states.
+   * @tparam t_callback the type of callback.
+   * @param state the state with a pattern.
+   * @param end the offset of the end of the occurrences in bytes.
+   * @param callback the callback.
+   */
+  template<class t_callback> void M_report(t_state state, size_type end, t_callback &callback) const {
+    // bytes patterns of the multibyte characters may occur inside the characters
+    if ((1U == sizeof(value_type)) || (0U == (end % sizeof(value_type)))) {
+      for (t_state pattern_state{m_report[state]}; m_root != pattern_state; pattern_state = m_dict[pattern_state]) {
+        ::portable_stl::aho_corasick_match const match{M_match(pattern_state, end)};
+        callback(match.pattern, match.offset);
+      }
+    }
+  }
+
+  /**
+   * @brief Adds a trie state.
+   * @param trie the trie.
+   * @param label the byte class of the edge to the state.
+   * @param sibling the next child of the same parent.
+   * @return the new state or length_error if there are too many states, allocate_error if memory cannot be allocated.
+   */
+  ::portable_stl::expected<t_state, ::portable_stl::portable_stl_error> M_add_state(
+    t_trie &trie, t_class label, t_state sibling) noexcept {
+    size_type const state{m_output.size()};
+    if (state > static_cast<size_type>(m_max_state)) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::length_error};
+    }
+    if ((!trie.m_child.push_back(m_root)) || (!trie.m_sibling.push_back(sibling)) || (!trie.m_label.push_back(label))
+        || (!m_output.push_back(m_no_pattern))) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+    return ::portable_stl::expected<t_state, ::portable_stl::portable_stl_error>(static_cast<t_state>(state));
+  }
+
+  /**
+   * @brief Finds the trie edge from the state.
+   * @param trie the trie.
+   * @param state the state.
+   * @param label the byte class of the edge.
+   * @return the child state or m_root if none.
+   */
+  static t_state M_trie_child(t_trie const &trie, t_state state, t_class label) noexcept {
+    t_state child{trie.m_child[state]};
+    while ((m_root != child) && (trie.m_label[child] < label)) {
+      child = trie.m_sibling[child];
+    }
+    return ((m_root != child) && (trie.m_label[child] == label)) ? child : m_root;
+  }
+
+  /**
+   * @brief Adds the pattern to the trie.
+   * @param trie the trie.
+   * @param pattern the pattern.
+   * @param id the pattern id.
+   * @return length_error if there are too many states, allocate_error if memory cannot be allocated.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> M_insert(
+    t_trie &trie, view_type pattern, size_type id) noexcept {
+    unsigned char const *const bytes{reinterpret_cast<unsigned char const *>(pattern.data())};
+    size_type const            size{pattern.size() * sizeof(value_type)};
+
+    t_state state{m_root};
+    for (size_type pos{0U}; pos < size; ++pos) {
+      t_class const label{m_class[bytes[pos]]};
+      // children are sorted by the byte class
+      t_state       previous{m_root};
+      t_state       child{trie.m_child[state]};
+      while ((m_root != child) && (trie.m_label[child] < label)) {
+        previous = child;
+        child    = trie.m_sibling[child];
+      }
+      if ((m_root == child) || (trie.m_label[child] != label)) {
+        auto const added = M_add_state(trie, label, child);
+        if (!added) {
+          return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{added.error()};
+        }
+        child = added.value();
+        if (m_root == previous) {
+          trie.m_child[state] = child;
+        } else {
+          trie.m_sibling[previous] = child;
+        }
+      }
+      state = child;
+    }
+    if ((m_root != state) && (m_no_pattern == m_output[state])) {
+      m_output[state] = id;
+    }
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Builds the automaton.
+   * @tparam t_forward_iterator the type of iterator.
+   * @param first the beginning of the patterns.
+   * @param last the end of the patterns.
+   * @return length_error if the automaton has too many states, allocate_error if memory cannot be allocated.
+   */
+  template<class t_forward_iterator>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> M_build(t_forward_iterator first,
+                                                                            t_forward_iterator last) {
+    // number the distinct bytes of the patterns in the byte order
+    for (t_forward_iterator iter{first}; iter != last; ++iter) {
+      view_type const            pattern(*iter);
+      unsigned char const *const bytes{reinterpret_cast<unsigned char const *>(pattern.data())};
+      for (size_type pos{0U}; pos < pattern.size() * sizeof(value_type); ++pos) {
+        m_class[bytes[pos]] = 1U;
+      }
+    }
+    for (size_type byte{0U}; byte < m_bytes; ++byte) {
+      if (0U != m_class[byte]) {
+        m_class[byte] = static_cast<t_class>(m_classes);
+        ++m_classes;
+      }
+    }
+
+    t_trie trie;
+    auto   result = M_add_state(trie, 0U, m_root);
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    for (size_type id{0U}; first != last; ++first, ++id) {
+      view_type const pattern(*first);
+      if ((!m_length.push_back(pattern.size()))) {
+        return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+          ::portable_stl::portable_stl_error::allocate_error};
+      }
+      auto const inserted = M_insert(trie, pattern, id);
+      if (!inserted) {
+        return inserted;
+      }
+    }
+
+    ::portable_stl::vector<t_state> order;
+    ::portable_stl::vector<t_state> fail;
+    size_type const                 states{m_output.size()};
+    if ((!order.resize(states)) || (!fail.resize(states, m_root)) || (!m_dict.resize(states, m_root))
+        || (!m_report.resize(states, m_root))) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+
+    // failure links in the breadth-first order, the failure link of the state is shallower than the state
+    order[0] = m_root;
+    size_type tail{1U};
+    for (size_type head{0U}; head < tail; ++head) {
+      t_state const state{order[head]};
+      for (t_state child{trie.m_child[state]}; m_root != child; child = trie.m_sibling[child]) {
+        order[tail] = child;
+        ++tail;
+
+        t_state link{m_root};
+        if (m_root != state) {
+          t_state suffix{fail[state]};
+          for (;;) {
+            link = M_trie_child(trie, suffix, trie.m_label[child]);
+            if ((m_root != link) || (m_root == suffix)) {
+              break;
+            }
+            suffix = fail[suffix];
+          }
+        }
+        fail[child]     = link;
+        m_dict[child]   = (m_no_pattern != m_output[link]) ? link : m_dict[link];
+        m_report[child] = (m_no_pattern != m_output[child]) ? child : m_dict[child];
+      }
+    }
+
+    if (::portable_stl::aho_corasick_mode::dense == m_mode) {
+      return M_build_dense(trie, order, fail);
+    }
+    return M_build_lean(trie, ::portable_stl::move(fail));
+  }
+
+  /**
+   * @brief Builds the complete transition table.
+   * @param trie the trie.
+   * @param order the states in the breadth-first order.
+   * @param fail the failure links.
+   * @return length_error if the table is too large, allocate_error if memory cannot be allocated.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> M_build_dense(
+    t_trie const &trie, ::portable_stl::vector<t_state> const &order, ::portable_stl::vector<t_state> const &fail) {
+    // at least two entries per row keep the low bit of the row offset free for the pattern mark
+    m_shift = 1U;
+    while ((static_cast<size_type>(1U) << m_shift) < m_classes) {
+      ++m_shift;
+    }
+    size_type const states{order.size()};
+    size_type const width{static_cast<size_type>(1U) << m_shift};
+    if ((states - 1U) > static_cast<size_type>(m_max_state >> m_shift)) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::length_error};
+    }
+    if (!m_next.resize(states * width, 0U)) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+
+    // the row of the failure link is complete before the row of the state
+    for (size_type pos{0U}; pos < states; ++pos) {
+      t_state const state{order[pos]};
+      t_state      *row{m_next.data() + (static_cast<size_type>(state) << m_shift)};
+      if (m_root != state) {
+        t_state const *suffix_row{m_next.data() + (static_cast<size_type>(fail[state]) << m_shift)};
+        for (size_type label{0U}; label < width; ++label) {
+          row[label] = suffix_row[label];
+        }
+      }
+      for (t_state child{trie.m_child[state]}; m_root != child; child = trie.m_sibling[child]) {
+        row[trie.m_label[child]]
+          = static_cast<t_state>((child << m_shift) | ((m_root != m_report[child]) ? 1U : 0U));
+      }
+    }
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Builds the sorted trie edges.
+   * @param trie the trie.
+   * @param fail the failure links.
+   * @return allocate_error if memory cannot be allocated.
+   */
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> M_build_lean(
+    t_trie const &trie, ::portable_stl::vector<t_state> &&fail) {
+    size_type const states{fail.size()};
+    if ((!m_edge_begin.resize(states + 1U)) || (!m_edge_label.resize(states - 1U))
+        || (!m_next.resize(states - 1U)) || (!m_root_next.resize(m_classes, m_root))) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+
+    // every state except the root is the target of one edge
+    t_state edge{0U};
+    for (size_type state{0U}; state < states; ++state) {
+      m_edge_begin[state] = edge;
+      for (t_state child{trie.m_child[state]}; m_root != child; child = trie.m_sibling[child]) {
+        m_edge_label[edge] = trie.m_label[child];
+        m_next[edge]       = child;
+        ++edge;
+        if (m_root == state) {
+          m_root_next[trie.m_label[child]] = child;
+        }
+      }
+    }
+    m_edge_begin[states] = edge;
+    m_fail               = ::portable_stl::move(fail);
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+};
+
+template<class t_char_type, class t_char_traits_type>
+typename aho_corasick<t_char_type, t_char_traits_type>::t_state const
+  aho_corasick<t_char_type, t_char_traits_type>::m_root;
+template<class t_char_type, class t_char_traits_type>
+typename aho_corasick<t_char_type, t_char_traits_type>::t_state const
+  aho_corasick<t_char_type, t_char_traits_type>::m_max_state;
+template<class t_char_type, class t_char_traits_type>
+typename aho_corasick<t_char_type, t_char_traits_type>::size_type const
+  aho_corasick<t_char_type, t_char_traits_type>::m_no_pattern;
+template<class t_char_type, class t_char_traits_type>
+typename aho_corasick<t_char_type, t_char_traits_type>::size_type const
+  aho_corasick<t_char_type, t_char_traits_type>::m_bytes;
+} // namespace portable_stl
+
+#endif // PSTL_AHO_CORASICK_H
@@ -0,0 +1,242 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="aho_corasick_iterator.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_AHO_CORASICK_ITERATOR_H
+#define PSTL_AHO_CORASICK_ITERATOR_H
+
+#include "../common/ptrdiff_t.h"
+#include "../common/size_t.h"
+#include "../iterator/input_iterator_tag.h"
+
+namespace portable_stl {
+/**
+ * @brief Occurrence of the pattern found by aho_corasick.
+ */
+struct aho_corasick_match final {
+  /**
+   * @brief Pattern id, the position of the pattern in the patterns range.
+   */
+  ::portable_stl::size_t pattern;
+  /**
+   * @brief Offset of the occurrence in the text in characters.
+   */
+  ::portable_stl::size_t offset;
+};
+
+/**
+ * @brief Input iterator over the occurrences of the patterns in the text.
+ * The iterator keeps the automaton state and finds the next occurrence on increment.
+ *
+ * @tparam t_automaton the type of aho_corasick automaton.
+ */
+template<class t_automaton> class aho_corasick_iterator final {
+public:
+  /**
+   * @brief Difference type.
+   */
+  using difference_type   = ::portable_stl::ptrdiff_t;
+  /**
+   * @brief Value type.
+   */
+  using value_type        = ::portable_stl::aho_corasick_match;
+  /**
+   * @brief Pointer type.
+   */
+  using pointer           = ::portable_stl::aho_corasick_match const *;
+  /**
+   * @brief Reference type.
+   */
+  using reference         = ::portable_stl::aho_corasick_match const &;
+  /**
+   * @brief Iterator category.
+   */
+  using iterator_category = ::portable_stl::input_iterator_tag;
+
+private:
+  /**
+   * @brief Size type.
+   */
+  using size_type = ::portable_stl::size_t;
+  /**
+   * @brief State index type.
+   */
+  using t_state   = typename t_automaton::t_state;
+
+  /**
+   * @brief The automaton, nullptr for the end iterator.
+   */
+  t_automaton const                 *m_automaton;
+  /**
+   * @brief Bytes of the text.
+   */
+  unsigned char const               *m_bytes;
+  /**
+   * @brief Number of bytes of the text.
+   */
+  size_type                          m_size;
+  /**
+   * @brief Number of scanned bytes.
+   */
+  size_type                          m_pos;
+  /**
+   * @brief Automaton state after the scanned bytes.
+   */
+  t_state                            m_state;
+  /**
+   * @brief The next state with a pattern ending at m_pos, the root if none.
+   */
+  t_state                            m_pending;
+  /**
+   * @brief The current match.
+   */
+  ::portable_stl::aho_corasick_match m_match;
+
+  /**
+   * @brief Finds the next match, becomes the end iterator if none.
+   */
+  void M_advance() noexcept {
+    size_type const char_size{sizeof(typename t_automaton::value_type)};
+    while (t_automaton::m_root == m_pending) {
+      if (m_pos == m_size) {
+        m_automaton = nullptr;
+        return;
+      }
+      m_state = m_automaton->M_step(m_state, m_bytes[m_pos]);
+      ++m_pos;
+      // bytes patterns of the multibyte characters may occur inside the characters
+      if ((1U == char_size) || (0U == (m_pos % char_size))) {
+        m_pending = m_automaton->m_report[m_state];
+      }
+    }
+    m_match   = m_automaton->M_match(m_pending, m_pos);
+    m_pending = m_automaton->m_dict[m_pending];
+  }
+
+public:
+  /**
+   * @brief Constructs the end iterator.
+   */
+  aho_corasick_iterator() noexcept
+      : m_automaton(nullptr),
+        m_bytes(nullptr),
+        m_size(0U),
+        m_pos(0U),
+        m_state(t_automaton::m_root),
+        m_pending(t_automaton::m_root),
+        m_match{0U, 0U} {
+  }
+
+  /**
+   * @brief Constructs the iterator at the first match in the text.
+   * @param automaton the automaton.
+   * @param text the text.
+   */
+  aho_corasick_iterator(t_automaton const &automaton, typename t_automaton::view_type text) noexcept
+      : m_automaton(&automaton),
+        m_bytes(reinterpret_cast<unsigned char const *>(text.data())),
+        m_size(text.size() * sizeof(typename t_automaton::value_type)),
+        m_pos(0U),
+        m_state(t_automaton::m_root),
+        m_pending(t_automaton::m_root),
+        m_match{0U, 0U} {
+    M_advance();
+  }
+
+  reference operator*() const noexcept {
+    return m_match;
+  }
+
+  pointer operator->() const noexcept {
+    return &m_match;
+  }
+
+  aho_corasick_iterator &operator++() noexcept {
+    M_advance();
+    return *this;
+  }
+
+  aho_corasick_iterator operator++(int) noexcept {
+    aho_corasick_iterator tmp{*this};
+    M_advance();
+    return tmp;
+  }
+
+  /**
+   * @brief Compares the iterators.
+   * @param other the other iterator over the same text.
+   * @return true if both iterators are at the same match or both are the end iterators.
+   */
+  bool operator==(aho_corasick_iterator const &other) const noexcept {
+    if ((nullptr == m_automaton) || (nullptr == other.m_automaton)) {
+      return m_automaton == other.m_automaton;
+    }
+    return (m_pos == other.m_pos) && (m_pending == other.m_pending);
+  }
+
+  /**
+   * @brief Compares the iterators.
+   * @param other the other iterator over the same text.
+   * @return true if the iterators are at the different matches.
+   */
+  bool operator!=(aho_corasick_iterator const &other) const noexcept {
+    return !(*this == other);
+  }
+};
+
+/**
+ * @brief Lazy range of the occurrences of the patterns in the text.
+ *
+ * @tparam t_automaton the type of aho_corasick automaton.
+ */
+template<class t_automaton> class aho_corasick_range final {
+  /**
+   * @brief The automaton.
+   */
+  t_automaton const              *m_automaton;
+  /**
+   * @brief The text.
+   */
+  typename t_automaton::view_type m_text;
+
+public:
+  /**
+   * @brief Iterator type.
+   */
+  using iterator = ::portable_stl::aho_corasick_iterator<t_automaton>;
+
+  /**
+   * @brief Constructs the range of the matches in the text.
+   * @param automaton the automaton.
+   * @param text the text.
+   */
+  aho_corasick_range(t_automaton const &automaton, typename t_automaton::view_type text) noexcept
+      : m_automaton(&automaton), m_text(text) {
+  }
+
+  /**
+   * @brief Starts the scan of the text.
+   * @return the iterator at the first match.
+   */
+  iterator begin() const noexcept {
+    return iterator(*m_automaton, m_text);
+  }
+
+  /**
+   * @brief Returns the end iterator.
+   * @return the end iterator.
+   */
+  iterator end() const noexcept {
+    return iterator();
+  }
+};
+} // namespace portable_stl
+
+#endif // PSTL_AHO_CORASICK_ITERATOR_H
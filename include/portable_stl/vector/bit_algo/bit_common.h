@@ -29,6 +29,18 @@ namespace bit_algo {
            ? static_cast<t_type>(~0)
            : static_cast<t_type>((static_cast<t_type>(1) << leading_ones) - 1) << (bits_per_word - leading_ones);
   }
+
+  /**
+   * @brief Returns the storage word where the bits equal to t_value are set.
+   *
+   * @tparam t_value the value of the bits of interest.
+   * @tparam t_type the storage word type.
+   * @param word the storage word.
+   * @return word for t_value=true and inverted word otherwise.
+   */
+  template<bool t_value, class t_type> inline t_type select_bits(t_type word) noexcept {
+    return t_value ? word : static_cast<t_type>(~word);
+  }
 } // namespace bit_algo
 } // namespace portable_stl
 
@@ -0,0 +1,95 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="bit_count.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BIT_COUNT_H
+#define PSTL_BIT_COUNT_H
+
+#include "../../algorithm/min.h"
+#include "../../algorithm/popcount.h"
+#include "../../memory/to_address.h"
+#include "../fwd_decl_bit.h"
+#include "bit_common.h"
+#include "bit_word_ops.h"
+
+namespace portable_stl {
+namespace bit_algo {
+  /**
+   * @brief Counts the bits equal to t_to_count in the range [first, first + num).
+   * The whole storage words are counted by count_words.
+   *
+   * @tparam t_to_count the value of the bits to count.
+   * @tparam t_container_type the bit container type.
+   * @tparam is_const the constness of the iterator.
+   * @param first the beginning of the range.
+   * @param num the number of bits in the range.
+   * @return the number of bits equal to t_to_count.
+   */
+  template<bool t_to_count, class t_container_type, bool is_const>
+  typename bit_iterator<t_container_type, is_const>::difference_type count_bool(
+    bit_iterator<t_container_type, is_const> first, typename t_container_type::size_type num) {
+    using t_iterator      = bit_iterator<t_container_type, is_const>;
+    using t_storage_type  = typename t_iterator::t_storage_type;
+    using difference_type = typename t_iterator::difference_type;
+    using t_size_type     = typename t_container_type::size_type;
+
+    unsigned int const bits_per_word = t_iterator::m_bits_per_word;
+    difference_type    result{0};
+
+    // do first partial word
+    if (first.m_ctz != 0) {
+      unsigned int   clz_f{bits_per_word - first.m_ctz};
+      unsigned int   dn = ::portable_stl::min(clz_f, static_cast<unsigned int>(num));
+      t_storage_type m  = (~t_storage_type(0) << first.m_ctz) & (~t_storage_type(0) >> (clz_f - dn));
+      result += ::portable_stl::popcount(select_bits<t_to_count>(*first.m_seg) & m);
+      num -= dn;
+      ++first.m_seg;
+    }
+
+    // do middle whole words
+    t_size_type numw = num / bits_per_word;
+    num -= numw * bits_per_word;
+
+    auto const ones_in_words = count_words(::portable_stl::to_address(first.m_seg), numw);
+    result += static_cast<difference_type>(t_to_count ? ones_in_words : (numw * bits_per_word - ones_in_words));
+    first.m_seg += static_cast<difference_type>(numw);
+
+    // do last partial word
+    if (num > 0) {
+      t_storage_type m = ~t_storage_type(0) >> (bits_per_word - num);
+      result += ::portable_stl::popcount(select_bits<t_to_count>(*first.m_seg) & m);
+    }
+    return result;
+  }
+} // namespace bit_algo
+
+/**
+ * @brief Returns the number of bits in the range [first, last) that are equal to value.
+ *
+ * @tparam t_container_type the bit container type.
+ * @tparam is_const the constness of the iterator.
+ * @tparam t_type the type of the value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value to compare the bits to.
+ * @return the number of bits equal to value.
+ */
+template<class t_container_type, bool is_const, class t_type>
+inline typename bit_iterator<t_container_type, is_const>::difference_type count(
+  bit_iterator<t_container_type, is_const> first, bit_iterator<t_container_type, is_const> last, t_type const &value) {
+  using t_size_type = typename t_container_type::size_type;
+  if (static_cast<bool>(value)) {
+    return bit_algo::count_bool<true>(first, static_cast<t_size_type>(last - first));
+  }
+  return bit_algo::count_bool<false>(first, static_cast<t_size_type>(last - first));
+}
+} // namespace portable_stl
+
+#endif // PSTL_BIT_COUNT_H
@@ -0,0 +1,101 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="bit_find.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BIT_FIND_H
+#define PSTL_BIT_FIND_H
+
+#include "../../algorithm/ctz.h"
+#include "../../algorithm/min.h"
+#include "../fwd_decl_bit.h"
+#include "bit_common.h"
+
+namespace portable_stl {
+namespace bit_algo {
+  /**
+   * @brief Finds the first bit equal to t_to_find in the range [first, first + num).
+   * Whole storage words are tested at once, the position in the word is found by ctz.
+   *
+   * @tparam t_to_find the value of the bit to find.
+   * @tparam t_container_type the bit container type.
+   * @tparam is_const the constness of the iterator.
+   * @param first the beginning of the range.
+   * @param num the number of bits in the range.
+   * @return the iterator to the found bit or first + num if there is no such bit.
+   */
+  template<bool t_to_find, class t_container_type, bool is_const>
+  bit_iterator<t_container_type, is_const> find_bool(bit_iterator<t_container_type, is_const> first,
+                                                     typename t_container_type::size_type     num) {
+    using t_iterator     = bit_iterator<t_container_type, is_const>;
+    using t_storage_type = typename t_iterator::t_storage_type;
+
+    unsigned int const bits_per_word = t_iterator::m_bits_per_word;
+
+    // do first partial word
+    if (first.m_ctz != 0) {
+      unsigned int   clz_f{bits_per_word - first.m_ctz};
+      unsigned int   dn = ::portable_stl::min(clz_f, static_cast<unsigned int>(num));
+      t_storage_type m  = (~t_storage_type(0) << first.m_ctz) & (~t_storage_type(0) >> (clz_f - dn));
+      t_storage_type b  = select_bits<t_to_find>(*first.m_seg) & m;
+      if (b != 0) {
+        return t_iterator(first.m_seg, static_cast<unsigned int>(::portable_stl::ctz(b)));
+      }
+      if (num == dn) {
+        return first + static_cast<typename t_iterator::difference_type>(num);
+      }
+      num -= dn;
+      ++first.m_seg;
+    }
+
+    // do middle whole words
+    for (; num >= bits_per_word; ++first.m_seg, num -= bits_per_word) {
+      t_storage_type b = select_bits<t_to_find>(*first.m_seg);
+      if (b != 0) {
+        return t_iterator(first.m_seg, static_cast<unsigned int>(::portable_stl::ctz(b)));
+      }
+    }
+
+    // do last partial word
+    if (num > 0) {
+      t_storage_type m = ~t_storage_type(0) >> (bits_per_word - num);
+      t_storage_type b = select_bits<t_to_find>(*first.m_seg) & m;
+      if (b != 0) {
+        return t_iterator(first.m_seg, static_cast<unsigned int>(::portable_stl::ctz(b)));
+      }
+    }
+    return t_iterator(first.m_seg, static_cast<unsigned int>(num));
+  }
+} // namespace bit_algo
+
+/**
+ * @brief Returns an iterator to the first bit in the range [first, last) that is equal to value (or last if there is
+ * no such bit).
+ *
+ * @tparam t_container_type the bit container type.
+ * @tparam is_const the constness of the iterator.
+ * @tparam t_type the type of the value.
+ * @param first the beginning of the range.
+ * @param last the end of the range.
+ * @param value the value to compare the bits to.
+ * @return the iterator to the first bit equal to value or last.
+ */
+template<class t_container_type, bool is_const, class t_type>
+inline bit_iterator<t_container_type, is_const> find(bit_iterator<t_container_type, is_const> first,
+                                                     bit_iterator<t_container_type, is_const> last,
+                                                     t_type const                            &value) {
+  using t_size_type = typename t_container_type::size_type;
+  if (static_cast<bool>(value)) {
+    return bit_algo::find_bool<true>(first, static_cast<t_size_type>(last - first));
+  }
+  return bit_algo::find_bool<false>(first, static_cast<t_size_type>(last - first));
+}
+} // namespace portable_stl
+
+#endif // PSTL_BIT_FIND_H
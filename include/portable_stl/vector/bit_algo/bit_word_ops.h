@@ -0,0 +1,242 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="bit_word_ops.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_BIT_WORD_OPS_H
+#define PSTL_BIT_WORD_OPS_H
+
+#include "../../algorithm/ctz.h"
+#include "../../algorithm/popcount.h"
+#include "../../common/size_t.h"
+#include "../../memory/to_address.h"
+#include "../fwd_decl_bit.h"
+
+namespace portable_stl {
+namespace bit_algo {
+  // Kernels over arrays of whole storage words shared by vector<bool> and bitset.
+  // The loops are kept simple and free of cross-iteration dependencies so the compiler can vectorize them.
+
+  /**
+   * @brief Number of bits in the storage word.
+   * @tparam t_word the storage word type.
+   */
+  template<class t_word> struct word_bits final {
+    /**
+     * @brief Number of bits in t_word.
+     */
+    static constexpr unsigned int value = static_cast<unsigned int>(sizeof(t_word) * 8);
+  };
+
+  /**
+   * @brief dst[i] &= src[i] for i in [0, num).
+   *
+   * @tparam t_word the storage word type.
+   * @param dst the destination words.
+   * @param src the source words.
+   * @param num the number of words.
+   */
+  template<class t_word> void and_words(t_word *dst, t_word const *src, ::portable_stl::size_t num) noexcept {
+    for (::portable_stl::size_t i{0U}; i < num; ++i) {
+      dst[i] &= src[i];
+    }
+  }
+
+  /**
+   * @brief dst[i] |= src[i] for i in [0, num).
+   *
+   * @tparam t_word the storage word type.
+   * @param dst the destination words.
+   * @param src the source words.
+   * @param num the number of words.
+   */
+  template<class t_word> void or_words(t_word *dst, t_word const *src, ::portable_stl::size_t num) noexcept {
+    for (::portable_stl::size_t i{0U}; i < num; ++i) {
+      dst[i] |= src[i];
+    }
+  }
+
+  /**
+   * @brief dst[i] ^= src[i] for i in [0, num).
+   *
+   * @tparam t_word the storage word type.
+   * @param dst the destination words.
+   * @param src the source words.
+   * @param num the number of words.
+   */
+  template<class t_word> void xor_words(t_word *dst, t_word const *src, ::portable_stl::size_t num) noexcept {
+    for (::portable_stl::size_t i{0U}; i < num; ++i) {
+      dst[i] ^= src[i];
+    }
+  }
+
+  /**
+   * @brief dst[i] &= ~src[i] for i in [0, num).
+   *
+   * @tparam t_word the storage word type.
+   * @param dst the destination words.
+   * @param src the source words.
+   * @param num the number of words.
+   */
+  template<class t_word> void and_not_words(t_word *dst, t_word const *src, ::portable_stl::size_t num) noexcept {
+    for (::portable_stl::size_t i{0U}; i < num; ++i) {
+      dst[i] &= static_cast<t_word>(~src[i]);
+    }
+  }
+
+  /**
+   * @brief dst[i] = ~dst[i] for i in [0, num).
+   *
+   * @tparam t_word the storage word type.
+   * @param dst the destination words.
+   * @param num the number of words.
+   */
+  template<class t_word> void not_words(t_word *dst, ::portable_stl::size_t num) noexcept {
+    for (::portable_stl::size_t i{0U}; i < num; ++i) {
+      dst[i] = static_cast<t_word>(~dst[i]);
+    }
+  }
+
+  /**
+   * @brief Counts the set bits in the words [0, num).
+   * Four independent accumulators break the dependency chain between the popcounts.
+   *
+   * @tparam t_word the storage word type.
+   * @param src the source words.
+   * @param num the number of words.
+   * @return the number of set bits.
+   */
+  template<class t_word> ::portable_stl::size_t count_words(t_word const *src, ::portable_stl::size_t num) noexcept {
+    ::portable_stl::size_t acc0{0U};
+    ::portable_stl::size_t acc1{0U};
+    ::portable_stl::size_t acc2{0U};
+    ::portable_stl::size_t acc3{0U};
+    for (; num >= 4U; num -= 4U, src += 4) {
+      acc0 += static_cast<::portable_stl::size_t>(::portable_stl::popcount(src[0]));
+      acc1 += static_cast<::portable_stl::size_t>(::portable_stl::popcount(src[1]));
+      acc2 += static_cast<::portable_stl::size_t>(::portable_stl::popcount(src[2]));
+      acc3 += static_cast<::portable_stl::size_t>(::portable_stl::popcount(src[3]));
+    }
+    for (; num > 0U; --num, ++src) {
+      acc0 += static_cast<::portable_stl::size_t>(::portable_stl::popcount(*src));
+    }
+    return (acc0 + acc1) + (acc2 + acc3);
+  }
+
+  /**
+   * @brief Shifts the bits of the words [0, num) to the higher positions (bit i moves to i + shift), the vacated
+   * positions are filled with zeros.
+   *
+   * @tparam t_word the storage word type.
+   * @param dst the words.
+   * @param num the number of words.
+   * @param shift the number of positions to shift.
+   */
+  template<class t_word>
+  void shift_up_words(t_word *dst, ::portable_stl::size_t num, ::portable_stl::size_t shift) noexcept {
+    unsigned int const           bits_per_word = word_bits<t_word>::value;
+    ::portable_stl::size_t const word_shift{shift / bits_per_word};
+    unsigned int const           bit_shift{static_cast<unsigned int>(shift % bits_per_word)};
+
+    if (word_shift >= num) {
+      for (::portable_stl::size_t i{0U}; i < num; ++i) {
+        dst[i] = 0U;
+      }
+      return;
+    }
+
+    if (0U == bit_shift) {
+      for (::portable_stl::size_t i{num - 1U}; i > word_shift; --i) {
+        dst[i] = dst[i - word_shift];
+      }
+    } else {
+      for (::portable_stl::size_t i{num - 1U}; i > word_shift; --i) {
+        dst[i] = static_cast<t_word>((dst[i - word_shift] << bit_shift)
+                                     | (dst[i - word_shift - 1U] >> (bits_per_word - bit_shift)));
+      }
+    }
+    dst[word_shift] = static_cast<t_word>(dst[0] << bit_shift);
+    for (::portable_stl::size_t i{0U}; i < word_shift; ++i) {
+      dst[i] = 0U;
+    }
+  }
+
+  /**
+   * @brief Shifts the bits of the words [0, num) to the lower positions (bit i moves to i - shift), the vacated
+   * positions are filled with zeros.
+   *
+   * @tparam t_word the storage word type.
+   * @param dst the words.
+   * @param num the number of words.
+   * @param shift the number of positions to shift.
+   */
+  template<class t_word>
+  void shift_down_words(t_word *dst, ::portable_stl::size_t num, ::portable_stl::size_t shift) noexcept {
+    unsigned int const           bits_per_word = word_bits<t_word>::value;
+    ::portable_stl::size_t const word_shift{shift / bits_per_word};
+    unsigned int const           bit_shift{static_cast<unsigned int>(shift % bits_per_word)};
+
+    if (word_shift >= num) {
+      for (::portable_stl::size_t i{0U}; i < num; ++i) {
+        dst[i] = 0U;
+      }
+      return;
+    }
+
+    ::portable_stl::size_t const last{num - word_shift - 1U};
+    if (0U == bit_shift) {
+      for (::portable_stl::size_t i{0U}; i < last; ++i) {
+        dst[i] = dst[i + word_shift];
+      }
+    } else {
+      for (::portable_stl::size_t i{0U}; i < last; ++i) {
+        dst[i] = static_cast<t_word>((dst[i + word_shift] >> bit_shift)
+                                     | (dst[i + word_shift + 1U] << (bits_per_word - bit_shift)));
+      }
+    }
+    dst[last] = static_cast<t_word>(dst[num - 1U] >> bit_shift);
+    for (::portable_stl::size_t i{last + 1U}; i < num; ++i) {
+      dst[i] = 0U;
+    }
+  }
+
+  /**
+   * @brief Finds the position of the set bit with the given rank in the word.
+   * UB: rank >= popcount(word).
+   *
+   * @tparam t_word the storage word type.
+   * @param word the storage word.
+   * @param rank the number of set bits before the bit to find.
+   * @return the position of the bit in the word.
+   */
+  template<class t_word> unsigned int select_in_word(t_word word, ::portable_stl::size_t rank) noexcept {
+    for (; rank > 0U; --rank) {
+      // clear the lowest set bit
+      word &= static_cast<t_word>(word - 1U);
+    }
+    return static_cast<unsigned int>(::portable_stl::ctz(word));
+  }
+
+  /**
+   * @brief Returns the address of the storage word the iterator points into.
+   * Gives read access to the whole words of the bit container for the structures built over it.
+   *
+   * @tparam t_container_type the bit container type.
+   * @tparam is_const the constness of the iterator.
+   * @param iter the iterator.
+   * @return the address of the storage word.
+   */
+  template<class t_container_type, bool is_const>
+  typename t_container_type::t_storage_type const *word_address(bit_iterator<t_container_type, is_const> iter) noexcept {
+    return ::portable_stl::to_address(iter.m_seg);
+  }
+} // namespace bit_algo
+} // namespace portable_stl
+
+#endif // PSTL_BIT_WORD_OPS_H
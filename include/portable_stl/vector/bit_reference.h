@@ -16,10 +16,13 @@
 #include "../metaprogramming/logical_operator/conjunction.h"
 #include "../metaprogramming/logical_operator/negation.h"
 #include "../metaprogramming/type_traits/has_storage_type.h"
+#include "bit_algo/bit_count.h"
 #include "bit_algo/bit_equal.h"
 #include "bit_algo/bit_fill.h"
+#include "bit_algo/bit_find.h"
 #include "bit_algo/bit_rotate.h"
 #include "bit_algo/bit_swap_ranges.h"
+#include "bit_algo/bit_word_ops.h"
 #include "fwd_decl_bit.h"
 
 namespace portable_stl {
@@ -351,10 +354,14 @@ private:
   friend bool equal(bit_iterator<_Dp, _IC1>, bit_iterator<_Dp, _IC1>, bit_iterator<_Dp, _IC2>);
 
   template<bool _ToFind, class _Dp, bool _IC>
-  friend bit_iterator<_Dp, _IC> __find_bool(bit_iterator<_Dp, _IC>, typename _Dp::size_type);
+  friend bit_iterator<_Dp, _IC> bit_algo::find_bool(bit_iterator<_Dp, _IC>, typename _Dp::size_type);
 
   template<bool _ToCount, class _Dp, bool _IC>
-  friend typename bit_iterator<_Dp, _IC>::difference_type __count_bool(bit_iterator<_Dp, _IC>, typename _Dp::size_type);
+  friend typename bit_iterator<_Dp, _IC>::difference_type bit_algo::count_bool(bit_iterator<_Dp, _IC>,
+                                                                               typename _Dp::size_type);
+
+  template<class _Dp, bool _IC>
+  friend typename _Dp::t_storage_type const *bit_algo::word_address(bit_iterator<_Dp, _IC>) noexcept;
 };
 
 } // namespace portable_stl
@@ -0,0 +1,353 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="eytzinger_array.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_EYTZINGER_ARRAY_H
+#define PSTL_EYTZINGER_ARRAY_H
+
+#include "../algorithm/branchless_search.h"
+#include "../algorithm/ctz.h"
+#include "../common/size_t.h"
+#include "../error/portable_stl_error.h"
+#include "../functional/less.h"
+#include "../iterator/distance.h"
+#include "../language_support/bad_alloc.h"
+#include "../memory/allocator.h"
+#include "../memory/prefetch.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/move.h"
+#include "vector.h"
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#  include "../language_support/exception/throw_on_true.h"
+#else
+#  include "../language_support/no_exception/throw_on_true.h"
+#endif
+
+namespace portable_stl {
+/**
+ * @brief Sorted set of values in the Eytzinger (breadth-first) layout.
+ * The elements of the sorted sequence are stored as the implicit complete binary search tree: the children of the
+ * node k (counting from 1) are the nodes 2k and 2k + 1. The first levels of the tree, visited by every search, share
+ * a few cache lines, and the 64 bytes of the descendants four levels down are contiguous, so the search prefetches
+ * them while it compares the current node. The search loop has no data dependent branches.
+ *
+ * The elements are read-only: modifying them would break the search order.
+ *
+ * @tparam t_type the type of the elements.
+ * @tparam t_compare the type of compare function.
+ * @tparam t_allocator the allocator type.
+ */
+template<class t_type,
+         class t_compare   = ::portable_stl::less<t_type>,
+         class t_allocator = ::portable_stl::allocator<t_type>>
+class eytzinger_array final {
+  /**
+   * @brief Storage type.
+   */
+  using t_storage = ::portable_stl::vector<t_type, t_allocator>;
+
+public:
+  /**
+   * @brief Value type.
+   */
+  using value_type      = t_type;
+  /**
+   * @brief Size type.
+   */
+  using size_type       = ::portable_stl::size_t;
+  /**
+   * @brief Compare function type.
+   */
+  using key_compare     = t_compare;
+  /**
+   * @brief Allocator type.
+   */
+  using allocator_type  = t_allocator;
+  /**
+   * @brief Const reference type.
+   */
+  using const_reference = value_type const &;
+  /**
+   * @brief Const pointer type.
+   */
+  using const_pointer   = value_type const *;
+  /**
+   * @brief Const iterator over the elements in the storage (breadth-first) order.
+   */
+  using const_iterator  = typename t_storage::const_iterator;
+  /**
+   * @brief Iterator type, the elements are read-only.
+   */
+  using iterator        = const_iterator;
+
+private:
+  /**
+   * @brief Computes the largest power of 2 not greater than value.
+   * @param value the value.
+   * @param result the accumulated result.
+   * @return the power of 2.
+   */
+  constexpr static size_type M_floor_pow2(size_type value, size_type result = 1U) noexcept {
+    return ((result * 2U) <= value) ? M_floor_pow2(value, result * 2U) : result;
+  }
+
+  /**
+   * @brief Number of the elements in the cache line, the distance (in nodes) between a node and its first
+   * descendant which is prefetched.
+   */
+  static constexpr size_type m_prefetch_stride = M_floor_pow2(64U / ((sizeof(t_type) < 64U) ? sizeof(t_type) : 64U));
+
+  /**
+   * @brief Elements in the breadth-first order.
+   */
+  t_storage m_data;
+  /**
+   * @brief Comparison function object.
+   */
+  t_compare m_comp;
+
+public:
+  /**
+   * @brief Constructs the empty array.
+   */
+  eytzinger_array() noexcept : m_data(), m_comp() {
+  }
+
+  /**
+   * @brief Constructs the empty array.
+   * @param comp the comparison function object.
+   * @param alloc the allocator.
+   */
+  explicit eytzinger_array(t_compare const &comp, allocator_type const &alloc = allocator_type()) noexcept
+      : m_data(alloc), m_comp(comp) {
+  }
+
+  /**
+   * @brief Constructs the array from the sorted range [first, last).
+   * UB: the range is not sorted with respect to comp.
+   * @throw bad_alloc if memory for the elements cannot be allocated.
+   * @tparam t_forward_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   * @param alloc the allocator.
+   */
+  template<class t_forward_iterator>
+  eytzinger_array(t_forward_iterator    first,
+                  t_forward_iterator    last,
+                  t_compare const      &comp  = t_compare(),
+                  allocator_type const &alloc = allocator_type())
+      : m_data(alloc), m_comp(comp) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!assign(first, last));
+  }
+
+  /**
+   * @brief Constructs the array from the sorted range [first, last).
+   * UB: the range is not sorted with respect to comp.
+   * @tparam t_forward_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @param comp the comparison function object.
+   * @param alloc the allocator.
+   * @return the array or allocate_error if memory for the elements cannot be allocated.
+   */
+  template<class t_forward_iterator>
+  static ::portable_stl::expected<eytzinger_array, ::portable_stl::portable_stl_error> make_eytzinger_array(
+    t_forward_iterator    first,
+    t_forward_iterator    last,
+    t_compare const      &comp  = t_compare(),
+    allocator_type const &alloc = allocator_type()) {
+    eytzinger_array array(comp, alloc);
+    auto            result = array.assign(first, last);
+    if (!result) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{result.error()};
+    }
+    return ::portable_stl::expected<eytzinger_array, ::portable_stl::portable_stl_error>(::portable_stl::move(array));
+  }
+
+  /**
+   * @brief Replaces the elements with the sorted range [first, last).
+   * UB: the range is not sorted with respect to key_comp().
+   * @tparam t_forward_iterator the type of iterator.
+   * @param first the beginning of the range.
+   * @param last the end of the range.
+   * @return nothing or allocate_error if memory for the elements cannot be allocated, the array is empty then.
+   */
+  template<class t_forward_iterator>
+  ::portable_stl::expected<void, ::portable_stl::portable_stl_error> assign(t_forward_iterator first,
+                                                                            t_forward_iterator last) {
+    m_data.clear();
+    auto const count = static_cast<size_type>(::portable_stl::distance(first, last));
+    if (0U != count) {
+      auto result = m_data.resize(count, *first);
+      if (!result) {
+        return result;
+      }
+      // the in-order traversal of the tree visits the nodes in the sorted order
+      M_fill(first, 1U);
+    }
+    return ::portable_stl::expected<void, ::portable_stl::portable_stl_error>();
+  }
+
+  /**
+   * @brief Returns the number of the elements.
+   * @return the number of the elements.
+   */
+  size_type size() const noexcept {
+    return m_data.size();
+  }
+
+  /**
+   * @brief Checks if the array is empty.
+   * @return true if the array is empty.
+   */
+  bool empty() const noexcept {
+    return m_data.empty();
+  }
+
+  /**
+   * @brief Returns the pointer to the elements in the breadth-first order.
+   * @return the pointer to the elements.
+   */
+  const_pointer data() const noexcept {
+    return m_data.data();
+  }
+
+  /**
+   * @brief Returns the iterator to the first element in the breadth-first order.
+   * @return the iterator.
+   */
+  const_iterator begin() const noexcept {
+    return m_data.cbegin();
+  }
+
+  /**
+   * @brief Returns the iterator after the last element in the breadth-first order, also returned by the failed
+   * searches.
+   * @return the iterator.
+   */
+  const_iterator end() const noexcept {
+    return m_data.cend();
+  }
+
+  /**
+   * @brief Returns the comparison function object.
+   * @return the comparison function object.
+   */
+  key_compare key_comp() const {
+    return m_comp;
+  }
+
+  /**
+   * @brief Returns the allocator.
+   * @return the allocator.
+   */
+  allocator_type get_allocator() const noexcept {
+    return m_data.get_allocator();
+  }
+
+  /**
+   * @brief Finds the smallest element which is not less than value.
+   * @tparam t_key the type of the value.
+   * @param value the value to compare the elements to.
+   * @return the iterator to the found element or end().
+   */
+  template<class t_key> const_iterator lower_bound(t_key const &value) const {
+    t_compare                                                                 comp(m_comp);
+    ::portable_stl::algorithm_helper::lower_bound_predicate<t_key, t_compare> pred(value, comp);
+    return M_search(pred);
+  }
+
+  /**
+   * @brief Finds the smallest element which is greater than value.
+   * @tparam t_key the type of the value.
+   * @param value the value to compare the elements to.
+   * @return the iterator to the found element or end().
+   */
+  template<class t_key> const_iterator upper_bound(t_key const &value) const {
+    t_compare                                                                 comp(m_comp);
+    ::portable_stl::algorithm_helper::upper_bound_predicate<t_key, t_compare> pred(value, comp);
+    return M_search(pred);
+  }
+
+  /**
+   * @brief Finds the element equivalent to value.
+   * @tparam t_key the type of the value.
+   * @param value the value to search for.
+   * @return the iterator to the found element or end().
+   */
+  template<class t_key> const_iterator find(t_key const &value) const {
+    const_iterator const iter{lower_bound(value)};
+    if ((iter == end()) || m_comp(value, *iter)) {
+      return end();
+    }
+    return iter;
+  }
+
+  /**
+   * @brief Checks if there is the element equivalent to value.
+   * @tparam t_key the type of the value.
+   * @param value the value to search for.
+   * @return true if the element is found.
+   */
+  template<class t_key> bool contains(t_key const &value) const {
+    return find(value) != end();
+  }
+
+private:
+  /**
+   * @brief Assigns the elements of the subtree of node in the in-order traversal.
+   * @tparam t_forward_iterator the type of iterator.
+   * @param iter the iterator to the next element of the sorted range.
+   * @param node the index of the subtree root (counting from 1).
+   */
+  template<class t_forward_iterator> void M_fill(t_forward_iterator &iter, size_type node) {
+    if (node <= m_data.size()) {
+      M_fill(iter, 2U * node);
+      m_data[node - 1U] = *iter;
+      ++iter;
+      M_fill(iter, 2U * node + 1U);
+    }
+  }
+
+  /**
+   * @brief Finds the first element in the sorted order for which pred returns false.
+   * The search descends to a leaf, going right while pred returns true. The answer is the last node where the search
+   * went left: the trailing ones of the final index are the right turns after it, the index of the node remains when
+   * they are shifted out with the left turn.
+   *
+   * @tparam t_predicate the type of the predicate.
+   * @param pred the predicate, true for the elements before the found one.
+   * @return the iterator to the found element or end().
+   */
+  template<class t_predicate> const_iterator M_search(t_predicate const &pred) const {
+    size_type const     count{m_data.size()};
+    const_pointer const nodes{m_data.data()};
+
+    size_type node{1U};
+    while (node <= count) {
+      if (node * m_prefetch_stride <= count) {
+        ::portable_stl::prefetch(nodes + (node * m_prefetch_stride - 1U));
+      }
+      node = 2U * node + static_cast<size_type>(pred(nodes[node - 1U]));
+    }
+    node >>= static_cast<size_type>(::portable_stl::ctz(~node)) + 1U;
+    return (0U == node) ? end() : (begin() + static_cast<typename t_storage::difference_type>(node - 1U));
+  }
+};
+
+template<class t_type, class t_compare, class t_allocator>
+constexpr typename eytzinger_array<t_type, t_compare, t_allocator>::size_type
+  eytzinger_array<t_type, t_compare, t_allocator>::m_prefetch_stride;
+} // namespace portable_stl
+
+#endif // PSTL_EYTZINGER_ARRAY_H
@@ -0,0 +1,322 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="rank_select.h"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#ifndef PSTL_RANK_SELECT_H
+#define PSTL_RANK_SELECT_H
+
+#include "../algorithm/min.h"
+#include "../algorithm/popcount.h"
+#include "../common/size_t.h"
+#include "../common/uint16_t.h"
+#include "../common/uint64_t.h"
+#include "../error/portable_stl_error.h"
+#include "../language_support/bad_alloc.h"
+#include "../memory/allocator.h"
+#include "../memory/allocator_traits.h"
+#include "../memory/rebind_alloc.h"
+#include "../utility/expected/expected.h"
+#include "../utility/expected/unexpected.h"
+#include "../utility/general/move.h"
+#include "bit_algo/bit_word_ops.h"
+#include "vector.h"
+#include "vector_bool.h"
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#  include "../language_support/exception/throw_on_true.h"
+#else
+#  include "../language_support/no_exception/throw_on_true.h"
+#endif
+
+namespace portable_stl {
+/**
+ * @brief Succinct rank/select index over the bits of vector<bool>.
+ * The index keeps a two-level directory of cumulative popcounts: the absolute number of ones before every superblock
+ * of 4096 bits (64-bit counters) and the number of ones from the superblock start before every block of 512 bits
+ * (16-bit counters), about 4.7% of the bitvector size. rank1 reads one counter of each level and counts at most one
+ * block. The superblock of every 4096-th one is sampled to narrow the search of select1.
+ *
+ * The index refers to the storage of the bitvector, so the bitvector must outlive the index and must not be modified
+ * or reallocated while the index is used.
+ *
+ * @tparam t_allocator the allocator type of the bitvector, also used for the directory.
+ */
+template<class t_allocator = ::portable_stl::allocator<bool>> class rank_select final {
+public:
+  /**
+   * @brief Indexed bitvector type.
+   */
+  using bit_vector     = ::portable_stl::vector<bool, t_allocator>;
+  /**
+   * @brief Size type.
+   */
+  using size_type      = ::portable_stl::size_t;
+  /**
+   * @brief Allocator type.
+   */
+  using allocator_type = t_allocator;
+
+  /**
+   * @brief Value returned by select when there is no such bit.
+   */
+  static size_type const npos = static_cast<size_type>(-1);
+
+private:
+  /**
+   * @brief Storage word type of the bitvector.
+   */
+  using t_storage_type = typename bit_vector::t_storage_type;
+
+  /**
+   * @brief Superblock counters allocator.
+   */
+  using t_super_allocator
+    = ::portable_stl::rebind_alloc<::portable_stl::allocator_traits<allocator_type>, ::portable_stl::uint64_t>;
+  /**
+   * @brief Block counters allocator.
+   */
+  using t_block_allocator
+    = ::portable_stl::rebind_alloc<::portable_stl::allocator_traits<allocator_type>, ::portable_stl::uint16_t>;
+
+  /**
+   * @brief Bits in the storage word.
+   */
+  static constexpr size_type m_bits_per_word = bit_algo::word_bits<t_storage_type>::value;
+  /**
+   * @brief Bits in the block.
+   */
+  static constexpr size_type m_block_bits    = 512U;
+  /**
+   * @brief Words in the block.
+   */
+  static constexpr size_type m_block_words   = m_block_bits / m_bits_per_word;
+  /**
+   * @brief Blocks in the superblock.
+   */
+  static constexpr size_type m_super_blocks  = 8U;
+  /**
+   * @brief Number of ones between the select samples.
+   */
+  static constexpr size_type m_select_sample = 4096U;
+
+  static_assert(0U == (m_block_bits % m_bits_per_word), "storage word must divide the block");
+
+  /**
+   * @brief Storage words of the bitvector.
+   */
+  t_storage_type const *m_words;
+  /**
+   * @brief Number of bits.
+   */
+  size_type             m_size;
+  /**
+   * @brief Number of ones.
+   */
+  size_type             m_ones;
+  /**
+   * @brief Number of ones before every superblock (one extra for the end).
+   */
+  ::portable_stl::vector<::portable_stl::uint64_t, t_super_allocator> m_super;
+  /**
+   * @brief Number of ones from the superblock start before every block (one extra for the end).
+   */
+  ::portable_stl::vector<::portable_stl::uint16_t, t_block_allocator> m_block;
+  /**
+   * @brief Superblock of every m_select_sample-th one.
+   */
+  ::portable_stl::vector<::portable_stl::uint64_t, t_super_allocator> m_select;
+
+  /**
+   * @brief Constructs empty index over the bitvector, the directory is not built.
+   * @param bits the bitvector.
+   * @param alloc the allocator for the directory.
+   */
+  rank_select(bit_vector const &bits, allocator_type const &alloc) noexcept
+      : m_words(bit_algo::word_address(bits.cbegin())),
+        m_size(bits.size()),
+        m_ones(0U),
+        m_super(t_super_allocator(alloc)),
+        m_block(t_block_allocator(alloc)),
+        m_select(t_super_allocator(alloc)) {
+  }
+
+public:
+  /**
+   * @brief Builds the index over the bitvector.
+   * @throw bad_alloc if memory for the directory cannot be allocated.
+   * @param bits the bitvector.
+   */
+  explicit rank_select(bit_vector const &bits) : rank_select(bits, bits.get_allocator()) {
+    ::portable_stl::throw_on_true<::portable_stl::bad_alloc<>>(!M_build());
+  }
+
+  /**
+   * @brief Builds the index over the bitvector.
+   * @param bits the bitvector.
+   * @return the index or allocate_error if memory for the directory cannot be allocated.
+   */
+  static ::portable_stl::expected<rank_select, ::portable_stl::portable_stl_error> make_rank_select(
+    bit_vector const &bits) noexcept {
+    rank_select index(bits, bits.get_allocator());
+    if (!index.M_build()) {
+      return ::portable_stl::unexpected<::portable_stl::portable_stl_error>{
+        ::portable_stl::portable_stl_error::allocate_error};
+    }
+    return ::portable_stl::expected<rank_select, ::portable_stl::portable_stl_error>(::portable_stl::move(index));
+  }
+
+  /**
+   * @brief Returns the number of indexed bits.
+   * @return the number of bits.
+   */
+  size_type size() const noexcept {
+    return m_size;
+  }
+
+  /**
+   * @brief Returns the number of ones.
+   * @return the number of ones.
+   */
+  size_type count() const noexcept {
+    return m_ones;
+  }
+
+  /**
+   * @brief Returns the number of ones in the positions [0, pos).
+   * UB: pos > size().
+   * @param pos the position.
+   * @return the number of ones before pos.
+   */
+  size_type rank1(size_type pos) const noexcept {
+    size_type const block{pos / m_block_bits};
+    size_type const word{pos / m_bits_per_word};
+    size_type       result{static_cast<size_type>(m_super[block / m_super_blocks]) + m_block[block]};
+    result += bit_algo::count_words(m_words + block * m_block_words, word - block * m_block_words);
+
+    size_type const bits{pos % m_bits_per_word};
+    if (bits != 0U) {
+      result += static_cast<size_type>(
+        ::portable_stl::popcount(m_words[word] & ((t_storage_type(1) << bits) - 1U)));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns the number of zeros in the positions [0, pos).
+   * UB: pos > size().
+   * @param pos the position.
+   * @return the number of zeros before pos.
+   */
+  size_type rank0(size_type pos) const noexcept {
+    return pos - rank1(pos);
+  }
+
+  /**
+   * @brief Finds the position of the one with the given rank (the number of ones before it).
+   * @param rank the rank of the one, starting from 0.
+   * @return the position of the one or npos if rank >= count().
+   */
+  size_type select1(size_type rank) const noexcept {
+    if (rank >= m_ones) {
+      return npos;
+    }
+
+    // the sampled superblocks bound the superblock of the one
+    size_type const sample{rank / m_select_sample};
+    size_type       low{static_cast<size_type>(m_select[sample])};
+    size_type       high{(sample + 1U < m_select.size()) ? static_cast<size_type>(m_select[sample + 1U])
+                                                         : (m_super.size() - 2U)};
+    // find the last superblock with less than or equal to rank ones before it
+    while (low < high) {
+      size_type const middle{low + (high - low + 1U) / 2U};
+      if (m_super[middle] <= rank) {
+        low = middle;
+      } else {
+        high = middle - 1U;
+      }
+    }
+    rank -= static_cast<size_type>(m_super[low]);
+
+    // find the block in the superblock
+    size_type       block{low * m_super_blocks};
+    size_type const last_block{::portable_stl::min(block + m_super_blocks, m_block.size() - 1U)};
+    while ((block + 1U < last_block) && (m_block[block + 1U] <= rank)) {
+      ++block;
+    }
+    rank -= m_block[block];
+
+    // find the word in the block
+    size_type word{block * m_block_words};
+    for (;; ++word) {
+      auto const ones = static_cast<size_type>(::portable_stl::popcount(m_words[word]));
+      if (rank < ones) {
+        break;
+      }
+      rank -= ones;
+    }
+    return word * m_bits_per_word + bit_algo::select_in_word(m_words[word], rank);
+  }
+
+private:
+  /**
+   * @brief Builds the directory.
+   * @return true if success, false if memory cannot be allocated.
+   */
+  bool M_build() noexcept {
+    size_type const words{(m_size + m_bits_per_word - 1U) / m_bits_per_word};
+    size_type const blocks{(m_size + m_block_bits - 1U) / m_block_bits};
+
+    if ((!m_block.resize(blocks + 1U)) || (!m_super.resize(blocks / m_super_blocks + 2U))) {
+      return false;
+    }
+
+    size_type ones{0U};
+    for (size_type block{0U}; block <= blocks; ++block) {
+      if (0U == (block % m_super_blocks)) {
+        m_super[block / m_super_blocks] = ones;
+      }
+      m_block[block] = static_cast<::portable_stl::uint16_t>(ones - m_super[block / m_super_blocks]);
+
+      size_type const first_word{block * m_block_words};
+      size_type const last_word{::portable_stl::min(first_word + m_block_words, words)};
+      if (first_word < last_word) {
+        ones += bit_algo::count_words(m_words + first_word, last_word - first_word - 1U);
+        // the bits of the last word beyond the size are not part of the bitvector
+        t_storage_type last_value{m_words[last_word - 1U]};
+        if ((last_word == words) && (0U != (m_size % m_bits_per_word))) {
+          last_value &= (t_storage_type(1) << (m_size % m_bits_per_word)) - 1U;
+        }
+        ones += static_cast<size_type>(::portable_stl::popcount(last_value));
+      }
+    }
+    // the superblock after the end
+    m_super[m_super.size() - 1U] = ones;
+    m_ones                       = ones;
+
+    // sample the superblock of every m_select_sample-th one
+    if (!m_select.resize((ones + m_select_sample - 1U) / m_select_sample)) {
+      return false;
+    }
+    size_type super{0U};
+    for (size_type sample{0U}; sample < m_select.size(); ++sample) {
+      size_type const rank{sample * m_select_sample};
+      while (m_super[super + 1U] <= rank) {
+        ++super;
+      }
+      m_select[sample] = super;
+    }
+    return true;
+  }
+};
+
+template<class t_allocator> typename rank_select<t_allocator>::size_type const rank_select<t_allocator>::npos;
+} // namespace portable_stl
+
+#endif // PSTL_RANK_SELECT_H
@@ -18,6 +18,7 @@
 #include "../memory/compressed_pair.h"
 #include "../memory/rebind_alloc.h"
 #include "../metaprogramming/type_traits/has_storage_type.h"
+#include "bit_algo/bit_word_ops.h"
 #include "bit_reference.h"
 #include "vector.h"
 
@@ -97,6 +98,24 @@ private:
     return (num - 1) / m_bits_per_word + 1;
   }
 
+  /**
+   * @brief Returns the number of storage words holding the elements.
+   * @return the number of storage words.
+   */
+  size_type M_words() const noexcept {
+    return (m_size + m_bits_per_word - 1U) / m_bits_per_word;
+  }
+
+  /**
+   * @brief Sets to zero the bits of the last storage word beyond size().
+   */
+  void M_clear_tail() noexcept {
+    size_type const tail{m_size % m_bits_per_word};
+    if (tail != 0U) {
+      m_begin[m_size / m_bits_per_word] &= ~t_storage_type(0) >> (m_bits_per_word - tail);
+    }
+  }
+
 public:
   vector() noexcept(noexcept(allocator_type()));
 
@@ -359,6 +378,88 @@ public:
 
   void flip() noexcept;
 
+  // [bit operations]
+
+  /**
+   * @brief Returns the number of bits set to true.
+   * @return the number of bits set to true.
+   */
+  size_type count() const noexcept {
+    return static_cast<size_type>(bit_algo::count_bool<true>(cbegin(), m_size));
+  }
+
+  /**
+   * @brief Checks if any bit is set to true.
+   * @return true if any bit is set to true, false otherwise.
+   */
+  bool any() const noexcept {
+    return bit_algo::find_bool<true>(cbegin(), m_size) != cend();
+  }
+
+  /**
+   * @brief Checks if all bits are set to true.
+   * @return true if all bits are set to true or the container is empty, false otherwise.
+   */
+  bool all() const noexcept {
+    return bit_algo::find_bool<false>(cbegin(), m_size) == cend();
+  }
+
+  /**
+   * @brief Checks if none of the bits is set to true.
+   * @return true if none of the bits is set to true, false otherwise.
+   */
+  bool none() const noexcept {
+    return !any();
+  }
+
+  /**
+   * @brief Sets the bits to the result of binary AND on corresponding bits of *this and other.
+   * UB: other.size() != size().
+   * @param other the other vector.
+   * @return *this.
+   */
+  vector &operator&=(vector const &other) noexcept;
+
+  /**
+   * @brief Sets the bits to the result of binary OR on corresponding bits of *this and other.
+   * UB: other.size() != size().
+   * @param other the other vector.
+   * @return *this.
+   */
+  vector &operator|=(vector const &other) noexcept;
+
+  /**
+   * @brief Sets the bits to the result of binary XOR on corresponding bits of *this and other.
+   * UB: other.size() != size().
+   * @param other the other vector.
+   * @return *this.
+   */
+  vector &operator^=(vector const &other) noexcept;
+
+  /**
+   * @brief Clears the bits that are set in other (*this &= ~other).
+   * UB: other.size() != size().
+   * @param other the other vector.
+   * @return *this.
+   */
+  vector &and_not(vector const &other) noexcept;
+
+  /**
+   * @brief Shifts the bits to the higher positions (bit i moves to i + num), the vacated positions are set to false.
+   * The size is not changed.
+   * @param num the number of positions to shift.
+   * @return *this.
+   */
+  vector &operator<<=(size_type num) noexcept;
+
+  /**
+   * @brief Shifts the bits to the lower positions (bit i moves to i - num), the vacated positions are set to false.
+   * The size is not changed.
+   * @param num the number of positions to shift.
+   * @return *this.
+   */
+  vector &operator>>=(size_type num) noexcept;
+
 private:
   template<class t_iterator, class t_sentinel>
   ::portable_stl::expected<void, ::portable_stl::portable_stl_error> M_assign_with_sentinel(t_iterator first,
@@ -1401,20 +1502,61 @@ template<class t_allocator>
 
 template<class t_allocator> void vector<bool, t_allocator>::flip() noexcept {
   // do middle whole words
-  size_type         num{m_size};
-  t_storage_pointer pos_storage{m_begin};
-  for (; num >= m_bits_per_word; ++pos_storage, num -= m_bits_per_word) {
-    *pos_storage = ~*pos_storage;
-  }
+  size_type const numw{m_size / m_bits_per_word};
+  bit_algo::not_words(::portable_stl::to_address(m_begin), numw);
   // do last partial word
+  size_type const num{m_size - numw * m_bits_per_word};
   if (num > 0U) {
-    t_storage_type m = ~t_storage_type(0) >> (m_bits_per_word - num);
-    t_storage_type b = *pos_storage & m;
+    t_storage_pointer pos_storage{m_begin + static_cast<difference_type>(numw)};
+    t_storage_type    m = ~t_storage_type(0) >> (m_bits_per_word - num);
+    t_storage_type    b = *pos_storage & m;
     *pos_storage &= ~m;
     *pos_storage |= ~b & m;
   }
 }
 
+template<class t_allocator>
+vector<bool, t_allocator> &vector<bool, t_allocator>::operator&=(vector const &other) noexcept {
+  bit_algo::and_words(::portable_stl::to_address(m_begin), ::portable_stl::to_address(other.m_begin), M_words());
+  return *this;
+}
+
+template<class t_allocator>
+vector<bool, t_allocator> &vector<bool, t_allocator>::operator|=(vector const &other) noexcept {
+  bit_algo::or_words(::portable_stl::to_address(m_begin), ::portable_stl::to_address(other.m_begin), M_words());
+  return *this;
+}
+
+template<class t_allocator>
+vector<bool, t_allocator> &vector<bool, t_allocator>::operator^=(vector const &other) noexcept {
+  bit_algo::xor_words(::portable_stl::to_address(m_begin), ::portable_stl::to_address(other.m_begin), M_words());
+  return *this;
+}
+
+template<class t_allocator>
+vector<bool, t_allocator> &vector<bool, t_allocator>::and_not(vector const &other) noexcept {
+  bit_algo::and_not_words(::portable_stl::to_address(m_begin), ::portable_stl::to_address(other.m_begin), M_words());
+  return *this;
+}
+
+template<class t_allocator>
+vector<bool, t_allocator> &vector<bool, t_allocator>::operator<<=(size_type num) noexcept {
+  // bits moved beyond size() stay in the unused part of the last word
+  bit_algo::shift_up_words(::portable_stl::to_address(m_begin), M_words(), num);
+  return *this;
+}
+
+template<class t_allocator>
+vector<bool, t_allocator> &vector<bool, t_allocator>::operator>>=(size_type num) noexcept {
+  size_type const words{M_words()};
+  if (words > 0U) {
+    // the unused part of the last word must not be shifted into the elements
+    M_clear_tail();
+    bit_algo::shift_down_words(::portable_stl::to_address(m_begin), words, num);
+  }
+  return *this;
+}
+
 template<typename t_allocator>
 inline bool operator==(vector<bool, t_allocator> const &left, vector<bool, t_allocator> const &right) {
   typename vector<bool, t_allocator>::size_type const left_size{left.size()};
@@ -0,0 +1,452 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="algorithm_benchmark.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "portable_stl/algorithm/count.h"
+#include "portable_stl/algorithm/find.h"
+#include "portable_stl/algorithm/max_element.h"
+#include "portable_stl/algorithm/min_element.h"
+#include "portable_stl/algorithm/partition.h"
+#include "portable_stl/algorithm/remove_if.h"
+#include "portable_stl/algorithm/search.h"
+#include "portable_stl/algorithm/stable_partition.h"
+#include "portable_stl/forward_list/forward_list.h"
+#include "portable_stl/functional/boyer_moore_horspool_searcher.h"
+#include "portable_stl/functional/boyer_moore_searcher.h"
+#include "portable_stl/functional/default_searcher.h"
+#include "portable_stl/iterator/distance.h"
+#include "portable_stl/iterator/next.h"
+#include "portable_stl/list/list.h"
+#include "portable_stl/numeric/inclusive_scan.h"
+#include "portable_stl/numeric/reduce.h"
+#include "portable_stl/numeric/transform_reduce.h"
+
+/**
+ * @brief Number of the elements of the scanned ranges.
+ */
+constexpr std::size_t scan_size{100000U};
+
+/**
+ * @brief Size of the searched texts in bytes.
+ */
+constexpr std::size_t text_bytes{1024U * 1024U};
+
+/**
+ * @brief Number of the elements of the searched patterns.
+ */
+constexpr std::size_t pattern_size{32U};
+
+/**
+ * @brief Number of the elements of the partitioned ranges.
+ */
+constexpr std::size_t partition_size{4000000U};
+
+/**
+ * @brief Number of the elements of the sorted lists.
+ */
+constexpr std::size_t list_size{10000000U};
+
+/**
+ * @brief Number of the runs of every measurement, the fastest run is reported.
+ */
+constexpr std::int32_t run_count{50};
+
+/**
+ * @brief Number of the runs of the list sort measurements, which take seconds each.
+ */
+constexpr std::int32_t list_run_count{3};
+
+/**
+ * @brief Keeps the results of the measured calls alive.
+ */
+static std::ptrdiff_t volatile sink{0};
+
+/**
+ * @brief Measures the fastest of the runs of the function, the setup before every run is not measured.
+ *
+ * @tparam t_setup the type of the setup.
+ * @tparam t_function the type of the function.
+ * @param setup the setup of the run.
+ * @param function the measured function.
+ * @param runs the number of the runs.
+ * @return the time of the fastest run in microseconds.
+ */
+template<class t_setup, class t_function>
+static double best_time(t_setup setup, t_function function, std::int32_t runs = run_count) {
+  double best{0.0};
+  for (std::int32_t run{0}; run < runs; ++run) {
+    setup();
+    auto const                                      start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::micro> const elapsed{std::chrono::steady_clock::now() - start};
+    if ((run == 0) || (elapsed.count() < best)) {
+      best = elapsed.count();
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief Measures the fastest of the runs of the function.
+ *
+ * @tparam t_function the type of the function.
+ * @param function the measured function.
+ * @return the time of the fastest run in microseconds.
+ */
+template<class t_function> static double best_time(t_function function) {
+  return best_time([]() {}, function);
+}
+
+/**
+ * @brief Prints the times of the standard and the portable algorithms and their ratio.
+ *
+ * @param name the name of the measurement.
+ * @param type_name the name of the element type.
+ * @param std_time the time of the standard algorithm.
+ * @param portable_time the time of the portable algorithm.
+ */
+static void report(char const *name, char const *type_name, double std_time, double portable_time) {
+  std::printf("%-18s %-9s %10.1f us %10.1f us %7.1fx\n",
+              name,
+              type_name,
+              std_time,
+              portable_time,
+              std_time / portable_time);
+}
+
+/**
+ * @brief Measures find of the absent value, count and min_element/max_element on scan_size random elements.
+ *
+ * @tparam t_type the type of the elements.
+ * @param type_name the name of the element type.
+ */
+template<class t_type> static void scan_benchmark(char const *type_name) {
+  std::mt19937        engine{12345U};
+  std::vector<t_type> values(scan_size);
+  for (auto &value : values) {
+    value = static_cast<t_type>(engine() % 100U + 1U);
+  }
+  t_type const *const first{values.data()};
+  t_type const *const last{first + values.size()};
+  t_type const        absent{0};
+  t_type const        present{values[scan_size / 2U]};
+
+  report("find",
+         type_name,
+         best_time([&]() { sink = std::find(first, last, absent) - first; }),
+         best_time([&]() { sink = ::portable_stl::find(first, last, absent) - first; }));
+  report("count",
+         type_name,
+         best_time([&]() { sink = std::count(first, last, present); }),
+         best_time([&]() { sink = ::portable_stl::count(first, last, present); }));
+  report("min_element",
+         type_name,
+         best_time([&]() { sink = std::min_element(first, last) - first; }),
+         best_time([&]() { sink = ::portable_stl::min_element(first, last) - first; }));
+  report("max_element",
+         type_name,
+         best_time([&]() { sink = std::max_element(first, last) - first; }),
+         best_time([&]() { sink = ::portable_stl::max_element(first, last) - first; }));
+}
+
+/**
+ * @brief Measures reduce, transform_reduce and inclusive_scan on scan_size random elements against the sequential
+ * std::accumulate, std::inner_product and std::partial_sum.
+ *
+ * @tparam t_type the type of the elements.
+ * @param type_name the name of the element type.
+ */
+template<class t_type> static void numeric_benchmark(char const *type_name) {
+  std::mt19937        engine{12345U};
+  std::vector<t_type> values(scan_size);
+  for (auto &value : values) {
+    value = static_cast<t_type>(engine() % 100U + 1U);
+  }
+  std::vector<t_type> output(scan_size);
+  t_type const *const first{values.data()};
+  t_type const *const last{first + values.size()};
+  t_type *const       d_first{output.data()};
+  t_type volatile     result{0};
+
+  report("reduce",
+         type_name,
+         best_time([&]() { result = std::accumulate(first, last, t_type{0}); }),
+         best_time([&]() { result = ::portable_stl::reduce(first, last, t_type{0}); }));
+  report("transform_reduce",
+         type_name,
+         best_time([&]() { result = std::inner_product(first, last, first, t_type{0}); }),
+         best_time([&]() { result = ::portable_stl::transform_reduce(first, last, first, t_type{0}); }));
+  report("inclusive_scan",
+         type_name,
+         best_time([&]() { sink = std::partial_sum(first, last, d_first) - d_first; }),
+         best_time([&]() { sink = ::portable_stl::inclusive_scan(first, last, d_first) - d_first; }));
+}
+
+/**
+ * @brief Measures search with the default, Boyer-Moore and Boyer-Moore-Horspool searchers against std::search. The
+ * text is text_bytes of random letters of the alphabet and the pattern_size pattern is found only at its end. The
+ * searchers are built before the measurement.
+ *
+ * @tparam t_char the type of the characters.
+ * @param type_name the name of the character type and the alphabet.
+ * @param alphabet_size the number of the letters.
+ */
+template<class t_char> static void search_benchmark(char const *type_name, std::uint32_t alphabet_size) {
+  std::mt19937        engine{12345U};
+  std::vector<t_char> text(text_bytes / sizeof(t_char));
+  for (auto &value : text) {
+    value = static_cast<t_char>(static_cast<std::uint32_t>('a') + engine() % alphabet_size);
+  }
+  t_char const *const first{text.data()};
+  t_char const *const last{first + text.size()};
+  t_char const *const pattern_first{last - pattern_size};
+  t_char const *const pattern_last{last};
+  std::vector<t_char> pattern(pattern_first, pattern_last);
+
+  double const std_time{best_time([&]() { sink = std::search(first, last, pattern_first, pattern_last) - first; })};
+
+  ::portable_stl::default_searcher<t_char const *> const default_searcher(pattern.data(),
+                                                                          pattern.data() + pattern.size());
+  report("default_searcher",
+         type_name,
+         std_time,
+         best_time([&]() { sink = ::portable_stl::search(first, last, default_searcher) - first; }));
+  ::portable_stl::boyer_moore_searcher<t_char const *> const boyer_moore(pattern.data(),
+                                                                         pattern.data() + pattern.size());
+  report("boyer_moore",
+         type_name,
+         std_time,
+         best_time([&]() { sink = ::portable_stl::search(first, last, boyer_moore) - first; }));
+  ::portable_stl::boyer_moore_horspool_searcher<t_char const *> const horspool(pattern.data(),
+                                                                               pattern.data() + pattern.size());
+  report("horspool",
+         type_name,
+         std_time,
+         best_time([&]() { sink = ::portable_stl::search(first, last, horspool) - first; }));
+}
+
+/**
+ * @brief Measures partition, stable_partition and remove_if with the parity predicate on partition_size random
+ * elements, every run starts from the same copy.
+ */
+static void partition_benchmark() {
+  std::mt19937              engine{12345U};
+  std::vector<std::int32_t> source(partition_size);
+  for (auto &value : source) {
+    value = static_cast<std::int32_t>(engine() >> 1U);
+  }
+  std::vector<std::int32_t> values;
+  std::int32_t             *first{nullptr};
+  std::int32_t             *last{nullptr};
+  auto const                restore = [&]() {
+    values = source;
+    first  = values.data();
+    last   = first + values.size();
+  };
+  auto const is_even = [](std::int32_t value) { return (value % 2) == 0; };
+
+  report("partition",
+         "int32_t",
+         best_time(restore, [&]() { sink = std::partition(first, last, is_even) - first; }),
+         best_time(restore, [&]() { sink = ::portable_stl::partition(first, last, is_even) - first; }));
+  report("stable_partition",
+         "int32_t",
+         best_time(restore, [&]() { sink = std::stable_partition(first, last, is_even) - first; }),
+         best_time(restore, [&]() { sink = ::portable_stl::stable_partition(first, last, is_even) - first; }));
+  report("remove_if",
+         "int32_t",
+         best_time(restore, [&]() { sink = std::remove_if(first, last, is_even) - first; }),
+         best_time(restore, [&]() { sink = ::portable_stl::remove_if(first, last, is_even) - first; }));
+}
+
+/**
+ * @brief The recursive merge sort list::sort used before the bottom-up one. Same-list splice only relinks the nodes,
+ * so it repeats the steps of the old private list::M_sort.
+ *
+ * @tparam t_list the type of the list.
+ * @tparam t_compare the type of the comparison.
+ * @param lst the sorted list.
+ * @param first1 the first element of the sorted range.
+ * @param end2 the end of the sorted range.
+ * @param num the number of the elements of the range.
+ * @param comp the comparison.
+ * @return the first element of the sorted range.
+ */
+template<class t_list, class t_compare>
+static typename t_list::iterator recursive_sort(t_list                   &lst,
+                                                typename t_list::iterator first1,
+                                                typename t_list::iterator end2,
+                                                std::size_t               num,
+                                                t_compare                &comp) {
+  using iterator = typename t_list::iterator;
+  if (num < 2U) {
+    return first1;
+  }
+  if (num == 2U) {
+    if (comp(*--end2, *first1)) {
+      lst.splice(first1, lst, end2);
+      return end2;
+    }
+    return first1;
+  }
+  std::size_t const num_div_2{num / 2U};
+  iterator          end1{::portable_stl::next(first1, static_cast<std::ptrdiff_t>(num_div_2))};
+  iterator          ret = first1 = recursive_sort(lst, first1, end1, num_div_2, comp);
+  iterator          first2 = end1 = recursive_sort(lst, end1, end2, num - num_div_2, comp);
+  if (comp(*first2, *first1)) {
+    iterator next_node2{::portable_stl::next(first2)};
+    for (; (next_node2 != end2) && comp(*next_node2, *first1); ++next_node2) {
+    }
+    iterator const run_first{first2};
+    ret = first2;
+    end1 = first2 = next_node2;
+    lst.splice(first1, lst, run_first, next_node2);
+  }
+  ++first1;
+  while ((first1 != end1) && (first2 != end2)) {
+    if (comp(*first2, *first1)) {
+      iterator next_node2{::portable_stl::next(first2)};
+      for (; (next_node2 != end2) && comp(*next_node2, *first1); ++next_node2) {
+      }
+      iterator const run_first{first2};
+      if (end1 == first2) {
+        end1 = next_node2;
+      }
+      first2 = next_node2;
+      lst.splice(first1, lst, run_first, next_node2);
+    }
+    ++first1;
+  }
+  return ret;
+}
+
+/**
+ * @brief The recursive merge sort forward_list::sort used before the bottom-up one: it cuts the list in the middle,
+ * sorts both halves and merges them. splice_after has to walk the moved half to find its last node, which the old
+ * private forward_list::sort_impl did not, so this version is somewhat slower than the old one was.
+ *
+ * @tparam t_type the type of the elements.
+ * @tparam t_compare the type of the comparison.
+ * @param lst the sorted list.
+ * @param size the number of the elements of the list.
+ * @param comp the comparison.
+ */
+template<class t_type, class t_compare>
+static void recursive_sort(::portable_stl::forward_list<t_type> &lst, std::size_t size, t_compare &comp) {
+  if (size < 2U) {
+    return;
+  }
+  if (size == 2U) {
+    if (comp(*::portable_stl::next(lst.begin()), *lst.begin())) {
+      lst.splice_after(lst.before_begin(), lst, lst.begin());
+    }
+    return;
+  }
+  std::size_t const                    size_left{size / 2U};
+  ::portable_stl::forward_list<t_type> right;
+  right.splice_after(right.before_begin(),
+                     lst,
+                     ::portable_stl::next(lst.begin(), static_cast<std::ptrdiff_t>(size_left - 1U)),
+                     lst.end());
+  recursive_sort(lst, size_left, comp);
+  recursive_sort(right, size - size_left, comp);
+  lst.merge(right, comp);
+}
+
+/**
+ * @brief Measures list::sort and forward_list::sort on list_size random elements against the recursive merge sorts
+ * they replaced, every run starts from a list rebuilt from the same values.
+ */
+static void list_sort_benchmark() {
+  std::mt19937              engine{12345U};
+  std::vector<std::int32_t> source(list_size);
+  for (auto &value : source) {
+    value = static_cast<std::int32_t>(engine() >> 1U);
+  }
+  auto const less = [](std::int32_t left, std::int32_t right) { return left < right; };
+
+  ::portable_stl::list<std::int32_t> lst;
+  auto const                         restore_list = [&]() {
+    lst.clear();
+    lst.insert(lst.end(), source.data(), source.data() + source.size());
+  };
+  report("list::sort",
+         "int32_t",
+         best_time(
+           restore_list,
+           [&]() { sink = *recursive_sort(lst, lst.begin(), lst.end(), lst.size(), less); },
+           list_run_count),
+         best_time(
+           restore_list,
+           [&]() {
+             lst.sort(less);
+             sink = lst.front();
+           },
+           list_run_count));
+  lst.clear();
+
+  ::portable_stl::forward_list<std::int32_t> flst;
+  auto const                                 restore_forward_list = [&]() {
+    flst.clear();
+    flst.insert_after(flst.before_begin(), source.data(), source.data() + source.size());
+  };
+  report("forward_list::sort",
+         "int32_t",
+         best_time(
+           restore_forward_list,
+           [&]() {
+             recursive_sort(flst, static_cast<std::size_t>(::portable_stl::distance(flst.begin(), flst.end())), less);
+             sink = flst.front();
+           },
+           list_run_count),
+         best_time(
+           restore_forward_list,
+           [&]() {
+             flst.sort(less);
+             sink = flst.front();
+           },
+           list_run_count));
+}
+
+/**
+ * @brief Compares the portable algorithms with the standard library on the same data.
+ * The figures depend on the compiler, the flags (-msse2 is the x86-64 baseline, -mavx2 selects the AVX2 lanes) and
+ * the machine, so they are printed rather than stated.
+ *
+ * @return 0.
+ */
+int main() {
+  std::printf("%-18s %-9s %13s %13s %8s\n", "algorithm", "type", "std", "portable", "speedup");
+  scan_benchmark<std::uint8_t>("uint8_t");
+  scan_benchmark<std::int16_t>("int16_t");
+  scan_benchmark<std::int32_t>("int32_t");
+  scan_benchmark<std::int64_t>("int64_t");
+  scan_benchmark<float>("float");
+  scan_benchmark<double>("double");
+  numeric_benchmark<std::uint64_t>("uint64_t");
+  numeric_benchmark<double>("double");
+  search_benchmark<char>("char/26", 26U);
+  search_benchmark<char>("char/4", 4U);
+  search_benchmark<char16_t>("u16/26", 26U);
+  search_benchmark<char16_t>("u16/4", 4U);
+  partition_benchmark();
+  std::printf("%-18s %-9s %13s %13s %8s\n", "algorithm", "type", "recursive", "bottom-up", "speedup");
+  list_sort_benchmark();
+  return 0;
+}
@@ -11,12 +11,61 @@
 // ***************************************************************************
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/test_allocator.h"
 #include "iterator_helper.h"
 #include "portable_stl/algorithm/any_of.h"
+#include "portable_stl/algorithm/binary_search.h"
+#include "portable_stl/algorithm/count.h"
+#include "portable_stl/algorithm/equal_range.h"
+#include "portable_stl/algorithm/ctz.h"
+#include "portable_stl/algorithm/find.h"
 #include "portable_stl/algorithm/find_end.h"
 #include "portable_stl/algorithm/find_first_of.h"
 #include "portable_stl/algorithm/find_if_not.h"
+#include "portable_stl/algorithm/includes.h"
+#include "portable_stl/algorithm/inplace_merge.h"
+#include "portable_stl/algorithm/is_heap.h"
+#include "portable_stl/algorithm/lower_bound.h"
+#include "portable_stl/algorithm/max_element.h"
+#include "portable_stl/algorithm/make_heap.h"
+#include "portable_stl/algorithm/merge.h"
+#include "portable_stl/algorithm/min_element.h"
+#include "portable_stl/algorithm/minmax_element.h"
+#include "portable_stl/algorithm/mismatch.h"
+#include "portable_stl/algorithm/nth_element.h"
+#include "portable_stl/algorithm/partial_sort.h"
+#include "portable_stl/algorithm/partition.h"
+#include "portable_stl/algorithm/partition_point.h"
+#include "portable_stl/algorithm/pop_heap.h"
+#include "portable_stl/algorithm/popcount.h"
+#include "portable_stl/algorithm/push_heap.h"
+#include "portable_stl/algorithm/radix_sort.h"
+#include "portable_stl/algorithm/remove_if.h"
+#include "portable_stl/algorithm/reverse.h"
 #include "portable_stl/algorithm/search.h"
+#include "portable_stl/algorithm/set_difference.h"
+#include "portable_stl/algorithm/set_intersection.h"
+#include "portable_stl/algorithm/set_symmetric_difference.h"
+#include "portable_stl/algorithm/set_union.h"
+#include "portable_stl/algorithm/shuffle.h"
+#include "portable_stl/algorithm/sort.h"
+#include "portable_stl/algorithm/sort_heap.h"
+#include "portable_stl/algorithm/stable_partition.h"
+#include "portable_stl/algorithm/stable_sort.h"
+#include "portable_stl/algorithm/unique.h"
+#include "portable_stl/algorithm/unique_copy.h"
+#include "portable_stl/algorithm/upper_bound.h"
+#include "portable_stl/functional/boyer_moore_horspool_searcher.h"
+#include "portable_stl/functional/boyer_moore_searcher.h"
+#include "portable_stl/functional/default_searcher.h"
+#include "portable_stl/string/string_view.h"
+#include "portable_stl/vector/vector.h"
 
 namespace test_algorithm_helper {
 /**
@@ -34,6 +83,25 @@ public:
     return value % 2 == 0;
   }
 };
+/**
+ * @brief Makes the test sequences for the sort algorithms: random, sorted, reversed, equal, organ pipe and few
+ * distinct values.
+ * @param len the length of the sequences.
+ * @return the sequences.
+ */
+static std::vector<std::vector<std::int32_t>> sort_patterns(std::int32_t len) {
+  std::mt19937                           randomness;
+  std::vector<std::vector<std::int32_t>> result(6);
+  for (std::int32_t i{0}; i < len; ++i) {
+    result[0].push_back(static_cast<std::int32_t>(randomness() % 100000U));
+    result[1].push_back(i);
+    result[2].push_back(len - i);
+    result[3].push_back(7);
+    result[4].push_back((i < len / 2) ? i : (len - i));
+    result[5].push_back(static_cast<std::int32_t>(randomness() % 4U));
+  }
+  return result;
+}
 } // namespace test_algorithm_helper
 
 TEST(algorithm, any_of) {
@@ -769,3 +837,1337 @@ TEST(algorithm, search_pred) {
   test_algorithm_helper::search_test_pred<test_iterator_helper::tst_random_access_iterator<std::int32_t const *>,
                                           test_iterator_helper::tst_random_access_iterator<std::int32_t const *>>();
 }
+
+TEST(algorithm, make_heap) {
+  static_cast<void>(test_info_);
+
+  {
+    std::int32_t   arr[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    unsigned const sa{sizeof(arr) / sizeof(arr[0])};
+
+    EXPECT_FALSE(::portable_stl::is_heap(arr, arr + sa));
+    ::portable_stl::make_heap(arr, arr + sa);
+    EXPECT_TRUE(::portable_stl::is_heap(arr, arr + sa));
+    EXPECT_EQ(9, arr[0]);
+  }
+
+  // custom compare
+  {
+    std::int32_t   arr[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    unsigned const sa{sizeof(arr) / sizeof(arr[0])};
+
+    auto comp = [](std::int32_t lhv, std::int32_t rhv) { return lhv > rhv; };
+    ::portable_stl::make_heap(arr, arr + sa, comp);
+    EXPECT_TRUE(::portable_stl::is_heap(arr, arr + sa, comp));
+    EXPECT_EQ(1, arr[0]);
+  }
+
+  // empty and single
+  {
+    std::int32_t   arr[] = {1};
+    ::portable_stl::make_heap(arr, arr);
+    ::portable_stl::make_heap(arr, arr + 1);
+    EXPECT_TRUE(::portable_stl::is_heap(arr, arr + 1));
+  }
+}
+
+TEST(algorithm, is_heap_until) {
+  static_cast<void>(test_info_);
+
+  std::int32_t   arr[] = {9, 5, 4, 1, 1, 3, 6};
+  unsigned const sa{sizeof(arr) / sizeof(arr[0])};
+
+  EXPECT_EQ(arr + 6, ::portable_stl::is_heap_until(arr, arr + sa));
+  EXPECT_EQ(arr, ::portable_stl::is_heap_until(arr, arr));
+}
+
+TEST(algorithm, push_pop_heap) {
+  static_cast<void>(test_info_);
+
+  std::int32_t arr[64]{};
+  std::int32_t len{0};
+  for (std::int32_t i{0}; i < 64; ++i) {
+    arr[len] = (i * 37) % 64;
+    ++len;
+    ::portable_stl::push_heap(arr, arr + len);
+    ASSERT_TRUE(::portable_stl::is_heap(arr, arr + len));
+  }
+
+  for (std::int32_t expected_value{63}; expected_value >= 0; --expected_value) {
+    EXPECT_EQ(expected_value, arr[0]);
+    ::portable_stl::pop_heap(arr, arr + len);
+    EXPECT_EQ(expected_value, arr[len - 1]);
+    --len;
+    ASSERT_TRUE(::portable_stl::is_heap(arr, arr + len));
+  }
+}
+
+TEST(algorithm, sort_heap) {
+  static_cast<void>(test_info_);
+
+  std::int32_t   arr[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+  unsigned const sa{sizeof(arr) / sizeof(arr[0])};
+
+  ::portable_stl::make_heap(arr, arr + sa);
+  ::portable_stl::sort_heap(arr, arr + sa);
+
+  std::int32_t const expected_values[] = {1, 1, 2, 3, 3, 4, 5, 5, 5, 6, 9};
+  for (unsigned i{0}; i < sa; ++i) {
+    EXPECT_EQ(expected_values[i], arr[i]);
+  }
+}
+
+TEST(algorithm, count) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const arr[] = {1, 2, 1, 3, 1};
+  EXPECT_EQ(3, ::portable_stl::count(arr, arr + 5, 1));
+  EXPECT_EQ(0, ::portable_stl::count(arr, arr + 5, 4));
+  EXPECT_EQ(0, ::portable_stl::count(arr, arr, 1));
+}
+
+TEST(algorithm, ctz_popcount) {
+  static_cast<void>(test_info_);
+
+  EXPECT_EQ(0, ::portable_stl::ctz(std::uint32_t{1}));
+  EXPECT_EQ(31, ::portable_stl::ctz(std::uint32_t{1} << 31U));
+  EXPECT_EQ(40, ::portable_stl::ctz(std::uint64_t{1} << 40U));
+  EXPECT_EQ(63, ::portable_stl::ctz(std::uint64_t{1} << 63U));
+  EXPECT_EQ(40, ::portable_stl::ctz(static_cast<::portable_stl::uint64_t>(std::uint64_t{1} << 40U)));
+
+  EXPECT_EQ(0, ::portable_stl::popcount(std::uint32_t{0}));
+  EXPECT_EQ(32, ::portable_stl::popcount(~std::uint32_t{0}));
+  EXPECT_EQ(64, ::portable_stl::popcount(~std::uint64_t{0}));
+  EXPECT_EQ(3, ::portable_stl::popcount(std::uint64_t{0x8000000100000001ULL}));
+  EXPECT_EQ(8, ::portable_stl::popcount(std::uint8_t{0xFFU}));
+}
+
+TEST(algorithm, merge) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const arr1[] = {1, 3, 3, 5, 7};
+  std::int32_t const arr2[] = {2, 3, 4, 8, 9, 10};
+  std::int32_t       dst[11]{};
+
+  std::int32_t const expected_values[] = {1, 2, 3, 3, 3, 4, 5, 7, 8, 9, 10};
+  EXPECT_EQ(dst + 11, ::portable_stl::merge(arr1, arr1 + 5, arr2, arr2 + 6, dst));
+  for (std::int32_t i{0}; i < 11; ++i) {
+    EXPECT_EQ(expected_values[i], dst[i]);
+  }
+
+  // input iterators
+  {
+    using t_iter = test_iterator_helper::tst_input_iterator<std::int32_t const *>;
+    std::int32_t dst2[11]{};
+    EXPECT_EQ(dst2 + 11, ::portable_stl::merge(t_iter(arr1), t_iter(arr1 + 5), t_iter(arr2), t_iter(arr2 + 6), dst2));
+    for (std::int32_t i{0}; i < 11; ++i) {
+      EXPECT_EQ(expected_values[i], dst2[i]);
+    }
+  }
+
+  // stability and skewed lengths, the key is value / 10
+  {
+    std::int32_t long_arr[200]{};
+    for (std::int32_t i{0}; i < 200; ++i) {
+      long_arr[i] = (i / 4) * 10 + 1;
+    }
+    std::int32_t const short_arr[] = {0, 52, 53, 492, 700};
+    std::int32_t       dst3[205]{};
+
+    auto comp = [](std::int32_t lhv, std::int32_t rhv) { return lhv / 10 < rhv / 10; };
+    EXPECT_EQ(dst3 + 205, ::portable_stl::merge(long_arr, long_arr + 200, short_arr, short_arr + 5, dst3, comp));
+    EXPECT_EQ(1, dst3[3]);
+    EXPECT_EQ(0, dst3[4]);
+    EXPECT_EQ(51, dst3[24]);
+    EXPECT_EQ(52, dst3[25]);
+    EXPECT_EQ(53, dst3[26]);
+    EXPECT_EQ(61, dst3[27]);
+    EXPECT_EQ(491, dst3[202]);
+    EXPECT_EQ(492, dst3[203]);
+    EXPECT_EQ(700, dst3[204]);
+  }
+}
+
+TEST(algorithm, inplace_merge) {
+  static_cast<void>(test_info_);
+
+  // first range is shorter, second range is shorter
+  for (std::int32_t middle{0}; middle <= 12; ++middle) {
+    std::int32_t arr[12]{};
+    for (std::int32_t i{0}; i < middle; ++i) {
+      arr[i] = i * 3;
+    }
+    for (std::int32_t i{middle}; i < 12; ++i) {
+      arr[i] = (i - middle) * 2;
+    }
+    ::portable_stl::inplace_merge(arr, arr + middle, arr + 12);
+    for (std::int32_t i{1}; i < 12; ++i) {
+      ASSERT_LE(arr[i - 1], arr[i]);
+    }
+  }
+
+  // stability with bidirectional iterators and a custom compare, the key is value / 10
+  {
+    std::int32_t arr[] = {11, 21, 22, 31, 41, 5, 12, 23, 24, 32, 60};
+    auto         comp  = [](std::int32_t lhv, std::int32_t rhv) { return lhv / 10 < rhv / 10; };
+
+    using t_iter = test_iterator_helper::tst_bidirectional_iterator<std::int32_t *>;
+    ::portable_stl::inplace_merge(t_iter(arr), t_iter(arr + 5), t_iter(arr + 11), comp);
+
+    std::int32_t const expected_values[] = {5, 11, 12, 21, 22, 23, 24, 31, 32, 41, 60};
+    for (std::int32_t i{0}; i < 11; ++i) {
+      EXPECT_EQ(expected_values[i], arr[i]);
+    }
+  }
+
+  // not trivially copyable, the rotation based merge used when the buffer can not be allocated
+  {
+    std::string arr[] = {"b", "d", "f", "h", "a", "c", "e", "g", "i"};
+    auto        comp  = ::portable_stl::less<>{};
+    ::portable_stl::algorithm_helper::merge_without_buffer(arr, arr + 4, arr + 9, 4, 5, comp);
+
+    std::string const expected_values[] = {"a", "b", "c", "d", "e", "f", "g", "h", "i"};
+    for (std::int32_t i{0}; i < 9; ++i) {
+      EXPECT_EQ(expected_values[i], arr[i]);
+    }
+
+    std::string arr2[] = {"b", "d", "f", "h", "a", "c", "e", "g", "i"};
+    ::portable_stl::inplace_merge(arr2, arr2 + 4, arr2 + 9);
+    for (std::int32_t i{0}; i < 9; ++i) {
+      EXPECT_EQ(expected_values[i], arr2[i]);
+    }
+  }
+}
+
+TEST(algorithm, inplace_merge_comp_throws) {
+  static_cast<void>(test_info_);
+
+  // the strings do not fit the small string buffer, so the lost and leaked elements are reported by the sanitizers
+  auto const make_value = [](std::int32_t key) {
+    std::string const digits{std::to_string(1000 + key)};
+    return std::string(32U, 'x') + digits;
+  };
+
+  // the first range is shorter, skewed, of the same length, the second range is shorter and skewed
+  for (std::int32_t middle : {4, 20, 32, 44, 60}) {
+    std::vector<std::string> source;
+    for (std::int32_t i{0}; i < middle; ++i) {
+      source.push_back(make_value(i * 2 + 1));
+    }
+    for (std::int32_t i{middle}; i < 64; ++i) {
+      source.push_back(make_value((i - middle) * 2));
+    }
+
+    for (std::int32_t throw_after : {0, 1, 5, 20, 40, 1000}) {
+      std::int32_t calls{0};
+      auto const   comp = [&calls, throw_after](std::string const &lhv, std::string const &rhv) {
+        if (calls++ == throw_after) {
+          throw std::int32_t{0};
+        }
+        return lhv < rhv;
+      };
+
+      std::vector<std::string> values(source);
+      try {
+        ::portable_stl::inplace_merge(values.data(), values.data() + middle, values.data() + values.size(), comp);
+        ASSERT_LT(calls, throw_after);
+        ASSERT_TRUE(std::is_sorted(values.begin(), values.end()));
+      } catch (std::int32_t) {
+      }
+      ASSERT_TRUE(std::is_permutation(source.begin(), source.end(), values.begin()));
+
+      calls  = 0;
+      values = source;
+      using t_iter = test_iterator_helper::tst_bidirectional_iterator<std::string *>;
+      try {
+        ::portable_stl::inplace_merge(
+          t_iter(values.data()), t_iter(values.data() + middle), t_iter(values.data() + values.size()), comp);
+        ASSERT_LT(calls, throw_after);
+        ASSERT_TRUE(std::is_sorted(values.begin(), values.end()));
+      } catch (std::int32_t) {
+      }
+      ASSERT_TRUE(std::is_permutation(source.begin(), source.end(), values.begin()));
+    }
+  }
+}
+
+TEST(algorithm, set_operations) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const arr1[] = {1, 2, 2, 4, 6, 6, 6, 9};
+  std::int32_t const arr2[] = {2, 3, 6, 6, 10};
+  std::int32_t       dst[16]{};
+
+  {
+    std::int32_t const expected_values[] = {1, 2, 2, 3, 4, 6, 6, 6, 9, 10};
+    EXPECT_EQ(dst + 10, ::portable_stl::set_union(arr1, arr1 + 8, arr2, arr2 + 5, dst));
+    for (std::int32_t i{0}; i < 10; ++i) {
+      EXPECT_EQ(expected_values[i], dst[i]);
+    }
+  }
+  {
+    std::int32_t const expected_values[] = {2, 6, 6};
+    EXPECT_EQ(dst + 3, ::portable_stl::set_intersection(arr1, arr1 + 8, arr2, arr2 + 5, dst));
+    for (std::int32_t i{0}; i < 3; ++i) {
+      EXPECT_EQ(expected_values[i], dst[i]);
+    }
+  }
+  {
+    std::int32_t const expected_values[] = {1, 2, 4, 6, 9};
+    EXPECT_EQ(dst + 5, ::portable_stl::set_difference(arr1, arr1 + 8, arr2, arr2 + 5, dst));
+    for (std::int32_t i{0}; i < 5; ++i) {
+      EXPECT_EQ(expected_values[i], dst[i]);
+    }
+  }
+  {
+    std::int32_t const expected_values[] = {1, 2, 3, 4, 6, 9, 10};
+    EXPECT_EQ(dst + 7, ::portable_stl::set_symmetric_difference(arr1, arr1 + 8, arr2, arr2 + 5, dst));
+    for (std::int32_t i{0}; i < 7; ++i) {
+      EXPECT_EQ(expected_values[i], dst[i]);
+    }
+  }
+
+  // input iterators
+  {
+    using t_iter = test_iterator_helper::tst_input_iterator<std::int32_t const *>;
+    EXPECT_EQ(dst + 10, ::portable_stl::set_union(t_iter(arr1), t_iter(arr1 + 8), t_iter(arr2), t_iter(arr2 + 5), dst));
+    EXPECT_EQ(dst + 3,
+              ::portable_stl::set_intersection(t_iter(arr1), t_iter(arr1 + 8), t_iter(arr2), t_iter(arr2 + 5), dst));
+    EXPECT_EQ(dst + 5,
+              ::portable_stl::set_difference(t_iter(arr1), t_iter(arr1 + 8), t_iter(arr2), t_iter(arr2 + 5), dst));
+    EXPECT_EQ(
+      dst + 7,
+      ::portable_stl::set_symmetric_difference(t_iter(arr1), t_iter(arr1 + 8), t_iter(arr2), t_iter(arr2 + 5), dst));
+  }
+}
+
+TEST(algorithm, set_operations_skewed) {
+  static_cast<void>(test_info_);
+
+  // posting lists: a short list against a long one, the long one is searched by galloping
+  std::int32_t long_list[1000]{};
+  for (std::int32_t i{0}; i < 1000; ++i) {
+    long_list[i] = i * 2;
+  }
+  std::int32_t const short_list[] = {-1, 0, 7, 8, 500, 1001, 1998, 2500};
+  std::int32_t       dst[1010]{};
+
+  std::int32_t comparisons{0};
+  auto         comp = [&comparisons](std::int32_t lhv, std::int32_t rhv) {
+    ++comparisons;
+    return lhv < rhv;
+  };
+
+  {
+    std::int32_t const expected_values[] = {0, 8, 500, 1998};
+    EXPECT_EQ(dst + 4,
+              ::portable_stl::set_intersection(short_list, short_list + 8, long_list, long_list + 1000, dst, comp));
+    for (std::int32_t i{0}; i < 4; ++i) {
+      EXPECT_EQ(expected_values[i], dst[i]);
+    }
+    EXPECT_GT(200, comparisons);
+
+    comparisons = 0;
+    EXPECT_EQ(dst + 4,
+              ::portable_stl::set_intersection(long_list, long_list + 1000, short_list, short_list + 8, dst, comp));
+    EXPECT_EQ(1998, dst[3]);
+    EXPECT_GT(200, comparisons);
+  }
+
+  {
+    EXPECT_EQ(dst + 4, ::portable_stl::set_difference(short_list, short_list + 8, long_list, long_list + 1000, dst));
+    EXPECT_EQ(-1, dst[0]);
+    EXPECT_EQ(7, dst[1]);
+    EXPECT_EQ(1001, dst[2]);
+    EXPECT_EQ(2500, dst[3]);
+
+    EXPECT_EQ(dst + 996, ::portable_stl::set_difference(long_list, long_list + 1000, short_list, short_list + 8, dst));
+    EXPECT_EQ(2, dst[0]);
+    EXPECT_EQ(1996, dst[995]);
+  }
+
+  {
+    EXPECT_EQ(dst + 1004, ::portable_stl::set_union(short_list, short_list + 8, long_list, long_list + 1000, dst));
+    for (std::int32_t i{1}; i < 1004; ++i) {
+      ASSERT_LT(dst[i - 1], dst[i]);
+    }
+    EXPECT_EQ(-1, dst[0]);
+    EXPECT_EQ(2500, dst[1003]);
+
+    EXPECT_EQ(dst + 1000,
+              ::portable_stl::set_symmetric_difference(short_list, short_list + 8, long_list, long_list + 1000, dst));
+    for (std::int32_t i{1}; i < 1000; ++i) {
+      ASSERT_LT(dst[i - 1], dst[i]);
+    }
+  }
+
+  {
+    comparisons = 0;
+    std::int32_t const sub_list[] = {0, 8, 500, 1998};
+    EXPECT_TRUE(::portable_stl::includes(long_list, long_list + 1000, sub_list, sub_list + 4, comp));
+    EXPECT_GT(200, comparisons);
+    EXPECT_FALSE(::portable_stl::includes(long_list, long_list + 1000, short_list, short_list + 8));
+    EXPECT_TRUE(::portable_stl::includes(long_list, long_list + 1000, sub_list, sub_list));
+    EXPECT_FALSE(::portable_stl::includes(sub_list, sub_list + 4, long_list, long_list + 1000));
+  }
+}
+
+TEST(algorithm, sort) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t len : {0, 1, 2, 23, 24, 100, 129, 1000, 20000}) {
+    for (auto const &pattern : test_algorithm_helper::sort_patterns(len)) {
+      std::vector<std::int32_t> expected_values(pattern);
+      std::sort(expected_values.begin(), expected_values.end());
+
+      // raw pointers, the branchless partition
+      std::vector<std::int32_t> values(pattern);
+      ::portable_stl::sort(values.data(), values.data() + values.size());
+      ASSERT_EQ(expected_values, values);
+
+      // vector iterators and a custom compare, descending order
+      ::portable_stl::vector<std::int32_t> vec;
+      for (std::int32_t value : pattern) {
+        ASSERT_TRUE(vec.push_back(value));
+      }
+      ::portable_stl::sort(vec.begin(), vec.end(), [](std::int32_t lhv, std::int32_t rhv) { return lhv > rhv; });
+      for (::portable_stl::size_t i{0}; i < vec.size(); ++i) {
+        ASSERT_EQ(expected_values[expected_values.size() - 1 - i], vec[i]);
+      }
+    }
+  }
+
+  // not trivially copyable
+  {
+    std::string arr[] = {"k", "b", "a", "z", "c", "b", "m", "q", "a", "y", "d", "x", "e", "f", "w", "g",
+                         "v", "h", "u", "i", "t", "j", "s", "l", "r", "n", "p", "o", "b", "a", "zz", "aa"};
+    std::vector<std::string> expected_values(arr, arr + 32);
+    std::sort(expected_values.begin(), expected_values.end());
+    ::portable_stl::sort(arr, arr + 32);
+    for (std::int32_t i{0}; i < 32; ++i) {
+      EXPECT_EQ(expected_values[static_cast<std::size_t>(i)], arr[i]);
+    }
+  }
+}
+
+TEST(algorithm, stable_sort) {
+  static_cast<void>(test_info_);
+
+  // the key is value / 10, the original order is kept in value % 10
+  auto comp = [](std::int32_t lhv, std::int32_t rhv) { return lhv / 10 < rhv / 10; };
+
+  for (std::int32_t len : {0, 1, 2, 32, 33, 100, 1000, 5000}) {
+    for (auto const &pattern : test_algorithm_helper::sort_patterns(len)) {
+      std::vector<std::int32_t> values;
+      for (std::int32_t value : pattern) {
+        values.push_back((value % 1000) * 10);
+      }
+      // mark the equal keys by their order of appearance
+      for (std::size_t i{0}; i < values.size(); ++i) {
+        values[i] += static_cast<std::int32_t>(i % 10U);
+      }
+      std::vector<std::int32_t> expected_values(values);
+      std::stable_sort(expected_values.begin(), expected_values.end(), comp);
+
+      std::vector<std::int32_t> sorted(values);
+      ::portable_stl::stable_sort(sorted.data(), sorted.data() + sorted.size(), comp);
+      ASSERT_EQ(expected_values, sorted);
+
+      // the merge by rotations used when the buffer can not be allocated
+      std::vector<std::int32_t> sorted_in_place(values);
+      ::portable_stl::algorithm_helper::stable_sort_impl(
+        sorted_in_place.data(), sorted_in_place.data() + sorted_in_place.size(), comp, nullptr);
+      ASSERT_EQ(expected_values, sorted_in_place);
+    }
+  }
+
+  // vector iterators, not trivially copyable
+  {
+    ::portable_stl::vector<std::string> vec;
+    for (std::int32_t i{0}; i < 100; ++i) {
+      ASSERT_TRUE(vec.push_back(std::string(1, static_cast<char>('a' + (i * 7) % 5)) + std::to_string(i)));
+    }
+    ::portable_stl::stable_sort(
+      vec.begin(), vec.end(), [](std::string const &lhv, std::string const &rhv) { return lhv[0] < rhv[0]; });
+    for (::portable_stl::size_t i{1}; i < vec.size(); ++i) {
+      ASSERT_LE(vec[i - 1][0], vec[i][0]);
+      if (vec[i - 1][0] == vec[i][0]) {
+        ASSERT_LT(std::stoi(vec[i - 1].substr(1)), std::stoi(vec[i].substr(1)));
+      }
+    }
+  }
+}
+
+TEST(algorithm, stable_sort_comp_throws) {
+  static_cast<void>(test_info_);
+
+  // the strings do not fit the small string buffer, so the lost and leaked elements are reported by the sanitizers
+  std::vector<std::string> source;
+  for (std::int32_t i{0}; i < 200; ++i) {
+    source.push_back(std::string(32U, 'x') + std::to_string(1000 + (i * 7919) % 200));
+  }
+
+  // the insertion sort of the first runs, the merges with the buffer and the merges of the sorted runs
+  for (std::int32_t throw_after : {0, 1, 10, 100, 400, 700, 1000, 1500, 1800, 2000, 100000}) {
+    std::int32_t calls{0};
+    auto const   comp = [&calls, throw_after](std::string const &lhv, std::string const &rhv) {
+      if (calls++ == throw_after) {
+        throw std::int32_t{0};
+      }
+      return lhv < rhv;
+    };
+
+    std::vector<std::string> values(source);
+    try {
+      ::portable_stl::stable_sort(values.data(), values.data() + values.size(), comp);
+      ASSERT_LT(calls, throw_after);
+      ASSERT_TRUE(std::is_sorted(values.begin(), values.end()));
+    } catch (std::int32_t) {
+    }
+    ASSERT_TRUE(std::is_permutation(source.begin(), source.end(), values.begin()));
+  }
+}
+
+TEST(algorithm, nth_element) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t len : {1, 2, 23, 24, 100, 1000, 20000}) {
+    for (auto const &pattern : test_algorithm_helper::sort_patterns(len)) {
+      std::vector<std::int32_t> expected_values(pattern);
+      std::sort(expected_values.begin(), expected_values.end());
+
+      for (std::int32_t nth : {0, len / 3, len - 1}) {
+        std::vector<std::int32_t> values(pattern);
+        std::int32_t *const       nth_iter{values.data() + nth};
+        ::portable_stl::nth_element(values.data(), nth_iter, values.data() + values.size());
+        ASSERT_EQ(expected_values[static_cast<std::size_t>(nth)], *nth_iter);
+        for (std::int32_t i{0}; i < nth; ++i) {
+          ASSERT_LE(values[static_cast<std::size_t>(i)], *nth_iter);
+        }
+        for (std::int32_t i{nth + 1}; i < len; ++i) {
+          ASSERT_GE(values[static_cast<std::size_t>(i)], *nth_iter);
+        }
+      }
+    }
+  }
+
+  // the heap selection used when the partitions are bad
+  {
+    std::int32_t arr[] = {5, 9, 1, 7, 3, 8, 2, 6, 4, 0};
+    auto         comp  = ::portable_stl::less<>{};
+    ::portable_stl::algorithm_helper::heap_select(arr, arr + 3, arr + 10, comp);
+    EXPECT_EQ(3, arr[3]);
+    for (std::int32_t i{0}; i < 3; ++i) {
+      EXPECT_GT(3, arr[i]);
+    }
+    for (std::int32_t i{4}; i < 10; ++i) {
+      EXPECT_LT(3, arr[i]);
+    }
+  }
+}
+
+TEST(algorithm, partial_sort) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t len : {1, 2, 30, 1000, 10000}) {
+    for (auto const &pattern : test_algorithm_helper::sort_patterns(len)) {
+      std::vector<std::int32_t> expected_values(pattern);
+      std::sort(expected_values.begin(), expected_values.end());
+
+      for (std::int32_t middle : {0, 1, len / 10, len}) {
+        ::portable_stl::vector<std::int32_t> vec;
+        for (std::int32_t value : pattern) {
+          ASSERT_TRUE(vec.push_back(value));
+        }
+        ::portable_stl::partial_sort(vec.begin(), vec.begin() + middle, vec.end());
+        for (std::int32_t i{0}; i < middle; ++i) {
+          ASSERT_EQ(expected_values[static_cast<std::size_t>(i)], vec[static_cast<::portable_stl::size_t>(i)]);
+        }
+        if (middle > 0) {
+          std::int32_t const last_sorted{vec[static_cast<::portable_stl::size_t>(middle - 1)]};
+          for (std::int32_t i{middle}; i < len; ++i) {
+            ASSERT_GE(vec[static_cast<::portable_stl::size_t>(i)], last_sorted);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(algorithm, radix_sort) {
+  static_cast<void>(test_info_);
+
+  std::mt19937 randomness;
+
+  // unsigned and signed integers
+  for (std::int32_t len : {0, 1, 2, 1000}) {
+    std::vector<std::uint32_t> values;
+    std::vector<std::int64_t>  signed_values;
+    for (std::int32_t i{0}; i < len; ++i) {
+      values.push_back(randomness());
+      signed_values.push_back(static_cast<std::int64_t>(randomness()) * ((0 == i % 3) ? -1000 : 1000) + i);
+    }
+    std::vector<std::uint32_t> expected_values(values);
+    std::sort(expected_values.begin(), expected_values.end());
+    ASSERT_TRUE(::portable_stl::radix_sort(values.data(), values.data() + values.size()));
+    ASSERT_EQ(expected_values, values);
+
+    std::vector<std::int64_t> expected_signed_values(signed_values);
+    std::sort(expected_signed_values.begin(), expected_signed_values.end());
+    ASSERT_TRUE(::portable_stl::radix_sort(signed_values.data(), signed_values.data() + signed_values.size()));
+    ASSERT_EQ(expected_signed_values, signed_values);
+  }
+
+  // floating point
+  {
+    ::portable_stl::vector<double> vec;
+    for (std::int32_t i{0}; i < 500; ++i) {
+      ASSERT_TRUE(vec.push_back((static_cast<double>(randomness() % 20001U) - 10000.0) / 7.0));
+    }
+    ASSERT_TRUE(vec.push_back(-1e300));
+    ASSERT_TRUE(vec.push_back(1e300));
+    ASSERT_TRUE(::portable_stl::radix_sort(vec.begin(), vec.end()));
+    for (::portable_stl::size_t i{1}; i < vec.size(); ++i) {
+      ASSERT_LE(vec[i - 1], vec[i]);
+    }
+    EXPECT_EQ(-1e300, vec[0]);
+    EXPECT_EQ(1e300, vec[vec.size() - 1]);
+  }
+
+  // records by the key projection, the sort is stable
+  {
+    std::vector<std::int32_t> records;
+    for (std::int32_t i{0}; i < 1000; ++i) {
+      records.push_back(static_cast<std::int32_t>(randomness() % 50U) * 10000 + i);
+    }
+    auto proj = [](std::int32_t record) { return static_cast<std::uint16_t>(record / 10000); };
+    ASSERT_TRUE(::portable_stl::radix_sort(records.data(), records.data() + records.size(), proj));
+    for (std::size_t i{1}; i < records.size(); ++i) {
+      ASSERT_LE(records[i - 1], records[i]);
+    }
+  }
+
+  // scratch buffer from the allocator, no buffer is needed if all keys are equal
+  {
+    test_allocator_helper::test_allocator_statistics   stat;
+    test_allocator_helper::test_allocator<std::int32_t> alloc(&stat);
+    stat.m_throw_after = 0;
+
+    std::int32_t arr[] = {3, 1, 2};
+    auto         proj  = [](std::int32_t value) { return value; };
+    auto         result = ::portable_stl::radix_sort(arr, arr + 3, proj, alloc);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+    EXPECT_EQ(3, arr[0]);
+
+    std::int32_t equal_arr[] = {5, 5, 5};
+    EXPECT_TRUE(::portable_stl::radix_sort(equal_arr, equal_arr + 3, proj, alloc));
+
+    stat.m_throw_after = ::portable_stl::numeric_limits_helper::int_max_constant;
+    EXPECT_TRUE(::portable_stl::radix_sort(arr, arr + 3, proj, alloc));
+    EXPECT_EQ(1, arr[0]);
+    EXPECT_EQ(3, arr[2]);
+    EXPECT_EQ(0U, stat.m_alloc_count);
+  }
+
+  // strings, MSD sort
+  {
+    std::vector<std::string> values;
+    for (std::int32_t i{0}; i < 2000; ++i) {
+      std::string value("common_prefix/");
+      for (auto j = randomness() % 6U; j > 0U; --j) {
+        value.push_back(static_cast<char>('a' + randomness() % 4U));
+      }
+      values.push_back(value);
+    }
+    std::vector<std::string> const unsorted_values(values);
+    std::vector<std::string>       expected_values(values);
+    std::sort(expected_values.begin(), expected_values.end());
+    ASSERT_TRUE(::portable_stl::radix_sort(values.data(), values.data() + values.size()));
+    ASSERT_EQ(expected_values, values);
+
+    // string views
+    std::vector<::portable_stl::string_view> views;
+    for (auto const &value : unsorted_values) {
+      views.push_back(::portable_stl::string_view(value.data(), value.size()));
+    }
+    ASSERT_TRUE(::portable_stl::radix_sort(views.data(), views.data() + views.size()));
+    for (std::size_t i{0}; i < views.size(); ++i) {
+      ASSERT_EQ(expected_values[i], std::string(views[i].data(), views[i].size()));
+    }
+
+    // wide code units are split into bytes
+    std::vector<std::u16string> wide_values;
+    for (std::int32_t i{0}; i < 300; ++i) {
+      wide_values.push_back(
+        std::u16string(1U + randomness() % 3U, static_cast<char16_t>(0x00F0U + (randomness() % 4U) * 0x0100U)));
+    }
+    std::vector<std::u16string> expected_wide_values(wide_values);
+    std::sort(expected_wide_values.begin(), expected_wide_values.end());
+    ASSERT_TRUE(::portable_stl::radix_sort(wide_values.data(), wide_values.data() + wide_values.size()));
+    ASSERT_EQ(expected_wide_values, wide_values);
+
+    // the bytes >= 0x80 go after ASCII in both the radix passes and the insertion sort of the small buckets
+    for (std::size_t count : {std::size_t{8}, std::size_t{500}}) {
+      std::vector<std::string> high_values;
+      for (std::size_t i{0}; i < count; ++i) {
+        high_values.push_back(
+          std::string(1U + randomness() % 3U, static_cast<char>(0x70U + (randomness() % 4U) * 0x10U)));
+      }
+      std::vector<std::string> const unsorted_high_values(high_values);
+      std::vector<std::string>       expected_high_values(high_values);
+      std::sort(expected_high_values.begin(), expected_high_values.end());
+      ASSERT_TRUE(::portable_stl::radix_sort(high_values.data(), high_values.data() + high_values.size()));
+      ASSERT_EQ(expected_high_values, high_values);
+
+      std::vector<::portable_stl::string_view> high_views;
+      for (auto const &value : unsorted_high_values) {
+        high_views.push_back(::portable_stl::string_view(value.data(), value.size()));
+      }
+      ASSERT_TRUE(::portable_stl::radix_sort(high_views.data(), high_views.data() + high_views.size()));
+      for (std::size_t i{1}; i < high_views.size(); ++i) {
+        ASSERT_FALSE(high_views[i] < high_views[i - 1U]);
+      }
+    }
+  }
+}
+
+namespace test_algorithm_helper {
+/**
+ * @brief Checks lower_bound, upper_bound, binary_search and equal_range over the iterators of type t_iterator
+ * against the std algorithms.
+ * @tparam t_iterator the type of iterator.
+ */
+template<class t_iterator> void bound_test() {
+  std::int32_t const values[]{1, 1, 2, 4, 4, 4, 7, 9};
+  std::int32_t const count{8};
+
+  for (std::int32_t length{0}; length <= count; ++length) {
+    t_iterator const first(values);
+    t_iterator const last(values + length);
+    for (std::int32_t value{0}; value <= 10; ++value) {
+      std::int32_t const *expected_lower{std::lower_bound(values, values + length, value)};
+      std::int32_t const *expected_upper{std::upper_bound(values, values + length, value)};
+
+      ASSERT_EQ(expected_lower, ::portable_stl::lower_bound(first, last, value).base());
+      ASSERT_EQ(expected_upper, ::portable_stl::upper_bound(first, last, value).base());
+      ASSERT_EQ(expected_lower != expected_upper, ::portable_stl::binary_search(first, last, value));
+
+      auto const range = ::portable_stl::equal_range(first, last, value);
+      ASSERT_EQ(expected_lower, ::portable_stl::get<0>(range).base());
+      ASSERT_EQ(expected_upper, ::portable_stl::get<1>(range).base());
+    }
+  }
+}
+} // namespace test_algorithm_helper
+
+TEST(algorithm, lower_upper_bound) {
+  static_cast<void>(test_info_);
+
+  test_algorithm_helper::bound_test<test_iterator_helper::tst_forward_iterator<std::int32_t const *>>();
+  test_algorithm_helper::bound_test<test_iterator_helper::tst_bidirectional_iterator<std::int32_t const *>>();
+  test_algorithm_helper::bound_test<test_iterator_helper::tst_random_access_iterator<std::int32_t const *>>();
+
+  // contiguous ranges of every length, the lengths around powers of 2 exercise the last probe
+  std::mt19937 randomness(7U);
+  for (std::int32_t length : {0, 1, 2, 3, 15, 16, 17, 1000, 4096, 10007}) {
+    ::portable_stl::vector<std::int32_t> values;
+    for (std::int32_t i{0}; i < length; ++i) {
+      ASSERT_TRUE(values.push_back(static_cast<std::int32_t>(randomness() % 512U)));
+    }
+    std::int32_t *const first{values.data()};
+    std::int32_t *const last{values.data() + values.size()};
+    std::sort(first, last);
+    for (std::int32_t value{-1}; value <= 512; ++value) {
+      ASSERT_EQ(std::lower_bound(first, last, value) - first,
+                ::portable_stl::lower_bound(values.begin(), values.end(), value) - values.begin());
+      ASSERT_EQ(std::upper_bound(first, last, value) - first,
+                ::portable_stl::upper_bound(values.begin(), values.end(), value) - values.begin());
+    }
+  }
+
+  // custom comparison, descending order
+  std::int32_t const descending[]{9, 7, 4, 4, 2, 1};
+  auto const         greater = [](std::int32_t left, std::int32_t right) { return left > right; };
+  EXPECT_EQ(descending + 2, ::portable_stl::lower_bound(descending, descending + 6, 4, greater));
+  EXPECT_EQ(descending + 4, ::portable_stl::upper_bound(descending, descending + 6, 4, greater));
+  EXPECT_TRUE(::portable_stl::binary_search(descending, descending + 6, 7, greater));
+  EXPECT_FALSE(::portable_stl::binary_search(descending, descending + 6, 8, greater));
+  EXPECT_EQ(descending + 6, ::portable_stl::lower_bound(descending, descending + 6, 0, greater));
+}
+
+namespace test_algorithm_helper {
+/**
+ * @brief Compares the vectorized scans of the contiguous ranges of every length up to 200 with std.
+ * @tparam t_type the type of the elements.
+ * @param randomness the random generator.
+ * @param narrow the elements take few values.
+ */
+template<class t_type> void simd_scan_test(std::mt19937 &randomness, bool narrow) {
+  for (std::size_t length{0}; length <= 200U; ++length) {
+    ::portable_stl::vector<t_type> values;
+    for (std::size_t i{0}; i < length; ++i) {
+      std::uint64_t const random_bits{(static_cast<std::uint64_t>(randomness()) << 32U) | randomness()};
+      ASSERT_TRUE(values.push_back(narrow ? static_cast<t_type>(random_bits % 8U) : static_cast<t_type>(random_bits)));
+    }
+    t_type const *const first{values.data()};
+    t_type const *const last{values.data() + values.size()};
+
+    for (std::int32_t value{-1}; value <= 8; ++value) {
+      t_type const needle{static_cast<t_type>(value)};
+      ASSERT_EQ(std::find(first, last, needle) - first,
+                ::portable_stl::find(values.begin(), values.end(), needle) - values.begin());
+      ASSERT_EQ(std::count(first, last, needle), ::portable_stl::count(values.begin(), values.end(), needle));
+    }
+    if (length > 0U) {
+      t_type const needle{values[length - 1U]};
+      ASSERT_EQ(std::find(first, last, needle) - first,
+                ::portable_stl::find(values.begin(), values.end(), needle) - values.begin());
+      ASSERT_EQ(std::count(first, last, needle), ::portable_stl::count(values.begin(), values.end(), needle));
+    }
+
+    ASSERT_EQ(std::min_element(first, last) - first,
+              ::portable_stl::min_element(values.begin(), values.end()) - values.begin());
+    ASSERT_EQ(std::max_element(first, last) - first,
+              ::portable_stl::max_element(values.begin(), values.end()) - values.begin());
+    auto const expected_minmax = std::minmax_element(first, last);
+    auto const minmax          = ::portable_stl::minmax_element(values.begin(), values.end());
+    ASSERT_EQ(expected_minmax.first - first, ::portable_stl::get<0>(minmax) - values.begin());
+    ASSERT_EQ(expected_minmax.second - first, ::portable_stl::get<1>(minmax) - values.begin());
+
+    // the copy differs at one position
+    ::portable_stl::vector<t_type> other(values);
+    ASSERT_EQ(length, ::portable_stl::get<0>(::portable_stl::mismatch(values.begin(), values.end(), other.begin()))
+                        - values.begin());
+    if (length > 0U) {
+      std::size_t const position{randomness() % length};
+      other[position] = static_cast<t_type>((static_cast<t_type>(1) == other[position]) ? 2 : 1);
+      auto const result = ::portable_stl::mismatch(values.begin(), values.end(), other.begin(), other.end());
+      ASSERT_EQ(position, ::portable_stl::get<0>(result) - values.begin());
+      ASSERT_EQ(position, ::portable_stl::get<1>(result) - other.begin());
+    }
+  }
+}
+} // namespace test_algorithm_helper
+
+TEST(algorithm, simd_scan) {
+  static_cast<void>(test_info_);
+
+  std::mt19937 randomness(11U);
+  for (bool narrow : {true, false}) {
+    test_algorithm_helper::simd_scan_test<std::int8_t>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<std::uint8_t>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<std::int16_t>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<std::uint16_t>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<std::int32_t>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<std::uint32_t>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<std::int64_t>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<std::uint64_t>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<float>(randomness, narrow);
+    test_algorithm_helper::simd_scan_test<double>(randomness, narrow);
+  }
+
+  // the value of the other type
+  std::uint8_t const bytes[]{1, 200, 44, 200, 255, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 255};
+  EXPECT_EQ(bytes + 19, ::portable_stl::find(bytes, bytes + 19, 456));
+  EXPECT_EQ(bytes + 1, ::portable_stl::find(bytes, bytes + 19, 200LL));
+  EXPECT_EQ(2, ::portable_stl::count(bytes, bytes + 19, 255U));
+  EXPECT_EQ(0, ::portable_stl::count(bytes, bytes + 19, 511));
+
+  std::vector<float> floats(40, 1.5F);
+  floats[33] = 3.0F;
+  floats[35] = -0.0F;
+  floats[37] = std::numeric_limits<float>::quiet_NaN();
+  EXPECT_EQ(33, ::portable_stl::find(floats.begin(), floats.end(), 3) - floats.begin());
+  EXPECT_EQ(35, ::portable_stl::find(floats.begin(), floats.end(), 0.0) - floats.begin());
+  EXPECT_EQ(40, ::portable_stl::find(floats.begin(), floats.end(), 1.25) - floats.begin());
+  EXPECT_EQ(0, ::portable_stl::count(floats.begin(), floats.end(), std::numeric_limits<float>::quiet_NaN()));
+  EXPECT_EQ(37, ::portable_stl::get<0>(::portable_stl::mismatch(floats.begin(), floats.end(), floats.begin()))
+                  - floats.begin());
+
+  // not contiguous iterators and the predicates use the scalar loops
+  std::int32_t const numbers[]{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+  using iterator = test_iterator_helper::tst_forward_iterator<std::int32_t const *>;
+  EXPECT_EQ(numbers + 4, ::portable_stl::find(iterator(numbers), iterator(numbers + 11), 5).base());
+  EXPECT_EQ(3, ::portable_stl::count(iterator(numbers), iterator(numbers + 11), 5));
+  EXPECT_EQ(numbers + 1, ::portable_stl::min_element(iterator(numbers), iterator(numbers + 11)).base());
+  EXPECT_EQ(numbers + 5, ::portable_stl::max_element(iterator(numbers), iterator(numbers + 11)).base());
+  auto const minmax = ::portable_stl::minmax_element(iterator(numbers), iterator(numbers + 11));
+  EXPECT_EQ(numbers + 1, ::portable_stl::get<0>(minmax).base());
+  EXPECT_EQ(numbers + 5, ::portable_stl::get<1>(minmax).base());
+
+  auto const greater = [](std::int32_t left, std::int32_t right) { return left > right; };
+  EXPECT_EQ(numbers + 5, ::portable_stl::min_element(numbers, numbers + 11, greater));
+  EXPECT_EQ(numbers + 1, ::portable_stl::max_element(numbers, numbers + 11, greater));
+
+  std::int32_t const prefix[]{3, 1, 4, 2};
+  auto const         result = ::portable_stl::mismatch(iterator(numbers), iterator(numbers + 11), iterator(prefix));
+  EXPECT_EQ(numbers + 3, ::portable_stl::get<0>(result).base());
+  EXPECT_EQ(prefix + 3, ::portable_stl::get<1>(result).base());
+  auto const shorter = ::portable_stl::mismatch(numbers, numbers + 11, prefix, prefix + 3);
+  EXPECT_EQ(numbers + 3, ::portable_stl::get<0>(shorter));
+  auto const same_parity = ::portable_stl::mismatch(
+    numbers, numbers + 11, prefix, prefix + 4, [](std::int32_t left, std::int32_t right) {
+      return (left % 2) == (right % 2);
+    });
+  EXPECT_EQ(numbers + 3, ::portable_stl::get<0>(same_parity));
+}
+
+namespace test_algorithm_helper {
+/**
+ * @brief Compares the searchers with std::search on the random texts over the small alphabet.
+ * @tparam t_type the type of the elements.
+ * @param randomness the random generator.
+ * @param alphabet the number of the distinct elements.
+ */
+template<class t_type> void searcher_test(std::mt19937 &randomness, std::uint32_t alphabet) {
+  for (std::size_t pattern_length : {1U, 2U, 3U, 5U, 8U, 17U}) {
+    for (std::size_t round{0}; round < 20U; ++round) {
+      std::vector<t_type> text(300U);
+      for (auto &element : text) {
+        element = static_cast<t_type>(0x100U + randomness() % alphabet);
+      }
+      // the pattern is taken from the text or is random
+      std::vector<t_type> pattern(pattern_length);
+      std::size_t const   offset{randomness() % (text.size() - pattern_length)};
+      for (std::size_t i{0}; i < pattern_length; ++i) {
+        pattern[i] = (0U == round % 2U) ? text[offset + i] : static_cast<t_type>(0x100U + randomness() % alphabet);
+      }
+
+      t_type const *const first{text.data()};
+      t_type const *const last{text.data() + text.size()};
+      auto const expected_pos = std::search(first, last, pattern.data(), pattern.data() + pattern_length) - first;
+
+      ::portable_stl::boyer_moore_searcher<t_type *> const bm(pattern.data(), pattern.data() + pattern_length);
+      auto const                                           bm_result = bm(first, last);
+      ASSERT_EQ(expected_pos, ::portable_stl::get<0>(bm_result) - first);
+      if (expected_pos != static_cast<std::ptrdiff_t>(text.size())) {
+        ASSERT_EQ(pattern_length, ::portable_stl::get<1>(bm_result) - ::portable_stl::get<0>(bm_result));
+      }
+
+      ::portable_stl::boyer_moore_horspool_searcher<t_type *> const bmh(pattern.data(),
+                                                                        pattern.data() + pattern_length);
+      ASSERT_EQ(expected_pos, ::portable_stl::search(first, last, bmh) - first);
+
+      ::portable_stl::default_searcher<t_type *> const searcher(pattern.data(), pattern.data() + pattern_length);
+      ASSERT_EQ(expected_pos, ::portable_stl::search(first, last, searcher) - first);
+    }
+  }
+}
+} // namespace test_algorithm_helper
+
+TEST(algorithm, searchers) {
+  static_cast<void>(test_info_);
+
+  std::mt19937 randomness(13U);
+  for (std::uint32_t alphabet : {2U, 4U, 200U}) {
+    test_algorithm_helper::searcher_test<char>(randomness, alphabet);
+    test_algorithm_helper::searcher_test<char16_t>(randomness, alphabet);
+    test_algorithm_helper::searcher_test<std::uint32_t>(randomness, alphabet);
+  }
+
+  // the periodic pattern, the pattern longer than the text, the empty pattern
+  ::portable_stl::string_view const text{"aaaaaaaaabaaaaab"};
+  ::portable_stl::string_view const pattern{"aaaaab"};
+  ::portable_stl::string_view const longer{"aaaaaaaaabaaaaabb"};
+  ::portable_stl::string_view const empty{""};
+
+  ::portable_stl::boyer_moore_searcher<char const *> const bm(pattern.begin(), pattern.end());
+  EXPECT_EQ(4, ::portable_stl::search(text.begin(), text.end(), bm) - text.begin());
+  ::portable_stl::boyer_moore_horspool_searcher<char const *> const bmh(pattern.begin(), pattern.end());
+  EXPECT_EQ(4, ::portable_stl::search(text.begin(), text.end(), bmh) - text.begin());
+
+  ::portable_stl::boyer_moore_searcher<char const *> const bm_longer(longer.begin(), longer.end());
+  EXPECT_EQ(text.end(), ::portable_stl::search(text.begin(), text.end(), bm_longer));
+  ::portable_stl::boyer_moore_horspool_searcher<char const *> const bmh_empty(empty.begin(), empty.end());
+  auto const empty_result = bmh_empty(text.begin(), text.end());
+  EXPECT_EQ(text.begin(), ::portable_stl::get<0>(empty_result));
+  EXPECT_EQ(text.begin(), ::portable_stl::get<1>(empty_result));
+
+  // one searcher over many buffers
+  {
+    auto const searcher
+      = ::portable_stl::boyer_moore_horspool_searcher<char const *>::make_boyer_moore_horspool_searcher(
+        pattern.begin(), pattern.end());
+    ASSERT_TRUE(searcher);
+    for (::portable_stl::size_t skip{0}; skip < 5U; ++skip) {
+      EXPECT_EQ(4 - static_cast<std::ptrdiff_t>(skip),
+                ::portable_stl::search(text.begin() + skip, text.end(), searcher.value()) - text.begin() - skip);
+    }
+    auto const bm_made
+      = ::portable_stl::boyer_moore_searcher<char const *>::make_boyer_moore_searcher(pattern.begin(), pattern.end());
+    ASSERT_TRUE(bm_made);
+    EXPECT_EQ(10, ::portable_stl::search(text.begin() + 5, text.end(), bm_made.value()) - text.begin());
+  }
+
+  // the predicate of the default searcher
+  {
+    ::portable_stl::string_view const upper{"AAB"};
+    auto const                        case_insensitive = [](char left, char right) {
+      return (left == right) || ((left - 'a') == (right - 'A'));
+    };
+    ::portable_stl::default_searcher<char const *, decltype(case_insensitive)> const searcher(
+      upper.begin(), upper.end(), case_insensitive);
+    EXPECT_EQ(7, ::portable_stl::search(text.begin(), text.end(), searcher) - text.begin());
+  }
+}
+
+TEST(algorithm, partition) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t len : {0, 1, 2, 63, 64, 65, 130, 1000, 5000}) {
+    for (auto const &pattern : test_algorithm_helper::sort_patterns(len)) {
+      for (std::int32_t divisor : {2, 3, 100001}) {
+        auto pred = [divisor](std::int32_t value) { return 0 == value % divisor; };
+        auto const expected_count = std::count_if(pattern.begin(), pattern.end(), pred);
+
+        // block partition
+        std::vector<std::int32_t> values(pattern);
+        std::int32_t *const       split{::portable_stl::partition(values.data(), values.data() + values.size(), pred)};
+        ASSERT_EQ(expected_count, split - values.data());
+        ASSERT_TRUE(std::is_partitioned(values.data(), values.data() + values.size(), pred));
+        std::sort(values.begin(), values.end());
+        std::vector<std::int32_t> sorted_pattern(pattern);
+        std::sort(sorted_pattern.begin(), sorted_pattern.end());
+        ASSERT_EQ(sorted_pattern, values);
+
+        // partition_point
+        ASSERT_EQ(split, ::portable_stl::partition_point(values.data(), values.data() + values.size(), [&](
+          std::int32_t const &value) { return &value < split; }));
+
+        // bidirectional and forward iterators
+        std::vector<std::int32_t> values_bidir(pattern);
+        auto const                split_bidir = ::portable_stl::partition(
+          test_iterator_helper::tst_bidirectional_iterator<std::int32_t *>(values_bidir.data()),
+          test_iterator_helper::tst_bidirectional_iterator<std::int32_t *>(values_bidir.data() + values_bidir.size()),
+          pred);
+        ASSERT_EQ(expected_count, split_bidir.base() - values_bidir.data());
+        ASSERT_TRUE(std::is_partitioned(values_bidir.begin(), values_bidir.end(), pred));
+
+        std::vector<std::int32_t> values_fwd(pattern);
+        auto const                split_fwd = ::portable_stl::partition(
+          test_iterator_helper::tst_forward_iterator<std::int32_t *>(values_fwd.data()),
+          test_iterator_helper::tst_forward_iterator<std::int32_t *>(values_fwd.data() + values_fwd.size()),
+          pred);
+        ASSERT_EQ(expected_count, split_fwd.base() - values_fwd.data());
+        ASSERT_TRUE(std::is_partitioned(values_fwd.begin(), values_fwd.end(), pred));
+        ASSERT_EQ(split_fwd.base(),
+                  ::portable_stl::partition_point(
+                    test_iterator_helper::tst_forward_iterator<std::int32_t *>(values_fwd.data()),
+                    test_iterator_helper::tst_forward_iterator<std::int32_t *>(values_fwd.data() + values_fwd.size()),
+                    pred)
+                    .base());
+      }
+    }
+  }
+
+  // vector iterators, not trivially copyable
+  {
+    ::portable_stl::vector<std::string> vec;
+    for (std::int32_t i{0}; i < 100; ++i) {
+      ASSERT_TRUE(vec.push_back(std::to_string(i)));
+    }
+    auto pred = [](std::string const &value) { return value.size() == 1; };
+    auto split = ::portable_stl::partition(vec.begin(), vec.end(), pred);
+    EXPECT_EQ(10, split - vec.begin());
+    EXPECT_TRUE(std::is_partitioned(vec.data(), vec.data() + vec.size(), pred));
+  }
+}
+
+TEST(algorithm, stable_partition) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t len : {0, 1, 2, 33, 100, 1000}) {
+    for (auto const &pattern : test_algorithm_helper::sort_patterns(len)) {
+      auto pred = [](std::int32_t value) { return 0 == value % 3; };
+      std::vector<std::int32_t> expected_values(pattern);
+      auto const                expected_split
+        = std::stable_partition(expected_values.begin(), expected_values.end(), pred) - expected_values.begin();
+
+      std::vector<std::int32_t> values(pattern);
+      auto const                split = ::portable_stl::stable_partition(
+        test_iterator_helper::tst_bidirectional_iterator<std::int32_t *>(values.data()),
+        test_iterator_helper::tst_bidirectional_iterator<std::int32_t *>(values.data() + values.size()),
+        pred);
+      ASSERT_EQ(expected_split, split.base() - values.data());
+      ASSERT_EQ(expected_values, values);
+
+      // partial buffer and rotations without the buffer
+      for (std::ptrdiff_t buffer_size : {0, 1, 7}) {
+        std::vector<std::int32_t> values_small(pattern);
+        std::int32_t             *first{std::find_if_not(values_small.data(), values_small.data() + len, pred)};
+        if (first != values_small.data() + len) {
+          std::vector<std::int32_t> buffer(static_cast<std::size_t>(buffer_size) + 1U);
+          std::int32_t *const       split_small{::portable_stl::algorithm_helper::stable_partition_impl(
+            first, values_small.data() + len, pred, values_small.data() + len - first, buffer.data(), buffer_size)};
+          ASSERT_EQ(expected_split, split_small - values_small.data());
+        }
+        ASSERT_EQ(expected_values, values_small);
+      }
+    }
+  }
+
+  // not trivially copyable
+  {
+    std::vector<std::string> values;
+    for (std::int32_t i{0}; i < 100; ++i) {
+      values.push_back(std::to_string(i));
+    }
+    std::vector<std::string> expected_values(values);
+    auto pred = [](std::string const &value) { return value.back() == '1'; };
+    std::stable_partition(expected_values.begin(), expected_values.end(), pred);
+    EXPECT_EQ(10, ::portable_stl::stable_partition(values.data(), values.data() + values.size(), pred) - values.data());
+    EXPECT_EQ(expected_values, values);
+  }
+}
+
+TEST(algorithm, stable_partition_pred_throws) {
+  static_cast<void>(test_info_);
+
+  // the strings do not fit the small string buffer, so the lost and leaked elements are reported by the sanitizers
+  std::vector<std::string> strings;
+  std::vector<std::int32_t> numbers;
+  for (std::int32_t i{0}; i < 64; ++i) {
+    strings.push_back(std::string(32U, 'x') + std::to_string(i));
+    numbers.push_back(i);
+  }
+
+  auto const is_first_group = [](std::string const &value) { return 0 == value.back() % 3; };
+  for (std::int32_t throw_after : {0, 1, 2, 39, 63, 70, 1000}) {
+    std::int32_t calls{0};
+    auto const   pred = [&calls, throw_after, &is_first_group](std::string const &value) {
+      if (calls++ == throw_after) {
+        throw std::int32_t{0};
+      }
+      return is_first_group(value);
+    };
+
+    std::vector<std::string> values(strings);
+    try {
+      static_cast<void>(::portable_stl::stable_partition(values.data(), values.data() + values.size(), pred));
+      ASSERT_LT(calls, throw_after);
+    } catch (std::int32_t) {
+    }
+    ASSERT_TRUE(std::is_permutation(strings.begin(), strings.end(), values.begin()));
+
+    // the partition with the half size buffer and the rotations
+    calls = 0;
+    values = strings;
+    std::string *const first{std::find_if_not(values.data(), values.data() + values.size(), is_first_group)};
+    ::portable_stl::algorithm_helper::temporary_buffer<std::string> buffer(16U);
+    try {
+      static_cast<void>(::portable_stl::algorithm_helper::stable_partition_impl(
+        first, values.data() + values.size(), pred, values.data() + values.size() - first, buffer.data(), 16));
+      ASSERT_LT(calls, throw_after);
+    } catch (std::int32_t) {
+    }
+    ASSERT_TRUE(std::is_permutation(strings.begin(), strings.end(), values.begin()));
+
+    // the branchless partition
+    calls = 0;
+    std::vector<std::int32_t> values_trivial(numbers);
+    auto const                pred_trivial = [&calls, throw_after](std::int32_t value) {
+      if (calls++ == throw_after) {
+        throw std::int32_t{0};
+      }
+      return 0 == value % 3;
+    };
+    try {
+      static_cast<void>(::portable_stl::stable_partition(
+        values_trivial.data(), values_trivial.data() + values_trivial.size(), pred_trivial));
+      ASSERT_LT(calls, throw_after);
+    } catch (std::int32_t) {
+    }
+    ASSERT_TRUE(std::is_permutation(numbers.begin(), numbers.end(), values_trivial.begin()));
+  }
+}
+
+TEST(algorithm, remove_if) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t len : {0, 1, 2, 63, 64, 65, 1000}) {
+    for (auto const &pattern : test_algorithm_helper::sort_patterns(len)) {
+      for (std::int32_t divisor : {2, 3, 100001}) {
+        auto pred = [divisor](std::int32_t value) { return 0 == value % divisor; };
+        std::vector<std::int32_t> expected_values(pattern);
+        expected_values.erase(std::remove_if(expected_values.begin(), expected_values.end(), pred),
+                              expected_values.end());
+
+        std::vector<std::int32_t> values(pattern);
+        values.resize(static_cast<std::size_t>(
+          ::portable_stl::remove_if(values.data(), values.data() + values.size(), pred) - values.data()));
+        ASSERT_EQ(expected_values, values);
+
+        std::vector<std::int32_t> values_fwd(pattern);
+        auto const                end_fwd = ::portable_stl::remove_if(
+          test_iterator_helper::tst_forward_iterator<std::int32_t *>(values_fwd.data()),
+          test_iterator_helper::tst_forward_iterator<std::int32_t *>(values_fwd.data() + values_fwd.size()),
+          pred);
+        values_fwd.resize(static_cast<std::size_t>(end_fwd.base() - values_fwd.data()));
+        ASSERT_EQ(expected_values, values_fwd);
+      }
+    }
+  }
+}
+
+TEST(algorithm, unique) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t len : {0, 1, 2, 100}) {
+    for (auto const &pattern : test_algorithm_helper::sort_patterns(len)) {
+      std::vector<std::int32_t> expected_values(pattern);
+      expected_values.erase(std::unique(expected_values.begin(), expected_values.end()), expected_values.end());
+
+      std::vector<std::int32_t> values(pattern);
+      values.resize(static_cast<std::size_t>(
+        ::portable_stl::unique(values.data(), values.data() + values.size()) - values.data()));
+      ASSERT_EQ(expected_values, values);
+
+      // unique_copy from the input and forward iterators
+      std::vector<std::int32_t> copied(pattern.size());
+      auto const                copied_end = ::portable_stl::unique_copy(
+        test_iterator_helper::tst_input_iterator<std::int32_t const *>(pattern.data()),
+        test_iterator_helper::tst_input_iterator<std::int32_t const *>(pattern.data() + pattern.size()),
+        copied.data());
+      ASSERT_EQ(expected_values, std::vector<std::int32_t>(copied.data(), copied_end));
+
+      auto const copied_fwd_end = ::portable_stl::unique_copy(
+        test_iterator_helper::tst_forward_iterator<std::int32_t const *>(pattern.data()),
+        test_iterator_helper::tst_forward_iterator<std::int32_t const *>(pattern.data() + pattern.size()),
+        copied.data());
+      ASSERT_EQ(expected_values, std::vector<std::int32_t>(copied.data(), copied_fwd_end));
+    }
+  }
+
+  // predicate
+  {
+    std::int32_t values[]{1, 3, 5, 2, 4, 7, 8};
+    auto         same_parity = [](std::int32_t lhv, std::int32_t rhv) { return (lhv % 2) == (rhv % 2); };
+    ASSERT_EQ(values + 4, ::portable_stl::unique(values, values + 7, same_parity));
+    EXPECT_EQ(1, values[0]);
+    EXPECT_EQ(2, values[1]);
+    EXPECT_EQ(7, values[2]);
+    EXPECT_EQ(8, values[3]);
+  }
+}
+
+TEST(algorithm, reverse) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t len : {0, 1, 2, 3, 100}) {
+    auto const                pattern = test_algorithm_helper::sort_patterns(len)[0];
+    std::vector<std::int32_t> expected_values(pattern.rbegin(), pattern.rend());
+
+    std::vector<std::int32_t> values(pattern);
+    ::portable_stl::reverse(values.data(), values.data() + values.size());
+    ASSERT_EQ(expected_values, values);
+
+    std::vector<std::int32_t> values_bidir(pattern);
+    ::portable_stl::reverse(
+      test_iterator_helper::tst_bidirectional_iterator<std::int32_t *>(values_bidir.data()),
+      test_iterator_helper::tst_bidirectional_iterator<std::int32_t *>(values_bidir.data() + values_bidir.size()));
+    ASSERT_EQ(expected_values, values_bidir);
+  }
+}
+
+namespace test_algorithm_helper {
+/**
+ * @brief Generator of the values 0, 1 and 2 to test the combined draws.
+ */
+class small_generator final {
+  /**
+   * @brief Underlying generator.
+   */
+  std::mt19937 m_gen;
+
+public:
+  /**
+   * @brief Result type.
+   */
+  using result_type = std::uint32_t;
+
+  /**
+   * @brief The smallest value.
+   * @return 0.
+   */
+  static constexpr result_type min() {
+    return 0U;
+  }
+
+  /**
+   * @brief The greatest value.
+   * @return 2.
+   */
+  static constexpr result_type max() {
+    return 2U;
+  }
+
+  /**
+   * @brief Draws the next value.
+   * @return the value in [0, 2].
+   */
+  result_type operator()() {
+    return m_gen() % 3U;
+  }
+};
+} // namespace test_algorithm_helper
+
+TEST(algorithm, shuffle) {
+  static_cast<void>(test_info_);
+
+  // every position receives every value about equally often
+  for (std::int32_t gen_kind{0}; gen_kind < 3; ++gen_kind) {
+    std::mt19937                          gen32;
+    std::mt19937_64                       gen64;
+    test_algorithm_helper::small_generator gen_small;
+    std::int32_t                          counts[5][5]{};
+    for (std::int32_t round{0}; round < 10000; ++round) {
+      std::int32_t values[]{0, 1, 2, 3, 4};
+      if (0 == gen_kind) {
+        ::portable_stl::shuffle(values, values + 5, gen32);
+      } else if (1 == gen_kind) {
+        ::portable_stl::shuffle(values, values + 5, gen64);
+      } else {
+        ::portable_stl::shuffle(values, values + 5, gen_small);
+      }
+      for (std::int32_t pos{0}; pos < 5; ++pos) {
+        ++counts[pos][values[pos]];
+      }
+    }
+    for (auto const &row : counts) {
+      for (std::int32_t count : row) {
+        EXPECT_LT(1800, count);
+        EXPECT_GT(2200, count);
+      }
+    }
+  }
+
+  // the combined draws of the short range generator
+  {
+    test_algorithm_helper::small_generator gen_small;
+    std::int32_t                          counts[10]{};
+    for (std::int32_t round{0}; round < 10000; ++round) {
+      ++counts[::portable_stl::algorithm_helper::shuffle_uniform(gen_small, 10U)];
+    }
+    for (std::int32_t count : counts) {
+      EXPECT_LT(850, count);
+      EXPECT_GT(1150, count);
+    }
+  }
+
+  // permutation of not trivially copyable elements
+  {
+    ::portable_stl::vector<std::string> vec;
+    for (std::int32_t i{0}; i < 100; ++i) {
+      ASSERT_TRUE(vec.push_back(std::to_string(i)));
+    }
+    ::portable_stl::shuffle(vec.begin(), vec.end(), std::mt19937{});
+    std::vector<std::string> sorted(vec.data(), vec.data() + vec.size());
+    std::sort(sorted.begin(), sorted.end(), [](std::string const &lhv, std::string const &rhv) {
+      return std::stoi(lhv) < std::stoi(rhv);
+    });
+    for (std::int32_t i{0}; i < 100; ++i) {
+      ASSERT_EQ(std::to_string(i), sorted[static_cast<std::size_t>(i)]);
+    }
+  }
+}
@@ -0,0 +1,140 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="bitset.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include "portable_stl/bitset/bitset.h"
+
+TEST(bitset, constructor) {
+  static_cast<void>(test_info_);
+
+  {
+    ::portable_stl::bitset<70> bits;
+    EXPECT_EQ(70, bits.size());
+    EXPECT_EQ(0, bits.count());
+    EXPECT_TRUE(bits.none());
+  }
+  {
+    ::portable_stl::bitset<8> bits(0x1FFULL);
+    EXPECT_EQ(8, bits.count());
+    EXPECT_TRUE(bits.all());
+  }
+  {
+    ::portable_stl::bitset<70> bits(0x8000000000000001ULL);
+    EXPECT_EQ(2, bits.count());
+    EXPECT_TRUE(bits[0]);
+    EXPECT_TRUE(bits[63]);
+    EXPECT_FALSE(bits[64]);
+  }
+}
+
+TEST(bitset, element_access) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::bitset<100> bits;
+  bits[3]  = true;
+  bits[99] = true;
+  EXPECT_TRUE(bits[3]);
+  EXPECT_TRUE(bits.test(99));
+  EXPECT_FALSE(bits.test(98));
+  EXPECT_EQ(2, bits.count());
+  EXPECT_TRUE(bits.any());
+  EXPECT_FALSE(bits.all());
+
+  bits[3].flip();
+  EXPECT_FALSE(bits[3]);
+  EXPECT_TRUE(~bits[3]);
+  bits[4] = bits[99];
+  EXPECT_TRUE(bits[4]);
+
+  try {
+    static_cast<void>(bits.test(100));
+    ASSERT_TRUE(false);
+  } catch (::portable_stl::out_of_range<> &) {
+  }
+}
+
+TEST(bitset, modifiers) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::bitset<70> bits;
+  bits.set();
+  EXPECT_EQ(70, bits.count());
+  EXPECT_TRUE(bits.all());
+
+  bits.reset(5).flip(6);
+  EXPECT_EQ(68, bits.count());
+
+  bits.flip();
+  EXPECT_EQ(2, bits.count());
+  EXPECT_TRUE(bits[5]);
+  EXPECT_TRUE(bits[6]);
+
+  EXPECT_EQ(68, (~bits).count());
+
+  bits.reset();
+  EXPECT_TRUE(bits.none());
+
+  try {
+    bits.set(70);
+    ASSERT_TRUE(false);
+  } catch (::portable_stl::out_of_range<> &) {
+  }
+}
+
+TEST(bitset, bitwise) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::bitset<130> lhv;
+  ::portable_stl::bitset<130> rhv;
+  lhv.set(1).set(64).set(129);
+  rhv.set(1).set(65).set(129);
+
+  EXPECT_EQ(2, (lhv & rhv).count());
+  EXPECT_EQ(4, (lhv | rhv).count());
+  EXPECT_EQ(2, (lhv ^ rhv).count());
+
+  ::portable_stl::bitset<130> diff(lhv);
+  diff.and_not(rhv);
+  EXPECT_EQ(1, diff.count());
+  EXPECT_TRUE(diff[64]);
+
+  EXPECT_TRUE(lhv == lhv);
+  EXPECT_TRUE(lhv != rhv);
+}
+
+TEST(bitset, shift) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::bitset<130> bits;
+  bits.set(0).set(63).set(127);
+
+  auto up = bits << 65U;
+  EXPECT_EQ(2, up.count());
+  EXPECT_TRUE(up[65]);
+  EXPECT_TRUE(up[128]);
+
+  auto down = bits >> 63U;
+  EXPECT_EQ(2, down.count());
+  EXPECT_TRUE(down[0]);
+  EXPECT_TRUE(down[64]);
+
+  // bits shifted beyond size are dropped
+  EXPECT_EQ(0, (bits << 130U).count());
+  EXPECT_EQ(2, (bits << 3U).count());
+  EXPECT_EQ(0, (bits >> 128U).count());
+
+  bits <<= 0U;
+  EXPECT_EQ(3, bits.count());
+  bits >>= 64U;
+  EXPECT_TRUE(bits[63]);
+  EXPECT_EQ(1, bits.count());
+}
@@ -0,0 +1,354 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="circular_buffer.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../common/test_allocator.h"
+#include "portable_stl/circular_buffer/circular_buffer.h"
+
+/**
+ * @brief Test allocator alias
+ */
+using TestCircularAlloc = test_allocator_helper::TestSimpleAllocator<std::int32_t>;
+
+TEST(circular_buffer, constructor) {
+  static_cast<void>(test_info_);
+
+  {
+    ::portable_stl::circular_buffer<std::int32_t> buf;
+    EXPECT_TRUE(buf.empty());
+    EXPECT_TRUE(buf.full());
+    EXPECT_EQ(0, buf.capacity());
+    EXPECT_FALSE(buf.push_back(1));
+  }
+  {
+    ::portable_stl::circular_buffer<std::int32_t> buf(5);
+    EXPECT_TRUE(buf.empty());
+    EXPECT_FALSE(buf.full());
+    EXPECT_EQ(8, buf.capacity());
+    EXPECT_EQ(8, buf.free_space());
+  }
+  {
+    ::portable_stl::circular_buffer<std::int32_t> buf(16);
+    EXPECT_EQ(16, buf.capacity());
+  }
+
+  // bad allocation
+  {
+    TestCircularAlloc::m_counter_ok_allocation = 0;
+    try {
+      ::portable_stl::circular_buffer<std::int32_t, TestCircularAlloc> buf(2);
+      ASSERT_TRUE(false);
+    } catch (::portable_stl::bad_alloc<> &) {
+    }
+    TestCircularAlloc::resetStat();
+  }
+
+  // rounded capacity exceeds max_size
+  {
+    TestCircularAlloc::m_max_size = 10;
+    try {
+      ::portable_stl::circular_buffer<std::int32_t, TestCircularAlloc> buf(9);
+      ASSERT_TRUE(false);
+    } catch (::portable_stl::length_error<> &) {
+    }
+    TestCircularAlloc::resetStat();
+  }
+}
+
+TEST(circular_buffer, make_circular_buffer) {
+  static_cast<void>(test_info_);
+
+  {
+    auto result = ::portable_stl::circular_buffer<std::int32_t>::make_circular_buffer(3);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(4, result.value().capacity());
+  }
+  {
+    TestCircularAlloc::m_counter_ok_allocation = 0;
+    auto result = ::portable_stl::circular_buffer<std::int32_t, TestCircularAlloc>::make_circular_buffer(3);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+    TestCircularAlloc::resetStat();
+  }
+  {
+    TestCircularAlloc::m_max_size = 10;
+    auto result = ::portable_stl::circular_buffer<std::int32_t, TestCircularAlloc>::make_circular_buffer(11);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(::portable_stl::portable_stl_error::length_error, result.error());
+    TestCircularAlloc::resetStat();
+  }
+}
+
+TEST(circular_buffer, push_pop) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::circular_buffer<std::int32_t> buf(4);
+  for (std::int32_t i{0}; i < 4; ++i) {
+    EXPECT_TRUE(buf.push_back(i));
+  }
+  EXPECT_TRUE(buf.full());
+
+  auto result = buf.push_back(4);
+  ASSERT_FALSE(result);
+  EXPECT_EQ(::portable_stl::portable_stl_error::length_error, result.error());
+
+  EXPECT_EQ(0, buf.front());
+  EXPECT_EQ(3, buf.back());
+  buf.pop_front();
+  buf.pop_front();
+  EXPECT_TRUE(buf.push_back(4));
+  EXPECT_TRUE(buf.push_back(5));
+
+  // wrapped content
+  EXPECT_EQ(2, buf.front());
+  EXPECT_EQ(5, buf.back());
+  for (std::int32_t i{0}; i < 4; ++i) {
+    EXPECT_EQ(i + 2, buf[static_cast<::portable_stl::size_t>(i)]);
+  }
+  EXPECT_EQ(4, buf.at(2).value());
+  EXPECT_FALSE(buf.at(4));
+
+  std::int32_t expected_value{2};
+  for (auto value : buf) {
+    EXPECT_EQ(expected_value, value);
+    ++expected_value;
+  }
+  EXPECT_EQ(4, buf.end() - buf.begin());
+  EXPECT_EQ(5, *buf.rbegin());
+
+  buf.clear();
+  EXPECT_TRUE(buf.empty());
+  EXPECT_EQ(4, buf.capacity());
+}
+
+TEST(circular_buffer, overwrite_oldest) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::circular_buffer<std::string> buf(2);
+  buf.set_overwrite_oldest(true);
+  EXPECT_TRUE(buf.overwrite_oldest());
+
+  EXPECT_TRUE(buf.push_back("a"));
+  EXPECT_TRUE(buf.push_back("b"));
+  auto result = buf.emplace_back(3U, 'c');
+  ASSERT_TRUE(result);
+  EXPECT_EQ("ccc", result.value().get());
+  EXPECT_EQ(2, buf.size());
+  EXPECT_EQ("b", buf.front());
+  EXPECT_EQ("ccc", buf.back());
+}
+
+TEST(circular_buffer, overwrite_oldest_self_reference) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::circular_buffer<std::string> buf(2);
+  buf.set_overwrite_oldest(true);
+  EXPECT_TRUE(buf.push_back(std::string(32U, 'a')));
+  EXPECT_TRUE(buf.push_back(std::string(32U, 'b')));
+
+  // the argument refers to the element which is overwritten
+  EXPECT_TRUE(buf.push_back(buf.front()));
+  EXPECT_EQ(2, buf.size());
+  EXPECT_EQ(std::string(32U, 'b'), buf.front());
+  EXPECT_EQ(std::string(32U, 'a'), buf.back());
+
+  auto result = buf.emplace_back(::portable_stl::move(buf.front()));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(std::string(32U, 'b'), result.value().get());
+  EXPECT_EQ(std::string(32U, 'a'), buf.front());
+  EXPECT_EQ(std::string(32U, 'b'), buf.back());
+}
+
+TEST(circular_buffer, push_back_n_self_reference) {
+  static_cast<void>(test_info_);
+
+  std::string const str_a(32U, 'a');
+  std::string const str_b(32U, 'b');
+  std::string const str_c(32U, 'c');
+  std::string const str_d(32U, 'd');
+
+  // the source is the elements which are overwritten
+  {
+    ::portable_stl::circular_buffer<std::string> buf(4);
+    buf.set_overwrite_oldest(true);
+    EXPECT_TRUE(buf.push_back(str_a));
+    EXPECT_TRUE(buf.push_back(str_b));
+    EXPECT_TRUE(buf.push_back(str_c));
+
+    auto const one = buf.array_one();
+    EXPECT_EQ(3, buf.push_back_n(one.ptr, one.count));
+    ASSERT_EQ(4, buf.size());
+    EXPECT_EQ(str_c, buf[0]);
+    EXPECT_EQ(str_a, buf[1]);
+    EXPECT_EQ(str_b, buf[2]);
+    EXPECT_EQ(str_c, buf[3]);
+  }
+  {
+    ::portable_stl::circular_buffer<std::string> buf(4);
+    buf.set_overwrite_oldest(true);
+    EXPECT_TRUE(buf.push_back(str_a));
+    EXPECT_TRUE(buf.push_back(str_b));
+    EXPECT_TRUE(buf.push_back(str_c));
+    EXPECT_TRUE(buf.push_back(str_d));
+
+    auto const one = buf.array_one();
+    EXPECT_EQ(4, buf.push_back_n(one.ptr, one.count));
+    ASSERT_EQ(4, buf.size());
+    EXPECT_EQ(str_a, buf[0]);
+    EXPECT_EQ(str_b, buf[1]);
+    EXPECT_EQ(str_c, buf[2]);
+    EXPECT_EQ(str_d, buf[3]);
+  }
+
+  // trivially copyable, the source overlaps the overwritten elements
+  {
+    std::int32_t const src[]{0, 1, 2, 3, 4, 5};
+
+    ::portable_stl::circular_buffer<std::int32_t> buf(4);
+    buf.set_overwrite_oldest(true);
+    EXPECT_EQ(4, buf.push_back_n(src, 4));
+    EXPECT_EQ(2, buf.erase_front(2));
+    EXPECT_EQ(2, buf.push_back_n(src + 4, 2));
+
+    // storage: [4, 5, 2, 3], the oldest element at index 2
+    auto const two = buf.array_two();
+    EXPECT_EQ(2, buf.push_back_n(two.ptr, two.count));
+    ASSERT_EQ(4, buf.size());
+    EXPECT_EQ(4, buf[0]);
+    EXPECT_EQ(5, buf[1]);
+    EXPECT_EQ(4, buf[2]);
+    EXPECT_EQ(5, buf[3]);
+
+    EXPECT_EQ(1, buf.erase_front(1));
+    auto const one = buf.array_one();
+    EXPECT_EQ(2, buf.push_back_n(one.ptr + 1, 2));
+    ASSERT_EQ(4, buf.size());
+    EXPECT_EQ(4, buf[0]);
+    EXPECT_EQ(5, buf[1]);
+    EXPECT_EQ(4, buf[2]);
+    EXPECT_EQ(5, buf[3]);
+  }
+}
+
+TEST(circular_buffer, array_one_two) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::circular_buffer<std::int32_t> buf(4);
+  EXPECT_EQ(0, buf.array_one().count);
+  EXPECT_EQ(0, buf.array_two().count);
+
+  std::int32_t const src[]{1, 2, 3};
+  EXPECT_EQ(3, buf.push_back_n(src, 3));
+  EXPECT_EQ(3, buf.array_one().count);
+  EXPECT_EQ(0, buf.array_two().count);
+
+  EXPECT_EQ(2, buf.erase_front(2));
+  EXPECT_EQ(3, buf.push_back_n(src, 3));
+
+  // storage: [2, 3, 3, 1], the oldest element at index 2
+  auto const one = buf.array_one();
+  auto const two = buf.array_two();
+  ASSERT_EQ(2, one.count);
+  ASSERT_EQ(2, two.count);
+  EXPECT_EQ(3, one.ptr[0]);
+  EXPECT_EQ(1, one.ptr[1]);
+  EXPECT_EQ(2, two.ptr[0]);
+  EXPECT_EQ(3, two.ptr[1]);
+}
+
+TEST(circular_buffer, bulk) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const src[]{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::int32_t       dst[10]{};
+
+  {
+    ::portable_stl::circular_buffer<std::int32_t> buf(8);
+    EXPECT_EQ(6, buf.push_back_n(src, 6));
+    EXPECT_EQ(4, buf.pop_front_n(dst, 4));
+    EXPECT_EQ(0, dst[0]);
+    EXPECT_EQ(3, dst[3]);
+
+    // wraps around the storage end, rejects elements beyond capacity
+    EXPECT_EQ(4, buf.push_back_n(src + 6, 4));
+    EXPECT_EQ(2, buf.push_back_n(src, 10));
+    EXPECT_TRUE(buf.full());
+
+    EXPECT_EQ(8, buf.pop_front_n(dst, 10));
+    std::int32_t const expected_values[]{4, 5, 6, 7, 8, 9, 0, 1};
+    for (::portable_stl::size_t i{0}; i < 8; ++i) {
+      EXPECT_EQ(expected_values[i], dst[i]);
+    }
+    EXPECT_TRUE(buf.empty());
+  }
+
+  // overwrite oldest
+  {
+    ::portable_stl::circular_buffer<std::int32_t> buf(4);
+    buf.set_overwrite_oldest(true);
+    EXPECT_EQ(3, buf.push_back_n(src, 3));
+    EXPECT_EQ(3, buf.push_back_n(src + 3, 3));
+    EXPECT_EQ(4, buf.size());
+    EXPECT_EQ(2, buf.front());
+
+    EXPECT_EQ(4, buf.push_back_n(src, 10));
+    EXPECT_EQ(6, buf.front());
+    EXPECT_EQ(9, buf.back());
+  }
+
+  // not trivially copyable
+  {
+    std::string const src_str[]{"a", "b", "c"};
+    std::string       dst_str[3];
+
+    ::portable_stl::circular_buffer<std::string> buf(4);
+    EXPECT_EQ(3, buf.push_back_n(src_str, 3));
+    EXPECT_EQ(2, buf.pop_front_n(dst_str, 2));
+    EXPECT_EQ(3, buf.push_back_n(src_str, 3));
+    EXPECT_EQ(4, buf.size());
+    EXPECT_EQ(3, buf.pop_front_n(dst_str, 3));
+    EXPECT_EQ("c", dst_str[0]);
+    EXPECT_EQ("a", dst_str[1]);
+    EXPECT_EQ("b", dst_str[2]);
+  }
+}
+
+TEST(circular_buffer, copy_move) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::circular_buffer<std::string> buf(4);
+  buf.set_overwrite_oldest(true);
+  for (std::int32_t i{0}; i < 6; ++i) {
+    EXPECT_TRUE(buf.push_back(std::to_string(i)));
+  }
+
+  ::portable_stl::circular_buffer<std::string> buf_copy(buf);
+  EXPECT_EQ(4, buf_copy.size());
+  EXPECT_TRUE(buf_copy.overwrite_oldest());
+  EXPECT_EQ("2", buf_copy.front());
+  EXPECT_EQ("5", buf_copy.back());
+
+  ::portable_stl::circular_buffer<std::string> buf_move(::portable_stl::move(buf_copy));
+  EXPECT_EQ(4, buf_move.size());
+  EXPECT_EQ(0, buf_copy.capacity());
+
+  ::portable_stl::circular_buffer<std::string> buf_assign(2);
+  buf_assign = buf_move;
+  EXPECT_EQ(4, buf_assign.capacity());
+  EXPECT_EQ("2", buf_assign.front());
+
+  buf_assign = ::portable_stl::circular_buffer<std::string>(8);
+  EXPECT_EQ(8, buf_assign.capacity());
+  EXPECT_TRUE(buf_assign.empty());
+}
@@ -0,0 +1,149 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="static_circular_buffer.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "portable_stl/circular_buffer/static_circular_buffer.h"
+
+TEST(static_circular_buffer, capacity) {
+  static_cast<void>(test_info_);
+
+  EXPECT_EQ(1, (::portable_stl::static_circular_buffer<std::int32_t, 1>::capacity()));
+  EXPECT_EQ(8, (::portable_stl::static_circular_buffer<std::int32_t, 5>::capacity()));
+  EXPECT_EQ(16, (::portable_stl::static_circular_buffer<std::int32_t, 16>::capacity()));
+}
+
+TEST(static_circular_buffer, push_pop) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::static_circular_buffer<std::int32_t, 4> buf;
+  EXPECT_TRUE(buf.empty());
+  for (std::int32_t i{0}; i < 4; ++i) {
+    EXPECT_TRUE(buf.push_back(i));
+  }
+  auto result = buf.push_back(4);
+  ASSERT_FALSE(result);
+  EXPECT_EQ(::portable_stl::portable_stl_error::length_error, result.error());
+
+  buf.pop_front();
+  EXPECT_TRUE(buf.push_back(4));
+  EXPECT_EQ(1, buf.front());
+  EXPECT_EQ(4, buf.back());
+  EXPECT_EQ(3, buf[2]);
+
+  buf.set_overwrite_oldest(true);
+  EXPECT_TRUE(buf.push_back(5));
+  EXPECT_EQ(2, buf.front());
+  EXPECT_EQ(5, buf.back());
+
+  std::int32_t expected_value{2};
+  for (auto value : buf) {
+    EXPECT_EQ(expected_value, value);
+    ++expected_value;
+  }
+}
+
+TEST(static_circular_buffer, overwrite_oldest_self_reference) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::static_circular_buffer<std::string, 2> buf;
+  buf.set_overwrite_oldest(true);
+  EXPECT_TRUE(buf.push_back(std::string(32U, 'a')));
+  EXPECT_TRUE(buf.push_back(std::string(32U, 'b')));
+
+  // the argument refers to the element which is overwritten
+  EXPECT_TRUE(buf.push_back(buf.front()));
+  EXPECT_EQ(std::string(32U, 'b'), buf.front());
+  EXPECT_EQ(std::string(32U, 'a'), buf.back());
+}
+
+TEST(static_circular_buffer, push_back_n_self_reference) {
+  static_cast<void>(test_info_);
+
+  std::string const str_a(32U, 'a');
+  std::string const str_b(32U, 'b');
+  std::string const str_c(32U, 'c');
+
+  // the source is the elements which are overwritten
+  {
+    ::portable_stl::static_circular_buffer<std::string, 4> buf;
+    buf.set_overwrite_oldest(true);
+    EXPECT_TRUE(buf.push_back(str_a));
+    EXPECT_TRUE(buf.push_back(str_b));
+    EXPECT_TRUE(buf.push_back(str_c));
+
+    auto const one = buf.array_one();
+    EXPECT_EQ(3, buf.push_back_n(one.ptr, one.count));
+    ASSERT_EQ(4, buf.size());
+    EXPECT_EQ(str_c, buf[0]);
+    EXPECT_EQ(str_a, buf[1]);
+    EXPECT_EQ(str_b, buf[2]);
+    EXPECT_EQ(str_c, buf[3]);
+  }
+
+  // trivially copyable, the source overlaps the overwritten elements
+  {
+    std::int32_t const src[]{1, 2, 3};
+
+    ::portable_stl::static_circular_buffer<std::int32_t, 4> buf;
+    buf.set_overwrite_oldest(true);
+    EXPECT_EQ(3, buf.push_back_n(src, 3));
+
+    auto const one = buf.array_one();
+    EXPECT_EQ(3, buf.push_back_n(one.ptr, one.count));
+    ASSERT_EQ(4, buf.size());
+    EXPECT_EQ(3, buf[0]);
+    EXPECT_EQ(1, buf[1]);
+    EXPECT_EQ(2, buf[2]);
+    EXPECT_EQ(3, buf[3]);
+  }
+}
+
+TEST(static_circular_buffer, bulk) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const src[]{0, 1, 2, 3, 4, 5, 6, 7};
+  std::int32_t       dst[8]{};
+
+  ::portable_stl::static_circular_buffer<std::int32_t, 4> buf;
+  EXPECT_EQ(3, buf.push_back_n(src, 3));
+  EXPECT_EQ(2, buf.pop_front_n(dst, 2));
+  EXPECT_EQ(3, buf.push_back_n(src + 3, 5));
+  EXPECT_EQ(2, buf.array_one().count);
+  EXPECT_EQ(2, buf.array_two().count);
+
+  EXPECT_EQ(4, buf.pop_front_n(dst, 8));
+  EXPECT_EQ(2, dst[0]);
+  EXPECT_EQ(3, dst[1]);
+  EXPECT_EQ(4, dst[2]);
+  EXPECT_EQ(5, dst[3]);
+}
+
+TEST(static_circular_buffer, copy_move) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::static_circular_buffer<std::string, 2> buf;
+  EXPECT_TRUE(buf.push_back("a"));
+  EXPECT_TRUE(buf.push_back("b"));
+
+  ::portable_stl::static_circular_buffer<std::string, 2> buf_copy(buf);
+  EXPECT_EQ(2, buf_copy.size());
+  EXPECT_EQ("a", buf_copy.front());
+
+  ::portable_stl::static_circular_buffer<std::string, 2> buf_move(::portable_stl::move(buf_copy));
+  EXPECT_EQ("b", buf_move.back());
+
+  buf_copy = buf_move;
+  EXPECT_EQ("a", buf_copy.front());
+  EXPECT_EQ("b", buf_copy.back());
+}
@@ -0,0 +1,417 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="execution.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "iterator_helper.h"
+#include "portable_stl/execution/copy.h"
+#include "portable_stl/execution/equal.h"
+#include "portable_stl/execution/execution_policy.h"
+#include "portable_stl/execution/fill_n.h"
+#include "portable_stl/execution/find.h"
+#include "portable_stl/execution/inline_executor.h"
+#include "portable_stl/execution/lexicographical_compare.h"
+#include "portable_stl/execution/reduce.h"
+#include "portable_stl/execution/remove_if.h"
+#include "portable_stl/execution/sort.h"
+#include "portable_stl/execution/transform.h"
+#if defined(__linux__)
+#  include "portable_stl/execution/pthread_executor.h"
+#endif
+
+namespace test_execution_helper {
+/**
+ * @brief Executor which runs the tasks on the calling thread in the reverse order and reports the concurrency of 4,
+ * so the algorithms split the ranges as for the thread pool.
+ */
+class counting_executor final : public ::portable_stl::execution::executor {
+public:
+  /**
+   * @brief The number of bulk_execute calls.
+   */
+  ::portable_stl::size_t m_calls{0U};
+  /**
+   * @brief The number of tasks.
+   */
+  ::portable_stl::size_t m_tasks{0U};
+
+  /**
+   * @brief Returns the number of the tasks which can run at the same time.
+   * @return 4.
+   */
+  ::portable_stl::size_t concurrency() const noexcept override {
+    return 4U;
+  }
+
+  /**
+   * @brief Runs the tasks in the reverse order.
+   * @param function the task function.
+   * @param context the context passed to the task function.
+   * @param count the number of tasks.
+   */
+  void bulk_execute(task_function function, void *context, ::portable_stl::size_t count) noexcept override {
+    ++m_calls;
+    m_tasks += count;
+    for (::portable_stl::size_t index{count}; index > 0U; --index) {
+      function(context, index - 1U);
+    }
+  }
+};
+
+/**
+ * @brief The number of elements in the tested ranges, enough for the parallel split.
+ */
+constexpr std::int32_t large_size{300000};
+
+/**
+ * @brief Makes the random values.
+ * @param len the number of values.
+ * @return the values.
+ */
+static std::vector<std::int32_t> random_values(std::int32_t len) {
+  std::mt19937              randomness;
+  std::vector<std::int32_t> result;
+  for (std::int32_t i{0}; i < len; ++i) {
+    result.push_back(static_cast<std::int32_t>(randomness() % 100000U));
+  }
+  return result;
+}
+} // namespace test_execution_helper
+
+TEST(execution, policy) {
+  static_cast<void>(test_info_);
+
+  EXPECT_TRUE((::portable_stl::is_execution_policy<::portable_stl::execution::sequenced_policy>{}()));
+  EXPECT_TRUE((::portable_stl::is_execution_policy<::portable_stl::execution::parallel_policy>{}()));
+  EXPECT_TRUE((::portable_stl::is_execution_policy<::portable_stl::execution::parallel_unsequenced_policy>{}()));
+  EXPECT_FALSE((::portable_stl::is_execution_policy<std::int32_t *>{}()));
+
+  test_execution_helper::counting_executor exec;
+  EXPECT_EQ(&exec, &::portable_stl::execution::par.on(exec).get_executor());
+  EXPECT_EQ(&exec, &::portable_stl::execution::par_unseq.on(exec).get_executor());
+  EXPECT_EQ(&::portable_stl::execution::default_executor(), &::portable_stl::execution::par.get_executor());
+  EXPECT_LE(1U, ::portable_stl::execution::default_executor().concurrency());
+
+  ::portable_stl::execution::set_default_executor(&exec);
+  EXPECT_EQ(&exec, &::portable_stl::execution::par.get_executor());
+  ::portable_stl::execution::set_default_executor(nullptr);
+  EXPECT_NE(&exec, &::portable_stl::execution::par.get_executor());
+
+  ::portable_stl::execution::inline_executor inline_exec;
+  std::vector<std::int32_t>                  visits(10, 0);
+  auto task = [](void *context, ::portable_stl::size_t index) {
+    ++(*static_cast<std::vector<std::int32_t> *>(context))[index];
+  };
+  inline_exec.bulk_execute(task, &visits, visits.size());
+  EXPECT_EQ(1U, inline_exec.concurrency());
+  EXPECT_EQ(std::vector<std::int32_t>(10, 1), visits);
+}
+
+#if defined(__linux__)
+TEST(execution, pthread_executor) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::execution::pthread_executor pool(4U);
+  EXPECT_EQ(4U, pool.concurrency());
+  EXPECT_LE(1U, ::portable_stl::execution::pthread_executor::hardware_concurrency());
+
+  // every task runs once
+  std::vector<std::int32_t> visits(1000, 0);
+  for (std::int32_t round{0}; round < 20; ++round) {
+    pool.bulk_execute(
+      [](void *context, ::portable_stl::size_t index) {
+        ++(*static_cast<std::vector<std::int32_t> *>(context))[index];
+      },
+      &visits,
+      visits.size());
+  }
+  EXPECT_EQ(std::vector<std::int32_t>(1000, 20), visits);
+
+  // the call from the task runs on the calling thread
+  struct t_nested {
+    ::portable_stl::execution::pthread_executor *m_pool;
+    std::vector<std::int32_t>                    m_visits;
+  } nested{&pool, std::vector<std::int32_t>(64, 0)};
+  pool.bulk_execute(
+    [](void *context, ::portable_stl::size_t index) {
+      auto *const state = static_cast<t_nested *>(context);
+      state->m_pool->bulk_execute(
+        [](void *inner_context, ::portable_stl::size_t inner_index) {
+          ++(*static_cast<std::int32_t *>(inner_context));
+          static_cast<void>(inner_index);
+        },
+        &state->m_visits[index],
+        3U);
+    },
+    &nested,
+    nested.m_visits.size());
+  EXPECT_EQ(std::vector<std::int32_t>(64, 3), nested.m_visits);
+
+  // the pool without workers
+  ::portable_stl::execution::pthread_executor single(1U);
+  EXPECT_EQ(1U, single.concurrency());
+  std::vector<std::int32_t> values(test_execution_helper::large_size, 1);
+  EXPECT_EQ(test_execution_helper::large_size,
+            ::portable_stl::reduce(
+              ::portable_stl::execution::par.on(single), values.data(), values.data() + values.size()));
+
+  // the algorithms on the pool
+  auto const source = test_execution_helper::random_values(test_execution_helper::large_size);
+  auto       sorted = source;
+  ::portable_stl::sort(::portable_stl::execution::par.on(pool), sorted.data(), sorted.data() + sorted.size());
+  auto expected_sorted = source;
+  std::sort(expected_sorted.begin(), expected_sorted.end());
+  EXPECT_EQ(expected_sorted, sorted);
+}
+
+TEST(execution, algorithms_on_pthread_pool) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::execution::pthread_executor pool(4U);
+  ASSERT_EQ(4U, pool.concurrency());
+  auto const par = ::portable_stl::execution::par.on(pool);
+  auto const seq = ::portable_stl::execution::seq;
+
+  auto const is_odd = [](std::int32_t value) {
+    return 0 != (value % 2);
+  };
+  auto const twice = [](std::int32_t value) {
+    return value * 2;
+  };
+
+  // several rounds, the workers take the chunks in a different order every time
+  for (std::int32_t round{0}; round < 8; ++round) {
+    auto const source = test_execution_helper::random_values(test_execution_helper::large_size + round * 4099);
+
+    std::int32_t const *const first{source.data()};
+    std::int32_t const *const last{source.data() + source.size()};
+    std::int32_t const        size{static_cast<std::int32_t>(source.size())};
+
+    std::vector<std::int32_t> parallel(source.size(), 0);
+    std::vector<std::int32_t> sequential(source.size(), 0);
+    EXPECT_EQ(parallel.data() + size, ::portable_stl::copy(par, first, last, parallel.data()));
+    ::portable_stl::copy(seq, first, last, sequential.data());
+    EXPECT_EQ(sequential, parallel);
+
+    ::portable_stl::fill_n(par, parallel.data(), size - 1000, round);
+    ::portable_stl::fill_n(seq, sequential.data(), size - 1000, round);
+    EXPECT_EQ(sequential, parallel);
+
+    ::portable_stl::transform(par, first, last, parallel.data(), twice);
+    ::portable_stl::transform(seq, first, last, sequential.data(), twice);
+    EXPECT_EQ(sequential, parallel);
+    ::portable_stl::transform(par, first, last, sequential.data(), parallel.data(), std::plus<std::int32_t>{});
+    ::portable_stl::transform(seq, first, last, sequential.data(), sequential.data(), std::plus<std::int32_t>{});
+    EXPECT_EQ(sequential, parallel);
+
+    // the values repeat, find returns the first one
+    for (std::int32_t const needle : {source[0], source[150000], source[source.size() - 1U], -1}) {
+      ASSERT_EQ(::portable_stl::find(seq, first, last, needle), ::portable_stl::find(par, first, last, needle));
+    }
+
+    std::vector<std::int32_t> other(source);
+    EXPECT_TRUE(::portable_stl::equal(par, first, last, other.data(), other.data() + other.size()));
+    other[static_cast<::portable_stl::size_t>(size - 1 - round)] = -1;
+    EXPECT_EQ(::portable_stl::equal(seq, first, last, other.data()),
+              ::portable_stl::equal(par, first, last, other.data()));
+    EXPECT_EQ(::portable_stl::lexicographical_compare(seq, other.data(), other.data() + size, first, last),
+              ::portable_stl::lexicographical_compare(par, other.data(), other.data() + size, first, last));
+    EXPECT_EQ(::portable_stl::lexicographical_compare(seq, first, last, other.data(), other.data() + size),
+              ::portable_stl::lexicographical_compare(par, first, last, other.data(), other.data() + size));
+
+    parallel   = source;
+    sequential = source;
+    auto const parallel_end{::portable_stl::remove_if(par, parallel.data(), parallel.data() + size, is_odd)};
+    auto const sequential_end{::portable_stl::remove_if(seq, sequential.data(), sequential.data() + size, is_odd)};
+    ASSERT_EQ(sequential_end - sequential.data(), parallel_end - parallel.data());
+    EXPECT_TRUE(std::equal(sequential.data(), sequential_end, parallel.data()));
+
+    parallel   = source;
+    sequential = source;
+    ::portable_stl::sort(par, parallel.data(), parallel.data() + size, std::greater<std::int32_t>{});
+    ::portable_stl::sort(seq, sequential.data(), sequential.data() + size, std::greater<std::int32_t>{});
+    EXPECT_EQ(sequential, parallel);
+
+    EXPECT_EQ(::portable_stl::reduce(seq, first, last, std::int64_t{round}),
+              ::portable_stl::reduce(par, first, last, std::int64_t{round}));
+  }
+}
+#endif
+
+TEST(execution, copy_fill_n_transform) {
+  static_cast<void>(test_info_);
+
+  auto const source = test_execution_helper::random_values(test_execution_helper::large_size);
+
+  test_execution_helper::counting_executor exec;
+  std::vector<std::int32_t>                target(source.size(), 0);
+  EXPECT_EQ(target.data() + target.size(),
+            ::portable_stl::copy(
+              ::portable_stl::execution::par.on(exec), source.data(), source.data() + source.size(), target.data()));
+  EXPECT_EQ(source, target);
+  EXPECT_EQ(1U, exec.m_calls);
+  EXPECT_EQ(16U, exec.m_tasks);
+
+  EXPECT_EQ(target.data() + 200000,
+            ::portable_stl::fill_n(::portable_stl::execution::par_unseq.on(exec), target.data(), 200000, 7));
+  EXPECT_EQ(200000, std::count(target.begin(), target.end(), 7));
+  EXPECT_EQ(source[200000], target[200000]);
+  EXPECT_EQ(target.data(), ::portable_stl::fill_n(::portable_stl::execution::par, target.data(), -1, 0));
+
+  auto const twice = [](std::int32_t value) {
+    return value * 2;
+  };
+  EXPECT_EQ(target.data() + target.size(),
+            ::portable_stl::transform(::portable_stl::execution::par.on(exec),
+                                      source.data(),
+                                      source.data() + source.size(),
+                                      target.data(),
+                                      twice));
+  for (::portable_stl::size_t i{0U}; i < source.size(); i += 997U) {
+    ASSERT_EQ(source[i] * 2, target[i]);
+  }
+  std::vector<std::int32_t> sums(source.size(), 0);
+  ::portable_stl::transform(::portable_stl::execution::par,
+                            source.data(),
+                            source.data() + source.size(),
+                            target.data(),
+                            sums.data(),
+                            std::plus<std::int32_t>{});
+  for (::portable_stl::size_t i{0U}; i < source.size(); i += 997U) {
+    ASSERT_EQ(source[i] * 3, sums[i]);
+  }
+
+  // the sequential policy and the short ranges do not use the executor
+  exec.m_calls = 0U;
+  std::vector<std::int32_t> short_target(100, 0);
+  ::portable_stl::copy(
+    ::portable_stl::execution::par.on(exec), source.data(), source.data() + 100, short_target.data());
+  ::portable_stl::copy(::portable_stl::execution::seq, source.data(), source.data() + 100, short_target.data());
+  EXPECT_EQ(0U, exec.m_calls);
+  EXPECT_TRUE(std::equal(short_target.begin(), short_target.end(), source.begin()));
+
+  // not random access iterators
+  using t_iter = test_iterator_helper::tst_input_iterator<std::int32_t const *>;
+  std::int32_t const values[]{1, 2, 3};
+  std::int32_t       result[3]{};
+  ::portable_stl::copy(::portable_stl::execution::par, t_iter(values), t_iter(values + 3), result);
+  EXPECT_EQ(3, result[2]);
+  ::portable_stl::transform(::portable_stl::execution::par, t_iter(values), t_iter(values + 3), result, twice);
+  EXPECT_EQ(6, result[2]);
+}
+
+TEST(execution, find_equal_lexicographical_compare) {
+  static_cast<void>(test_info_);
+
+  std::vector<std::int32_t> values(test_execution_helper::large_size, 0);
+  std::iota(values.begin(), values.end(), 0);
+  std::int32_t const *const first{values.data()};
+  std::int32_t const *const last{values.data() + values.size()};
+
+  test_execution_helper::counting_executor exec;
+  auto const                               policy = ::portable_stl::execution::par.on(exec);
+  EXPECT_EQ(first + 123456, ::portable_stl::find(policy, first, last, 123456));
+  EXPECT_EQ(first, ::portable_stl::find(policy, first, last, 0));
+  EXPECT_EQ(last - 1, ::portable_stl::find(policy, first, last, test_execution_helper::large_size - 1));
+  EXPECT_EQ(last, ::portable_stl::find(policy, first, last, -1));
+  EXPECT_EQ(first + 5, ::portable_stl::find(::portable_stl::execution::par, first, last, 5));
+
+  // the first of the equal elements is found though the later chunks run first
+  values[200000] = 50000;
+  EXPECT_EQ(first + 50000, ::portable_stl::find(policy, first, last, 50000));
+
+  std::vector<std::int32_t> other(values);
+  EXPECT_TRUE(::portable_stl::equal(policy, first, last, other.data()));
+  EXPECT_TRUE(::portable_stl::equal(policy, first, last, other.data(), other.data() + other.size()));
+  EXPECT_FALSE(::portable_stl::equal(policy, first, last, other.data(), other.data() + other.size() - 1));
+  other[250000] = -1;
+  EXPECT_FALSE(::portable_stl::equal(policy, first, last, other.data()));
+  EXPECT_TRUE(::portable_stl::equal(
+    ::portable_stl::execution::par, first, last, other.data(), [](std::int32_t lhv, std::int32_t rhv) {
+      return (lhv == rhv) || (rhv < 0);
+    }));
+
+  EXPECT_TRUE(::portable_stl::lexicographical_compare(policy, other.data(), other.data() + other.size(), first, last));
+  EXPECT_FALSE(::portable_stl::lexicographical_compare(policy, first, last, other.data(), other.data() + other.size()));
+  EXPECT_FALSE(::portable_stl::lexicographical_compare(policy, first, last, first, last));
+  EXPECT_TRUE(::portable_stl::lexicographical_compare(policy, first, last - 1, first, last));
+  EXPECT_TRUE(::portable_stl::lexicographical_compare(
+    policy, first, last, other.data(), other.data() + other.size(), std::greater<std::int32_t>{}));
+
+  // not random access iterators
+  using t_iter = test_iterator_helper::tst_forward_iterator<std::int32_t const *>;
+  EXPECT_EQ(first + 7, ::portable_stl::find(::portable_stl::execution::par, t_iter(first), t_iter(last), 7).base());
+  EXPECT_TRUE(::portable_stl::equal(::portable_stl::execution::par, t_iter(first), t_iter(first + 9), t_iter(first)));
+  EXPECT_TRUE(::portable_stl::lexicographical_compare(
+    ::portable_stl::execution::par, t_iter(first), t_iter(first + 9), t_iter(first), t_iter(first + 10)));
+}
+
+TEST(execution, remove_if_sort_reduce) {
+  static_cast<void>(test_info_);
+
+  auto const source = test_execution_helper::random_values(test_execution_helper::large_size);
+  auto const is_odd = [](std::int32_t value) {
+    return 0 != (value % 2);
+  };
+
+  test_execution_helper::counting_executor exec;
+  for (auto const &policy : {::portable_stl::execution::par.on(exec), ::portable_stl::execution::par}) {
+    auto       removed = source;
+    auto const end = ::portable_stl::remove_if(policy, removed.data(), removed.data() + removed.size(), is_odd);
+    auto       expected_removed = source;
+    expected_removed.erase(std::remove_if(expected_removed.begin(), expected_removed.end(), is_odd),
+                           expected_removed.end());
+    ASSERT_EQ(expected_removed.size(), static_cast<::portable_stl::size_t>(end - removed.data()));
+    EXPECT_TRUE(std::equal(expected_removed.begin(), expected_removed.end(), removed.begin()));
+
+    auto sorted = source;
+    ::portable_stl::sort(policy, sorted.data(), sorted.data() + sorted.size());
+    auto expected_sorted = source;
+    std::sort(expected_sorted.begin(), expected_sorted.end());
+    EXPECT_EQ(expected_sorted, sorted);
+
+    ::portable_stl::sort(policy, sorted.data(), sorted.data() + sorted.size(), std::greater<std::int32_t>{});
+    EXPECT_TRUE(std::equal(expected_sorted.rbegin(), expected_sorted.rend(), sorted.begin()));
+
+    std::int64_t const expected_sum{std::accumulate(source.begin(), source.end(), std::int64_t{10})};
+    EXPECT_EQ(expected_sum,
+              ::portable_stl::reduce(policy, source.data(), source.data() + source.size(), std::int64_t{10}));
+    EXPECT_EQ(*std::max_element(source.begin(), source.end()),
+              ::portable_stl::reduce(policy,
+                                     source.data(),
+                                     source.data() + source.size(),
+                                     0,
+                                     [](std::int32_t lhv, std::int32_t rhv) {
+                                       return (lhv < rhv) ? rhv : lhv;
+                                     }));
+  }
+
+  // 2, 3, ... 16 chunks: the merge rounds with the unpaired runs
+  for (std::int32_t chunks{2}; chunks <= 16; ++chunks) {
+    auto sorted = test_execution_helper::random_values(
+      chunks * static_cast<std::int32_t>(::portable_stl::execution_helper::parallel_min_chunk));
+    ::portable_stl::sort(::portable_stl::execution::par.on(exec), sorted.data(), sorted.data() + sorted.size());
+    ASSERT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+  }
+
+  std::vector<double> const doubles(test_execution_helper::large_size, 0.5);
+  EXPECT_EQ(0.5 * test_execution_helper::large_size,
+            ::portable_stl::reduce(
+              ::portable_stl::execution::par_unseq, doubles.data(), doubles.data() + doubles.size()));
+  EXPECT_EQ(0, ::portable_stl::reduce(::portable_stl::execution::seq, doubles.data(), doubles.data()));
+}
@@ -132,6 +132,25 @@ TEST(list, assign_iter_iter) {
   }
 }
 
+TEST(list, assign_reuse_nodes) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::list<std::int32_t> lst{1, 2, 3, 4};
+  std::int32_t const                *first_node  = &lst.front();
+  std::int32_t const                *second_node = &*::portable_stl::next(lst.begin());
+
+  std::int32_t const src[]{5, 6, 7};
+  ASSERT_TRUE(lst.assign(src, src + 3));
+  ASSERT_EQ(first_node, &lst.front());
+  ASSERT_EQ(second_node, &*::portable_stl::next(lst.begin()));
+  ASSERT_EQ(5, lst.front());
+
+  ASSERT_TRUE(lst.assign(6, 8));
+  ASSERT_EQ(first_node, &lst.front());
+  ASSERT_EQ(second_node, &*::portable_stl::next(lst.begin()));
+  ASSERT_EQ(8, *::portable_stl::next(lst.begin(), 5));
+}
+
 TEST(list, assign_init_list) {
   static_cast<void>(test_info_);
 
@@ -17,6 +17,7 @@
 // #include "portable_stl/iterator/move_iterator.h"
 #include <algorithm>
 #include <random>
+#include <vector>
 
 #include "portable_stl/list/list.h"
 #include "portable_stl/vector/vector.h"
@@ -1187,6 +1188,87 @@ TEST(list, sort) {
   }
 }
 
+TEST(list, sort_large) {
+  static_cast<void>(test_info_);
+
+  using t_list = ::portable_stl::list<std::int32_t>;
+
+  constexpr std::int32_t num{5000};
+
+  std::vector<std::int32_t> values;
+  for (std::int32_t i{0}; i < num; ++i) {
+    values.push_back(i);
+  }
+  std::vector<std::int32_t> shuffled(values);
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937());
+
+  // random and sorted input, both in ascending and descending order
+  std::vector<std::int32_t> const *sources[]{&shuffled, &values};
+  for (auto const *source : sources) {
+    {
+      t_list lst(source->data(), source->data() + num);
+      lst.sort();
+      ASSERT_TRUE(std::equal(values.begin(), values.end(), lst.begin()));
+    }
+    {
+      t_list lst(source->data(), source->data() + num);
+      lst.sort(std::greater<std::int32_t>());
+      ASSERT_TRUE(std::equal(values.rbegin(), values.rend(), lst.begin()));
+    }
+  }
+
+  for (std::int32_t i : {1000, 1023, 1024, 1025}) {
+    test_list_helper::test_stable(i);
+  }
+}
+
+TEST(list, sort_comp_throws) {
+  static_cast<void>(test_info_);
+
+  constexpr std::int32_t num{100};
+
+  std::vector<std::int32_t> values;
+  for (std::int32_t i{0}; i < num; ++i) {
+    values.push_back(i);
+  }
+  std::shuffle(values.begin(), values.end(), std::mt19937());
+
+  for (std::int32_t throw_after : {0, 1, 7, 50, 99, 300}) {
+    ::portable_stl::list<std::int32_t> lst(values.data(), values.data() + num);
+
+    std::int32_t calls{0};
+    try {
+      lst.sort([&calls, throw_after](std::int32_t left, std::int32_t right) {
+        if (calls++ == throw_after) {
+          throw std::int32_t{0};
+        }
+        return left < right;
+      });
+      ASSERT_TRUE(false);
+    } catch (std::int32_t) {
+    }
+
+    // all elements are still in the list
+    ASSERT_EQ(static_cast<std::size_t>(num), lst.size());
+    std::vector<std::int32_t> content;
+    for (auto value : lst) {
+      content.push_back(value);
+    }
+    ASSERT_EQ(values.size(), content.size());
+    ASSERT_TRUE(std::is_permutation(values.begin(), values.end(), content.begin()));
+
+    // the links in both directions are valid
+    std::int32_t count_backward{0};
+    for (auto iter = lst.end(); iter != lst.begin(); --iter) {
+      ++count_backward;
+    }
+    ASSERT_EQ(num, count_backward);
+
+    lst.sort();
+    ASSERT_TRUE(std::is_sorted(lst.begin(), lst.end()));
+  }
+}
+
 // template <class Compare> sort(Compare comp);
 TEST(list, sort_comp) {
   static_cast<void>(test_info_);
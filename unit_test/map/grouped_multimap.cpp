@@ -0,0 +1,199 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="grouped_multimap.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <portable_stl/map/grouped_multimap.h>
+
+#include "../common/test_allocator.h"
+
+namespace test_grouped_multimap_helper {
+/**
+ * @brief Container alias.
+ */
+using t_grouped = ::portable_stl::grouped_multimap<std::int32_t, std::int32_t>;
+
+/**
+ * @brief Allocator with statistics.
+ */
+using t_allocator = test_allocator_helper::test_allocator<::portable_stl::tuple<std::int32_t const, std::int32_t>>;
+
+/**
+ * @brief Container with statistics alias.
+ */
+using t_grouped_stat
+  = ::portable_stl::grouped_multimap<std::int32_t, std::int32_t, ::portable_stl::less<std::int32_t>, t_allocator>;
+} // namespace test_grouped_multimap_helper
+
+TEST(grouped_multimap, insert_lookup) {
+  static_cast<void>(test_info_);
+
+  test_grouped_multimap_helper::t_grouped mmap;
+  EXPECT_TRUE(mmap.empty());
+
+  for (std::int32_t i{0}; i < 100; ++i) {
+    auto result = mmap.insert(i % 3, i);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(i, *result.value());
+  }
+  EXPECT_EQ(100, mmap.size());
+  EXPECT_EQ(3, mmap.key_count());
+  EXPECT_EQ(34, mmap.count(0));
+  EXPECT_EQ(33, mmap.count(2));
+  EXPECT_EQ(0, mmap.count(3));
+  EXPECT_TRUE(mmap.contains(1));
+  EXPECT_FALSE(mmap.contains(-1));
+
+  // the values of the key are contiguous and in insertion order
+  auto range = mmap.equal_range(1);
+  ASSERT_EQ(33, ::portable_stl::get<1>(range) - ::portable_stl::get<0>(range));
+  std::int32_t const *data{&*::portable_stl::get<0>(range)};
+  for (std::int32_t i{0}; i < 33; ++i) {
+    EXPECT_EQ(i * 3 + 1, data[i]);
+  }
+
+  auto const &cmmap       = mmap;
+  auto        empty_range = cmmap.equal_range(5);
+  EXPECT_EQ(::portable_stl::get<0>(empty_range), ::portable_stl::get<1>(empty_range));
+
+  // groups are ordered by key
+  std::int32_t expected_key{0};
+  for (auto const &group : cmmap) {
+    EXPECT_EQ(expected_key, ::portable_stl::get<0>(group));
+    ++expected_key;
+  }
+  EXPECT_EQ(3, expected_key);
+  EXPECT_EQ(2, ::portable_stl::get<0>(*cmmap.find(2)));
+  EXPECT_EQ(cmmap.end(), cmmap.find(7));
+
+  // the groups are read-only even through the non-constant container
+  static_assert(std::is_const<std::remove_reference_t<decltype(::portable_stl::get<1>(*mmap.begin()))>>{}(),
+                "the values of a group must not be resized through the group iterator");
+  static_assert(std::is_const<std::remove_reference_t<decltype(::portable_stl::get<1>(*mmap.find(1)))>>{}(),
+                "the values of a group must not be resized through the group iterator");
+
+  std::int32_t const values[] = {7, 8, 9};
+  ASSERT_TRUE(mmap.insert(5, values, values + 3));
+  EXPECT_EQ(3, mmap.count(5));
+  EXPECT_EQ(103, mmap.size());
+
+  auto emplace_result = mmap.emplace(5, 10);
+  ASSERT_TRUE(emplace_result);
+  EXPECT_EQ(10, *emplace_result.value());
+}
+
+TEST(grouped_multimap, erase) {
+  static_cast<void>(test_info_);
+
+  test_grouped_multimap_helper::t_grouped mmap;
+  for (std::int32_t i{0}; i < 10; ++i) {
+    ASSERT_TRUE(mmap.insert(1, i % 4));
+    ASSERT_TRUE(mmap.insert(2, i));
+  }
+
+  EXPECT_EQ(3, mmap.erase(1, 0));
+  EXPECT_EQ(0, mmap.erase(1, 0));
+  EXPECT_EQ(7, mmap.count(1));
+  std::int32_t const expected_values[] = {1, 2, 3, 1, 2, 3, 1};
+  auto               range             = mmap.equal_range(1);
+  for (std::int32_t i{0}; i < 7; ++i) {
+    EXPECT_EQ(expected_values[i], ::portable_stl::get<0>(range)[i]);
+  }
+
+  EXPECT_EQ(10, mmap.erase(2));
+  EXPECT_EQ(0, mmap.erase(2));
+  EXPECT_FALSE(mmap.contains(2));
+  EXPECT_EQ(7, mmap.size());
+
+  // the key is removed with its last value
+  ASSERT_TRUE(mmap.insert(3, 5));
+  EXPECT_EQ(1, mmap.erase(3, 5));
+  EXPECT_FALSE(mmap.contains(3));
+  EXPECT_EQ(1, mmap.key_count());
+
+  EXPECT_EQ(mmap.end(), mmap.erase(mmap.begin()));
+  EXPECT_TRUE(mmap.empty());
+  EXPECT_EQ(0, mmap.key_count());
+}
+
+TEST(grouped_multimap, copy_swap) {
+  static_cast<void>(test_info_);
+
+  test_grouped_multimap_helper::t_grouped mmap;
+  ASSERT_TRUE(mmap.insert(1, 1));
+  ASSERT_TRUE(mmap.insert(1, 2));
+
+  test_grouped_multimap_helper::t_grouped mmap_copy{mmap};
+  EXPECT_EQ(2, mmap_copy.size());
+  EXPECT_EQ(2, mmap_copy.count(1));
+
+  test_grouped_multimap_helper::t_grouped mmap_other;
+  ASSERT_TRUE(mmap_other.insert(2, 1));
+  ::portable_stl::swap(mmap_copy, mmap_other);
+  EXPECT_EQ(1, mmap_copy.size());
+  EXPECT_TRUE(mmap_copy.contains(2));
+  EXPECT_EQ(2, mmap_other.size());
+
+  test_grouped_multimap_helper::t_grouped mmap_move{std::move(mmap_other)};
+  EXPECT_EQ(2, mmap_move.count(1));
+
+  mmap_move.clear();
+  EXPECT_TRUE(mmap_move.empty());
+  EXPECT_EQ(0, mmap_move.key_count());
+}
+
+TEST(grouped_multimap, memory) {
+  static_cast<void>(test_info_);
+
+  test_allocator_helper::test_allocator_statistics alloc_stats;
+  {
+    test_grouped_multimap_helper::t_grouped_stat mmap{::portable_stl::less<std::int32_t>{},
+                                                      test_grouped_multimap_helper::t_allocator(&alloc_stats)};
+
+    // no storage is reserved for an absent key, the empty key is not added
+    auto reserve_result = mmap.reserve(1, 1000);
+    ASSERT_FALSE(reserve_result);
+    EXPECT_EQ(::portable_stl::portable_stl_error::not_exists, reserve_result.error());
+    EXPECT_FALSE(mmap.contains(1));
+    EXPECT_EQ(0, mmap.key_count());
+    EXPECT_EQ(mmap.end(), mmap.begin());
+    EXPECT_EQ(0, alloc_stats.m_alloc_count);
+
+    // one node and one values block per key instead of one node per value
+    ASSERT_TRUE(mmap.insert(1, 0));
+    ASSERT_TRUE(mmap.reserve(1, 1000));
+    for (std::int32_t i{1}; i < 1000; ++i) {
+      ASSERT_TRUE(mmap.insert(1, i));
+    }
+    EXPECT_EQ(2, alloc_stats.m_alloc_count);
+    EXPECT_EQ(1000, mmap.count(1));
+
+    // failed allocation of the node
+    alloc_stats.m_throw_after = alloc_stats.m_time_to_throw;
+    auto result               = mmap.insert(2, 1);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+    alloc_stats.m_throw_after = ::portable_stl::numeric_limits_helper::int_max_constant;
+
+    // failed allocation of the values, the empty key is not left behind
+    ASSERT_TRUE(mmap.insert(3, 1));
+    alloc_stats.m_throw_after = alloc_stats.m_time_to_throw + 1U;
+    result                    = mmap.insert(2, 1);
+    ASSERT_FALSE(result);
+    alloc_stats.m_throw_after = ::portable_stl::numeric_limits_helper::int_max_constant;
+    EXPECT_FALSE(mmap.contains(2));
+    EXPECT_EQ(2, mmap.key_count());
+    EXPECT_EQ(1001, mmap.size());
+  }
+  EXPECT_EQ(0, alloc_stats.m_alloc_count);
+}
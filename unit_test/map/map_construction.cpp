@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <portable_stl/map/map.h>
+#include <vector>
 
 #include "../common/counter.h"
 #include "../common/move_only.h"
@@ -391,6 +392,88 @@ TEST(map, make_map_iter_iter_comp_alloc) {
   }
 }
 
+TEST(map, constructor_sorted_unique) {
+  static_cast<void>(test_info_);
+
+  {
+    std::vector<t_map_value_type> values;
+    for (std::int32_t i{0}; i < 1000; ++i) {
+      values.emplace_back(i, 0.5 * i);
+    }
+
+    ::portable_stl::map<std::int32_t, double> mp(::portable_stl::sorted_unique_t{}, values.begin(), values.end());
+
+    ASSERT_EQ(1000, mp.size());
+    ASSERT_EQ(1000, ::portable_stl::distance(mp.begin(), mp.end()));
+    std::int32_t key{0};
+    for (auto const &item : mp) {
+      EXPECT_EQ(t_map_value_type(key, 0.5 * key), item);
+      ++key;
+    }
+    EXPECT_EQ(t_map_value_type(500, 250), *mp.find(500));
+    EXPECT_TRUE(::portable_stl::get<1>(mp.insert(t_map_value_type(-1, 0)).value()));
+    EXPECT_EQ(t_map_value_type(-1, 0), *mp.begin());
+  }
+
+  // empty range
+  {
+    ::portable_stl::map<std::int32_t, double, t_compare> mp(
+      ::portable_stl::sorted_unique_t{}, test_map_helper::arr, test_map_helper::arr, t_compare(3));
+    ASSERT_TRUE(mp.empty());
+    ASSERT_EQ(t_compare(3), mp.key_comp());
+    ASSERT_EQ(mp.begin(), mp.end());
+  }
+
+  // bad alloc
+  {
+    t_tree_allocator_const_key::m_counter_ok_allocation = 1;
+
+    try {
+      ::portable_stl::map<std::int32_t const, double, ::portable_stl::less<std::int32_t>, t_allocator> mp(
+        ::portable_stl::sorted_unique_t{},
+        test_map_helper::arr,
+        test_map_helper::arr_end,
+        ::portable_stl::less<std::int32_t>(),
+        t_allocator());
+      ASSERT_TRUE(false);
+    } catch (::portable_stl::bad_alloc<> &) {
+    }
+
+    t_tree_allocator_const_key::m_counter_ok_allocation = 10000;
+  }
+}
+
+TEST(map, make_map_sorted_unique) {
+  static_cast<void>(test_info_);
+
+  {
+    auto result = ::portable_stl::map<std::int32_t, double, t_compare>::make_map(
+      ::portable_stl::sorted_unique_t{}, test_map_helper::arr, test_map_helper::arr_end, t_compare(3));
+    ASSERT_TRUE(result);
+
+    auto mp = result.value();
+    ASSERT_EQ(3, mp.size());
+    ASSERT_EQ(t_compare(3), mp.key_comp());
+    EXPECT_EQ(t_map_value_type(1, 1), *mp.begin());
+    EXPECT_EQ(t_map_value_type(2, 1), *::portable_stl::next(mp.begin()));
+    EXPECT_EQ(t_map_value_type(3, 1), *::portable_stl::next(mp.begin(), 2));
+  }
+
+  // bad alloc
+  {
+    t_tree_allocator_const_key::m_counter_ok_allocation = 1;
+
+    auto result
+      = ::portable_stl::map<std::int32_t const, double, ::portable_stl::less<std::int32_t>, t_allocator>::make_map(
+        ::portable_stl::sorted_unique_t{}, test_map_helper::arr, test_map_helper::arr_end);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+
+    t_tree_allocator_const_key::m_counter_ok_allocation = 10000;
+  }
+}
+
 TEST(map, constructor_copy) {
   static_cast<void>(test_info_);
 
@@ -1299,3 +1382,150 @@ TEST(map, assign_initializer_list) {
     ASSERT_EQ(0, alloc_stats.m_alloc_count);
   }
 }
+
+TEST(map, copy_assign_reuse_nodes) {
+  static_cast<void>(test_info_);
+
+  test_allocator_helper::test_allocator_statistics alloc_stats;
+  {
+    using t_map_stat = ::portable_stl::map<std::int32_t, double, t_compare, t_allocator2>;
+
+    t_map_stat mp{t_compare(), t_allocator2(&alloc_stats)};
+    t_map_stat mp_small{t_compare(), t_allocator2(&alloc_stats)};
+    t_map_stat mp_large{t_compare(), t_allocator2(&alloc_stats)};
+    for (std::int32_t i{0}; i < 100; ++i) {
+      ASSERT_TRUE(mp.insert(t_map_value_type(i, i)));
+    }
+    for (std::int32_t i{0}; i < 60; ++i) {
+      ASSERT_TRUE(mp_small.insert(t_map_value_type(i * 2, 0.5)));
+    }
+    for (std::int32_t i{0}; i < 150; ++i) {
+      ASSERT_TRUE(mp_large.insert(t_map_value_type(i * 3, 1.5)));
+    }
+
+    std::vector<void const *> nodes;
+    for (auto const &item : mp) {
+      nodes.push_back(&item);
+    }
+    std::sort(nodes.begin(), nodes.end());
+
+    // the nodes of mp are reused, 40 of them are freed
+    std::uint32_t const alloc_count{alloc_stats.m_alloc_count};
+    mp = mp_small;
+    ASSERT_EQ(alloc_count - 40U, alloc_stats.m_alloc_count);
+    ASSERT_EQ(60, mp.size());
+    std::int32_t key{0};
+    for (auto const &item : mp) {
+      ASSERT_EQ(t_map_value_type(key, 0.5), item);
+      ASSERT_TRUE(std::binary_search(nodes.begin(), nodes.end(), static_cast<void const *>(&item)));
+      key += 2;
+    }
+
+    // only the missing nodes are allocated
+    mp = mp_large;
+    ASSERT_EQ(alloc_count + 50U, alloc_stats.m_alloc_count);
+    ASSERT_EQ(150, mp.size());
+    ASSERT_TRUE(mp == mp_large);
+    ASSERT_EQ(mp.end(), mp.find(1));
+    ASSERT_NE(mp.end(), mp.find(447));
+
+    // reuse by assign_unique
+    mp = {t_map_value_type(5, 1), t_map_value_type(3, 1), t_map_value_type(5, 2)};
+    ASSERT_EQ(alloc_count - 98U, alloc_stats.m_alloc_count);
+    ASSERT_EQ(2, mp.size());
+  }
+  ASSERT_EQ(0, alloc_stats.m_alloc_count);
+}
+
+namespace test_map_helper {
+/**
+ * @brief Statistics of bulk_allocator.
+ */
+class bulk_statistics final {
+public:
+  /**
+   * @brief The number of allocated and not yet deallocated storages.
+   */
+  std::int32_t m_alloc_count{0};
+  /**
+   * @brief The number of deallocate_bulk calls.
+   */
+  std::int32_t m_bulk_count{0};
+};
+
+/**
+ * @brief Allocator with deallocate_bulk member function.
+ * @tparam t_type the value type.
+ */
+template<class t_type> class bulk_allocator final {
+  template<class t_other_type> friend class bulk_allocator;
+
+  bulk_statistics *m_stats;
+
+public:
+  using value_type = t_type;
+  using size_type  = ::portable_stl::size_t;
+
+  explicit bulk_allocator(bulk_statistics *stats) noexcept : m_stats(stats) {
+  }
+
+  template<class t_other_type>
+  bulk_allocator(bulk_allocator<t_other_type> const &other) noexcept : m_stats(other.m_stats) {
+  }
+
+  t_type *allocate(size_type num) {
+    ++m_stats->m_alloc_count;
+    return static_cast<t_type *>(::operator new(num * sizeof(t_type)));
+  }
+
+  void deallocate(t_type *ptr, size_type) noexcept {
+    --m_stats->m_alloc_count;
+    ::operator delete(ptr);
+  }
+
+  void deallocate_bulk(t_type *const *ptrs, size_type count, size_type) noexcept {
+    ++m_stats->m_bulk_count;
+    for (size_type i{0U}; i < count; ++i) {
+      --m_stats->m_alloc_count;
+      ::operator delete(ptrs[i]);
+    }
+  }
+
+  friend bool operator==(bulk_allocator const &lhv, bulk_allocator const &rhv) noexcept {
+    return lhv.m_stats == rhv.m_stats;
+  }
+
+  friend bool operator!=(bulk_allocator const &lhv, bulk_allocator const &rhv) noexcept {
+    return !(lhv == rhv);
+  }
+};
+} // namespace test_map_helper
+
+TEST(map, destroy_bulk_deallocate) {
+  static_cast<void>(test_info_);
+
+  using t_map_value_type = ::portable_stl::tuple<std::int32_t const, std::int32_t>;
+  using t_allocator      = test_map_helper::bulk_allocator<t_map_value_type>;
+  using t_map            = ::portable_stl::map<std::int32_t, std::int32_t, std::less<std::int32_t>, t_allocator>;
+
+  test_map_helper::bulk_statistics stats;
+  {
+    t_map mp{std::less<std::int32_t>(), t_allocator(&stats)};
+    // ascending inserts give the deepest left spine for the teardown
+    for (std::int32_t i{0}; i < 1000; ++i) {
+      ASSERT_TRUE(mp.emplace(i, i));
+    }
+    ASSERT_EQ(1000, stats.m_alloc_count);
+
+    mp.clear();
+    ASSERT_EQ(0, stats.m_alloc_count);
+    // 1000 nodes are released in batches of 64
+    ASSERT_EQ(16, stats.m_bulk_count);
+
+    for (std::int32_t i{0}; i < 10; ++i) {
+      ASSERT_TRUE(mp.emplace(i, i));
+    }
+  }
+  ASSERT_EQ(0, stats.m_alloc_count);
+  ASSERT_EQ(17, stats.m_bulk_count);
+}
@@ -825,3 +825,101 @@ TEST(map, equal_range_transparent) {
     ASSERT_EQ(3, nels);
   }
 }
+
+TEST(map, nth_rank) {
+  static_cast<void>(test_info_);
+
+  /**
+   * @brief Map with order statistics.
+   */
+  using t_rank_map = ::portable_stl::
+    map<std::int32_t, double, ::portable_stl::less<std::int32_t>, t_allocator2, ::portable_stl::tree_rank_node_policy>;
+
+  t_rank_map mp;
+  for (std::int32_t i{0}; i < 100; ++i) {
+    ASSERT_TRUE(mp.insert(t_map_value_type((i * 37) % 100, i)));
+  }
+
+  t_rank_map const &cmp = mp;
+  for (std::int32_t i{0}; i < 100; ++i) {
+    ASSERT_EQ(i, ::portable_stl::get<0>(*mp.nth(static_cast<std::size_t>(i))));
+    ASSERT_EQ(i, ::portable_stl::get<0>(*cmp.nth(static_cast<std::size_t>(i))));
+    ASSERT_EQ(i, mp.rank(i));
+  }
+  ASSERT_EQ(mp.end(), mp.nth(100));
+  ASSERT_EQ(cmp.end(), cmp.nth(1000));
+  ASSERT_EQ(100, mp.rank(1000));
+  ASSERT_EQ(0, mp.rank(-1));
+
+  // erase even keys
+  for (std::int32_t i{0}; i < 100; i += 2) {
+    ASSERT_EQ(1, mp.erase(i));
+  }
+  for (std::int32_t i{0}; i < 50; ++i) {
+    ASSERT_EQ(2 * i + 1, ::portable_stl::get<0>(*mp.nth(static_cast<std::size_t>(i))));
+    ASSERT_EQ(i, mp.rank(2 * i + 1));
+    ASSERT_EQ(i, mp.rank(2 * i));
+  }
+  ASSERT_EQ(mp.end(), mp.nth(50));
+
+  // copy keeps the order statistics
+  t_rank_map mp_copy(mp);
+  ASSERT_EQ(25, ::portable_stl::get<0>(*mp_copy.nth(12)));
+  ASSERT_EQ(12, mp_copy.rank(25));
+}
+
+TEST(map, find_many) {
+  static_cast<void>(test_info_);
+
+  t_map mp;
+  // odd keys only, so every even key is a miss
+  for (std::int32_t i{0}; i < 500; ++i) {
+    ASSERT_TRUE(mp.insert(t_map_value_type(2 * ((i * 263) % 500) + 1, i)));
+  }
+  t_map const &cmp = mp;
+
+  // sorted keys, finger search
+  {
+    std::int32_t keys[1003];
+    for (std::int32_t i{0}; i < 1003; ++i) {
+      keys[i] = i - 1;
+    }
+    t_map::iterator       found[1003];
+    t_map::const_iterator bounds[1003];
+    bool                  contained[1003];
+    ASSERT_EQ(found + 1003, mp.find_many(keys, keys + 1003, found));
+    ASSERT_EQ(bounds + 1003, cmp.lower_bound_many(keys, keys + 1003, bounds));
+    ASSERT_EQ(contained + 1003, cmp.contains_many(keys, keys + 1003, contained));
+    for (std::int32_t i{0}; i < 1003; ++i) {
+      ASSERT_EQ(mp.find(keys[i]), found[i]);
+      ASSERT_EQ(cmp.lower_bound(keys[i]), bounds[i]);
+      ASSERT_EQ(mp.contains(keys[i]), contained[i]);
+    }
+  }
+
+  // unsorted keys with repeats and partially sorted runs, interleaved descents
+  {
+    std::int32_t keys[1000];
+    for (std::int32_t i{0}; i < 1000; ++i) {
+      keys[i] = (i < 500) ? ((i * 389) % 1100 - 50) : (i / 3);
+    }
+    t_map::const_iterator found[1000];
+    t_map::iterator       bounds[1000];
+    ASSERT_EQ(found + 1000, cmp.find_many(keys, keys + 1000, found));
+    ASSERT_EQ(bounds + 1000, mp.lower_bound_many(keys, keys + 1000, bounds));
+    for (std::int32_t i{0}; i < 1000; ++i) {
+      ASSERT_EQ(cmp.find(keys[i]), found[i]);
+      ASSERT_EQ(mp.lower_bound(keys[i]), bounds[i]);
+    }
+  }
+
+  // empty map and empty batch
+  {
+    t_map              empty_map;
+    std::int32_t const keys[]{3, 1, 2};
+    bool               contained[3]{true, true, true};
+    ASSERT_EQ(contained + 3, empty_map.contains_many(keys, keys + 3, contained));
+    ASSERT_FALSE(contained[0] || contained[1] || contained[2]);
+    ASSERT_EQ(contained, mp.contains_many(keys, keys, contained));
+  }
+}
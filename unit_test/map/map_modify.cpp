@@ -12,6 +12,8 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <iterator>
+#include <vector>
 #include <portable_stl/map/map.h>
 #include <portable_stl/ranges/begin.h>
 #include <portable_stl/ranges/end.h>
@@ -1262,3 +1264,268 @@ TEST(map, try_emplace3) {
     ASSERT_EQ(::portable_stl::get<1>(*iter).get(), 4); // value
   }
 }
+
+TEST(map, split_join) {
+  static_cast<void>(test_info_);
+
+  {
+    t_map mp;
+    for (std::int32_t i{0}; i < 100; ++i) {
+      ASSERT_TRUE(mp.insert(t_map_value_type((i * 37) % 100, i)));
+    }
+    auto       iter  = mp.find(70);
+    auto const value = &::portable_stl::get<1>(*iter);
+
+    t_map right = mp.split(40);
+    ASSERT_EQ(40, mp.size());
+    ASSERT_EQ(60, right.size());
+    ASSERT_EQ(0, ::portable_stl::get<0>(*mp.begin()));
+    ASSERT_EQ(39, ::portable_stl::get<0>(*::portable_stl::prev(mp.end())));
+    ASSERT_EQ(40, ::portable_stl::get<0>(*right.begin()));
+    ASSERT_EQ(99, ::portable_stl::get<0>(*::portable_stl::prev(right.end())));
+    // no node is reallocated
+    ASSERT_EQ(value, &::portable_stl::get<1>(*right.find(70)));
+    ASSERT_EQ(iter, right.find(70));
+    ASSERT_EQ(mp.end(), mp.find(70));
+
+    // join in any order
+    right.join(mp);
+    ASSERT_TRUE(mp.empty());
+    ASSERT_EQ(100, right.size());
+    std::int32_t expected_key{0};
+    for (auto const &item : right) {
+      ASSERT_EQ(expected_key, ::portable_stl::get<0>(item));
+      ++expected_key;
+    }
+    ASSERT_EQ(value, &::portable_stl::get<1>(*right.find(70)));
+
+    // split at the ends
+    t_map all = right.split(-1);
+    ASSERT_TRUE(right.empty());
+    ASSERT_EQ(100, all.size());
+    t_map none = all.split(100);
+    ASSERT_TRUE(none.empty());
+    ASSERT_EQ(100, all.size());
+    all.join(none);
+    ASSERT_EQ(100, all.size());
+    none.join(all);
+    ASSERT_EQ(100, none.size());
+    ASSERT_EQ(0, ::portable_stl::get<0>(*none.begin()));
+  }
+
+  // with the subtree sizes
+  {
+    ::portable_stl::
+      map<std::int32_t, double, ::portable_stl::less<std::int32_t>, t_allocator2, ::portable_stl::tree_rank_node_policy>
+        mp;
+    for (std::int32_t i{0}; i < 50; ++i) {
+      ASSERT_TRUE(mp.insert(t_map_value_type(i, i)));
+    }
+    auto right = mp.split(10);
+    ASSERT_EQ(10, mp.size());
+    ASSERT_EQ(40, right.size());
+    ASSERT_EQ(15, ::portable_stl::get<0>(*right.nth(5)));
+    ASSERT_EQ(5, right.rank(15));
+
+    mp.join(right);
+    ASSERT_EQ(50, mp.size());
+    ASSERT_EQ(45, ::portable_stl::get<0>(*mp.nth(45)));
+  }
+}
+
+TEST(map, erase_iter_iter_split) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t first{0}; first < 30; first += 3) {
+    for (std::int32_t last{first}; last <= 30; last += 4) {
+      t_map mp;
+      for (std::int32_t i{0}; i < 30; ++i) {
+        ASSERT_TRUE(mp.insert(t_map_value_type(i, i)));
+      }
+      auto const value = &::portable_stl::get<1>(*mp.find(29));
+
+      auto iter = mp.erase(mp.find(first), (30 == last) ? mp.end() : mp.find(last));
+      ASSERT_EQ(static_cast<std::size_t>(30 - (last - first)), mp.size());
+      ASSERT_EQ((30 == last) ? mp.end() : mp.find(last), iter);
+
+      std::int32_t expected_key{0};
+      for (auto const &item : mp) {
+        if (expected_key == first) {
+          expected_key = last;
+        }
+        ASSERT_EQ(expected_key, ::portable_stl::get<0>(item));
+        ++expected_key;
+      }
+      if (last < 30) {
+        ASSERT_EQ(value, &::portable_stl::get<1>(*mp.find(29)));
+      }
+      ASSERT_TRUE(mp.insert(t_map_value_type(first, 0)));
+    }
+  }
+}
+
+TEST(map, set_operations) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::map<std::int32_t, double> map_long;
+  for (std::int32_t i{0}; i < 500; ++i) {
+    ASSERT_TRUE(map_long.insert(t_map_value_type(i * 2, 1.0)));
+  }
+  ::portable_stl::map<std::int32_t, double> map_short{t_map_value_type(3, 2.0),
+                                                      t_map_value_type(100, 2.0),
+                                                      t_map_value_type(998, 2.0),
+                                                      t_map_value_type(1200, 2.0)};
+
+  std::vector<t_map_value_type> dst;
+  ::portable_stl::set_intersection(map_short, map_long, std::back_inserter(dst));
+  ASSERT_EQ(2, dst.size());
+  EXPECT_EQ(100, ::portable_stl::get<0>(dst[0]));
+  EXPECT_EQ(2.0, ::portable_stl::get<1>(dst[0]));
+  EXPECT_EQ(998, ::portable_stl::get<0>(dst[1]));
+
+  dst.clear();
+  ::portable_stl::set_union(map_long, map_short, std::back_inserter(dst));
+  ASSERT_EQ(502, dst.size());
+  EXPECT_EQ(1.0, ::portable_stl::get<1>(dst[51]));
+  EXPECT_EQ(1200, ::portable_stl::get<0>(dst[501]));
+
+  dst.clear();
+  ::portable_stl::set_difference(map_short, map_long, std::back_inserter(dst));
+  ASSERT_EQ(2, dst.size());
+  EXPECT_EQ(3, ::portable_stl::get<0>(dst[0]));
+  EXPECT_EQ(1200, ::portable_stl::get<0>(dst[1]));
+
+  dst.clear();
+  ::portable_stl::set_symmetric_difference(map_short, map_long, std::back_inserter(dst));
+  EXPECT_EQ(500, dst.size());
+
+  dst.clear();
+  ::portable_stl::merge(map_short, map_long, std::back_inserter(dst));
+  ASSERT_EQ(504, dst.size());
+  EXPECT_EQ(2.0, ::portable_stl::get<1>(dst[51]));
+  EXPECT_EQ(1.0, ::portable_stl::get<1>(dst[52]));
+
+  EXPECT_FALSE(::portable_stl::includes(map_long, map_short));
+  ASSERT_EQ(1, map_short.erase(3));
+  ASSERT_EQ(1, map_short.erase(1200));
+  EXPECT_TRUE(::portable_stl::includes(map_long, map_short));
+
+  // merge by splicing the nodes
+  ::portable_stl::map<std::int32_t, double> result{::portable_stl::merge(map_short, map_long)};
+  EXPECT_EQ(500, result.size());
+  EXPECT_EQ(2, map_short.size());
+  EXPECT_TRUE(map_long.empty());
+  EXPECT_EQ(1.0, ::portable_stl::get<1>(*result.find(100)));
+}
+
+TEST(map, compact) {
+  static_cast<void>(test_info_);
+
+  using t_map_stat = ::portable_stl::map<std::int32_t, double, t_compare, t_allocator2>;
+
+  test_allocator_helper::test_allocator_statistics alloc_stats;
+  {
+    t_map_stat mp{t_compare(), t_allocator2(&alloc_stats)};
+    for (std::int32_t i{0}; i < 200; ++i) {
+      ASSERT_TRUE(mp.insert(t_map_value_type((i * 37) % 200, i)));
+    }
+    for (std::int32_t i{0}; i < 200; i += 3) {
+      ASSERT_EQ(1, mp.erase(i));
+    }
+    ASSERT_EQ(133, mp.size());
+    ASSERT_EQ(133, alloc_stats.m_alloc_count);
+
+    ASSERT_TRUE(mp.compact());
+    ASSERT_EQ(1, alloc_stats.m_alloc_count);
+    ASSERT_EQ(133, mp.size());
+
+    // the elements follow each other in memory in the sorted order
+    auto const *prev_value = &::portable_stl::get<1>(*mp.begin());
+    std::int32_t prev_key{::portable_stl::get<0>(*mp.begin())};
+    std::ptrdiff_t const step{reinterpret_cast<char const *>(&::portable_stl::get<1>(*::portable_stl::next(mp.begin())))
+                              - reinterpret_cast<char const *>(prev_value)};
+    ASSERT_LT(0, step);
+    for (auto iter = ::portable_stl::next(mp.begin()); iter != mp.end(); ++iter) {
+      ASSERT_LT(prev_key, ::portable_stl::get<0>(*iter));
+      ASSERT_EQ(step,
+                reinterpret_cast<char const *>(&::portable_stl::get<1>(*iter))
+                  - reinterpret_cast<char const *>(prev_value));
+      prev_value = &::portable_stl::get<1>(*iter);
+      prev_key   = ::portable_stl::get<0>(*iter);
+    }
+    for (std::int32_t i{0}; i < 200; ++i) {
+      ASSERT_EQ(0 != i % 3, mp.contains(i));
+    }
+
+    // modifications after compaction
+    ASSERT_TRUE(mp.insert(t_map_value_type(0, 1.0)));
+    ASSERT_EQ(1, mp.erase(1));
+    ASSERT_EQ(2, alloc_stats.m_alloc_count);
+
+    // extracted element gets its own node
+    auto node = mp.extract(2);
+    ASSERT_FALSE(node.empty());
+    ASSERT_EQ(3, alloc_stats.m_alloc_count);
+
+    // no memory for the extracted element
+    alloc_stats.m_throw_after = alloc_stats.m_time_to_throw;
+    ASSERT_TRUE(mp.extract(mp.find(4)).empty());
+    ASSERT_TRUE(mp.contains(4));
+    alloc_stats.m_throw_after = 1000000;
+
+    // split moves the greater elements to separate nodes, join takes them back
+    t_map_stat right = mp.split(100);
+    ASSERT_EQ(67, right.size());
+    ASSERT_EQ(65, mp.size());
+    ASSERT_TRUE(right.compact());
+    mp.join(right);
+    ASSERT_TRUE(right.empty());
+    ASSERT_EQ(132, mp.size());
+    ASSERT_TRUE(mp.contains(199));
+
+    // the old block is released with its last element
+    ASSERT_TRUE(mp.compact());
+    ASSERT_EQ(2, alloc_stats.m_alloc_count);
+
+    // split reallocates only the moved elements placed in a block shared with the remaining ones
+    ASSERT_TRUE(mp.insert(t_map_value_type(500, 1.0)));
+    ASSERT_EQ(3, alloc_stats.m_alloc_count);
+    t_map_stat shared_right = mp.split(190);
+    ASSERT_EQ(8, shared_right.size());
+    ASSERT_EQ(10, alloc_stats.m_alloc_count);
+    mp.join(shared_right);
+    ASSERT_EQ(1, mp.erase(500));
+    ASSERT_TRUE(mp.compact());
+    ASSERT_EQ(2, alloc_stats.m_alloc_count);
+
+    // the block with all its elements moved goes along with them
+    {
+      t_map_stat upper{t_compare(), t_allocator2(&alloc_stats)};
+      for (std::int32_t i{1000}; i < 1050; ++i) {
+        ASSERT_TRUE(upper.insert(t_map_value_type(i, 1.0)));
+      }
+      ASSERT_TRUE(upper.compact());
+      mp.join(upper);
+      ASSERT_EQ(3, alloc_stats.m_alloc_count);
+      t_map_stat upper_right = mp.split(1000);
+      ASSERT_EQ(50, upper_right.size());
+      ASSERT_EQ(132, mp.size());
+      ASSERT_EQ(3, alloc_stats.m_alloc_count);
+      ASSERT_TRUE(upper_right.contains(1049));
+      ASSERT_EQ(1, upper_right.erase(1000));
+    }
+    ASSERT_EQ(2, alloc_stats.m_alloc_count);
+
+    // move and swap carry the block along
+    t_map_stat moved{::portable_stl::move(mp)};
+    ASSERT_EQ(132, moved.size());
+    mp.swap(moved);
+    ASSERT_EQ(132, mp.size());
+
+    mp.clear();
+    ASSERT_EQ(1, alloc_stats.m_alloc_count);
+    ASSERT_TRUE(mp.compact());
+  }
+  ASSERT_EQ(0, alloc_stats.m_alloc_count);
+  ASSERT_EQ(0, alloc_stats.m_allocated_size);
+}
@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 
 #include <portable_stl/containers/tree.h>
+#include <vector>
 
 TEST(tree, key_type) {
   static_cast<void>(test_info_);
@@ -102,6 +103,59 @@ struct Node {
   Node() : m_left(), m_right(), m_parent(), m_is_black() {
   }
 };
+
+struct SizedNode {
+  SizedNode   *m_left;
+  SizedNode   *m_right;
+  SizedNode   *m_parent;
+  bool         m_is_black;
+  std::size_t  m_size;
+  std::int32_t m_value;
+
+  SizedNode *parent_unsafe() const {
+    return m_parent;
+  }
+  void set_parent(SizedNode *x) {
+    m_parent = x;
+  }
+
+  SizedNode() : m_left(), m_right(), m_parent(), m_is_black(), m_size(), m_value() {
+  }
+};
+
+/**
+ * @brief Checks the subtree sizes of all the nodes.
+ * @param node the subtree root.
+ * @return the number of nodes in the subtree or -1 if the sizes are broken.
+ */
+std::int64_t check_sizes(SizedNode const *node) {
+  if (nullptr == node) {
+    return 0;
+  }
+  std::int64_t const left_size{check_sizes(node->m_left)};
+  std::int64_t const right_size{check_sizes(node->m_right)};
+  if ((left_size < 0) || (right_size < 0) || (static_cast<std::int64_t>(node->m_size) != left_size + right_size + 1)) {
+    return -1;
+  }
+  return left_size + right_size + 1;
+}
+
+/**
+ * @brief Inserts node to the tree with the end node 'end_node'.
+ * @param end_node the end node of the tree.
+ * @param node the inserted node.
+ */
+void insert_sized(SizedNode &end_node, SizedNode *node) {
+  SizedNode  *parent = &end_node;
+  SizedNode **child  = &end_node.m_left;
+  while (*child != nullptr) {
+    parent = *child;
+    child  = (node->m_value < parent->m_value) ? &parent->m_left : &parent->m_right;
+  }
+  *child         = node;
+  node->m_parent = parent;
+  ::portable_stl::tree_ns::tree_balance_after_insert(end_node.m_left, node);
+}
 } // namespace test_tree_helper
 
 TEST(tree, left_rotate) {
@@ -3405,3 +3459,151 @@ TEST(tree, tree_remove) {
     ASSERT_EQ(root.m_is_black, false);
   }
 }
+
+TEST(tree, tree_build_balanced) {
+  static_cast<void>(test_info_);
+
+  for (std::size_t num{1}; num < 70; ++num) {
+    test_tree_helper::Node              root;
+    std::vector<test_tree_helper::Node> nodes(num);
+    for (std::size_t i{0}; i + 1 < num; ++i) {
+      nodes[i].m_right = &nodes[i + 1];
+    }
+
+    root.m_left           = ::portable_stl::tree_ns::tree_build_balanced(&nodes[0], num);
+    root.m_left->m_parent = &root;
+
+    ASSERT_TRUE(::portable_stl::tree_ns::tree_invariant(root.m_left));
+
+    // in-order traversal keeps the list order
+    test_tree_helper::Node *node = ::portable_stl::tree_ns::tree_min(root.m_left);
+    for (std::size_t i{0}; i < num; ++i) {
+      ASSERT_EQ(&nodes[i], node);
+      node = ::portable_stl::tree_ns::tree_next(node);
+    }
+    ASSERT_EQ(&root, node);
+  }
+}
+
+TEST(tree, subtree_size) {
+  static_cast<void>(test_info_);
+
+  ASSERT_TRUE((::portable_stl::tree_ns::tree_has_size<test_tree_helper::SizedNode *>::type{}()));
+  ASSERT_FALSE((::portable_stl::tree_ns::tree_has_size<test_tree_helper::Node *>::type{}()));
+
+  // the plain node policy does not change the node size
+  ASSERT_EQ(sizeof(test_tree_helper::Node), (sizeof(::portable_stl::tree_node_base<void *>)));
+  ASSERT_LT(sizeof(test_tree_helper::Node),
+            (sizeof(::portable_stl::tree_node_base<void *, ::portable_stl::tree_rank_node_policy>)));
+
+  std::size_t const                        num{200};
+  std::vector<test_tree_helper::SizedNode> nodes(num);
+  test_tree_helper::SizedNode              end_node;
+  for (std::size_t i{0}; i < num; ++i) {
+    nodes[i].m_value = static_cast<std::int32_t>((i * 37U) % num);
+    test_tree_helper::insert_sized(end_node, &nodes[i]);
+    ASSERT_EQ(static_cast<std::int64_t>(i + 1), test_tree_helper::check_sizes(end_node.m_left));
+  }
+  ASSERT_TRUE(::portable_stl::tree_ns::tree_invariant(end_node.m_left));
+
+  for (std::size_t i{0}; i < num; i += 3U) {
+    ::portable_stl::tree_ns::tree_remove(end_node.m_left, &nodes[i]);
+    ASSERT_TRUE(::portable_stl::tree_ns::tree_invariant(end_node.m_left));
+    ASSERT_EQ(static_cast<std::int64_t>(num - (i / 3U) - 1U), test_tree_helper::check_sizes(end_node.m_left));
+  }
+
+  for (std::size_t count{1}; count < 40; ++count) {
+    test_tree_helper::SizedNode              root;
+    std::vector<test_tree_helper::SizedNode> list(count);
+    for (std::size_t i{0}; i + 1 < count; ++i) {
+      list[i].m_right = &list[i + 1];
+    }
+    root.m_left           = ::portable_stl::tree_ns::tree_build_balanced(&list[0], count);
+    root.m_left->m_parent = &root;
+    ASSERT_EQ(static_cast<std::int64_t>(count), test_tree_helper::check_sizes(root.m_left));
+  }
+}
+
+TEST(tree, tree_split_join) {
+  static_cast<void>(test_info_);
+
+  std::size_t const num{100};
+  for (std::size_t pos{0}; pos < num; ++pos) {
+    std::vector<test_tree_helper::SizedNode> nodes(num);
+    test_tree_helper::SizedNode              end_node;
+    for (std::size_t i{0}; i < num; ++i) {
+      nodes[i].m_value = static_cast<std::int32_t>((i * 37U) % num);
+      test_tree_helper::insert_sized(end_node, &nodes[i]);
+    }
+    test_tree_helper::SizedNode *split_node = &nodes[(pos * 73U) % num];
+    std::int32_t const           split_value{split_node->m_value};
+
+    test_tree_helper::SizedNode right_end;
+    ::portable_stl::tree_ns::tree_split(end_node.m_left, split_node, &end_node, &right_end);
+
+    ASSERT_TRUE(::portable_stl::tree_ns::tree_invariant(right_end.m_left));
+    ASSERT_EQ(static_cast<std::int64_t>(num) - split_value, test_tree_helper::check_sizes(right_end.m_left));
+    ASSERT_EQ(split_node, ::portable_stl::tree_ns::tree_min(right_end.m_left));
+    if (0 == split_value) {
+      ASSERT_EQ(nullptr, end_node.m_left);
+    } else {
+      ASSERT_TRUE(::portable_stl::tree_ns::tree_invariant(end_node.m_left));
+      ASSERT_EQ(split_value, test_tree_helper::check_sizes(end_node.m_left));
+      ASSERT_EQ(split_value - 1, ::portable_stl::tree_ns::tree_max(end_node.m_left)->m_value);
+    }
+
+    // join back with the first node of the right tree between the trees
+    ::portable_stl::tree_ns::tree_remove(right_end.m_left, split_node);
+    ::portable_stl::tree_ns::tree_join(&end_node, end_node.m_left, split_node, right_end.m_left);
+    ASSERT_EQ(&end_node, end_node.m_left->m_parent);
+    ASSERT_TRUE(::portable_stl::tree_ns::tree_invariant(end_node.m_left));
+    ASSERT_EQ(static_cast<std::int64_t>(num), test_tree_helper::check_sizes(end_node.m_left));
+
+    test_tree_helper::SizedNode *node = ::portable_stl::tree_ns::tree_min(end_node.m_left);
+    for (std::int32_t i{0}; i < static_cast<std::int32_t>(num); ++i) {
+      ASSERT_EQ(i, node->m_value);
+      node = ::portable_stl::tree_ns::tree_next(node);
+    }
+    ASSERT_EQ(&end_node, node);
+  }
+
+  // trees of very different black heights
+  {
+    std::vector<test_tree_helper::SizedNode> nodes(64);
+    test_tree_helper::SizedNode              left_end;
+    test_tree_helper::SizedNode              right_end;
+    for (std::size_t i{0}; i < 64; ++i) {
+      nodes[i].m_value = static_cast<std::int32_t>(i);
+    }
+    test_tree_helper::insert_sized(left_end, &nodes[0]);
+    for (std::size_t i{2}; i < 64; ++i) {
+      test_tree_helper::insert_sized(right_end, &nodes[i]);
+    }
+    ::portable_stl::tree_ns::tree_join(&left_end, left_end.m_left, &nodes[1], right_end.m_left);
+    ASSERT_TRUE(::portable_stl::tree_ns::tree_invariant(left_end.m_left));
+    ASSERT_EQ(64, test_tree_helper::check_sizes(left_end.m_left));
+    ASSERT_EQ(&nodes[0], ::portable_stl::tree_ns::tree_min(left_end.m_left));
+  }
+
+  // the black height returned by the join is the one of the joined tree
+  for (std::size_t left_num{0}; left_num < 40U; ++left_num) {
+    std::vector<test_tree_helper::SizedNode> nodes(41);
+    test_tree_helper::SizedNode              left_end;
+    test_tree_helper::SizedNode              right_end;
+    for (std::size_t i{0}; i < nodes.size(); ++i) {
+      nodes[i].m_value = static_cast<std::int32_t>(i);
+      if (i < left_num) {
+        test_tree_helper::insert_sized(left_end, &nodes[i]);
+      } else if (i > left_num) {
+        test_tree_helper::insert_sized(right_end, &nodes[i]);
+      }
+    }
+    unsigned const left_height{::portable_stl::tree_ns::tree_black_height(left_end.m_left)};
+    unsigned const right_height{::portable_stl::tree_ns::tree_black_height(right_end.m_left)};
+    unsigned const height{::portable_stl::tree_ns::tree_join_heights(
+      &left_end, left_end.m_left, left_height, &nodes[left_num], right_end.m_left, right_height)};
+    ASSERT_TRUE(::portable_stl::tree_ns::tree_invariant(left_end.m_left));
+    ASSERT_EQ(41, test_tree_helper::check_sizes(left_end.m_left));
+    ASSERT_EQ(::portable_stl::tree_ns::tree_black_height(left_end.m_left), height);
+  }
+}
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <portable_stl/map/multimap.h>
+#include <vector>
 
 #include "../common/counter.h"
 #include "../common/move_only.h"
@@ -462,6 +463,85 @@ TEST(multimap, make_multimap_iter_iter_comp_alloc) {
   }
 }
 
+TEST(multimap, constructor_sorted_equivalent) {
+  static_cast<void>(test_info_);
+
+  {
+    ::portable_stl::multimap<std::int32_t, double> mp(
+      ::portable_stl::sorted_equivalent_t{}, test_multimap_helper::arr, test_multimap_helper::arr_end);
+
+    ASSERT_EQ(9, mp.size());
+    ASSERT_TRUE(std::equal(mp.begin(), mp.end(), test_multimap_helper::arr));
+    EXPECT_EQ(3, mp.count(2));
+  }
+
+  // unsorted tail
+  {
+    t_map_value_type const values[] = {t_map_value_type(1, 1),
+                                       t_map_value_type(3, 1),
+                                       t_map_value_type(3, 2),
+                                       t_map_value_type(2, 1),
+                                       t_map_value_type(3, 3),
+                                       t_map_value_type(0, 1)};
+
+    ::portable_stl::multimap<std::int32_t, double> mp(std::begin(values), std::end(values));
+
+    t_map_value_type const expected_values[] = {t_map_value_type(0, 1),
+                                                t_map_value_type(1, 1),
+                                                t_map_value_type(2, 1),
+                                                t_map_value_type(3, 1),
+                                                t_map_value_type(3, 2),
+                                                t_map_value_type(3, 3)};
+    ASSERT_EQ(6, mp.size());
+    ASSERT_TRUE(std::equal(mp.begin(), mp.end(), std::begin(expected_values)));
+  }
+
+  // bad alloc
+  {
+    t_tree_allocator_const_key::m_counter_ok_allocation = 4;
+
+    try {
+      ::portable_stl::multimap<std::int32_t const, double, t_compare, t_allocator> mp(
+        ::portable_stl::sorted_equivalent_t{}, test_multimap_helper::arr, test_multimap_helper::arr_end, t_compare(3));
+      ASSERT_TRUE(false);
+    } catch (::portable_stl::bad_alloc<> &) {
+    }
+
+    t_tree_allocator_const_key::m_counter_ok_allocation = 10000;
+  }
+}
+
+TEST(multimap, make_multimap_sorted_equivalent) {
+  static_cast<void>(test_info_);
+
+  {
+    auto result = ::portable_stl::multimap<std::int32_t, double>::make_multimap(
+      ::portable_stl::sorted_equivalent_t{}, test_multimap_helper::arr, test_multimap_helper::arr_end);
+    ASSERT_TRUE(result);
+
+    auto mp = result.value();
+    ASSERT_EQ(9, mp.size());
+    ASSERT_TRUE(std::equal(mp.begin(), mp.end(), test_multimap_helper::arr));
+  }
+
+  // bad alloc
+  {
+    t_tree_allocator_const_key::m_counter_ok_allocation = 0;
+
+    auto result = ::portable_stl::multimap<std::int32_t const, double, t_compare, t_allocator>::make_multimap(
+      ::portable_stl::sorted_equivalent_t{},
+      test_multimap_helper::arr,
+      test_multimap_helper::arr_end,
+      t_compare(3),
+      t_allocator());
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+
+    t_tree_allocator_const_key::m_counter_ok_allocation = 10000;
+  }
+}
+
 TEST(multimap, constructor_copy) {
   static_cast<void>(test_info_);
 
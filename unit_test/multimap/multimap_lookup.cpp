@@ -632,3 +632,60 @@ TEST(multimap, equal_range_transparent) {
     ASSERT_EQ(3, nels);
   }
 }
+
+TEST(multimap, nth_rank) {
+  static_cast<void>(test_info_);
+
+  /**
+   * @brief Multimap with order statistics.
+   */
+  using t_rank_map = ::portable_stl::multimap<std::int32_t,
+                                              double,
+                                              ::portable_stl::less<std::int32_t>,
+                                              t_allocator2,
+                                              ::portable_stl::tree_rank_node_policy>;
+
+  t_rank_map mp;
+  // every key is inserted three times
+  for (std::int32_t i{0}; i < 90; ++i) {
+    ASSERT_TRUE(mp.insert(t_map_value_type((i * 7) % 30, i)));
+  }
+
+  for (std::int32_t i{0}; i < 90; ++i) {
+    ASSERT_EQ(i / 3, ::portable_stl::get<0>(*mp.nth(static_cast<std::size_t>(i))));
+  }
+  for (std::int32_t i{0}; i < 30; ++i) {
+    ASSERT_EQ(3 * i, mp.rank(i));
+  }
+  ASSERT_EQ(mp.end(), mp.nth(90));
+
+  ASSERT_EQ(3, mp.erase(10));
+  ASSERT_EQ(30, mp.rank(10));
+  ASSERT_EQ(30, mp.rank(11));
+  ASSERT_EQ(11, ::portable_stl::get<0>(*mp.nth(30)));
+  ASSERT_EQ(87, mp.size());
+  ASSERT_EQ(mp.end(), mp.nth(87));
+}
+
+TEST(multimap, lower_bound_many) {
+  static_cast<void>(test_info_);
+
+  t_map mp;
+  for (std::int32_t i{0}; i < 300; ++i) {
+    ASSERT_TRUE(mp.insert(t_map_value_type((i * 17) % 100, i)));
+  }
+
+  std::int32_t keys[400];
+  for (std::int32_t i{0}; i < 400; ++i) {
+    keys[i] = (i < 200) ? (i / 2 - 10) : ((i * 31) % 120);
+  }
+  t_map::iterator bounds[400];
+  t_map::iterator found[400];
+  ASSERT_EQ(bounds + 400, mp.lower_bound_many(keys, keys + 400, bounds));
+  ASSERT_EQ(found + 400, mp.find_many(keys, keys + 400, found));
+  for (std::int32_t i{0}; i < 400; ++i) {
+    // the first of the equal elements
+    ASSERT_EQ(mp.lower_bound(keys[i]), bounds[i]);
+    ASSERT_EQ(mp.find(keys[i]), found[i]);
+  }
+}
@@ -676,3 +676,36 @@ TEST(multimap, merge) {
     }
   }
 }
+
+TEST(multimap, split_join) {
+  static_cast<void>(test_info_);
+
+  t_map mp;
+  for (std::int32_t i{0}; i < 60; ++i) {
+    ASSERT_TRUE(mp.insert(t_map_value_type((i * 7) % 20, i)));
+  }
+
+  t_map right = mp.split(10);
+  ASSERT_EQ(30, mp.size());
+  ASSERT_EQ(30, right.size());
+  ASSERT_EQ(3, right.count(10));
+  ASSERT_EQ(0, mp.count(10));
+  ASSERT_EQ(9, ::portable_stl::get<0>(*::portable_stl::prev(mp.end())));
+
+  mp.join(right);
+  ASSERT_EQ(60, mp.size());
+  ASSERT_TRUE(right.empty());
+  std::int32_t index{0};
+  for (auto const &item : mp) {
+    ASSERT_EQ(index / 3, ::portable_stl::get<0>(item));
+    ++index;
+  }
+
+  // erase the range of equivalent keys
+  auto range = mp.equal_range(5);
+  auto iter  = mp.erase(::portable_stl::get<0>(range), ::portable_stl::get<1>(range));
+  ASSERT_EQ(57, mp.size());
+  ASSERT_EQ(6, ::portable_stl::get<0>(*iter));
+  ASSERT_EQ(0, mp.count(5));
+  ASSERT_EQ(3, mp.count(6));
+}
@@ -0,0 +1,287 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="numeric.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "iterator_helper.h"
+#include "portable_stl/numeric/accumulate.h"
+#include "portable_stl/numeric/adjacent_difference.h"
+#include "portable_stl/numeric/exclusive_scan.h"
+#include "portable_stl/numeric/inclusive_scan.h"
+#include "portable_stl/numeric/inner_product.h"
+#include "portable_stl/numeric/iota.h"
+#include "portable_stl/numeric/reduce.h"
+#include "portable_stl/numeric/transform_reduce.h"
+#include "portable_stl/vector/vector.h"
+
+namespace test_numeric_helper {
+/**
+ * @brief Input iterator alias.
+ */
+using t_input_iterator = test_iterator_helper::tst_input_iterator<std::int32_t const *>;
+} // namespace test_numeric_helper
+
+TEST(numeric, iota) {
+  static_cast<void>(test_info_);
+
+  std::int32_t values[5]{};
+  ::portable_stl::iota(values, values + 5, -2);
+  for (std::int32_t i{0}; i < 5; ++i) {
+    EXPECT_EQ(i - 2, values[i]);
+  }
+
+  ::portable_stl::vector<double> doubles(3, 0.0);
+  ::portable_stl::iota(doubles.begin(), doubles.end(), 0.5);
+  EXPECT_EQ(2.5, doubles[2]);
+}
+
+TEST(numeric, accumulate) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const values[]{1, 2, 3, 4};
+  EXPECT_EQ(10, ::portable_stl::accumulate(values, values + 4, 0));
+  EXPECT_EQ(5, ::portable_stl::accumulate(values, values, 5));
+  EXPECT_EQ(24, ::portable_stl::accumulate(values, values + 4, 1, [](std::int32_t acc, std::int32_t value) {
+              return acc * value;
+            }));
+
+  // the order of the operations is kept
+  std::string const words[]{"a", "b", "c"};
+  EXPECT_EQ("xabc", ::portable_stl::accumulate(words, words + 3, std::string("x")));
+  EXPECT_EQ(10,
+            ::portable_stl::accumulate(
+              test_numeric_helper::t_input_iterator(values), test_numeric_helper::t_input_iterator(values + 4), 0));
+}
+
+TEST(numeric, inner_product) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const left[]{1, 2, 3};
+  std::int32_t const right[]{4, 5, 6};
+  EXPECT_EQ(32, ::portable_stl::inner_product(left, left + 3, right, 0));
+  EXPECT_EQ(3,
+            ::portable_stl::inner_product(
+              left, left + 3, right, 0, [](std::int32_t acc, bool less) { return acc + (less ? 1 : 0); },
+              [](std::int32_t first, std::int32_t second) { return first < second; }));
+}
+
+TEST(numeric, reduce) {
+  static_cast<void>(test_info_);
+
+  // every length around the unrolled block
+  for (std::int32_t length{0}; length < 40; ++length) {
+    ::portable_stl::vector<std::uint64_t> values;
+    ::portable_stl::vector<double>        doubles;
+    for (std::int32_t i{0}; i < length; ++i) {
+      ASSERT_TRUE(values.push_back(static_cast<std::uint64_t>(i) * 3U));
+      ASSERT_TRUE(doubles.push_back(static_cast<double>(i) * 0.5));
+    }
+    std::uint64_t const sum{static_cast<std::uint64_t>(3 * length * (length - 1) / 2)};
+    ASSERT_EQ(sum, ::portable_stl::reduce(values.begin(), values.end()));
+    ASSERT_EQ(sum + 7U, ::portable_stl::reduce(values.begin(), values.end(), std::uint64_t{7U}));
+    ASSERT_EQ(static_cast<double>(sum) / 6.0 + 1.0, ::portable_stl::reduce(doubles.begin(), doubles.end(), 1.0));
+  }
+
+  std::int32_t const values[]{3, -1, 4, 1, -5, 9, 2, -6, 5, 3, -5, 8, 9, 7, -9, 3, 2, 3, 8, 4};
+  auto const max = [](std::int32_t left, std::int32_t right) { return (left < right) ? right : left; };
+  EXPECT_EQ(9, ::portable_stl::reduce(values, values + 20, -100, max));
+  EXPECT_EQ(45, ::portable_stl::reduce(values, values + 20, 0));
+  EXPECT_EQ(45, ::portable_stl::reduce(test_numeric_helper::t_input_iterator(values),
+                                       test_numeric_helper::t_input_iterator(values + 20)));
+
+  std::string const words[]{"a", "b", "c"};
+  EXPECT_EQ("abc", ::portable_stl::reduce(words, words + 3));
+}
+
+TEST(numeric, reduce_vector_sum) {
+  static_cast<void>(test_info_);
+
+  static_assert(::portable_stl::numeric_helper::simd_reduce_tag<std::int32_t const *,
+                                                                std::int32_t,
+                                                                ::portable_stl::plus<>>{}()
+                  == typename ::portable_stl::algorithm_helper::simd_ops<std::int32_t>::has_add{}(),
+                "the sums of int32_t use the vector lanes where the target has them");
+  static_assert(!::portable_stl::numeric_helper::simd_reduce_tag<std::int32_t const *,
+                                                                 std::int64_t,
+                                                                 ::portable_stl::plus<>>{}(),
+                "the sums into a wider type stay scalar");
+  static_assert(
+    !::portable_stl::numeric_helper::simd_reduce_tag<bool const *, bool, ::portable_stl::plus<>>{}(), "no bool lanes");
+
+  // every length around the vector blocks, the tails and the wrap around of the narrow integers
+  for (std::int32_t length{0}; length < 300; ++length) {
+    ::portable_stl::vector<std::uint8_t> bytes;
+    ::portable_stl::vector<std::int16_t> shorts;
+    ::portable_stl::vector<std::int32_t> ints;
+    ::portable_stl::vector<std::int64_t> longs;
+    ::portable_stl::vector<float>        floats;
+    for (std::int32_t i{0}; i < length; ++i) {
+      ASSERT_TRUE(bytes.push_back(static_cast<std::uint8_t>(200 + i)));
+      ASSERT_TRUE(shorts.push_back(static_cast<std::int16_t>(i * ((i % 2 == 0) ? 300 : -7))));
+      ASSERT_TRUE(ints.push_back(i * 1000 - 70000));
+      ASSERT_TRUE(longs.push_back(static_cast<std::int64_t>(i) << 33));
+      ASSERT_TRUE(floats.push_back(static_cast<float>(i % 17)));
+    }
+    std::uint8_t byte_sum{3U};
+    std::int16_t short_sum{0};
+    std::int64_t long_sum{5};
+    std::int32_t int_sum{0};
+    float        float_sum{0.0F};
+    for (std::int32_t i{0}; i < length; ++i) {
+      byte_sum   = static_cast<std::uint8_t>(byte_sum + bytes[static_cast<std::size_t>(i)]);
+      short_sum  = static_cast<std::int16_t>(short_sum + shorts[static_cast<std::size_t>(i)]);
+      int_sum   += ints[static_cast<std::size_t>(i)];
+      long_sum  += longs[static_cast<std::size_t>(i)];
+      float_sum += floats[static_cast<std::size_t>(i)];
+    }
+    ASSERT_EQ(byte_sum, ::portable_stl::reduce(bytes.begin(), bytes.end(), std::uint8_t{3U}));
+    ASSERT_EQ(short_sum, ::portable_stl::reduce(shorts.begin(), shorts.end()));
+    ASSERT_EQ(int_sum, ::portable_stl::reduce(ints.begin(), ints.end()));
+    ASSERT_EQ(int_sum,
+              ::portable_stl::reduce(ints.data(), ints.data() + length, 0, ::portable_stl::plus<std::int32_t>{}));
+    ASSERT_EQ(long_sum, ::portable_stl::reduce(longs.begin(), longs.end(), std::int64_t{5}));
+    ASSERT_EQ(float_sum, ::portable_stl::reduce(floats.begin(), floats.end()));
+  }
+}
+
+TEST(numeric, transform_reduce) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t length{0}; length < 40; ++length) {
+    std::vector<double>       left;
+    std::vector<std::int32_t> right;
+    double                    expected_value{0.0};
+    for (std::int32_t i{0}; i < length; ++i) {
+      left.push_back(static_cast<double>(i));
+      right.push_back(2 - i);
+      expected_value += static_cast<double>(i * (2 - i));
+    }
+    ASSERT_EQ(expected_value,
+              ::portable_stl::transform_reduce(left.data(), left.data() + left.size(), right.data(), 0.0));
+  }
+
+  std::int32_t const values[]{1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11, -12, 13, -14, 15, -16, 17};
+  auto const         abs = [](std::int32_t value) { return (value < 0) ? -value : value; };
+  EXPECT_EQ(153, ::portable_stl::transform_reduce(values, values + 17, 0, ::portable_stl::plus<>{}, abs));
+  EXPECT_EQ(153,
+            ::portable_stl::transform_reduce(test_numeric_helper::t_input_iterator(values),
+                                             test_numeric_helper::t_input_iterator(values + 17),
+                                             0,
+                                             ::portable_stl::plus<>{},
+                                             abs));
+  EXPECT_EQ(-99, ::portable_stl::transform_reduce(values, values + 17, values, -100, ::portable_stl::plus<>{},
+                                                  [](std::int32_t, std::int32_t) { return 0; })
+                   + 1);
+}
+
+TEST(numeric, inclusive_scan) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const values[]{1, 2, 3, 4, 5};
+  std::int32_t       result[5]{};
+  EXPECT_EQ(result + 5, ::portable_stl::inclusive_scan(values, values + 5, result));
+  std::int32_t const expected_sums[]{1, 3, 6, 10, 15};
+  for (std::int32_t i{0}; i < 5; ++i) {
+    EXPECT_EQ(expected_sums[i], result[i]);
+  }
+
+  EXPECT_EQ(result + 5,
+            ::portable_stl::inclusive_scan(test_numeric_helper::t_input_iterator(values),
+                                           test_numeric_helper::t_input_iterator(values + 5),
+                                           result,
+                                           ::portable_stl::multiplies<>{},
+                                           2));
+  EXPECT_EQ(240, result[4]);
+  EXPECT_EQ(result, ::portable_stl::inclusive_scan(values, values, result));
+
+  // the unrolled floating-point scan, in place
+  for (std::int32_t length{0}; length < 20; ++length) {
+    ::portable_stl::vector<double> doubles;
+    for (std::int32_t i{0}; i < length; ++i) {
+      ASSERT_TRUE(doubles.push_back(static_cast<double>(i + 1)));
+    }
+    ASSERT_EQ(doubles.end(), ::portable_stl::inclusive_scan(doubles.begin(), doubles.end(), doubles.begin()));
+    for (std::int32_t i{0}; i < length; ++i) {
+      ASSERT_EQ(static_cast<double>((i + 1) * (i + 2) / 2), doubles[static_cast<::portable_stl::size_t>(i)]);
+    }
+
+    std::vector<double> scanned(static_cast<std::size_t>(length));
+    ::portable_stl::inclusive_scan(doubles.begin(), doubles.end(), scanned.data(), ::portable_stl::plus<>{}, 0.5);
+    double sum{0.5};
+    for (std::int32_t i{0}; i < length; ++i) {
+      sum += doubles[static_cast<::portable_stl::size_t>(i)];
+      ASSERT_EQ(sum, scanned[static_cast<std::size_t>(i)]);
+    }
+  }
+}
+
+TEST(numeric, exclusive_scan) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const values[]{1, 2, 3, 4, 5};
+  std::int32_t       result[5]{};
+  EXPECT_EQ(result + 5, ::portable_stl::exclusive_scan(values, values + 5, result, 10));
+  std::int32_t const expected_sums[]{10, 11, 13, 16, 20};
+  for (std::int32_t i{0}; i < 5; ++i) {
+    EXPECT_EQ(expected_sums[i], result[i]);
+  }
+
+  EXPECT_EQ(result + 5,
+            ::portable_stl::exclusive_scan(test_numeric_helper::t_input_iterator(values),
+                                           test_numeric_helper::t_input_iterator(values + 5),
+                                           result,
+                                           1,
+                                           ::portable_stl::multiplies<>{}));
+  EXPECT_EQ(24, result[4]);
+
+  // the unrolled floating-point scan, in place
+  for (std::int32_t length{0}; length < 20; ++length) {
+    std::vector<double> doubles;
+    for (std::int32_t i{0}; i < length; ++i) {
+      doubles.push_back(static_cast<double>(i + 1));
+    }
+    double *const first{doubles.data()};
+    ASSERT_EQ(first + length, ::portable_stl::exclusive_scan(first, first + length, first, 0.0));
+    for (std::int32_t i{0}; i < length; ++i) {
+      ASSERT_EQ(static_cast<double>(i * (i + 1) / 2), doubles[static_cast<std::size_t>(i)]);
+    }
+  }
+}
+
+TEST(numeric, adjacent_difference) {
+  static_cast<void>(test_info_);
+
+  std::int32_t values[]{2, 4, 6, 9, 9};
+  std::int32_t result[5]{};
+  EXPECT_EQ(result + 5, ::portable_stl::adjacent_difference(values, values + 5, result));
+  std::int32_t const expected_values[]{2, 2, 2, 3, 0};
+  for (std::int32_t i{0}; i < 5; ++i) {
+    EXPECT_EQ(expected_values[i], result[i]);
+  }
+
+  // in place, the inverse of inclusive_scan
+  EXPECT_EQ(values + 5, ::portable_stl::adjacent_difference(values, values + 5, values));
+  ::portable_stl::inclusive_scan(values, values + 5, values);
+  EXPECT_EQ(9, values[4]);
+  EXPECT_EQ(6, values[2]);
+
+  EXPECT_EQ(result + 4,
+            ::portable_stl::adjacent_difference(test_numeric_helper::t_input_iterator(values),
+                                                test_numeric_helper::t_input_iterator(values + 4),
+                                                result,
+                                                ::portable_stl::plus<>{}));
+  EXPECT_EQ(15, result[3]);
+  EXPECT_EQ(result, ::portable_stl::adjacent_difference(values, values, result));
+}
@@ -0,0 +1,295 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="indexed_priority_queue.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "../common/test_allocator.h"
+#include "portable_stl/queue/indexed_priority_queue.h"
+
+namespace test_indexed_priority_queue_helper {
+/**
+ * @brief Greater comparison for min-queue.
+ */
+class greater final {
+public:
+  /**
+   * @brief The only operator.
+   * @param lhv
+   * @param rhv
+   * @return true if lhv > rhv.
+   */
+  constexpr bool operator()(std::int32_t const &lhv, std::int32_t const &rhv) const {
+    return lhv > rhv;
+  }
+};
+
+/**
+ * @brief Min-queue alias.
+ */
+using min_queue = ::portable_stl::indexed_priority_queue<std::int32_t, greater>;
+
+/**
+ * @brief Counter of the alive elements.
+ */
+static std::int32_t live_count{0};
+
+/**
+ * @brief Element which counts the alive objects and can not be assigned.
+ */
+class counted final {
+public:
+  /**
+   * @brief The value.
+   */
+  std::int32_t m_value;
+
+  /**
+   * @brief Constructor.
+   * @param value the value.
+   */
+  explicit counted(std::int32_t value) : m_value(value) {
+    ++live_count;
+  }
+
+  /**
+   * @brief Copy constructor.
+   * @param other the element to copy.
+   */
+  counted(counted const &other) : m_value(other.m_value) {
+    ++live_count;
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  ~counted() {
+    --live_count;
+  }
+
+  counted &operator=(counted const &) = delete;
+
+  /**
+   * @brief Compares the values.
+   * @param other the element to compare with.
+   * @return true if the value is less than the other one.
+   */
+  bool operator<(counted const &other) const {
+    return m_value < other.m_value;
+  }
+};
+} // namespace test_indexed_priority_queue_helper
+
+TEST(indexed_priority_queue, push_pop) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::indexed_priority_queue<std::int32_t> queue;
+  EXPECT_TRUE(queue.empty());
+
+  for (std::int32_t i{0}; i < 100; ++i) {
+    auto result = queue.push((i * 37) % 100);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(static_cast<::portable_stl::size_t>(i), result.value());
+  }
+  EXPECT_EQ(100, queue.size());
+
+  for (std::int32_t expected_value{99}; expected_value >= 0; --expected_value) {
+    EXPECT_EQ(expected_value, queue.top());
+    EXPECT_EQ(expected_value, queue.value(queue.top_handle()));
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(indexed_priority_queue, decrease_key) {
+  static_cast<void>(test_info_);
+
+  test_indexed_priority_queue_helper::min_queue queue;
+
+  auto const h10 = queue.push(10).value();
+  auto const h20 = queue.push(20).value();
+  auto const h30 = queue.push(30).value();
+  auto const h40 = queue.push(40).value();
+  EXPECT_EQ(h10, queue.top_handle());
+
+  EXPECT_TRUE(queue.decrease_key(h30, 5));
+  EXPECT_EQ(h30, queue.top_handle());
+  EXPECT_EQ(5, queue.top());
+
+  EXPECT_TRUE(queue.increase_key(h30, 50));
+  EXPECT_EQ(h10, queue.top_handle());
+
+  EXPECT_TRUE(queue.update(h40, 1));
+  EXPECT_EQ(h40, queue.top_handle());
+  EXPECT_TRUE(queue.update(h40, 25));
+  EXPECT_EQ(h10, queue.top_handle());
+
+  std::int32_t const expected_values[] = {10, 20, 25, 50};
+  for (auto expected_value : expected_values) {
+    EXPECT_EQ(expected_value, queue.top());
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.contains(h20));
+
+  auto result = queue.decrease_key(h20, 1);
+  EXPECT_FALSE(result);
+  EXPECT_EQ(::portable_stl::portable_stl_error::out_of_range, result.error());
+}
+
+TEST(indexed_priority_queue, decrease_key_default_compare) {
+  static_cast<void>(test_info_);
+
+  // the default less<> comparison: the largest element is the top, a decreased key moves towards the bottom
+  ::portable_stl::indexed_priority_queue<std::int32_t> queue;
+
+  auto const h10 = queue.push(10).value();
+  auto const h20 = queue.push(20).value();
+  auto const h30 = queue.push(30).value();
+  auto const h40 = queue.push(40).value();
+  EXPECT_EQ(h40, queue.top_handle());
+
+  EXPECT_TRUE(queue.decrease_key(h40, 5));
+  EXPECT_EQ(h30, queue.top_handle());
+  EXPECT_TRUE(queue.increase_key(h10, 35));
+  EXPECT_EQ(h10, queue.top_handle());
+  static_cast<void>(h20);
+
+  // many changes in both directions keep the heap order
+  std::int32_t           keys[100]{};
+  ::portable_stl::size_t handles[100]{};
+  for (std::int32_t i{0}; i < 100; ++i) {
+    keys[i]    = i * 10;
+    handles[i] = queue.push(keys[i]).value();
+  }
+  for (std::int32_t i{0}; i < 100; ++i) {
+    std::int32_t const other{(i * 37) % 100};
+    keys[other] -= 7 * i;
+    EXPECT_TRUE(queue.decrease_key(handles[other], keys[other]));
+    keys[i] += 3 * i;
+    EXPECT_TRUE(queue.increase_key(handles[i], keys[i]));
+  }
+
+  std::vector<std::int32_t> expected_values(keys, keys + 100);
+  expected_values.push_back(35);
+  expected_values.push_back(20);
+  expected_values.push_back(30);
+  expected_values.push_back(5);
+  std::sort(expected_values.begin(), expected_values.end(), std::greater<std::int32_t>());
+  for (auto expected_value : expected_values) {
+    ASSERT_EQ(expected_value, queue.top());
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(indexed_priority_queue, erase) {
+  static_cast<void>(test_info_);
+
+  test_indexed_priority_queue_helper::min_queue queue;
+
+  ::portable_stl::size_t handles[50]{};
+  for (std::int32_t i{0}; i < 50; ++i) {
+    handles[i] = queue.push(i).value();
+  }
+
+  // erase odd values
+  for (std::int32_t i{1}; i < 50; i += 2) {
+    EXPECT_TRUE(queue.erase(handles[i]));
+    EXPECT_FALSE(queue.contains(handles[i]));
+  }
+  EXPECT_FALSE(queue.erase(handles[1]));
+  EXPECT_FALSE(queue.erase(1000));
+  EXPECT_EQ(25, queue.size());
+
+  // handles are reused
+  auto const reused = queue.push(-1).value();
+  EXPECT_LT(reused, 50);
+  EXPECT_EQ(reused, queue.top_handle());
+  queue.pop();
+
+  for (std::int32_t expected_value{0}; expected_value < 50; expected_value += 2) {
+    EXPECT_EQ(expected_value, queue.top());
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+
+  static_cast<void>(queue.push(1));
+  queue.clear();
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(indexed_priority_queue, element_lifetime) {
+  static_cast<void>(test_info_);
+
+  using test_indexed_priority_queue_helper::counted;
+  using test_indexed_priority_queue_helper::live_count;
+  {
+    ::portable_stl::indexed_priority_queue<counted> queue;
+    ::portable_stl::size_t                          handles[10]{};
+    for (std::int32_t i{0}; i < 10; ++i) {
+      handles[i] = queue.emplace(i).value();
+    }
+    EXPECT_EQ(10, live_count);
+
+    // removed elements are destroyed at once
+    queue.pop();
+    EXPECT_EQ(9, live_count);
+    EXPECT_TRUE(queue.erase(handles[3]));
+    EXPECT_EQ(8, live_count);
+
+    // the reused handle gets the new element constructed in place, no assignment is needed
+    auto const reused = queue.emplace(100).value();
+    EXPECT_TRUE((reused == handles[3]) || (reused == handles[9]));
+    EXPECT_EQ(9, live_count);
+    EXPECT_EQ(100, queue.top().m_value);
+    EXPECT_EQ(100, queue.value(reused).m_value);
+
+    auto queue_copy = queue;
+    EXPECT_EQ(18, live_count);
+    EXPECT_EQ(100, queue_copy.top().m_value);
+  }
+  EXPECT_EQ(0, live_count);
+}
+
+TEST(indexed_priority_queue, bad_alloc) {
+  static_cast<void>(test_info_);
+
+  using TestAllocator       = test_allocator_helper::TestSimpleAllocator<std::int32_t>;
+  using TestHandleAllocator = test_allocator_helper::TestSimpleAllocator<::portable_stl::size_t>;
+
+  ::portable_stl::indexed_priority_queue<std::int32_t, ::portable_stl::less<std::int32_t>, TestAllocator> queue;
+  EXPECT_TRUE(queue.push(1));
+
+  // values storage
+  using TestSlotAllocator = test_allocator_helper::TestSimpleAllocator<
+    ::portable_stl::queue_helper::indexed_slot<std::int32_t>>;
+  TestSlotAllocator::m_counter_ok_allocation = 0;
+  auto result = queue.push(2);
+  EXPECT_FALSE(result);
+  EXPECT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+  EXPECT_EQ(1, queue.size());
+  TestSlotAllocator::resetStat();
+
+  // handles storage
+  TestHandleAllocator::m_counter_ok_allocation = 0;
+  result                                       = queue.push(2);
+  EXPECT_FALSE(result);
+  EXPECT_EQ(1, queue.size());
+  EXPECT_EQ(1, queue.top());
+  TestHandleAllocator::resetStat();
+
+  EXPECT_TRUE(queue.push(2));
+  EXPECT_EQ(2, queue.top());
+}
@@ -0,0 +1,131 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="priority_queue.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../common/test_allocator.h"
+#include "portable_stl/queue/priority_queue.h"
+
+namespace test_priority_queue_helper {
+/**
+ * @brief Greater comparison for min-queue.
+ */
+class greater final {
+public:
+  /**
+   * @brief The only operator.
+   * @param lhv
+   * @param rhv
+   * @return true if lhv > rhv.
+   */
+  constexpr bool operator()(std::int32_t const &lhv, std::int32_t const &rhv) const {
+    return lhv > rhv;
+  }
+};
+} // namespace test_priority_queue_helper
+
+TEST(priority_queue, push_pop) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::priority_queue<std::int32_t> queue;
+  EXPECT_TRUE(queue.empty());
+
+  for (std::int32_t i{0}; i < 100; ++i) {
+    EXPECT_TRUE(queue.push((i * 37) % 100));
+  }
+  EXPECT_EQ(100, queue.size());
+
+  for (std::int32_t expected_value{99}; expected_value >= 0; --expected_value) {
+    ASSERT_FALSE(queue.empty());
+    EXPECT_EQ(expected_value, queue.top());
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(priority_queue, arity) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::priority_queue<std::int32_t,
+                                 ::portable_stl::vector<std::int32_t>,
+                                 test_priority_queue_helper::greater,
+                                 2U>
+    binary_queue;
+  ::portable_stl::priority_queue<std::int32_t,
+                                 ::portable_stl::vector<std::int32_t>,
+                                 test_priority_queue_helper::greater,
+                                 8U>
+    octal_queue;
+
+  for (std::int32_t i{0}; i < 200; ++i) {
+    EXPECT_TRUE(binary_queue.push((i * 73) % 200));
+    EXPECT_TRUE(octal_queue.emplace((i * 73) % 200));
+  }
+  for (std::int32_t expected_value{0}; expected_value < 200; ++expected_value) {
+    EXPECT_EQ(expected_value, binary_queue.top());
+    EXPECT_EQ(expected_value, octal_queue.top());
+    binary_queue.pop();
+    octal_queue.pop();
+  }
+}
+
+TEST(priority_queue, constructor) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const arr[] = {3, 1, 4, 1, 5, 9, 2, 6};
+  unsigned const     sa{sizeof(arr) / sizeof(arr[0])};
+
+  {
+    ::portable_stl::priority_queue<std::int32_t> queue(arr, arr + sa);
+    EXPECT_EQ(sa, queue.size());
+    EXPECT_EQ(9, queue.top());
+  }
+  {
+    ::portable_stl::vector<std::int32_t> vec(arr, arr + sa);
+
+    ::portable_stl::priority_queue<std::int32_t> queue(::portable_stl::less<std::int32_t>(), vec);
+    EXPECT_EQ(9, queue.top());
+
+    ::portable_stl::priority_queue<std::int32_t> queue2(::portable_stl::less<std::int32_t>(), ::portable_stl::move(vec));
+    EXPECT_EQ(9, queue2.top());
+
+    queue2.pop();
+    queue.swap(queue2);
+    EXPECT_EQ(6, queue.top());
+    EXPECT_EQ(9, queue2.top());
+  }
+  {
+    ::portable_stl::priority_queue<std::string> queue;
+    EXPECT_TRUE(queue.push("b"));
+    EXPECT_TRUE(queue.emplace(2U, 'c'));
+    EXPECT_TRUE(queue.push("a"));
+    EXPECT_EQ("cc", queue.top());
+  }
+}
+
+TEST(priority_queue, bad_alloc) {
+  static_cast<void>(test_info_);
+
+  using TestAllocator = test_allocator_helper::TestSimpleAllocator<std::int32_t>;
+
+  ::portable_stl::priority_queue<std::int32_t, ::portable_stl::vector<std::int32_t, TestAllocator>> queue;
+  EXPECT_TRUE(queue.push(1));
+
+  TestAllocator::m_counter_ok_allocation = 0;
+  auto result = queue.push(2);
+  EXPECT_FALSE(result);
+  EXPECT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+  EXPECT_EQ(1, queue.size());
+  EXPECT_EQ(1, queue.top());
+  TestAllocator::resetStat();
+}
@@ -0,0 +1,321 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="ranges_views.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+#include "portable_stl/list/list.h"
+#include "portable_stl/ranges/all.h"
+#include "portable_stl/ranges/chunk_view.h"
+#include "portable_stl/ranges/drop_view.h"
+#include "portable_stl/ranges/filter_view.h"
+#include "portable_stl/ranges/iota_view.h"
+#include "portable_stl/ranges/join_view.h"
+#include "portable_stl/ranges/split_view.h"
+#include "portable_stl/ranges/take_view.h"
+#include "portable_stl/ranges/transform_view.h"
+#include "portable_stl/ranges/zip_view.h"
+#include "portable_stl/string/string_view.h"
+#include "portable_stl/vector/vector.h"
+
+namespace test_ranges_views_helper {
+/**
+ * @brief Makes the vector of the values [0, count).
+ * @param count the number of values.
+ * @return the vector.
+ */
+::portable_stl::vector<std::int32_t> make_vector(std::int32_t count) {
+  ::portable_stl::vector<std::int32_t> result;
+  for (std::int32_t i{0}; i < count; ++i) {
+    static_cast<void>(result.push_back(i));
+  }
+  return result;
+}
+
+/**
+ * @brief Concatenates the pieces of the text split by the separator, every piece in brackets.
+ * @param text the text.
+ * @param separator the separator.
+ * @return the concatenated pieces.
+ */
+std::string split_pieces(::portable_stl::string_view text, char separator) {
+  std::string result;
+  for (auto piece : text | ::portable_stl::views::split(separator)) {
+    result += '[';
+    for (char character : piece) {
+      result += character;
+    }
+    result += ']';
+  }
+  return result;
+}
+} // namespace test_ranges_views_helper
+
+TEST(ranges_views, all) {
+  static_cast<void>(test_info_);
+
+  auto vec = test_ranges_views_helper::make_vector(3);
+
+  auto ref = vec | ::portable_stl::views::all;
+  EXPECT_TRUE((std::is_same<decltype(ref), ::portable_stl::ranges::ref_view<::portable_stl::vector<std::int32_t>>>{}));
+  EXPECT_EQ(&vec, &ref.base());
+  EXPECT_EQ(3, ref.size());
+  EXPECT_EQ(2, ref.back());
+
+  // the view is copied
+  auto copy = ::portable_stl::views::all(ref);
+  EXPECT_TRUE((std::is_same<decltype(copy), decltype(ref)>{}));
+
+  // the rvalue range is owned
+  auto owning = ::portable_stl::views::all(test_ranges_views_helper::make_vector(4));
+  EXPECT_TRUE(
+    (std::is_same<decltype(owning), ::portable_stl::ranges::owning_view<::portable_stl::vector<std::int32_t>>>{}));
+  EXPECT_EQ(4, owning.size());
+  EXPECT_EQ(3, owning[3]);
+  EXPECT_FALSE(owning.empty());
+}
+
+TEST(ranges_views, filter) {
+  static_cast<void>(test_info_);
+
+  auto const vec  = test_ranges_views_helper::make_vector(10);
+  auto const even = vec | ::portable_stl::views::filter([](std::int32_t value) { return 0 == (value % 2); });
+
+  std::int32_t expected{0};
+  for (auto value : even) {
+    EXPECT_EQ(expected, value);
+    expected += 2;
+  }
+  EXPECT_EQ(10, expected);
+  EXPECT_EQ(0, even.front());
+  EXPECT_EQ(8, even.back());
+
+  auto iter = even.end();
+  --iter;
+  --iter;
+  EXPECT_EQ(6, *iter);
+
+  auto const none = ::portable_stl::views::filter(vec, [](std::int32_t value) { return value > 100; });
+  EXPECT_TRUE(none.empty());
+  EXPECT_TRUE(none.begin() == none.end());
+}
+
+TEST(ranges_views, transform) {
+  static_cast<void>(test_info_);
+
+  auto       vec     = test_ranges_views_helper::make_vector(5);
+  auto const squares = vec | ::portable_stl::views::transform([](std::int32_t value) { return value * value; });
+
+  EXPECT_EQ(5, squares.size());
+  EXPECT_EQ(9, squares[3]);
+  EXPECT_EQ(16, squares.back());
+  EXPECT_EQ(5, squares.end() - squares.begin());
+
+  // the reference result modifies the elements
+  auto const identity = [](std::int32_t &value) -> std::int32_t & { return value; };
+  for (auto &value : vec | ::portable_stl::views::transform(identity)) {
+    value += 10;
+  }
+  EXPECT_EQ(14, vec[4]);
+}
+
+TEST(ranges_views, take_drop) {
+  static_cast<void>(test_info_);
+
+  auto const vec = test_ranges_views_helper::make_vector(10);
+
+  auto const middle = vec | ::portable_stl::views::drop(2) | ::portable_stl::views::take(3);
+  EXPECT_EQ(3, middle.size());
+  EXPECT_EQ(2, middle.front());
+  EXPECT_EQ(4, middle.back());
+
+  EXPECT_EQ(10, (vec | ::portable_stl::views::take(100)).size());
+  EXPECT_TRUE((vec | ::portable_stl::views::drop(100)).empty());
+  EXPECT_TRUE((vec | ::portable_stl::views::take(0)).empty());
+
+  // forward iterators
+  ::portable_stl::list<std::int32_t> lst;
+  for (std::int32_t i{0}; i < 5; ++i) {
+    static_cast<void>(lst.push_back(i));
+  }
+  std::int32_t sum{0};
+  for (auto value : lst | ::portable_stl::views::drop(1) | ::portable_stl::views::take(3)) {
+    sum += value;
+  }
+  EXPECT_EQ(6, sum);
+
+  sum = 0;
+  for (auto value : lst | ::portable_stl::views::take(10)) {
+    sum += value;
+  }
+  EXPECT_EQ(10, sum);
+}
+
+TEST(ranges_views, iota) {
+  static_cast<void>(test_info_);
+
+  auto const numbers = ::portable_stl::views::iota(1, 5);
+  EXPECT_EQ(4, numbers.size());
+  EXPECT_EQ(3, numbers[2]);
+
+  std::int32_t sum{0};
+  for (auto value : numbers) {
+    sum += value;
+  }
+  EXPECT_EQ(10, sum);
+
+  auto const unbounded = ::portable_stl::views::iota(static_cast<std::uint8_t>(250));
+  EXPECT_EQ(5, unbounded.size());
+
+  auto const reversed_order = ::portable_stl::views::iota(5U, 2U);
+  EXPECT_EQ(-3, reversed_order.end() - reversed_order.begin());
+}
+
+TEST(ranges_views, split) {
+  static_cast<void>(test_info_);
+
+  EXPECT_EQ("[a][bc][][d]", test_ranges_views_helper::split_pieces("a,bc,,d", ','));
+  EXPECT_EQ("[a][]", test_ranges_views_helper::split_pieces("a,", ','));
+  EXPECT_EQ("[][]", test_ranges_views_helper::split_pieces(",", ','));
+  EXPECT_EQ("", test_ranges_views_helper::split_pieces("", ','));
+  EXPECT_EQ("[abc]", test_ranges_views_helper::split_pieces("abc", ','));
+
+  // range pattern
+  ::portable_stl::vector<std::int32_t> vec;
+  for (std::int32_t value : {1, 0, 0, 2, 3, 0, 0, 4}) {
+    static_cast<void>(vec.push_back(value));
+  }
+  ::portable_stl::vector<std::int32_t> pattern;
+  static_cast<void>(pattern.push_back(0));
+  static_cast<void>(pattern.push_back(0));
+
+  std::int32_t pieces{0};
+  std::int32_t digits{0};
+  for (auto piece : vec | ::portable_stl::views::split(pattern)) {
+    ++pieces;
+    for (auto value : piece) {
+      digits = digits * 10 + value;
+    }
+  }
+  EXPECT_EQ(3, pieces);
+  EXPECT_EQ(1234, digits);
+
+  // empty pattern splits into single elements
+  pieces = 0;
+  for (auto piece : ::portable_stl::views::split(vec, ::portable_stl::vector<std::int32_t>{})) {
+    ++pieces;
+    EXPECT_EQ(1, piece.size());
+  }
+  EXPECT_EQ(8, pieces);
+}
+
+TEST(ranges_views, join) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::vector<::portable_stl::vector<std::int32_t>> nested;
+  static_cast<void>(nested.push_back(test_ranges_views_helper::make_vector(2)));
+  static_cast<void>(nested.push_back(test_ranges_views_helper::make_vector(0)));
+  static_cast<void>(nested.push_back(test_ranges_views_helper::make_vector(3)));
+  static_cast<void>(nested.push_back(test_ranges_views_helper::make_vector(0)));
+
+  std::int32_t const expected_values[]{0, 1, 0, 1, 2};
+  std::int32_t       index{0};
+  for (auto value : nested | ::portable_stl::views::join) {
+    EXPECT_EQ(expected_values[index], value);
+    ++index;
+  }
+  EXPECT_EQ(5, index);
+
+  ::portable_stl::vector<::portable_stl::vector<std::int32_t>> empty_nested;
+  static_cast<void>(empty_nested.push_back(test_ranges_views_helper::make_vector(0)));
+  EXPECT_TRUE((empty_nested | ::portable_stl::views::join).empty());
+
+  // split and join back without the separators
+  ::portable_stl::string_view const text{"ab,c,,de"};
+  std::string                       joined;
+  for (char character : text | ::portable_stl::views::split(',') | ::portable_stl::views::join) {
+    joined += character;
+  }
+  EXPECT_EQ("abcde", joined);
+}
+
+TEST(ranges_views, zip) {
+  static_cast<void>(test_info_);
+
+  auto         vec = test_ranges_views_helper::make_vector(10);
+  std::int64_t array[]{10, 20, 30};
+
+  auto const zipped = ::portable_stl::views::zip(vec, array);
+  EXPECT_EQ(3, zipped.size());
+
+  std::int64_t sum{0};
+  for (auto values : zipped) {
+    sum += ::portable_stl::get<0>(values) * ::portable_stl::get<1>(values);
+    ++::portable_stl::get<1>(values);
+  }
+  EXPECT_EQ(80, sum);
+  EXPECT_EQ(11, array[0]);
+  EXPECT_EQ(21, ::portable_stl::get<1>(zipped[1]));
+
+  // forward iterators, the shortest range ends the view
+  ::portable_stl::list<std::int32_t> lst;
+  static_cast<void>(lst.push_back(7));
+  static_cast<void>(lst.push_back(8));
+  std::int32_t count{0};
+  for (auto values : ::portable_stl::views::zip(lst, ::portable_stl::views::iota(100))) {
+    EXPECT_EQ(7 + count, ::portable_stl::get<0>(values));
+    EXPECT_EQ(100 + count, ::portable_stl::get<1>(values));
+    ++count;
+  }
+  EXPECT_EQ(2, count);
+}
+
+TEST(ranges_views, chunk) {
+  static_cast<void>(test_info_);
+
+  auto const vec = test_ranges_views_helper::make_vector(7);
+
+  ::portable_stl::size_t const expected_sizes[]{3, 3, 1};
+  std::int32_t                 index{0};
+  for (auto batch : vec | ::portable_stl::views::chunk(3)) {
+    EXPECT_EQ(expected_sizes[index], batch.size());
+    EXPECT_EQ(index * 3, batch.front());
+    ++index;
+  }
+  EXPECT_EQ(3, index);
+
+  EXPECT_TRUE((test_ranges_views_helper::make_vector(0) | ::portable_stl::views::chunk(3)).empty());
+}
+
+TEST(ranges_views, composition) {
+  static_cast<void>(test_info_);
+
+  auto const vec      = test_ranges_views_helper::make_vector(20);
+  auto const pipeline = ::portable_stl::views::filter([](std::int32_t value) { return 0 == (value % 3); })
+                      | ::portable_stl::views::transform([](std::int32_t value) { return value * 2; })
+                      | ::portable_stl::views::drop(1);
+
+  std::int32_t sum{0};
+  for (auto value : vec | pipeline | ::portable_stl::views::take(3)) {
+    sum += value;
+  }
+  // 6 + 12 + 18
+  EXPECT_EQ(36, sum);
+
+  // the iterators are trivially copyable
+  auto const filtered = vec | ::portable_stl::views::filter([](std::int32_t value) { return value > 0; });
+  EXPECT_TRUE((std::is_trivially_copyable<decltype(filtered.begin())>{}));
+  EXPECT_TRUE((std::is_trivially_copyable<decltype((vec | pipeline).begin())>{}));
+  EXPECT_TRUE((std::is_trivially_copyable<decltype(::portable_stl::views::zip(vec, vec).begin())>{}));
+  EXPECT_TRUE((std::is_trivially_copyable<decltype((vec | ::portable_stl::views::chunk(2)).begin())>{}));
+}
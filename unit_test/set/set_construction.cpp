@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <portable_stl/set/set.h>
+#include <vector>
 
 #include "../common/counter.h"
 #include "../common/move_only.h"
@@ -357,6 +358,118 @@ TEST(set, make_set_iter_iter_comp_alloc) {
   }
 }
 
+TEST(set, make_set_sorted_allocations) {
+  static_cast<void>(test_info_);
+
+  std::int32_t const sorted_arr[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+  // the linear build allocates one node per element
+  {
+    test_allocator_helper::test_allocator_statistics stat;
+    {
+      auto result = ::portable_stl::set<std::int32_t, t_compare, t_allocator2>::make_set(
+        sorted_arr, sorted_arr + 8, t_compare(3), t_allocator2(&stat));
+      ASSERT_TRUE(result);
+      ASSERT_EQ(8, result.value().size());
+      ASSERT_EQ(8, stat.m_alloc_count);
+    }
+    ASSERT_EQ(0, stat.m_alloc_count);
+  }
+
+  // the nodes allocated before the failure are released
+  {
+    test_allocator_helper::test_allocator_statistics stat;
+    stat.m_throw_after = 5;
+
+    auto result = ::portable_stl::set<std::int32_t, t_compare, t_allocator2>::make_set(
+      sorted_arr, sorted_arr + 8, t_compare(3), t_allocator2(&stat));
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+    ASSERT_EQ(0, stat.m_alloc_count);
+  }
+}
+
+TEST(set, constructor_sorted_unique) {
+  static_cast<void>(test_info_);
+
+  for (std::int32_t num{0}; num < 130; ++num) {
+    std::vector<std::int32_t> values;
+    for (std::int32_t i{0}; i < num; ++i) {
+      values.push_back(i);
+    }
+
+    ::portable_stl::set<std::int32_t> st(::portable_stl::sorted_unique_t{}, values.begin(), values.end());
+
+    ASSERT_EQ(num, st.size());
+    ASSERT_TRUE(std::equal(st.begin(), st.end(), values.begin()));
+
+    // the tree stays valid after the modification
+    for (std::int32_t i{0}; i < num; i += 2) {
+      ASSERT_EQ(1, st.erase(i));
+    }
+    ASSERT_TRUE(::portable_stl::get<1>(st.insert(num).value()));
+    ASSERT_EQ(num / 2 + 1, st.size());
+  }
+
+  // bad alloc
+  {
+    t_tree_allocator::m_counter_ok_allocation = 2;
+
+    try {
+      ::portable_stl::set<std::int32_t, ::portable_stl::less<std::int32_t>, t_allocator> st(
+        ::portable_stl::sorted_unique_t{}, test_set_helper::arr, test_set_helper::arr + 3);
+      ASSERT_TRUE(false);
+    } catch (::portable_stl::bad_alloc<> &) {
+    }
+
+    t_tree_allocator::m_counter_ok_allocation = 10000;
+  }
+}
+
+TEST(set, make_set_sorted_unique) {
+  static_cast<void>(test_info_);
+
+  {
+    auto result = ::portable_stl::set<std::int32_t, t_compare, t_allocator2>::make_set(
+      ::portable_stl::sorted_unique_t{}, test_set_helper::arr, test_set_helper::arr + 3, t_compare(3), t_allocator2());
+    ASSERT_TRUE(result);
+
+    auto st = result.value();
+    ASSERT_EQ(3, st.size());
+    ASSERT_EQ(t_compare(3), st.key_comp());
+    EXPECT_EQ(1, *st.begin());
+    EXPECT_EQ(3, *st.rbegin());
+  }
+
+  // bad alloc
+  {
+    t_tree_allocator::m_counter_ok_allocation = 1;
+
+    auto result = ::portable_stl::set<std::int32_t, ::portable_stl::less<std::int32_t>, t_allocator>::make_set(
+      ::portable_stl::sorted_unique_t{}, test_set_helper::arr, test_set_helper::arr + 3);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+
+    t_tree_allocator::m_counter_ok_allocation = 10000;
+  }
+}
+
+TEST(set, insert_iter_iter_unsorted) {
+  static_cast<void>(test_info_);
+
+  // sorted prefix is linked at once, the rest is inserted one by one
+  std::int32_t const values[] = {1, 2, 2, 5, 8, 3, 8, 0, 9, 4};
+
+  ::portable_stl::set<std::int32_t> st;
+  ASSERT_TRUE(st.insert(std::begin(values), std::end(values)));
+
+  std::int32_t const expected_values[] = {0, 1, 2, 3, 4, 5, 8, 9};
+  ASSERT_EQ(8, st.size());
+  ASSERT_TRUE(std::equal(st.begin(), st.end(), std::begin(expected_values)));
+}
+
 TEST(set, constructor_copy) {
   static_cast<void>(test_info_);
 
@@ -752,3 +752,25 @@ TEST(set, equal_range_transparent) {
     ASSERT_EQ(3, nels);
   }
 }
+
+TEST(set, contains_many) {
+  static_cast<void>(test_info_);
+
+  t_set st;
+  for (std::int32_t i{0}; i < 200; ++i) {
+    ASSERT_TRUE(st.insert(i * 3));
+  }
+
+  std::int32_t keys[700];
+  for (std::int32_t i{0}; i < 700; ++i) {
+    keys[i] = (i < 350) ? (i * 2 - 20) : ((i * 211) % 650);
+  }
+  bool            contained[700];
+  t_set::iterator found[700];
+  ASSERT_EQ(contained + 700, st.contains_many(keys, keys + 700, contained));
+  ASSERT_EQ(found + 700, st.find_many(keys, keys + 700, found));
+  for (std::int32_t i{0}; i < 700; ++i) {
+    ASSERT_EQ((keys[i] >= 0) && (keys[i] < 600) && (0 == keys[i] % 3), contained[i]);
+    ASSERT_EQ(st.find(keys[i]), found[i]);
+  }
+}
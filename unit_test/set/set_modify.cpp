@@ -414,3 +414,101 @@ TEST(set, merge) {
     ASSERT_TRUE(test_set_helper::set_equal(dst, t_set2({2, 4, 5}, test_set_helper::throw_comparator(do_throw))));
   }
 }
+
+TEST(set, set_operations) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::set<std::int32_t> set_long;
+  for (std::int32_t i{0}; i < 1000; ++i) {
+    ASSERT_TRUE(set_long.insert(i * 2));
+  }
+  ::portable_stl::set<std::int32_t> set_short{-1, 0, 7, 8, 500, 1001, 1998, 2500};
+
+  std::int32_t dst[1010]{};
+  {
+    std::int32_t const expected_values[] = {0, 8, 500, 1998};
+    EXPECT_EQ(dst + 4, ::portable_stl::set_intersection(set_short, set_long, dst));
+    for (std::int32_t i{0}; i < 4; ++i) {
+      EXPECT_EQ(expected_values[i], dst[i]);
+    }
+    EXPECT_EQ(dst + 4, ::portable_stl::set_intersection(set_long, set_short, dst));
+    EXPECT_EQ(1998, dst[3]);
+  }
+  {
+    std::int32_t const expected_values[] = {-1, 7, 1001, 2500};
+    EXPECT_EQ(dst + 4, ::portable_stl::set_difference(set_short, set_long, dst));
+    for (std::int32_t i{0}; i < 4; ++i) {
+      EXPECT_EQ(expected_values[i], dst[i]);
+    }
+    EXPECT_EQ(dst + 996, ::portable_stl::set_difference(set_long, set_short, dst));
+    EXPECT_EQ(2, dst[0]);
+    EXPECT_EQ(1996, dst[995]);
+  }
+  {
+    EXPECT_EQ(dst + 1004, ::portable_stl::set_union(set_short, set_long, dst));
+    EXPECT_EQ(dst + 1000, ::portable_stl::set_symmetric_difference(set_long, set_short, dst));
+    for (std::int32_t i{1}; i < 1000; ++i) {
+      ASSERT_LT(dst[i - 1], dst[i]);
+    }
+    EXPECT_EQ(dst + 1008, ::portable_stl::merge(set_short, set_long, dst));
+    for (std::int32_t i{1}; i < 1008; ++i) {
+      ASSERT_LE(dst[i - 1], dst[i]);
+    }
+  }
+  {
+    ::portable_stl::set<std::int32_t> const set_sub{0, 8, 500, 1998};
+    EXPECT_TRUE(::portable_stl::includes(set_long, set_sub));
+    EXPECT_FALSE(::portable_stl::includes(set_long, set_short));
+    EXPECT_FALSE(::portable_stl::includes(set_sub, set_long));
+    EXPECT_TRUE(::portable_stl::includes(set_long, ::portable_stl::set<std::int32_t>{}));
+  }
+
+  // finger search from a position
+  EXPECT_EQ(500, *set_long.lower_bound_from(set_long.find(100), 499));
+  EXPECT_EQ(set_long.end(), set_long.lower_bound_from(set_long.find(100), 2000));
+  EXPECT_EQ(100, *set_long.lower_bound_from(set_long.find(100), 100));
+
+  // merge by splicing the nodes
+  {
+    ::portable_stl::set<std::int32_t> set_small{1, 3, 5};
+    ::portable_stl::set<std::int32_t> set_big{2, 4, 5, 6};
+
+    ::portable_stl::set<std::int32_t> result{::portable_stl::merge(set_small, set_big)};
+    ASSERT_TRUE(test_set_helper::set_equal(result, {1, 2, 3, 4, 5, 6}));
+    ASSERT_TRUE(test_set_helper::set_equal(set_small, {5}));
+    ASSERT_TRUE(set_big.empty());
+  }
+}
+
+TEST(set, compact) {
+  static_cast<void>(test_info_);
+
+  test_allocator_helper::test_allocator_statistics alloc_stats;
+  {
+    using t_set_stat = ::portable_stl::set<std::int32_t, ::portable_stl::less<std::int32_t>, t_allocator2>;
+
+    t_set_stat st{::portable_stl::less<std::int32_t>(), t_allocator2(&alloc_stats)};
+    for (std::int32_t i{0}; i < 50; ++i) {
+      ASSERT_TRUE(st.insert((i * 7) % 50));
+    }
+    ASSERT_TRUE(st.compact());
+    ASSERT_EQ(1, alloc_stats.m_alloc_count);
+    // the nodes follow each other in memory in the sorted order
+    std::ptrdiff_t const step{&*::portable_stl::next(st.begin()) - &*st.begin()};
+    ASSERT_LT(0, step);
+    for (auto iter = ::portable_stl::next(st.begin()); iter != st.end(); ++iter) {
+      ASSERT_EQ(step, &*iter - &*::portable_stl::prev(iter));
+    }
+
+    // the merged elements leave the block for their own nodes
+    t_set_stat dst{::portable_stl::less<std::int32_t>(), t_allocator2(&alloc_stats)};
+    ASSERT_TRUE(dst.insert(10));
+    st.merge(dst);
+    ASSERT_EQ(1, dst.size());
+    dst.merge(st);
+    ASSERT_EQ(50, dst.size());
+    ASSERT_EQ(1, st.size());
+    ASSERT_EQ(51, alloc_stats.m_alloc_count);
+  }
+  ASSERT_EQ(0, alloc_stats.m_alloc_count);
+}
@@ -0,0 +1,192 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="aho_corasick.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "portable_stl/string/aho_corasick.h"
+#include "portable_stl/string/string_view.h"
+
+namespace test_aho_corasick_helper {
+/**
+ * @brief Match as (offset, pattern) for sorting.
+ */
+using match_t = std::tuple<std::size_t, std::size_t>;
+
+/**
+ * @brief Finds all occurrences of the patterns with basic_string_view::find.
+ * Equal patterns are reported with the id of the first one.
+ * @tparam t_char_type Character type.
+ * @param patterns the patterns.
+ * @param text the text.
+ * @return sorted matches.
+ */
+template<class t_char_type>
+std::vector<match_t> naive_matches(std::vector<::portable_stl::basic_string_view<t_char_type>> const &patterns,
+                                   ::portable_stl::basic_string_view<t_char_type>                     text) {
+  std::vector<match_t> result;
+  for (std::size_t id{0}; id < patterns.size(); ++id) {
+    if (patterns[id].empty()
+        || (std::find(patterns.begin(), patterns.begin() + static_cast<std::ptrdiff_t>(id), patterns[id])
+            != patterns.begin() + static_cast<std::ptrdiff_t>(id))) {
+      continue;
+    }
+    for (std::size_t pos{text.find(patterns[id])}; pos != text.npos; pos = text.find(patterns[id], pos + 1)) {
+      result.emplace_back(pos, id);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/**
+ * @brief Finds all occurrences of the patterns with the automaton scan.
+ * @tparam t_automaton the type of automaton.
+ * @param automaton the automaton.
+ * @param text the text.
+ * @return sorted matches.
+ */
+template<class t_automaton>
+std::vector<match_t> scan_matches(t_automaton const &automaton, typename t_automaton::view_type text) {
+  std::vector<match_t> result;
+  automaton.scan(text, [&result](std::size_t pattern, std::size_t offset) {
+    result.emplace_back(offset, pattern);
+  });
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/**
+ * @brief Finds all occurrences of the patterns with the lazy range.
+ * @tparam t_automaton the type of automaton.
+ * @param automaton the automaton.
+ * @param text the text.
+ * @return sorted matches.
+ */
+template<class t_automaton>
+std::vector<match_t> range_matches(t_automaton const &automaton, typename t_automaton::view_type text) {
+  std::vector<match_t> result;
+  for (auto const &match : automaton.matches(text)) {
+    result.emplace_back(match.offset, match.pattern);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+} // namespace test_aho_corasick_helper
+
+TEST(aho_corasick, classic) {
+  static_cast<void>(test_info_);
+
+  std::vector<::portable_stl::string_view> const patterns{"he", "she", "his", "hers", "", "she"};
+  ::portable_stl::string_view const              text{"ushers and his sheep"};
+
+  for (auto const mode : {::portable_stl::aho_corasick_mode::dense, ::portable_stl::aho_corasick_mode::lean}) {
+    ::portable_stl::aho_corasick<char> const automaton(patterns.begin(), patterns.end(), mode);
+    EXPECT_EQ(mode, automaton.mode());
+    EXPECT_EQ(6, automaton.pattern_count());
+    EXPECT_EQ(10, automaton.state_count());
+
+    // the longest pattern first for the same end
+    std::vector<test_aho_corasick_helper::match_t> found;
+    automaton.scan(text, [&found](std::size_t pattern, std::size_t offset) {
+      found.emplace_back(offset, pattern);
+    });
+    std::vector<test_aho_corasick_helper::match_t> const expected_matches{
+      {1, 1}, {2, 0}, {2, 3}, {11, 2}, {15, 1}, {16, 0}};
+    EXPECT_EQ(expected_matches, found);
+
+    found.clear();
+    for (auto const &match : automaton.matches(text)) {
+      found.emplace_back(match.offset, match.pattern);
+    }
+    EXPECT_EQ(expected_matches, found);
+
+    auto const range = automaton.matches("nothing");
+    EXPECT_TRUE(range.begin() == range.end());
+  }
+}
+
+TEST(aho_corasick, make_aho_corasick) {
+  static_cast<void>(test_info_);
+
+  {
+    std::vector<::portable_stl::string_view> const patterns;
+    auto const result = ::portable_stl::aho_corasick<char>::make_aho_corasick(patterns.begin(), patterns.end());
+    ASSERT_TRUE(result);
+    EXPECT_EQ(0, result.value().pattern_count());
+    EXPECT_EQ(1, result.value().state_count());
+    EXPECT_TRUE(test_aho_corasick_helper::scan_matches(result.value(), "text").empty());
+  }
+  {
+    char const *const patterns[]{"ab", "b"};
+    auto const        result = ::portable_stl::aho_corasick<char>::make_aho_corasick(
+      patterns, patterns + 2, ::portable_stl::aho_corasick_mode::lean);
+    ASSERT_TRUE(result);
+    std::vector<test_aho_corasick_helper::match_t> const expected_matches{{0, 0}, {1, 1}, {2, 1}, {3, 1}};
+    EXPECT_EQ(expected_matches, test_aho_corasick_helper::scan_matches(result.value(), "abbb"));
+  }
+}
+
+TEST(aho_corasick, random) {
+  static_cast<void>(test_info_);
+
+  std::mt19937 gen(5U);
+  for (std::size_t alphabet : {2U, 4U, 26U}) {
+    std::uniform_int_distribution<int> letter(0, static_cast<int>(alphabet) - 1);
+    std::uniform_int_distribution<int> length(1, 6);
+
+    std::vector<std::string> storage(200);
+    for (auto &pattern : storage) {
+      pattern.resize(static_cast<std::size_t>(length(gen)));
+      for (auto &chr : pattern) {
+        chr = static_cast<char>('a' + letter(gen));
+      }
+    }
+    std::vector<::portable_stl::string_view> patterns;
+    for (auto const &pattern : storage) {
+      patterns.emplace_back(pattern.data(), pattern.size());
+    }
+    std::string text(2000, 'a');
+    for (auto &chr : text) {
+      chr = static_cast<char>('a' + letter(gen));
+    }
+    ::portable_stl::string_view const text_view(text.data(), text.size());
+
+    auto const expected_matches = test_aho_corasick_helper::naive_matches(patterns, text_view);
+    for (auto const mode : {::portable_stl::aho_corasick_mode::dense, ::portable_stl::aho_corasick_mode::lean}) {
+      ::portable_stl::aho_corasick<char> const automaton(patterns.begin(), patterns.end(), mode);
+      EXPECT_EQ(expected_matches, test_aho_corasick_helper::scan_matches(automaton, text_view));
+      EXPECT_EQ(expected_matches, test_aho_corasick_helper::range_matches(automaton, text_view));
+    }
+  }
+}
+
+TEST(aho_corasick, wide_char) {
+  static_cast<void>(test_info_);
+
+  // bytes of the patterns occur inside the characters of the text
+  std::vector<::portable_stl::basic_string_view<char16_t>> const patterns{
+    u"Ăȁ", u"ȁ", u"Ă", u"̂Ă"};
+  ::portable_stl::basic_string_view<char16_t> const text{u"Ăȁ̂ĂȁĂĂ"};
+
+  auto const expected_matches = test_aho_corasick_helper::naive_matches(patterns, text);
+  EXPECT_EQ(9, expected_matches.size());
+  for (auto const mode : {::portable_stl::aho_corasick_mode::dense, ::portable_stl::aho_corasick_mode::lean}) {
+    ::portable_stl::aho_corasick<char16_t> const automaton(patterns.begin(), patterns.end(), mode);
+    EXPECT_EQ(expected_matches, test_aho_corasick_helper::scan_matches(automaton, text));
+    EXPECT_EQ(expected_matches, test_aho_corasick_helper::range_matches(automaton, text));
+  }
+}
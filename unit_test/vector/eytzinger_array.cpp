@@ -0,0 +1,156 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="eytzinger_array.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../common/test_allocator.h"
+#include "portable_stl/vector/eytzinger_array.h"
+
+namespace test_eytzinger_array_helper {
+/**
+ * @brief Checks the lookups of the array built from the sorted values against the std algorithms.
+ * @param values the sorted values.
+ */
+inline void check_lookups(std::vector<std::int32_t> const &values) {
+  ::portable_stl::eytzinger_array<std::int32_t> array(values.data(), values.data() + values.size());
+  ASSERT_EQ(values.size(), array.size());
+
+  std::int32_t const last_value{values.empty() ? 0 : values.back() + 1};
+  for (std::int32_t value{-1}; value <= last_value; ++value) {
+    auto const expected_lower = std::lower_bound(values.begin(), values.end(), value);
+    auto const expected_upper = std::upper_bound(values.begin(), values.end(), value);
+
+    auto const lower = array.lower_bound(value);
+    if (expected_lower == values.end()) {
+      ASSERT_EQ(array.end(), lower);
+    } else {
+      ASSERT_NE(array.end(), lower);
+      ASSERT_EQ(*expected_lower, *lower);
+    }
+
+    auto const upper = array.upper_bound(value);
+    if (expected_upper == values.end()) {
+      ASSERT_EQ(array.end(), upper);
+    } else {
+      ASSERT_NE(array.end(), upper);
+      ASSERT_EQ(*expected_upper, *upper);
+    }
+
+    bool const found{expected_lower != expected_upper};
+    ASSERT_EQ(found, array.contains(value));
+    ASSERT_EQ(found, array.find(value) != array.end());
+  }
+}
+} // namespace test_eytzinger_array_helper
+
+TEST(eytzinger_array, empty) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::eytzinger_array<std::int32_t> array;
+  EXPECT_TRUE(array.empty());
+  EXPECT_EQ(0, array.size());
+  EXPECT_EQ(array.end(), array.lower_bound(0));
+  EXPECT_EQ(array.end(), array.upper_bound(0));
+  EXPECT_FALSE(array.contains(0));
+}
+
+TEST(eytzinger_array, layout) {
+  static_cast<void>(test_info_);
+
+  // the root is the median, the children of the node k (counting from 1) are 2k and 2k + 1
+  std::int32_t const                            values[]{1, 2, 3, 4, 5, 6, 7};
+  ::portable_stl::eytzinger_array<std::int32_t> array(values, values + 7);
+  std::int32_t const                            expected_values[]{4, 2, 6, 1, 3, 5, 7};
+  ASSERT_EQ(7, array.size());
+  for (::portable_stl::size_t i{0}; i < 7; ++i) {
+    EXPECT_EQ(expected_values[i], array.data()[i]);
+  }
+  EXPECT_EQ(4, *array.begin());
+}
+
+TEST(eytzinger_array, lookups) {
+  static_cast<void>(test_info_);
+
+  // sizes on the full tree boundaries and between them
+  for (std::int32_t size : {1, 2, 3, 7, 8, 9, 100, 1023, 1024, 1025}) {
+    std::vector<std::int32_t> values;
+    for (std::int32_t i{0}; i < size; ++i) {
+      values.push_back(2 * i);
+    }
+    test_eytzinger_array_helper::check_lookups(values);
+  }
+
+  // duplicates
+  std::vector<std::int32_t> values;
+  for (std::int32_t i{0}; i < 300; ++i) {
+    values.push_back(i / 7);
+  }
+  test_eytzinger_array_helper::check_lookups(values);
+}
+
+TEST(eytzinger_array, compare) {
+  static_cast<void>(test_info_);
+
+  /**
+   * @brief Descending order.
+   */
+  auto const greater = [](std::string const &left, std::string const &right) { return left > right; };
+
+  std::string const values[]{"pear", "kiwi", "fig", "apple"};
+  ::portable_stl::eytzinger_array<std::string, decltype(greater)> array(values, values + 4, greater);
+  EXPECT_TRUE(array.contains(std::string("fig")));
+  EXPECT_FALSE(array.contains(std::string("grape")));
+  EXPECT_EQ("fig", *array.lower_bound(std::string("grape")));
+  EXPECT_EQ("apple", *array.upper_bound(std::string("fig")));
+  EXPECT_EQ(array.end(), array.upper_bound(std::string("apple")));
+}
+
+TEST(eytzinger_array, make_eytzinger_array) {
+  static_cast<void>(test_info_);
+
+  /**
+   * @brief Test allocator alias.
+   */
+  using t_alloc = test_allocator_helper::TestSimpleAllocator<std::int32_t>;
+  /**
+   * @brief Array with test allocator.
+   */
+  using t_array = ::portable_stl::eytzinger_array<std::int32_t, ::portable_stl::less<std::int32_t>, t_alloc>;
+
+  std::int32_t const values[]{1, 3, 5, 7, 9};
+  {
+    auto result = ::portable_stl::eytzinger_array<std::int32_t>::make_eytzinger_array(values, values + 5);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(5, result.value().size());
+    EXPECT_EQ(7, *result.value().find(7));
+  }
+  {
+    t_alloc::m_counter_ok_allocation = 0;
+    auto result = t_array::make_eytzinger_array(values, values + 5);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+    t_alloc::resetStat();
+  }
+  {
+    t_alloc::m_counter_ok_allocation = 0;
+    try {
+      t_array array(values, values + 5);
+      ASSERT_TRUE(false);
+    } catch (::portable_stl::bad_alloc<> &) {
+    }
+    t_alloc::resetStat();
+  }
+}
@@ -0,0 +1,141 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="rank_select.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "../common/test_allocator.h"
+#include "portable_stl/vector/rank_select.h"
+
+namespace test_rank_select_helper {
+/**
+ * @brief Fills the bitvector with pseudo-random bits.
+ * @param size the number of bits.
+ * @param density_percent the probability of one in percents.
+ * @return the bitvector.
+ */
+inline ::portable_stl::vector<bool> make_random_bits(::portable_stl::size_t size, std::uint32_t density_percent) {
+  ::portable_stl::vector<bool> vec(size, false);
+  std::uint32_t                state{12345U};
+  for (::portable_stl::size_t i{0U}; i < size; ++i) {
+    state  = state * 1103515245U + 12345U;
+    vec[i] = ((state >> 16U) % 100U) < density_percent;
+  }
+  return vec;
+}
+
+/**
+ * @brief Checks rank1/select1 against the bit by bit results.
+ * @param vec the bitvector.
+ */
+inline void check_rank_select(::portable_stl::vector<bool> const &vec) {
+  ::portable_stl::rank_select<> index(vec);
+  ASSERT_EQ(vec.size(), index.size());
+  ASSERT_EQ(vec.count(), index.count());
+
+  std::vector<::portable_stl::size_t> positions;
+  ::portable_stl::size_t              ones{0U};
+  for (::portable_stl::size_t i{0U}; i < vec.size(); ++i) {
+    ASSERT_EQ(ones, index.rank1(i));
+    ASSERT_EQ(i - ones, index.rank0(i));
+    if (vec[i]) {
+      positions.push_back(i);
+      ++ones;
+    }
+  }
+  ASSERT_EQ(ones, index.rank1(vec.size()));
+
+  for (::portable_stl::size_t rank{0U}; rank < positions.size(); ++rank) {
+    ASSERT_EQ(positions[rank], index.select1(rank));
+  }
+  ASSERT_EQ(::portable_stl::rank_select<>::npos, index.select1(positions.size()));
+}
+} // namespace test_rank_select_helper
+
+TEST(rank_select, empty) {
+  static_cast<void>(test_info_);
+
+  ::portable_stl::vector<bool>  vec;
+  ::portable_stl::rank_select<> index(vec);
+  EXPECT_EQ(0, index.size());
+  EXPECT_EQ(0, index.count());
+  EXPECT_EQ(0, index.rank1(0));
+  EXPECT_EQ(::portable_stl::rank_select<>::npos, index.select1(0));
+}
+
+TEST(rank_select, rank_select) {
+  static_cast<void>(test_info_);
+
+  test_rank_select_helper::check_rank_select(::portable_stl::vector<bool>(100, true));
+  test_rank_select_helper::check_rank_select(::portable_stl::vector<bool>(4096, true));
+  test_rank_select_helper::check_rank_select(::portable_stl::vector<bool>(5000, false));
+
+  // sizes on the block and superblock boundaries and between them
+  for (::portable_stl::size_t size : {511U, 512U, 513U, 4095U, 4096U, 4097U, 20000U}) {
+    test_rank_select_helper::check_rank_select(test_rank_select_helper::make_random_bits(size, 50U));
+  }
+
+  // sparse and dense bitvectors
+  test_rank_select_helper::check_rank_select(test_rank_select_helper::make_random_bits(100000U, 1U));
+  test_rank_select_helper::check_rank_select(test_rank_select_helper::make_random_bits(100000U, 99U));
+}
+
+TEST(rank_select, unused_bits) {
+  static_cast<void>(test_info_);
+
+  // the bits left beyond size() by resize are not counted
+  ::portable_stl::vector<bool> vec(1000, true);
+  vec.resize(700);
+  ::portable_stl::rank_select<> index(vec);
+  EXPECT_EQ(700, index.count());
+  EXPECT_EQ(700, index.rank1(700));
+  EXPECT_EQ(699, index.select1(699));
+  EXPECT_EQ(::portable_stl::rank_select<>::npos, index.select1(700));
+}
+
+TEST(rank_select, make_rank_select) {
+  static_cast<void>(test_info_);
+
+  /**
+   * @brief Bitvector with test allocator.
+   */
+  using t_bit_vector = ::portable_stl::vector<bool, test_allocator_helper::TestSimpleAllocator<bool>>;
+  /**
+   * @brief Allocator of the superblock counters.
+   */
+  using t_super_alloc = test_allocator_helper::TestSimpleAllocator<::portable_stl::uint64_t>;
+
+  t_bit_vector vec(10000, true);
+  {
+    auto result = ::portable_stl::rank_select<test_allocator_helper::TestSimpleAllocator<bool>>::make_rank_select(vec);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(10000, result.value().count());
+    EXPECT_EQ(5000, result.value().select1(5000));
+  }
+  {
+    t_super_alloc::m_counter_ok_allocation = 0;
+    auto result = ::portable_stl::rank_select<test_allocator_helper::TestSimpleAllocator<bool>>::make_rank_select(vec);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(::portable_stl::portable_stl_error::allocate_error, result.error());
+    t_super_alloc::resetStat();
+  }
+  {
+    t_super_alloc::m_counter_ok_allocation = 0;
+    try {
+      ::portable_stl::rank_select<test_allocator_helper::TestSimpleAllocator<bool>> index(vec);
+      ASSERT_TRUE(false);
+    } catch (::portable_stl::bad_alloc<> &) {
+    }
+    t_super_alloc::resetStat();
+  }
+}
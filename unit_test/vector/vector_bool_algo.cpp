@@ -0,0 +1,215 @@
+// ***************************************************************************
+// * Copyright (c) 2024-2025 Paragon Software Group
+// *
+// * Project="Paragon Portable STL" File="vector_bool_algo.cpp"
+// * 
+// * This program and the accompanying materials are made available under the
+// * terms of the MIT License which is available at
+// * https://opensource.org/licenses/MIT.
+// * 
+// * SPDX-License-Identifier: MIT
+// ***************************************************************************
+#include <gtest/gtest.h>
+
+#include "portable_stl/vector/vector_bool.h"
+
+namespace test_vector_bool_algo_helper {
+/**
+ * @brief Bits in the storage word.
+ */
+constexpr ::portable_stl::size_t bits_per_word{8 * sizeof(::portable_stl::vector<bool>::t_storage_type)};
+
+/**
+ * @brief Makes vector with the bits set at the given positions.
+ * @param size the size of the vector.
+ * @param positions the positions of the bits to set.
+ * @return the vector.
+ */
+inline ::portable_stl::vector<bool> make_bits(::portable_stl::size_t                          size,
+                                              std::initializer_list<::portable_stl::size_t> positions) {
+  ::portable_stl::vector<bool> vec(size, false);
+  for (auto pos : positions) {
+    vec[pos] = true;
+  }
+  return vec;
+}
+} // namespace test_vector_bool_algo_helper
+
+TEST(vector_bool_algo, count) {
+  static_cast<void>(test_info_);
+
+  using test_vector_bool_algo_helper::bits_per_word;
+  using test_vector_bool_algo_helper::make_bits;
+
+  {
+    ::portable_stl::vector<bool> vec;
+    EXPECT_EQ(0, vec.count());
+    EXPECT_EQ(0, ::portable_stl::count(vec.begin(), vec.end(), true));
+  }
+
+  // more than four whole words to use the unrolled loop
+  ::portable_stl::size_t const size{bits_per_word * 6 + 5};
+  auto vec = make_bits(size, {0, 3, bits_per_word - 1, bits_per_word, bits_per_word * 5, size - 1});
+
+  EXPECT_EQ(6, vec.count());
+  EXPECT_EQ(6, ::portable_stl::count(vec.begin(), vec.end(), true));
+  EXPECT_EQ(static_cast<std::ptrdiff_t>(size - 6), ::portable_stl::count(vec.cbegin(), vec.cend(), false));
+
+  // unaligned and inside one word
+  EXPECT_EQ(1, ::portable_stl::count(vec.begin() + 1, vec.begin() + 5, true));
+  EXPECT_EQ(3, ::portable_stl::count(vec.begin() + 1, vec.begin() + 5, false));
+  EXPECT_EQ(2, ::portable_stl::count(vec.begin() + 1, vec.begin() + static_cast<std::ptrdiff_t>(bits_per_word), true));
+  EXPECT_EQ(4, ::portable_stl::count(vec.begin() + 3, vec.end() - 1, true));
+
+  // compare with the bit by bit result for every subrange start
+  for (::portable_stl::size_t start{0}; start < size; start += 7) {
+    std::ptrdiff_t expected_count{0};
+    for (::portable_stl::size_t i{start}; i < size; ++i) {
+      if (vec[i]) {
+        ++expected_count;
+      }
+    }
+    EXPECT_EQ(expected_count,
+              ::portable_stl::count(vec.begin() + static_cast<std::ptrdiff_t>(start), vec.end(), true));
+  }
+}
+
+TEST(vector_bool_algo, find) {
+  static_cast<void>(test_info_);
+
+  using test_vector_bool_algo_helper::bits_per_word;
+  using test_vector_bool_algo_helper::make_bits;
+
+  ::portable_stl::size_t const size{bits_per_word * 3 + 10};
+  auto                         vec = make_bits(size, {5, bits_per_word + 2, size - 1});
+
+  EXPECT_EQ(5, ::portable_stl::find(vec.begin(), vec.end(), true) - vec.begin());
+  EXPECT_EQ(static_cast<std::ptrdiff_t>(bits_per_word + 2),
+            ::portable_stl::find(vec.begin() + 6, vec.end(), true) - vec.begin());
+  EXPECT_EQ(static_cast<std::ptrdiff_t>(size - 1),
+            ::portable_stl::find(vec.cbegin() + static_cast<std::ptrdiff_t>(bits_per_word + 3), vec.cend(), true)
+              - vec.cbegin());
+
+  // not found inside the first partial word
+  EXPECT_EQ(vec.begin() + 5, ::portable_stl::find(vec.begin() + 1, vec.begin() + 5, true));
+  // not found in the last partial word
+  EXPECT_EQ(vec.end() - 1,
+            ::portable_stl::find(vec.begin() + static_cast<std::ptrdiff_t>(bits_per_word + 3), vec.end() - 1, true));
+
+  EXPECT_EQ(0, ::portable_stl::find(vec.begin(), vec.end(), false) - vec.begin());
+  EXPECT_EQ(6, ::portable_stl::find(vec.begin() + 5, vec.end(), false) - vec.begin());
+
+  vec.flip();
+  EXPECT_EQ(5, ::portable_stl::find(vec.begin(), vec.end(), false) - vec.begin());
+  EXPECT_EQ(static_cast<std::ptrdiff_t>(bits_per_word + 2),
+            ::portable_stl::find(vec.begin() + 6, vec.end(), false) - vec.begin());
+  EXPECT_EQ(vec.end() - 1, ::portable_stl::find(vec.end() - 1, vec.end(), false));
+}
+
+TEST(vector_bool_algo, any_all_none) {
+  static_cast<void>(test_info_);
+
+  using test_vector_bool_algo_helper::bits_per_word;
+
+  {
+    ::portable_stl::vector<bool> vec;
+    EXPECT_FALSE(vec.any());
+    EXPECT_TRUE(vec.all());
+    EXPECT_TRUE(vec.none());
+  }
+
+  ::portable_stl::vector<bool> vec(bits_per_word * 2 + 3, false);
+  EXPECT_FALSE(vec.any());
+  EXPECT_FALSE(vec.all());
+  EXPECT_TRUE(vec.none());
+
+  vec[bits_per_word * 2 + 2] = true;
+  EXPECT_TRUE(vec.any());
+  EXPECT_FALSE(vec.all());
+  EXPECT_FALSE(vec.none());
+
+  vec.flip();
+  EXPECT_TRUE(vec.any());
+  EXPECT_FALSE(vec.all());
+
+  vec[bits_per_word * 2 + 2] = true;
+  EXPECT_TRUE(vec.all());
+  EXPECT_EQ(vec.size(), vec.count());
+}
+
+TEST(vector_bool_algo, bitwise) {
+  static_cast<void>(test_info_);
+
+  using test_vector_bool_algo_helper::bits_per_word;
+  using test_vector_bool_algo_helper::make_bits;
+
+  ::portable_stl::size_t const size{bits_per_word * 5 + 7};
+
+  auto lhv = make_bits(size, {1, bits_per_word, bits_per_word * 4, size - 1});
+  auto rhv = make_bits(size, {1, bits_per_word + 1, bits_per_word * 4, size - 2});
+
+  {
+    auto vec = lhv;
+    vec &= rhv;
+    EXPECT_TRUE(vec == make_bits(size, {1, bits_per_word * 4}));
+  }
+  {
+    auto vec = lhv;
+    vec |= rhv;
+    EXPECT_TRUE(vec == make_bits(size, {1, bits_per_word, bits_per_word + 1, bits_per_word * 4, size - 2, size - 1}));
+  }
+  {
+    auto vec = lhv;
+    vec ^= rhv;
+    EXPECT_TRUE(vec == make_bits(size, {bits_per_word, bits_per_word + 1, size - 2, size - 1}));
+  }
+  {
+    auto vec = lhv;
+    vec.and_not(rhv);
+    EXPECT_TRUE(vec == make_bits(size, {bits_per_word, size - 1}));
+  }
+  {
+    auto vec = lhv;
+    vec.flip();
+    EXPECT_EQ(size - 4, vec.count());
+    vec.and_not(lhv);
+    EXPECT_EQ(size - 4, vec.count());
+  }
+}
+
+TEST(vector_bool_algo, shift) {
+  static_cast<void>(test_info_);
+
+  using test_vector_bool_algo_helper::bits_per_word;
+  using test_vector_bool_algo_helper::make_bits;
+
+  ::portable_stl::size_t const size{bits_per_word * 2 + 5};
+
+  {
+    auto vec = make_bits(size, {0, 3, bits_per_word - 1, size - 2});
+    vec <<= 2U;
+    EXPECT_TRUE(vec == make_bits(size, {2, 5, bits_per_word + 1}));
+
+    vec <<= bits_per_word;
+    EXPECT_TRUE(vec == make_bits(size, {bits_per_word + 2, bits_per_word + 5, bits_per_word * 2 + 1}));
+
+    vec <<= size;
+    EXPECT_TRUE(vec.none());
+  }
+  {
+    auto vec = make_bits(size, {0, 3, bits_per_word, size - 1});
+    vec >>= 3U;
+    EXPECT_TRUE(vec == make_bits(size, {0, bits_per_word - 3, size - 4}));
+
+    vec >>= bits_per_word + 1U;
+    EXPECT_TRUE(vec == make_bits(size, {size - 5 - bits_per_word}));
+  }
+  {
+    // the bits left beyond size() by resize are not shifted into the elements
+    ::portable_stl::vector<bool> vec(size, true);
+    vec.resize(size - 3);
+    vec >>= 1U;
+    EXPECT_EQ(size - 4, vec.count());
+    EXPECT_FALSE(vec[size - 4]);
+  }
+}